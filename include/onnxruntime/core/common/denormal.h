@@ -9,4 +9,22 @@ namespace onnxruntime {
 // Return true if SSE3 instruction is supported, otherwise return false.
 bool SetDenormalAsZero(bool on);
 
+// Applies flush-to-zero and denormal-as-zero to the calling thread for the lifetime of the object and
+// restores the previous mode on destruction. Use this to give externally-managed threads that call into
+// kernel execution the same floating point environment as the pool threads, which apply the setting when
+// they start. No-op on platforms without denormal control.
+class ScopedDenormalAsZero {
+ public:
+  explicit ScopedDenormalAsZero(bool on);
+  ~ScopedDenormalAsZero();
+
+  ScopedDenormalAsZero(const ScopedDenormalAsZero&) = delete;
+  ScopedDenormalAsZero& operator=(const ScopedDenormalAsZero&) = delete;
+
+ private:
+  bool active_{false};
+  unsigned int previous_denormals_zero_mode_{0};
+  unsigned int previous_flush_zero_mode_{0};
+};
+
 }  // namespace onnxruntime
@@ -96,6 +96,13 @@ class IAllocator {
   // Each implementation of IAllocator can override and provide their own implementation
   virtual void GetStats(AllocatorStats* /*stats*/) { return; }
 
+  // Returns true if successive Alloc() calls are guaranteed to return adjacent memory whenever
+  // possible, i.e. the allocator grows a single contiguous address range (e.g. by mapping
+  // physical pages into a reserved virtual address range) instead of handing out unrelated
+  // blocks. BFCArena uses this to merge adjacent extensions into one allocation region so that
+  // free memory can coalesce across extension boundaries.
+  virtual bool SupportsCoalescing() const { return false; }
+
   static bool CalcMemSizeForArray(size_t nmemb, size_t size, size_t* out) noexcept {
     return CalcMemSizeForArrayWithAlignment(nmemb, size, 0, out);
   }
@@ -0,0 +1,39 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <string>
+
+#include "core/common/basic_types.h"
+
+namespace onnxruntime {
+
+/**
+ * Content-addressed store for blobs produced by compiling execution providers
+ * (e.g. serialized TensorRT engines or OpenVINO blobs).
+ *
+ * Keys are content hashes of fused subgraphs computed by the graph partitioner
+ * (see IExecutionProvider::FusedNodeAndGraph::fused_subgraph_hash), so identical
+ * subgraphs encountered in different models or sessions map to the same entry and
+ * can share one compilation. An EP whose compilation output also depends on state
+ * outside the subgraph (precision flags, optimization profiles, device, ...) must
+ * fold that state into the key it uses.
+ *
+ * The interface is deliberately virtual-only so that execution providers built as
+ * shared libraries can use an instance owned by the core runtime.
+ * Implementations must be thread-safe.
+ */
+class CompiledSubgraphBlobStore {
+ public:
+  virtual ~CompiledSubgraphBlobStore() = default;
+
+  /** Look up the blob stored under 'key'. Returns true and fills 'blob' on a hit. */
+  virtual bool Get(HashValue key, std::string& blob) const = 0;
+
+  /** Store 'blob' under 'key'. Entries are content addressed, so if 'key' is already
+      present the existing blob is kept and the call is a no-op. */
+  virtual void Put(HashValue key, const std::string& blob) = 0;
+};
+
+}  // namespace onnxruntime
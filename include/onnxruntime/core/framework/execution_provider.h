@@ -38,6 +38,8 @@ struct OrtRunOptions;
 
 namespace onnxruntime {
 
+class CompiledSubgraphBlobStore;
+
 /**
    Logical device representation.
 */
@@ -251,6 +253,10 @@ class IExecutionProvider {
     const std::reference_wrapper<onnxruntime::Node> fused_node;
     // GraphViewer that filters the full graph to the nodes that are covered by 'node'
     const std::reference_wrapper<GraphViewer> filtered_graph;
+    // Content hash of the fused subgraph computed by the graph partitioner. Structurally
+    // identical subgraphs from different models or sessions produce the same hash, so it can
+    // key lookups in GetCompiledSubgraphBlobStore(). 0 if no hash was computed.
+    HashValue fused_subgraph_hash{0};
   };
 
   // Fusion approach that is supported
@@ -347,10 +353,29 @@ class IExecutionProvider {
     return InlinedVector<const Node*>();
   }
 
+  /**
+   * Set by the graph partitioner before Compile is called. Compiling EPs can use the store to
+   * share compiled blobs (serialized engines etc.) between sessions, models and processes.
+   * Entries are keyed by FusedNodeAndGraph::fused_subgraph_hash combined with whatever EP
+   * specific compilation state (precision flags, optimization profiles, device, ...) affects
+   * the produced blob.
+   */
+  void SetCompiledSubgraphBlobStore(CompiledSubgraphBlobStore* store) {
+    compiled_subgraph_blob_store_ = store;
+  }
+
+  /** The compiled subgraph blob store, or nullptr if none was provided. */
+  CompiledSubgraphBlobStore* GetCompiledSubgraphBlobStore() const {
+    return compiled_subgraph_blob_store_;
+  }
+
  private:
   const std::string type_;
 
   // It will be set when this object is registered to a session
   const logging::Logger* logger_ = nullptr;
+
+  // owned by the core runtime; set by the graph partitioner
+  CompiledSubgraphBlobStore* compiled_subgraph_blob_store_ = nullptr;
 };
 }  // namespace onnxruntime
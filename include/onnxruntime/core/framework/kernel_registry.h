@@ -5,6 +5,7 @@
 
 #include <string_view>
 
+#include "core/common/inlined_containers.h"
 #include "core/framework/op_kernel.h"
 
 namespace onnxruntime {
@@ -73,6 +74,18 @@ class KernelRegistry {
 
   bool IsEmpty() const { return kernel_creator_fn_map_.empty(); }
 
+  /**
+   * @brief Removes every registered kernel whose KernelCreateInfo is not in kernels_to_keep.
+   *        Used after session initialization to return the memory of the kernels the loaded
+   *        model can never reach. Pointers to the kept entries remain valid. A trimmed
+   *        registry no longer covers its provider's full opset and must not be handed to
+   *        another session; see IsTrimmed.
+   */
+  void Trim(const InlinedHashSet<const KernelCreateInfo*>& kernels_to_keep);
+
+  /** True if Trim removed kernels from this registry. */
+  bool IsTrimmed() const { return trimmed_; }
+
   // This is used by the opkernel doc generator to enlist all registered operators for a given provider's opkernel
   const KernelCreateMap& GetKernelCreateMap() const {
     return kernel_creator_fn_map_;
@@ -103,10 +116,13 @@ class KernelRegistry {
   // type value for each type constraint is provided in type_constraints.
   //
   // Either kernel_type_str_resolver or type_constraints is provided and not both.
+  //
+  // error_str may be nullptr when no mismatch explanation is needed; lookups first scan the
+  // candidates without diagnostics and only build the explanations if no candidate matched.
   static bool VerifyKernelDef(const Node& node, const KernelDef& kernel_def,
                               const IKernelTypeStrResolver* kernel_type_str_resolver,
                               const TypeConstraintMap* type_constraints,
-                              std::string& error_str);
+                              std::string* error_str);
 
   static std::string GetMapKey(std::string_view op_name, std::string_view domain, std::string_view provider) {
     std::string key(op_name);
@@ -121,5 +137,13 @@ class KernelRegistry {
   // Kernel create function map from op name to kernel creation info.
   // key is opname+domain_name+provider_name
   KernelCreateMap kernel_creator_fn_map_;
+
+  // Hash index over kernel_creator_fn_map_ so per-node kernel resolution during session
+  // initialization is a single probe instead of a string-keyed tree search. Values point into
+  // kernel_creator_fn_map_, whose entries have stable addresses; Register and Trim keep the
+  // index in sync.
+  InlinedHashMap<std::string, InlinedVector<gsl::not_null<const KernelCreateInfo*>>> kernel_index_;
+
+  bool trimmed_ = false;
 };
 }  // namespace onnxruntime
@@ -129,6 +129,26 @@ class OpKernel {
     return Status::OK();
   }
 
+  // Override this function to adopt pre-packed buffers that were produced by PrePack() in another
+  // session and persisted (e.g. inside an ORT format model).
+  // Unlike UseSharedPrePackedBuffers(), PrePack() has NOT been invoked on this kernel instance
+  // when this is called, so any side state PrePack() would normally compute (e.g. cached shapes)
+  // must be re-derived from the provided tensor here. Kernels that do not override this decline
+  // the buffers and the initializer is packed as usual.
+  // @param tensor: The constant initializer the buffers were packed from
+  // @param input_idx: The input index of the tensor in this kernel
+  // @param prepacked_buffers: The pre-packed buffers, in the same order PrePack() stored them.
+  //                           As with UseSharedPrePackedBuffers(), the deleters are NULL - the
+  //                           buffers are owned by the session state and outlive the kernel.
+  // @param used_saved_buffers: Boolean flag set by the kernel implementation indicating
+  // that the provided buffers have been adopted by the kernel.
+  virtual Status UseSavedPrePackedBuffers(const Tensor& /*tensor*/, int /*input_idx*/,
+                                          std::vector<BufferUniquePtr>& /*prepacked_buffers*/,
+                                          /*out*/ bool& used_saved_buffers) {
+    used_saved_buffers = false;
+    return Status::OK();
+  }
+
   const OrtDevice GetDevice(OrtMemType mem_type) const;
   const OpKernelInfo& Info() const {
     return *op_kernel_info_;
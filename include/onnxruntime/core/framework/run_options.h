@@ -5,6 +5,7 @@
 
 #include <string>
 #include <atomic>
+#include <functional>
 
 #include "core/common/inlined_containers_fwd.h"
 #include "core/session/onnxruntime_c_api.h"
@@ -35,6 +36,19 @@ struct OrtRunOptions {
   // So it is possible that only some of the nodes are executed.
   bool only_execute_path_to_fetches = false;
 
+  using OutputReadyCallback = std::function<void(const std::string& output_name, const OrtValue& value)>;
+
+  // Optional callback fired while Run() is still in progress, as soon as a requested output has
+  // been produced, so downstream work can overlap with the rest of the graph execution.
+  // Notes:
+  // - the callback runs on the thread that executed the producing kernel, and may be invoked
+  //   concurrently for different outputs when the model executes on multiple streams;
+  // - the OrtValue is the value as produced, so for a non-CPU output the data may still be
+  //   pending on the device stream. The reference stays valid until Run() returns;
+  // - outputs that are not produced by a node (an input fed straight through to an output, or a
+  //   constant initializer) are not streamed and are only available once Run() returns.
+  OutputReadyCallback output_ready_callback;
+
 #ifdef ENABLE_TRAINING
   // Used by onnxruntime::training::TrainingSession. This class is now deprecated.
   // Delete training_mode when TrainingSession is deleted.
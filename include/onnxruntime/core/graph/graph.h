@@ -33,6 +33,7 @@
 #if !defined(ORT_MINIMAL_BUILD)
 #include "core/graph/function_template.h"
 #endif
+#include "core/graph/graph_arena.h"
 #include "core/graph/graph_nodes.h"
 #include "core/graph/node_arg.h"
 #include "core/graph/ort_format_load_options.h"
@@ -43,6 +44,10 @@ struct IndexedSubGraph;
 class Model;
 class OpSignature;
 
+namespace concurrency {
+class ThreadPool;
+}
+
 #if !defined(ORT_MINIMAL_BUILD) || defined(ORT_EXTENDED_MINIMAL_BUILD)
 class RuntimeOptimizationRecordContainer;
 #endif
@@ -485,10 +490,6 @@ class Node {
   void SetFunctionTemplate(const FunctionTemplate& func_template);
 #endif
 
-  static Status LoadFromOrtFormat(const onnxruntime::fbs::Node& fbs_node, Graph& graph,
-                                  const OrtFormatLoadOptions& load_options,
-                                  const logging::Logger& logger, std::unique_ptr<Node>& node);
-
   Status LoadFromOrtFormat(const onnxruntime::fbs::Node& fbs_node,
                            const OrtFormatLoadOptions& load_options,
                            const logging::Logger& logger);
@@ -917,7 +918,7 @@ class Graph {  // NOLINT(clang-analyzer-optin.performance.Padding): preserve exi
   NodeArg& GetOrCreateNodeArg(const std::string& name, const ONNX_NAMESPACE::TypeProto* p_arg_type) {
     auto insert_result = node_args_.emplace(name, nullptr);
     if (insert_result.second) {
-      insert_result.first->second = std::make_unique<NodeArg>(name, p_arg_type);
+      insert_result.first->second = GraphArenaPtr<NodeArg>{graph_arena_.Make<NodeArg>(name, p_arg_type)};
     }
     return *(insert_result.first->second);
   }
@@ -1370,6 +1371,10 @@ class Graph {  // NOLINT(clang-analyzer-optin.performance.Padding): preserve exi
     // Whether to set that no proto sync is required after resolving.
     // Useful for resolving right after loading from a GraphProto.
     bool no_proto_sync_required = false;
+    // Optional thread pool used to run type/shape inference concurrently over independent nodes
+    // (level-synchronous over the topological order). Nodes with subgraphs or function bodies are
+    // always inferred serially. When nullptr, inference runs serially as before.
+    concurrency::ThreadPool* thread_pool = nullptr;
   };
 
   /**
@@ -1594,6 +1599,10 @@ class Graph {  // NOLINT(clang-analyzer-optin.performance.Padding): preserve exi
 
   common::Status InferAndVerifyTypeMatch(Node& node, const ONNX_NAMESPACE::OpSchema& op, const ResolveOptions& options);
 
+  // Runs InferAndVerifyTypeMatch over all nodes in level-synchronous batches, inferring
+  // independent nodes of a level concurrently on options.thread_pool. See ResolveOptions.
+  common::Status InferAndVerifyTypeMatchByLevels(const ResolveOptions& options);
+
   // perform type and shape inferencing on the subgraph and Resolve to validate
   static common::Status InferAndVerifySubgraphTypes(const Node& node, Graph& subgraph,
                                                     const std::vector<const ONNX_NAMESPACE::TypeProto*>& input_types,
@@ -1723,8 +1732,12 @@ class Graph {  // NOLINT(clang-analyzer-optin.performance.Padding): preserve exi
 #endif  // !defined(ORT_MINIMAL_BUILD)
 
   // Graph nodes.
+  // Arena that backs the Node and NodeArg objects owned by this graph. Declared before nodes_ and
+  // node_args_ so it is destroyed after them.
+  GraphArena graph_arena_;
+
   // Element in <nodes_> may be nullptr due to graph optimization.
-  std::vector<std::unique_ptr<Node>> nodes_;
+  std::vector<GraphArenaPtr<Node>> nodes_;
 
   // Wrapper of Graph nodes to provide iteration services that hide nullptr entries
   GraphNodes iterable_nodes_{nodes_};
@@ -1762,7 +1775,7 @@ class Graph {  // NOLINT(clang-analyzer-optin.performance.Padding): preserve exi
   std::unordered_set<const NodeArg*> value_info_;
 
   // All node args owned by <*this> graph. Key is node arg name.
-  std::unordered_map<std::string, std::unique_ptr<NodeArg>> node_args_;
+  std::unordered_map<std::string, GraphArenaPtr<NodeArg>> node_args_;
 
 #if !defined(ORT_MINIMAL_BUILD) || defined(ORT_EXTENDED_MINIMAL_BUILD)
   int name_generator_ = 0;
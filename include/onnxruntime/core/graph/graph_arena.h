@@ -0,0 +1,83 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include "core/common/common.h"
+
+namespace onnxruntime {
+
+/**
+@class GraphArena
+Chunked bump allocator backing the Graph-owned Node and NodeArg objects.
+
+Graph construction makes one small heap allocation per node and per node arg; for graphs with
+thousands of nodes this is a large number of individual allocations with poor locality during
+the optimizer passes. Allocating the objects out of a few large chunks keeps related objects
+adjacent in memory and avoids the per-object heap traffic. Storage is only reclaimed when the
+arena (i.e. the owning Graph) is destroyed.
+*/
+class GraphArena {
+ public:
+  GraphArena() = default;
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(GraphArena);
+
+  /** Construct a T inside the arena.
+  The caller is responsible for running the destructor (typically via GraphArenaPtr);
+  the storage itself is released with the arena. */
+  template <typename T, typename... Args>
+  T* Make(Args&&... args) {
+    return new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+  }
+
+  /** Bump-allocate uninitialized storage with the given size and alignment. */
+  void* Allocate(size_t size, size_t alignment) {
+    size_t offset = (current_offset_ + alignment - 1) & ~(alignment - 1);
+    if (current_chunk_ == nullptr || offset + size > current_chunk_size_) {
+      // operator new[] storage is suitably aligned for any type without extended alignment,
+      // which covers Node and NodeArg.
+      const size_t chunk_size = std::max(kDefaultChunkSize, size);
+      chunks_.push_back(std::make_unique<char[]>(chunk_size));
+      current_chunk_ = chunks_.back().get();
+      current_chunk_size_ = chunk_size;
+      offset = 0;
+    }
+
+    void* p = current_chunk_ + offset;
+    current_offset_ = offset + size;
+    return p;
+  }
+
+ private:
+  static constexpr size_t kDefaultChunkSize = 64 * 1024;
+
+  std::vector<std::unique_ptr<char[]>> chunks_;
+  char* current_chunk_ = nullptr;
+  size_t current_chunk_size_ = 0;
+  size_t current_offset_ = 0;
+};
+
+/** Runs the destructor of an arena-allocated object without freeing its storage;
+the storage belongs to the GraphArena and is released when the arena is destroyed. */
+template <typename T>
+struct GraphArenaDeleter {
+  void operator()(T* p) const noexcept {
+    if (p != nullptr) {
+      p->~T();
+    }
+  }
+};
+
+/** Owning pointer to an arena-allocated object. Behaves like std::unique_ptr except that
+destruction only runs the destructor; the underlying storage stays with the arena. */
+template <typename T>
+using GraphArenaPtr = std::unique_ptr<T, GraphArenaDeleter<T>>;
+
+}  // namespace onnxruntime
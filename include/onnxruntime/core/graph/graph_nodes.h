@@ -7,6 +7,8 @@
 #include <type_traits>
 #include <vector>
 
+#include "core/graph/graph_arena.h"
+
 namespace onnxruntime {
 
 class Node;
@@ -162,19 +164,19 @@ class ValidNodes {
 /**
 Class that provides iteration over all valid nodes in the Graph.
 */
-class GraphNodes : public ValidNodes<std::vector<std::unique_ptr<Node>>> {
+class GraphNodes : public ValidNodes<std::vector<GraphArenaPtr<Node>>> {
  public:
-  GraphNodes(std::vector<std::unique_ptr<Node>>& nodes) : ValidNodes(nodes) {
+  GraphNodes(std::vector<GraphArenaPtr<Node>>& nodes) : ValidNodes(nodes) {
   }
 };
 
 // Variant that only ever allows const access to nodes and optionally allows filtering of the nodes.
-class ConstGraphNodes : public ValidNodes<const std::vector<std::unique_ptr<Node>>> {
+class ConstGraphNodes : public ValidNodes<const std::vector<GraphArenaPtr<Node>>> {
  public:
-  ConstGraphNodes(const std::vector<std::unique_ptr<Node>>& nodes) : ValidNodes(nodes) {
+  ConstGraphNodes(const std::vector<GraphArenaPtr<Node>>& nodes) : ValidNodes(nodes) {
   }
 
-  ConstGraphNodes(const std::vector<std::unique_ptr<Node>>& nodes,
+  ConstGraphNodes(const std::vector<GraphArenaPtr<Node>>& nodes,
                   GraphNodes::NodeFilterFunc&& filter_func)
       : ValidNodes(nodes, std::move(filter_func)) {
   }
@@ -231,6 +231,11 @@ class ThreadPoolProfiler {
   void LogCoreAndBlock(std::ptrdiff_t){};
   void LogThreadId(int) {};
   void LogRun(int) {};
+  void LogSectionEnd(unsigned, unsigned){};
+  void LogSteal(int, bool){};
+  void LogSpinCycles(int, uint64_t){};
+  void LogPark(int) {};
+  void LogUnpark(int) {};
   std::string DumpChildThreadStat() { return {}; }
 };
 #else
@@ -257,6 +262,13 @@ class ThreadPoolProfiler {
   void LogCoreAndBlock(std::ptrdiff_t block_size);  // called in main thread to log core and block size for task breakdown
   void LogThreadId(int thread_idx);                 // called in child thread to log its id
   void LogRun(int thread_idx);                      // called in child thread to log num of run
+  void LogSectionEnd(unsigned tasks_started,
+                     unsigned tasks_revoked);        // called in main thread when a parallel section ends
+  void LogSteal(int thread_idx, bool success);       // called in child thread after a steal attempt
+  void LogSpinCycles(int thread_idx,
+                     uint64_t cycles);               // called in child thread after a spin-wait episode
+  void LogPark(int thread_idx);                      // called in child thread when it blocks waiting for work
+  void LogUnpark(int thread_idx);                    // called in child thread when it wakes up again
   std::string DumpChildThreadStat();                // return all child statitics collected so far
 
  private:
@@ -264,6 +276,12 @@ class ThreadPoolProfiler {
   struct MainThreadStat {
     uint64_t events_[MAX_EVENT] = {};
     int32_t core_ = -1;
+    // per-parallel-section task accounting; a high revoked count means the pool's
+    // workers never picked the tasks up and the loop ran with less parallelism
+    // than requested.
+    uint64_t num_sections_ = 0;
+    uint64_t tasks_started_ = 0;
+    uint64_t tasks_revoked_ = 0;
     std::vector<std::ptrdiff_t> blocks_;  // block size determined by cost model
     std::vector<onnxruntime::TimePoint> points_;
     void LogCore();
@@ -284,6 +302,14 @@ class ThreadPoolProfiler {
   struct ORT_ALIGN_TO_AVOID_FALSE_SHARING ChildThreadStat {
     std::thread::id thread_id_;
     uint64_t num_run_ = 0;
+    // scheduling counters, written only by the owning worker thread:
+    // steal attempts that returned a task / came back empty, iterations of the
+    // spin-wait loop, and transitions into/out of the blocked (parked) state.
+    uint64_t num_steals_ = 0;
+    uint64_t num_failed_steals_ = 0;
+    uint64_t num_spin_cycles_ = 0;
+    uint64_t num_parks_ = 0;
+    uint64_t num_unparks_ = 0;
     onnxruntime::TimePoint last_logged_point_ = Clock::now();
     int32_t core_ = -1;  // core that the child thread is running on
   };
@@ -773,6 +799,10 @@ class ThreadPoolTempl : public onnxruntime::concurrency::ExtendedThreadPoolInter
         env_(env),
         num_threads_(num_threads),
         allow_spinning_(allow_spinning),
+        steal_domain_size_((thread_options.steal_domain_size > 0 &&
+                            thread_options.steal_domain_size < num_threads)
+                               ? static_cast<unsigned>(thread_options.steal_domain_size)
+                               : 0u),
         set_denormal_as_zero_(thread_options.set_denormal_as_zero),
         worker_data_(num_threads),
         all_coprimes_(num_threads),
@@ -831,6 +861,23 @@ class ThreadPoolTempl : public onnxruntime::concurrency::ExtendedThreadPoolInter
     }
   }
 
+  // Request that each worker thread re-pins itself to the given logical
+  // processors.  affinities[i] applies to worker i; an empty entry leaves that
+  // worker's current affinity unchanged.  The update is applied lazily by each
+  // worker from within its work loop rather than synchronously, so there is no
+  // interruption to in-flight work; blocked workers are woken so that they
+  // apply the update promptly.
+  void SetThreadAffinities(std::vector<LogicalProcessors> affinities) {
+    {
+      std::lock_guard<OrtMutex> lock(affinity_update_mutex_);
+      requested_affinities_ = std::move(affinities);
+    }
+    affinity_generation_.fetch_add(1, std::memory_order_release);
+    for (auto& td : worker_data_) {
+      td.EnsureAwake();
+    }
+  }
+
   //......................................................................
   //
   // Parallel sections
@@ -942,6 +989,8 @@ class ThreadPoolTempl : public onnxruntime::concurrency::ExtendedThreadPoolInter
       onnxruntime::concurrency::SpinPause();
     }
 
+    profiler_.LogSectionEnd(tasks_started, ps.tasks_revoked);
+
     // Clear status to allow the ThreadPoolParallelSection to be
     // re-used.
     ps.tasks_finished = 0;
@@ -1492,6 +1541,8 @@ class ThreadPoolTempl : public onnxruntime::concurrency::ExtendedThreadPoolInter
   Environment& env_;
   const unsigned num_threads_;
   const bool allow_spinning_;
+  // Number of consecutive worker ids per steal domain; 0 means a single pool-wide domain.
+  const unsigned steal_domain_size_;
   const bool set_denormal_as_zero_;
   Eigen::MaxSizeVector<WorkerData> worker_data_;
   Eigen::MaxSizeVector<Eigen::MaxSizeVector<unsigned>> all_coprimes_;
@@ -1510,6 +1561,30 @@ class ThreadPoolTempl : public onnxruntime::concurrency::ExtendedThreadPoolInter
   // Default is no control over spinning
   std::atomic<SpinLoopStatus> spin_loop_status_{SpinLoopStatus::kBusy};
 
+  // Per-worker affinities requested at runtime via SetThreadAffinities.
+  // requested_affinities_ is updated under affinity_update_mutex_ and
+  // affinity_generation_ is bumped afterwards so that workers notice the
+  // change from WorkerLoop without taking the lock on the fast path.
+  OrtMutex affinity_update_mutex_;
+  std::vector<LogicalProcessors> requested_affinities_;
+  std::atomic<uint64_t> affinity_generation_{0};
+
+  // Apply the most recently requested affinity for this worker, if any.
+  // Failures are ignored; the request may name processors that are no longer
+  // available, in which case the worker keeps its current affinity.
+  void ApplyRequestedAffinity(int thread_id) {
+    LogicalProcessors processors;
+    {
+      std::lock_guard<OrtMutex> lock(affinity_update_mutex_);
+      if (static_cast<size_t>(thread_id) < requested_affinities_.size()) {
+        processors = requested_affinities_[thread_id];
+      }
+    }
+    if (!processors.empty()) {
+      ORT_IGNORE_RETURN_VALUE(env_.SetSelfThreadAffinity(processors));
+    }
+  }
+
   // Wake any blocked workers so that they can cleanly exit WorkerLoop().  For
   // a clean exit, each thread will observe (1) done_ set, indicating that the
   // destructor has been called, (2) all threads blocked, and (3) no
@@ -1539,13 +1614,25 @@ class ThreadPoolTempl : public onnxruntime::concurrency::ExtendedThreadPoolInter
     SetDenormalAsZero(set_denormal_as_zero_);
     profiler_.LogThreadId(thread_id);
 
+    // Affinity updates requested via SetThreadAffinities are applied lazily by each worker;
+    // track the generation this worker has already applied.
+    uint64_t applied_affinity_generation = 0;
+
     while (!should_exit) {
+      const uint64_t affinity_generation = affinity_generation_.load(std::memory_order_acquire);
+      if (affinity_generation != applied_affinity_generation) {
+        applied_affinity_generation = affinity_generation;
+        ApplyRequestedAffinity(thread_id);
+      }
+
       Task t = q.PopFront();
       if (!t) {
         // Spin waiting for work.
-        for (int i = 0; i < spin_count && !done_; i++) {
-          if (((i + 1) % steal_count == 0)) {
+        int spin_iterations = 0;
+        for (; spin_iterations < spin_count && !done_; spin_iterations++) {
+          if (((spin_iterations + 1) % steal_count == 0)) {
             t = Steal(StealAttemptKind::TRY_ONE);
+            profiler_.LogSteal(thread_id, static_cast<bool>(t));
           } else {
             t = q.PopFront();
           }
@@ -1556,6 +1643,9 @@ class ThreadPoolTempl : public onnxruntime::concurrency::ExtendedThreadPoolInter
           }
           onnxruntime::concurrency::SpinPause();
         }
+        if (spin_iterations > 0) {
+          profiler_.LogSpinCycles(thread_id, static_cast<uint64_t>(spin_iterations));
+        }
 
         // Attempt to block
         if (!t) {
@@ -1609,17 +1699,24 @@ class ThreadPoolTempl : public onnxruntime::concurrency::ExtendedThreadPoolInter
                     }
                   }
                 }
+                if (should_block) {
+                  profiler_.LogPark(thread_id);
+                }
                 return should_block;
               },
               // Post-block update (executed only if we blocked)
               [&]() {
                 blocked_--;
+                profiler_.LogUnpark(thread_id);
               });
           // Thread just unblocked.  Unless we picked up work while
           // blocking, or are exiting, then either work was pushed to
           // us, or it was pushed to an overloaded queue
           if (!t) t = q.PopFront();
-          if (!t) t = Steal(StealAttemptKind::TRY_ALL);
+          if (!t) {
+            t = Steal(StealAttemptKind::TRY_ALL);
+            profiler_.LogSteal(thread_id, static_cast<bool>(t));
+          }
         }
       }
 
@@ -1647,23 +1744,47 @@ class ThreadPoolTempl : public onnxruntime::concurrency::ExtendedThreadPoolInter
 
   Task Steal(StealAttemptKind steal_kind) {
     PerThread* pt = GetPerThread();
+
+    // With steal domains configured (ThreadOptions::steal_domain_size, typically one domain per NUMA
+    // node), prefer victims inside the caller's own domain: cross-domain steals pull task state across
+    // sockets. A TRY_ONE attempt stays within the domain; a TRY_ALL sweep tries the whole domain first
+    // and only then the remaining threads, so work conservation is unchanged.
+    if (steal_domain_size_ > 0 && pt->thread_id >= 0) {
+      const unsigned domain_start =
+          (static_cast<unsigned>(pt->thread_id) / steal_domain_size_) * steal_domain_size_;
+      const unsigned domain_size = std::min(steal_domain_size_, num_threads_ - domain_start);
+      if (domain_size > 1) {
+        Task t = StealFromRange(pt, domain_start, domain_size,
+                                steal_kind == StealAttemptKind::TRY_ALL ? domain_size : 1);
+        if (t || steal_kind == StealAttemptKind::TRY_ONE) {
+          return t;
+        }
+      }
+    }
+
     unsigned size = num_threads_;
     unsigned num_attempts = (steal_kind == StealAttemptKind::TRY_ALL) ? size : 1;
+    return StealFromRange(pt, 0, size, num_attempts);
+  }
+
+  // One round of steal attempts over the half-open range of worker ids
+  // [range_start, range_start + range_size), visited in a pseudo-random permutation.
+  Task StealFromRange(PerThread* pt, unsigned range_start, unsigned range_size, unsigned num_attempts) {
     unsigned r = Rand(&pt->rand);
-    unsigned inc = all_coprimes_[size - 1][r % all_coprimes_[size - 1].size()];
-    unsigned victim = r % size;
+    unsigned inc = all_coprimes_[range_size - 1][r % all_coprimes_[range_size - 1].size()];
+    unsigned victim = r % range_size;
 
     for (unsigned i = 0; i < num_attempts; i++) {
-      assert(victim < size);
-      if (worker_data_[victim].GetStatus() == WorkerData::ThreadStatus::Active) {
-        Task t = worker_data_[victim].queue.PopBack();
+      assert(range_start + victim < num_threads_);
+      if (worker_data_[range_start + victim].GetStatus() == WorkerData::ThreadStatus::Active) {
+        Task t = worker_data_[range_start + victim].queue.PopBack();
         if (t) {
           return t;
         }
       }
       victim += inc;
-      if (victim >= size) {
-        victim -= size;
+      if (victim >= range_size) {
+        victim -= range_size;
       }
     }
 
@@ -132,6 +132,7 @@ namespace concurrency {
 template <typename Environment>
 class ThreadPoolTempl;
 
+class AdaptiveDegreeController;
 class ExtendedThreadPoolInterface;
 class LoopCounter;
 class ThreadPoolParallelSection;
@@ -163,6 +164,17 @@ class ThreadPool {
   // set of threads.
   ~ThreadPool();
 
+  // Joins and destroys all worker threads, leaving the pool in a state where the process image can
+  // be safely snapshotted (fork/CRIU): no live threads remain in the pool. The pool must be idle -
+  // no work may be in flight and no parallel section may be active. Parallel loops run between
+  // Quiesce() and Resume() execute sequentially on the calling thread.
+  void Quiesce();
+
+  // Re-creates the worker threads after Quiesce(), e.g. once the snapshotted process image has been
+  // restored. Calibration results and learned parallelism limits from before the snapshot are kept.
+  // No-op if the pool is not quiesced.
+  void Resume();
+
   // Start and end a multi-loop parallel section.  Parallel loops can
   // be executed directly (without using this API), but entering a
   // parallel section allows the runtime system to amortize loop
@@ -213,6 +225,23 @@ class ThreadPool {
     ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(ParallelSection);
   };
 
+  // Cap the degree of parallelism that parallel loops started by the current
+  // thread will assume, for the lifetime of the scope.  While a cap of N is
+  // active, DegreeOfParallelism returns at most N and loops fork to at most
+  // N-1 helper threads; a cap of 1 runs loops inline in the caller.  Caps only
+  // tighten: nesting a scope with a larger (or non-positive) value keeps the
+  // enclosing cap.  The cap is thread-local, so it naturally extends to
+  // subgraph kernels that control flow ops run on the invoking thread.
+  class DegreeOfParallelismCap {
+   public:
+    explicit DegreeOfParallelismCap(int max_degree_of_parallelism);
+    ~DegreeOfParallelismCap();
+
+   private:
+    int previous_cap_;
+    ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(DegreeOfParallelismCap);
+  };
+
   // The below API allows to disable spinning
   // This is used to support real-time scenarios where
   // spinning between relatively infrequent requests
@@ -221,6 +250,13 @@ class ThreadPool {
 
   void DisableSpinning();
 
+  // Request that each worker thread re-pins itself to the given logical
+  // processors; affinities[i] applies to worker i and an empty entry leaves
+  // that worker unchanged.  The update is applied asynchronously by the
+  // workers themselves.  This is a no-op for pools that do not own their
+  // threads (degree-of-parallelism of 1, or an external Eigen pool).
+  void SetThreadAffinities(std::vector<LogicalProcessors> affinities);
+
   // Schedules fn() for execution in the pool of threads.  The function may run
   // synchronously if it cannot be enqueued.  This will occur if the thread pool's
   // degree-of-parallelism is 1, but it may also occur for implementation-dependent
@@ -393,6 +429,17 @@ class ThreadPool {
   void ParallelForFixedBlockSizeScheduling(std::ptrdiff_t total, std::ptrdiff_t block_size,
                                            const std::function<void(std::ptrdiff_t, std::ptrdiff_t)>& fn);
 
+  // Degree-limited variant of ParallelForFixedBlockSizeScheduling used by the small-loop
+  // fast path in ParallelFor: forks to the caller thread plus at most max_d_of_p - 1
+  // workers instead of fanning out across the whole pool.
+  void ParallelForSmallLoopScheduling(std::ptrdiff_t total, std::ptrdiff_t block_size, int max_d_of_p,
+                                      const std::function<void(std::ptrdiff_t, std::ptrdiff_t)>& fn);
+
+  // Measure the fixed fork/join cost of dispatching work to the pool.  Called once at
+  // construction when the small-loop fast path is enabled (see
+  // ThreadOptions::small_loop_max_helpers); the result sizes the fast path's thresholds.
+  void CalibrateSmallLoopDispatchOverhead();
+
   // Return whether or not the calling thread should run a loop of
   // num_iterations divided in chunks of block_size in parallel.  If not,
   // the caller should run the loop sequentially.
@@ -417,6 +464,13 @@ class ThreadPool {
 
   ThreadOptions thread_options_;
 
+  // Construction parameters retained so Quiesce()/Resume() can destroy and re-create the worker
+  // threads around a process snapshot.
+  Env* env_ = nullptr;
+  std::basic_string<NAME_CHAR_TYPE> name_;
+  int threads_to_create_ = 0;
+  bool low_latency_hint_ = false;
+
   // If a thread pool is created with degree_of_parallelism != 1 then an underlying
   // EigenThreadPool is used to create OS threads and handle work distribution to them.
   // If degree_of_parallelism == 1 then underlying_threadpool_ is left as nullptr
@@ -428,6 +482,15 @@ class ThreadPool {
 
   // Force the thread pool to run in hybrid mode on a normal cpu.
   bool force_hybrid_ = false;
+
+  // Fork/join cost of an empty dispatch, measured by CalibrateSmallLoopDispatchOverhead.
+  // 0 when the small-loop fast path is disabled.
+  uint64_t small_loop_dispatch_overhead_ns_ = 0;
+
+  // Learns, per bucket of loop cost, the degree of parallelism beyond which loops stop
+  // scaling, and clamps future dispatches of that bucket accordingly.  Only allocated when
+  // ThreadOptions::adaptive_degree is set; see the class comment in threadpool.cc.
+  std::unique_ptr<AdaptiveDegreeController> adaptive_degree_controller_;
 };
 
 }  // namespace concurrency
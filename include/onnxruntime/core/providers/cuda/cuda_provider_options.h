@@ -40,4 +40,6 @@ struct OrtCUDAProviderOptionsV2 {
   int use_tf32 = 1;                                                                                            // use TF32
   int fuse_conv_bias = 0;                                                                                      // Enable CUDNN Frontend kernel fusing, results in JIT compiles
   int sdpa_kernel = 0;                                                                                         // Scaled Dot Product Attention kernel option
+  int use_vmm_arena = 0;                                                                                       // back the BFC Arena with the CUDA virtual memory management API so it
+                                                                                                               // grows one contiguous region (falls back to cudaMalloc if unsupported)
 };
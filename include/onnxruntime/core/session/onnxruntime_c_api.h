@@ -38,7 +38,7 @@
  *
  * This value is used by some API functions to behave as this version of the header expects.
  */
-#define ORT_API_VERSION 20
+#define ORT_API_VERSION 21
 
 #ifdef __cplusplus
 extern "C" {
@@ -305,6 +305,7 @@ ORT_RUNTIME_CLASS(OpAttr);
 ORT_RUNTIME_CLASS(Logger);
 ORT_RUNTIME_CLASS(ShapeInferContext);
 ORT_RUNTIME_CLASS(LoraAdapter);
+ORT_RUNTIME_CLASS(TensorPool);
 
 #ifdef _WIN32
 typedef _Return_type_success_(return == 0) OrtStatus* OrtStatusPtr;
@@ -312,6 +313,38 @@ typedef _Return_type_success_(return == 0) OrtStatus* OrtStatusPtr;
 typedef OrtStatus* OrtStatusPtr;
 #endif
 
+/** \brief Snapshot of the runtime statistics collected by an allocator
+ *
+ * All counters are zero for allocators that do not track statistics (e.g. plain device allocators
+ * without an arena). Counters prefixed with `num_arena_` and the free chunk fields are only
+ * populated by arena based allocators.
+ */
+typedef struct OrtAllocatorStats {
+  int64_t num_allocs;                ///< Number of allocations
+  int64_t num_reserves;              ///< Number of Reserve() calls (arena based allocators only)
+  int64_t num_arena_extensions;      ///< Number of arena extensions (arena based allocators only)
+  int64_t num_arena_shrinkages;      ///< Number of arena shrinkages (arena based allocators only)
+  int64_t bytes_in_use;              ///< Number of bytes currently in use
+  int64_t total_allocated_bytes;     ///< Total bytes the allocator has acquired from the underlying device
+  int64_t max_bytes_in_use;          ///< High-water mark of bytes in use
+  int64_t max_alloc_size;            ///< Largest single allocation seen
+  int64_t bytes_limit;               ///< Upper limit of what the allocator can allocate, 0 if unknown
+  int64_t largest_free_chunk_bytes;  ///< Size of the largest free chunk (arena based allocators only)
+} OrtAllocatorStats;
+
+/** \brief Zero-copy view of one input tensor of a kernel context
+ *
+ * Filled by OrtApi::KernelContext_GetInputViews. All pointers alias memory owned by the kernel
+ * context and are only valid for the duration of the kernel's compute call.
+ */
+typedef struct OrtTensorView {
+  const void* data;      ///< Element data; device memory for non-CPU kernels. NULL if the input is absent or not a tensor
+  const int64_t* shape;  ///< Dimensions. NULL when num_dims is 0
+  size_t num_dims;       ///< Number of dimensions; 0 for scalars
+  size_t num_elements;   ///< Product of the dimensions; 1 for scalars
+  ONNXTensorElementDataType element_type;  ///< ONNX_TENSOR_ELEMENT_DATA_TYPE_UNDEFINED if the input is absent or not a tensor
+} OrtTensorView;
+
 /** \brief Memory allocation interface
  *
  * Structure of function pointers that defines a memory allocator. This can be created and filled in by the user for custom allocators.
@@ -329,6 +362,12 @@ typedef struct OrtAllocator {
    * those made during session initialization. This allows for separate memory management strategies for these allocations.
    */
   void*(ORT_API_CALL* Reserve)(struct OrtAllocator* this_, size_t size);  ///< Returns a pointer to an allocated block of `size` bytes
+  /**
+   * @brief Optional function to snapshot the allocator's statistics into `stats`.
+   * Only present if the allocator was created with `version` >= 21; may be NULL if the allocator
+   * does not collect statistics. Implementations must zero-fill fields they do not track.
+   */
+  void(ORT_API_CALL* GetStats)(const struct OrtAllocator* this_, OrtAllocatorStats* stats);
 } OrtAllocator;
 
 typedef void(ORT_API_CALL* OrtLoggingFunction)(
@@ -4741,6 +4780,362 @@ struct OrtApi {
    */
   ORT_API2_STATUS(SetEpDynamicOptions, _Inout_ OrtSession* sess, _In_reads_(kv_len) const char* const* keys,
                   _In_reads_(kv_len) const char* const* values, _In_ size_t kv_len);
+
+  /// @}
+  /// \name OrtSession
+  /// @{
+
+  /** \brief Re-pin the threads of a session's intra-op thread pool at runtime
+   *
+   * Updates the CPU affinity of the session's intra-op worker threads without recreating the session.
+   * This allows concurrent sessions to be moved onto disjoint sets of cores (e.g. one NUMA node each)
+   * in response to changing load. The affinity string uses the same format as the
+   * `kOrtSessionOptionsConfigIntraOpThreadAffinities` session config entry; see
+   * `include\onnxruntime\core\session\onnxruntime_session_options_config_keys.h`.
+   *
+   * The update is applied asynchronously by the worker threads themselves, so in-flight Run() calls
+   * are not interrupted. Returns an error if the session uses a global or external intra-op thread
+   * pool, as those threads may be shared with other sessions.
+   *
+   * \param[in] sess Session to update
+   * \param[in] affinity_str Null-terminated affinity configuration string
+   *
+   * \since Version 1.21
+   */
+  ORT_API2_STATUS(SessionSetIntraOpThreadAffinities, _Inout_ OrtSession* sess, _In_ const char* affinity_str);
+
+  /// @}
+  /// \name OrtAllocator
+  /// @{
+
+  /** \brief Snapshot an allocator's runtime statistics
+   *
+   * Fills `stats` with the counters currently tracked by the allocator: allocation counts, bytes
+   * in use, the high-water mark, arena extension/shrinkage counts and the largest free chunk.
+   * For arena based allocators the snapshot is O(number of size bins) and holds the arena lock
+   * only for that walk, so it is cheap enough to poll from a metrics exporter while inference is
+   * running. A live fragmentation ratio can be derived as
+   * `1 - largest_free_chunk_bytes / (total_allocated_bytes - bytes_in_use)`, and arena growth can
+   * be detected by watching `num_arena_extensions` instead of waiting for an out-of-memory error.
+   *
+   * Returns an error if the allocator does not implement OrtAllocator::GetStats (e.g. a custom
+   * allocator created with an older API version).
+   *
+   * \param[in] ort_allocator Allocator to sample, e.g. from OrtApi::CreateAllocator
+   * \param[out] stats Filled with a snapshot of the allocator's statistics
+   *
+   * \since Version 1.21
+   */
+  ORT_API2_STATUS(AllocatorGetStats, _In_ const OrtAllocator* ort_allocator, _Out_ OrtAllocatorStats* stats);
+
+  /// @}
+  /// \name OrtSession
+  /// @{
+
+  /** \brief Snapshot the per-node kernel latency histograms of a session
+   *
+   * Requires the `kOrtSessionOptionsKernelTimeHistogramSamplingInterval` session config entry to
+   * be set to a sampling interval > 0; see
+   * `include\onnxruntime\core\session\onnxruntime_session_options_config_keys.h`. Collection costs
+   * a few relaxed atomic adds per node invocation, so unlike OrtApi::EnableProfiling it can stay
+   * enabled in production and be polled periodically to spot regressed nodes in live traffic.
+   *
+   * The snapshot is a JSON array with one entry per executed node holding the invocation count,
+   * the number of sampled (timed) invocations, the summed latency in nanoseconds and a
+   * log2-bucketed latency histogram where bucket `b` counts sampled invocations that took
+   * [2^b, 2^(b+1)) nanoseconds. Counters are read without stopping inference, so values are
+   * individually consistent but not a consistent cut across nodes.
+   *
+   * \param[in] sess Session to snapshot
+   * \param[in] allocator Allocator used to allocate the output string
+   * \param[out] out Null-terminated JSON snapshot. Must be freed with OrtAllocator::Free
+   *
+   * \since Version 1.21
+   */
+  ORT_API2_STATUS(SessionGetKernelTimeHistograms, _In_ const OrtSession* sess, _Inout_ OrtAllocator* allocator,
+                  _Outptr_ char** out);
+
+  /** \brief Snapshot the per-run memory watermarks of a session
+   *
+   * Always enabled. For every run, the execution frame tracks the bytes of live frame-owned
+   * allocations per device with a couple of relaxed atomic updates per allocation and records the
+   * peak, keyed by the input-shape signature of that run's feeds. This shows which request shapes
+   * drive memory, unlike OrtApi::AllocatorGetStats whose max_bytes_in_use is a single lifetime
+   * peak with no attribution.
+   *
+   * The snapshot is a JSON array with one entry per observed input-shape signature listing, per
+   * device, the number of runs, the highest per-run peak in bytes and the peak of the most recent
+   * run. Buffers owned by the frame are counted: planned allocations, memory pattern chunks and
+   * graph outputs. Scratch memory allocated inside kernel implementations through their
+   * temp-space allocator is not routed through the frame and is not counted.
+   *
+   * \param[in] sess Session to snapshot
+   * \param[in] allocator Allocator used to allocate the output string
+   * \param[out] out Null-terminated JSON snapshot. Must be freed with OrtAllocator::Free
+   *
+   * \since Version 1.21
+   */
+  ORT_API2_STATUS(SessionGetMemoryWatermarks, _In_ const OrtSession* sess, _Inout_ OrtAllocator* allocator,
+                  _Outptr_ char** out);
+
+  /** \brief Set all strings in a string tensor from one contiguous buffer
+   *
+   * Fills a string tensor from offset+length views over a caller-owned buffer, as produced by
+   * most tokenizer front ends. Element `i` is the byte range [offsets[i], offsets[i+1]) of
+   * \p buffer; strings need not be null terminated and may contain embedded nulls. Compared to
+   * OrtApi::FillStringTensor this avoids one API call and one strlen per element, and elements
+   * short enough for the small-string optimization are stored without a heap allocation.
+   * The buffer only needs to stay alive for the duration of this call.
+   *
+   * \param[in,out] value A tensor of type ONNX_TENSOR_ELEMENT_DATA_TYPE_STRING
+   * \param[in] buffer UTF-8 bytes of all strings, concatenated
+   * \param[in] buffer_length Byte length of \p buffer
+   * \param[in] offsets Monotonically non-decreasing byte offsets into \p buffer. Contains
+   *                    \p offsets_len entries; the last entry must not exceed \p buffer_length
+   * \param[in] offsets_len Count of offsets. Must be the element count of \p value plus one
+   *
+   * \snippet{doc} snippets.dox OrtStatus Return Value
+   *
+   * \since Version 1.21
+   */
+  ORT_API2_STATUS(FillStringTensorFromOffsets, _Inout_ OrtValue* value,
+                  _In_reads_(buffer_length) const char* buffer, size_t buffer_length,
+                  _In_reads_(offsets_len) const size_t* offsets, size_t offsets_len);
+
+  /// @}
+  /// \name OrtKernelContext Custom operator APIs.
+  /// @{
+
+  /** \brief Snapshot zero-copy views of every input of a kernel context in one call
+   *
+   * Intended for the hot path of custom op kernels: one call replaces the per-input sequence of
+   * OrtApi::KernelContext_GetInput, OrtApi::GetTensorTypeAndShape, OrtApi::GetDimensions and
+   * OrtApi::GetTensorData (four calls plus a heap-allocated type-and-shape object per input).
+   * Nothing is copied; the views alias tensor memory owned by the context and are only valid
+   * during the current compute call. Combine with OrtApi::KernelContext_ParallelFor to run the
+   * computation on the session's intra-op thread pool.
+   *
+   * Inputs that are absent (unfed optional inputs) or not tensors yield a view with NULL data
+   * and shape, zero num_dims and num_elements and element_type
+   * ONNX_TENSOR_ELEMENT_DATA_TYPE_UNDEFINED. For kernels running on a non-CPU execution
+   * provider, data points at device memory.
+   *
+   * \param[in] context The kernel context passed to the kernel's compute callback
+   * \param[out] views Array of \p num_views entries, filled in input order
+   * \param[in] num_views Must equal the count from OrtApi::KernelContext_GetInputCount
+   *
+   * \since Version 1.21
+   */
+  ORT_API2_STATUS(KernelContext_GetInputViews, _In_ const OrtKernelContext* context,
+                  _Out_writes_(num_views) OrtTensorView* views, _In_ size_t num_views);
+
+  /// @}
+  /// \name OrtSession
+  /// @{
+
+  /** \brief Report the CPU dispatch tiers and execution provider placements of a session
+   *
+   * Intended to be queried right after session creation so deployment tooling can reject a
+   * placement that landed on hardware where kernels silently dispatch to slower tiers, instead
+   * of discovering the regression on latency dashboards.
+   *
+   * The report is a JSON object with:
+   * - `mlas_dispatch`: space-separated instruction-set tiers the MLAS compute library selected
+   *   for this process (e.g. "sse2 avx avx2 avx512f"); empty on targets without runtime dispatch
+   * - `registered_eps`: the session's execution providers in priority order
+   * - `preferred_ep` and `fallback_nodes`: the nodes of the main graph that were not assigned to
+   *   the highest-priority provider, with their op type and assigned provider
+   *
+   * \param[in] sess Session to report on
+   * \param[in] allocator Allocator used to allocate the output string
+   * \param[out] out Null-terminated JSON report. Must be freed with OrtAllocator::Free
+   *
+   * \since Version 1.21
+   */
+  ORT_API2_STATUS(SessionGetDispatchReport, _In_ const OrtSession* sess, _Inout_ OrtAllocator* allocator,
+                  _Outptr_ char** out);
+
+  /// @}
+  /// \name OrtSessionOptions
+  /// @{
+
+  /** \brief Serialize session options into an opaque binary snapshot
+   *
+   * For services that create many short-lived sessions from the same configuration: build and
+   * validate an ::OrtSessionOptions once, snapshot it, and stamp out per-session copies with
+   * OrtApi::CreateSessionOptionsFromSnapshot, which performs no string parsing or validation.
+   *
+   * The snapshot captures scalar options, thread pool parameters, free dimension overrides and
+   * session config entries. Options holding process-local pointers cannot round-trip through
+   * bytes; snapshotting fails with ORT_INVALID_ARGUMENT if the options carry execution
+   * providers, custom op domains, user logging or thread callbacks, or user-owned initializer
+   * buffers. Append those to each restored copy instead.
+   *
+   * The blob format is internal: it is only guaranteed to restore in the same onnxruntime build
+   * that produced it, and must not be treated as a persistence or exchange format.
+   *
+   * \param[in] options Session options to serialize
+   * \param[in] allocator Allocator used to allocate the output buffer
+   * \param[out] snapshot The serialized snapshot. Must be freed with OrtAllocator::Free
+   * \param[out] size Byte size of \p snapshot
+   *
+   * \snippet{doc} snippets.dox OrtStatus Return Value
+   *
+   * \since Version 1.21
+   */
+  ORT_API2_STATUS(SessionOptionsToSnapshot, _In_ const OrtSessionOptions* options,
+                  _Inout_ OrtAllocator* allocator, _Outptr_ void** snapshot, _Out_ size_t* size);
+
+  /** \brief Create session options from a snapshot taken with OrtApi::SessionOptionsToSnapshot
+   *
+   * Restores without re-validating: config entries and other fields were validated when the
+   * snapshotted options were built. Malformed or truncated blobs are rejected with
+   * ORT_INVALID_ARGUMENT.
+   *
+   * \param[in] snapshot Buffer produced by OrtApi::SessionOptionsToSnapshot
+   * \param[in] size Byte size of \p snapshot
+   * \param[out] out Newly created session options. Must be freed with OrtApi::ReleaseSessionOptions
+   *
+   * \snippet{doc} snippets.dox OrtStatus Return Value
+   *
+   * \since Version 1.21
+   */
+  ORT_API2_STATUS(CreateSessionOptionsFromSnapshot, _In_reads_(size) const void* snapshot,
+                  _In_ size_t size, _Outptr_ OrtSessionOptions** out);
+
+  /** \brief Snapshot the streaming calibration statistics of a session
+   *
+   * Requires the `kOrtSessionOptionsEnableCalibrationCollection` session config entry to be set
+   * to "1"; see `include\onnxruntime\core\session\onnxruntime_session_options_config_keys.h`.
+   * While enabled, every float/double CPU node output (optionally restricted to a list of names
+   * via `kOrtSessionOptionsCalibrationTensorNames`) is scanned once per invocation and folded
+   * into running per-tensor min/max ranges, so quantization calibration can run on production
+   * traffic during normal inference instead of a separate dump-and-replay flow.
+   *
+   * The snapshot is a JSON array with one entry per observed tensor holding its running min, max
+   * and largest absolute value along with the number of elements and updates folded in. It can be
+   * taken while inference is running; entries are individually consistent.
+   *
+   * \param[in] sess Session to snapshot
+   * \param[in] allocator Allocator used to allocate the output string
+   * \param[out] out Null-terminated JSON snapshot. Must be freed with OrtAllocator::Free
+   *
+   * \since Version 1.21
+   */
+  ORT_API2_STATUS(SessionGetCalibrationStats, _In_ const OrtSession* sess, _Inout_ OrtAllocator* allocator,
+                  _Outptr_ char** out);
+
+  /** \brief Report the memory budget activity of a session
+   *
+   * Requires the `kOrtSessionOptionsMemoryBudgetBytes` session config entry to be set to a byte
+   * count; see `include\onnxruntime\core\session\onnxruntime_session_options_config_keys.h`.
+   * The budget is a soft per-session cap on the CPU arena: before an allocation that would grow
+   * the arena past it, the session evicts caches that can be rebuilt at a latency cost and
+   * shrinks unused arena regions, then the allocation proceeds. Allocations never fail because
+   * of the budget.
+   *
+   * The report is a JSON object with the configured budget, the arena's current and peak bytes
+   * in use, the number of allocations that triggered eviction, and per-callback eviction
+   * counts. It can be taken while inference is running.
+   *
+   * \param[in] sess Session to report on
+   * \param[in] allocator Allocator used to allocate the output string
+   * \param[out] out Null-terminated JSON report. Must be freed with OrtAllocator::Free
+   *
+   * \since Version 1.21
+   */
+  ORT_API2_STATUS(SessionGetMemoryBudgetReport, _In_ const OrtSession* sess, _Inout_ OrtAllocator* allocator,
+                  _Outptr_ char** out);
+
+  /// @}
+  /// \name OrtTensorPool
+  /// @{
+
+  /** \brief Create a tensor pool on top of an allocator
+   *
+   * Serving callers typically allocate input/output tensors of the same few shapes on every
+   * request. A tensor pool keeps the buffers of released pooled tensors in free lists bucketed
+   * by byte size (rounded up to a power of two) and hands them back to the next
+   * OrtApi::CreateTensorFromPool call of a matching size, skipping the underlying allocator.
+   *
+   * \param[in] allocator Allocator backing the pool, e.g. the session allocator from
+   *            OrtApi::CreateAllocator. Must stay valid for the lifetime of the pool and of
+   *            every tensor created from it
+   * \param[out] out Newly created pool. Must be freed with OrtApi::ReleaseTensorPool
+   *
+   * \snippet{doc} snippets.dox OrtStatus Return Value
+   *
+   * \since Version 1.21
+   */
+  ORT_API2_STATUS(CreateTensorPool, _Inout_ OrtAllocator* allocator, _Outptr_ OrtTensorPool** out);
+
+  /** \brief Create an ::OrtValue tensor backed by the pool
+   *
+   * Equivalent to OrtApi::CreateTensorAsOrtValue except the buffer comes from the pool's free
+   * lists when a bucket of the right size is available. When the returned value is released its
+   * buffer goes back to the pool instead of the backing allocator.
+   *
+   * Recycled buffers are returned as-is and are never zeroed; treat the tensor's initial
+   * contents as undefined.
+   *
+   * \param[in] pool Tensor pool created with OrtApi::CreateTensorPool
+   * \param[in] shape Pointer to the tensor shape dimensions
+   * \param[in] shape_len The number of tensor shape dimensions
+   * \param[in] type The data type
+   * \param[out] out Newly created ::OrtValue. Must be freed with OrtApi::ReleaseValue. May be
+   *             released after the pool; the pooled memory stays valid until the last such
+   *             value is gone
+   *
+   * \snippet{doc} snippets.dox OrtStatus Return Value
+   *
+   * \since Version 1.21
+   */
+  ORT_API2_STATUS(CreateTensorFromPool, _Inout_ OrtTensorPool* pool, _In_ const int64_t* shape, size_t shape_len,
+                  ONNXTensorElementDataType type, _Outptr_ OrtValue** out);
+
+  /** \brief Return the pool's cached buffers to the backing allocator
+   *
+   * Frees every buffer currently sitting in the pool's free lists. Buffers backing live pooled
+   * tensors are unaffected; they rejoin the pool when those tensors are released.
+   *
+   * \param[in] pool Tensor pool created with OrtApi::CreateTensorPool
+   *
+   * \snippet{doc} snippets.dox OrtStatus Return Value
+   *
+   * \since Version 1.21
+   */
+  ORT_API2_STATUS(ClearTensorPool, _Inout_ OrtTensorPool* pool);
+
+  /* \brief: Release a tensor pool created with OrtApi::CreateTensorPool
+   *
+   * Cached buffers are returned to the backing allocator. Tensors created from the pool may
+   * outlive it; see OrtApi::CreateTensorFromPool.
+   *
+   * \since Version 1.21
+   */
+  ORT_CLASS_RELEASE(TensorPool);
+
+  /** \brief Report the execution provider boundary costs of a session
+   *
+   * Requires the `kOrtSessionOptionsEnableEpBoundaryStats` session config entry to be set to
+   * "1"; see `include\onnxruntime\core\session\onnxruntime_session_options_config_keys.h`.
+   * While enabled, every MemcpyFromHost/MemcpyToHost node the partitioner inserted and every
+   * edge whose producer and consumer were assigned to different execution providers folds the
+   * bytes it moves (and, for Memcpy nodes, the wall time of the copy) into running per-transition
+   * totals, so the cost of an EP-assignment change can be tracked as a metric.
+   *
+   * The report is a JSON array with one entry per EP transition ("<src EP> -> <dst EP>") holding
+   * the number of crossings, the bytes moved, and the count of and time spent in Memcpy nodes.
+   * It can be taken while inference is running; entries are individually consistent.
+   *
+   * \param[in] sess Session to report on
+   * \param[in] allocator Allocator used to allocate the output string
+   * \param[out] out Null-terminated JSON report. Must be freed with OrtAllocator::Free
+   *
+   * \since Version 1.21
+   */
+  ORT_API2_STATUS(SessionGetEpBoundaryReport, _In_ const OrtSession* sess, _Inout_ OrtAllocator* allocator,
+                  _Outptr_ char** out);
 };
 
 /*
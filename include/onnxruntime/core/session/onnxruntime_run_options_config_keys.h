@@ -26,6 +26,25 @@
 // By default, the value for this key is empty (i.e.) no memory arenas are shrunk
 static const char* const kOrtRunOptionsConfigEnableMemoryArenaShrinkage = "memory.enable_memory_arena_shrinkage";
 
+// Time budget in milliseconds for the Run() calls using these options.
+// When set to a positive integer, a deadline of now + the given number of milliseconds is computed when the
+// run starts. The deadline is checked before every kernel launch (including inside control flow subgraphs,
+// so a Loop or Scan gives up between iterations), and a run that exceeds it fails with an error status while
+// any fetches produced so far are discarded. The granularity is cooperative: a kernel that is already
+// executing runs to completion, so the overrun is bounded by the longest single kernel rather than by zero.
+// "0" means no deadline. [DEFAULT]
+static const char* const kOrtRunOptionsConfigDeadlineMs = "run.deadline_ms";
+
+// Maximum intra-op degree of parallelism for the Run() calls using these options.
+// When set to a positive integer N, kernels executed by these runs fan parallel loops out to at most N threads
+// (the calling thread plus N-1 helpers) regardless of the session's intra-op thread pool size; "1" runs all
+// kernels single threaded. The cap lets latency-bound runs (e.g. batch-1 decode steps) avoid fork/join
+// overhead on a session whose pool is sized for throughput-bound runs, without a second session or thread
+// pool. It applies to kernels on the session's intra-op pool, including control flow subgraphs; it does not
+// resize the pool, so concurrent runs without the option are unaffected.
+// "0" means no cap. [DEFAULT]
+static const char* const kOrtRunOptionsConfigIntraOpMaxDegreeOfParallelism = "run.intra_op_max_degree_of_parallelism";
+
 // Set to '1' to not synchronize execution providers with CPU at the end of session run.
 // Per default it will be set to '0'
 // Taking CUDA EP as an example, it omit triggering cudaStreamSynchronize on the compute stream.
@@ -20,6 +20,17 @@
 // If the config value is set to "1" then the prepacking is disabled, otherwise prepacking is enabled (default value)
 static const char* const kOrtSessionOptionsConfigDisablePrepacking = "session.disable_prepacking";
 
+// Declared target ISA for pre-packed weights stored in / loaded from an ORT format model.
+// When saving an ORT format model, setting this to a non-empty value stores the pre-packed form of the constant
+// initializers (as produced by the kernels' PrePack() methods) in the file, tagged with this value.
+// When loading an ORT format model, stored pre-packed weights are only used if this value matches the one recorded
+// in the file, letting supporting kernels skip the packing computation at session initialization.
+// The value is an opaque string that is compared for equality - it is up to the user to pick a suitable name
+// (e.g. "arm64-bf16") and to ensure the model is saved and loaded with equivalent session configuration on
+// hardware the packed layout is valid for.
+// If unset (default), pre-packed weights are neither saved nor loaded.
+static const char* const kOrtSessionOptionsConfigPrepackedWeightsTargetIsa = "session.prepacked_weights_target_isa";
+
 // A value of "1" means allocators registered in the env will be used. "0" means the allocators created in the session
 // will be used. Use this to override the usage of env allocators on a per session level.
 static const char* const kOrtSessionOptionsConfigUseEnvAllocators = "session.use_env_allocators";
@@ -32,6 +43,21 @@ static const char* const kOrtSessionOptionsConfigLoadModelFormat = "session.load
 // If unset, format will default to ONNX unless optimized_model_filepath ends in '.ort'.
 static const char* const kOrtSessionOptionsConfigSaveModelFormat = "session.save_model_format";
 
+// If "1", apply the NHWC layout transformation when saving an ORT format model, so the transposed / re-blocked
+// initializers for execution providers that prefer NHWC are baked into the saved model and do not need to be
+// rewritten at load time. The target execution providers must be registered in the session doing the conversion,
+// and the saved model should only be used with those execution providers. Compiling execution providers still
+// compile their nodes at load time. The default is "0": layout transformation runs when the model is loaded.
+static const char* const kOrtSessionOptionsSaveOrtFormatApplyLayoutTransformation =
+    "session.save_ort_format_apply_layout_transformation";
+
+// Directory for the on-disk optimized model cache. When set and the session is created from a model file path,
+// the post-optimization graph is saved to this directory as an ORT format model keyed by a hash of the model file,
+// ONNX Runtime version, optimization level and registered execution providers. Subsequent sessions with a matching
+// key load the cached copy directly and skip graph optimization and partitioning. The directory is created if needed.
+// Unset (default) disables the cache.
+static const char* const kOrtSessionOptionsOptimizedModelCacheDir = "session.optimized_model_cache_dir";
+
 // If a value is "1", flush-to-zero and denormal-as-zero are applied. The default is "0".
 // When multiple sessions are created, a main thread doesn't override changes from succeeding session options,
 // but threads in session thread pools follow option changes.
@@ -47,6 +73,12 @@ static const char* const kOrtSessionOptionsConfigSetDenormalAsZero = "session.se
 // Its default value is "0" unless the DirectML execution provider is registered, in which case it defaults to "1".
 static const char* const kOrtSessionOptionsDisableQuantQDQ = "session.disable_quant_qdq";
 
+// Limit in bytes on any single tensor produced by constant folding. A node is not folded when one of
+// its computed outputs would exceed the limit, which keeps the pre-computed initializers of large
+// foldable subgraphs memory-bounded.
+// "0" (default): no limit.
+static const char* const kOrtSessionOptionsConstantFoldingSizeCapBytes = "session.constant_folding_size_cap_bytes";
+
 // It controls whether to enable Double QDQ remover and Identical Children Consolidation
 // "0": not to disable. ORT does remove the middle 2 Nodes from a Q->(QD->Q)->QD pairs
 // "1": disable. ORT doesn't remove the middle 2 Nodes from a Q->(QD->Q)->QD pairs
@@ -111,6 +143,58 @@ static const char* const kOrtSessionOptionsDisableSpecifiedOptimizers = "optimiz
 // Using device allocators means the memory allocation is made using malloc/new.
 static const char* const kOrtSessionOptionsUseDeviceAllocatorForInitializers = "session.use_device_allocator_for_initializers";
 
+// Enable or disable content-hash sharing of duplicated initializers. "1": enable; "0": disable.
+// The default is "0".
+// When enabled, constant CPU initializers that carry identical bytes (hashed, then verified by a
+// full byte comparison) are materialized once and every duplicate aliases that single buffer,
+// including duplicates living in control flow subgraphs. Ensembles that embed the same backbone
+// weights several times load them once. Small initializers are left to the ConstantSharing graph
+// transformer, and initializers loaded from external data files are excluded since the OS already
+// shares their memory-mapped pages.
+static const char* const kOrtSessionOptionsShareDuplicateInitializers = "session.share_duplicate_initializers";
+
+// Enable or disable verification of initializer checksums while external data is loaded.
+// "1": enable; "0": disable. The default is "0".
+// When enabled, an external data entry carrying a "checksum" field (the CRC32C of the data
+// segment as hex digits) is verified right after its bytes are read, so the weight file is
+// only traversed once. Entries without a checksum are loaded as usual.
+static const char* const kOrtSessionOptionsVerifyExternalDataChecksum = "session.verify_external_data_checksum";
+
+// Enable or disable a per-thread size-class cache in front of the CPU memory arena.
+// "1": enable; "0": disable. The default is "0".
+// With this option enabled, allocations of up to 4KB (small intermediate tensors such as scalars, shape
+// tensors and index arrays) are served from free lists owned by the calling thread and never contend on
+// the arena's shared lock. The cache is bounded per thread and only applies when the CPU arena is in use
+// (see enable_cpu_mem_arena); note the CPU arena can then not be shrunk via
+// kOrtRunOptionsConfigEnableMemoryArenaShrinkage.
+static const char* const kOrtSessionOptionsEnableCpuArenaThreadCache = "session.enable_cpu_arena_thread_cache";
+
+// Enable or disable TunableOp for the default CPU execution provider.
+// "1": enable; "0": disable. The default is "0".
+// With TunableOp enabled, tunable kernels (currently the fp32 convolution algorithm selection) consult
+// previously collected tuning results instead of built-in heuristics. Results can be collected online by
+// additionally enabling kOrtSessionOptionsCpuTunableOpTuningEnable, or loaded from an earlier session via
+// the tuning results APIs shared with the CUDA and ROCm providers.
+static const char* const kOrtSessionOptionsCpuTunableOpEnable = "session.cpu_tunable_op_enable";
+
+// Enable or disable online tuning for the CPU execution provider's TunableOp.
+// "1": enable; "0": disable. The default is "0".
+// Only takes effect when kOrtSessionOptionsCpuTunableOpEnable is set. The first invocation of a tunable op
+// for a given problem shape profiles all candidate implementations and caches the fastest one.
+static const char* const kOrtSessionOptionsCpuTunableOpTuningEnable = "session.cpu_tunable_op_tuning_enable";
+
+// Specify the maximum time in milliseconds that online tuning may spend profiling the candidate
+// implementations of one tunable op invocation. The default is "0", which means no limit.
+static const char* const kOrtSessionOptionsCpuTunableOpMaxTuningDurationMs =
+    "session.cpu_tunable_op_max_tuning_duration_ms";
+
+// Enable or disable prefetching CPU initializer data on a background thread after session initialization.
+// "1": enable; "0": disable. The default is "0".
+// Initializers backed by a memory-mapped file are materialized lazily by the OS on first access; with this
+// option enabled a background thread touches their pages in execution plan order so the first Run does not
+// pay the page-fault cost, while session creation time and peak RSS stay unaffected.
+static const char* const kOrtSessionOptionsConfigBackgroundInitializerPrefetch = "session.background_initializer_prefetch";
+
 // Configure whether to allow the inter_op/intra_op threads spinning a number of times before blocking
 // "0": thread will block if found no job to run
 // "1": default, thread will spin a number of times before blocking
@@ -214,6 +298,43 @@ static const char* const kNodePartitionConfigFile = "session.node_partition_conf
 //    Hence 64-65 is an invalid configuration, because a windows thread cannot be attached to processors across group boundary.
 static const char* const kOrtSessionOptionsConfigIntraOpThreadAffinities = "session.intra_op_thread_affinities";
 
+// Number of consecutive intra-op worker threads that form one work-steal domain. Work stealing prefers victims
+// inside the caller's domain and only crosses domains when the whole domain is drained. On NUMA hosts, combine
+// this with session.intra_op_thread_affinities so that consecutive threads are bound to the same node and set
+// the value to the number of worker threads per node; steals then stay node-local. "0" (default) keeps a single
+// pool-wide steal domain.
+static const char* const kOrtSessionOptionsConfigIntraOpStealDomainSize = "session.intra_op_steal_domain_size";
+
+// Maximum number of intra-op worker threads (in addition to the calling thread) enlisted for small
+// parallel loops. When set to a positive value the thread pool measures its dispatch overhead at
+// creation, and loops whose estimated cost is small relative to that overhead are run either inline
+// or with a fork limited to this many workers, avoiding the fixed cost of a full fan-out for the
+// many tiny elementwise loops found in some models. Most effective when spinning is left enabled
+// (see kOrtSessionOptionsConfigAllowIntraOpSpinning) so that the enlisted workers pick the work up
+// without a kernel-level wake-up. "0" (default) disables the fast path.
+static const char* const kOrtSessionOptionsConfigIntraOpSmallLoopMaxHelpers = "session.intra_op_small_loop_max_helpers";
+
+// Enable the adaptive degree-of-parallelism controller in the intra-op thread pool.
+// "1": enable; "0": disable. The default is "0".
+// The pool's degree of parallelism is otherwise static, so small parallel loops fan out across
+// every thread and can lose more to synchronization than the extra threads contribute. With this
+// option enabled, loops are bucketed by their cost estimate, a subset of each bucket's dispatches
+// is timed, and future dispatches of the bucket are clamped to the thread count it has been
+// measured to scale to. The learned clamps appear under "adaptive_degree" in the thread pool
+// profiler output (see profiling).
+static const char* const kOrtSessionOptionsConfigIntraOpAdaptiveDegree = "session.intra_op_adaptive_degree";
+
+// Semicolon-separated list of node names to treat as hot when planning initializer memory,
+// ordered hottest first. The initializer inputs of these nodes are placed together at the start
+// of the pre-allocated weight buffer so that the weights touched most often during inference span
+// as few memory pages as possible.
+// The intended workflow is profiling feedback: run a few calibration inferences with profiling
+// enabled (see EnableProfiling), take the node names with the largest accumulated durations from
+// the trace, and set them here when creating the session used for serving.
+// Names that do not match a node in the optimized graph are ignored, as the profile may have been
+// collected with different optimizations applied. Empty (default) keeps the plan order unchanged.
+static const char* const kOrtSessionOptionsConfigProfilingHotNodeNames = "session.profiling_hot_node_names";
+
 // This option will dump out the model to assist debugging any issues with layout transformation,
 // and is primarily intended for developer usage. It is only relevant if an execution provider that requests
 // NHWC layout is enabled such as NNAPI, XNNPACK or QNN.
@@ -272,17 +393,303 @@ static const char* const kOrtSessionOptionEpContextNodeNamePrefix = "ep.context_
 // Share EP related resources across EPs
 static const char* const kOrtSessionOptionShareEpContexts = "ep.share_ep_contexts";
 
+// After session initialization, remove every kernel registration the loaded model can never
+// reach from the kernel registries this session exclusively owns, returning the memory of the
+// full opset x type registration matrix each provider brings into the process. Registries
+// shared with other live sessions are left untouched, and a later session rebuilds the full
+// registry, so this is most effective for processes that serve one model per session.
+// "0": keep all kernel registrations. (default)
+// "1": trim unreachable kernel registrations after initialization.
+static const char* const kOrtSessionOptionsTrimKernelRegistriesAfterInitialization =
+    "session.trim_kernel_registries_after_initialization";
+
+// Directory backing the process wide compiled subgraph blob store that the graph partitioner
+// hands to compiling EPs (see IExecutionProvider::GetCompiledSubgraphBlobStore). Blobs are
+// always shared in memory within the process; setting a directory additionally mirrors them
+// to disk so separate processes can share compilations. The directory is created if needed.
+// The first session to set a directory wins; it cannot be changed for the process afterwards.
+static const char* const kOrtSessionOptionsCompiledSubgraphBlobCacheDir =
+    "session.compiled_subgraph_blob_cache_dir";
+
+// Pin named nodes to specific execution providers before the capability based partitioning pass
+// runs, as the building block for manual layer-wise pipeline splits of a large model across the
+// providers registered in one session. The value is a ';' separated list of
+// "<node name>:<provider type>" entries, e.g.
+//   "encoder_layer_0/MatMul:CUDAExecutionProvider;lm_head/MatMul:CPUExecutionProvider"
+// A pinned node keeps its assignment: the capability pass never reassigns an already assigned
+// node, and required cross device transfers are inserted by the usual memcpy transform passes.
+// Referencing a provider that is not registered in the session, or a node name that does not
+// exist in the model, fails session initialization rather than being silently ignored. The
+// pinned provider must have a kernel for the node; a missing kernel surfaces as the usual kernel
+// creation error. Applies to ONNX format models only.
+static const char* const kOrtSessionOptionsPartitionPinnedNodes = "session.partition_pinned_nodes";
+
+// Cap the number of device stream collections the session keeps for concurrent Run calls.
+// Each collection's streams retain their arena allocations across runs, so with a cap of K the
+// device activation memory of the session is bounded by K x per-run peak even under burst load.
+// When more than K runs execute concurrently, the extra runs wait for a collection to be
+// returned instead of allocating fresh device memory.
+// "0": unbounded; a new collection is created whenever none is cached. (default)
+// "N": at most N collections exist; concurrent runs beyond N block until one is recycled.
+static const char* const kOrtSessionOptionsDeviceStreamPoolSize = "session.device_stream_pool_size";
+
+// Minimum number of nodes between the producer and the first consumer of an activation, within
+// one logic stream, for the session to offload the activation to host memory in between.
+// After the producing kernel is launched the tensor is copied into host staging memory (pinned,
+// when the execution provider registered a pinned allocator) and its device buffer is released;
+// it is copied back to the device right before the first consumer. This trades copy bandwidth
+// for peak device memory, turning a hard out-of-memory into a tunable slowdown for models whose
+// activations exceed device memory.
+// Only activations produced and consumed on a single logic stream whose buffer is not reused by
+// another value are offloaded. Works best with memory patterns disabled: an activation placed
+// inside a memory pattern chunk cannot return its memory when spilled.
+// "0": activation offloading is disabled. (default)
+// "N": activations whose first use is at least N nodes after their producer are offloaded.
+static const char* const kOrtSessionOptionsActivationOffloadMinGap = "session.activation_offload_min_gap";
+
+// Minimum number of nodes between the first and the second consumer of an activation, within
+// one logic stream, for the session to recompute the activation instead of keeping it live in
+// between. The activation is released right after its first consumer and its producer is
+// re-executed right before the second consumer, so at most one of the "long gap" activations
+// occupies device memory at a time during a memory peak.
+// Only activations from cheap, deterministic producers (elementwise ops and layer
+// normalization) with a single output are recomputed, and only when the producer and every
+// consumer run on the same logic stream and no other value is planned to reuse the buffer.
+// The producer's inputs are kept alive until the re-execution.
+// "0": activation recomputation is disabled. (default)
+// "N": qualifying activations whose second use is at least N nodes after the first are
+//      released after the first use and recomputed ahead of the second.
+static const char* const kOrtSessionOptionsActivationRecomputeMinGap = "session.activation_recompute_min_gap";
+
+// Comma-separated list of graph input and output names the caller guarantees to bind in the
+// execution provider's device memory (typically through IOBinding). For a listed def that is
+// consumed on both the provider and CPU, the memcpy transformer keeps the provider side reading
+// or writing the original def — so it stays planned in device memory and the bound tensor is
+// consumed in place — and feeds the CPU consumers through a MemcpyToHost copy instead of staging
+// the def on the host and copying it back to the device.
+// Listed names that do not match a graph input or output are ignored. Binding a listed def in
+// host memory still works; it merely pays the device transfer this option is meant to avoid.
+// "": no declarations. (default)
+static const char* const kOrtSessionOptionsDeviceResidentIo = "session.device_resident_io";
+
+// Memoize the outputs of pure control-flow subgraphs at runtime. When an If branch contains only
+// deterministic ops, no nested control flow and tensor outputs, its outputs are cached under a
+// 128-bit content fingerprint of the inputs fed to it, and a later execution with identical
+// inputs copies the cached outputs instead of running the subgraph. Intended for ensemble graphs
+// that evaluate the same feature-normalization subgraph on the same input several times per run,
+// which compile-time common subexpression elimination cannot merge across branch bodies.
+// CPU tensors only; a fingerprint collision would return the wrong outputs, which is why the
+// feature is opt-in.
+// Option values:
+// - "0": Subgraph memoization is not enabled. [DEFAULT]
+// - "1": Subgraph memoization is enabled.
+static const char* const kOrtSessionOptionsEnableSubgraphMemoization = "session.enable_subgraph_memoization";
+
+// Maximum number of cached results each memoized subgraph keeps (least recently used entries are
+// evicted). Only read when kOrtSessionOptionsEnableSubgraphMemoization is "1".
+// If not provided, default is 16.
+static const char* const kOrtSessionOptionsSubgraphMemoizationMaxEntries = "session.subgraph_memoization_max_entries";
+
+// Keep the attention core of the QAttention CPU kernel quantized: requantize Q/K/V to int8
+// per head and compute QK^T and the context GEMM with int32 accumulation instead of fp32.
+// Only takes effect when there is no attention mask, no past/present state and the
+// attention is bidirectional; other shapes use the fp32 path regardless of this option.
+// Option values:
+// - "0": Quantized attention core is not enabled. [DEFAULT]
+// - "1": Quantized attention core is enabled.
+static const char* const kOrtSessionOptionsEnableQuantizedAttentionCore = "session.enable_quantized_attention_core";
+
 // Gemm fastmath mode provides fp32 gemm acceleration with bfloat16 based matmul.
 // Option values:
 // - "0": Gemm FastMath mode is not enabled. [DEFAULT]
 // - "1": Gemm FastMath mode is enabled.
 static const char* const kOrtSessionOptionsMlasGemmFastMathArm64Bfloat16 = "mlas.enable_gemm_fastmath_arm64_bfloat16";
 
+// Cache the MLAS-packed copy of MatMul's B input across runs when B is a runtime tensor rather
+// than a constant initializer (constant B is already packed once at session initialization).
+// Intended for graphs that repeatedly multiply against a matrix that rarely changes between
+// runs, e.g. attention over a fixed document set; the cached copy is validated against B's
+// buffer address, shape and a hash of its contents, and is re-packed whenever any of them
+// change. Each enabled MatMul node keeps one packed copy of B alive, and unchanged runs still
+// pay one hashing pass over B, so enable this only when packing shows up in profiles.
+// Option values:
+// - "0": Runtime packed B caching is not enabled. [DEFAULT]
+// - "1": Runtime packed B caching is enabled.
+static const char* const kOrtSessionOptionsMatMulRuntimePackedBCache = "session.matmul_runtime_packed_b_cache";
+
+// Gemm fastmath mode provides fp32 gemm acceleration with bfloat16 based matmul
+// on x86-64 processors with Intel AMX tile support (Sapphire Rapids and later).
+// Option values:
+// - "0": Gemm FastMath mode is not enabled. [DEFAULT]
+// - "1": Gemm FastMath mode is enabled.
+static const char* const kOrtSessionOptionsMlasGemmFastMathAmxBfloat16 = "mlas.enable_gemm_fastmath_amx_bfloat16";
+
 // When converting DQ + MatMul -> MatMulNBits, the accuracy level of the MatMulNBits is controlled by this option.
 // Refer to MatMulNBits op schema for more details.
 // If not provided, default is 4.
 static const char* const kOrtSessionOptionsQDQMatMulNBitsAccuracyLevel = "session.qdq_matmulnbits_accuracy_level";
 
+// Derive the GPU graph annotation id (see kOrtRunOptionsConfigCudaGraphAnnotation) from the
+// shapes of the inputs fed to Run(). Use with enable_cuda_graph=true.
+// The value is the maximum number of distinct input-shape signatures ("buckets") to maintain
+// captured graphs for. Each signature gets its own annotation id assigned on first occurrence,
+// so the first Run() with a given set of input shapes captures a graph and later Runs with the
+// same shapes replay it. Runs with a signature beyond the limit execute without capture.
+// An explicit "gpu_graph_id" run option takes precedence over the derived id.
+// If not provided, default is "0" and annotation ids are never derived from shapes.
+static const char* const kOrtSessionOptionsGpuGraphShapeBuckets = "session.gpu_graph_shape_buckets";
+
+// Collect always-on per-node latency histograms that can be snapshot with
+// OrtApi::SessionGetKernelTimeHistograms. The value is the sampling interval: every Nth
+// invocation of a node is timed on the launching thread (host-side wall clock of the kernel's
+// Compute call) and added to a lock-free log2-bucketed histogram, so the per-node overhead is a
+// few relaxed atomic adds and the feature can stay enabled in production, unlike enable_profiling.
+// - "0": disabled. [DEFAULT]
+// - "1": every invocation is timed.
+// - "N": every Nth invocation of each node is timed.
+static const char* const kOrtSessionOptionsKernelTimeHistogramSamplingInterval =
+    "session.kernel_time_histogram_sampling_interval";
+
+// Collect streaming min/max statistics of node outputs during normal inference for quantization
+// calibration, snapshot with OrtApi::SessionGetCalibrationStats. Each observed float/double CPU
+// output is scanned once per invocation for its batch min/max (one pass over data that is
+// usually still cache resident) and merged into running per-tensor ranges, so calibration can
+// run on production traffic instead of a separate dump-and-replay flow.
+// - "0": disabled. [DEFAULT]
+// - "1": enabled.
+static const char* const kOrtSessionOptionsEnableCalibrationCollection =
+    "session.enable_calibration_collection";
+
+// Semicolon-separated list of node output names to restrict calibration collection to. Only
+// read when calibration collection is enabled. An empty list observes every floating point
+// output in the graph.
+// - "": observe all outputs. [DEFAULT]
+static const char* const kOrtSessionOptionsCalibrationTensorNames =
+    "session.calibration_tensor_names";
+
+// Keep the resident set of weight pages close to the execution wavefront, for models whose
+// weights do not fit in RAM. Weights loaded from external data are memory mapped; with this
+// option enabled, executing a node prefetches the weights of upcoming nodes (up to the budget
+// below) and advises the OS to reclaim pages of weights whose last consumer has run, so NVMe
+// reads overlap with compute instead of stalling it. All hints are content preserving and
+// advisory only.
+// - "0": disabled. [DEFAULT]
+// - "1": enabled.
+static const char* const kOrtSessionOptionsEnableWeightStreaming =
+    "session.enable_weight_streaming";
+
+// Byte budget for weight-streaming read-ahead. Only read when weight streaming is enabled.
+// The default is "1073741824" (1 GiB).
+static const char* const kOrtSessionOptionsWeightStreamingBudgetBytes =
+    "session.weight_streaming_budget_bytes";
+
+// Skip recomputation of graph prefixes whose inputs did not change since the previous Run, for
+// workloads that re-run with mostly identical feeds. Each feed is fingerprinted at Run start;
+// deterministic nodes that depend only on unchanged feeds reuse their cached outputs from the
+// run that last executed them, and only the dirty suffix of the graph recomputes. Cached
+// outputs are deep copies of CPU tensors bounded by the budget below; nodes with non-CPU or
+// oversized outputs always execute. Overlapping Run calls temporarily disable the reuse.
+// - "0": disabled. [DEFAULT]
+// - "1": enabled.
+static const char* const kOrtSessionOptionsEnableDeltaExecution =
+    "session.enable_delta_execution";
+
+// Byte budget for the delta-execution output cache. Only read when delta execution is enabled.
+// The default is "268435456" (256 MiB).
+static const char* const kOrtSessionOptionsDeltaExecutionCacheBudgetBytes =
+    "session.delta_execution_cache_budget_bytes";
+
+// Soft per-session byte budget for the CPU arena, for multi-tenant hosts where one session's
+// shape spike should degrade that session's latency rather than grow the process towards an
+// out-of-memory kill. Before an allocation that would push the arena past the budget, the
+// session evicts state that can be rebuilt - the delta-execution output cache, memoized
+// subgraph results - and shrinks the arena's unused regions; the allocation then proceeds, so
+// the budget never makes a Run fail that would have succeeded without it. The hard limit stays
+// the arena's max_mem. Eviction activity is reported by OrtApi::SessionGetMemoryBudgetReport.
+// Ignored with a warning when the session's CPU allocator is not a session-owned arena (e.g.
+// when "session.use_env_allocators" is set, the allocator is shared across sessions and a
+// per-session budget is not meaningful).
+// - "": disabled. [DEFAULT]
+// - "<bytes>": enabled with the given budget, e.g. "1073741824" for 1 GiB.
+static const char* const kOrtSessionOptionsMemoryBudgetBytes =
+    "session.memory_budget_bytes";
+
+// Path to a memory watermarks profile captured from a previous deployment of the same model
+// (the JSON returned by OrtApi::SessionGetMemoryWatermarks). After initialization, each
+// arena-backed allocator is primed with a single allocation of the largest per-run peak the
+// profile recorded for its device, so the arena reaches its steady-state size in one
+// reservation instead of growing through a series of extensions during the first requests.
+// A missing or unreadable file fails session creation; devices in the profile that have no
+// arena in this session are ignored.
+// - "": disabled. [DEFAULT]
+static const char* const kOrtSessionOptionsMemoryWatermarksProfilePath =
+    "session.memory_watermarks_profile_path";
+
+// Serve transient CPU kernel scratch (GetTempSpaceAllocator) from a per-run bump allocator.
+// Each run carves one slab sized from the scratch peak recorded for its input-shape signature,
+// so scratch allocations become a pointer bump with no arena lock and frees cost nothing until
+// the run tears the slab down in one shot. A signature's first run, and any request that does
+// not fit the slab, falls through to the regular allocator. Scratch freed mid-run is not
+// reclaimed until run end, so kernels that repeatedly allocate and free large scratch hold
+// their sum, not their maximum, for the duration of the run.
+// - "0": disabled. [DEFAULT]
+// - "1": enabled.
+static const char* const kOrtSessionOptionsEnableRunScratchArena = "session.enable_run_scratch_arena";
+
+// Space separated list of MLAS instruction set tiers (as named by MlasGetDispatchSummary, e.g.
+// "avx512f amx-int8") that the CPU kernel library must not select; it falls back to the next
+// lower tier as if the hardware lacked the capability. Meant for comparing kernel tiers on the
+// same hardware and for rolling back a problematic tier without rebuilding. The MLAS dispatch
+// tables are process wide and initialize on first use, so only a session created before any
+// MLAS routine has run can apply this; a session that is too late logs a warning and keeps the
+// existing dispatch. The active and hardware-supported tier sets are reported by
+// OrtApi::SessionGetDispatchReport.
+// - "": no override. [DEFAULT]
+static const char* const kOrtSessionOptionsMlasDisabledDispatchTiers =
+    "session.mlas_disabled_dispatch_tiers";
+
+// Capture hardware performance counters (retired instructions, last level cache misses, backend
+// stall cycles) around each kernel invocation on every Nth profiled Run, and attach them to the
+// per-node kernel_time events in the profile output as "hw_instructions", "hw_llc_misses" and
+// "hw_stalled_cycles". This separates kernels that regressed because they execute more
+// instructions from kernels that stall on the memory subsystem, which wall time alone cannot do.
+// Only takes effect while profiling is enabled. Counters are Linux only (perf_event_open,
+// counting the executing thread in user space); where the OS refuses them the profile simply
+// carries no counter args. Runs that are not sampled pay nothing, which keeps the option
+// production safe at a suitably large interval.
+// - "0": disabled. [DEFAULT]
+// - "<N>": capture counters on every Nth Run, e.g. "1" for every run, "100" for one in a hundred.
+static const char* const kOrtSessionOptionsProfileHwPerfCountersRunInterval =
+    "session.profile_hw_perf_counters_run_interval";
+
+// Compress the per-iteration scan outputs of CPU Loop nodes while the loop is still running.
+// A Loop holds every iteration's scan output slice alive until the final concatenation, so a
+// loop producing large slices over many iterations (e.g. a diffusion sampler emitting latents
+// each step) keeps iterations x slice_size bytes live at peak. With this enabled, each slice is
+// compressed with a block zero suppression codec right after its iteration produces it and only
+// decompressed while writing the final concatenated output. The trade is compute for memory:
+// slices pay roughly one extra pass over their bytes each way. A slice is only considered when
+// it lives on CPU, is not a string tensor and is at least 64KB; the first iteration acts as a
+// probe, and an output whose first slice does not shrink by at least 1/8 is stored uncompressed
+// for the rest of the loop so dense data only pays for one slice.
+// - "0": disabled. [DEFAULT]
+// - "1": enabled.
+static const char* const kOrtSessionOptionsEnableLoopScanOutputCompression =
+    "session.enable_loop_scan_output_compression";
+
+// Account the cost of execution provider boundaries: the MemcpyFromHost/MemcpyToHost nodes the
+// partitioner inserts and every edge whose producer and consumer landed on different EPs. Each
+// executed boundary node folds the bytes it moved (and, for Memcpy nodes, the wall time of the
+// copy) into per-transition totals that can be snapshot with OrtApi::SessionGetEpBoundaryReport,
+// so an EP-assignment regression shows up as a metric instead of an investigation. When
+// profiling is also enabled, the corresponding kernel_time events carry "ep_boundary" and
+// "ep_boundary_bytes" args. The boundary structure is classified once at initialization;
+// non-boundary nodes pay one hash lookup per execution.
+// - "0": disabled. [DEFAULT]
+// - "1": enabled.
+static const char* const kOrtSessionOptionsEnableEpBoundaryStats =
+    "session.enable_ep_boundary_stats";
+
 // THIS OPTION IS NOT A REGULAR SESSION OPTION SINCE IT CAN BE MODIFIED AT ANY TIME
 // Meant to be used with SetEpDynamicOptions
 // Specify the type of workload for this session.
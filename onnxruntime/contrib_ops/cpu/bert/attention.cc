@@ -199,6 +199,7 @@ Status Attention<T>::Compute(OpKernelContext* context) const {
   const Tensor* mask_index = context->Input<Tensor>(3);
   const Tensor* past = context->Input<Tensor>(4);
   const Tensor* attention_bias = context->Input<Tensor>(5);
+  const Tensor* past_seq_len = context->Input<Tensor>(6);
 
   const TensorShape& weights_shape = (weights ? weights->Shape() : weight_shape_);
 
@@ -209,7 +210,8 @@ Status Attention<T>::Compute(OpKernelContext* context) const {
                                   mask_index,
                                   past,
                                   attention_bias,
-                                  &parameters));
+                                  &parameters,
+                                  past_seq_len));
 
   if (parameters.do_rotary) {
     ORT_NOT_IMPLEMENTED(
@@ -338,7 +340,7 @@ Status Attention<T>::Compute(OpKernelContext* context) const {
                         output, nullptr /* present_key */, nullptr /* present_value */,
                         batch_size, sequence_length, sequence_length,
                         parameters.head_size, parameters.v_head_size, parameters.v_hidden_size,
-                        attention_bias, context);
+                        attention_bias, context, &parameters);
 }
 }  // namespace contrib
 }  // namespace onnxruntime
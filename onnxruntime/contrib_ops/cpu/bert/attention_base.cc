@@ -337,5 +337,26 @@ Tensor* AttentionBase::GetPresent(OpKernelContext* context,
   return present;
 }
 
+Tensor* AttentionBase::GetPresentWithSharedBuffer(OpKernelContext* context, const Tensor* past) const {
+  // Both past and present have shape (2, batch_size, num_heads, max_sequence_length, head_size),
+  // with only the first past_sequence_length (+ kv_sequence_length for present) rows of each
+  // chunk holding valid data.
+  ORT_ENFORCE(past != nullptr, "past state is required when past_present_share_buffer is set");
+
+  Tensor* present = context->Output(1, past->Shape());
+  if (nullptr == present) {
+    ORT_THROW("Expect to have present state output when past state input is given");
+  }
+
+  // In production use (like GreedySearch or BeamSearch), the past and present outputs are bound
+  // to the same buffer, so only the new key/value chunks need to be written. The unit test
+  // framework cannot bind them to the same buffer, hence one full copy of the cache here.
+  if (present->MutableDataRaw() != past->DataRaw()) {
+    memcpy(present->MutableDataRaw(), past->DataRaw(), past->SizeInBytes());
+  }
+
+  return present;
+}
+
 }  // namespace contrib
 }  // namespace onnxruntime
@@ -30,6 +30,11 @@ class AttentionBase {
                      int kv_sequence_length,
                      int& past_sequence_length) const;
 
+  // Get present state output when past and present share the same buffer of shape
+  // (2, batch_size, num_heads, max_sequence_length, head_size), so the kernel appends
+  // new key/value chunks in place instead of copying the whole past state every token.
+  Tensor* GetPresentWithSharedBuffer(OpKernelContext* context, const Tensor* past) const;
+
  protected:
   AttentionBase(const OpKernelInfo& info, bool require_same_hidden_size) {
     int64_t num_heads = 0;
@@ -112,6 +112,7 @@ struct GroupQueryAttentionParameters {
   int rotary_dim;          // rotary embedding dimension
   bool is_unidirectional;  // causal
   int local_window_size;
+  bool is_ring_kv_cache;  // CPU: KV cache is a fixed-size ring buffer (sinks + local window) smaller than the total sequence
   bool kv_share_buffer;
   bool is_packed_qkv;
   bool is_subsequent_prompt;  // indicates whether we have past context and seqlen > 1
@@ -36,16 +36,27 @@ class AttentionCPUBase : public AttentionBase {
                         int v_head_size,           // head size of V (H_v)
                         int v_hidden_size,         // hidden size of V (D_v)
                         const Tensor* attn_bias,   // additive bias applied on scaled QK.
-                        OpKernelContext* context) const {
+                        OpKernelContext* context,
+                        // parameters is required only when past and present share a buffer
+                        const AttentionParameters* parameters = nullptr) const {
     AllocatorPtr allocator;
     ORT_RETURN_IF_ERROR(context->GetTempSpaceAllocator(&allocator));
 
     auto* tp = context->GetOperatorThreadPool();
 
     int past_sequence_length = 0;
+    int max_sequence_length = 0;  // > 0 only when past and present share a buffer of (2, B, N, M, H)
     Tensor* present = nullptr;
     if (present_key == nullptr && present_value == nullptr) {
-      present = GetPresent(context, past, batch_size, v_head_size, kv_sequence_length, past_sequence_length);
+      if (parameters != nullptr && parameters->past_present_share_buffer) {
+        // Past and present share a preallocated buffer with capacity for max_sequence_length tokens,
+        // so the new key/value chunks are appended in place instead of copying the whole past state.
+        past_sequence_length = parameters->past_sequence_length;
+        max_sequence_length = parameters->max_sequence_length;
+        present = GetPresentWithSharedBuffer(context, past);
+      } else {
+        present = GetPresent(context, past, batch_size, v_head_size, kv_sequence_length, past_sequence_length);
+      }
     } else if (past_key != nullptr && past_value != nullptr) {
       past_sequence_length = static_cast<int>(past_key->Shape().GetDims()[2]);
     }
@@ -96,6 +107,7 @@ class AttentionCPUBase : public AttentionBase {
     ComputeAttentionProbs<T>(static_cast<T*>(attention_probs), Q, K,
                              static_cast<T*>(mask_data),
                              batch_size, sequence_length, kv_sequence_length, past_sequence_length,
+                             max_sequence_length,
                              qk_head_size == 0 ? v_head_size : qk_head_size, past_data, past_key_data,
                              present_data, present_key_data, tp, scale, attn_bias_data, attn_bias_dims);
 
@@ -105,7 +117,8 @@ class AttentionCPUBase : public AttentionBase {
     BufferUniquePtr out_tmp_buffer(out_tmp_data, BufferDeleter(std::move(allocator)));
 
     ComputeVxAttentionScore(output->MutableData<T>(), static_cast<T*>(out_tmp_data), static_cast<T*>(attention_probs),
-                            V, batch_size, sequence_length, kv_sequence_length, past_sequence_length, v_head_size,
+                            V, batch_size, sequence_length, kv_sequence_length, past_sequence_length,
+                            max_sequence_length, v_head_size,
                             v_hidden_size, past_data, past_value_data, present_data, present_value_data, tp);
 
     return Status::OK();
@@ -125,6 +138,7 @@ class AttentionCPUBase : public AttentionBase {
                              int sequence_length,                     // sequence length of self-attention (S)
                              int kv_sequence_length,                  // sequence length of cross-attention (L)
                              int past_sequence_length,                // sequence length of past state
+                             int max_sequence_length,                 // max sequence length of shared buffer, or 0
                              int head_size,                           // head size of self-attention
                              const T* past,                           // past state
                              const T* past_key,                       // past key only (if not using past state)
@@ -141,6 +155,13 @@ class AttentionCPUBase : public AttentionBase {
     const size_t kv_input_chunk_length = static_cast<size_t>(kv_sequence_length) * head_size;  // L x H
     const size_t present_chunk_length = past_chunk_length + kv_input_chunk_length;             // T x H
 
+    // When past and present share a buffer, chunks are strided by the buffer capacity (M x H) and
+    // the past keys are already in place, so only the new L rows of each chunk need to be written.
+    const bool past_present_share_buffer = max_sequence_length > 0;
+    const size_t present_buff_chunk_length = past_present_share_buffer
+                                                 ? static_cast<size_t>(max_sequence_length) * head_size  // M x H
+                                                 : present_chunk_length;
+
     DUMP_CPU_TENSOR_INIT();
     DUMP_CPU_TENSOR("Q", Q, batch_size, num_heads_, sequence_length, head_size);
     DUMP_CPU_TENSOR("K", K, batch_size, num_heads_, total_sequence_length, head_size);
@@ -164,7 +185,8 @@ class AttentionCPUBase : public AttentionBase {
       }
 
       if (present || present_key) {
-        double bytes_to_copy_key = static_cast<double>(sizeof(T) * present_chunk_length);
+        double bytes_to_copy_key = static_cast<double>(
+            sizeof(T) * (past_present_share_buffer ? kv_input_chunk_length : present_chunk_length));
         unit_cost.bytes_loaded += bytes_to_copy_key;
         unit_cost.bytes_stored += bytes_to_copy_key;
       }
@@ -211,8 +233,14 @@ class AttentionCPUBase : public AttentionBase {
 
           const T* k = K + kv_input_chunk_length * i;
           if (nullptr != present) {
-            // Concatenate past_K and K : (BxNx)PxH, (BxNx)LxH -> (BxNx)TxH
-            k = ConcatStateChunk(past, k, present, past_chunk_length, present_chunk_length, i);
+            if (past_present_share_buffer) {
+              // Append K to the shared buffer: the first T rows of each (BxNx)MxH chunk stay contiguous.
+              k = ConcatStateChunkGQA(past, k, present, present_buff_chunk_length, present_buff_chunk_length,
+                                      past_chunk_length, kv_input_chunk_length, true, i);
+            } else {
+              // Concatenate past_K and K : (BxNx)PxH, (BxNx)LxH -> (BxNx)TxH
+              k = ConcatStateChunk(past, k, present, past_chunk_length, present_chunk_length, i);
+            }
           } else if (nullptr != present_key) {
             k = ConcatStateChunk(past_key, k, present_key, past_chunk_length, present_chunk_length, i);
           }
@@ -251,6 +279,7 @@ class AttentionCPUBase : public AttentionBase {
                                int sequence_length,       // sequence length
                                int kv_sequence_length,    // sequence length of K or V
                                int past_sequence_length,  // sequence length in past state
+                               int max_sequence_length,   // max sequence length of shared buffer, or 0
                                int v_head_size,           // head size of V (H_v)
                                int v_hidden_size,         // hidden size of V (D_v)
                                const T* past,             // past state
@@ -264,12 +293,22 @@ class AttentionCPUBase : public AttentionBase {
     const ptrdiff_t kv_input_chunk_length = SafeInt<ptrdiff_t>(kv_sequence_length) * v_head_size;  // L x H_v
     const ptrdiff_t present_chunk_length = past_chunk_length + kv_input_chunk_length;              // T x H_v
 
-    // Move the pointer of past and present to start of v values.
+    // When past and present share a buffer, chunks are strided by the buffer capacity (M x H_v) and
+    // the past values are already in place, so only the new L rows of each chunk need to be written.
+    const bool past_present_share_buffer = max_sequence_length > 0;
+    const ptrdiff_t present_buff_chunk_length = past_present_share_buffer
+                                                    ? SafeInt<ptrdiff_t>(max_sequence_length) * v_head_size  // M x H_v
+                                                    : present_chunk_length;
+
+    // Move the pointer of past and present to start of v values. In a shared buffer both halves
+    // are strided by the buffer capacity rather than the sequence lengths seen so far.
     if (nullptr != past) {
-      past += SafeInt<ptrdiff_t>(batch_size) * num_heads_ * past_sequence_length * v_head_size;
+      past += SafeInt<ptrdiff_t>(batch_size) * num_heads_ *
+              (past_present_share_buffer ? max_sequence_length : past_sequence_length) * v_head_size;
     }
     if (nullptr != present) {
-      present += SafeInt<ptrdiff_t>(batch_size) * num_heads_ * total_sequence_length * v_head_size;
+      present += SafeInt<ptrdiff_t>(batch_size) * num_heads_ *
+                 (past_present_share_buffer ? max_sequence_length : total_sequence_length) * v_head_size;
     }
 
     // The cost of Gemm
@@ -281,7 +320,8 @@ class AttentionCPUBase : public AttentionBase {
     unit_cost.bytes_stored = static_cast<double>(sequence_length * v_head_size * sizeof(T));
 
     if (present || present_value) {
-      double bytes_to_copy_value = static_cast<double>(present_chunk_length * sizeof(T));
+      double bytes_to_copy_value = static_cast<double>(
+          (past_present_share_buffer ? kv_input_chunk_length : present_chunk_length) * sizeof(T));
       unit_cost.bytes_loaded += bytes_to_copy_value;
       unit_cost.bytes_stored += bytes_to_copy_value;
     }
@@ -296,8 +336,17 @@ class AttentionCPUBase : public AttentionBase {
           for (std::ptrdiff_t i = begin; i != end; ++i) {
             const T* v = V + kv_input_chunk_length * i;
             if (nullptr != present) {
-              // Concatenate past_V and V: (BxNx)PxH_v, (BxNx)LxH_v -> (BxNx)TxH_v
-              v = ConcatStateChunk(past, v, present, past_chunk_length, present_chunk_length, i);
+              if (past_present_share_buffer) {
+                // Append V to the shared buffer: the first T rows of each (BxNx)MxH_v chunk stay contiguous.
+                v = ConcatStateChunkGQA(past, v, present,
+                                        static_cast<size_t>(present_buff_chunk_length),
+                                        static_cast<size_t>(present_buff_chunk_length),
+                                        static_cast<size_t>(past_chunk_length),
+                                        static_cast<size_t>(kv_input_chunk_length), true, i);
+              } else {
+                // Concatenate past_V and V: (BxNx)PxH_v, (BxNx)LxH_v -> (BxNx)TxH_v
+                v = ConcatStateChunk(past, v, present, past_chunk_length, present_chunk_length, i);
+              }
             } else if (nullptr != present_value) {
               v = ConcatStateChunk(past_value, v, present_value, past_chunk_length, present_chunk_length, i);
             }
@@ -11,6 +11,9 @@
 #include "core/common/safeint.h"
 #include "core/framework/op_kernel.h"
 
+#include <cmath>
+#include <limits>
+
 namespace onnxruntime {
 namespace contrib {
 
@@ -34,6 +37,9 @@ class GQAAttentionBase {
     use_smooth_softmax_ = info.GetAttrOrDefault<int64_t>("smooth_softmax", 0) == 1;
 
     local_window_size_ = has_local ? static_cast<int>(info.GetAttrOrDefault<int64_t>("local_window_size", -1)) : -1;
+    num_sink_tokens_ = has_local ? static_cast<int>(info.GetAttrOrDefault<int64_t>("num_sink_tokens", 0)) : 0;
+
+    kv_cache_quant_type_ = static_cast<int>(info.GetAttrOrDefault<int64_t>("kv_cache_quant_type", 0));
   }
 
   int num_heads_;     // number of attention heads of Q
@@ -43,6 +49,8 @@ class GQAAttentionBase {
   bool do_rotary_;  // whether or not to use rotary embeddings
   bool rotary_interleaved_;
   int local_window_size_;
+  int num_sink_tokens_;  // initial tokens kept attendable alongside the local window (attention sinks)
+  int kv_cache_quant_type_;  // 0: cache stored as T; 1: int8 rows with a trailing per-row float scale
 
   bool use_smooth_softmax_;
 
@@ -56,10 +64,13 @@ class GQAAttentionBase {
                         Tensor* present_key,                        // present K output tensor (if separating present KV)
                         Tensor* present_value,                      // present V output tensor (if separating present KV)
                         const Tensor* seqlens_k,                    // past sequence lengths tensor
+                        const Tensor* block_table,                  // page table for the paged KV cache, or nullptr
                         GroupQueryAttentionParameters& parameters,  // attention parameters
                         AllocatorPtr allocator,                     // allocator for temporary tensors
-                        OpKernelContext* context) const {
+                        OpKernelContext* context,
+                        bool kv_appended_to_present = false) const {  // whether the new K/V tokens were already written into the present cache
     const bool is_prompt = parameters.is_first_prompt;
+    const bool is_paged_kv = block_table != nullptr;
     const int batch_size = parameters.batch_size;
     const int sequence_length = parameters.sequence_length;
     const int head_size = parameters.head_size;
@@ -69,10 +80,12 @@ class GQAAttentionBase {
     auto* tp = context->GetOperatorThreadPool();
 
     int seqlen_past_kv_cache = 0;
-    if (past_key != nullptr && past_value != nullptr) {
+    if (past_key != nullptr && past_value != nullptr && !is_paged_kv) {
       seqlen_past_kv_cache = static_cast<int>(past_key->Shape().GetDims()[2]);
     }
-    int seqlen_present_kv_cache = static_cast<int>(present_key->Shape().GetDims()[2]);
+    // In paged mode present_key holds the page pool, so its dims do not give the cache length.
+    int seqlen_present_kv_cache = is_paged_kv ? parameters.seqlen_present_kv_cache
+                                              : static_cast<int>(present_key->Shape().GetDims()[2]);
 
     // Compute the attention score.
     size_t bytes = SafeInt<size_t>(batch_size) * num_heads_ * sequence_length * seqlen_present_kv_cache * sizeof(float);
@@ -86,23 +99,307 @@ class GQAAttentionBase {
 
     bool past_present_share_buffer = past_key_data == present_key_data && past_value_data == present_value_data;
 
-    const T* k = packed_qkv ? Q + num_heads_ * sequence_length * head_size : K;
+    // Paged KV cache: gather each sequence's pages into contiguous scratch caches and append the
+    // new tokens to the page pool, then run the regular contiguous attention against the scratch.
+    BufferUniquePtr key_cache_buffer;
+    BufferUniquePtr value_cache_buffer;
+    if (is_paged_kv) {
+      const T* k_new = packed_qkv ? Q + num_heads_ * sequence_length * head_size : K;
+      const T* v_new = packed_qkv ? Q + (num_heads_ + kv_num_heads_) * sequence_length * head_size : V;
+      PreparePagedKvCache<T>(k_new, v_new, past_key, past_value, present_key, present_value,
+                             seqlens_k->Data<int32_t>(), block_table, parameters,
+                             static_cast<size_t>(seqlen_present_kv_cache), allocator,
+                             key_cache_buffer, value_cache_buffer);
+      past_key_data = nullptr;
+      past_value_data = nullptr;
+      present_key_data = static_cast<T*>(key_cache_buffer.get());
+      present_value_data = static_cast<T*>(value_cache_buffer.get());
+      // The scratch caches already hold the past entries; let ConcatStateChunkGQA append only the
+      // new tokens, as it does for a shared past/present buffer.
+      past_present_share_buffer = true;
+    }
+
+    const T* k = !kv_appended_to_present && packed_qkv ? Q + num_heads_ * sequence_length * head_size : K;
     ComputeAttentionProbs<T>(static_cast<float*>(attention_probs), Q, k, seqlens_k->Data<int32_t>(), batch_size,
                              sequence_length, seqlen_past_kv_cache, seqlen_present_kv_cache, head_size, past_key_data,
-                             present_key_data, past_present_share_buffer, packed_qkv, is_prompt, tp, allocator);
+                             present_key_data, past_present_share_buffer, kv_appended_to_present, packed_qkv,
+                             is_prompt, parameters.is_ring_kv_cache, tp, allocator);
 
     // Compute the attentionScore * Value: out(B, N, S, H_v) = attention_probs(B, N, S, T) x V(B, N, T, H_v)
-    const T* v = packed_qkv ? Q + (num_heads_ + kv_num_heads_) * sequence_length * head_size : V;
+    const T* v = !kv_appended_to_present && packed_qkv ? Q + (num_heads_ + kv_num_heads_) * sequence_length * head_size : V;
     ComputeVxAttentionScore(output->MutableData<T>(), static_cast<float*>(attention_probs), v,
                             seqlens_k->Data<int32_t>(),
                             batch_size, sequence_length, seqlen_past_kv_cache, seqlen_present_kv_cache, head_size,
-                            hidden_size, past_value_data, present_value_data, past_present_share_buffer, packed_qkv,
-                            is_prompt, tp, allocator);
+                            hidden_size, past_value_data, present_value_data, past_present_share_buffer,
+                            kv_appended_to_present, packed_qkv, is_prompt, parameters.is_ring_kv_cache, tp, allocator);
+
+    return Status::OK();
+  }
+
+  // Entry point for the int8-quantized KV cache path (kv_cache_quant_type == 1, float only).
+  // past/present hold int8 rows of head_size values plus a trailing float32 scale; the rows are
+  // dequantized on the fly right before the Q*K' and probs*V GEMMs, so decode streams a quarter
+  // of the fp32 cache bytes. Paged and ring caches keep their unquantized paths.
+  Status ApplyAttentionQuantKv(const float* Q,                             // Q data with shape BxNxSxH
+                               const float* K,                             // K data with shape BxN_kvxSxH
+                               const float* V,                             // V data with shape BxN_kvxSxH
+                               const Tensor* past_key,                     // past K input tensor (B, N_kv, S*, H + 4)
+                               const Tensor* past_value,                   // past V input tensor (B, N_kv, S*, H + 4)
+                               Tensor* output,                             // output tensor
+                               Tensor* present_key,                        // present K output tensor (B, N_kv, S+, H + 4)
+                               Tensor* present_value,                      // present V output tensor (B, N_kv, S+, H + 4)
+                               const Tensor* seqlens_k,                    // past sequence lengths tensor
+                               GroupQueryAttentionParameters& parameters,  // attention parameters
+                               AllocatorPtr allocator,                     // allocator for temporary tensors
+                               OpKernelContext* context) const {
+    const bool is_prompt = parameters.is_first_prompt;
+    const int batch_size = parameters.batch_size;
+    const int sequence_length = parameters.sequence_length;
+    const int head_size = parameters.head_size;
+    const int hidden_size = parameters.hidden_size;
+    const bool packed_qkv = parameters.is_packed_qkv;
+
+    auto* tp = context->GetOperatorThreadPool();
+
+    int seqlen_past_kv_cache = 0;
+    if (past_key != nullptr && past_value != nullptr) {
+      seqlen_past_kv_cache = static_cast<int>(past_key->Shape().GetDims()[2]);
+    }
+    const int seqlen_present_kv_cache = static_cast<int>(present_key->Shape().GetDims()[2]);
+
+    // Compute the attention score.
+    size_t bytes = SafeInt<size_t>(batch_size) * num_heads_ * sequence_length * seqlen_present_kv_cache * sizeof(float);
+    auto attention_probs = allocator->Alloc(bytes);
+    BufferUniquePtr scratch_buffer(attention_probs, BufferDeleter(allocator));
+
+    const int8_t* past_key_data = past_key != nullptr ? past_key->Data<int8_t>() : nullptr;
+    int8_t* present_key_data = present_key->MutableData<int8_t>();
+    const int8_t* past_value_data = past_value != nullptr ? past_value->Data<int8_t>() : nullptr;
+    int8_t* present_value_data = present_value->MutableData<int8_t>();
+
+    const bool past_present_share_buffer = past_key_data == present_key_data && past_value_data == present_value_data;
+
+    const float* k = packed_qkv ? Q + num_heads_ * sequence_length * head_size : K;
+    ComputeAttentionProbsQuantKv(static_cast<float*>(attention_probs), Q, k, seqlens_k->Data<int32_t>(), batch_size,
+                                 sequence_length, seqlen_past_kv_cache, seqlen_present_kv_cache, head_size,
+                                 past_key_data, present_key_data, past_present_share_buffer, packed_qkv, is_prompt,
+                                 tp, allocator);
+
+    // Compute the attentionScore * Value: out(B, N, S, H_v) = attention_probs(B, N, S, T) x V(B, N, T, H_v)
+    const float* v = packed_qkv ? Q + (num_heads_ + kv_num_heads_) * sequence_length * head_size : V;
+    ComputeVxAttentionScoreQuantKv(output->MutableData<float>(), static_cast<float*>(attention_probs), v,
+                                   seqlens_k->Data<int32_t>(), batch_size, sequence_length, seqlen_past_kv_cache,
+                                   seqlen_present_kv_cache, head_size, hidden_size, past_value_data,
+                                   present_value_data, past_present_share_buffer, packed_qkv, is_prompt, tp,
+                                   allocator);
 
     return Status::OK();
   }
 
  private:
+  // Paged KV cache helper. Gathers each sequence's past entries from the page pool into contiguous
+  // scratch caches of shape (batch_size, kv_num_heads, seqlen_present_kv_cache, head_size) and
+  // scatters the new tokens into the pool through the present outputs (which alias the pool when it
+  // is IO-bound as both past and present). The new tokens are appended to the scratch caches later
+  // by ConcatStateChunkGQA during the attention computation.
+  template <typename T>
+  void PreparePagedKvCache(const T* k_new,                    // new K tokens with shape BxN_kvxSxH (or packed QKV)
+                           const T* v_new,                    // new V tokens with shape BxN_kvxSxH (or packed QKV)
+                           const Tensor* past_key,            // K page pool (num_pages, N_kv, page_size, H)
+                           const Tensor* past_value,          // V page pool (num_pages, N_kv, page_size, H)
+                           Tensor* present_key,               // present K output carrying the updated pool
+                           Tensor* present_value,             // present V output carrying the updated pool
+                           const int32_t* seqlens_k,          // total - 1 sequence lengths tensor
+                           const Tensor* block_table_tensor,  // page table (batch_size, max_blocks_per_sequence)
+                           const GroupQueryAttentionParameters& parameters,
+                           const size_t cache_sequence_length,  // sequence length of the scratch caches
+                           AllocatorPtr allocator,
+                           BufferUniquePtr& key_cache_buffer,    // out: scratch K cache
+                           BufferUniquePtr& value_cache_buffer)  // out: scratch V cache
+      const {
+    const size_t batch_size = parameters.batch_size;
+    const size_t sequence_length = parameters.sequence_length;
+    const size_t head_size = parameters.head_size;
+    const size_t kv_num_heads = parameters.kv_num_heads;
+    const bool is_prompt = parameters.is_first_prompt;
+    const bool packed_qkv = parameters.is_packed_qkv;
+
+    const size_t page_size = static_cast<size_t>(past_key->Shape().GetDims()[2]);
+    const size_t pool_elements = static_cast<size_t>(past_key->Shape().Size());
+    const size_t max_blocks_per_seq = static_cast<size_t>(block_table_tensor->Shape().GetDims()[1]);
+    const int32_t* block_table = block_table_tensor->Data<int32_t>();
+
+    T* key_pool = present_key->MutableData<T>();
+    T* value_pool = present_value->MutableData<T>();
+    // When the pool is not IO-bound as both past and present, copy it so the present outputs still
+    // carry the updated pages.
+    if (past_key->Data<T>() != key_pool) {
+      memcpy(key_pool, past_key->Data<T>(), pool_elements * sizeof(T));
+    }
+    if (past_value->Data<T>() != value_pool) {
+      memcpy(value_pool, past_value->Data<T>(), pool_elements * sizeof(T));
+    }
+
+    const size_t cache_bytes = SafeInt<size_t>(batch_size) * kv_num_heads * cache_sequence_length * head_size * sizeof(T);
+    key_cache_buffer = BufferUniquePtr(allocator->Alloc(cache_bytes), BufferDeleter(allocator));
+    value_cache_buffer = BufferUniquePtr(allocator->Alloc(cache_bytes), BufferDeleter(allocator));
+    T* key_cache = static_cast<T*>(key_cache_buffer.get());
+    T* value_cache = static_cast<T*>(value_cache_buffer.get());
+
+    const ptrdiff_t packed_batch_stride =
+        packed_qkv ? SafeInt<ptrdiff_t>(num_heads_ + 2 * kv_num_heads_) * sequence_length * head_size
+                   : SafeInt<ptrdiff_t>(0);
+    const size_t kv_input_chunk_length = sequence_length * head_size;      // S x H
+    const size_t cache_chunk_length = cache_sequence_length * head_size;  // T x H
+
+    for (size_t b = 0; b < batch_size; ++b) {
+      const size_t total_seqlen = static_cast<size_t>(seqlens_k[b]) + 1;
+      const size_t past_seqlen = is_prompt ? 0 : total_seqlen - sequence_length;  // Assume no padding sequence length
+      const int32_t* seq_block_table = block_table + b * max_blocks_per_seq;
+
+      for (size_t h = 0; h < kv_num_heads; ++h) {
+        T* key_cache_chunk = key_cache + (b * kv_num_heads + h) * cache_chunk_length;
+        T* value_cache_chunk = value_cache + (b * kv_num_heads + h) * cache_chunk_length;
+
+        // Gather the past entries page by page.
+        size_t pos = 0;
+        while (pos < past_seqlen) {
+          const size_t page = static_cast<size_t>(seq_block_table[pos / page_size]);
+          const size_t page_offset = pos % page_size;
+          const size_t run = std::min(page_size - page_offset, past_seqlen - pos);
+          const size_t pool_offset = ((page * kv_num_heads + h) * page_size + page_offset) * head_size;
+          memcpy(key_cache_chunk + pos * head_size, key_pool + pool_offset, run * head_size * sizeof(T));
+          memcpy(value_cache_chunk + pos * head_size, value_pool + pool_offset, run * head_size * sizeof(T));
+          pos += run;
+        }
+
+        // Scatter the new tokens into the pool one row at a time since they can straddle pages.
+        const T* k_src = packed_qkv ? k_new + packed_batch_stride * b + kv_input_chunk_length * h
+                                    : k_new + kv_input_chunk_length * (b * kv_num_heads + h);
+        const T* v_src = packed_qkv ? v_new + packed_batch_stride * b + kv_input_chunk_length * h
+                                    : v_new + kv_input_chunk_length * (b * kv_num_heads + h);
+        for (size_t s = 0; s < sequence_length; ++s) {
+          const size_t new_pos = past_seqlen + s;
+          const size_t page = static_cast<size_t>(seq_block_table[new_pos / page_size]);
+          const size_t pool_offset = ((page * kv_num_heads + h) * page_size + new_pos % page_size) * head_size;
+          memcpy(key_pool + pool_offset, k_src + s * head_size, head_size * sizeof(T));
+          memcpy(value_pool + pool_offset, v_src + s * head_size, head_size * sizeof(T));
+        }
+      }
+    }
+  }
+
+  // Writes the new KV tokens of one head into a sliding-window ring cache chunk and returns the
+  // chunk. The first num_sink_tokens_ slots pin the attention sinks, and position p lives in slot
+  // num_sink_tokens_ + (p - num_sink_tokens_) % local_window_size_, so each new token evicts the
+  // oldest windowed token in place. Only reached once the sequence has outgrown the cache, which
+  // the kernel restricts to token generation, so the sink slots were filled long before wrapping.
+  template <typename T>
+  T* AppendStateChunkRing(const T* past,
+                          const T* chunk,
+                          T* present,
+                          size_t present_buff_chunk_length,
+                          size_t past_seqlen,
+                          size_t sequence_length,
+                          size_t head_size,
+                          bool past_present_share_buffer,
+                          std::ptrdiff_t i) const {
+    T* start = present + i * present_buff_chunk_length;
+    if (!past_present_share_buffer && past != nullptr) {
+      // Like ConcatStateChunkGQA, carry the past cache over when the buffers are separate. The
+      // past ring cache has the same fixed capacity as the present one.
+      memcpy(start, past + i * present_buff_chunk_length, present_buff_chunk_length * sizeof(T));
+    }
+    const size_t sink_tokens = static_cast<size_t>(num_sink_tokens_);
+    const size_t window = static_cast<size_t>(local_window_size_);
+    for (size_t s = 0; s < sequence_length; s++) {
+      const size_t pos = past_seqlen + s;
+      const size_t slot = sink_tokens + (pos - sink_tokens) % window;
+      memcpy(start + slot * head_size, chunk + s * head_size, head_size * sizeof(T));
+    }
+    return start;
+  }
+
+  // Applies causal softmax (with optional local window, attention sinks, softcap and smooth
+  // softmax) in place to the sequence_length score rows of one head, each of
+  // present_buffer_sequence_length entries.
+  void RunAttentionSoftmax(float* output_softmax,
+                           const size_t sequence_length,
+                           const size_t past_seqlen,
+                           const size_t total_seqlen,
+                           const size_t kv_len,
+                           const bool wrapped,
+                           const size_t present_buffer_sequence_length) const {
+    for (size_t seq = 0; seq < sequence_length; seq++) {
+      size_t seq_causal_length = past_seqlen + seq + 1;
+      if (wrapped) {
+        // Every slot of the ring cache holds either a sink token or one of the last
+        // local_window_size_ tokens, so the whole row is live and nothing gets masked.
+        if (softcap_ > 0.f) {
+          ComputeAttentionSoftcapInplace(output_softmax, static_cast<int>(kv_len), softcap_);
+        }
+        if (use_smooth_softmax_) {
+          ComputeSmoothSoftmaxInplace(output_softmax, 1, static_cast<int>(kv_len), nullptr);
+        } else {
+          ComputeAttentionSoftmaxInplace(output_softmax, 1, static_cast<int>(kv_len), nullptr);
+        }
+        output_softmax += present_buffer_sequence_length;
+        continue;
+      }
+      if (local_window_size_ > 0 && seq_causal_length > static_cast<size_t>(local_window_size_) + 1) {
+        const size_t window_start = seq_causal_length - local_window_size_ - 1;
+        const size_t sink_tokens = std::min(static_cast<size_t>(num_sink_tokens_), window_start);
+        if (sink_tokens > 0) {
+          // Attention sinks stay attendable alongside the local window: mask only the gap
+          // between them (exp underflows to zero) and run softmax over the whole row.
+          if (softcap_ > 0.f) {
+            ComputeAttentionSoftcapInplace(output_softmax, static_cast<int>(sink_tokens), softcap_);
+            ComputeAttentionSoftcapInplace(output_softmax + window_start, local_window_size_ + 1, softcap_);
+          }
+          for (size_t total_seq_id = sink_tokens; total_seq_id < window_start; total_seq_id++) {
+            output_softmax[total_seq_id] = std::numeric_limits<float>::lowest();
+          }
+          if (use_smooth_softmax_) {
+            ComputeSmoothSoftmaxInplace(output_softmax, 1, static_cast<int>(seq_causal_length), nullptr);
+          } else {
+            ComputeAttentionSoftmaxInplace(output_softmax, 1, static_cast<int>(seq_causal_length), nullptr);
+          }
+        } else {
+          for (size_t total_seq_id = 0; total_seq_id < window_start; total_seq_id++) {
+            output_softmax[total_seq_id] = 0.f;
+          }
+          if (softcap_ > 0.f) {
+            ComputeAttentionSoftcapInplace(output_softmax + window_start,
+                                           local_window_size_ + 1, softcap_);
+          }
+          if (use_smooth_softmax_) {
+            ComputeSmoothSoftmaxInplace(output_softmax + window_start, 1,
+                                        local_window_size_ + 1, nullptr);
+          } else {
+            ComputeAttentionSoftmaxInplace(output_softmax + window_start, 1,
+                                           local_window_size_ + 1, nullptr);
+          }
+        }
+      } else {
+        if (softcap_ > 0.f) {
+          ComputeAttentionSoftcapInplace(output_softmax, static_cast<int>(seq_causal_length), softcap_);
+        }
+        if (use_smooth_softmax_) {
+          ComputeSmoothSoftmaxInplace(output_softmax, 1, static_cast<int>(seq_causal_length), nullptr);
+        } else {
+          ComputeAttentionSoftmaxInplace(output_softmax, 1, static_cast<int>(seq_causal_length), nullptr);
+        }
+      }
+
+      // set causal [seq_causal_length, total_seqlen) to 0.f
+      for (size_t total_seq_id = seq_causal_length; total_seq_id < total_seqlen; total_seq_id++) {
+        output_softmax[total_seq_id] = 0.f;
+      }
+
+      output_softmax += present_buffer_sequence_length;
+    }
+  }
+
   // Helper function to compute the attention probs. It does 2 things:
   //  attention_probs(B, N, S, T) = 1/sqrt(H) x Q(B, N, S, H) x K'(B, N, T, H -> B, N, H, T)
   //  attention_probs(B, N, S, T) = Softmax(attention_probs)
@@ -119,8 +416,10 @@ class GQAAttentionBase {
                              const T* past_key,                            // past key only
                              T* present_key,                               // present key only
                              const bool past_present_share_buffer,         // whether present key and value share the same buffer
+                             const bool kv_appended_to_present,            // whether the new K tokens are already in the present cache
                              const bool packed_qkv,                        // whether Q, K, V are packed
                              const bool is_prompt,                         // whether it is prompt
+                             const bool is_ring_kv_cache,                  // whether the present cache is a sliding-window ring buffer
                              ThreadPool* tp,                               // thread pool
                              AllocatorPtr allocator) const {               // allocator for temporary buffer
     const ptrdiff_t packed_batch_stride =
@@ -167,19 +466,37 @@ class GQAAttentionBase {
         const size_t past_seqlen = is_prompt ? 0 : total_seqlen - sequence_length;  // Assume no padding sequence length
         const size_t past_chunk_length = past_seqlen * head_size;
 
+        // Once a sequence outgrows a ring cache, the first num_sink_tokens_ slots keep the attention
+        // sinks and the remaining local_window_size_ slots hold the most recent tokens, so every
+        // cache slot is live and new tokens overwrite the oldest non-sink slot in place.
+        const bool wrapped = is_ring_kv_cache && total_seqlen > present_buffer_sequence_length;
+        const size_t kv_len = wrapped ? present_buffer_sequence_length : total_seqlen;
+
         const ptrdiff_t output_offset = SafeInt<ptrdiff_t>(i) * sequence_length * present_buffer_sequence_length;
         float* output = attention_probs + output_offset;
 
         const T* k;
-        if (packed_qkv) {
-          k = K + packed_batch_stride * batch_index + kv_input_chunk_length * (head_index / kv_num_heads_factor);
+        if (kv_appended_to_present) {
+          // The caller already rotated/copied the new K tokens into the present cache, so read the
+          // whole sequence straight from it.
+          k = present_key + (i / kv_num_heads_factor) * present_buff_chunk_length;
         } else {
-          k = K + kv_input_chunk_length * (i / kv_num_heads_factor);
-        }
-        if (nullptr != present_key) {
-          k = ConcatStateChunkGQA(past_key, k, present_key, present_buff_chunk_length, past_buff_chunk_length,
-                                  past_chunk_length, kv_input_chunk_length, past_present_share_buffer,
-                                  i / kv_num_heads_factor);
+          if (packed_qkv) {
+            k = K + packed_batch_stride * batch_index + kv_input_chunk_length * (head_index / kv_num_heads_factor);
+          } else {
+            k = K + kv_input_chunk_length * (i / kv_num_heads_factor);
+          }
+          if (nullptr != present_key) {
+            if (wrapped) {
+              k = AppendStateChunkRing(past_key, k, present_key, present_buff_chunk_length, past_seqlen,
+                                       sequence_length, head_size, past_present_share_buffer,
+                                       i / kv_num_heads_factor);
+            } else {
+              k = ConcatStateChunkGQA(past_key, k, present_key, present_buff_chunk_length, past_buff_chunk_length,
+                                      past_chunk_length, kv_input_chunk_length, past_present_share_buffer,
+                                      i / kv_num_heads_factor);
+            }
+          }
         }
 
         // Compute Q*K' + AttentionMask
@@ -195,11 +512,11 @@ class GQAAttentionBase {
         }
 
         if constexpr (std::is_same<T, float>::value) {
-          math::GemmEx<float, ThreadPool>(CblasNoTrans, CblasTrans, sequence_length, total_seqlen, head_size, alpha, q,
+          math::GemmEx<float, ThreadPool>(CblasNoTrans, CblasTrans, sequence_length, kv_len, head_size, alpha, q,
                                           static_cast<int>(head_size), k, static_cast<int>(head_size), 0.0f /*bata*/,
                                           output, static_cast<int>(present_buffer_sequence_length), nullptr);
         } else {
-          size_t bytes = head_size * (sequence_length + total_seqlen) * sizeof(float);
+          size_t bytes = head_size * (sequence_length + kv_len) * sizeof(float);
           auto q_k_fp32 = allocator->Alloc(bytes);
           BufferUniquePtr scratch_buffer(q_k_fp32, BufferDeleter(allocator));
 
@@ -207,50 +524,16 @@ class GQAAttentionBase {
           MlasConvertHalfToFloatBuffer(q, q_fp32, head_size * sequence_length);
 
           float* k_fp32 = q_fp32 + head_size * sequence_length;
-          MlasConvertHalfToFloatBuffer(k, k_fp32, head_size * total_seqlen);
+          MlasConvertHalfToFloatBuffer(k, k_fp32, head_size * kv_len);
 
-          math::GemmEx<float, ThreadPool>(CblasNoTrans, CblasTrans, sequence_length, total_seqlen, head_size, alpha, q_fp32,
+          math::GemmEx<float, ThreadPool>(CblasNoTrans, CblasTrans, sequence_length, kv_len, head_size, alpha, q_fp32,
                                           static_cast<int>(head_size), k_fp32, static_cast<int>(head_size), 0.0f /*bata*/,
                                           output, static_cast<int>(present_buffer_sequence_length), nullptr);
         }
 
         // compute Softmax
-        float* output_softmax = output;
-        for (size_t seq = 0; seq < sequence_length; seq++) {
-          size_t seq_causal_length = past_seqlen + seq + 1;
-          if (local_window_size_ > 0 && seq_causal_length > static_cast<size_t>(local_window_size_) + 1) {
-            for (size_t total_seq_id = 0; total_seq_id < seq_causal_length - local_window_size_ - 1; total_seq_id++) {
-              output_softmax[total_seq_id] = 0.f;
-            }
-            if (softcap_ > 0.f) {
-              ComputeAttentionSoftcapInplace(output_softmax + seq_causal_length - local_window_size_ - 1,
-                                             local_window_size_ + 1, softcap_);
-            }
-            if (use_smooth_softmax_) {
-              ComputeSmoothSoftmaxInplace(output_softmax + seq_causal_length - local_window_size_ - 1, 1,
-                                          local_window_size_ + 1, nullptr);
-            } else {
-              ComputeAttentionSoftmaxInplace(output_softmax + seq_causal_length - local_window_size_ - 1, 1,
-                                             local_window_size_ + 1, nullptr);
-            }
-          } else {
-            if (softcap_ > 0.f) {
-              ComputeAttentionSoftcapInplace(output_softmax, static_cast<int>(seq_causal_length), softcap_);
-            }
-            if (use_smooth_softmax_) {
-              ComputeSmoothSoftmaxInplace(output_softmax, 1, static_cast<int>(seq_causal_length), nullptr);
-            } else {
-              ComputeAttentionSoftmaxInplace(output_softmax, 1, static_cast<int>(seq_causal_length), nullptr);
-            }
-          }
-
-          // set causal [seq_causal_length, total_seqlen) to 0.f
-          for (size_t total_seq_id = seq_causal_length; total_seq_id < total_seqlen; total_seq_id++) {
-            output_softmax[total_seq_id] = 0.f;
-          }
-
-          output_softmax += present_buffer_sequence_length;
-        }
+        RunAttentionSoftmax(output, sequence_length, past_seqlen, total_seqlen, kv_len, wrapped,
+                            present_buffer_sequence_length);
       }
     });
   }
@@ -269,8 +552,10 @@ class GQAAttentionBase {
                                const T* past_value,                          // past value only
                                T* present_value,                             // present value only
                                const bool past_present_share_buffer,         // whether present key and value share the same buffer
+                               const bool kv_appended_to_present,            // whether the new V tokens are already in the present cache
                                const bool packed_qkv,                        // whether Q, K, V are packed
                                const bool is_prompt,                         // whether it is prompt
+                               const bool is_ring_kv_cache,                  // whether the present cache is a sliding-window ring buffer
                                ThreadPool* tp,
                                AllocatorPtr allocator) const {
     const ptrdiff_t packed_batch_stride =
@@ -323,38 +608,53 @@ class GQAAttentionBase {
         const size_t past_seqlen = is_prompt ? 0 : total_seqlen - sequence_length;  // Assume no padding sequence length
         const size_t past_chunk_length = past_seqlen * head_size;
 
+        const bool wrapped = is_ring_kv_cache && total_seqlen > present_buffer_sequence_length;
+        const size_t kv_len = wrapped ? present_buffer_sequence_length : total_seqlen;
+
         const T* v;
-        if (packed_qkv) {
-          v = V + packed_batch_stride * batch_index + kv_input_chunk_length * (head_index / kv_num_heads_factor);
+        if (kv_appended_to_present) {
+          // The caller already copied the new V tokens into the present cache, so read the whole
+          // sequence straight from it.
+          v = present_value + (i / kv_num_heads_factor) * present_buff_chunk_length;
         } else {
-          v = V + kv_input_chunk_length * (i / kv_num_heads_factor);
-        }
-        if (nullptr != present_value) {
-          v = ConcatStateChunkGQA(past_value, v, present_value, present_buff_chunk_length, past_buff_chunk_length,
-                                  past_chunk_length, kv_input_chunk_length, past_present_share_buffer,
-                                  i / kv_num_heads_factor);
+          if (packed_qkv) {
+            v = V + packed_batch_stride * batch_index + kv_input_chunk_length * (head_index / kv_num_heads_factor);
+          } else {
+            v = V + kv_input_chunk_length * (i / kv_num_heads_factor);
+          }
+          if (nullptr != present_value) {
+            if (wrapped) {
+              v = AppendStateChunkRing(past_value, v, present_value, present_buff_chunk_length, past_seqlen,
+                                       sequence_length, head_size, past_present_share_buffer,
+                                       i / kv_num_heads_factor);
+            } else {
+              v = ConcatStateChunkGQA(past_value, v, present_value, present_buff_chunk_length, past_buff_chunk_length,
+                                      past_chunk_length, kv_input_chunk_length, past_present_share_buffer,
+                                      i / kv_num_heads_factor);
+            }
+          }
         }
 
         ptrdiff_t attention_probs_offset = SafeInt<ptrdiff_t>(sequence_length) * present_buffer_sequence_length * i;
 
         if constexpr (std::is_same<T, float>::value) {
           T* output_current = output + (batch_index * sequence_length * num_heads_ + head_index) * head_size;
-          math::GemmEx<float, ThreadPool>(CblasNoTrans, CblasNoTrans, sequence_length, head_size, total_seqlen,
+          math::GemmEx<float, ThreadPool>(CblasNoTrans, CblasNoTrans, sequence_length, head_size, kv_len,
                                           1.f, /*alpha*/ attention_probs + attention_probs_offset,
                                           static_cast<int>(present_buffer_sequence_length), v,
                                           static_cast<int>(head_size), 0.0f /*beta*/, output_current,
                                           static_cast<int>(hidden_size), nullptr);
         } else {
-          size_t bytes = head_size * total_seqlen * sizeof(float);
+          size_t bytes = head_size * kv_len * sizeof(float);
           auto v_fp32 = allocator->Alloc(bytes);
           BufferUniquePtr scratch_buffer(v_fp32, BufferDeleter(allocator));
 
           float* v_fp32_ptr = static_cast<float*>(v_fp32);
-          MlasConvertHalfToFloatBuffer(v, v_fp32_ptr, head_size * total_seqlen);
+          MlasConvertHalfToFloatBuffer(v, v_fp32_ptr, head_size * kv_len);
 
           float* output_fp32_current = static_cast<float*>(output_fp32) +
                                        (batch_index * sequence_length * num_heads_ + head_index) * head_size;
-          math::GemmEx<float, ThreadPool>(CblasNoTrans, CblasNoTrans, sequence_length, head_size, total_seqlen,
+          math::GemmEx<float, ThreadPool>(CblasNoTrans, CblasNoTrans, sequence_length, head_size, kv_len,
                                           1.f, /*alpha*/ attention_probs + attention_probs_offset,
                                           static_cast<int>(present_buffer_sequence_length), v_fp32_ptr,
                                           static_cast<int>(head_size), 0.0f /*beta*/, output_fp32_current,
@@ -369,6 +669,246 @@ class GQAAttentionBase {
                                    SafeInt<size_t>(sequence_length) * batch_size * num_heads_ * head_size);
     }
   }
+
+  // One quantized KV cache row stores head_size int8 values followed by the row's float32
+  // dequantization scale.
+  static size_t QuantKvRowBytes(size_t head_size) {
+    return head_size + sizeof(float);
+  }
+
+  // Symmetric absmax quantization of one cache row; the scale lands in the trailing 4 bytes.
+  static void QuantizeKvRow(const float* src, size_t head_size, int8_t* dst) {
+    float absmax = 0.0f;
+    for (size_t h = 0; h < head_size; h++) {
+      absmax = std::max(absmax, std::abs(src[h]));
+    }
+    const float scale = absmax / 127.0f;
+    const float inv_scale = absmax == 0.0f ? 0.0f : 127.0f / absmax;
+    for (size_t h = 0; h < head_size; h++) {
+      dst[h] = static_cast<int8_t>(std::lroundf(src[h] * inv_scale));
+    }
+    memcpy(dst + head_size, &scale, sizeof(float));
+  }
+
+  static void DequantizeKvRows(const int8_t* rows, size_t num_rows, size_t head_size, float* dst) {
+    const size_t row_bytes = QuantKvRowBytes(head_size);
+    for (size_t r = 0; r < num_rows; r++) {
+      const int8_t* row = rows + r * row_bytes;
+      float scale;
+      memcpy(&scale, row + head_size, sizeof(float));
+      float* out = dst + r * head_size;
+      for (size_t h = 0; h < head_size; h++) {
+        out[h] = scale * static_cast<float>(row[h]);
+      }
+    }
+  }
+
+  // Quantized-cache counterpart of ConcatStateChunkGQA: carries the past rows over when past and
+  // present are separate buffers and quantizes the new tokens of one head into their cache slots.
+  // Returns the head's present cache chunk.
+  const int8_t* AppendQuantKvChunk(const int8_t* past,
+                                   const float* chunk,  // new tokens of one head, S x H
+                                   int8_t* present,
+                                   size_t present_buff_chunk_bytes,
+                                   size_t past_buff_chunk_bytes,
+                                   size_t past_seqlen,
+                                   size_t sequence_length,
+                                   size_t head_size,
+                                   bool past_present_share_buffer,
+                                   std::ptrdiff_t i) const {
+    const size_t row_bytes = QuantKvRowBytes(head_size);
+    int8_t* start = present + i * present_buff_chunk_bytes;
+    if (!past_present_share_buffer && past != nullptr && past_seqlen > 0) {
+      memcpy(start, past + i * past_buff_chunk_bytes, past_seqlen * row_bytes);
+    }
+    int8_t* dst = start + past_seqlen * row_bytes;
+    for (size_t s = 0; s < sequence_length; s++) {
+      QuantizeKvRow(chunk + s * head_size, head_size, dst + s * row_bytes);
+    }
+    return start;
+  }
+
+  // Quantized-KV counterpart of ComputeAttentionProbs. The new K tokens are quantized into the
+  // int8 cache and each head's live rows are dequantized into a scratch buffer right before the
+  // Q*K' GEMM, mirroring how the fp16 path converts its operands per chunk.
+  void ComputeAttentionProbsQuantKv(float* attention_probs,                       // output buffer with size BxNxSxT
+                                    const float* Q,                               // Q data. Its size is BxNxSxH
+                                    const float* K,                               // k data. Its size is BxNxLxH
+                                    const int32_t* seqlens_k,                     // total - 1 sequence lengths tensor
+                                    const size_t batch_size,                      // batch size of self-attention
+                                    const size_t sequence_length,                 // sequence length of self-attention (S)
+                                    const size_t past_buffer_sequence_length,     // sequence length of past state
+                                    const size_t present_buffer_sequence_length,  // sequence length of present state
+                                    const size_t head_size,                       // head size of self-attention
+                                    const int8_t* past_key,                       // past key only
+                                    int8_t* present_key,                          // present key only
+                                    const bool past_present_share_buffer,         // whether past and present share the buffer
+                                    const bool packed_qkv,                        // whether Q, K, V are packed
+                                    const bool is_prompt,                         // whether it is prompt
+                                    ThreadPool* tp,                               // thread pool
+                                    AllocatorPtr allocator) const {               // allocator for temporary buffer
+    const ptrdiff_t packed_batch_stride =
+        packed_qkv ? SafeInt<ptrdiff_t>(num_heads_ + 2 * kv_num_heads_) * sequence_length * head_size
+                   : SafeInt<ptrdiff_t>(0);
+    const size_t kv_num_heads_factor = num_heads_ / kv_num_heads_;
+    const size_t q_input_chunk_length = sequence_length * head_size;   // S x H
+    const size_t kv_input_chunk_length = sequence_length * head_size;  // L x H
+    const size_t row_bytes = QuantKvRowBytes(head_size);
+    const size_t past_buff_chunk_bytes = past_buffer_sequence_length * row_bytes;
+    const size_t present_buff_chunk_bytes = present_buffer_sequence_length * row_bytes;
+
+    if (!past_present_share_buffer) {
+      // all-zero rows carry a zero scale and dequantize to zero
+      memset(present_key, 0, batch_size * kv_num_heads_ * present_buff_chunk_bytes);
+    }
+
+    const size_t loop_len = batch_size * num_heads_;
+    const float alpha = scale_ == 0.0f ? 1.0f / sqrt(static_cast<float>(head_size)) : scale_;
+
+    TensorOpCost unit_cost;
+    const ptrdiff_t probs_matrix_bytes =
+        SafeInt<ptrdiff_t>(sequence_length) * present_buffer_sequence_length * sizeof(float);
+    unit_cost.compute_cycles =
+        static_cast<double>(SafeInt<ptrdiff_t>(2) * sequence_length * head_size * present_buffer_sequence_length);
+    unit_cost.bytes_loaded = static_cast<double>(sequence_length * head_size * sizeof(float) +
+                                                 present_buffer_sequence_length * row_bytes);
+    unit_cost.bytes_stored = static_cast<double>(probs_matrix_bytes);
+
+    unit_cost.bytes_loaded += static_cast<double>(probs_matrix_bytes);
+    unit_cost.bytes_stored += static_cast<double>(probs_matrix_bytes);
+
+    // the dequantized K scratch is written and read back once per head
+    double dequant_bytes = static_cast<double>(present_buffer_sequence_length * head_size * sizeof(float));
+    unit_cost.bytes_loaded += dequant_bytes;
+    unit_cost.bytes_stored += dequant_bytes;
+
+    ThreadPool::TryParallelFor(tp, loop_len, unit_cost, [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+      for (std::ptrdiff_t i = begin; i != end; ++i) {
+        const size_t batch_index = i / num_heads_;
+        const size_t head_index = i % num_heads_;
+        const size_t total_seqlen = static_cast<size_t>(seqlens_k[batch_index]) + 1;
+        const size_t past_seqlen = is_prompt ? 0 : total_seqlen - sequence_length;  // Assume no padding sequence length
+        const size_t kv_len = total_seqlen;
+
+        const ptrdiff_t output_offset = SafeInt<ptrdiff_t>(i) * sequence_length * present_buffer_sequence_length;
+        float* output = attention_probs + output_offset;
+
+        const float* k_new;
+        if (packed_qkv) {
+          k_new = K + packed_batch_stride * batch_index + kv_input_chunk_length * (head_index / kv_num_heads_factor);
+        } else {
+          k_new = K + kv_input_chunk_length * (i / kv_num_heads_factor);
+        }
+        const int8_t* k_quant = AppendQuantKvChunk(past_key, k_new, present_key, present_buff_chunk_bytes,
+                                                   past_buff_chunk_bytes, past_seqlen, sequence_length, head_size,
+                                                   past_present_share_buffer, i / kv_num_heads_factor);
+
+        size_t bytes = head_size * kv_len * sizeof(float);
+        auto k_fp32_data = allocator->Alloc(bytes);
+        BufferUniquePtr scratch_buffer(k_fp32_data, BufferDeleter(allocator));
+        float* k_fp32 = static_cast<float*>(k_fp32_data);
+        DequantizeKvRows(k_quant, kv_len, head_size, k_fp32);
+
+        const float* q;
+        if (packed_qkv) {
+          q = Q + packed_batch_stride * batch_index + q_input_chunk_length * head_index;
+        } else {
+          q = Q + q_input_chunk_length * i;
+        }
+
+        math::GemmEx<float, ThreadPool>(CblasNoTrans, CblasTrans, sequence_length, kv_len, head_size, alpha, q,
+                                        static_cast<int>(head_size), k_fp32, static_cast<int>(head_size),
+                                        0.0f /*beta*/, output, static_cast<int>(present_buffer_sequence_length),
+                                        nullptr);
+
+        // compute Softmax
+        RunAttentionSoftmax(output, sequence_length, past_seqlen, total_seqlen, kv_len, /*wrapped*/ false,
+                            present_buffer_sequence_length);
+      }
+    });
+  }
+
+  // Quantized-KV counterpart of ComputeVxAttentionScore.
+  void ComputeVxAttentionScoreQuantKv(float* output,                                // buffer for the result with size BxSxNxH
+                                      const float* attention_probs,                 // Attention probs with size BxNxSxT
+                                      const float* V,                               // V value with size BxN_kvxSxH
+                                      const int32_t* seqlens_k,                     // total - 1 sequence lengths tensor
+                                      const size_t batch_size,                      // batch size
+                                      const size_t sequence_length,                 // sequence length
+                                      const size_t past_buffer_sequence_length,     // sequence length in past state
+                                      const size_t present_buffer_sequence_length,  // sequence length in present state
+                                      const size_t head_size,                       // head size of Q, K, V
+                                      const size_t hidden_size,                     // hidden size of Output
+                                      const int8_t* past_value,                     // past value only
+                                      int8_t* present_value,                        // present value only
+                                      const bool past_present_share_buffer,         // whether past and present share the buffer
+                                      const bool packed_qkv,                        // whether Q, K, V are packed
+                                      const bool is_prompt,                         // whether it is prompt
+                                      ThreadPool* tp,
+                                      AllocatorPtr allocator) const {
+    const ptrdiff_t packed_batch_stride =
+        packed_qkv ? SafeInt<ptrdiff_t>(num_heads_ + 2 * kv_num_heads_) * sequence_length * head_size
+                   : SafeInt<ptrdiff_t>(0);
+    const size_t kv_num_heads_factor = num_heads_ / kv_num_heads_;
+    const size_t kv_input_chunk_length = sequence_length * head_size;  // L x H
+    const size_t row_bytes = QuantKvRowBytes(head_size);
+    const size_t past_buff_chunk_bytes = past_buffer_sequence_length * row_bytes;
+    const size_t present_buff_chunk_bytes = present_buffer_sequence_length * row_bytes;
+
+    if (!past_present_share_buffer) {
+      memset(present_value, 0, batch_size * kv_num_heads_ * present_buff_chunk_bytes);
+    }
+
+    const size_t loop_len = batch_size * num_heads_;
+
+    // The cost of Gemm
+    TensorOpCost unit_cost;
+    unit_cost.compute_cycles =
+        static_cast<double>(SafeInt<ptrdiff_t>(2) * sequence_length * head_size * present_buffer_sequence_length);
+    unit_cost.bytes_loaded = static_cast<double>(SafeInt<ptrdiff_t>(sequence_length) * present_buffer_sequence_length * sizeof(float) +
+                                                 present_buffer_sequence_length * row_bytes);
+    unit_cost.bytes_stored = static_cast<double>(sequence_length * head_size * sizeof(float));
+
+    // the dequantized V scratch is written and read back once per head
+    double dequant_bytes = static_cast<double>(present_buffer_sequence_length * head_size * sizeof(float));
+    unit_cost.bytes_loaded += dequant_bytes;
+    unit_cost.bytes_stored += dequant_bytes;
+
+    ThreadPool::TryParallelFor(tp, loop_len, unit_cost, [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+      for (std::ptrdiff_t i = begin; i != end; ++i) {
+        const size_t batch_index = i / num_heads_;
+        const size_t head_index = i % num_heads_;
+        const size_t total_seqlen = static_cast<size_t>(seqlens_k[batch_index]) + 1;
+        const size_t past_seqlen = is_prompt ? 0 : total_seqlen - sequence_length;  // Assume no padding sequence length
+        const size_t kv_len = total_seqlen;
+
+        const float* v_new;
+        if (packed_qkv) {
+          v_new = V + packed_batch_stride * batch_index + kv_input_chunk_length * (head_index / kv_num_heads_factor);
+        } else {
+          v_new = V + kv_input_chunk_length * (i / kv_num_heads_factor);
+        }
+        const int8_t* v_quant = AppendQuantKvChunk(past_value, v_new, present_value, present_buff_chunk_bytes,
+                                                   past_buff_chunk_bytes, past_seqlen, sequence_length, head_size,
+                                                   past_present_share_buffer, i / kv_num_heads_factor);
+
+        size_t bytes = head_size * kv_len * sizeof(float);
+        auto v_fp32_data = allocator->Alloc(bytes);
+        BufferUniquePtr scratch_buffer(v_fp32_data, BufferDeleter(allocator));
+        float* v_fp32 = static_cast<float*>(v_fp32_data);
+        DequantizeKvRows(v_quant, kv_len, head_size, v_fp32);
+
+        const ptrdiff_t attention_probs_offset = SafeInt<ptrdiff_t>(sequence_length) * present_buffer_sequence_length * i;
+
+        float* output_current = output + (batch_index * sequence_length * num_heads_ + head_index) * head_size;
+        math::GemmEx<float, ThreadPool>(CblasNoTrans, CblasNoTrans, sequence_length, head_size, kv_len,
+                                        1.f, /*alpha*/ attention_probs + attention_probs_offset,
+                                        static_cast<int>(present_buffer_sequence_length), v_fp32,
+                                        static_cast<int>(head_size), 0.0f /*beta*/, output_current,
+                                        static_cast<int>(hidden_size), nullptr);
+      }
+    });
+  }
 };
 
 }  // namespace contrib
@@ -31,6 +31,8 @@ namespace contrib {
       kCpuExecutionProvider,                                            \
       KernelDefBuilder()                                                \
           .TypeConstraint("T", DataTypeImpl::GetTensorType<T>())        \
+          .TypeConstraint("T_cache", {DataTypeImpl::GetTensorType<T>(), \
+                                      DataTypeImpl::GetTensorType<int8_t>()}) \
           .TypeConstraint("M", DataTypeImpl::GetTensorType<int32_t>()), \
       GroupQueryAttention<T>);
 
@@ -52,13 +54,44 @@ Status GroupQueryAttention<T>::Compute(OpKernelContext* context) const {
   const Tensor* total_seqlen_tensor = context->Input<Tensor>(6);
   const Tensor* cos_cache = context->Input<Tensor>(7);
   const Tensor* sin_cache = context->Input<Tensor>(8);
+  const Tensor* block_table = context->Input<Tensor>(9);
+
+  // With a paged KV cache, past_key/past_value are a page pool rather than BNSH cache tensors, so
+  // they are validated separately below.
+  const bool is_paged_kv = block_table != nullptr;
+
+  if (kv_cache_quant_type_ != 0) {
+    if (kv_cache_quant_type_ != 1) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, NOT_IMPLEMENTED,
+                             "kv_cache_quant_type ", kv_cache_quant_type_,
+                             " is not supported; only 0 (none) and 1 (int8) are implemented.");
+    }
+    if constexpr (!std::is_same<T, float>::value) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, NOT_IMPLEMENTED,
+                             "The quantized KV cache is only implemented for float input on CPU.");
+    }
+    if (is_paged_kv) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                             "The quantized KV cache is not supported together with a paged KV cache.");
+    }
+    if (past_key != nullptr && past_value != nullptr &&
+        (!past_key->IsDataType<int8_t>() || !past_value->IsDataType<int8_t>())) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                             "Inputs 'past_key' and 'past_value' must be int8 tensors when kv_cache_quant_type is 1.");
+    }
+  } else if (past_key != nullptr && past_value != nullptr && !is_paged_kv &&
+             (!past_key->IsDataType<T>() || !past_value->IsDataType<T>())) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "Inputs 'past_key' and 'past_value' must have the same type as 'query' when "
+                           "kv_cache_quant_type is 0.");
+  }
 
   GroupQueryAttentionParameters parameters = {};
   ORT_RETURN_IF_ERROR(group_query_attention_helper::CheckInputs(query,
                                                                 key,
                                                                 value,
-                                                                past_key,
-                                                                past_value,
+                                                                is_paged_kv ? nullptr : past_key,
+                                                                is_paged_kv ? nullptr : past_value,
                                                                 cos_cache,
                                                                 sin_cache,
                                                                 &parameters,
@@ -67,7 +100,44 @@ Status GroupQueryAttention<T>::Compute(OpKernelContext* context) const {
                                                                 seqlens_k,
                                                                 total_seqlen_tensor,
                                                                 scale_,
-                                                                softcap_));
+                                                                softcap_,
+                                                                kv_cache_quant_type_));
+
+  if (is_paged_kv) {
+    ORT_RETURN_IF_ERROR(group_query_attention_helper::CheckPagedInputs(past_key,
+                                                                       past_value,
+                                                                       block_table,
+                                                                       parameters,
+                                                                       kv_num_heads_));
+  }
+
+  // Sliding-window ring KV cache with optional attention sinks. When local attention is enabled
+  // and the bound KV cache is smaller than the total sequence length, the cache is treated as a
+  // ring buffer: the first num_sink_tokens slots pin the initial tokens and the remaining
+  // local_window_size slots hold the most recent tokens, with each new token overwriting the
+  // oldest non-sink slot in place. Cache memory stays capped regardless of conversation length.
+  if (!is_paged_kv && local_window_size_ > 0 && past_key != nullptr &&
+      parameters.seqlen_past_kv_cache > 0 &&
+      parameters.seqlen_past_kv_cache < parameters.total_sequence_length) {
+    if (kv_cache_quant_type_ != 0) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, NOT_IMPLEMENTED,
+                             "The quantized KV cache is not supported together with a sliding-window ring KV cache.");
+    }
+    if (parameters.seqlen_past_kv_cache != num_sink_tokens_ + local_window_size_) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                             "A KV cache smaller than total_sequence_length must be allocated with exactly "
+                             "num_sink_tokens + local_window_size entries to be used as a sliding window, got ",
+                             parameters.seqlen_past_kv_cache);
+    }
+    if (parameters.sequence_length != 1) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                             "Prompt processing must fit within the sliding-window KV cache; only token "
+                             "generation (sequence_length == 1) may run past the window.");
+    }
+    parameters.is_ring_kv_cache = true;
+    // The cache never grows past its capacity, so present keeps the fixed past shape.
+    parameters.seqlen_present_kv_cache = parameters.seqlen_past_kv_cache;
+  }
 
   const int batch_size = parameters.batch_size;
   const int sequence_length = parameters.sequence_length;
@@ -82,10 +152,33 @@ Status GroupQueryAttention<T>::Compute(OpKernelContext* context) const {
   output_shape[2] = static_cast<int64_t>(q_hidden_size);
   Tensor* output = context->Output(0, output_shape);
 
-  std::vector<int64_t> present_k_shape({static_cast<int64_t>(batch_size), static_cast<int64_t>(kv_num_heads_), static_cast<int64_t>(present_kv_seqlen), static_cast<int64_t>(head_size)});
-  std::vector<int64_t> present_v_shape({static_cast<int64_t>(batch_size), static_cast<int64_t>(kv_num_heads_), static_cast<int64_t>(present_kv_seqlen), static_cast<int64_t>(head_size)});
-  Tensor* present_k = context->Output(1, present_k_shape);
-  Tensor* present_v = context->Output(2, present_v_shape);
+  Tensor* present_k;
+  Tensor* present_v;
+  if (is_paged_kv) {
+    // In paged mode the present outputs carry the updated page pool.
+    present_k = context->Output(1, past_key->Shape());
+    present_v = context->Output(2, past_value->Shape());
+  } else {
+    // Quantized cache rows carry head_size int8 values plus a trailing float32 scale.
+    const int64_t cache_head_size = kv_cache_quant_type_ == 1
+                                        ? static_cast<int64_t>(head_size) + static_cast<int64_t>(sizeof(float))
+                                        : static_cast<int64_t>(head_size);
+    std::vector<int64_t> present_k_shape({static_cast<int64_t>(batch_size), static_cast<int64_t>(kv_num_heads_), static_cast<int64_t>(present_kv_seqlen), cache_head_size});
+    std::vector<int64_t> present_v_shape({static_cast<int64_t>(batch_size), static_cast<int64_t>(kv_num_heads_), static_cast<int64_t>(present_kv_seqlen), cache_head_size});
+    present_k = context->Output(1, present_k_shape);
+    present_v = context->Output(2, present_v_shape);
+  }
+
+  // When the cache is contiguous and past/present are bound to the same buffer, the rotary
+  // embedding for K (and the plain copy for V) can write the new tokens directly into their
+  // present cache slot, saving a round-trip through a temporary buffer that ApplyAttention would
+  // otherwise copy into the cache again. The fused writers place tokens at their unwrapped cache
+  // position, so a ring cache takes the regular path and appends inside ApplyAttention instead.
+  const bool fused_rotary_kv_append = do_rotary_ && !is_paged_kv && !parameters.is_ring_kv_cache &&
+                                      kv_cache_quant_type_ == 0 &&
+                                      past_key != nullptr && past_value != nullptr &&
+                                      past_key->Data<T>() == present_k->Data<T>() &&
+                                      past_value->Data<T>() == present_v->Data<T>();
 
   AllocatorPtr allocator;
   ORT_RETURN_IF_ERROR(context->GetTempSpaceAllocator(&allocator));
@@ -133,7 +226,8 @@ Status GroupQueryAttention<T>::Compute(OpKernelContext* context) const {
     if (parameters.is_first_prompt) {
       pos_ids[0] = static_cast<int64_t>(0);
     } else {
-      // Note: As of now, continuous decoding supports only batch size 1 and token generation supports only sequence length 1.
+      // Note: multi-token passes (continuous decoding or draft-token verification) derive each
+      // sequence's positions from its own seqlens_k entry, so any batch size is supported on CPU.
       for (int b = 0; b < batch_size; b++) {
         const int total_seqlen = seqlens_k->Data<int32_t>()[b] + 1;
         const int past_seqlen = total_seqlen - sequence_length;
@@ -157,45 +251,91 @@ Status GroupQueryAttention<T>::Compute(OpKernelContext* context) const {
       k_rotary = q_rotary + num_heads_ * sequence_length * head_size;
     } else {
       Tensor::InitOrtValue(element_type, TensorShape({batch_size, num_heads_, sequence_length, head_size}), allocator, RotaryQ);
-      Tensor::InitOrtValue(element_type, TensorShape({batch_size, kv_num_heads_, sequence_length, head_size}), allocator, RotaryK);
       q_input = Q.Get<Tensor>().Data<T>();
       k_input = K.Get<Tensor>().Data<T>();
       q_rotary = RotaryQ.GetMutable<Tensor>()->MutableData<T>();
-      k_rotary = RotaryK.GetMutable<Tensor>()->MutableData<T>();
+      if (!fused_rotary_kv_append) {
+        Tensor::InitOrtValue(element_type, TensorShape({batch_size, kv_num_heads_, sequence_length, head_size}), allocator, RotaryK);
+        k_rotary = RotaryK.GetMutable<Tensor>()->MutableData<T>();
+      }
     }
     // Run rotary embedding for Q and K
     ORT_RETURN_IF_ERROR(RunRotaryEmbedding<T>(tp, rotary_params, q_input,
                                               pos_ids.data(), cos_cache->Data<T>(),
                                               sin_cache->Data<T>(), q_rotary, rotary_interleaved_));
 
-    rotary_params.num_heads = kv_num_heads_;
-    rotary_params.hidden_size = parameters.kv_hidden_size;
-    if (!packed_qkv) {
-      rotary_params.batch_stride = kv_num_heads_ * rotary_params.head_stride;
-    }
-    ORT_RETURN_IF_ERROR(RunRotaryEmbedding<T>(tp, rotary_params, k_input,
-                                              pos_ids.data(), cos_cache->Data<T>(),
-                                              sin_cache->Data<T>(), k_rotary, rotary_interleaved_));
-    // Pack V into rotary QKV buffer
-    if (packed_qkv) {
-      const T* v_input = k_input + kv_num_heads_ * sequence_length * head_size;
-      T* v_rotary = k_rotary + kv_num_heads_ * sequence_length * head_size;
-      ORT_RETURN_IF_ERROR(rotary_helper::PackVIntoRotaryQKV<T>(tp,
-                                                               parameters.batch_size,
-                                                               parameters.sequence_length,
-                                                               parameters.num_heads,
-                                                               parameters.kv_num_heads,
-                                                               parameters.head_size,
-                                                               v_input,
-                                                               v_rotary));
+    if (fused_rotary_kv_append) {
+      // Rotate K and copy V directly into their present cache slots instead of materializing them
+      // in the rotary buffers only for ApplyAttention to append them to the cache again.
+      const int kv_input_batch_stride =
+          (packed_qkv ? (num_heads_ + 2 * kv_num_heads_) : kv_num_heads_) * sequence_length * head_size;
+      ORT_RETURN_IF_ERROR(rotary_helper::RunRotaryEmbeddingIntoPresent<T>(tp, batch_size, sequence_length,
+                                                                          kv_num_heads_, head_size,
+                                                                          parameters.rotary_dim,
+                                                                          kv_input_batch_stride,
+                                                                          rotary_interleaved_,
+                                                                          parameters.is_first_prompt,
+                                                                          seqlens_k->Data<int32_t>(),
+                                                                          k_input,
+                                                                          cos_cache->Data<T>(),
+                                                                          sin_cache->Data<T>(),
+                                                                          present_k->MutableData<T>(),
+                                                                          present_kv_seqlen));
+      const T* v_input = packed_qkv ? k_input + kv_num_heads_ * sequence_length * head_size
+                                    : V.Get<Tensor>().Data<T>();
+      ORT_RETURN_IF_ERROR(rotary_helper::PackVIntoPresent<T>(tp, batch_size, sequence_length,
+                                                             kv_num_heads_, head_size,
+                                                             kv_input_batch_stride,
+                                                             parameters.is_first_prompt,
+                                                             seqlens_k->Data<int32_t>(),
+                                                             v_input,
+                                                             present_v->MutableData<T>(),
+                                                             present_kv_seqlen));
+    } else {
+      rotary_params.num_heads = kv_num_heads_;
+      rotary_params.hidden_size = parameters.kv_hidden_size;
+      if (!packed_qkv) {
+        rotary_params.batch_stride = kv_num_heads_ * rotary_params.head_stride;
+      }
+      ORT_RETURN_IF_ERROR(RunRotaryEmbedding<T>(tp, rotary_params, k_input,
+                                                pos_ids.data(), cos_cache->Data<T>(),
+                                                sin_cache->Data<T>(), k_rotary, rotary_interleaved_));
+      // Pack V into rotary QKV buffer
+      if (packed_qkv) {
+        const T* v_input = k_input + kv_num_heads_ * sequence_length * head_size;
+        T* v_rotary = k_rotary + kv_num_heads_ * sequence_length * head_size;
+        ORT_RETURN_IF_ERROR(rotary_helper::PackVIntoRotaryQKV<T>(tp,
+                                                                 parameters.batch_size,
+                                                                 parameters.sequence_length,
+                                                                 parameters.num_heads,
+                                                                 parameters.kv_num_heads,
+                                                                 parameters.head_size,
+                                                                 v_input,
+                                                                 v_rotary));
+      }
     }
   }
 
   ORT_RETURN_IF_ERROR(context->GetTempSpaceAllocator(&allocator));
+
+  if constexpr (std::is_same<T, float>::value) {
+    if (kv_cache_quant_type_ == 1) {
+      // int8 cache rows with trailing per-row scales; the new tokens are quantized on append and
+      // the cache is dequantized on the fly inside the attention computation.
+      return ApplyAttentionQuantKv(q_rotary,
+                                   packed_qkv ? nullptr : k_rotary,
+                                   packed_qkv ? nullptr : V.Get<Tensor>().Data<T>(),
+                                   past_key, past_value, output, present_k, present_v,
+                                   seqlens_k, parameters, allocator, context);
+    }
+  }
+
   // Compute the attention score and apply the score to V
-  return ApplyAttention(q_rotary, packed_qkv ? nullptr : k_rotary, packed_qkv ? nullptr : V.Get<Tensor>().Data<T>(),
+  return ApplyAttention(q_rotary,
+                        (packed_qkv || fused_rotary_kv_append) ? nullptr : k_rotary,
+                        (packed_qkv || fused_rotary_kv_append) ? nullptr : V.Get<Tensor>().Data<T>(),
                         past_key, past_value, output, present_k, present_v,
-                        seqlens_k, parameters, allocator, context);
+                        seqlens_k, block_table, parameters, allocator, context, fused_rotary_kv_append);
 }
 }  // namespace contrib
 }  // namespace onnxruntime
@@ -24,10 +24,13 @@ Status CheckInputs(const Tensor* query,
                    const Tensor* seqlens_k,
                    const Tensor* total_seqlen,
                    float scale,
-                   float softcap) {
+                   float softcap,
+                   int kv_cache_quant_type = 0) {
   // Note: Here S* is seqlen_past_kv_cache, S+ is seqlen_present_kv_cache
   //     past_key                   : (B, N_k, S*, H) or (B, N_k, S+, H) or nullptr
   //     past_value                 : (B, N_k, S*, H) or (B, N_k, S+, H) or nullptr
+  // With an int8-quantized KV cache (kv_cache_quant_type == 1) each past/present cache row stores
+  // head_size int8 values plus a trailing float32 scale, so the cache head dimension is H + 4.
   // no packing for q/k/v:
   //     query            (Q)       : (B, S, D) or (B, S, (D_q + 2 D_kv))
   //     key              (K)       : (B, S, D_kv) or nullptr
@@ -153,14 +156,17 @@ Status CheckInputs(const Tensor* query,
     // We assume all sequence in past kv are right-padded to max or past sequence length
     past_sequence_length = static_cast<int>(past_key_dims[2]);
 
-    if (past_key_dims[3] != head_size) {
+    const int64_t cache_head_size = kv_cache_quant_type == 1
+                                        ? static_cast<int64_t>(head_size) + static_cast<int64_t>(sizeof(float))
+                                        : static_cast<int64_t>(head_size);
+    if (past_key_dims[3] != cache_head_size) {
       return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
-                             "Input 'past_key' dimension 3 should be same as head_size, got ",
+                             "Input 'past_key' dimension 3 should be ", cache_head_size, ", got ",
                              past_key_dims[3]);
     }
-    if (past_value_dims[3] != head_size) {
+    if (past_value_dims[3] != cache_head_size) {
       return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
-                             "Input 'past_value' dimension 3 should be same as head_size, got ",
+                             "Input 'past_value' dimension 3 should be ", cache_head_size, ", got ",
                              past_value_dims[3]);
     }
   } else if (past_key != nullptr || past_value != nullptr) {
@@ -220,10 +226,10 @@ Status CheckInputs(const Tensor* query,
 
   bool is_subsequent_prompt = false;
   if (sequence_length > 1 && sequence_length != total_sequence_length) {
-    if (batch_size != 1) {
-      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
-                             "batch_size must be 1 when sequence_length > 1 and past context is given.");
-    }
+    // Multi-token passes over past context cover both continuous decoding and verifying a batch of
+    // draft tokens in one call (speculative decoding). The CPU kernel applies causal masking per
+    // sequence for any batch size; GPU kernels that only handle batch_size == 1 enforce that
+    // restriction themselves.
     is_subsequent_prompt = true;
   }
 
@@ -265,6 +271,58 @@ Status CheckInputs(const Tensor* query,
   return Status::OK();
 }
 
+// Validates the paged KV-cache inputs. Expects 'parameters' to be filled in by CheckInputs already
+// (with past_key/past_value omitted there, since the page pool does not have BNSH cache shape).
+// In paged mode past_key/past_value are a page pool of shape (num_pages, kv_num_heads, page_size, head_size)
+// shared by all sequences, and block_table has shape (batch_size, max_blocks_per_sequence).
+inline Status CheckPagedInputs(const Tensor* past_key,
+                               const Tensor* past_value,
+                               const Tensor* block_table,
+                               const GroupQueryAttentionParameters& parameters,
+                               int kv_num_heads) {
+  if (past_key == nullptr || past_value == nullptr) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "Inputs 'past_key' and 'past_value' (the KV page pool) are required when "
+                           "'block_table' is provided.");
+  }
+
+  const auto& key_pool_dims = past_key->Shape().GetDims();
+  if (key_pool_dims.size() != 4 || past_key->Shape() != past_value->Shape()) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "Inputs 'past_key' and 'past_value' are expected to be identically shaped "
+                           "(num_pages, kv_num_heads, page_size, head_size) page pools when 'block_table' is provided.");
+  }
+  if (key_pool_dims[1] != kv_num_heads) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "KV page pool dimension 1 should be kv_num_heads, got ", key_pool_dims[1]);
+  }
+  if (key_pool_dims[2] < 1) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "KV page pool dimension 2 (page_size) should be at least 1, got ", key_pool_dims[2]);
+  }
+  if (key_pool_dims[3] != parameters.head_size) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "KV page pool dimension 3 should be head_size, got ", key_pool_dims[3]);
+  }
+
+  const auto& block_table_dims = block_table->Shape().GetDims();
+  if (block_table_dims.size() != 2) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "Input 'block_table' is expected to have 2 dimensions, got ", block_table_dims.size());
+  }
+  if (block_table_dims[0] != parameters.batch_size) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "Input 'block_table' dimension 0 should be batch_size, got ", block_table_dims[0]);
+  }
+  if (block_table_dims[1] * key_pool_dims[2] < parameters.total_sequence_length) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "Input 'block_table' does not reference enough pages to hold total_sequence_length ",
+                           parameters.total_sequence_length, " entries.");
+  }
+
+  return Status::OK();
+}
+
 Status CheckInputs(const Tensor* query,
                    const Tensor* key,
                    const Tensor* value,
@@ -279,12 +337,13 @@ Status CheckInputs(const Tensor* query,
                    const Tensor* total_seqlen,
                    float scale,
                    float softcap,
+                   int kv_cache_quant_type,
                    int max_threads_per_block) {
   if (max_threads_per_block > 0 && num_heads > max_threads_per_block) {
     return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "num_heads should be no larger than ", max_threads_per_block);
   }
 
-  return CheckInputs(query, key, value, past_key, past_value, cos_cache, sin_cache, parameters, num_heads, kv_num_heads, seqlens_k, total_seqlen, scale, softcap);
+  return CheckInputs(query, key, value, past_key, past_value, cos_cache, sin_cache, parameters, num_heads, kv_num_heads, seqlens_k, total_seqlen, scale, softcap, kv_cache_quant_type);
 }
 }  // namespace group_query_attention_helper
 }  // namespace contrib
@@ -147,9 +147,7 @@ Status MultiHeadAttention<T>::Compute(OpKernelContext* context) const {
 
   if (std::is_same_v<T, float> &&
       !disable_flash_ &&
-      !is_unidirectional_ &&
       key_padding_mask == nullptr &&
-      attn_bias == nullptr &&
       past_key == nullptr &&
       past_value == nullptr &&
       present_k == nullptr &&
@@ -205,6 +203,11 @@ Status MultiHeadAttention<T>::Compute(OpKernelContext* context) const {
     args.value = V.Get<Tensor>().Data<float>();
     args.output = output->MutableData<float>();
 
+    args.attention_bias = attn_bias != nullptr ? attn_bias->Data<float>() : nullptr;
+    args.broadcast_attention_bias_batch = parameters.broadcast_attn_bias_dim_0;
+    args.broadcast_attention_bias_head = parameters.broadcast_attn_bias_dim_1;
+    args.causal = is_unidirectional_;
+
     MlasFlashAttention(&args, tp);
     return Status::OK();
   }
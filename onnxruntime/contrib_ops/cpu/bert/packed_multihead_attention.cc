@@ -0,0 +1,324 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "contrib_ops/cpu/bert/packed_multihead_attention.h"
+
+#include "core/common/safeint.h"
+#include "core/platform/threadpool.h"
+#include "core/util/math.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+using onnxruntime::concurrency::ThreadPool;
+
+namespace onnxruntime {
+namespace contrib {
+
+ONNX_OPERATOR_TYPED_KERNEL_EX(
+    PackedMultiHeadAttention,
+    kMSDomain,
+    1,
+    float,
+    kCpuExecutionProvider,
+    KernelDefBuilder()
+        .TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+    PackedMultiHeadAttention<float>);
+
+template <typename T>
+PackedMultiHeadAttention<T>::PackedMultiHeadAttention(const OpKernelInfo& info) : OpKernel(info) {
+  int64_t num_heads = 0;
+  ORT_ENFORCE(info.GetAttr("num_heads", &num_heads).IsOK() && num_heads > 0);
+  num_heads_ = static_cast<int>(num_heads);
+
+  scale_ = info.GetAttrOrDefault<float>("scale", 0.0f);
+}
+
+namespace {
+
+// In-place softmax of each row of an L x L score matrix.
+void SoftmaxInplace(float* scores, int64_t rows, int64_t columns) {
+  for (int64_t r = 0; r < rows; r++) {
+    float* row = scores + r * columns;
+
+    float row_max = row[0];
+    for (int64_t c = 1; c < columns; c++) {
+      row_max = std::max(row_max, row[c]);
+    }
+
+    float sum = 0.0f;
+    for (int64_t c = 0; c < columns; c++) {
+      row[c] = std::exp(row[c] - row_max);
+      sum += row[c];
+    }
+
+    const float inverse_sum = 1.0f / sum;
+    for (int64_t c = 0; c < columns; c++) {
+      row[c] *= inverse_sum;
+    }
+  }
+}
+
+}  // namespace
+
+template <typename T>
+Status PackedMultiHeadAttention<T>::Compute(OpKernelContext* context) const {
+  // shape of inputs:
+  //   query:                       (token_count, hidden_size)
+  //                             or (token_count, num_heads, 3, head_size) when QKV is packed
+  //   key:                         (token_count, hidden_size) or None
+  //   value:                       (token_count, v_hidden_size) or None
+  //   bias:                        (hidden_size + hidden_size + v_hidden_size) or None
+  //   token_offset:                (batch_size, sequence_length)
+  //   cumulative_sequence_length:  (batch_size + 1)
+  //   attention_bias:              (batch_size or 1, num_heads or 1, sequence_length, sequence_length) or None
+  // shape of output:
+  //   output:                      (token_count, v_hidden_size)
+  const Tensor* query = context->Input<Tensor>(0);
+  const Tensor* key = context->Input<Tensor>(1);
+  const Tensor* value = context->Input<Tensor>(2);
+  const Tensor* bias = context->Input<Tensor>(3);
+  const Tensor* token_offset = context->Input<Tensor>(4);
+  const Tensor* cumulative_sequence_length = context->Input<Tensor>(5);
+  const Tensor* attention_bias = context->Input<Tensor>(6);
+
+  const auto& query_dims = query->Shape().GetDims();
+  const bool is_packed_qkv = query_dims.size() == 4;
+  if (!is_packed_qkv && query_dims.size() != 2) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "Input 'query' is expected to have 2 or 4 dimensions, got ", query_dims.size());
+  }
+  const int64_t token_count = query_dims[0];
+
+  int64_t hidden_size;
+  int64_t v_hidden_size;
+  int64_t head_size;
+  if (is_packed_qkv) {
+    if (key != nullptr || value != nullptr) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                             "Inputs 'key' and 'value' shall be empty when 'query' has packed QKV");
+    }
+    if (query_dims[1] != num_heads_ || query_dims[2] != 3) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                             "Input 'query' with packed QKV is expected to have shape "
+                             "(token_count, num_heads, 3, head_size)");
+    }
+    head_size = query_dims[3];
+    hidden_size = static_cast<int64_t>(num_heads_) * head_size;
+    v_hidden_size = hidden_size;
+  } else {
+    if (key == nullptr || value == nullptr) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                             "Inputs 'key' and 'value' are required when 'query' is not packed QKV");
+    }
+    hidden_size = query_dims[1];
+    if (hidden_size % num_heads_ != 0) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "hidden_size shall be divisible by num_heads");
+    }
+    head_size = hidden_size / num_heads_;
+
+    const auto& key_dims = key->Shape().GetDims();
+    if (key_dims.size() != 2 || key_dims[0] != token_count || key_dims[1] != hidden_size) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                             "Input 'key' is expected to have shape (token_count, hidden_size)");
+    }
+
+    const auto& value_dims = value->Shape().GetDims();
+    if (value_dims.size() != 2 || value_dims[0] != token_count) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                             "Input 'value' is expected to have shape (token_count, v_hidden_size)");
+    }
+    v_hidden_size = value_dims[1];
+    if (v_hidden_size % num_heads_ != 0) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "v_hidden_size shall be divisible by num_heads");
+    }
+  }
+  const int64_t v_head_size = v_hidden_size / num_heads_;
+
+  const auto& offset_dims = token_offset->Shape().GetDims();
+  if (offset_dims.size() != 2) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "Input 'token_offset' is expected to have 2 dimensions, got ", offset_dims.size());
+  }
+  const int64_t batch_size = offset_dims[0];
+  const int64_t sequence_length = offset_dims[1];
+
+  if (cumulative_sequence_length->Shape().NumDimensions() != 1 ||
+      cumulative_sequence_length->Shape()[0] != batch_size + 1) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "Input 'cumulative_sequence_length' is expected to have shape (batch_size + 1)");
+  }
+  const int32_t* cu_seqlens = cumulative_sequence_length->Data<int32_t>();
+  if (cu_seqlens[0] != 0 || cu_seqlens[batch_size] != token_count) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "cumulative_sequence_length shall start at 0 and end at token_count");
+  }
+  for (int64_t b = 0; b < batch_size; b++) {
+    const int64_t length = cu_seqlens[b + 1] - cu_seqlens[b];
+    if (length < 0 || length > sequence_length) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "cumulative_sequence_length[", b + 1,
+                             "] gives a sequence length out of range [0, sequence_length]");
+    }
+  }
+
+  if (bias != nullptr &&
+      bias->Shape().Size() != hidden_size + hidden_size + v_hidden_size) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "Input 'bias' is expected to have shape (hidden_size + hidden_size + v_hidden_size)");
+  }
+
+  bool broadcast_bias_batch = false;
+  bool broadcast_bias_head = false;
+  if (attention_bias != nullptr) {
+    const auto& bias_dims = attention_bias->Shape().GetDims();
+    if (bias_dims.size() != 4 ||
+        (bias_dims[0] != batch_size && bias_dims[0] != 1) ||
+        (bias_dims[1] != num_heads_ && bias_dims[1] != 1) ||
+        bias_dims[2] != sequence_length || bias_dims[3] != sequence_length) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                             "Input 'attention_bias' is expected to have shape "
+                             "(batch_size or 1, num_heads or 1, sequence_length, sequence_length)");
+    }
+    broadcast_bias_batch = bias_dims[0] == 1;
+    broadcast_bias_head = bias_dims[1] == 1;
+  }
+
+  Tensor* output = context->Output(0, {token_count, v_hidden_size});
+  if (token_count == 0) {
+    return Status::OK();
+  }
+
+  AllocatorPtr allocator;
+  ORT_RETURN_IF_ERROR(context->GetTempSpaceAllocator(&allocator));
+  ThreadPool* tp = context->GetOperatorThreadPool();
+
+  // Materialize Q, K and V in token-major layout (token_count, hidden_size) with the input
+  // projection bias folded in, so the per-sequence GEMMs below only differ in pointers and
+  // leading dimensions. When the inputs already have that layout and there is no bias, use
+  // them directly.
+  const T* q_data = nullptr;
+  const T* k_data = nullptr;
+  const T* v_data = nullptr;
+  IAllocatorUniquePtr<T> qkv_buffer;
+  if (is_packed_qkv || bias != nullptr) {
+    const size_t qkv_size = SafeInt<size_t>(token_count) * (hidden_size + hidden_size + v_hidden_size);
+    qkv_buffer = IAllocator::MakeUniquePtr<T>(allocator, qkv_size);
+    T* q_buffer = qkv_buffer.get();
+    T* k_buffer = q_buffer + static_cast<size_t>(token_count) * hidden_size;
+    T* v_buffer = k_buffer + static_cast<size_t>(token_count) * hidden_size;
+
+    const T* query_data = query->Data<T>();
+    const T* key_data = (key != nullptr) ? key->Data<T>() : nullptr;
+    const T* value_data = (value != nullptr) ? value->Data<T>() : nullptr;
+    const T* bias_data = (bias != nullptr) ? bias->Data<T>() : nullptr;
+
+    ThreadPool::TrySimpleParallelFor(tp, static_cast<std::ptrdiff_t>(token_count), [&](std::ptrdiff_t t) {
+      if (is_packed_qkv) {
+        // query element (t, n, j, d) lives at ((t * num_heads + n) * 3 + j) * head_size + d
+        for (int64_t n = 0; n < num_heads_; n++) {
+          const T* packed = query_data + ((t * num_heads_ + n) * 3) * head_size;
+          T* q_row = q_buffer + t * hidden_size + n * head_size;
+          T* k_row = k_buffer + t * hidden_size + n * head_size;
+          T* v_row = v_buffer + t * v_hidden_size + n * head_size;
+          for (int64_t d = 0; d < head_size; d++) {
+            const int64_t i = n * head_size + d;
+            q_row[d] = packed[d] + (bias_data != nullptr ? bias_data[i] : T{});
+            k_row[d] = packed[head_size + d] + (bias_data != nullptr ? bias_data[hidden_size + i] : T{});
+            v_row[d] = packed[2 * head_size + d] + (bias_data != nullptr ? bias_data[2 * hidden_size + i] : T{});
+          }
+        }
+      } else {
+        for (int64_t i = 0; i < hidden_size; i++) {
+          q_buffer[t * hidden_size + i] = query_data[t * hidden_size + i] + bias_data[i];
+          k_buffer[t * hidden_size + i] = key_data[t * hidden_size + i] + bias_data[hidden_size + i];
+        }
+        for (int64_t i = 0; i < v_hidden_size; i++) {
+          v_buffer[t * v_hidden_size + i] = value_data[t * v_hidden_size + i] + bias_data[2 * hidden_size + i];
+        }
+      }
+    });
+
+    q_data = q_buffer;
+    k_data = k_buffer;
+    v_data = v_buffer;
+  } else {
+    q_data = query->Data<T>();
+    k_data = key->Data<T>();
+    v_data = value->Data<T>();
+  }
+
+  // One L x L score matrix per (sequence, head). Sequences see only their own tokens, so this
+  // is the packed equivalent of the (batch, heads, S, S) buffer regular attention allocates.
+  std::vector<size_t> scores_offsets(static_cast<size_t>(batch_size));
+  size_t scores_size = 0;
+  for (int64_t b = 0; b < batch_size; b++) {
+    scores_offsets[static_cast<size_t>(b)] = scores_size;
+    const size_t length = static_cast<size_t>(cu_seqlens[b + 1] - cu_seqlens[b]);
+    scores_size += SafeInt<size_t>(num_heads_) * length * length;
+  }
+  auto scores_buffer = IAllocator::MakeUniquePtr<float>(allocator, std::max<size_t>(scores_size, 1));
+
+  const float scale = (scale_ == 0.0f) ? 1.0f / std::sqrt(static_cast<float>(head_size)) : scale_;
+  const float* attention_bias_data = (attention_bias != nullptr) ? attention_bias->Data<float>() : nullptr;
+  T* output_data = output->MutableData<T>();
+
+  ThreadPool::TrySimpleParallelFor(
+      tp, static_cast<std::ptrdiff_t>(batch_size) * num_heads_, [&](std::ptrdiff_t i) {
+        const int64_t b = i / num_heads_;
+        const int64_t n = i % num_heads_;
+        const int64_t start = cu_seqlens[b];
+        const int64_t length = cu_seqlens[b + 1] - start;
+        if (length == 0) {
+          return;
+        }
+
+        float* scores = scores_buffer.get() + scores_offsets[static_cast<size_t>(b)] +
+                        static_cast<size_t>(n) * length * length;
+        const T* q = q_data + start * hidden_size + n * head_size;
+        const T* k = k_data + start * hidden_size + n * head_size;
+        const T* v = v_data + start * v_hidden_size + n * v_head_size;
+
+        // scores = scale * Q x K', with rows strided by hidden_size
+        math::GemmEx<float, ThreadPool>(CblasNoTrans, CblasTrans,
+                                        length, length, head_size,
+                                        scale,
+                                        q, static_cast<int>(hidden_size),
+                                        k, static_cast<int>(hidden_size),
+                                        0.0f,
+                                        scores, static_cast<int>(length),
+                                        nullptr);
+
+        if (attention_bias_data != nullptr) {
+          // padding is on the right, so token j of this sequence sits at position j
+          const float* bias_matrix = attention_bias_data +
+                                     ((broadcast_bias_batch ? 0 : b) * (broadcast_bias_head ? 1 : num_heads_) +
+                                      (broadcast_bias_head ? 0 : n)) *
+                                         sequence_length * sequence_length;
+          for (int64_t r = 0; r < length; r++) {
+            for (int64_t c = 0; c < length; c++) {
+              scores[r * length + c] += bias_matrix[r * sequence_length + c];
+            }
+          }
+        }
+
+        SoftmaxInplace(scores, length, length);
+
+        // output = probs x V, with V rows and output rows strided by v_hidden_size
+        math::GemmEx<float, ThreadPool>(CblasNoTrans, CblasNoTrans,
+                                        length, v_head_size, length,
+                                        1.0f,
+                                        scores, static_cast<int>(length),
+                                        v, static_cast<int>(v_hidden_size),
+                                        0.0f,
+                                        output_data + start * v_hidden_size + n * v_head_size,
+                                        static_cast<int>(v_hidden_size),
+                                        nullptr);
+      });
+
+  return Status::OK();
+}
+
+}  // namespace contrib
+}  // namespace onnxruntime
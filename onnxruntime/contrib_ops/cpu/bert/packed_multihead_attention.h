@@ -0,0 +1,23 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+#include "core/common/common.h"
+#include "core/framework/op_kernel.h"
+
+namespace onnxruntime {
+namespace contrib {
+
+template <typename T>
+class PackedMultiHeadAttention final : public OpKernel {
+ public:
+  PackedMultiHeadAttention(const OpKernelInfo& info);
+  Status Compute(OpKernelContext* context) const override;
+
+ private:
+  int num_heads_;
+  float scale_;
+};
+
+}  // namespace contrib
+}  // namespace onnxruntime
@@ -0,0 +1,104 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "contrib_ops/cpu/bert/remove_padding.h"
+
+#include "core/common/safeint.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace onnxruntime {
+namespace contrib {
+
+ONNX_OPERATOR_TYPED_KERNEL_EX(
+    RemovePadding,
+    kMSDomain,
+    1,
+    float,
+    kCpuExecutionProvider,
+    KernelDefBuilder()
+        .TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+    RemovePadding<float>);
+
+template <typename T>
+RemovePadding<T>::RemovePadding(const OpKernelInfo& info) : OpKernel(info) {
+}
+
+template <typename T>
+Status RemovePadding<T>::Compute(OpKernelContext* context) const {
+  // shape of inputs:
+  //   input:                   (batch_size, sequence_length, hidden_size)
+  //   sequence_token_count:    (batch_size)
+  // shape of outputs:
+  //   output:                  (total_tokens, hidden_size)
+  //   token_offset:            (batch_size, sequence_length)
+  //   cumulated_seq_len:       (batch_size + 1)
+  //   max_token_count:         (1)
+  const Tensor* input = context->Input<Tensor>(0);
+  const Tensor* sequence_token_count = context->Input<Tensor>(1);
+
+  const auto& dims = input->Shape().GetDims();
+  if (dims.size() != 3) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Input 'input' is expected to have 3 dimensions, got ",
+                           dims.size());
+  }
+  const int64_t batch_size = dims[0];
+  const int64_t sequence_length = dims[1];
+  const int64_t hidden_size = dims[2];
+
+  if (sequence_token_count->Shape().NumDimensions() != 1 ||
+      sequence_token_count->Shape()[0] != batch_size) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "Input 'sequence_token_count' is expected to have shape (batch_size)");
+  }
+
+  const int32_t* token_counts = sequence_token_count->Data<int32_t>();
+  int64_t total_tokens = 0;
+  int32_t max_token_count = 0;
+  for (int64_t b = 0; b < batch_size; b++) {
+    if (token_counts[b] < 0 || token_counts[b] > sequence_length) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "sequence_token_count[", b,
+                             "] is out of range [0, sequence_length]");
+    }
+    total_tokens += token_counts[b];
+    max_token_count = std::max(max_token_count, token_counts[b]);
+  }
+
+  Tensor* output = context->Output(0, {total_tokens, hidden_size});
+  Tensor* token_offset = context->Output(1, {batch_size, sequence_length});
+  Tensor* cumulated_seq_len = context->Output(2, {batch_size + 1});
+  Tensor* max_token_count_tensor = context->Output(3, {1});
+
+  const T* input_data = input->Data<T>();
+  T* output_data = output->MutableData<T>();
+  int32_t* token_offset_data = token_offset->MutableData<int32_t>();
+  int32_t* cumulated_seq_len_data = cumulated_seq_len->MutableData<int32_t>();
+
+  // token_offset lists the flattened offsets of all non-padding tokens first, then those of
+  // all padding tokens, both in batch order. Padding is on the right of each sequence.
+  int64_t token_index = 0;
+  int64_t padding_index = total_tokens;
+  cumulated_seq_len_data[0] = 0;
+  for (int64_t b = 0; b < batch_size; b++) {
+    const int64_t count = token_counts[b];
+    cumulated_seq_len_data[b + 1] = cumulated_seq_len_data[b] + static_cast<int32_t>(count);
+
+    for (int64_t s = 0; s < count; s++) {
+      token_offset_data[token_index++] = static_cast<int32_t>(b * sequence_length + s);
+    }
+    for (int64_t s = count; s < sequence_length; s++) {
+      token_offset_data[padding_index++] = static_cast<int32_t>(b * sequence_length + s);
+    }
+
+    memcpy(output_data + SafeInt<size_t>(cumulated_seq_len_data[b]) * hidden_size,
+           input_data + SafeInt<size_t>(b) * sequence_length * hidden_size,
+           SafeInt<size_t>(count) * hidden_size * sizeof(T));
+  }
+
+  max_token_count_tensor->MutableData<int32_t>()[0] = max_token_count;
+  return Status::OK();
+}
+
+}  // namespace contrib
+}  // namespace onnxruntime
@@ -0,0 +1,79 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "contrib_ops/cpu/bert/restore_padding.h"
+
+#include "core/common/safeint.h"
+
+#include <cstring>
+
+namespace onnxruntime {
+namespace contrib {
+
+ONNX_OPERATOR_TYPED_KERNEL_EX(
+    RestorePadding,
+    kMSDomain,
+    1,
+    float,
+    kCpuExecutionProvider,
+    KernelDefBuilder()
+        .TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+    RestorePadding<float>);
+
+template <typename T>
+RestorePadding<T>::RestorePadding(const OpKernelInfo& info) : OpKernel(info) {
+}
+
+template <typename T>
+Status RestorePadding<T>::Compute(OpKernelContext* context) const {
+  // shape of inputs:
+  //   input:        (total_tokens, hidden_size)
+  //   token_offset: (batch_size, sequence_length)
+  // shape of output:
+  //   output:       (batch_size, sequence_length, hidden_size)
+  const Tensor* input = context->Input<Tensor>(0);
+  const Tensor* token_offset = context->Input<Tensor>(1);
+
+  const auto& input_dims = input->Shape().GetDims();
+  if (input_dims.size() != 2) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Input 'input' is expected to have 2 dimensions, got ",
+                           input_dims.size());
+  }
+  const int64_t total_tokens = input_dims[0];
+  const int64_t hidden_size = input_dims[1];
+
+  const auto& offset_dims = token_offset->Shape().GetDims();
+  if (offset_dims.size() != 2) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "Input 'token_offset' is expected to have 2 dimensions, got ", offset_dims.size());
+  }
+  const int64_t batch_size = offset_dims[0];
+  const int64_t sequence_length = offset_dims[1];
+  if (total_tokens > batch_size * sequence_length) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "Input 'input' has more tokens than token_offset has entries");
+  }
+
+  Tensor* output = context->Output(0, {batch_size, sequence_length, hidden_size});
+
+  const T* input_data = input->Data<T>();
+  const int32_t* token_offset_data = token_offset->Data<int32_t>();
+  T* output_data = output->MutableData<T>();
+
+  // padding positions are filled with zeros; only the first total_tokens offsets are read.
+  memset(output_data, 0, SafeInt<size_t>(batch_size) * sequence_length * hidden_size * sizeof(T));
+  for (int64_t t = 0; t < total_tokens; t++) {
+    const int64_t offset = token_offset_data[t];
+    if (offset < 0 || offset >= batch_size * sequence_length) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "token_offset[", t, "] is out of range");
+    }
+    memcpy(output_data + SafeInt<size_t>(offset) * hidden_size,
+           input_data + SafeInt<size_t>(t) * hidden_size,
+           SafeInt<size_t>(hidden_size) * sizeof(T));
+  }
+
+  return Status::OK();
+}
+
+}  // namespace contrib
+}  // namespace onnxruntime
@@ -42,6 +42,121 @@ Status PackVIntoRotaryQKV(concurrency::ThreadPool* tp,
   return Status::OK();
 }
 
+// Applies rotary position embedding to the new K tokens while writing them directly into their
+// slot of the contiguous present KV cache, fusing the rotation with the cache append that
+// ConcatStateChunkGQA would otherwise perform from a temporary buffer.
+// The input is laid out BxN_kvxSxH within each batch; input_batch_stride covers the packed QKV
+// case where the K heads are embedded in a larger per-batch block.
+template <typename T>
+Status RunRotaryEmbeddingIntoPresent(concurrency::ThreadPool* tp,
+                                     int batch_size,
+                                     int sequence_length,
+                                     int kv_num_heads,
+                                     int head_size,
+                                     int rotary_embedding_dim,
+                                     int input_batch_stride,
+                                     bool interleaved,
+                                     bool is_first_prompt,
+                                     const int32_t* seqlens_k,
+                                     const T* input,
+                                     const T* cos_cache,
+                                     const T* sin_cache,
+                                     T* present,
+                                     int present_buffer_sequence_length) {
+  const int half_rotary_emb_dim = rotary_embedding_dim / 2;
+  const int seq_stride = head_size;
+  const int head_stride = sequence_length * seq_stride;
+
+  const int loop_len = batch_size * sequence_length * kv_num_heads;
+  const double cost = static_cast<double>(rotary_embedding_dim);
+  ThreadPool::TryParallelFor(tp, loop_len, cost, [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+    for (std::ptrdiff_t ptr = begin; ptr != end; ++ptr) {
+      const int b = static_cast<int>((ptr / kv_num_heads) / sequence_length);
+      const int s = static_cast<int>((ptr / kv_num_heads) % sequence_length);
+      const int n = static_cast<int>(ptr % kv_num_heads);
+
+      const int total_seqlen = seqlens_k[b] + 1;
+      const int past_seqlen = is_first_prompt ? 0 : total_seqlen - sequence_length;  // Assume no padding sequence length
+
+      const T* input_data = input + b * input_batch_stride + n * head_stride + s * seq_stride;
+      T* present_data = present +
+                        (static_cast<std::ptrdiff_t>(b * kv_num_heads + n) * present_buffer_sequence_length +
+                         past_seqlen + s) *
+                            head_size;
+
+      // Cache is (M, H/2) or (M, rotary_embedding_dim/2)
+      const int cache_offset = (past_seqlen + s) * half_rotary_emb_dim;
+      const T* cos_data = cos_cache + cache_offset;
+      const T* sin_data = sin_cache + cache_offset;
+
+      int cache_idx = 0;
+      bool sign = false;
+      int j = 0;
+      for (int i = 0; i < rotary_embedding_dim; i++) {
+        if (interleaved) {
+          cache_idx = (i / 2) % half_rotary_emb_dim;
+          sign = i & 1;
+          j = sign ? i - 1 : i + 1;  // i - sign
+        } else {
+          cache_idx = i % half_rotary_emb_dim;
+          sign = (i >= half_rotary_emb_dim);
+          j = (i + half_rotary_emb_dim) % rotary_embedding_dim;
+        }
+        float present_data_i = static_cast<float>(input_data[i]) * static_cast<float>(cos_data[cache_idx]);
+        float input_data_j = static_cast<float>(input_data[j]);
+        float sin_data_cache_idx = static_cast<float>(sin_data[cache_idx]);
+        if (sign) {
+          present_data_i += input_data_j * sin_data_cache_idx;
+        } else {
+          present_data_i -= input_data_j * sin_data_cache_idx;
+        }
+        present_data[i] = static_cast<T>(present_data_i);
+      }
+      for (int i = rotary_embedding_dim; i < head_size; i++) {
+        present_data[i] = input_data[i];
+      }
+    }
+  });
+  return Status::OK();
+}
+
+// Copies the new V tokens directly into their slot of the contiguous present KV cache so that the
+// attention computation does not need to append them from a temporary buffer.
+template <typename T>
+Status PackVIntoPresent(concurrency::ThreadPool* tp,
+                        int batch_size,
+                        int sequence_length,
+                        int kv_num_heads,
+                        int head_size,
+                        int input_batch_stride,
+                        bool is_first_prompt,
+                        const int32_t* seqlens_k,
+                        const T* input,
+                        T* present,
+                        int present_buffer_sequence_length) {
+  const int head_stride = sequence_length * head_size;  // S x H
+
+  const int loop_len = batch_size * kv_num_heads;
+  const double cost = static_cast<double>(head_stride);
+  ThreadPool::TryParallelFor(tp, loop_len, cost, [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+    for (std::ptrdiff_t ptr = begin; ptr != end; ++ptr) {
+      const int b = static_cast<int>(ptr / kv_num_heads);
+      const int n = static_cast<int>(ptr % kv_num_heads);
+
+      const int total_seqlen = seqlens_k[b] + 1;
+      const int past_seqlen = is_first_prompt ? 0 : total_seqlen - sequence_length;  // Assume no padding sequence length
+
+      const T* input_data = input + b * input_batch_stride + n * head_stride;
+      T* present_data = present +
+                        (static_cast<std::ptrdiff_t>(b * kv_num_heads + n) * present_buffer_sequence_length +
+                         past_seqlen) *
+                            head_size;
+      memcpy(present_data, input_data, static_cast<size_t>(head_stride) * sizeof(T));
+    }
+  });
+  return Status::OK();
+}
+
 }  // namespace rotary_helper
 }  // namespace contrib
 }  // namespace onnxruntime
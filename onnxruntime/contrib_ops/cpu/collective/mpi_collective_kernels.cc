@@ -0,0 +1,198 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "contrib_ops/cpu/collective/mpi_collective_kernels.h"
+
+#if defined(USE_MPI)
+
+#include <numeric>
+#include <vector>
+
+#include "core/common/narrow.h"
+#include "core/providers/cpu/tensor/transpose.h"
+
+namespace onnxruntime {
+namespace contrib {
+
+#define MPI_RETURN_IF_ERROR(expr)                                  \
+  do {                                                             \
+    int mpi_status = (expr);                                       \
+    ORT_RETURN_IF(mpi_status != MPI_SUCCESS,                       \
+                  "MPI error ", mpi_status, " returned by " #expr); \
+  } while (0)
+
+namespace {
+
+// reductions need a real MPI datatype so MPI_SUM applies; the data movement collectives
+// below transfer MPI_BYTE and take any tensor type
+Status GetMpiReduceType(MLDataType type, MPI_Datatype& mpi_type) {
+  if (type == DataTypeImpl::GetType<float>()) {
+    mpi_type = MPI_FLOAT;
+  } else if (type == DataTypeImpl::GetType<double>()) {
+    mpi_type = MPI_DOUBLE;
+  } else {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "AllReduce on CPU supports float and double tensors. ",
+                           "float16 reductions require the NCCL backed CUDA kernels.");
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+MpiContext& MpiContext::Instance() {
+  static MpiContext context;
+  return context;
+}
+
+MpiContext::MpiContext() {
+  int is_mpi_initialized = 0;
+  MPI_Initialized(&is_mpi_initialized);
+  if (!is_mpi_initialized) {
+    int mpi_threads_provided = 0;
+    MPI_Init_thread(nullptr, nullptr, MPI_THREAD_MULTIPLE, &mpi_threads_provided);
+  }
+
+  MPI_Comm_size(MPI_COMM_WORLD, &world_size_);
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank_);
+  ORT_ENFORCE(world_size_ >= 1 && rank_ >= 0, "MPI did not provide a valid rank/world size.");
+}
+
+MpiContext::~MpiContext() {
+  int is_mpi_finalized = 0;
+  MPI_Finalized(&is_mpi_finalized);
+  if (!is_mpi_finalized) {
+    MPI_Finalize();
+  }
+}
+
+AllReduce::AllReduce(const OpKernelInfo& info) : MpiKernel(info) {
+}
+
+Status AllReduce::Compute(OpKernelContext* context) const {
+  for (int i = 0; i < context->InputCount(); ++i) {
+    const auto* input_tensor = context->Input<Tensor>(i);
+    const auto& in_shape = input_tensor->Shape();
+
+    MPI_Datatype dtype;
+    ORT_RETURN_IF_ERROR(GetMpiReduceType(input_tensor->DataType(), dtype));
+
+    void* output_data = context->Output(i, in_shape)->MutableDataRaw();
+    MPI_RETURN_IF_ERROR(MPI_Allreduce(input_tensor->DataRaw(), output_data,
+                                      narrow<int>(in_shape.Size()), dtype, MPI_SUM, mpi_->Comm()));
+  }
+
+  return Status::OK();
+}
+
+AllGather::AllGather(const OpKernelInfo& info) : MpiKernel(info) {
+  info.GetAttrOrDefault("group_size", &group_size_, static_cast<int64_t>(1));
+  info.GetAttrOrDefault("axis", &axis_, static_cast<int64_t>(0));
+}
+
+Status AllGather::Compute(OpKernelContext* context) const {
+  for (int i = 0; i < context->InputCount(); ++i) {
+    const auto* input_tensor = context->Input<Tensor>(i);
+    const auto& in_shape = input_tensor->Shape();
+    const int send_bytes = narrow<int>(input_tensor->SizeInBytes());
+
+    if (axis_ > 0) {
+      // gathering along a non-leading axis: move the axis to the front, gather contiguously and
+      // transpose back. the CUDA kernel's TODO applies here too: fuse the transpose with the gather.
+      AllocatorPtr alloc;
+      ORT_RETURN_IF_ERROR(context->GetTempSpaceAllocator(&alloc));
+
+      std::vector<size_t> permutation(in_shape.NumDimensions());
+      std::iota(permutation.begin(), permutation.end(), size_t{0});
+      permutation[narrow<size_t>(axis_)] = 0;
+      permutation[0] = narrow<size_t>(axis_);
+
+      std::vector<int64_t> transposed_input_dims;
+      transposed_input_dims.reserve(in_shape.NumDimensions());
+      for (auto e : permutation) {
+        transposed_input_dims.push_back(in_shape[e]);
+      }
+
+      auto temp_input = Tensor::Create(input_tensor->DataType(), TensorShape(transposed_input_dims), alloc);
+      ORT_RETURN_IF_ERROR(TransposeBase::DoTranspose(permutation, *input_tensor, *temp_input));
+
+      TensorShape all_gather_out_shape(transposed_input_dims);
+      all_gather_out_shape[0] = group_size_ * all_gather_out_shape[0];
+      auto all_gather_output = Tensor::Create(temp_input->DataType(), all_gather_out_shape, alloc);
+
+      MPI_RETURN_IF_ERROR(MPI_Allgather(temp_input->DataRaw(), send_bytes, MPI_BYTE,
+                                        all_gather_output->MutableDataRaw(), send_bytes, MPI_BYTE,
+                                        mpi_->Comm()));
+
+      TensorShape out_shape(in_shape);
+      out_shape[narrow<size_t>(axis_)] = group_size_ * out_shape[narrow<size_t>(axis_)];
+      auto* output_tensor = context->Output(i, out_shape);
+      ORT_RETURN_IF_ERROR(TransposeBase::DoTranspose(permutation, *all_gather_output, *output_tensor));
+    } else {
+      TensorShape out_shape(in_shape);
+      out_shape[0] = group_size_ * out_shape[0];
+      void* output_data = context->Output(i, out_shape)->MutableDataRaw();
+
+      MPI_RETURN_IF_ERROR(MPI_Allgather(input_tensor->DataRaw(), send_bytes, MPI_BYTE,
+                                        output_data, send_bytes, MPI_BYTE, mpi_->Comm()));
+    }
+  }
+
+  return Status::OK();
+}
+
+AllToAll::AllToAll(const OpKernelInfo& info) : MpiKernel(info) {
+  info.GetAttrOrDefault("group_size", &group_size_, static_cast<int64_t>(1));
+}
+
+Status AllToAll::Compute(OpKernelContext* context) const {
+  for (int i = 0; i < context->InputCount(); ++i) {
+    const auto* input_tensor = context->Input<Tensor>(i);
+    const auto& in_shape = input_tensor->Shape();
+
+    ORT_RETURN_IF(in_shape.Size() % group_size_ != 0,
+                  "AllToAll requires the element count (", in_shape.Size(),
+                  ") to be divisible by group_size (", group_size_, ").");
+
+    const int rank_stride_bytes = narrow<int>(input_tensor->SizeInBytes() / narrow<size_t>(group_size_));
+    void* output_data = context->Output(i, in_shape)->MutableDataRaw();
+
+    MPI_RETURN_IF_ERROR(MPI_Alltoall(input_tensor->DataRaw(), rank_stride_bytes, MPI_BYTE,
+                                     output_data, rank_stride_bytes, MPI_BYTE, mpi_->Comm()));
+  }
+
+  return Status::OK();
+}
+
+ONNX_OPERATOR_KERNEL_EX(
+    AllReduce,
+    kMSDomain,
+    1,
+    kCpuExecutionProvider,
+    KernelDefBuilder()
+        .TypeConstraint("T", {DataTypeImpl::GetTensorType<float>(),
+                              DataTypeImpl::GetTensorType<double>()}),
+    AllReduce);
+
+ONNX_OPERATOR_KERNEL_EX(
+    AllGather,
+    kMSDomain,
+    1,
+    kCpuExecutionProvider,
+    KernelDefBuilder()
+        .TypeConstraint("T", DataTypeImpl::AllTensorTypes()),
+    AllGather);
+
+ONNX_OPERATOR_KERNEL_EX(
+    AllToAll,
+    kMSDomain,
+    1,
+    kCpuExecutionProvider,
+    KernelDefBuilder()
+        .TypeConstraint("T", DataTypeImpl::AllTensorTypes()),
+    AllToAll);
+
+}  // namespace contrib
+}  // namespace onnxruntime
+
+#endif  // USE_MPI
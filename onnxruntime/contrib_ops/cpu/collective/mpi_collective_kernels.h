@@ -0,0 +1,76 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#if defined(USE_MPI)
+
+#define OMPI_SKIP_MPICXX 1  // See https://github.com/open-mpi/ompi/issues/5157
+#include <mpi.h>
+#undef OMPI_SKIP_MPICXX
+
+#include "core/framework/op_kernel.h"
+
+namespace onnxruntime {
+namespace contrib {
+
+// Process wide MPI state for the CPU collective kernels: initializes MPI on first use and
+// exposes the rank and size of MPI_COMM_WORLD. Counterpart of the NcclContext the CUDA
+// collective kernels use, for builds where the collectives run over MPI directly.
+class MpiContext final {
+ public:
+  static MpiContext& Instance();
+
+  int Rank() const { return rank_; }
+  int Size() const { return world_size_; }
+  MPI_Comm Comm() const { return MPI_COMM_WORLD; }
+
+ private:
+  MpiContext();
+  ~MpiContext();
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(MpiContext);
+
+  int rank_ = -1;
+  int world_size_ = -1;
+};
+
+class MpiKernel : public OpKernel {
+ public:
+  explicit MpiKernel(const OpKernelInfo& info) : OpKernel(info), mpi_(&MpiContext::Instance()) {}
+
+ protected:
+  MpiContext* mpi_;
+};
+
+class AllReduce final : public MpiKernel {
+ public:
+  explicit AllReduce(const OpKernelInfo& info);
+
+  Status Compute(OpKernelContext* context) const override;
+};
+
+class AllGather final : public MpiKernel {
+ public:
+  explicit AllGather(const OpKernelInfo& info);
+
+  Status Compute(OpKernelContext* context) const override;
+
+ private:
+  int64_t group_size_ = -1;
+  int64_t axis_ = -1;
+};
+
+class AllToAll final : public MpiKernel {
+ public:
+  explicit AllToAll(const OpKernelInfo& info);
+
+  Status Compute(OpKernelContext* context) const override;
+
+ private:
+  int64_t group_size_ = -1;
+};
+
+}  // namespace contrib
+}  // namespace onnxruntime
+
+#endif  // USE_MPI
@@ -0,0 +1,149 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "contrib_ops/cpu/diffusion/group_norm.h"
+
+#include <cmath>
+
+#include "core/platform/threadpool.h"
+
+namespace onnxruntime {
+namespace contrib {
+
+ONNX_OPERATOR_KERNEL_EX(
+    GroupNorm,
+    kMSDomain,
+    1,
+    kCpuExecutionProvider,
+    KernelDefBuilder()
+        .TypeConstraint("T", DataTypeImpl::GetTensorType<float>())
+        .TypeConstraint("M", DataTypeImpl::GetTensorType<float>()),
+    GroupNorm);
+
+GroupNorm::GroupNorm(const OpKernelInfo& info) : OpKernel(info) {
+  epsilon_ = info.GetAttrOrDefault<float>("epsilon", 1e-5f);
+  ORT_ENFORCE(epsilon_ >= 0.f);
+
+  ORT_ENFORCE(info.GetAttr("groups", &num_groups_).IsOK());
+  ORT_ENFORCE(num_groups_ > 0);
+
+  int64_t activation = 0;
+  ORT_ENFORCE(info.GetAttr("activation", &activation).IsOK());
+  ORT_ENFORCE(activation == 0 || activation == 1, "activation should be 0 or 1");
+  use_silu_ = activation == 1;
+
+  channels_last_ = info.GetAttrOrDefault<int64_t>("channels_last", 1) != 0;
+}
+
+namespace {
+
+inline float Silu(float v) {
+  return v / (1.f + std::exp(-v));
+}
+
+}  // namespace
+
+Status GroupNorm::Compute(OpKernelContext* context) const {
+  const Tensor* input = context->Input<Tensor>(0);
+  const Tensor* gamma = context->Input<Tensor>(1);
+  const Tensor* beta = context->Input<Tensor>(2);
+
+  const auto& input_dims = input->Shape().GetDims();
+  if (input_dims.size() != 4) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "input is expected to have 4 dimensions, got ", input_dims.size());
+  }
+
+  const int64_t batch_size = input_dims[0];
+  const int64_t num_channels = channels_last_ ? input_dims[3] : input_dims[1];
+  const int64_t spatial_size = channels_last_ ? input_dims[1] * input_dims[2] : input_dims[2] * input_dims[3];
+
+  if (num_channels % num_groups_ != 0) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "number of channels ", num_channels, " should be divisible by num_groups ", num_groups_);
+  }
+
+  if (gamma->Shape().Size() != num_channels || beta->Shape().Size() != num_channels) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "gamma and beta are expected to have ", num_channels, " elements");
+  }
+
+  Tensor* output = context->Output(0, input->Shape());
+
+  const float* input_data = input->Data<float>();
+  const float* gamma_data = gamma->Data<float>();
+  const float* beta_data = beta->Data<float>();
+  float* output_data = output->MutableData<float>();
+
+  const int64_t channels_per_group = num_channels / num_groups_;
+  const int64_t group_size = channels_per_group * spatial_size;
+
+  concurrency::ThreadPool* tp = context->GetOperatorThreadPool();
+
+  concurrency::ThreadPool::TryBatchParallelFor(
+      tp, static_cast<ptrdiff_t>(batch_size * num_groups_),
+      [&](ptrdiff_t task_idx) {
+        const int64_t n = task_idx / num_groups_;
+        const int64_t g = task_idx % num_groups_;
+
+        float sum = 0.f;
+        float sum_sq = 0.f;
+
+        if (channels_last_) {
+          // group channels form a contiguous chunk of each (h, w) row
+          const float* src = input_data + n * spatial_size * num_channels + g * channels_per_group;
+          for (int64_t s = 0; s < spatial_size; ++s) {
+            const float* row = src + s * num_channels;
+            for (int64_t c = 0; c < channels_per_group; ++c) {
+              const float v = row[c];
+              sum += v;
+              sum_sq += v * v;
+            }
+          }
+        } else {
+          // the whole group is contiguous
+          const float* src = input_data + n * num_channels * spatial_size + g * group_size;
+          for (int64_t i = 0; i < group_size; ++i) {
+            const float v = src[i];
+            sum += v;
+            sum_sq += v * v;
+          }
+        }
+
+        const float mean = sum / static_cast<float>(group_size);
+        const float variance = sum_sq / static_cast<float>(group_size) - mean * mean;
+        const float inv_std_dev = 1.f / std::sqrt(variance + epsilon_);
+
+        if (channels_last_) {
+          const int64_t base = n * spatial_size * num_channels + g * channels_per_group;
+          const float* group_gamma = gamma_data + g * channels_per_group;
+          const float* group_beta = beta_data + g * channels_per_group;
+          for (int64_t s = 0; s < spatial_size; ++s) {
+            const float* src = input_data + base + s * num_channels;
+            float* dst = output_data + base + s * num_channels;
+            for (int64_t c = 0; c < channels_per_group; ++c) {
+              float v = (src[c] - mean) * inv_std_dev * group_gamma[c] + group_beta[c];
+              dst[c] = use_silu_ ? Silu(v) : v;
+            }
+          }
+        } else {
+          for (int64_t c = 0; c < channels_per_group; ++c) {
+            const int64_t channel = g * channels_per_group + c;
+            const float scale = gamma_data[channel] * inv_std_dev;
+            const float shift = beta_data[channel] - mean * scale;
+            const float* src = input_data + (n * num_channels + channel) * spatial_size;
+            float* dst = output_data + (n * num_channels + channel) * spatial_size;
+            for (int64_t s = 0; s < spatial_size; ++s) {
+              float v = src[s] * scale + shift;
+              dst[s] = use_silu_ ? Silu(v) : v;
+            }
+          }
+        }
+      },
+      0);
+
+  return Status::OK();
+}
+
+}  // namespace contrib
+}  // namespace onnxruntime
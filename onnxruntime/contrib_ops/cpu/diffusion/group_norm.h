@@ -0,0 +1,29 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/common/common.h"
+#include "core/framework/op_kernel.h"
+
+namespace onnxruntime {
+namespace contrib {
+
+// CPU implementation of the com.microsoft GroupNorm op used by diffusion UNet models.
+// Normalization, the per-channel affine transform and the optional SiLU activation are applied
+// in a single pass over each (batch, group) slice, replacing the decomposed
+// Reshape/InstanceNormalization/Reshape/Mul/Add(/Sigmoid/Mul) subgraph.
+class GroupNorm final : public OpKernel {
+ public:
+  explicit GroupNorm(const OpKernelInfo& info);
+  Status Compute(OpKernelContext* context) const override;
+
+ private:
+  float epsilon_;
+  int64_t num_groups_;
+  bool use_silu_;
+  bool channels_last_;
+};
+
+}  // namespace contrib
+}  // namespace onnxruntime
@@ -0,0 +1,132 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/common/narrow.h"
+#include "core/framework/op_kernel.h"
+#include "core/platform/threadpool.h"
+#include "core/util/math_cpuonly.h"
+#include "core/util/prefetch.h"
+
+namespace onnxruntime {
+namespace contrib {
+
+// Pools rows of a 2-D embedding table selected by an index tensor - the fused form of
+// Gather(axis=0) + ReduceSum/ReduceMean over the last index dimension produced by the
+// EmbeddingBagFusion graph transformer. Each bag's rows are accumulated straight into
+// the pooled output row, so the gathered matrix is never written out.
+class EmbeddingBag final : public OpKernel {
+ public:
+  explicit EmbeddingBag(const OpKernelInfo& info) : OpKernel(info) {
+    std::string mode = info.GetAttrOrDefault<std::string>("mode", "sum");
+    ORT_ENFORCE(mode == "sum" || mode == "mean", "Unsupported EmbeddingBag mode: ", mode);
+    mean_ = (mode == "mean");
+  }
+
+  Status Compute(OpKernelContext* context) const override;
+
+ private:
+  template <typename Tin>
+  Status ComputeImpl(OpKernelContext* context, const Tensor& weight, const Tensor& indices) const;
+
+  bool mean_;
+};
+
+template <typename Tin>
+Status EmbeddingBag::ComputeImpl(OpKernelContext* context, const Tensor& weight,
+                                 const Tensor& indices) const {
+  const TensorShape& weight_shape = weight.Shape();
+  const TensorShape& indices_shape = indices.Shape();
+  const int64_t num_rows = weight_shape[0];
+  const int64_t embedding_dim = weight_shape[1];
+  const size_t indices_rank = indices_shape.NumDimensions();
+  const int64_t bag_size = indices_shape[indices_rank - 1];
+
+  TensorShapeVector output_dims(indices_shape.GetDims().begin(), indices_shape.GetDims().end() - 1);
+  output_dims.push_back(embedding_dim);
+  Tensor* output = context->Output(0, TensorShape(output_dims));
+
+  if (output->Shape().Size() == 0) {
+    return Status::OK();
+  }
+  if (bag_size == 0) {
+    // Empty bags pool to zero (matches ReduceSum over an empty axis).
+    EigenVectorArrayMap<float>(output->MutableData<float>(), narrow<size_t>(output->Shape().Size())).setZero();
+    return Status::OK();
+  }
+  const int64_t num_bags = indices_shape.Size() / bag_size;
+
+  const Tin* indices_data = indices.Data<Tin>();
+
+  // Check the indices first in case there's an out of bound index.
+  for (int64_t i = 0, n = indices_shape.Size(); i < n; ++i) {
+    Tin idx = indices_data[i];
+    if (idx < -num_rows || idx >= num_rows) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                             "indices element out of data bounds, idx=", idx,
+                             " must be within the inclusive range [", -num_rows, ",", num_rows - 1, "]");
+    }
+  }
+
+  const float* weight_data = weight.Data<float>();
+  float* output_data = output->MutableData<float>();
+
+  // The table rows are data dependent random reads; prefetch a few rows ahead of
+  // the accumulation so they are in flight while the current row is summed.
+  constexpr int64_t kPrefetchAhead = 4;
+
+  const TensorOpCost cost{static_cast<double>(bag_size * embedding_dim * sizeof(float)),
+                          static_cast<double>(embedding_dim * sizeof(float)),
+                          static_cast<double>(bag_size * embedding_dim)};
+  concurrency::ThreadPool::TryParallelFor(
+      context->GetOperatorThreadPool(), narrow<std::ptrdiff_t>(num_bags), cost,
+      [this, indices_data, weight_data, output_data, num_rows, embedding_dim,
+       bag_size](std::ptrdiff_t first, std::ptrdiff_t last) {
+        for (std::ptrdiff_t bag = first; bag < last; ++bag) {
+          const Tin* bag_indices = indices_data + bag * bag_size;
+          float* out_row = output_data + bag * embedding_dim;
+          EigenVectorArrayMap<float> accumulator(out_row, narrow<size_t>(embedding_dim));
+          accumulator.setZero();
+          for (int64_t i = 0; i < bag_size; ++i) {
+            if (i + kPrefetchAhead < bag_size) {
+              Tin next = bag_indices[i + kPrefetchAhead];
+              next = next < 0 ? next + static_cast<Tin>(num_rows) : next;
+              PrefetchForRead(weight_data + next * embedding_dim);
+            }
+            Tin idx = bag_indices[i];
+            idx = idx < 0 ? idx + static_cast<Tin>(num_rows) : idx;
+            accumulator += ConstEigenVectorArrayMap<float>(weight_data + idx * embedding_dim,
+                                                           narrow<size_t>(embedding_dim));
+          }
+          if (mean_) {
+            accumulator *= 1.0f / static_cast<float>(bag_size);
+          }
+        }
+      });
+
+  return Status::OK();
+}
+
+Status EmbeddingBag::Compute(OpKernelContext* context) const {
+  const Tensor& weight = *context->Input<Tensor>(0);
+  const Tensor& indices = *context->Input<Tensor>(1);
+
+  ORT_RETURN_IF_NOT(weight.Shape().NumDimensions() == 2, "weight must be a 2-D tensor");
+  ORT_RETURN_IF_NOT(indices.Shape().NumDimensions() >= 1, "indices must have rank >= 1");
+
+  if (indices.IsDataType<int32_t>()) {
+    return ComputeImpl<int32_t>(context, weight, indices);
+  }
+  return ComputeImpl<int64_t>(context, weight, indices);
+}
+
+ONNX_CPU_OPERATOR_MS_KERNEL(
+    EmbeddingBag,
+    1,
+    KernelDefBuilder()
+        .TypeConstraint("T", DataTypeImpl::GetTensorType<float>())
+        .TypeConstraint("Tind", {DataTypeImpl::GetTensorType<int32_t>(),
+                                 DataTypeImpl::GetTensorType<int64_t>()}),
+    EmbeddingBag);
+
+}  // namespace contrib
+}  // namespace onnxruntime
@@ -49,4 +49,69 @@ common::Status GetFusedActivationAttr(const OpKernelInfo& info, MLAS_ACTIVATION&
   return Status::OK();
 }
 
+common::Status GetFusedPostOpsAttr(const OpKernelInfo& info, InlinedVector<MLAS_ACTIVATION>& chain) {
+  std::vector<std::string> post_ops;
+  if (!info.GetAttrs<std::string>("post_ops", post_ops).IsOK() || post_ops.empty()) {
+    return Status::OK();
+  }
+
+  std::vector<float> post_op_params;
+  // optional; only stages with parameters consume entries
+  ORT_IGNORE_RETURN_VALUE(info.GetAttrs<float>("post_op_params", post_op_params));
+
+  size_t param_idx = 0;
+  auto take_param = [&](float& value) -> bool {
+    if (param_idx >= post_op_params.size()) {
+      return false;
+    }
+    value = post_op_params[param_idx++];
+    return true;
+  };
+
+  chain.reserve(post_ops.size());
+  for (const auto& post_op : post_ops) {
+    MLAS_ACTIVATION stage;
+    stage.ActivationKind = MlasIdentityActivation;
+    bool params_ok = true;
+    if (post_op == "Relu") {
+      stage.ActivationKind = MlasReluActivation;
+    } else if (post_op == "Tanh") {
+      stage.ActivationKind = MlasTanhActivation;
+    } else if (post_op == "Sigmoid") {
+      stage.ActivationKind = MlasLogisticActivation;
+    } else if (post_op == "LeakyRelu") {
+      stage.ActivationKind = MlasLeakyReluActivation;
+      params_ok = take_param(stage.Parameters.LeakyRelu.alpha);
+    } else if (post_op == "Clip") {
+      stage.ActivationKind = MlasClipActivation;
+      params_ok = take_param(stage.Parameters.Clip.minimum) && take_param(stage.Parameters.Clip.maximum);
+    } else if (post_op == "HardSigmoid") {
+      stage.ActivationKind = MlasHardSigmoidActivation;
+      params_ok = take_param(stage.Parameters.HardSigmoid.alpha) && take_param(stage.Parameters.HardSigmoid.beta);
+    } else if (post_op == "Mul") {
+      // multiplication by a scalar constant folded out of the graph
+      stage.ActivationKind = MlasAffineActivation;
+      params_ok = take_param(stage.Parameters.Affine.alpha);
+      stage.Parameters.Affine.beta = 0.0f;
+    } else if (post_op == "Add") {
+      // addition of a scalar constant folded out of the graph
+      stage.ActivationKind = MlasAffineActivation;
+      stage.Parameters.Affine.alpha = 1.0f;
+      params_ok = take_param(stage.Parameters.Affine.beta);
+    } else {
+      return Status(common::ONNXRUNTIME, common::INVALID_ARGUMENT, "unimplemented post op: " + post_op);
+    }
+    if (!params_ok) {
+      return Status(common::ONNXRUNTIME, common::INVALID_ARGUMENT, "post_op_params count mismatch");
+    }
+    chain.push_back(stage);
+  }
+
+  if (param_idx != post_op_params.size()) {
+    return Status(common::ONNXRUNTIME, common::INVALID_ARGUMENT, "post_op_params count mismatch");
+  }
+
+  return Status::OK();
+}
+
 }  // namespace onnxruntime
@@ -3,6 +3,7 @@
 
 #pragma once
 #include "core/common/common.h"
+#include "core/common/inlined_containers.h"
 #include "core/framework/op_kernel.h"
 #include "core/util/math.h"
 #include "core/mlas/inc/mlas.h"
@@ -11,4 +12,8 @@ namespace onnxruntime {
 
 common::Status GetFusedActivationAttr(const OpKernelInfo& info, MLAS_ACTIVATION& activation);
 
+// Parse the 'post_ops'/'post_op_params' attributes into an ordered chain of MLAS post operation
+// stages. Leaves 'chain' empty when the node carries no 'post_ops' attribute.
+common::Status GetFusedPostOpsAttr(const OpKernelInfo& info, InlinedVector<MLAS_ACTIVATION>& chain);
+
 }  // namespace onnxruntime
@@ -0,0 +1,171 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "core/framework/op_kernel.h"
+#include "core/mlas/inc/mlas.h"
+#include "core/platform/threadpool.h"
+
+namespace onnxruntime {
+namespace contrib {
+
+// Executes the per-element program produced by the ElementwiseFusion graph transformer in a
+// single streaming pass over the input: the intermediate values of the fused chain never leave
+// the cache-resident block being processed, so a chain of N elementwise nodes costs one memory
+// pass rather than N.
+class FusedElementwise final : public OpKernel {
+ public:
+  explicit FusedElementwise(const OpKernelInfo& info) : OpKernel(info) {
+    std::vector<std::string> step_ops;
+    std::vector<float> scalars;
+    std::vector<int64_t> scalar_first;
+    ORT_THROW_IF_ERROR(info.GetAttrs("steps", step_ops));
+    ORT_THROW_IF_ERROR(info.GetAttrs("scalars", scalars));
+    ORT_THROW_IF_ERROR(info.GetAttrs("scalar_first", scalar_first));
+    ORT_ENFORCE(!step_ops.empty() && step_ops.size() == scalars.size() && step_ops.size() == scalar_first.size(),
+                "steps, scalars and scalar_first must be non-empty and of equal length");
+
+    program_.reserve(step_ops.size());
+    for (size_t i = 0; i < step_ops.size(); ++i) {
+      program_.push_back(Step{OpFromString(step_ops[i]), scalars[i], scalar_first[i] != 0});
+    }
+  }
+
+  Status Compute(OpKernelContext* context) const override;
+
+ private:
+  enum class StepOp : uint8_t {
+    kAdd,
+    kSub,
+    kMul,
+    kDiv,
+    kNeg,
+    kAbs,
+    kSqrt,
+    kExp,
+    kSigmoid,
+    kTanh,
+    kRelu,
+  };
+
+  struct Step {
+    StepOp op;
+    float scalar;
+    bool scalar_first;
+  };
+
+  static StepOp OpFromString(const std::string& op_type) {
+    if (op_type == "Add") return StepOp::kAdd;
+    if (op_type == "Sub") return StepOp::kSub;
+    if (op_type == "Mul") return StepOp::kMul;
+    if (op_type == "Div") return StepOp::kDiv;
+    if (op_type == "Neg") return StepOp::kNeg;
+    if (op_type == "Abs") return StepOp::kAbs;
+    if (op_type == "Sqrt") return StepOp::kSqrt;
+    if (op_type == "Exp") return StepOp::kExp;
+    if (op_type == "Sigmoid") return StepOp::kSigmoid;
+    if (op_type == "Tanh") return StepOp::kTanh;
+    if (op_type == "Relu") return StepOp::kRelu;
+    ORT_THROW("Unsupported FusedElementwise step: ", op_type);
+  }
+
+  void RunProgram(const float* input, float* output, std::ptrdiff_t length) const;
+
+  std::vector<Step> program_;
+};
+
+void FusedElementwise::RunProgram(const float* input, float* output, std::ptrdiff_t length) const {
+  // Interpret the program over cache-resident blocks: each step is a tight loop (or MLAS
+  // routine) over the block, so the per-step dispatch is amortized across kBlockSize elements
+  // while the intermediates stay in L1.  The program executes in place in the output buffer.
+  constexpr std::ptrdiff_t kBlockSize = 4096;
+  for (std::ptrdiff_t base = 0; base < length; base += kBlockSize) {
+    const size_t n = static_cast<size_t>(std::min(kBlockSize, length - base));
+    float* block = output + base;
+    memcpy(block, input + base, n * sizeof(float));
+
+    for (const auto& step : program_) {
+      const float scalar = step.scalar;
+      switch (step.op) {
+        case StepOp::kAdd:
+          for (size_t i = 0; i < n; ++i) block[i] += scalar;
+          break;
+        case StepOp::kSub:
+          if (step.scalar_first) {
+            for (size_t i = 0; i < n; ++i) block[i] = scalar - block[i];
+          } else {
+            for (size_t i = 0; i < n; ++i) block[i] -= scalar;
+          }
+          break;
+        case StepOp::kMul:
+          for (size_t i = 0; i < n; ++i) block[i] *= scalar;
+          break;
+        case StepOp::kDiv:
+          if (step.scalar_first) {
+            for (size_t i = 0; i < n; ++i) block[i] = scalar / block[i];
+          } else {
+            for (size_t i = 0; i < n; ++i) block[i] /= scalar;
+          }
+          break;
+        case StepOp::kNeg:
+          for (size_t i = 0; i < n; ++i) block[i] = -block[i];
+          break;
+        case StepOp::kAbs:
+          for (size_t i = 0; i < n; ++i) block[i] = std::fabs(block[i]);
+          break;
+        case StepOp::kSqrt:
+          for (size_t i = 0; i < n; ++i) block[i] = std::sqrt(block[i]);
+          break;
+        case StepOp::kExp:
+          MlasComputeExp(block, block, n);
+          break;
+        case StepOp::kSigmoid:
+          MlasComputeLogistic(block, block, n);
+          break;
+        case StepOp::kTanh:
+          MlasComputeTanh(block, block, n);
+          break;
+        case StepOp::kRelu:
+          for (size_t i = 0; i < n; ++i) block[i] = std::max(0.f, block[i]);
+          break;
+      }
+    }
+  }
+}
+
+Status FusedElementwise::Compute(OpKernelContext* context) const {
+  const auto* X = context->Input<Tensor>(0);
+  auto* Y = context->Output(0, X->Shape());
+  const auto length = static_cast<std::ptrdiff_t>(X->Shape().Size());
+  if (length == 0) {
+    return Status::OK();
+  }
+
+  const float* input = X->Data<float>();
+  float* output = Y->MutableData<float>();
+
+  // One load and one store per element regardless of chain length; charge a few compute
+  // cycles per element per step.
+  const TensorOpCost cost{static_cast<double>(sizeof(float)), static_cast<double>(sizeof(float)),
+                          5.0 * static_cast<double>(program_.size())};
+  concurrency::ThreadPool::TryParallelFor(
+      context->GetOperatorThreadPool(), length, cost,
+      [this, input, output](std::ptrdiff_t first, std::ptrdiff_t last) {
+        RunProgram(input + first, output + first, last - first);
+      });
+
+  return Status::OK();
+}
+
+ONNX_CPU_OPERATOR_TYPED_MS_KERNEL(
+    FusedElementwise,
+    1,
+    float,
+    KernelDefBuilder().TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+    FusedElementwise);
+
+}  // namespace contrib
+}  // namespace onnxruntime
@@ -0,0 +1,92 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <cmath>
+
+#include "core/common/common.h"
+#include "core/common/narrow.h"
+#include "core/framework/op_kernel.h"
+#include "core/platform/threadpool.h"
+
+namespace onnxruntime {
+namespace contrib {
+
+// Fusion of an ai.onnx.ml Imputer followed by a Scaler, produced by ImputerScalerFusion.
+// Both source ops make one full pass over the batch; the fused kernel imputes and rescales
+// each element while it is still in cache, so the batch is only streamed once.
+class FusedImputerScaler final : public OpKernel {
+ public:
+  FusedImputerScaler(const OpKernelInfo& info) : OpKernel(info),
+                                                 imputed_values_(info.GetAttrsOrDefault<float>("imputed_value_floats")),
+                                                 scale_(info.GetAttrsOrDefault<float>("scale")),
+                                                 offset_(info.GetAttrsOrDefault<float>("offset")) {
+    ORT_ENFORCE(!imputed_values_.empty(), "Empty imputed_value_floats in attributes");
+    ORT_ENFORCE(!scale_.empty(), "Empty scale in attributes");
+    ORT_ENFORCE(scale_.size() == offset_.size(),
+                "Scale size: (" + std::to_string(scale_.size()) + ") != (" + std::to_string(offset_.size()) + ")");
+    replaced_value_ = info.GetAttrOrDefault<float>("replaced_value_float", 0.f);
+  }
+
+  Status Compute(OpKernelContext* context) const override;
+
+ private:
+  std::vector<float> imputed_values_;
+  std::vector<float> scale_;
+  std::vector<float> offset_;
+  float replaced_value_{0.f};
+};
+
+ONNX_CPU_OPERATOR_TYPED_MS_KERNEL(
+    FusedImputerScaler,
+    1,
+    float,
+    KernelDefBuilder().TypeConstraint("T", DataTypeImpl::GetTensorType<float>()).MayInplace(0, 0),
+    FusedImputerScaler);
+
+static constexpr int kParallelizationThreshold = 10 * 1000;
+
+Status FusedImputerScaler::Compute(OpKernelContext* context) const {
+  const Tensor& X = *context->Input<Tensor>(0);
+  const TensorShape& x_shape = X.Shape();
+  Tensor* Y = context->Output(0, x_shape);
+  const float* x_data = X.Data<float>();
+  float* y_data = Y->MutableData<float>();
+  auto x_dims = x_shape.GetDims();
+  if (x_dims.empty()) {
+    return Status(ONNXRUNTIME, INVALID_ARGUMENT, "Invalid argument: input has empty dimensions.");
+  }
+
+  size_t x_size = onnxruntime::narrow<size_t>(x_shape.Size());
+  int64_t stride = x_dims.size() == 1 ? x_dims[0] : x_dims[1];
+  const bool per_feature_imputed = imputed_values_.size() == static_cast<size_t>(stride);
+  const bool per_feature_scale = static_cast<int64_t>(scale_.size()) == stride;
+  if (!per_feature_scale && scale_.size() != 1) {
+    std::ostringstream err_msg;
+    err_msg << "Either both scale and offset can be of feature size (" << stride << ") or 1";
+    return Status(ONNXRUNTIME, INVALID_ARGUMENT, err_msg.str());
+  }
+
+  const float replaced_value = replaced_value_;
+  const bool replaced_is_nan = std::isnan(replaced_value);
+  auto fn = [this, y_data, x_data, stride, per_feature_imputed, per_feature_scale,
+             replaced_value, replaced_is_nan](ptrdiff_t i) {
+    float value = x_data[i];
+    if ((std::isnan(value) && replaced_is_nan) || value == replaced_value) {
+      value = imputed_values_[per_feature_imputed ? i % stride : 0];
+    }
+    size_t f = per_feature_scale ? i % stride : 0;
+    y_data[i] = (value - offset_[f]) * scale_[f];
+  };
+
+  if (x_size < kParallelizationThreshold) {  // TODO: tune this, arbitrary threshold
+    for (size_t i = 0; i < x_size; ++i) {
+      fn(i);
+    }
+  } else {
+    concurrency::ThreadPool::TryBatchParallelFor(context->GetOperatorThreadPool(), x_size, fn, 0);
+  }
+  return Status::OK();
+}
+
+}  // namespace contrib
+}  // namespace onnxruntime
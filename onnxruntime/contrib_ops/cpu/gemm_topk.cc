@@ -0,0 +1,166 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <algorithm>
+#include <vector>
+
+#include "core/common/narrow.h"
+#include "core/framework/op_kernel.h"
+#include "core/mlas/inc/mlas.h"
+#include "core/platform/ort_mutex.h"
+#include "core/platform/threadpool.h"
+
+namespace onnxruntime {
+namespace contrib {
+
+namespace {
+
+struct Candidate {
+  float value;
+  int64_t index;
+};
+
+// Strict weak ordering with the better entry first: by value in the requested direction,
+// ties preferring the lower column index like TopK. Used both as the heap comparator
+// (so the worst retained entry sits at the heap top, one comparison away from the next
+// candidate) and for the final per-row sort.
+struct IsBetter {
+  bool largest;
+  bool operator()(const Candidate& lhs, const Candidate& rhs) const {
+    if (lhs.value != rhs.value) {
+      return largest ? lhs.value > rhs.value : lhs.value < rhs.value;
+    }
+    return lhs.index < rhs.index;
+  }
+};
+
+// Offers 'candidate' to a k-bounded heap ordered by 'better'.
+void OfferCandidate(std::vector<Candidate>& heap, const Candidate& candidate, size_t k,
+                    const IsBetter& better) {
+  if (heap.size() < k) {
+    heap.push_back(candidate);
+    std::push_heap(heap.begin(), heap.end(), better);
+  } else if (better(candidate, heap.front())) {
+    std::pop_heap(heap.begin(), heap.end(), better);
+    heap.back() = candidate;
+    std::push_heap(heap.begin(), heap.end(), better);
+  }
+}
+
+}  // namespace
+
+// Fused MatMul + TopK over the last axis, for classification heads whose label dimension
+// dwarfs k. The GEMM is tiled along N and each tile's logits are folded into per-row
+// streaming top-k heaps while they are still cache resident, so the full (M, N) logit
+// tensor is never written to memory and the separate TopK pass over it disappears.
+// Produced by the MatMulTopKFusion graph transformer.
+class GemmTopK final : public OpKernel {
+ public:
+  explicit GemmTopK(const OpKernelInfo& info) : OpKernel(info) {
+    ORT_ENFORCE(info.GetAttr<int64_t>("k", &k_).IsOK() && k_ > 0, "k must be a positive int attribute");
+    largest_ = info.GetAttrOrDefault<int64_t>("largest", 1) != 0;
+  }
+
+  Status Compute(OpKernelContext* context) const override;
+
+ private:
+  int64_t k_;
+  bool largest_;
+};
+
+Status GemmTopK::Compute(OpKernelContext* context) const {
+  const Tensor& A = *context->Input<Tensor>(0);
+  const Tensor& B = *context->Input<Tensor>(1);
+
+  ORT_RETURN_IF_NOT(A.Shape().NumDimensions() == 2, "A must be a 2-D tensor");
+  ORT_RETURN_IF_NOT(B.Shape().NumDimensions() == 2, "B must be a 2-D tensor");
+
+  const int64_t M = A.Shape()[0];
+  const int64_t K = A.Shape()[1];
+  const int64_t N = B.Shape()[1];
+  ORT_RETURN_IF_NOT(B.Shape()[0] == K, "A and B have mismatched inner dimensions: ",
+                    K, " vs ", B.Shape()[0]);
+  ORT_RETURN_IF_NOT(k_ <= N, "k (", k_, ") must not exceed the number of columns of B (", N, ")");
+
+  Tensor* values = context->Output(0, {M, k_});
+  Tensor* indices = context->Output(1, {M, k_});
+  if (M == 0) {
+    return Status::OK();
+  }
+
+  const float* a_data = A.Data<float>();
+  const float* b_data = B.Data<float>();
+  const size_t k = narrow<size_t>(k_);
+  const IsBetter better{largest_};
+
+  // Tile the N dimension so a tile's logits fit in cache; each worker reduces its tiles
+  // into private per-row heaps and merges them into the shared ones once at the end, so
+  // the mutex is taken once per TryParallelFor partition, not per tile.
+  constexpr int64_t kTileN = 512;
+  const int64_t num_tiles = (N + kTileN - 1) / kTileN;
+
+  std::vector<std::vector<Candidate>> row_heaps(narrow<size_t>(M));
+  OrtMutex merge_mutex;
+
+  const TensorOpCost cost{static_cast<double>((K * kTileN + M * K) * sizeof(float)),
+                          static_cast<double>(M * k_ * sizeof(Candidate)),
+                          static_cast<double>(2 * M * kTileN * K)};
+  concurrency::ThreadPool::TryParallelFor(
+      context->GetOperatorThreadPool(), narrow<std::ptrdiff_t>(num_tiles), cost,
+      [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+        std::vector<float> logits(narrow<size_t>(M * kTileN));
+        std::vector<std::vector<Candidate>> local_heaps(narrow<size_t>(M));
+        for (auto& heap : local_heaps) {
+          heap.reserve(k);
+        }
+
+        for (std::ptrdiff_t tile = first; tile < last; ++tile) {
+          const int64_t n0 = tile * kTileN;
+          const int64_t tile_n = std::min(kTileN, N - n0);
+          MlasGemm(CblasNoTrans, CblasNoTrans,
+                   narrow<size_t>(M), narrow<size_t>(tile_n), narrow<size_t>(K),
+                   1.0f, a_data, narrow<size_t>(K), b_data + n0, narrow<size_t>(N),
+                   0.0f, logits.data(), narrow<size_t>(tile_n), nullptr);
+
+          for (int64_t m = 0; m < M; ++m) {
+            const float* row = logits.data() + m * tile_n;
+            auto& heap = local_heaps[narrow<size_t>(m)];
+            for (int64_t j = 0; j < tile_n; ++j) {
+              OfferCandidate(heap, Candidate{row[j], n0 + j}, k, better);
+            }
+          }
+        }
+
+        std::lock_guard<OrtMutex> lock(merge_mutex);
+        for (int64_t m = 0; m < M; ++m) {
+          auto& shared_heap = row_heaps[narrow<size_t>(m)];
+          for (const Candidate& candidate : local_heaps[narrow<size_t>(m)]) {
+            OfferCandidate(shared_heap, candidate, k, better);
+          }
+        }
+      });
+
+  float* values_data = values->MutableData<float>();
+  int64_t* indices_data = indices->MutableData<int64_t>();
+  for (int64_t m = 0; m < M; ++m) {
+    auto& heap = row_heaps[narrow<size_t>(m)];
+    std::sort(heap.begin(), heap.end(), better);
+    for (size_t j = 0; j < k; ++j) {
+      values_data[m * k_ + j] = heap[j].value;
+      indices_data[m * k_ + j] = heap[j].index;
+    }
+  }
+
+  return Status::OK();
+}
+
+ONNX_CPU_OPERATOR_MS_KERNEL(
+    GemmTopK,
+    1,
+    KernelDefBuilder()
+        .TypeConstraint("T", DataTypeImpl::GetTensorType<float>())
+        .TypeConstraint("I", DataTypeImpl::GetTensorType<int64_t>()),
+    GemmTopK);
+
+}  // namespace contrib
+}  // namespace onnxruntime
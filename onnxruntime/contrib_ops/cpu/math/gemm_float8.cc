@@ -0,0 +1,227 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <string>
+
+#include "core/common/narrow.h"
+#include "core/framework/op_kernel.h"
+#include "core/mlas/inc/mlas.h"
+#include "core/providers/common.h"
+#include "core/providers/cpu/math/gemm_helper.h"
+
+namespace onnxruntime {
+namespace contrib {
+
+// CPU tier of com.microsoft.GemmFloat8, so fp8 weight-only models can be evaluated for
+// accuracy and memory footprint without fp8 hardware. A stays float; a float 8 B is
+// widened to float - once at pre-pack time for a constant initializer, straight into the
+// MLAS packed layout, or per run otherwise - and the GEMM then runs on the regular float
+// tier. The per-tensor scaleB stays outside the pack and folds into alpha, so a scale
+// refreshed by re-quantization does not invalidate the packed weights.
+class GemmFloat8 final : public OpKernel {
+ public:
+  explicit GemmFloat8(const OpKernelInfo& info) : OpKernel(info) {
+    transA_ = info.GetAttrOrDefault<int64_t>("transA", 0) != 0;
+    transB_ = info.GetAttrOrDefault<int64_t>("transB", 0) != 0;
+    alpha_ = info.GetAttrOrDefault<float>("alpha", 1.0f);
+    beta_ = info.GetAttrOrDefault<float>("beta", 0.0f);
+
+    const int64_t dtype = info.GetAttrOrDefault<int64_t>("dtype", ONNX_NAMESPACE::TensorProto_DataType_FLOAT);
+    ORT_ENFORCE(dtype == ONNX_NAMESPACE::TensorProto_DataType_FLOAT,
+                "The CPU GemmFloat8 kernel only produces a float output, requested dtype=", dtype);
+
+    const std::string activation = info.GetAttrOrDefault<std::string>("activation", "NONE");
+    ORT_ENFORCE(activation == "NONE", "Unexpected value for activation: '", activation, "'.");
+  }
+
+  Status PrePack(const Tensor& tensor, int input_idx, AllocatorPtr alloc,
+                 /*out*/ bool& is_packed,
+                 /*out*/ PrePackedWeights* prepacked_weights) override;
+
+  Status UseSharedPrePackedBuffers(std::vector<BufferUniquePtr>& prepacked_buffers, int input_idx,
+                                   /*out*/ bool& used_shared_buffers) override;
+
+  Status Compute(OpKernelContext* context) const override;
+
+ private:
+  bool transA_;
+  bool transB_;
+  float alpha_;
+  float beta_;
+
+  IAllocatorUniquePtr<void> packed_b_;
+  TensorShape b_shape_;
+};
+
+Status GemmFloat8::PrePack(const Tensor& tensor, int input_idx, AllocatorPtr alloc,
+                           /*out*/ bool& is_packed,
+                           /*out*/ PrePackedWeights* prepacked_weights) {
+  is_packed = false;
+
+#if !defined(DISABLE_FLOAT8_TYPES)
+  // only pack a constant float 8 B; a float B goes through the unpacked GEMM as usual
+  if (input_idx != 1 || !tensor.IsDataType<Float8E4M3FN>() || tensor.Shape().NumDimensions() != 2) {
+    return Status::OK();
+  }
+
+  b_shape_ = tensor.Shape();
+
+  const size_t K = narrow<size_t>(transB_ ? b_shape_[1] : b_shape_[0]);
+  const size_t N = narrow<size_t>(transB_ ? b_shape_[0] : b_shape_[1]);
+
+  const size_t packed_b_size = MlasGemmPackBSize(N, K);
+  if (packed_b_size == 0) {
+    return Status::OK();
+  }
+
+  // Widen the fp8 weights to float in the original layout, then hand them to the regular
+  // SGEMM packer. The widened copy is transient; only the packed buffer is kept.
+  const size_t num_elements = narrow<size_t>(b_shape_.Size());
+  auto widened_b = IAllocator::MakeUniquePtr<float>(alloc, num_elements);
+  Float8E4M3FNToFloat(tensor.Data<Float8E4M3FN>(), widened_b.get(), num_elements);
+
+  packed_b_ = IAllocator::MakeUniquePtr<void>(alloc, packed_b_size, true);
+
+  // Initialize memory to 0 as there could be some padding associated with pre-packed
+  // buffer memory and we don not want it uninitialized and generate different hashes
+  // if and when we try to cache this pre-packed buffer for sharing between sessions.
+  memset(packed_b_.get(), 0, packed_b_size);
+  MlasGemmPackB(transB_ ? CblasTrans : CblasNoTrans, N, K, widened_b.get(),
+                transB_ ? K : N, packed_b_.get());
+  is_packed = true;
+
+  if (prepacked_weights != nullptr) {
+    prepacked_weights->buffers_.push_back(std::move(packed_b_));
+    prepacked_weights->buffer_sizes_.push_back(packed_b_size);
+  }
+#else
+  ORT_UNUSED_PARAMETER(tensor);
+  ORT_UNUSED_PARAMETER(input_idx);
+  ORT_UNUSED_PARAMETER(alloc);
+  ORT_UNUSED_PARAMETER(prepacked_weights);
+#endif
+
+  return Status::OK();
+}
+
+Status GemmFloat8::UseSharedPrePackedBuffers(std::vector<BufferUniquePtr>& prepacked_buffers, int input_idx,
+                                             /*out*/ bool& used_shared_buffers) {
+  used_shared_buffers = false;
+
+  if (input_idx == 1) {
+    used_shared_buffers = true;
+    packed_b_ = std::move(prepacked_buffers[0]);
+  }
+
+  return Status::OK();
+}
+
+Status GemmFloat8::Compute(OpKernelContext* context) const {
+  concurrency::ThreadPool* thread_pool = context->GetOperatorThreadPool();
+
+  const auto* A = context->Input<Tensor>(0);
+  const auto* B = packed_b_ ? nullptr : context->Input<Tensor>(1);
+  const auto* C = context->Input<Tensor>(2);
+  const auto* scale_a = context->Input<Tensor>(3);
+  const auto* scale_b = context->Input<Tensor>(4);
+  const auto* scale_y = context->Input<Tensor>(5);
+
+  // A and Y are float on CPU, so only the weight scale has anything to undo.
+  if (scale_a != nullptr || scale_y != nullptr) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "The CPU GemmFloat8 kernel takes a float A and produces a float Y; "
+                           "scaleA and scaleY must not be provided.");
+  }
+
+  float dequant_scale = 1.0f;
+  if (scale_b != nullptr) {
+    if (!IsScalarOr1ElementVector(scale_b)) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "scaleB must be a per-tensor (scalar) scale.");
+    }
+    dequant_scale = *scale_b->Data<float>();
+  }
+
+  GemmHelper helper(A->Shape(), transA_, B != nullptr ? B->Shape() : b_shape_, transB_,
+                    C != nullptr ? C->Shape() : TensorShape({}));
+  if (!helper.State().IsOK())
+    return helper.State();
+
+  const ptrdiff_t M = helper.M();
+  const ptrdiff_t N = helper.N();
+  const ptrdiff_t K = helper.K();
+
+  auto* Y = context->Output(0, {M, N});
+  if (M == 0 || N == 0)
+    return Status::OK();
+
+  float* y_data = Y->MutableData<float>();
+  const float* c_data = C != nullptr ? C->Data<float>() : nullptr;
+  const TensorShape* c_shape = C != nullptr ? &C->Shape() : nullptr;
+
+  GemmBroadcastBias(M, N, beta_, c_data, c_shape, y_data);
+
+  if (K == 0) {
+    if (beta_ == 0 || c_data == nullptr) {
+      EigenMatrixMapRowMajor<float> dest(y_data, narrow<Eigen::Index>(M), narrow<Eigen::Index>(N));
+      dest.setZero();
+    }
+    return Status::OK();
+  }
+
+  const float* a_data = A->Data<float>();
+  const size_t lda = narrow<size_t>(transA_ ? M : K);
+  const float beta = c_data != nullptr ? beta_ : 0.0f;
+
+  if (packed_b_) {
+    MlasGemm(transA_ ? CblasTrans : CblasNoTrans,
+             narrow<size_t>(M), narrow<size_t>(N), narrow<size_t>(K),
+             alpha_ * dequant_scale, a_data, lda, packed_b_.get(),
+             beta, y_data, narrow<size_t>(N), thread_pool);
+    return Status::OK();
+  }
+
+  const float* b_data;
+  IAllocatorUniquePtr<float> widened_b;
+  if (B->IsDataType<float>()) {
+    b_data = B->Data<float>();
+  } else {
+#if !defined(DISABLE_FLOAT8_TYPES)
+    // non-constant fp8 B: widen into a transient buffer for this run
+    const size_t num_elements = narrow<size_t>(B->Shape().Size());
+    AllocatorPtr alloc;
+    ORT_RETURN_IF_ERROR(context->GetTempSpaceAllocator(&alloc));
+    widened_b = IAllocator::MakeUniquePtr<float>(alloc, num_elements);
+    Float8E4M3FNToFloat(B->Data<Float8E4M3FN>(), widened_b.get(), num_elements);
+    b_data = widened_b.get();
+#else
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "B must be a float tensor in this build.");
+#endif
+  }
+
+  MlasGemm(transA_ ? CblasTrans : CblasNoTrans, transB_ ? CblasTrans : CblasNoTrans,
+           narrow<size_t>(M), narrow<size_t>(N), narrow<size_t>(K),
+           alpha_ * dequant_scale, a_data, lda, b_data,
+           narrow<size_t>(transB_ ? K : N), beta, y_data, narrow<size_t>(N), thread_pool);
+
+  return Status::OK();
+}
+
+#if !defined(DISABLE_FLOAT8_TYPES)
+#define GEMM_FLOAT8_CPU_B_CONSTRAINTS BuildKernelDefConstraints<Float8E4M3FN, float>()
+#else
+#define GEMM_FLOAT8_CPU_B_CONSTRAINTS BuildKernelDefConstraints<float>()
+#endif
+
+ONNX_CPU_OPERATOR_MS_KERNEL(
+    GemmFloat8,
+    1,
+    KernelDefBuilder()
+        .TypeConstraint("TA", DataTypeImpl::GetTensorType<float>())
+        .TypeConstraint("TB", GEMM_FLOAT8_CPU_B_CONSTRAINTS)
+        .TypeConstraint("TC", DataTypeImpl::GetTensorType<float>())
+        .TypeConstraint("TR", DataTypeImpl::GetTensorType<float>())
+        .TypeConstraint("TS", DataTypeImpl::GetTensorType<float>()),
+    GemmFloat8);
+
+}  // namespace contrib
+}  // namespace onnxruntime
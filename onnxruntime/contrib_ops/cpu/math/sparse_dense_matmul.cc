@@ -5,6 +5,7 @@
 
 #include "core/framework/sparse_tensor.h"
 #include "core/common/narrow.h"
+#include "core/platform/threadpool.h"
 #include "core/providers/cpu/math/gemm_matmul_common.h"
 #include "core/providers/cpu/math/matmul_helper.h"
 #include "core/util/math.h"
@@ -45,6 +46,7 @@ struct ComputeCtx {
   bool trans_A;
   bool trans_B;
   float alpha;
+  concurrency::ThreadPool* thread_pool;
 };
 
 template <typename T>
@@ -72,7 +74,32 @@ inline void SparseDenseMatMulImpl<float>(const ComputeCtx& ctx, const ConstSpars
   } else if (!ctx.trans_A && ctx.trans_B) {
     output_map = map_A * ctx.alpha * map_B.transpose();
   } else {
-    output_map = map_A * ctx.alpha * map_B;
+    // Row-parallel CSR x dense product for the common non-transposed case. Output row m
+    // accumulates alpha * a(m, k) * B(k, :) over the nonzeros of sparse row m, so the inner
+    // update is a contiguous AXPY over the output row that Eigen vectorizes. The Eigen sparse
+    // product above is single threaded (it only parallelizes with OpenMP), which leaves most
+    // of the machine idle exactly when the weight is large enough for sparsity to matter.
+    const Eigen::Index* outer = map_A.outerIndexPtr();
+    const Eigen::Index* inner = map_A.innerIndexPtr();
+    const float* values = map_A.valuePtr();
+    const Eigen::Index M = map_A.rows();
+    const Eigen::Index N = map_B.cols();
+    const double avg_nnz_per_row =
+        M > 0 ? static_cast<double>(map_A.nonZeros()) / static_cast<double>(M) : 0.0;
+    const double bytes_per_row = (avg_nnz_per_row + 1.0) * static_cast<double>(N) * sizeof(float);
+    concurrency::ThreadPool::TryParallelFor(
+        ctx.thread_pool, narrow<std::ptrdiff_t>(M),
+        TensorOpCost{bytes_per_row, static_cast<double>(N) * sizeof(float),
+                     2.0 * avg_nnz_per_row * static_cast<double>(N)},
+        [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+          for (std::ptrdiff_t m = begin; m != end; ++m) {
+            auto output_row = output_map.row(m);
+            output_row.setZero();
+            for (Eigen::Index idx = outer[m]; idx < outer[m + 1]; ++idx) {
+              output_row += (ctx.alpha * values[idx]) * map_B.row(inner[idx]);
+            }
+          }
+        });
   }
 }
 
@@ -119,8 +146,8 @@ struct SparseToDenseCsr {
     ConstEigenMatrixMapRowMajor<T> map_B(B.Data<T>(), narrow<Eigen::Index>(b_dims[0]), narrow<Eigen::Index>(b_dims[1]));
     EigenMatrixMapRowMajor<T> output_map(output.MutableData<T>(), narrow<Eigen::Index>(out_dims[0]),
                                          narrow<Eigen::Index>(out_dims[1]));
-    // XXX: Consider re-writing it as a parallel loop as Eigen requires it to use OpenMP
-    // XXX: Consider vectorization
+    // The float specialization runs the non-transposed product as a parallel loop over the
+    // sparse rows; the remaining cases still go through the single threaded Eigen product.
     SparseDenseMatMulImpl(ctx, map_A, map_B, output_map);
   }
 };
@@ -209,7 +236,7 @@ Status SparseToDenseMatMul::Compute(OpKernelContext* ctx) const {
   utils::MLTypeCallDispatcher<float, double, int32_t, uint32_t, int64_t, uint64_t> t_disp(A->GetElementType());
   // I am not expecting to do the below in every kernel but this is a reference
   // implementation to show the expectations.
-  ComputeCtx compute_ctx{trans_a_attr_ != 0, trans_b_attr_ != 0, alpha_attr_};
+  ComputeCtx compute_ctx{trans_a_attr_ != 0, trans_b_attr_ != 0, alpha_attr_, ctx->GetOperatorThreadPool()};
   if (A->Format() == SparseFormat::kCoo) {
     auto coo_view = A->AsCoo();
     const auto num_dims = coo_view.Indices().Shape().NumDimensions();
@@ -0,0 +1,261 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "contrib_ops/cpu/moe/moe.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "core/common/safeint.h"
+#include "core/framework/allocator.h"
+#include "core/mlas/inc/mlas.h"
+#include "core/platform/threadpool.h"
+#include "core/util/math_cpuonly.h"
+
+using onnxruntime::concurrency::ThreadPool;
+
+namespace onnxruntime {
+namespace contrib {
+
+ONNX_OPERATOR_TYPED_KERNEL_EX(
+    MoE,
+    kMSDomain,
+    1,
+    float,
+    kCpuExecutionProvider,
+    KernelDefBuilder()
+        .TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+    MoE);
+
+namespace {
+
+void ApplyActivation(float* data, int64_t size, MoEActivationType activation_type) {
+  switch (activation_type) {
+    case MoEActivationType::Relu:
+      for (int64_t i = 0; i < size; ++i) {
+        data[i] = std::max(data[i], 0.0f);
+      }
+      break;
+    case MoEActivationType::Gelu:
+      for (int64_t i = 0; i < size; ++i) {
+        data[i] = 0.5f * data[i] * (1.0f + std::erf(data[i] * static_cast<float>(M_SQRT1_2)));
+      }
+      break;
+    case MoEActivationType::Silu:
+      for (int64_t i = 0; i < size; ++i) {
+        data[i] = data[i] / (1.0f + std::exp(-data[i]));
+      }
+      break;
+    case MoEActivationType::Identity:
+      break;
+  }
+}
+
+// C (m x n) = A (m x k) * B (k x n) + broadcast bias (n), single-threaded: the caller already
+// runs one task per expert on the thread pool
+void GemmWithOptionalBias(const float* a, const float* b, const float* bias,
+                          float* c, int64_t m, int64_t n, int64_t k) {
+  float beta = 0.0f;
+  if (bias != nullptr) {
+    for (int64_t i = 0; i < m; ++i) {
+      memcpy(c + i * n, bias, SafeInt<size_t>(n) * sizeof(float));
+    }
+    beta = 1.0f;
+  }
+
+  MlasGemm(CblasNoTrans, CblasNoTrans,
+           static_cast<size_t>(m), static_cast<size_t>(n), static_cast<size_t>(k),
+           1.0f, a, static_cast<size_t>(k), b, static_cast<size_t>(n),
+           beta, c, static_cast<size_t>(n), nullptr);
+}
+
+}  // namespace
+
+Status MoE::Compute(OpKernelContext* context) const {
+  const Tensor* input = context->Input<Tensor>(0);
+  const Tensor* router_probs = context->Input<Tensor>(1);
+  const Tensor* fc1_experts_weights = context->Input<Tensor>(2);
+  const Tensor* fc1_experts_bias_optional = context->Input<Tensor>(3);
+  const Tensor* fc2_experts_weights = context->Input<Tensor>(4);
+  const Tensor* fc2_experts_bias_optional = context->Input<Tensor>(5);
+  const Tensor* fc3_experts_weights_optional = context->Input<Tensor>(6);
+  const Tensor* fc3_experts_bias_optional = context->Input<Tensor>(7);
+
+  MoEParameters params;
+  ORT_RETURN_IF_ERROR(CheckInputs(params, input, router_probs, fc1_experts_weights, fc1_experts_bias_optional,
+                                  fc2_experts_weights, fc2_experts_bias_optional, fc3_experts_weights_optional,
+                                  fc3_experts_bias_optional));
+
+  if (use_sparse_mixer_) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, NOT_IMPLEMENTED, "use_sparse_mixer is not supported by the CPU MoE kernel");
+  }
+  if (k_ < 1 || k_ > params.num_experts) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "k must be in [1, num_experts], got ", k_);
+  }
+
+  const int64_t num_rows = params.num_rows;
+  const int64_t num_experts = params.num_experts;
+  const int64_t hidden_size = params.hidden_size;
+  const int64_t inter_size = params.inter_size;
+  const int64_t k = k_;
+  const int64_t num_slots = num_rows * k;
+
+  Tensor* output = context->Output(0, input->Shape());
+
+  const float* input_data = input->Data<float>();
+  const float* router_probs_data = router_probs->Data<float>();
+  const float* fc1_weights = fc1_experts_weights->Data<float>();
+  const float* fc1_bias = fc1_experts_bias_optional != nullptr ? fc1_experts_bias_optional->Data<float>() : nullptr;
+  const float* fc2_weights = fc2_experts_weights->Data<float>();
+  const float* fc2_bias = fc2_experts_bias_optional != nullptr ? fc2_experts_bias_optional->Data<float>() : nullptr;
+  const float* fc3_weights =
+      fc3_experts_weights_optional != nullptr ? fc3_experts_weights_optional->Data<float>() : nullptr;
+  const float* fc3_bias = fc3_experts_bias_optional != nullptr ? fc3_experts_bias_optional->Data<float>() : nullptr;
+
+  AllocatorPtr alloc;
+  ORT_RETURN_IF_ERROR(context->GetTempSpaceAllocator(&alloc));
+
+  // 1. Routing: softmax over the experts of each row, then top-k (ties go to the lower expert
+  //    index, matching the CUDA kernel). Slot r * k + j holds the j-th choice of row r.
+  auto slot_expert_buffer = IAllocator::MakeUniquePtr<int64_t>(alloc, static_cast<size_t>(num_slots));
+  auto slot_weight_buffer = IAllocator::MakeUniquePtr<float>(alloc, static_cast<size_t>(num_slots));
+  int64_t* slot_expert = slot_expert_buffer.get();
+  float* slot_weight = slot_weight_buffer.get();
+
+  {
+    std::vector<float> probs(static_cast<size_t>(num_experts));
+    for (int64_t row = 0; row < num_rows; ++row) {
+      const float* logits = router_probs_data + row * num_experts;
+      float max_logit = *std::max_element(logits, logits + num_experts);
+      float sum = 0.0f;
+      for (int64_t e = 0; e < num_experts; ++e) {
+        probs[static_cast<size_t>(e)] = std::exp(logits[e] - max_logit);
+        sum += probs[static_cast<size_t>(e)];
+      }
+
+      float top_k_sum = 0.0f;
+      for (int64_t j = 0; j < k; ++j) {
+        int64_t best = -1;
+        float best_prob = -1.0f;
+        for (int64_t e = 0; e < num_experts; ++e) {
+          if (probs[static_cast<size_t>(e)] > best_prob) {
+            best_prob = probs[static_cast<size_t>(e)];
+            best = e;
+          }
+        }
+        slot_expert[row * k + j] = best;
+        slot_weight[row * k + j] = best_prob / sum;
+        top_k_sum += best_prob / sum;
+        probs[static_cast<size_t>(best)] = -1.0f;  // exclude from the remaining selections
+      }
+
+      if (normalize_routing_weights_) {
+        for (int64_t j = 0; j < k; ++j) {
+          slot_weight[row * k + j] /= top_k_sum;
+        }
+      }
+    }
+  }
+
+  // 2. Dispatch: bucket the slots by expert so each expert sees its tokens as one contiguous
+  //    batch. Rows are visited in order, so the batch order within an expert is deterministic.
+  std::vector<int64_t> expert_offsets(static_cast<size_t>(num_experts) + 1, 0);
+  for (int64_t slot = 0; slot < num_slots; ++slot) {
+    expert_offsets[static_cast<size_t>(slot_expert[slot]) + 1]++;
+  }
+  for (int64_t e = 0; e < num_experts; ++e) {
+    expert_offsets[static_cast<size_t>(e) + 1] += expert_offsets[static_cast<size_t>(e)];
+  }
+
+  auto slot_position_buffer = IAllocator::MakeUniquePtr<int64_t>(alloc, static_cast<size_t>(num_slots));
+  auto position_row_buffer = IAllocator::MakeUniquePtr<int64_t>(alloc, static_cast<size_t>(num_slots));
+  int64_t* slot_position = slot_position_buffer.get();  // slot -> position in the permuted batch
+  int64_t* position_row = position_row_buffer.get();    // position in the permuted batch -> row
+  {
+    std::vector<int64_t> cursor(expert_offsets.begin(), expert_offsets.end() - 1);
+    for (int64_t slot = 0; slot < num_slots; ++slot) {
+      int64_t position = cursor[static_cast<size_t>(slot_expert[slot])]++;
+      slot_position[slot] = position;
+      position_row[position] = slot / k;
+    }
+  }
+
+  // 3. Expert FFNs, one task per expert on the thread pool. Each task gathers its tokens,
+  //    runs fc1 (+ optional fc3 gating) and fc2 as single-threaded GEMMs over the whole batch,
+  //    and writes into its own contiguous region of the permuted buffers, so there is no
+  //    write sharing between tasks.
+  auto permuted_input_buffer = IAllocator::MakeUniquePtr<float>(alloc, static_cast<size_t>(num_slots * hidden_size));
+  auto fc1_output_buffer = IAllocator::MakeUniquePtr<float>(alloc, static_cast<size_t>(num_slots * inter_size));
+  auto fc3_output_buffer = fc3_weights != nullptr
+                               ? IAllocator::MakeUniquePtr<float>(alloc, static_cast<size_t>(num_slots * inter_size))
+                               : IAllocatorUniquePtr<float>();
+  auto permuted_output_buffer = IAllocator::MakeUniquePtr<float>(alloc, static_cast<size_t>(num_slots * hidden_size));
+  float* permuted_input = permuted_input_buffer.get();
+  float* fc1_output = fc1_output_buffer.get();
+  float* fc3_output = fc3_output_buffer.get();
+  float* permuted_output = permuted_output_buffer.get();
+
+  ThreadPool* tp = context->GetOperatorThreadPool();
+  ThreadPool::TrySimpleParallelFor(
+      tp, static_cast<std::ptrdiff_t>(num_experts),
+      [&](std::ptrdiff_t expert) {
+        const int64_t begin = expert_offsets[static_cast<size_t>(expert)];
+        const int64_t expert_rows = expert_offsets[static_cast<size_t>(expert) + 1] - begin;
+        if (expert_rows == 0) {
+          return;
+        }
+
+        float* expert_input = permuted_input + begin * hidden_size;
+        for (int64_t i = 0; i < expert_rows; ++i) {
+          memcpy(expert_input + i * hidden_size, input_data + position_row[begin + i] * hidden_size,
+                 SafeInt<size_t>(hidden_size) * sizeof(float));
+        }
+
+        float* expert_fc1 = fc1_output + begin * inter_size;
+        GemmWithOptionalBias(expert_input, fc1_weights + expert * hidden_size * inter_size,
+                             fc1_bias != nullptr ? fc1_bias + expert * inter_size : nullptr,
+                             expert_fc1, expert_rows, inter_size, hidden_size);
+        ApplyActivation(expert_fc1, expert_rows * inter_size, activation_type_);
+
+        if (fc3_weights != nullptr) {
+          // gated FFN: the fc3 projection is not activated and multiplies the activated fc1
+          float* expert_fc3 = fc3_output + begin * inter_size;
+          GemmWithOptionalBias(expert_input, fc3_weights + expert * hidden_size * inter_size,
+                               fc3_bias != nullptr ? fc3_bias + expert * inter_size : nullptr,
+                               expert_fc3, expert_rows, inter_size, hidden_size);
+          for (int64_t i = 0; i < expert_rows * inter_size; ++i) {
+            expert_fc1[i] *= expert_fc3[i];
+          }
+        }
+
+        GemmWithOptionalBias(expert_fc1, fc2_weights + expert * inter_size * hidden_size,
+                             fc2_bias != nullptr ? fc2_bias + expert * hidden_size : nullptr,
+                             permuted_output + begin * hidden_size, expert_rows, hidden_size, inter_size);
+      });
+
+  // 4. Scatter back: each row sums its k expert results weighted by the routing weights.
+  //    Parallel over rows, so concurrent experts never write the same output row.
+  float* output_data = output->MutableData<float>();
+  ThreadPool::TryParallelFor(
+      tp, static_cast<std::ptrdiff_t>(num_rows), static_cast<double>(k * hidden_size),
+      [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+        for (std::ptrdiff_t row = first; row < last; ++row) {
+          float* out_row = output_data + row * hidden_size;
+          memset(out_row, 0, SafeInt<size_t>(hidden_size) * sizeof(float));
+          for (int64_t j = 0; j < k; ++j) {
+            const float weight = slot_weight[row * k + j];
+            const float* expert_row = permuted_output + slot_position[row * k + j] * hidden_size;
+            for (int64_t h = 0; h < hidden_size; ++h) {
+              out_row[h] += weight * expert_row[h];
+            }
+          }
+        }
+      });
+
+  return Status::OK();
+}
+
+}  // namespace contrib
+}  // namespace onnxruntime
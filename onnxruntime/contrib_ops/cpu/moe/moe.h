@@ -0,0 +1,25 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "contrib_ops/cpu/moe/moe_base.h"
+#include "core/common/common.h"
+#include "core/framework/op_kernel.h"
+
+namespace onnxruntime {
+namespace contrib {
+
+// Mixture of experts for CPU. Tokens are batched per expert so each selected expert runs its
+// FFN as one GEMM per layer over all the tokens routed to it, and the experts are processed in
+// parallel on the intra-op thread pool; the results are scattered back to token order weighted
+// by the routing probabilities.
+class MoE final : public OpKernel, public MoEBase {
+ public:
+  explicit MoE(const OpKernelInfo& info) : OpKernel(info), MoEBase(info) {}
+
+  Status Compute(OpKernelContext* context) const override;
+};
+
+}  // namespace contrib
+}  // namespace onnxruntime
@@ -0,0 +1,163 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <string>
+
+#include "core/common/common.h"
+#include "core/framework/op_kernel.h"
+#include "core/framework/tensor_shape.h"
+
+namespace onnxruntime {
+namespace contrib {
+
+enum class MoEActivationType {
+  Relu,
+  Gelu,
+  Silu,
+  Identity,
+};
+
+struct MoEParameters {
+  int64_t num_rows;
+  int64_t num_experts;
+  int64_t hidden_size;
+  int64_t inter_size;
+};
+
+// Attribute handling and shape validation for the CPU MoE kernel, mirroring the CUDA MoEBase.
+// The CPU build has neither quantized weights nor expert/tensor parallelism, so those parts are
+// dropped and the full expert set must be local (fc1_experts_weights dim 0 == num_experts).
+class MoEBase {
+ public:
+  Status CheckInputs(MoEParameters& parameters, const Tensor* input, const Tensor* router_probs,
+                     const Tensor* fc1_experts_weights, const Tensor* fc1_experts_bias_optional,
+                     const Tensor* fc2_experts_weights, const Tensor* fc2_experts_bias_optional,
+                     const Tensor* fc3_experts_weights_optional, const Tensor* fc3_experts_bias_optional) const {
+    const auto& input_dims = input->Shape().GetDims();
+    const auto& router_probs_dims = router_probs->Shape().GetDims();
+    const auto& fc1_experts_weights_dims = fc1_experts_weights->Shape().GetDims();
+    const auto& fc2_experts_weights_dims = fc2_experts_weights->Shape().GetDims();
+
+    int64_t num_rows = input_dims.size() == 2 ? input_dims[0] : input_dims[0] * input_dims[1];
+    int64_t hidden_size = input_dims[input_dims.size() - 1];
+    int64_t num_experts = router_probs_dims[1];
+    int64_t inter_size = fc2_experts_weights_dims[1];
+
+    if (fc1_experts_weights_dims.size() != 3) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "fc1_experts_weights_dims must be 3D, got ",
+                             fc1_experts_weights_dims.size());
+    }
+    if (fc2_experts_weights_dims.size() != 3) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "fc2_experts_weights_dims must be 3D, got ",
+                             fc2_experts_weights_dims.size());
+    }
+    if (fc1_experts_weights_dims[0] != num_experts) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                             "fc1_experts_weights_dims[0] must be equal to num_experts on CPU "
+                             "(expert parallelism is not supported), got ",
+                             fc1_experts_weights_dims[0], " and ", num_experts);
+    }
+    if (fc1_experts_weights_dims[1] != hidden_size) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                             "fc1_experts_weights_dims[1] must be equal to hidden_size, got ",
+                             fc1_experts_weights_dims[1], " and ", hidden_size);
+    }
+    if (fc1_experts_weights_dims[2] != inter_size) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                             "fc1_experts_weights_dims[2] must be equal to inter_size, got ",
+                             fc1_experts_weights_dims[2], " and ", inter_size);
+    }
+    if (fc2_experts_weights_dims[0] != num_experts) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                             "fc2_experts_weights_dims[0] must be equal to num_experts, got ",
+                             fc2_experts_weights_dims[0], " and ", num_experts);
+    }
+    if (fc2_experts_weights_dims[2] != hidden_size) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                             "fc2_experts_weights_dims[2] must be equal to hidden_size, got ",
+                             fc2_experts_weights_dims[2], " and ", hidden_size);
+    }
+
+    if (router_probs_dims.size() != 2) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "router_probs_dims must be 2D, got ",
+                             router_probs_dims.size());
+    }
+    if (router_probs_dims[0] != num_rows) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "router_probs_dims[0] must be equal to num_rows, got ",
+                             router_probs_dims[0], " and ", num_rows);
+    }
+
+    if (fc1_experts_bias_optional != nullptr) {
+      const auto& fc1_experts_bias_dims = fc1_experts_bias_optional->Shape().GetDims();
+      if (fc1_experts_bias_dims.size() != 2 || fc1_experts_bias_dims[0] != num_experts ||
+          fc1_experts_bias_dims[1] != inter_size) {
+        return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                               "fc1_experts_bias must have shape (num_experts, inter_size), got ",
+                               fc1_experts_bias_optional->Shape());
+      }
+    }
+    if (fc2_experts_bias_optional != nullptr) {
+      const auto& fc2_experts_bias_dims = fc2_experts_bias_optional->Shape().GetDims();
+      if (fc2_experts_bias_dims.size() != 2 || fc2_experts_bias_dims[0] != num_experts ||
+          fc2_experts_bias_dims[1] != hidden_size) {
+        return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                               "fc2_experts_bias must have shape (num_experts, hidden_size), got ",
+                               fc2_experts_bias_optional->Shape());
+      }
+    }
+
+    if (fc3_experts_weights_optional != nullptr &&
+        fc3_experts_weights_optional->Shape().GetDims() != fc1_experts_weights_dims) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                             "fc3_experts_weights_dims must be equal to fc1_experts_weights_dims, got ",
+                             fc3_experts_weights_optional->Shape(), " and ", TensorShape(fc1_experts_weights_dims));
+    }
+
+    if (fc3_experts_bias_optional != nullptr && fc1_experts_bias_optional != nullptr &&
+        fc3_experts_bias_optional->Shape().GetDims() != fc1_experts_bias_optional->Shape().GetDims()) {
+      return ORT_MAKE_STATUS(
+          ONNXRUNTIME, INVALID_ARGUMENT, "fc3_experts_bias_dims must be equal to fc1_experts_bias_dims, got ",
+          fc3_experts_bias_optional->Shape(), " and ", fc1_experts_bias_optional->Shape());
+    }
+
+    parameters.num_rows = num_rows;
+    parameters.num_experts = num_experts;
+    parameters.hidden_size = hidden_size;
+    parameters.inter_size = inter_size;
+
+    return Status::OK();
+  }
+
+ protected:
+  MoEBase(const OpKernelInfo& op_kernel_info) {
+    ORT_ENFORCE(op_kernel_info.GetAttr<int64_t>("k", &k_).IsOK());
+
+    std::string activation_type_str;
+    ORT_ENFORCE(op_kernel_info.GetAttr<std::string>("activation_type", &activation_type_str).IsOK());
+    if (activation_type_str == "relu") {
+      activation_type_ = MoEActivationType::Relu;
+    } else if (activation_type_str == "gelu") {
+      activation_type_ = MoEActivationType::Gelu;
+    } else if (activation_type_str == "silu") {
+      activation_type_ = MoEActivationType::Silu;
+    } else if (activation_type_str == "identity") {
+      activation_type_ = MoEActivationType::Identity;
+    } else {
+      ORT_THROW("Unsupported MoE activation type: ", activation_type_str);
+    }
+
+    normalize_routing_weights_ = op_kernel_info.GetAttrOrDefault<int64_t>("normalize_routing_weights", 0) == 1;
+
+    use_sparse_mixer_ = op_kernel_info.GetAttrOrDefault<int64_t>("use_sparse_mixer", 0) == 1;
+  }
+
+  bool normalize_routing_weights_;
+  bool use_sparse_mixer_;
+  int64_t k_;
+  MoEActivationType activation_type_;
+};
+
+}  // namespace contrib
+}  // namespace onnxruntime
@@ -3,6 +3,7 @@
 
 #include "core/framework/op_kernel.h"
 #include "contrib_ops/cpu/bert/attention_cpu_base.h"
+#include "contrib_ops/cpu/bert/attention_helper.h"
 #include "core/providers/common.h"
 #include "core/util/math.h"
 #include "core/util/qmath.h"
@@ -10,6 +11,10 @@
 #include "core/common/safeint.h"
 #include "core/platform/threadpool.h"
 #include "core/mlas/inc/mlas.h"
+#include "core/session/onnxruntime_session_options_config_keys.h"
+
+#include <algorithm>
+#include <cmath>
 
 using onnxruntime::concurrency::ThreadPool;
 
@@ -36,6 +41,7 @@ class QAttention : public OpKernel, public AttentionCPUBase {
   size_t packed_weights_size_;
   TensorShape weight_shape_;
   bool weights_is_signed_;
+  bool use_quantized_attention_core_{false};
 };
 
 // These ops are internal-only, so register outside of onnx
@@ -54,6 +60,8 @@ ONNX_OPERATOR_TYPED_KERNEL_EX(
 
 template <typename T>
 QAttention<T>::QAttention(const OpKernelInfo& info) : OpKernel(info), AttentionCPUBase(info, true) {
+  use_quantized_attention_core_ =
+      info.GetConfigOptions().GetConfigEntry(kOrtSessionOptionsEnableQuantizedAttentionCore) == "1";
 }
 
 template <typename T>
@@ -129,6 +137,149 @@ Status QAttention<T>::UseSharedPrePackedBuffers(std::vector<BufferUniquePtr>& pr
   return Status::OK();
 }
 
+namespace {
+
+// Symmetric dynamic quantization of a block of floats to int8.
+// Returns the scale; a zero block quantizes with scale 1 so the dequantized result stays zero.
+float QuantizeBlockSymmetric(const float* input, int8_t* output, size_t count) {
+  float min_value, max_value;
+  MlasFindMinMaxElement(input, &min_value, &max_value, count);
+  float abs_max = std::max(std::fabs(min_value), std::fabs(max_value));
+  float scale = abs_max > 0.0f ? abs_max / 127.0f : 1.0f;
+  MlasQuantizeLinear(input, output, count, scale, static_cast<int8_t>(0));
+  return scale;
+}
+
+// Fully quantized attention core for the shapes the fp32 base path handles without extras:
+// no mask, no past/present state, bidirectional. Q/K/V arrive as fp32 per-head blocks of
+// shape (S, H) from the fused dequantizing QKV GEMM; each block is requantized to int8 with
+// a per-head dynamic scale, QK^T and the context GEMM run through MlasGemmBatch with int32
+// accumulation (which supplies the cache tiling and threading), and the only fp32 work left
+// is the softmax, whose input absorbs the combined q*k*1/sqrt(H) scale in the int32->float
+// conversion. Attention probabilities are in [0, 1] so they requantize to uint8 with the
+// fixed scale 1/255.
+Status ComputeQuantizedAttention(const float* Q, const float* K, const float* V, float* output,
+                                 int batch_size, int sequence_length, int head_size,
+                                 int hidden_size, int num_heads,
+                                 AllocatorPtr allocator, ThreadPool* tp) {
+  const size_t num_matrices = SafeInt<size_t>(batch_size) * num_heads;
+  const size_t qkv_block = SafeInt<size_t>(sequence_length) * head_size;
+  const size_t score_block = SafeInt<size_t>(sequence_length) * sequence_length;
+
+  auto q_quant = IAllocator::MakeUniquePtr<int8_t>(allocator, num_matrices * qkv_block);
+  auto k_quant = IAllocator::MakeUniquePtr<int8_t>(allocator, num_matrices * qkv_block);
+  auto k_quant_t = IAllocator::MakeUniquePtr<int8_t>(allocator, num_matrices * qkv_block);
+  auto v_quant = IAllocator::MakeUniquePtr<int8_t>(allocator, num_matrices * qkv_block);
+  auto scores = IAllocator::MakeUniquePtr<int32_t>(allocator, num_matrices * score_block);
+  auto probs_quant = IAllocator::MakeUniquePtr<uint8_t>(allocator, num_matrices * score_block);
+  auto context_quant = IAllocator::MakeUniquePtr<int32_t>(allocator, num_matrices * qkv_block);
+
+  std::vector<float> q_scales(num_matrices);
+  std::vector<float> k_scales(num_matrices);
+  std::vector<float> v_scales(num_matrices);
+
+  // STEP.1: requantize Q, K and V per head; K is additionally transposed to (H, S) so that
+  // QK^T maps onto a plain row-major GEMM.
+  ThreadPool::TrySimpleParallelFor(tp, static_cast<std::ptrdiff_t>(num_matrices),
+                                   [&](std::ptrdiff_t i) {
+                                     const size_t offset = static_cast<size_t>(i) * qkv_block;
+                                     q_scales[i] = QuantizeBlockSymmetric(Q + offset, q_quant.get() + offset, qkv_block);
+                                     k_scales[i] = QuantizeBlockSymmetric(K + offset, k_quant.get() + offset, qkv_block);
+                                     v_scales[i] = QuantizeBlockSymmetric(V + offset, v_quant.get() + offset, qkv_block);
+
+                                     const int8_t* k_src = k_quant.get() + offset;
+                                     int8_t* k_dst = k_quant_t.get() + offset;
+                                     for (int s = 0; s < sequence_length; s++) {
+                                       for (int h = 0; h < head_size; h++) {
+                                         k_dst[h * sequence_length + s] = k_src[s * head_size + h];
+                                       }
+                                     }
+                                   });
+
+  // STEP.2: scores(S, S) = Q_q(S, H) x K_q^T(H, S) with int32 accumulation.
+  {
+    MLAS_GEMM_QUANT_SHAPE_PARAMS gemm_shape;
+    gemm_shape.M = sequence_length;
+    gemm_shape.N = sequence_length;
+    gemm_shape.K = head_size;
+    gemm_shape.AIsSigned = true;
+    gemm_shape.BIsSigned = true;
+
+    std::vector<MLAS_GEMM_QUANT_DATA_PARAMS> gemm_data_vec(num_matrices);
+    for (size_t i = 0; i < num_matrices; i++) {
+      auto& gemm_params = gemm_data_vec[i];
+      gemm_params.A = reinterpret_cast<const uint8_t*>(q_quant.get() + i * qkv_block);
+      gemm_params.lda = head_size;
+      gemm_params.B = k_quant_t.get() + i * qkv_block;
+      gemm_params.ldb = sequence_length;
+      gemm_params.C = scores.get() + i * score_block;
+      gemm_params.ldc = sequence_length;
+    }
+
+    MlasGemmBatch(gemm_shape, gemm_data_vec.data(), num_matrices, tp);
+  }
+
+  // STEP.3: softmax. The int32 scores convert to float in place with the combined scale
+  // q_scale * k_scale / sqrt(H) folded in, then the probabilities requantize to uint8.
+  ThreadPool::TrySimpleParallelFor(tp, static_cast<std::ptrdiff_t>(num_matrices),
+                                   [&](std::ptrdiff_t i) {
+                                     int32_t* score_block_data = scores.get() + static_cast<size_t>(i) * score_block;
+                                     float* prob_block_data = reinterpret_cast<float*>(score_block_data);
+                                     const float scale = q_scales[i] * k_scales[i] / sqrtf(static_cast<float>(head_size));
+                                     for (size_t j = 0; j < score_block; j++) {
+                                       prob_block_data[j] = static_cast<float>(score_block_data[j]) * scale;
+                                     }
+                                     ComputeAttentionSoftmaxInplace(prob_block_data, sequence_length, sequence_length, nullptr);
+                                     MlasQuantizeLinear(prob_block_data,
+                                                        probs_quant.get() + static_cast<size_t>(i) * score_block,
+                                                        score_block, 1.0f / 255.0f, static_cast<uint8_t>(0));
+                                   });
+
+  // STEP.4: context(S, H) = probs_q(S, S) x V_q(S, H) with int32 accumulation.
+  {
+    MLAS_GEMM_QUANT_SHAPE_PARAMS gemm_shape;
+    gemm_shape.M = sequence_length;
+    gemm_shape.N = head_size;
+    gemm_shape.K = sequence_length;
+    gemm_shape.AIsSigned = false;
+    gemm_shape.BIsSigned = true;
+
+    std::vector<MLAS_GEMM_QUANT_DATA_PARAMS> gemm_data_vec(num_matrices);
+    for (size_t i = 0; i < num_matrices; i++) {
+      auto& gemm_params = gemm_data_vec[i];
+      gemm_params.A = probs_quant.get() + i * score_block;
+      gemm_params.lda = sequence_length;
+      gemm_params.B = v_quant.get() + i * qkv_block;
+      gemm_params.ldb = head_size;
+      gemm_params.C = context_quant.get() + i * qkv_block;
+      gemm_params.ldc = head_size;
+    }
+
+    MlasGemmBatch(gemm_shape, gemm_data_vec.data(), num_matrices, tp);
+  }
+
+  // STEP.5: dequantize the context and transpose (B, N, S, H) back to the (B, S, N*H) output.
+  ThreadPool::TrySimpleParallelFor(tp, static_cast<std::ptrdiff_t>(num_matrices),
+                                   [&](std::ptrdiff_t i) {
+                                     const int batch_index = static_cast<int>(i) / num_heads;
+                                     const int head_index = static_cast<int>(i) % num_heads;
+                                     const float scale = (1.0f / 255.0f) * v_scales[i];
+                                     const int32_t* context_data = context_quant.get() + static_cast<size_t>(i) * qkv_block;
+                                     for (int s = 0; s < sequence_length; s++) {
+                                       float* output_row = output +
+                                                           (static_cast<size_t>(batch_index) * sequence_length + s) * hidden_size +
+                                                           static_cast<size_t>(head_index) * head_size;
+                                       for (int h = 0; h < head_size; h++) {
+                                         output_row[h] = static_cast<float>(context_data[s * head_size + h]) * scale;
+                                       }
+                                     }
+                                   });
+
+  return Status::OK();
+}
+
+}  // namespace
+
 template <typename T>
 Status QAttention<T>::Compute(OpKernelContext* context) const {
   // Input and output shapes:
@@ -287,6 +438,18 @@ Status QAttention<T>::Compute(OpKernelContext* context) const {
     MlasGemmBatch(gemm_shape, gemm_data_vec.data(), loop_len, tp);
   }
 
+  // When enabled and the fp32 base path would add nothing (no mask, no past/present state,
+  // bidirectional), keep the attention core quantized instead of falling back to fp32 GEMMs.
+  if (use_quantized_attention_core_ &&
+      mask_index == nullptr && past_tensor == nullptr && !is_unidirectional_ &&
+      context->OutputCount() == 1) {
+    AllocatorPtr quant_allocator;
+    ORT_RETURN_IF_ERROR(context->GetTempSpaceAllocator(&quant_allocator));
+    return ComputeQuantizedAttention(Q, K, V, output->MutableData<T>(),
+                                     batch_size, sequence_length, head_size, hidden_size,
+                                     num_heads_, quant_allocator, tp);
+  }
+
   // Compute the attention score and apply the score to V
   return ApplyAttention(Q, K, V, mask_index, past_tensor, nullptr /* past_key */, nullptr /* past_value*/,
                         output, nullptr /* present_key */, nullptr /* present_value */,
@@ -1,6 +1,8 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#include <algorithm>
+#include <type_traits>
 #include <vector>
 #include <unordered_map>
 
@@ -12,10 +14,32 @@
 #include "core/framework/op_kernel.h"
 #include "core/platform/threadpool.h"
 #include "core/providers/common.h"
+#include "core/util/prefetch.h"
 
 namespace onnxruntime {
 namespace contrib {
 
+namespace {
+// 4-bit types pack two elements per byte; 8-bit types hold one element per byte.
+template <typename T1>
+constexpr bool kIsPacked4Bit = std::is_same_v<T1, Int4x2> || std::is_same_v<T1, UInt4x2>;
+
+template <typename T1>
+inline int32_t QuantizedElem(const T1* ptr, int64_t idx) {
+  if constexpr (kIsPacked4Bit<T1>) {
+    return static_cast<int32_t>(ptr[idx >> 1].GetElem(narrow<size_t>(idx & 1)));
+  } else {
+    return static_cast<int32_t>(ptr[idx]);
+  }
+}
+
+// Embedding lookups are data dependent, so the rows a few indices ahead of the
+// dequantize loop are prefetched explicitly. Only the leading bytes of a row
+// are touched; the hardware prefetcher keeps up once the row read is streaming.
+constexpr int64_t kIndexPrefetchAhead = 8;
+constexpr int64_t kIndexPrefetchBytes = 256;
+}  // namespace
+
 template <typename T1, typename Tind>
 class GatherBlockQuantized : public OpKernel {
  public:
@@ -142,6 +166,45 @@ Status GatherBlockQuantized<T1, Tind>::CopyDataAndDequantize(const T1* data_ptr,
   auto quantize_full_block = quantize_axis_dim * quantize_N;
   auto scale_full_block = (quantize_axis_dim + block_size_ - 1) / block_size_ * quantize_N;
 
+  // Embedding-table fast path: with the quantize axis innermost and every gathered block
+  // starting on a row boundary, the scale only changes every block_size_ contiguous elements,
+  // so the per-element div/mod of the general path can be hoisted to once per quantization
+  // block. Typical lookup tables ([vocab, hidden] with gather_axis=0, quantize_axis=1) take
+  // this path.
+  const bool contiguous_rows = quantize_N == 1 && (gather_block % quantize_axis_dim) == 0;
+
+  // Dequantize `count` contiguous elements sharing one scale/zero-point. The 8-bit loop is
+  // written so that compilers auto-vectorize it; the 4-bit loop unpacks a byte pair per
+  // iteration after peeling to byte alignment.
+  auto dequantize_run = [&](int64_t data_idx, int64_t output_idx, int64_t count,
+                            float scale_val, int32_t zp_val) {
+    if constexpr (kIsPacked4Bit<T1>) {
+      int64_t i = 0;
+      if ((data_idx & 1) != 0 && i < count) {
+        output_ptr[output_idx] =
+            static_cast<T2>(static_cast<float>(QuantizedElem(data_ptr, data_idx) - zp_val) * scale_val);
+        ++i;
+      }
+      for (; i + 1 < count; i += 2) {
+        const auto pair = data_ptr[(data_idx + i) >> 1];
+        output_ptr[output_idx + i] =
+            static_cast<T2>(static_cast<float>(static_cast<int32_t>(pair.GetElem(0)) - zp_val) * scale_val);
+        output_ptr[output_idx + i + 1] =
+            static_cast<T2>(static_cast<float>(static_cast<int32_t>(pair.GetElem(1)) - zp_val) * scale_val);
+      }
+      if (i < count) {
+        output_ptr[output_idx + i] =
+            static_cast<T2>(static_cast<float>(QuantizedElem(data_ptr, data_idx + i) - zp_val) * scale_val);
+      }
+    } else {
+      const T1* src = data_ptr + data_idx;
+      T2* dst = output_ptr + output_idx;
+      for (int64_t i = 0; i < count; ++i) {
+        dst[i] = static_cast<T2>(static_cast<float>(static_cast<int32_t>(src[i]) - zp_val) * scale_val);
+      }
+    }
+  };
+
   auto lambda = [&](int64_t gather_MN_idx, std::unordered_map<int64_t, int64_t>& cache) {
     int64_t gather_M_idx = gather_MN_idx / gather_N;
     int64_t gather_N_idx = gather_MN_idx % gather_N;
@@ -161,32 +224,53 @@ Status GatherBlockQuantized<T1, Tind>::CopyDataAndDequantize(const T1* data_ptr,
       return;
     }
 
-    // TODO(fajin): use SIMD
-    int64_t output_idx = output_idx_base;
-    int64_t data_idx = data_idx_base;
-    for (int64_t i = 0; i < gather_block; ++i, ++output_idx, ++data_idx) {
-      auto data_val = static_cast<int32_t>(data_ptr[data_idx >> 1].GetElem(narrow<size_t>(data_idx & 1)));
-
-      int64_t x = data_idx / quantize_full_block;
-      int64_t y = data_idx % quantize_full_block / quantize_N;
-      int64_t z = data_idx % quantize_N;
-      int64_t scale_idx = x * scale_full_block + y / block_size_ * quantize_N + z;
-      auto scale_val = static_cast<float>(scales_ptr[scale_idx]);
-      auto zp_val = static_cast<int32_t>(zero_points_ptr
-                                             ? zero_points_ptr[scale_idx >> 1].GetElem(narrow<size_t>(scale_idx & 1))
-                                             : 0);
-
-      output_ptr[output_idx] = static_cast<T2>(static_cast<float>(data_val - zp_val) * scale_val);
+    if (contiguous_rows) {
+      int64_t data_idx = data_idx_base;
+      int64_t output_idx = output_idx_base;
+      int64_t remaining = gather_block;
+      while (remaining > 0) {
+        const int64_t y = data_idx % quantize_axis_dim;
+        const int64_t run = std::min({block_size_ - y % block_size_, quantize_axis_dim - y, remaining});
+        const int64_t scale_idx = data_idx / quantize_axis_dim * scale_full_block + y / block_size_;
+        const auto scale_val = static_cast<float>(scales_ptr[scale_idx]);
+        const int32_t zp_val = zero_points_ptr ? QuantizedElem(zero_points_ptr, scale_idx) : 0;
+
+        dequantize_run(data_idx, output_idx, run, scale_val, zp_val);
+
+        data_idx += run;
+        output_idx += run;
+        remaining -= run;
+      }
+    } else {
+      int64_t output_idx = output_idx_base;
+      int64_t data_idx = data_idx_base;
+      for (int64_t i = 0; i < gather_block; ++i, ++output_idx, ++data_idx) {
+        auto data_val = QuantizedElem(data_ptr, data_idx);
+
+        int64_t x = data_idx / quantize_full_block;
+        int64_t y = data_idx % quantize_full_block / quantize_N;
+        int64_t z = data_idx % quantize_N;
+        int64_t scale_idx = x * scale_full_block + y / block_size_ * quantize_N + z;
+        auto scale_val = static_cast<float>(scales_ptr[scale_idx]);
+        auto zp_val = zero_points_ptr ? QuantizedElem(zero_points_ptr, scale_idx) : 0;
+
+        output_ptr[output_idx] = static_cast<T2>(static_cast<float>(data_val - zp_val) * scale_val);
+      }
     }
 
     cache[data_idx_base] = output_idx_base;
   };
 
+  const int64_t gather_MN = SafeInt<int64_t>(gather_M) * gather_N;
+  const int64_t row_bytes = kIsPacked4Bit<T1> ? (gather_block + 1) / 2
+                                              : gather_block * static_cast<int64_t>(sizeof(T1));
+  const int64_t prefetch_bytes = std::min(row_bytes, kIndexPrefetchBytes);
+
   concurrency::ThreadPool::TryParallelFor(
       tp,
-      SafeInt<ptrdiff_t>(gather_M) * gather_N,
+      narrow<ptrdiff_t>(gather_MN),
       static_cast<double>(gather_block * 3),
-      [&lambda](ptrdiff_t first, ptrdiff_t last) {
+      [&](ptrdiff_t first, ptrdiff_t last) {
         // cache dequantized gather_block. Key is data_idx_base. Value is the output_idx_base.
         // cache is per thread to avoid contention.
         std::unordered_map<int64_t, int64_t> cache;
@@ -194,6 +278,22 @@ Status GatherBlockQuantized<T1, Tind>::CopyDataAndDequantize(const T1* data_ptr,
         for (auto index = static_cast<int64_t>(first), end = static_cast<int64_t>(last);
              index < end;
              ++index) {
+          if (const int64_t ahead = index + kIndexPrefetchAhead; ahead < gather_MN) {
+            // Resolve the index a few iterations early and touch the start of its row.
+            // Out-of-bounds values are left to the dequantize loop's error handling.
+            int64_t ahead_val = static_cast<int64_t>(indices_ptr[ahead % gather_N]);
+            ahead_val = ahead_val < 0 ? ahead_val + gather_axis_dim : ahead_val;
+            if (ahead_val >= 0 && ahead_val < gather_axis_dim) {
+              const int64_t ahead_data_idx = ahead / gather_N * data_full_block + ahead_val * gather_block;
+              const char* row = reinterpret_cast<const char*>(data_ptr) +
+                                (kIsPacked4Bit<T1> ? ahead_data_idx >> 1
+                                                   : ahead_data_idx * static_cast<int64_t>(sizeof(T1)));
+              for (int64_t pf = 0; pf < prefetch_bytes; pf += 64) {
+                PrefetchForRead(row + pf);
+              }
+            }
+          }
+
           lambda(index, cache);
         }
       });
@@ -277,6 +377,10 @@ REGISTER_GATHERBLOCKQUANTIZED(UInt4x2, int32_t);
 REGISTER_GATHERBLOCKQUANTIZED(UInt4x2, int64_t);
 REGISTER_GATHERBLOCKQUANTIZED(Int4x2, int32_t);
 REGISTER_GATHERBLOCKQUANTIZED(Int4x2, int64_t);
+REGISTER_GATHERBLOCKQUANTIZED(uint8_t, int32_t);
+REGISTER_GATHERBLOCKQUANTIZED(uint8_t, int64_t);
+REGISTER_GATHERBLOCKQUANTIZED(int8_t, int32_t);
+REGISTER_GATHERBLOCKQUANTIZED(int8_t, int64_t);
 
 }  // namespace contrib
 }  // namespace onnxruntime
@@ -32,6 +32,123 @@ constexpr size_t A = 0,
                  bias = 5;
 };
 
+// Activation fused into the op by MatMulNBitsFusion via the "activation" attribute.
+enum class ActivationKind {
+  None,
+  Relu,
+  Sigmoid,
+  Tanh,
+  Gelu,
+  FastGelu,
+  Silu,
+};
+
+ActivationKind GetActivationKind(const std::string& activation) {
+  if (activation.empty()) {
+    return ActivationKind::None;
+  }
+  if (activation == "Relu") {
+    return ActivationKind::Relu;
+  }
+  if (activation == "Sigmoid") {
+    return ActivationKind::Sigmoid;
+  }
+  if (activation == "Tanh") {
+    return ActivationKind::Tanh;
+  }
+  if (activation == "Gelu") {
+    return ActivationKind::Gelu;
+  }
+  if (activation == "FastGelu") {
+    return ActivationKind::FastGelu;
+  }
+  if (activation == "Silu") {
+    return ActivationKind::Silu;
+  }
+  ORT_THROW("Unsupported MatMulNBits activation: ", activation);
+}
+
+// Applies the fused activation to an output tile while the tile is still hot in cache.
+// MlasSQNBitGemmBatch() invokes Process() per tile, after the bias add.
+// Process() may be called concurrently from multiple threads so it must be stateless.
+class ActivationEpilogue : public MLAS_GEMM_POSTPROCESSOR<float> {
+ public:
+  explicit ActivationEpilogue(ActivationKind kind) : kind_{kind} {}
+
+  void Process(float* C, size_t RangeStartM, size_t RangeStartN,
+               size_t RangeCountM, size_t RangeCountN, size_t ldc) const override {
+    float* c_blk = C + RangeStartM * ldc + RangeStartN;
+
+    switch (kind_) {
+      case ActivationKind::Relu:
+      case ActivationKind::Sigmoid:
+      case ActivationKind::Tanh: {
+        MLAS_ACTIVATION activation;
+        activation.ActivationKind = kind_ == ActivationKind::Relu      ? MlasReluActivation
+                                    : kind_ == ActivationKind::Sigmoid ? MlasLogisticActivation
+                                                                       : MlasTanhActivation;
+        MlasActivation(&activation, c_blk, nullptr, RangeCountM, RangeCountN, ldc);
+        break;
+      }
+      case ActivationKind::Gelu:
+      case ActivationKind::FastGelu:
+      case ActivationKind::Silu: {
+        for (size_t m = 0; m < RangeCountM; ++m) {
+          ProcessRow(c_blk + m * ldc, RangeCountN);
+        }
+        break;
+      }
+      case ActivationKind::None: {
+        break;
+      }
+    }
+  }
+
+ private:
+  void ProcessRow(float* row, size_t count) const {
+    // Process in fixed size chunks so the scratch buffer can live on the stack.
+    constexpr size_t kChunkSize = 128;
+    float buffer[kChunkSize];
+
+    while (count > 0) {
+      const size_t n = std::min(count, kChunkSize);
+
+      if (kind_ == ActivationKind::Gelu) {
+        constexpr float kSqrtHalf = 0.7071067811865476f;  // 1 / sqrt(2)
+        for (size_t i = 0; i < n; ++i) {
+          buffer[i] = row[i] * kSqrtHalf;
+        }
+        MlasComputeErf(buffer, buffer, n);
+        for (size_t i = 0; i < n; ++i) {
+          row[i] = 0.5f * row[i] * (1.f + buffer[i]);
+        }
+      } else if (kind_ == ActivationKind::FastGelu) {
+        // tanh approximation matching the FastGelu contrib op
+        constexpr float kAlpha = 0.7978845608028654f;    // sqrt(2 / pi)
+        constexpr float kGamma = 0.035677408136300125f;  // kAlpha * 0.044715
+        for (size_t i = 0; i < n; ++i) {
+          const float x = row[i];
+          buffer[i] = x * (kGamma * x * x + kAlpha);
+        }
+        MlasComputeTanh(buffer, buffer, n);
+        for (size_t i = 0; i < n; ++i) {
+          row[i] = 0.5f * row[i] * (1.f + buffer[i]);
+        }
+      } else {  // ActivationKind::Silu
+        MlasComputeLogistic(row, buffer, n);
+        for (size_t i = 0; i < n; ++i) {
+          row[i] *= buffer[i];
+        }
+      }
+
+      row += n;
+      count -= n;
+    }
+  }
+
+  const ActivationKind kind_;
+};
+
 int64_t GetAccuracyLevel(size_t nbits, size_t block_size, int64_t accuracy_level_attr) {
   const auto accuracy_level = std::clamp(accuracy_level_attr,
                                          static_cast<int64_t>(CompMostAccurate),
@@ -77,6 +194,7 @@ class MatMulNBits final : public OpKernel {
         accuracy_level_{GetAccuracyLevel(nbits_, block_size_, info.GetAttr<int64_t>("accuracy_level"))},
         has_g_idx_{info.GetInputCount() > InputIndex::g_idx && info.node().InputDefs()[InputIndex::g_idx]->Exists()},
         has_bias_{info.GetInputCount() > InputIndex::bias && info.node().InputDefs()[InputIndex::bias]->Exists()},
+        activation_kind_{GetActivationKind(info.GetAttrOrDefault<std::string>("activation", ""))},
         compute_type_{static_cast<MLAS_SQNBIT_GEMM_COMPUTE_TYPE>(accuracy_level_)} {
     const auto& node = info.node();
     auto input_defs = node.InputDefs();
@@ -112,6 +230,7 @@ class MatMulNBits final : public OpKernel {
   const int64_t accuracy_level_;
   const bool has_g_idx_;
   const bool has_bias_;
+  const ActivationKind activation_kind_;
   const MLAS_SQNBIT_GEMM_COMPUTE_TYPE compute_type_;
   bool has_unquantized_zero_point_{false};
   const bool column_wise_quant_{true};
@@ -284,6 +403,8 @@ Status MatMulNBits<float>::ComputeBPacked(const Tensor* a,
     workspace = IAllocator::MakeUniquePtr<std::byte>(allocator, workspace_size, true);
   }
 
+  ActivationEpilogue activation_epilogue{activation_kind_};
+
   InlinedVector<MLAS_SQNBIT_GEMM_DATA_PARAMS> data(batch_count);
   for (size_t i = 0; i < batch_count; ++i) {
     data[i].A = a_data + helper.LeftOffsets()[i];
@@ -299,6 +420,9 @@ Status MatMulNBits<float>::ComputeBPacked(const Tensor* a,
     data[i].Bias = bias_data;
     data[i].C = y_data + helper.OutputOffsets()[i];
     data[i].ldc = N;
+    if (activation_kind_ != ActivationKind::None) {
+      data[i].PostProcessor = &activation_epilogue;
+    }
   }
   MlasSQNBitGemmBatch(M, N, K, batch_count, nbits_, block_size_, compute_type_, data.data(), workspace.get(),
                       thread_pool);
@@ -361,6 +485,8 @@ Status MatMulNBits<MLFloat16>::ComputeBPacked(const Tensor* a,
   size_t c_size = static_cast<size_t>(y->Shape().Size());
   std::vector<float> c_v(c_size);
 
+  ActivationEpilogue activation_epilogue{activation_kind_};
+
   InlinedVector<MLAS_SQNBIT_GEMM_DATA_PARAMS> data(batch_count);
   for (size_t i = 0; i < batch_count; ++i) {
     data[i].A = tmp_a_data_ptr.get() + helper.LeftOffsets()[i];
@@ -376,6 +502,9 @@ Status MatMulNBits<MLFloat16>::ComputeBPacked(const Tensor* a,
     data[i].Bias = bias ? bias_ptr : nullptr;
     data[i].C = c_v.data() + helper.OutputOffsets()[i];
     data[i].ldc = N;
+    if (activation_kind_ != ActivationKind::None) {
+      data[i].PostProcessor = &activation_epilogue;
+    }
   }
   MlasSQNBitGemmBatch(M, N, K, batch_count, nbits_, block_size_, compute_type_, data.data(), workspace.get(),
                       thread_pool);
@@ -488,6 +617,13 @@ Status MatMulNBits<float>::ComputeBUnpacked(const Tensor* a,
   MlasGemmBatch(CblasNoTrans, CblasTrans,
                 M, N, K, data.data(), batch_count, thread_pool);
 
+  if (activation_kind_ != ActivationKind::None) {
+    const ActivationEpilogue activation_epilogue{activation_kind_};
+    for (size_t i = 0; i < batch_count; ++i) {
+      activation_epilogue.Process(y_data + helper.OutputOffsets()[i], 0, 0, M, N, N);
+    }
+  }
+
   return Status::OK();
 }
 
@@ -619,6 +755,14 @@ Status MatMulNBits<MLFloat16>::ComputeBUnpacked(const Tensor* a,
   }
 
   MlasGemmBatch(CblasNoTrans, CblasTrans, M, N, K, data.data(), batch_count, thread_pool);
+
+  if (activation_kind_ != ActivationKind::None) {
+    const ActivationEpilogue activation_epilogue{activation_kind_};
+    for (size_t i = 0; i < batch_count; ++i) {
+      activation_epilogue.Process(tmp_c_ptr.get() + helper.OutputOffsets()[i], 0, 0, M, N, N);
+    }
+  }
+
   MlasConvertFloatToHalfBuffer(tmp_c_ptr.get(), y_data, c_size);
   return Status::OK();
 }
@@ -0,0 +1,131 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "contrib_ops/cpu/quantization/qlinear_layer_norm.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+#include "core/common/common.h"
+#include "core/common/narrow.h"
+#include "core/platform/threadpool.h"
+#include "core/providers/common.h"
+
+namespace onnxruntime {
+namespace contrib {
+
+QLinearLayerNorm::QLinearLayerNorm(const OpKernelInfo& info) : OpKernel(info) {
+  axis_ = info.GetAttrOrDefault<int64_t>("axis", -1);
+  epsilon_ = info.GetAttrOrDefault<float>("epsilon", 1e-5f);
+}
+
+Status QLinearLayerNorm::Compute(OpKernelContext* context) const {
+  const Tensor* X = context->Input<Tensor>(0);
+  if (X->IsDataType<uint8_t>()) {
+    return ComputeImpl<uint8_t>(context);
+  }
+  return ComputeImpl<int8_t>(context);
+}
+
+template <typename T>
+Status QLinearLayerNorm::ComputeImpl(OpKernelContext* context) const {
+  const Tensor* X = context->Input<Tensor>(0);
+  const Tensor* x_scale_tensor = context->Input<Tensor>(1);
+  const Tensor* scale = context->Input<Tensor>(3);
+  const Tensor* bias = context->Input<Tensor>(4);
+  const Tensor* y_scale_tensor = context->Input<Tensor>(5);
+  const Tensor* y_zero_point_tensor = context->Input<Tensor>(6);
+
+  ORT_RETURN_IF_NOT(IsScalarOr1ElementVector(x_scale_tensor),
+                    "QLinearLayerNormalization : input X_scale must be a scalar or 1D tensor of size 1");
+  ORT_RETURN_IF_NOT(IsScalarOr1ElementVector(y_scale_tensor),
+                    "QLinearLayerNormalization : input Y_scale must be a scalar or 1D tensor of size 1");
+  ORT_RETURN_IF_NOT(IsScalarOr1ElementVector(y_zero_point_tensor),
+                    "QLinearLayerNormalization : input Y_zero_point must be a scalar or 1D tensor of size 1");
+
+  const TensorShape& x_shape = X->Shape();
+  Tensor* Y = context->Output(0, x_shape);
+  if (x_shape.Size() == 0) {
+    return Status::OK();
+  }
+
+  const int64_t axis = HandleNegativeAxis(axis_, narrow<int64_t>(x_shape.NumDimensions()));
+  const int64_t norm_count = x_shape.SizeToDimension(narrow<size_t>(axis));
+  const int64_t norm_size = x_shape.SizeFromDimension(narrow<size_t>(axis));
+
+  ORT_RETURN_IF_NOT(scale->Shape().Size() == norm_size,
+                    "QLinearLayerNormalization : input Scale must match the normalized dimensions, expected size ",
+                    norm_size, ", got ", scale->Shape().Size());
+  ORT_RETURN_IF_NOT(bias == nullptr || bias->Shape().Size() == norm_size,
+                    "QLinearLayerNormalization : input B must match the normalized dimensions, expected size ",
+                    norm_size, ", got ", bias != nullptr ? bias->Shape().Size() : 0);
+
+  const float x_scale = *x_scale_tensor->Data<float>();
+  const float y_scale = *y_scale_tensor->Data<float>();
+  const int32_t y_zero_point = static_cast<int32_t>(*y_zero_point_tensor->Data<T>());
+
+  const T* input = X->Data<T>();
+  T* output = Y->MutableData<T>();
+  const float* gamma = scale->Data<float>();
+  const float* beta = bias != nullptr ? bias->Data<float>() : nullptr;
+
+  const size_t row_size = narrow<size_t>(norm_size);
+  const float inv_row_size = 1.0f / static_cast<float>(row_size);
+  const float inv_y_scale = 1.0f / y_scale;
+  constexpr int32_t quant_min = static_cast<int32_t>(std::numeric_limits<T>::lowest());
+  constexpr int32_t quant_max = static_cast<int32_t>(std::numeric_limits<T>::max());
+
+  concurrency::ThreadPool* thread_pool = context->GetOperatorThreadPool();
+  concurrency::ThreadPool::TryBatchParallelFor(
+      thread_pool, narrow<ptrdiff_t>(norm_count),
+      [input, output, gamma, beta, row_size, inv_row_size, x_scale, inv_y_scale,
+       y_zero_point, epsilon = epsilon_](ptrdiff_t row_idx) {
+        const T* row = input + static_cast<size_t>(row_idx) * row_size;
+        T* row_out = output + static_cast<size_t>(row_idx) * row_size;
+
+        // Accumulate the integer sum and sum of squares in a single pass. The zero point cancels
+        // in the mean subtraction, so the statistics can be taken over the raw quantized values:
+        // x - mean(x) = x_scale * (q - mean(q)) and var(x) = x_scale^2 * var(q).
+        int32_t sum = 0;
+        int64_t sum_of_squares = 0;
+        for (size_t i = 0; i < row_size; ++i) {
+          const int32_t value = static_cast<int32_t>(row[i]);
+          sum += value;
+          sum_of_squares += static_cast<int64_t>(value) * value;
+        }
+
+        const float mean = static_cast<float>(sum) * inv_row_size;
+        const float variance = std::max(
+            x_scale * x_scale * (static_cast<float>(sum_of_squares) * inv_row_size - mean * mean), 0.0f);
+        // Fold the dequantize scale and the inverse standard deviation into one multiplier.
+        const float norm_scale = x_scale / std::sqrt(variance + epsilon);
+
+        for (size_t i = 0; i < row_size; ++i) {
+          float normalized = (static_cast<float>(row[i]) - mean) * norm_scale * gamma[i];
+          if (beta != nullptr) {
+            normalized += beta[i];
+          }
+          const int32_t quantized = static_cast<int32_t>(std::nearbyintf(normalized * inv_y_scale)) + y_zero_point;
+          row_out[i] = static_cast<T>(std::min(std::max(quantized, quant_min), quant_max));
+        }
+      },
+      0);
+
+  return Status::OK();
+}
+
+ONNX_CPU_OPERATOR_MS_KERNEL(
+    QLinearLayerNormalization,
+    1,
+    KernelDefBuilder()
+        .TypeConstraint(
+            "T",
+            {DataTypeImpl::GetTensorType<uint8_t>(),
+             DataTypeImpl::GetTensorType<int8_t>()})
+        .TypeConstraint("F", DataTypeImpl::GetTensorType<float>()),
+    QLinearLayerNorm)
+
+}  // namespace contrib
+}  // namespace onnxruntime
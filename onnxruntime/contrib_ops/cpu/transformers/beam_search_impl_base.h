@@ -101,6 +101,14 @@ struct BeamSearchCpuState : IBeamSearchCpuState {
 
       size_t next_token_size = SafeInt<size_t>(batch_beam_size_) * parameters.vocab_size;
       next_token_scores = AllocateBuffer<float>(allocator, next_token_scores_buffer_, next_token_size, stream);
+    } else {
+      // The host reorder path tracks beam reorders with back pointers (token + parent per row
+      // per step) instead of copying every row's prefix each step.
+      size_t back_pointers_size = SafeInt<size_t>(2) * batch_beam_size_ *
+                                  (parameters.max_length - parameters.sequence_length);
+      gsl::span<int32_t> back_pointers =
+          AllocateBuffer<int32_t>(allocator, back_pointers_buffer_, back_pointers_size, stream);
+      sequences.InitBackPointers(back_pointers);
     }
   }
 
@@ -135,6 +143,7 @@ struct BeamSearchCpuState : IBeamSearchCpuState {
   IAllocatorUniquePtr<void> topk_indices_buffer_;
   IAllocatorUniquePtr<void> sequences_space_buffer_;
   IAllocatorUniquePtr<void> next_token_scores_buffer_;
+  IAllocatorUniquePtr<void> back_pointers_buffer_;
 };
 
 // Base class of beam search implementation that is common for GPT-2, T5, and Whisper.
@@ -19,9 +19,11 @@ namespace contrib {
 namespace transformers {
 using ::onnxruntime::rnn::detail::Allocate;
 
-void BeamHypotheses::Init(float length_penalty, gsl::span<HypothesisScore> beams) {
+void BeamHypotheses::Init(float length_penalty, gsl::span<HypothesisScore> beams, gsl::span<int32_t> hypothesis_pool) {
   beams_ = beams;
   beams_used_ = 0;
+  hypothesis_pool_ = hypothesis_pool;
+  slot_capacity_ = narrow<int>(hypothesis_pool.size() / beams.size());
   length_penalty_ = length_penalty;
   done_ = false;
 }
@@ -31,18 +33,28 @@ void BeamHypotheses::Add(gsl::span<const int32_t>& hypothesis, float sum_logprob
   float score = sum_logprobs / pow(static_cast<float>(length), length_penalty_);
 
   size_t index = beams_used_;
+  size_t slot_offset;
   // If the array is full, don't add unless it's better than the worst element
   if (index == beams_.size()) {
     if (score <= beams_[--index].score)
       return;
-  } else
+    // The evicted worst hypothesis frees its pool slot for the new one. Kept hypotheses always
+    // point at the start of their slot, so the offset is already slot aligned.
+    slot_offset = static_cast<size_t>(beams_[index].hypothesis.data() - hypothesis_pool_.data());
+  } else {
+    slot_offset = index * static_cast<size_t>(slot_capacity_);
     beams_used_++;
+  }
+
+  // Copy the tokens into the pool; the input span typically points at a live sequence buffer.
+  gsl::span<int32_t> slot = hypothesis_pool_.subspan(slot_offset, length);
+  gsl::copy(hypothesis, slot);
 
   // Rotate existing elements over while the new element scores higher
   for (; index > 0 && score > beams_[index - 1].score; index--)
     beams_[index] = beams_[index - 1];
 
-  beams_[index] = HypothesisScore{hypothesis, score};
+  beams_[index] = HypothesisScore{slot, score};
 }
 
 bool BeamHypotheses::CanImprove(float best_sum_logprobs, int current_length) const {
@@ -84,18 +96,18 @@ BeamSearchScorer::BeamSearchScorer(const IGenerationParameters& parameters,
       not_done_count_{parameters.batch_size} {
   size_t batch_beam_size = batch_size_ * num_beams_;
 
+  size_t batch_pool_size = num_beams_ * max_length_;
+  hypothesis_buffer_ = Allocate<int32_t>(allocator, batch_beam_size * max_length_, hypothesis_buffer_ptr_);
+
   auto beams = Allocate<HypothesisScore>(allocator, batch_beam_size, hypothesis_scores_ptr_);
   beam_hyps_ = Allocate<BeamHypotheses>(allocator, batch_size_, beam_hyps_ptr_);
   for (size_t i = 0; i < batch_size_; i++)
-    beam_hyps_[i].Init(parameters.length_penalty, beams.subspan(i * num_beams_, num_beams_));
+    beam_hyps_[i].Init(parameters.length_penalty, beams.subspan(i * num_beams_, num_beams_),
+                       hypothesis_buffer_.subspan(i * batch_pool_size, batch_pool_size));
 
   next_beam_scores_ = Allocate<float>(allocator, batch_beam_size, next_beam_scores_ptr_);
   next_beam_tokens_ = Allocate<int32_t>(allocator, batch_beam_size, next_beam_tokens_ptr_);
   next_beam_indices_ = Allocate<int32_t>(allocator, batch_beam_size, next_beam_indices_ptr_);
-
-  // Space to store intermediate sequence with length sequence_length, sequence_length + 1, ..., max_sequence_length.
-  size_t per_beam = (SafeInt<size_t>(max_length_) * (max_length_ + 1) - (parameters.sequence_length - 1) * parameters.sequence_length) / 2;
-  hypothesis_buffer_ = Allocate<int32_t>(allocator, batch_beam_size * per_beam, hypothesis_buffer_ptr_);
 }
 
 void BeamSearchScorer::Process(ISequences& sequences,
@@ -142,14 +154,9 @@ void BeamSearchScorer::Process(ISequences& sequences,
           continue;
         }
 
-        // Clone the sequence and append to buffer.
+        // Add copies the sequence into the hypotheses' pool slot.
         gsl::span<const int32_t> src = sequences.GetSequence(batch_beam_idx);
-        auto clone = hypothesis_buffer_.subspan(static_cast<size_t>(hypothesis_buffer_used_), sequence_length);
-
-        gsl::copy(src, clone);
-        hypothesis_buffer_used_ += sequence_length;
-        auto sequence = ReinterpretAsSpan<const int32_t>(clone);
-        beam_hyp.Add(sequence, next_score);
+        beam_hyp.Add(src, next_score);
       } else {
         // Add next predicted token since it is not eos_token.
         next_beam_scores_[batch * num_beams_ + beam_idx] = next_score;
@@ -164,7 +171,6 @@ void BeamSearchScorer::Process(ISequences& sequences,
     }
 
     ORT_ENFORCE(beam_idx == num_beams_);
-    ORT_ENFORCE(static_cast<size_t>(hypothesis_buffer_used_) <= hypothesis_buffer_.size());
 
     //  Check if we are done so that we can save a pad step if all(done)
     if (static_cast<size_t>(beam_hyp.beams_used_) < num_beams_)
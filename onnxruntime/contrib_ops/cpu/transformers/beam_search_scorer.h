@@ -26,9 +26,12 @@ struct HypothesisScore {
 
 struct BeamHypotheses {
   // As these are constructed as an uninitialized array of memory, we need an Init method
-  void Init(float length_penalty, gsl::span<HypothesisScore> beams);
+  // hypothesis_pool provides beams.size() fixed slots of max_length tokens each; every kept
+  // hypothesis owns one slot and an evicted hypothesis hands its slot to its replacement.
+  void Init(float length_penalty, gsl::span<HypothesisScore> beams, gsl::span<int32_t> hypothesis_pool);
 
-  // Add a new hypothesis
+  // Add a new hypothesis. The tokens are copied into this hypotheses' pool, so the span may
+  // point at a live sequence buffer that later steps overwrite.
   void Add(gsl::span<const int32_t>& hypothesis, float sum_logprobs);
 
   // Return true if this beats the worst score in the hypothesis
@@ -43,6 +46,8 @@ struct BeamHypotheses {
 
   gsl::span<HypothesisScore> beams_;  // Beam width sized array of hypotheses, sorted by highest scoring
   int beams_used_;                    // Number of elements used in beams_
+  gsl::span<int32_t> hypothesis_pool_;  // beams_.size() slots of slot_capacity_ tokens each
+  int slot_capacity_;                   // Tokens per pool slot (max sequence length)
   float length_penalty_;
   bool done_;
 };
@@ -87,9 +92,10 @@ struct BeamSearchScorer : IBeamScorer {
   IAllocatorUniquePtr<int32_t> next_beam_indices_ptr_;
   gsl::span<int32_t> next_beam_indices_;
 
-  IAllocatorUniquePtr<int32_t> hypothesis_buffer_ptr_;  // Allocated buffer to hold all hypotheses
-  gsl::span<int32_t> hypothesis_buffer_;                // Span of the allocated buffer
-  int hypothesis_buffer_used_{};                        // Offset of available buffer, or length of used buffer.
+  // Fixed pool backing the kept hypotheses: one max_length_ slot per beam per batch. It no
+  // longer grows with the number of end-of-sequence candidates seen during the search.
+  IAllocatorUniquePtr<int32_t> hypothesis_buffer_ptr_;
+  gsl::span<int32_t> hypothesis_buffer_;
 
   IAllocatorUniquePtr<HypothesisScore> hypothesis_scores_ptr_;  // num_beams_ * batch_size_, divided into num_beams_ chunks per BeamHypothesis in beam_hyps_
   IAllocatorUniquePtr<BeamHypotheses> beam_hyps_ptr_;
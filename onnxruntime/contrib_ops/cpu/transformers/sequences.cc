@@ -27,11 +27,49 @@ void Sequences::InitDevice(gsl::span<int32_t> buffer) {
   device_sequences[1] = buffer.subspan(buffer.size() / 2);
 }
 
+void Sequences::InitBackPointers(gsl::span<int32_t> buffer) {
+  size_t steps_size = buffer.size() / 2;
+  assert(steps_size == SafeInt<size_t>(batch_beam_size_) * (max_length_ - current_length_));
+
+  tokens_by_step_ = buffer.subspan(0, steps_size);
+  parents_by_step_ = buffer.subspan(steps_size);
+
+  use_back_pointers_ = true;
+  init_length_ = current_length_;
+
+  // Every row starts as just the prompt, which the caller writes straight into sequences[0]
+  // before stepping, so the rows are considered current at the initial length.
+  materialized_length_.assign(static_cast<size_t>(batch_beam_size_), current_length_);
+}
+
 gsl::span<const int32_t> Sequences::GetSequence(int beam_index) const {
+  if (use_back_pointers_) {
+    Materialize(beam_index);
+  }
   gsl::span<const int32_t> buffer = sequences[current_sequences_buffer];
   return buffer.subspan(SafeInt<size_t>(beam_index) * max_length_, static_cast<gsl::index>(current_length_));
 }
 
+void Sequences::Materialize(int beam_index) const {
+  if (materialized_length_[beam_index] == current_length_) {
+    return;
+  }
+
+  // Walk the back pointers from the newest step towards the prompt, filling the row back to
+  // front. The prompt positions [0, init_length_) never need rewriting: the parent chain stays
+  // within one batch entry, and all beams of a batch share the same prompt.
+  gsl::span<int32_t> row = sequences[0].subspan(SafeInt<size_t>(beam_index) * max_length_,
+                                               static_cast<gsl::index>(max_length_));
+  int parent = beam_index;
+  for (int position = current_length_ - 1; position >= init_length_; --position) {
+    const size_t step = SafeInt<size_t>(position - init_length_) * batch_beam_size_;
+    row[position] = tokens_by_step_[step + parent];
+    parent = parents_by_step_[step + parent];
+  }
+
+  materialized_length_[beam_index] = current_length_;
+}
+
 int Sequences::GetSequenceLength() const {
   return current_length_;
 }
@@ -49,6 +87,17 @@ void Sequences::PrintSequences(const IConsoleDumper* dumper) const {
 void Sequences::AppendNextTokenToSequences(
     gsl::span<int32_t>& beam_indices,
     gsl::span<int32_t>& beam_next_tokens) {
+  if (use_back_pointers_) {
+    // Record token and parent per row; rows are materialized lazily when somebody reads them.
+    const size_t step = SafeInt<size_t>(current_length_ - init_length_) * batch_beam_size_;
+    for (int i = 0; i < batch_beam_size_; i++) {
+      tokens_by_step_[step + i] = beam_next_tokens[i];
+      parents_by_step_[step + i] = beam_indices[i];
+    }
+    ++current_length_;
+    return;
+  }
+
   gsl::span<const int32_t> input = sequences[current_sequences_buffer];
   gsl::span<int32_t> output = sequences[current_sequences_buffer ^ 1];
 
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <gsl/gsl>
+#include "core/common/inlined_containers.h"
 #include "contrib_ops/cpu/transformers/generation_shared.h"
 
 namespace onnxruntime {
@@ -17,6 +18,13 @@ class Sequences : public ISequences {
   void Init(gsl::span<int32_t> buffer, int batch_beam_size, int sequence_length, int max_length);
   void InitDevice(gsl::span<int32_t> buffer);
 
+  // Switch the host reorder path (AppendNextTokenToSequences with beam indices) to back pointer
+  // bookkeeping: each step only records the chosen token and parent beam per row instead of
+  // copying every row's whole prefix, and GetSequence materializes a row on demand by walking
+  // the back pointers. The buffer holds 2 * batch_beam_size * (max_length - sequence_length)
+  // elements (token and parent per row per generated step).
+  void InitBackPointers(gsl::span<int32_t> buffer);
+
   // Returns a sequence of word IDs for a given beam index ( beam_index < batch_beam_size).
   gsl::span<const int32_t> GetSequence(int beam_index) const override;
   gsl::span<const int32_t> GetCurrentDeviceSequences() const override { return device_sequences[current_sequences_buffer]; }
@@ -41,9 +49,14 @@ class Sequences : public ISequences {
   void AfterDeviceAppendedNextToken();
 
  private:
+  // Rebuild the row for beam_index in sequences[0] from the back pointers if it is stale.
+  // Logically const: it only refreshes a cache of state that is already committed.
+  void Materialize(int beam_index) const;
+
   // Two buffers of shape (batch_size, num_beams, max_seq_length) to store sequences.
   // At each time, there is only one buffer is active. The other one will be active in next token.
   // Each AppendNextTokenToSequences call will trigger a rotation of active buffer.
+  // In back pointer mode only sequences[0] is used, as a per-row materialization cache.
   gsl::span<int32_t> sequences[2];
   gsl::span<int32_t> device_sequences[2];
 
@@ -53,6 +66,16 @@ class Sequences : public ISequences {
   int batch_beam_size_;
   int max_length_;
   int current_length_;
+
+  // Back pointer mode state. Both spans have shape (max_length - init_length, batch_beam_size):
+  // tokens_by_step_ holds the token appended to each row at a step, parents_by_step_ the row it
+  // was continued from. materialized_length_[i] is the current_length_ at which row i of
+  // sequences[0] was last rebuilt; any other value means the row is stale.
+  bool use_back_pointers_{false};
+  int init_length_{0};
+  gsl::span<int32_t> tokens_by_step_;
+  gsl::span<int32_t> parents_by_step_;
+  mutable InlinedVector<int> materialized_length_;
 };
 
 }  // namespace transformers
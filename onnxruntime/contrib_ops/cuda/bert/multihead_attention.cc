@@ -151,139 +151,201 @@ Status MultiHeadAttention<T>::ComputeInternal(OpKernelContext* context) const {
 
   AttentionKernelType kernel_type = AttentionKernelType::AttentionKernel_Default;
 
-#if USE_FLASH_ATTENTION
-  bool use_flash_attention = !disable_flash_attention_ &&
-                             nullptr == attention_bias &&
-                             nullptr == key_padding_mask &&
-                             parameters.head_size == parameters.v_head_size &&
-                             onnxruntime::flash::is_supported(device_prop,
-                                                              parameters.head_size,
-                                                              parameters.num_heads,
-                                                              parameters.num_heads);
-  // When input is packed QKV format, TensorRT kernel might be faster than flash attention when sequence length <= 512.
-  if (use_flash_attention && parameters.qkv_format == AttentionQkvFormat::QKV_BS3NH &&
-      parameters.sequence_length < kernel_options_->MinSeqLenForFlashAttentionPackedQkv()) {
-    use_flash_attention = false;
-  }
-  // Allocate buffers
+  bool use_flash_attention = false;
+  bool use_cudnn_sdpa = false;
+  bool use_fused_cross_attention = false;
+  bool use_fused_runner = false;
+  bool use_memory_efficient_attention = false;
   size_t softmax_lse_accum_bytes = 0;
   size_t out_accum_bytes = 0;
-  if (use_flash_attention) {
-    using namespace std;
-    auto [num_splits, slse_accum_bytes, o_accum_bytes] = onnxruntime::flash::get_num_splits_and_buffer_sizes(
-        parameters.batch_size, parameters.sequence_length, parameters.total_sequence_length, parameters.num_heads,
-        parameters.head_size, device_prop.multiProcessorCount);
-    parameters.num_splits = static_cast<int>(num_splits);
-    softmax_lse_accum_bytes = slse_accum_bytes;
-    out_accum_bytes = o_accum_bytes;
-    kernel_type = AttentionKernelType::AttentionKernel_FlashAttention;
-  }
-  auto softmax_lse_accum_buffer = GetScratchBuffer<void>(softmax_lse_accum_bytes, context->GetComputeStream());
-  auto out_accum_buffer = GetScratchBuffer<void>(out_accum_bytes, context->GetComputeStream());
-#else
-  constexpr bool use_flash_attention = false;
-  auto softmax_lse_accum_buffer = GetScratchBuffer<void>(0, context->GetComputeStream());  // nullptr
-  auto out_accum_buffer = GetScratchBuffer<void>(0, context->GetComputeStream());          // nullptr
-#endif
 
-  bool is_mask_none_or_1d_k_len = parameters.mask_type == AttentionMaskType::MASK_NONE ||
-                                  parameters.mask_type == AttentionMaskType::MASK_1D_KEY_SEQ_LEN;
-  bool use_cudnn_sdpa = kernel_type == AttentionKernelType::AttentionKernel_Default &&
-                        enable_cudnn_flash_attention_ &&
-                        is_mask_none_or_1d_k_len &&
-                        onnxruntime::cudnn_sdpa::is_supported(device_prop,
-                                                              parameters.num_heads,              // num_heads_q
-                                                              parameters.num_heads,              // num_heads_kv
-                                                              parameters.head_size,              // head_size_qk
-                                                              parameters.v_head_size,            // head_size_v
-                                                              parameters.sequence_length,        // seq_len_q
-                                                              parameters.total_sequence_length,  // seq_len_kv
-                                                              is_unidirectional_);
-  if (use_cudnn_sdpa) {
-    kernel_type = AttentionKernelType::AttentionKernel_CudnnFlashAttention;
+  // The support checks below only depend on the input configuration captured in the key
+  // (and on attributes and build flags that never change), so when consecutive runs share the
+  // same configuration we reuse the previous decision instead of probing each kernel again.
+  const AttentionDispatchKey dispatch_key{parameters.batch_size,
+                                          parameters.sequence_length,
+                                          parameters.kv_sequence_length,
+                                          parameters.total_sequence_length,
+                                          parameters.head_size,
+                                          parameters.v_head_size,
+                                          parameters.mask_type,
+                                          parameters.qkv_format,
+                                          bias != nullptr,
+                                          key_padding_mask != nullptr,
+                                          attention_bias != nullptr,
+                                          past_key != nullptr,
+                                          present_key != nullptr};
+
+  std::optional<AttentionDispatchDecision> cached_decision;
+  {
+    std::lock_guard<std::mutex> lock(dispatch_decision_mutex_);
+    if (dispatch_decision_cache_.has_value() && dispatch_decision_cache_->key == dispatch_key) {
+      cached_decision = dispatch_decision_cache_;
+    }
   }
 
-  bool use_fused_cross_attention =
-      kernel_type == AttentionKernelType::AttentionKernel_Default &&
-      !disable_fused_cross_attention_ &&
-      !is_unidirectional_ &&
-      nullptr == key_padding_mask &&
-      nullptr == attention_bias &&
-      nullptr == past_key && nullptr == present_key &&
-      (parameters.qkv_format == Q_K_V_BSNH || (parameters.qkv_format == Q_KV_BSNH_BSN2H && bias == nullptr)) &&
-      parameters.hidden_size == parameters.v_hidden_size &&
-      has_fused_cross_attention_kernel(sm, parameters.head_size, parameters.kv_sequence_length);
-  if (use_fused_cross_attention) {
-    if (fused_fp16_cross_attention_kernel_ == nullptr) {
-      std::call_once(fused_cross_init_once_flag_, [&]() {
-        fused_fp16_cross_attention_kernel_ = get_fused_cross_attention_kernels(sm);
-      });
+  if (cached_decision.has_value()) {
+    kernel_type = cached_decision->kernel_type;
+    use_flash_attention = cached_decision->use_flash_attention;
+    use_cudnn_sdpa = cached_decision->use_cudnn_flash_attention;
+    use_fused_cross_attention = cached_decision->use_fused_cross_attention;
+    use_fused_runner = cached_decision->use_fused_runner;
+    use_memory_efficient_attention = cached_decision->use_memory_efficient_attention;
+    parameters.num_splits = cached_decision->num_splits;
+    softmax_lse_accum_bytes = cached_decision->softmax_lse_accum_bytes;
+    out_accum_bytes = cached_decision->out_accum_bytes;
+
+    // the fused kernels below were created/loaded when the decision was first made.
+    if (use_fused_cross_attention) {
+      fused_cross_attention_kernel = fused_fp16_cross_attention_kernel_;
     }
 
-    // In case some kernel not loaded due to shared memory limit, we need to double check here.
-    // The kernel has no limit on sequence length, and this checks whether the kernel has been loaded.
-    if (fused_fp16_cross_attention_kernel_->isValid(sequence_length)) {
-      fused_cross_attention_kernel = fused_fp16_cross_attention_kernel_;
-      kernel_type = AttentionKernelType::AttentionKernel_TrtFusedCrossAttention;
+    if (use_fused_runner) {
+      fused_runner = fused_fp16_runner_.get();
     }
-  }
+  } else {
+#if USE_FLASH_ATTENTION
+    use_flash_attention = !disable_flash_attention_ &&
+                          nullptr == attention_bias &&
+                          nullptr == key_padding_mask &&
+                          parameters.head_size == parameters.v_head_size &&
+                          onnxruntime::flash::is_supported(device_prop,
+                                                           parameters.head_size,
+                                                           parameters.num_heads,
+                                                           parameters.num_heads);
+    // When input is packed QKV format, TensorRT kernel might be faster than flash attention when sequence length <= 512.
+    if (use_flash_attention && parameters.qkv_format == AttentionQkvFormat::QKV_BS3NH &&
+        parameters.sequence_length < kernel_options_->MinSeqLenForFlashAttentionPackedQkv()) {
+      use_flash_attention = false;
+    }
+    if (use_flash_attention) {
+      using namespace std;
+      auto [num_splits, slse_accum_bytes, o_accum_bytes] = onnxruntime::flash::get_num_splits_and_buffer_sizes(
+          parameters.batch_size, parameters.sequence_length, parameters.total_sequence_length, parameters.num_heads,
+          parameters.head_size, device_prop.multiProcessorCount);
+      parameters.num_splits = static_cast<int>(num_splits);
+      softmax_lse_accum_bytes = slse_accum_bytes;
+      out_accum_bytes = o_accum_bytes;
+      kernel_type = AttentionKernelType::AttentionKernel_FlashAttention;
+    }
+#endif
 
-  bool use_fused_runner =
-      kernel_type == AttentionKernelType::AttentionKernel_Default &&
-      !disable_fused_self_attention_ &&
-      !is_unidirectional_ &&
-      nullptr == attention_bias &&
-      (parameters.qkv_format == Q_K_V_BSNH || parameters.qkv_format == QKV_BSN3H) &&
-      nullptr == past_key && nullptr == present_key &&
-      is_mask_none_or_1d_k_len &&
-      parameters.hidden_size == parameters.v_hidden_size &&
-      parameters.sequence_length == parameters.kv_sequence_length &&  // self attention only for fused runner
-      FusedMHARunnerFP16v2::IsSupported(sm, parameters.head_size, sequence_length,
-                                        enable_trt_flash_attention_, is_unidirectional_);
-  if (use_fused_runner) {
-    // Here we assume that num_heads and head_size does not change for a MultiHeadAttention node.
-    if (nullptr == fused_fp16_runner_.get()) {
-      std::call_once(fused_fp16_runner_created_, [&]() {
-        fused_fp16_runner_ = FusedMHARunnerFP16v2::Create(num_heads_, parameters.head_size, sm, is_unidirectional_,
-                                                          enable_trt_flash_attention_, parameters.scale);
-      });
+    bool is_mask_none_or_1d_k_len = parameters.mask_type == AttentionMaskType::MASK_NONE ||
+                                    parameters.mask_type == AttentionMaskType::MASK_1D_KEY_SEQ_LEN;
+    use_cudnn_sdpa = kernel_type == AttentionKernelType::AttentionKernel_Default &&
+                     enable_cudnn_flash_attention_ &&
+                     is_mask_none_or_1d_k_len &&
+                     onnxruntime::cudnn_sdpa::is_supported(device_prop,
+                                                           parameters.num_heads,              // num_heads_q
+                                                           parameters.num_heads,              // num_heads_kv
+                                                           parameters.head_size,              // head_size_qk
+                                                           parameters.v_head_size,            // head_size_v
+                                                           parameters.sequence_length,        // seq_len_q
+                                                           parameters.total_sequence_length,  // seq_len_kv
+                                                           is_unidirectional_);
+    if (use_cudnn_sdpa) {
+      kernel_type = AttentionKernelType::AttentionKernel_CudnnFlashAttention;
     }
 
-    // In case some kernel not loaded due to shared memory limit, we need to double check here.
-    const int normalized_seq_len = fused_fp16_runner_->NormalizeSequenceLength(sequence_length);
-    if (fused_fp16_runner_->IsValid(normalized_seq_len)) {
-      fused_runner = fused_fp16_runner_.get();
-      // could also be AttentionKernel_TrtFlashAttention, but we don't classify it here.
-      kernel_type = AttentionKernelType::AttentionKernel_TrtFusedAttention;
+    use_fused_cross_attention =
+        kernel_type == AttentionKernelType::AttentionKernel_Default &&
+        !disable_fused_cross_attention_ &&
+        !is_unidirectional_ &&
+        nullptr == key_padding_mask &&
+        nullptr == attention_bias &&
+        nullptr == past_key && nullptr == present_key &&
+        (parameters.qkv_format == Q_K_V_BSNH || (parameters.qkv_format == Q_KV_BSNH_BSN2H && bias == nullptr)) &&
+        parameters.hidden_size == parameters.v_hidden_size &&
+        has_fused_cross_attention_kernel(sm, parameters.head_size, parameters.kv_sequence_length);
+    if (use_fused_cross_attention) {
+      if (fused_fp16_cross_attention_kernel_ == nullptr) {
+        std::call_once(fused_cross_init_once_flag_, [&]() {
+          fused_fp16_cross_attention_kernel_ = get_fused_cross_attention_kernels(sm);
+        });
+      }
+
+      // In case some kernel not loaded due to shared memory limit, we need to double check here.
+      // The kernel has no limit on sequence length, and this checks whether the kernel has been loaded.
+      if (fused_fp16_cross_attention_kernel_->isValid(sequence_length)) {
+        fused_cross_attention_kernel = fused_fp16_cross_attention_kernel_;
+        kernel_type = AttentionKernelType::AttentionKernel_TrtFusedCrossAttention;
+      }
+
+      use_fused_cross_attention = fused_cross_attention_kernel != nullptr;
+    }
+
+    use_fused_runner =
+        kernel_type == AttentionKernelType::AttentionKernel_Default &&
+        !disable_fused_self_attention_ &&
+        !is_unidirectional_ &&
+        nullptr == attention_bias &&
+        (parameters.qkv_format == Q_K_V_BSNH || parameters.qkv_format == QKV_BSN3H) &&
+        nullptr == past_key && nullptr == present_key &&
+        is_mask_none_or_1d_k_len &&
+        parameters.hidden_size == parameters.v_hidden_size &&
+        parameters.sequence_length == parameters.kv_sequence_length &&  // self attention only for fused runner
+        FusedMHARunnerFP16v2::IsSupported(sm, parameters.head_size, sequence_length,
+                                          enable_trt_flash_attention_, is_unidirectional_);
+    if (use_fused_runner) {
+      // Here we assume that num_heads and head_size does not change for a MultiHeadAttention node.
+      if (nullptr == fused_fp16_runner_.get()) {
+        std::call_once(fused_fp16_runner_created_, [&]() {
+          fused_fp16_runner_ = FusedMHARunnerFP16v2::Create(num_heads_, parameters.head_size, sm, is_unidirectional_,
+                                                            enable_trt_flash_attention_, parameters.scale);
+        });
+      }
+
+      // In case some kernel not loaded due to shared memory limit, we need to double check here.
+      const int normalized_seq_len = fused_fp16_runner_->NormalizeSequenceLength(sequence_length);
+      if (fused_fp16_runner_->IsValid(normalized_seq_len)) {
+        fused_runner = fused_fp16_runner_.get();
+        // could also be AttentionKernel_TrtFlashAttention, but we don't classify it here.
+        kernel_type = AttentionKernelType::AttentionKernel_TrtFusedAttention;
+      }
+
+      use_fused_runner = fused_runner != nullptr;
     }
-  }
 
 #if USE_MEMORY_EFFICIENT_ATTENTION
-  int length_threshold = this->kernel_options_->MinSeqLenForEfficientAttentionFp32();
-  bool is_long_sequence = std::is_same<T, MLFloat16>::value ||  // sequence length threshold is 0 for FP16
-                          parameters.sequence_length >= length_threshold ||
-                          parameters.kv_sequence_length >= length_threshold;
-
-  bool use_memory_efficient_attention =
-      kernel_type == AttentionKernelType::AttentionKernel_Default &&
-      !disable_memory_efficient_attention_ &&
-      is_long_sequence &&
-      // Check whether the attention bias alignment is good for memory efficient attention.
-      (attention_bias == nullptr || parameters.sequence_length % (4 * sizeof(T)) == 0) &&
-      (nullptr == key_padding_mask || parameters.mask_type == AttentionMaskType::MASK_1D_KEY_SEQ_LEN_START) &&
-      has_memory_efficient_attention(sm, std::is_same<T, MLFloat16>::value,
-                                     parameters.head_size, parameters.v_head_size);
-  if (use_memory_efficient_attention) {
-    kernel_type = AttentionKernelType::AttentionKernel_CutlassMemoryEfficientAttention;
-  }
-#else
-  constexpr bool use_memory_efficient_attention = false;
+    int length_threshold = this->kernel_options_->MinSeqLenForEfficientAttentionFp32();
+    bool is_long_sequence = std::is_same<T, MLFloat16>::value ||  // sequence length threshold is 0 for FP16
+                            parameters.sequence_length >= length_threshold ||
+                            parameters.kv_sequence_length >= length_threshold;
+
+    use_memory_efficient_attention =
+        kernel_type == AttentionKernelType::AttentionKernel_Default &&
+        !disable_memory_efficient_attention_ &&
+        is_long_sequence &&
+        // Check whether the attention bias alignment is good for memory efficient attention.
+        (attention_bias == nullptr || parameters.sequence_length % (4 * sizeof(T)) == 0) &&
+        (nullptr == key_padding_mask || parameters.mask_type == AttentionMaskType::MASK_1D_KEY_SEQ_LEN_START) &&
+        has_memory_efficient_attention(sm, std::is_same<T, MLFloat16>::value,
+                                       parameters.head_size, parameters.v_head_size);
+    if (use_memory_efficient_attention) {
+      kernel_type = AttentionKernelType::AttentionKernel_CutlassMemoryEfficientAttention;
+    }
 #endif
 
-  if (kernel_type == AttentionKernelType::AttentionKernel_Default) {
-    kernel_type = AttentionKernelType::AttentionKernel_Unfused;
+    if (kernel_type == AttentionKernelType::AttentionKernel_Default) {
+      kernel_type = AttentionKernelType::AttentionKernel_Unfused;
+    }
+
+    std::lock_guard<std::mutex> lock(dispatch_decision_mutex_);
+    dispatch_decision_cache_ = AttentionDispatchDecision{dispatch_key,
+                                                         kernel_type,
+                                                         use_flash_attention,
+                                                         use_cudnn_sdpa,
+                                                         use_fused_cross_attention,
+                                                         use_fused_runner,
+                                                         use_memory_efficient_attention,
+                                                         use_flash_attention ? parameters.num_splits : 0,
+                                                         softmax_lse_accum_bytes,
+                                                         out_accum_bytes};
   }
 
+  auto softmax_lse_accum_buffer = GetScratchBuffer<void>(softmax_lse_accum_bytes, context->GetComputeStream());
+  auto out_accum_buffer = GetScratchBuffer<void>(out_accum_bytes, context->GetComputeStream());
+
   typedef typename ToCudaType<T>::MappedType CudaT;
   AttentionData<CudaT> data;
   data.bias = (nullptr == bias) ? nullptr : reinterpret_cast<const CudaT*>(bias->Data<T>());
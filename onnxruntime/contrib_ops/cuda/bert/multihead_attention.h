@@ -5,7 +5,9 @@
 
 #include <memory>
 #include <mutex>
+#include <optional>
 #include "core/providers/cuda/cuda_kernel.h"
+#include "contrib_ops/cpu/bert/attention_common.h"
 #include "contrib_ops/cuda/bert/tensorrt_fused_multihead_attention/mha_runner.h"
 #include "contrib_ops/cuda/bert/tensorrt_fused_multihead_attention/cross_attention/fmha_cross_attention.h"
 #include "contrib_ops/cuda/bert/attention_impl.h"
@@ -17,6 +19,56 @@ namespace cuda {
 
 using namespace onnxruntime::cuda;
 
+// The kernel dispatch decision only depends on these fields (the attributes and build flags that
+// also feed into it never change after the kernel is constructed), so when consecutive runs share
+// the same configuration we can reuse the previous decision instead of re-probing kernel support.
+struct AttentionDispatchKey {
+  int batch_size;
+  int sequence_length;
+  int kv_sequence_length;
+  int total_sequence_length;
+  int head_size;
+  int v_head_size;
+  AttentionMaskType mask_type;
+  AttentionQkvFormat qkv_format;
+  bool has_bias;
+  bool has_key_padding_mask;
+  bool has_attention_bias;
+  bool has_past_key;
+  bool has_present_key;
+
+  bool operator==(const AttentionDispatchKey& other) const {
+    return batch_size == other.batch_size &&
+           sequence_length == other.sequence_length &&
+           kv_sequence_length == other.kv_sequence_length &&
+           total_sequence_length == other.total_sequence_length &&
+           head_size == other.head_size &&
+           v_head_size == other.v_head_size &&
+           mask_type == other.mask_type &&
+           qkv_format == other.qkv_format &&
+           has_bias == other.has_bias &&
+           has_key_padding_mask == other.has_key_padding_mask &&
+           has_attention_bias == other.has_attention_bias &&
+           has_past_key == other.has_past_key &&
+           has_present_key == other.has_present_key;
+  }
+};
+
+// Dispatch decision for one input configuration, including the per-shape values derived while
+// making it (flash attention split count and accumulation buffer sizes).
+struct AttentionDispatchDecision {
+  AttentionDispatchKey key;
+  AttentionKernelType kernel_type;
+  bool use_flash_attention;
+  bool use_cudnn_flash_attention;
+  bool use_fused_cross_attention;
+  bool use_fused_runner;
+  bool use_memory_efficient_attention;
+  int num_splits;
+  size_t softmax_lse_accum_bytes;
+  size_t out_accum_bytes;
+};
+
 template <typename T>
 class MultiHeadAttention final : public CudaKernel {
  public:
@@ -44,6 +96,11 @@ class MultiHeadAttention final : public CudaKernel {
   mutable CumulatedSequenceLengthCache cumulated_sequence_length_q_cache_;
   mutable CumulatedSequenceLengthCache cumulated_sequence_length_kv_cache_;
 
+  // Cache of the last kernel dispatch decision. Guarded by a mutex since the decision is
+  // re-validated and overwritten whenever the input configuration changes.
+  mutable std::optional<AttentionDispatchDecision> dispatch_decision_cache_;
+  mutable std::mutex dispatch_decision_mutex_;
+
   const AttentionKernelOptions* kernel_options_;
 };
 
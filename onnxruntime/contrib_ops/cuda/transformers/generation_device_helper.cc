@@ -633,6 +633,11 @@ struct CudaBeamSearchScorer : transformers::IBeamScorer {
   bool IsDone() const override { return false; }  // For CUDA we speculatively run the next step while we wait for the GPU to report status. We use 'IsDoneLater()' for this
   bool IsDoneLater() const override;
 
+  // How many generation steps may run between blocking termination checks. In between, the
+  // scorer state is only inspected when the GPU has already published it (non blocking event
+  // query), so the host does not stall on every step.
+  static constexpr int kTerminationCheckInterval = 8;
+
   gsl::span<float> GetNextScores() override { return next_beam_scores_; }
   gsl::span<int32_t> GetNextTokens() override { return next_beam_tokens_; }
   gsl::span<int32_t> GetNextIndicesCPU() override {
@@ -666,6 +671,8 @@ struct CudaBeamSearchScorer : transformers::IBeamScorer {
   IAllocatorUniquePtr<cuda::HypothesisScore> hypothesis_scores_ptr_;  // num_beams_ * batch_size_, divided into num_beams_ chunks per BeamHypothesis in beam_hyps_
   IAllocatorUniquePtr<cuda::BeamHypotheses> beam_hyps_ptr_;
   gsl::span<cuda::BeamHypotheses> beam_hyps_;  // Shape is batch_size_
+
+  mutable int steps_since_termination_check_{0};
 };
 
 template <typename TAlloc>
@@ -748,7 +755,24 @@ void CudaBeamSearchScorer::Process(transformers::ISequences& sequences,
 }
 
 bool CudaBeamSearchScorer::IsDoneLater() const {
-  CUDA_CALL_THROW(cudaEventSynchronize(event_process_complete_.Get()));
+  // Scoring, top-k selection and beam reordering all stay on device; the only host involvement
+  // per step is this termination check. Blocking on the event every step stalls the host while
+  // the GPU catches up, so on most steps we only peek at the event: if the GPU has already
+  // passed it, the pinned scorer state is valid and can be read for free, otherwise we let the
+  // next (speculative) step proceed. A blocking sync still happens every
+  // kTerminationCheckInterval steps so completion is detected within a bounded number of
+  // wasted steps.
+  if (++steps_since_termination_check_ < kTerminationCheckInterval) {
+    cudaError_t status = cudaEventQuery(event_process_complete_.Get());
+    if (status == cudaErrorNotReady) {
+      return false;
+    }
+    CUDA_CALL_THROW(status);
+  } else {
+    CUDA_CALL_THROW(cudaEventSynchronize(event_process_complete_.Get()));
+  }
+
+  steps_since_termination_check_ = 0;
   return state_cpu_->not_done_count_ == 0;
 }
 
@@ -31,6 +31,7 @@ namespace rocm {
       kRocmExecutionProvider,                                          \
       (*KernelDefBuilder::Create())                                    \
           .TypeConstraint("T", DataTypeImpl::GetTensorType<T>())       \
+          .TypeConstraint("T_cache", DataTypeImpl::GetTensorType<T>()) \
           .TypeConstraint("M", DataTypeImpl::GetTensorType<int32_t>()) \
           .MayInplace(3, 1)                                            \
           .MayInplace(4, 2)                                            \
@@ -160,6 +161,11 @@ Status GroupQueryAttention<T>::ComputeInternal(OpKernelContext* ctx) const {
   const Tensor* cos_cache = ctx->Input<Tensor>(7);
   const Tensor* sin_cache = ctx->Input<Tensor>(8);
 
+  if (ctx->Input<Tensor>(9) != nullptr) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, NOT_IMPLEMENTED,
+                           "Paged KV cache (block_table) is not implemented for ROCm in GroupQueryAttention.");
+  }
+
   auto& device_prop = GetDeviceProp();
   std::call_once(
       arch_checking_,
@@ -195,8 +201,14 @@ Status GroupQueryAttention<T>::ComputeInternal(OpKernelContext* ctx) const {
                                                                 total_seqlen,
                                                                 is_past_bsnh_,
                                                                 scale_,
+                                                                /*kv_cache_quant_type*/ 0,
                                                                 max_thr_per_blk));
 
+  if (parameters.is_subsequent_prompt && parameters.batch_size != 1) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "batch_size must be 1 when sequence_length > 1 and past context is given.");
+  }
+
   const int batch_size = parameters.batch_size;
   const int sequence_length = parameters.sequence_length;
   const int kv_sequence_length = parameters.sequence_length;
@@ -26,6 +26,10 @@
 #define HWCAP2_I8MM (1 << 13)
 #endif
 
+#ifndef HWCAP_SVE
+#define HWCAP_SVE (1 << 22)
+#endif
+
 #ifndef HWCAP2_SVEI8MM
 #define HWCAP2_SVEI8MM (1 << 9)
 #endif
@@ -34,6 +38,14 @@
 #define HWCAP2_BF16 (1 << 14)
 #endif
 
+#ifndef HWCAP2_SME
+#define HWCAP2_SME (1 << 23)
+#endif
+
+#ifndef HWCAP2_SME2
+#define HWCAP2_SME2 (1UL << 37)
+#endif
+
 #endif  // ARM
 
 #endif  // Linux
@@ -117,6 +129,7 @@ void CPUIDInfo::X86Init() {
       bool has_sse2 = (data[3] & (1 << 26));
       has_sse3_ = (data[2] & 0x1);
       has_sse4_1_ = (data[2] & (1 << 19));
+      has_sse4_2_ = (data[2] & (1 << 20));
       bool has_ssse3 = (data[2] & (1 << 9));
       has_avx_ = has_sse2 && has_ssse3 && (data[2] & (1 << 28)) && ((value & AVX_MASK) == AVX_MASK);
       bool has_avx512 = (value & AVX512_MASK) == AVX512_MASK;
@@ -155,6 +168,7 @@ void CPUIDInfo::ArmLinuxInit() {
     has_arm_neon_dot_ = cpuinfo_has_arm_neon_dot();
     has_fp16_ = cpuinfo_has_arm_neon_fp16_arith();
     has_arm_neon_i8mm_ = cpuinfo_has_arm_i8mm();
+    has_arm_sve_ = cpuinfo_has_arm_sve();
     has_arm_sve_i8mm_ = cpuinfo_has_arm_sve() && cpuinfo_has_arm_i8mm();
     has_arm_neon_bf16_ = cpuinfo_has_arm_neon_bf16();
 
@@ -185,10 +199,15 @@ void CPUIDInfo::ArmLinuxInit() {
     has_fp16_ |= has_arm_neon_dot_;
 
     has_arm_neon_i8mm_ = ((getauxval(AT_HWCAP2) & HWCAP2_I8MM) != 0);
+    has_arm_sve_ = ((getauxval(AT_HWCAP) & HWCAP_SVE) != 0);
     has_arm_sve_i8mm_ = ((getauxval(AT_HWCAP2) & HWCAP2_SVEI8MM) != 0);
 
     has_arm_neon_bf16_ = ((getauxval(AT_HWCAP2) & HWCAP2_BF16) != 0);
   }
+
+  // cpuinfo has no SME query yet, so read the capability bits directly in both branches.
+  has_arm_sme_ = ((getauxval(AT_HWCAP2) & HWCAP2_SME) != 0);
+  has_arm_sme2_ = ((getauxval(AT_HWCAP2) & HWCAP2_SME2) != 0);
 }
 
 #elif defined(_WIN32)  // ^ defined(__linux__)
@@ -255,6 +274,7 @@ void CPUIDInfo::ArmWindowsInit() {
   if (pytorch_cpuinfo_init_) {
     has_fp16_ = cpuinfo_has_arm_neon_fp16_arith();
     has_arm_neon_i8mm_ = cpuinfo_has_arm_i8mm();
+    has_arm_sve_ = cpuinfo_has_arm_sve();
     has_arm_sve_i8mm_ = cpuinfo_has_arm_sve() && cpuinfo_has_arm_i8mm();
     has_arm_neon_bf16_ = cpuinfo_has_arm_neon_bf16();
   } else
@@ -262,6 +282,7 @@ void CPUIDInfo::ArmWindowsInit() {
   {
     has_fp16_ = false;
     has_arm_neon_i8mm_ = false;
+    has_arm_sve_ = false;
     has_arm_sve_i8mm_ = false;
     has_arm_neon_bf16_ = false;
   }
@@ -276,6 +297,7 @@ void CPUIDInfo::ArmAppleInit() {
     has_arm_neon_dot_ = cpuinfo_has_arm_neon_dot();
     has_fp16_ = cpuinfo_has_arm_neon_fp16_arith();
     has_arm_neon_i8mm_ = cpuinfo_has_arm_i8mm();
+    has_arm_sve_ = cpuinfo_has_arm_sve();
     has_arm_sve_i8mm_ = cpuinfo_has_arm_sve() && cpuinfo_has_arm_i8mm();
     has_arm_neon_bf16_ = cpuinfo_has_arm_neon_bf16();
 
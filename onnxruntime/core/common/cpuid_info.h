@@ -24,13 +24,17 @@ class CPUIDInfo {
   bool HasF16C() const { return has_f16c_; } /*fp16 conversion inst*/
   bool HasSSE3() const { return has_sse3_; }
   bool HasSSE4_1() const { return has_sse4_1_; }
+  bool HasSSE4_2() const { return has_sse4_2_; }
   bool IsHybrid() const { return is_hybrid_; }
 
   // ARM
   bool HasArmNeonDot() const { return has_arm_neon_dot_; }
   bool HasArmNeon_I8MM() const { return has_arm_neon_i8mm_; }
+  bool HasArmSVE() const { return has_arm_sve_; }
   bool HasArmSVE_I8MM() const { return has_arm_sve_i8mm_; }
   bool HasArmNeon_BF16() const { return has_arm_neon_bf16_; }
+  bool HasArmSME() const { return has_arm_sme_; }
+  bool HasArmSME2() const { return has_arm_sme2_; }
 
   uint32_t GetCurrentCoreIdx() const;
 
@@ -103,6 +107,7 @@ class CPUIDInfo {
   bool has_f16c_{false};
   bool has_sse3_{false};
   bool has_sse4_1_{false};
+  bool has_sse4_2_{false};
   bool is_hybrid_{false};
 
   std::vector<uint32_t> core_uarchs_;  // micro-arch of each core
@@ -115,8 +120,11 @@ class CPUIDInfo {
   bool has_arm_neon_dot_{false};
   bool has_fp16_{false};
   bool has_arm_neon_i8mm_{false};
+  bool has_arm_sve_{false};
   bool has_arm_sve_i8mm_{false};
   bool has_arm_neon_bf16_{false};
+  bool has_arm_sme_{false};
+  bool has_arm_sme2_{false};
 
 #if defined(CPUIDINFO_ARCH_X86)
 
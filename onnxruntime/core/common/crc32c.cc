@@ -0,0 +1,126 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/common/crc32c.h"
+
+#include <cstring>
+
+#include "core/common/cpuid_info.h"
+
+#if defined(_M_X64) || defined(__x86_64__)
+#include <nmmintrin.h>
+#define CRC32C_X64_HARDWARE 1
+#elif defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#define CRC32C_ARM_HARDWARE 1
+#endif
+
+namespace onnxruntime {
+
+namespace {
+
+// Slicing-by-8 software fallback. The tables are generated once on first use.
+struct Crc32cTables {
+  uint32_t table[8][256];
+
+  Crc32cTables() {
+    constexpr uint32_t kPolynomial = 0x82F63B78;  // reflected 0x1EDC6F41
+    for (uint32_t i = 0; i < 256; ++i) {
+      uint32_t crc = i;
+      for (int j = 0; j < 8; ++j) {
+        crc = (crc >> 1) ^ ((crc & 1) ? kPolynomial : 0);
+      }
+      table[0][i] = crc;
+    }
+    for (uint32_t i = 0; i < 256; ++i) {
+      for (int slice = 1; slice < 8; ++slice) {
+        table[slice][i] = (table[slice - 1][i] >> 8) ^ table[0][table[slice - 1][i] & 0xFF];
+      }
+    }
+  }
+};
+
+uint32_t Crc32cSoftware(const uint8_t* p, size_t size, uint32_t crc) {
+  static const Crc32cTables tables;
+  const auto& t = tables.table;
+
+  while (size >= 8) {
+    uint64_t word;
+    std::memcpy(&word, p, sizeof(word));
+    word ^= crc;
+    crc = t[7][word & 0xFF] ^
+          t[6][(word >> 8) & 0xFF] ^
+          t[5][(word >> 16) & 0xFF] ^
+          t[4][(word >> 24) & 0xFF] ^
+          t[3][(word >> 32) & 0xFF] ^
+          t[2][(word >> 40) & 0xFF] ^
+          t[1][(word >> 48) & 0xFF] ^
+          t[0][word >> 56];
+    p += 8;
+    size -= 8;
+  }
+  while (size > 0) {
+    crc = (crc >> 8) ^ t[0][(crc ^ *p) & 0xFF];
+    ++p;
+    --size;
+  }
+  return crc;
+}
+
+#if defined(CRC32C_X64_HARDWARE)
+#if defined(__GNUC__) || defined(__clang__)
+__attribute__((target("sse4.2")))
+#endif
+uint32_t
+Crc32cHardware(const uint8_t* p, size_t size, uint32_t crc) {
+  uint64_t crc64 = crc;
+  while (size >= 8) {
+    uint64_t word;
+    std::memcpy(&word, p, sizeof(word));
+    crc64 = _mm_crc32_u64(crc64, word);
+    p += 8;
+    size -= 8;
+  }
+  crc = static_cast<uint32_t>(crc64);
+  while (size > 0) {
+    crc = _mm_crc32_u8(crc, *p);
+    ++p;
+    --size;
+  }
+  return crc;
+}
+#elif defined(CRC32C_ARM_HARDWARE)
+uint32_t Crc32cHardware(const uint8_t* p, size_t size, uint32_t crc) {
+  while (size >= 8) {
+    uint64_t word;
+    std::memcpy(&word, p, sizeof(word));
+    crc = __crc32cd(crc, word);
+    p += 8;
+    size -= 8;
+  }
+  while (size > 0) {
+    crc = __crc32cb(crc, *p);
+    ++p;
+    --size;
+  }
+  return crc;
+}
+#endif
+
+}  // namespace
+
+uint32_t ComputeCrc32c(const void* data, size_t size) {
+  const auto* p = static_cast<const uint8_t*>(data);
+  uint32_t crc = 0xFFFFFFFF;
+#if defined(CRC32C_X64_HARDWARE)
+  static const bool has_sse4_2 = CPUIDInfo::GetCPUIDInfo().HasSSE4_2();
+  crc = has_sse4_2 ? Crc32cHardware(p, size, crc) : Crc32cSoftware(p, size, crc);
+#elif defined(CRC32C_ARM_HARDWARE)
+  crc = Crc32cHardware(p, size, crc);
+#else
+  crc = Crc32cSoftware(p, size, crc);
+#endif
+  return crc ^ 0xFFFFFFFF;
+}
+
+}  // namespace onnxruntime
@@ -0,0 +1,18 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace onnxruntime {
+
+/// <summary>
+/// Computes the CRC32C (Castagnoli, polynomial 0x1EDC6F41) checksum of a byte range.
+/// Uses the SSE4.2 crc32 instruction when the CPU supports it (or the ARM CRC32
+/// extension when the build targets it) and a table-driven implementation otherwise.
+/// </summary>
+uint32_t ComputeCrc32c(const void* data, size_t size);
+
+}  // namespace onnxruntime
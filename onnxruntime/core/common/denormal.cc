@@ -42,4 +42,25 @@ bool SetDenormalAsZero(bool on) {
   return false;
 }
 
+ScopedDenormalAsZero::ScopedDenormalAsZero(bool on) {
+#ifdef DENORMAL_INTRINC
+  if (CPUIDInfo::GetCPUIDInfo().HasSSE3()) {
+    previous_denormals_zero_mode_ = _MM_GET_DENORMALS_ZERO_MODE();
+    previous_flush_zero_mode_ = _MM_GET_FLUSH_ZERO_MODE();
+    active_ = SetDenormalAsZero(on);
+  }
+#else
+  ORT_UNUSED_PARAMETER(on);
+#endif
+}
+
+ScopedDenormalAsZero::~ScopedDenormalAsZero() {
+#ifdef DENORMAL_INTRINC
+  if (active_) {
+    _MM_SET_DENORMALS_ZERO_MODE(previous_denormals_zero_mode_);
+    _MM_SET_FLUSH_ZERO_MODE(previous_flush_zero_mode_);
+  }
+#endif
+}
+
 }  // namespace onnxruntime
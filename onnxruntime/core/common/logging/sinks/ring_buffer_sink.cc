@@ -0,0 +1,198 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/common/logging/sinks/ring_buffer_sink.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#include "core/common/logging/capture.h"
+
+namespace onnxruntime {
+namespace logging {
+
+namespace {
+
+template <size_t N>
+void CopyTruncate(char (&dst)[N], const char* src) {
+  std::strncpy(dst, src, N - 1);
+  dst[N - 1] = '\0';
+}
+
+}  // namespace
+
+// a fixed-size structured log record. filling one in never allocates; oversized fields are
+// truncated to their slot
+struct RingBufferSink::Entry {
+  Timestamp timestamp;
+  Severity severity;
+  logging::DataType data_type;
+  int line;
+  char logger_id[64];
+  char category[32];
+  char file[192];
+  char function[96];
+  char message[512];
+};
+
+// single producer (the owning thread) / single consumer (the drain thread) ring.
+// 'head' is the next slot the producer writes, 'tail' the next slot the consumer reads.
+struct RingBufferSink::ThreadRing {
+  explicit ThreadRing(size_t capacity) : entries(capacity) {}
+
+  std::vector<Entry> entries;
+  std::atomic<uint64_t> head{0};
+  std::atomic<uint64_t> tail{0};
+  std::atomic<uint64_t> dropped{0};
+  // set when the owning thread exits; the drain loop unregisters the ring once it is empty
+  std::atomic<bool> retired{false};
+};
+
+namespace {
+
+// rings this thread has registered, keyed by sink id. destroyed on thread exit, which retires
+// the rings so the drain loop can forward any remaining records and then drop them.
+struct ThreadRings {
+  std::vector<std::pair<uint64_t, std::shared_ptr<RingBufferSink::ThreadRing>>> rings;
+
+  ~ThreadRings() {
+    for (auto& entry : rings) {
+      entry.second->retired.store(true, std::memory_order_release);
+    }
+  }
+};
+
+thread_local ThreadRings thread_rings;
+
+size_t RoundUpToPowerOfTwo(size_t value) {
+  size_t result = 1;
+  while (result < value) {
+    result <<= 1;
+  }
+  return result;
+}
+
+}  // namespace
+
+RingBufferSink::RingBufferSink(std::unique_ptr<ISink> downstream,
+                               size_t entries_per_thread,
+                               std::chrono::milliseconds poll_interval)
+    : sink_id_([] {
+        static std::atomic<uint64_t> next_sink_id{1};
+        return next_sink_id.fetch_add(1);
+      }()),
+      capacity_(RoundUpToPowerOfTwo(entries_per_thread)),
+      poll_interval_(poll_interval),
+      downstream_(std::move(downstream)),
+      drain_thread_([this] { DrainLoop(); }) {
+}
+
+RingBufferSink::~RingBufferSink() {
+  {
+    std::lock_guard<OrtMutex> lock(wake_mutex_);
+    stop_.store(true, std::memory_order_release);
+  }
+  wake_cv_.notify_all();
+  drain_thread_.join();
+  DrainOnce();  // anything logged between the last drain and thread exit
+}
+
+RingBufferSink::ThreadRing& RingBufferSink::RingForThisThread() {
+  for (auto& entry : thread_rings.rings) {
+    if (entry.first == sink_id_) {
+      return *entry.second;
+    }
+  }
+
+  auto ring = std::make_shared<ThreadRing>(capacity_);
+  {
+    std::lock_guard<OrtMutex> lock(rings_mutex_);
+    rings_.push_back(ring);
+  }
+
+  thread_rings.rings.emplace_back(sink_id_, ring);
+  return *ring;
+}
+
+void RingBufferSink::SendImpl(const Timestamp& timestamp, const std::string& logger_id,
+                              const Capture& message) {
+  ThreadRing& ring = RingForThisThread();
+
+  const uint64_t head = ring.head.load(std::memory_order_relaxed);
+  if (head - ring.tail.load(std::memory_order_acquire) >= capacity_) {
+    ring.dropped.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+
+  Entry& entry = ring.entries[head & (capacity_ - 1)];
+  entry.timestamp = timestamp;
+  entry.severity = message.Severity();
+  entry.data_type = message.DataType();
+  entry.line = message.Location().line_num;
+  CopyTruncate(entry.logger_id, logger_id.c_str());
+  CopyTruncate(entry.category, message.Category());
+  CopyTruncate(entry.file, message.Location().file_and_path.c_str());
+  CopyTruncate(entry.function, message.Location().function.c_str());
+  CopyTruncate(entry.message, message.Message().c_str());
+
+  ring.head.store(head + 1, std::memory_order_release);
+}
+
+size_t RingBufferSink::DrainOnce() {
+  std::vector<std::shared_ptr<ThreadRing>> rings;
+  {
+    std::lock_guard<OrtMutex> lock(rings_mutex_);
+    rings = rings_;
+  }
+
+  size_t forwarded = 0;
+  for (const auto& ring : rings) {
+    uint64_t tail = ring->tail.load(std::memory_order_relaxed);
+    const uint64_t head = ring->head.load(std::memory_order_acquire);
+
+    for (; tail != head; ++tail) {
+      const Entry& entry = ring->entries[tail & (capacity_ - 1)];
+
+      Capture capture{entry.severity, entry.category, entry.data_type,
+                      CodeLocation{entry.file, entry.line, entry.function}};
+      capture.Stream() << entry.message;
+      downstream_->Send(entry.timestamp, entry.logger_id, capture);
+      ++forwarded;
+    }
+
+    ring->tail.store(tail, std::memory_order_release);
+
+    // now that the ring has room again, report anything the producer had to drop
+    const uint64_t dropped = ring->dropped.exchange(0, std::memory_order_relaxed);
+    if (dropped > 0) {
+      Capture capture{Severity::kWARNING, Category::onnxruntime, DataType::SYSTEM, ORT_WHERE};
+      capture.Stream() << "RingBufferSink dropped " << dropped << " log message(s) on an overfull ring";
+      downstream_->Send(std::chrono::system_clock::now(), "logging", capture);
+    }
+
+    if (ring->retired.load(std::memory_order_acquire) &&
+        ring->tail.load(std::memory_order_relaxed) == ring->head.load(std::memory_order_acquire)) {
+      std::lock_guard<OrtMutex> lock(rings_mutex_);
+      rings_.erase(std::remove(rings_.begin(), rings_.end(), ring), rings_.end());
+    }
+  }
+
+  return forwarded;
+}
+
+void RingBufferSink::DrainLoop() {
+  while (!stop_.load(std::memory_order_acquire)) {
+    if (DrainOnce() == 0) {
+      // re-check stop_ under the mutex so a concurrent destructor cannot slip its
+      // notification in between the check and the wait
+      std::unique_lock<OrtMutex> lock(wake_mutex_);
+      if (!stop_.load(std::memory_order_acquire)) {
+        wake_cv_.wait_for(lock, poll_interval_);
+      }
+    }
+  }
+}
+
+}  // namespace logging
+}  // namespace onnxruntime
@@ -0,0 +1,74 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "core/common/logging/isink.h"
+#include "core/platform/ort_mutex.h"
+
+namespace onnxruntime {
+namespace logging {
+
+/// <summary>
+/// An ISink decorator that makes the logging hot path wait-free.
+///
+/// Each logging thread writes fixed-size structured records (severity, category, location,
+/// message text) into its own single-producer ring buffer without taking any lock or
+/// allocating; a background thread drains the rings and forwards the records to the wrapped
+/// sink, which does the formatting and I/O. If a thread outruns the drain thread its ring
+/// fills up and further records are dropped (and counted; a warning with the drop count is
+/// forwarded once the ring has room again) rather than blocking the logging thread.
+///
+/// Intended to wrap the sink given to the LoggingManager when verbose logging must stay
+/// enabled in production. Records are forwarded with their original capture timestamps but
+/// with a short delay, and field values longer than the fixed record slots are truncated.
+/// </summary>
+/// <seealso cref="ISink" />
+class RingBufferSink : public ISink {
+ public:
+  /// @param downstream The sink that drained records are forwarded to.
+  /// @param entries_per_thread Ring capacity per logging thread; rounded up to a power of two.
+  /// @param poll_interval How long the drain thread sleeps when all rings are empty.
+  explicit RingBufferSink(std::unique_ptr<ISink> downstream,
+                          size_t entries_per_thread = 1024,
+                          std::chrono::milliseconds poll_interval = std::chrono::milliseconds{2});
+
+  /// Stops the drain thread after forwarding all buffered records.
+  ~RingBufferSink() override;
+
+  // implementation details, defined in the .cc. public so the thread local ring registry
+  // (an implementation detail of the .cc as well) can reference them.
+  struct Entry;
+  struct ThreadRing;
+
+ private:
+  void SendImpl(const Timestamp& timestamp, const std::string& logger_id, const Capture& message) override;
+
+  ThreadRing& RingForThisThread();
+  void DrainLoop();
+  // forwards everything currently buffered; returns the number of records forwarded
+  size_t DrainOnce();
+
+  const uint64_t sink_id_;  // distinguishes sink instances in thread local ring lookups
+  const size_t capacity_;   // power of two
+  const std::chrono::milliseconds poll_interval_;
+  std::unique_ptr<ISink> downstream_;
+
+  OrtMutex rings_mutex_;  // guards 'rings_'; taken by a thread's first log and by the drain loop
+  std::vector<std::shared_ptr<ThreadRing>> rings_;
+
+  // wakes the drain thread early on destruction instead of waiting out poll_interval_
+  OrtMutex wake_mutex_;
+  OrtCondVar wake_cv_;
+  std::atomic<bool> stop_{false};
+  std::thread drain_thread_;
+};
+
+}  // namespace logging
+}  // namespace onnxruntime
@@ -9,14 +9,54 @@ using namespace std::chrono;
 
 std::atomic<size_t> Profiler::global_max_num_events_{1000 * 1000};
 
+// Pending events are handed to the drain thread once this many have queued up; a timed wait in
+// DrainLoop bounds the latency for traces produced at a lower rate.
+constexpr size_t kDrainBatchSize = 256;
+
+// suffix sequential_executor appends to per-node kernel events; stripped when folding stacks so
+// the .folded file holds plain node names.
+constexpr const char kKernelTimeSuffix[] = "_kernel_time";
+constexpr size_t kKernelTimeSuffixLen = sizeof(kKernelTimeSuffix) - 1;
+
+// One frame stack per thread. ExecuteSubgraph runs a subgraph's kernels on the thread that
+// invoked the parent control flow kernel, so the stack a thread sees when it records an event
+// is exactly the chain of control flow parents of that event.
+static thread_local std::vector<std::string> profile_frame_stack;
+
+ScopedProfileFrame::ScopedProfileFrame(const std::string& parent_name, int64_t iteration) {
+  profile_frame_stack.push_back(MakeString(parent_name, "#", iteration));
+}
+
+ScopedProfileFrame::ScopedProfileFrame(std::string label) {
+  profile_frame_stack.push_back(std::move(label));
+}
+
+ScopedProfileFrame::~ScopedProfileFrame() {
+  profile_frame_stack.pop_back();
+}
+
+std::string ScopedProfileFrame::CurrentStack() {
+  std::string stack;
+  for (const auto& frame : profile_frame_stack) {
+    if (!stack.empty()) {
+      stack += ';';
+    }
+    stack += frame;
+  }
+  return stack;
+}
+
 #ifdef ENABLE_STATIC_PROFILER_INSTANCE
 Profiler* Profiler::instance_ = nullptr;
 
 profiling::Profiler::~Profiler() {
+  StopDrainThread();
   instance_ = nullptr;
 }
 #else
-profiling::Profiler::~Profiler() {}
+profiling::Profiler::~Profiler() {
+  StopDrainThread();
+}
 #endif
 
 ::onnxruntime::TimePoint profiling::Profiler::Start() {
@@ -60,10 +100,20 @@ void Profiler::StartProfiling(const std::basic_string<T>& file_name) {
   profile_stream_.open(file_name, std::ios::out | std::ios::trunc);
 #endif
   profile_stream_file_ = ToUTF8String(file_name);
+  profile_stream_ << "[\n";
+  any_event_written_ = false;
   profiling_start_time_ = std::chrono::high_resolution_clock::now();
   for (const auto& ep_profiler : ep_profilers_) {
     ep_profiler->StartProfiling(profiling_start_time_);
   }
+#if !defined(__wasm__)
+  // Serialize records on a background thread as they are produced instead of holding the whole
+  // trace in memory and paying one large serialization stall in EndProfiling. The trace file is
+  // valid chrome tracing output the moment each batch is flushed, so long-running processes can
+  // be observed mid-session (modulo the missing closing bracket).
+  drain_stop_ = false;
+  drain_thread_ = std::thread([this]() { DrainLoop(); });
+#endif
 }
 
 template void Profiler::StartProfiling<char>(const std::basic_string<char>& file_name);
@@ -75,26 +125,43 @@ void Profiler::EndTimeAndRecordEvent(EventCategory category,
                                      const std::string& event_name,
                                      const TimePoint& start_time,
                                      const std::initializer_list<std::pair<std::string, std::string>>& event_args,
+                                     bool sync_gpu) {
+  EndTimeAndRecordEvent(category, event_name, start_time,
+                        std::unordered_map<std::string, std::string>{event_args.begin(), event_args.end()},
+                        sync_gpu);
+}
+
+void Profiler::EndTimeAndRecordEvent(EventCategory category,
+                                     const std::string& event_name,
+                                     const TimePoint& start_time,
+                                     std::unordered_map<std::string, std::string>&& event_args,
                                      bool /*sync_gpu*/) {
   long long dur = TimeDiffMicroSeconds(start_time);
   long long ts = TimeDiffMicroSeconds(profiling_start_time_, start_time);
 
   EventRecord event(category, logging::GetProcessId(),
-                    logging::GetThreadId(), event_name, ts, dur, {event_args.begin(), event_args.end()});
+                    logging::GetThreadId(), event_name, ts, dur, std::move(event_args));
   if (profile_with_logger_) {
     custom_logger_->SendProfileEvent(event);
   } else {
     // TODO: sync_gpu if needed.
-    std::lock_guard<OrtMutex> lock(mutex_);
-    if (events_.size() < max_num_events_) {
-      events_.emplace_back(std::move(event));
-    } else {
-      if (session_logger_ && !max_events_reached) {
-        LOGS(*session_logger_, ERROR)
-            << "Maximum number of events reached, could not record profile event.";
-        max_events_reached = true;
+    bool wake_drain_thread = false;
+    {
+      std::lock_guard<OrtMutex> lock(mutex_);
+      if (events_.size() < max_num_events_) {
+        events_.emplace_back(std::move(event));
+        wake_drain_thread = events_.size() >= kDrainBatchSize;
+      } else {
+        if (session_logger_ && !max_events_reached) {
+          LOGS(*session_logger_, ERROR)
+              << "Maximum number of events reached, could not record profile event.";
+          max_events_reached = true;
+        }
       }
     }
+    if (wake_drain_thread) {
+      drain_cv_.notify_one();
+    }
   }
 
   for (const auto& ep_profiler : ep_profilers_) {
@@ -102,28 +169,41 @@ void Profiler::EndTimeAndRecordEvent(EventCategory category,
   }
 }
 
-std::string Profiler::EndProfiling() {
-  if (!enabled_) {
-    return std::string();
-  }
-  if (profile_with_logger_) {
-    profile_with_logger_ = false;
-    return std::string();
+void Profiler::DrainLoop() {
+  std::unique_lock<OrtMutex> lock(mutex_);
+  while (!drain_stop_) {
+    if (events_.empty()) {
+      // the timed wait bounds how stale the file can get when events trickle in slowly
+      drain_cv_.wait_for(lock, std::chrono::milliseconds(100));
+    }
+    if (events_.empty()) {
+      continue;
+    }
+    Events batch;
+    batch.swap(events_);
+    lock.unlock();
+    WriteEvents(batch);
+    lock.lock();
   }
+}
 
-  if (session_logger_) {
-    LOGS(*session_logger_, INFO) << "Writing profiler data to file " << profile_stream_file_;
+void Profiler::StopDrainThread() {
+  {
+    std::lock_guard<OrtMutex> lock(mutex_);
+    drain_stop_ = true;
   }
-
-  std::lock_guard<OrtMutex> lock(mutex_);
-  profile_stream_ << "[\n";
-
-  for (const auto& ep_profiler : ep_profilers_) {
-    ep_profiler->EndProfiling(profiling_start_time_, events_);
+  drain_cv_.notify_one();
+  if (drain_thread_.joinable()) {
+    drain_thread_.join();
   }
+}
 
-  for (size_t i = 0; i < events_.size(); ++i) {
-    auto& rec = events_[i];
+void Profiler::WriteEvents(const Events& batch) {
+  for (const auto& rec : batch) {
+    if (any_event_written_) {
+      profile_stream_ << ",\n";
+    }
+    any_event_written_ = true;
     profile_stream_ << R"({"cat" : ")" << event_category_names_[rec.cat] << "\",";
     profile_stream_ << "\"pid\" :" << rec.pid << ",";
     profile_stream_ << "\"tid\" :" << rec.tid << ",";
@@ -133,7 +213,7 @@ std::string Profiler::EndProfiling() {
     profile_stream_ << R"("name" :")" << rec.name << "\",";
     profile_stream_ << "\"args\" : {";
     bool is_first_arg = true;
-    for (std::pair<std::string, std::string> event_arg : rec.args) {
+    for (const std::pair<std::string, std::string>& event_arg : rec.args) {
       if (!is_first_arg) profile_stream_ << ",";
       if (!event_arg.second.empty() && (event_arg.second[0] == '{' || event_arg.second[0] == '[')) {
         profile_stream_ << "\"" << event_arg.first << "\" : " << event_arg.second << "";
@@ -142,14 +222,70 @@ std::string Profiler::EndProfiling() {
       }
       is_first_arg = false;
     }
-    profile_stream_ << "}";
-    if (i == events_.size() - 1) {
-      profile_stream_ << "}\n";
-    } else {
-      profile_stream_ << "},\n";
-    }
+    profile_stream_ << "}}";
+    AccumulateFoldedStack(rec);
+  }
+  profile_stream_.flush();
+}
+
+void Profiler::AccumulateFoldedStack(const EventRecord& rec) {
+  if (rec.cat != NODE_EVENT ||
+      rec.name.size() <= kKernelTimeSuffixLen ||
+      rec.name.compare(rec.name.size() - kKernelTimeSuffixLen, kKernelTimeSuffixLen,
+                       kKernelTimeSuffix) != 0) {
+    return;
+  }
+
+  std::string key;
+  auto stack_arg = rec.args.find("stack");
+  if (stack_arg != rec.args.end() && !stack_arg->second.empty()) {
+    key = stack_arg->second + ';';
   }
-  profile_stream_ << "]\n";
+  key.append(rec.name, 0, rec.name.size() - kKernelTimeSuffixLen);
+
+  folded_stacks_[key] += rec.dur;
+}
+
+void Profiler::WriteFoldedStacks() {
+#if !defined(__wasm__)
+  if (folded_stacks_.empty() || profile_stream_file_.empty()) {
+    return;
+  }
+
+  std::ofstream folded_stream(profile_stream_file_ + ".folded", std::ios::out | std::ios::trunc);
+  for (const auto& entry : folded_stacks_) {
+    folded_stream << entry.first << " " << entry.second << "\n";
+  }
+#endif
+}
+
+std::string Profiler::EndProfiling() {
+  if (!enabled_) {
+    return std::string();
+  }
+  if (profile_with_logger_) {
+    profile_with_logger_ = false;
+    return std::string();
+  }
+
+  if (session_logger_) {
+    LOGS(*session_logger_, INFO) << "Writing profiler data to file " << profile_stream_file_;
+  }
+
+  StopDrainThread();
+
+  // the drain thread is gone, so it is safe to serialize on this thread under the lock
+  std::lock_guard<OrtMutex> lock(mutex_);
+  for (const auto& ep_profiler : ep_profilers_) {
+    ep_profiler->EndProfiling(profiling_start_time_, events_);
+  }
+  WriteEvents(events_);
+  events_.clear();
+
+  WriteFoldedStacks();
+  folded_stacks_.clear();
+
+  profile_stream_ << "\n]\n";
 #if !defined(__wasm__)
   profile_stream_.close();
 #endif
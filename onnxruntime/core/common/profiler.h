@@ -7,6 +7,8 @@
 #include <fstream>
 #include <initializer_list>
 #include <iostream>
+#include <map>
+#include <thread>
 #include <tuple>
 
 #include "core/common/profiler_common.h"
@@ -80,6 +82,16 @@ class Profiler {
                              const std::initializer_list<std::pair<std::string, std::string>>& event_args = {},
                              bool sync_gpu = false);
 
+  /*
+  Overload for callers that assemble event args at runtime, e.g. to append
+  optional entries to a fixed set.
+  */
+  void EndTimeAndRecordEvent(EventCategory category,
+                             const std::string& event_name,
+                             const TimePoint& start_time,
+                             std::unordered_map<std::string, std::string>&& event_args,
+                             bool sync_gpu = false);
+
   /*
   Write profile data to the given stream in chrome format defined below.
   https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU/preview#
@@ -122,6 +134,35 @@ class Profiler {
  private:
   ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(Profiler);
 
+  /*
+  Body of the background drain thread: batches of pending events are swapped out under the lock
+  and serialized to profile_stream_ without it, so recording threads never pay for file I/O.
+  */
+  void DrainLoop();
+
+  /*
+  Serialize a batch of events to profile_stream_ in chrome tracing format. Only called from the
+  drain thread, or from EndProfiling after that thread has been joined.
+  */
+  void WriteEvents(const Events& batch);
+
+  /*
+  Fold the kernel time of a node event into folded_stacks_ under the frame stack it was recorded
+  with. Called from WriteEvents only, so the same serialization guarantees apply.
+  */
+  void AccumulateFoldedStack(const EventRecord& rec);
+
+  /*
+  Write the folded stack aggregation to "<profile file>.folded" in the format flamegraph.pl
+  consumes ("frame;frame;node <microseconds>" per line). Called once from EndProfiling.
+  */
+  void WriteFoldedStacks();
+
+  /*
+  Ask the drain thread to stop and wait for it.
+  */
+  void StopDrainThread();
+
   /**
    * The maximum number of profiler records to collect.
    * This value is used to initialize the per-profiler maximum.
@@ -146,11 +187,24 @@ class Profiler {
   const logging::Logger* session_logger_{nullptr};
   const logging::Logger* custom_logger_{nullptr};
   TimePoint profiling_start_time_;
+  // pending events not yet serialized; drained continuously by drain_thread_ when profiling to a
+  // file, so this stays small instead of holding the whole trace until EndProfiling
   Events events_;
   bool max_events_reached{false};
   bool profile_with_logger_{false};
   const size_t max_num_events_{global_max_num_events_.load()};
 
+  // background serialization thread; not started on WebAssembly or when profiling via a custom
+  // logger, in which case events accumulate as before
+  std::thread drain_thread_;
+  OrtCondVar drain_cv_;          // signalled when a batch is ready or the thread should stop
+  bool drain_stop_{false};       // GUARDED_BY(mutex_)
+  bool any_event_written_{false};  // only touched by the serializing thread
+
+  // per-stack sums of node kernel times; a std::map so the .folded file is deterministically
+  // ordered. only touched by the serializing thread, same as any_event_written_
+  std::map<std::string, long long> folded_stacks_;
+
 #ifdef ENABLE_STATIC_PROFILER_INSTANCE
   static Profiler* instance_;
 #endif
@@ -158,5 +212,35 @@ class Profiler {
   std::vector<std::unique_ptr<EpProfiler>> ep_profilers_;
 };
 
+/**
+ * RAII marker that scopes profile events to a parent frame, e.g. a control flow node and the
+ * iteration it is executing. While an instance is alive, node events recorded on this thread
+ * carry the current frame stack in their "stack" arg, and EndProfiling additionally aggregates
+ * kernel times per stack into "<profile file>.folded", which flamegraph.pl consumes directly.
+ * So a Loop body node shows up as "my_loop#3;body_node" instead of blurring together with every
+ * other iteration.
+ *
+ * The stack is thread local. That is sound because ExecuteSubgraph runs the subgraph's kernels
+ * on the thread that invoked the parent control flow kernel; kernels dispatched to other
+ * threads (e.g. by the parallel executor) are recorded as top level.
+ */
+class ScopedProfileFrame {
+ public:
+  // frame for one iteration of a loop-style node, recorded as "<parent_name>#<iteration>"
+  ScopedProfileFrame(const std::string& parent_name, int64_t iteration);
+
+  // frame with a caller-built label, e.g. "<if_name>:then_branch". the label must not
+  // contain ';' as that is the folded stack separator.
+  explicit ScopedProfileFrame(std::string label);
+
+  ~ScopedProfileFrame();
+
+  // the stack of the calling thread as "outer;inner"; empty at the top level
+  static std::string CurrentStack();
+
+ private:
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(ScopedProfileFrame);
+};
+
 }  // namespace profiling
 }  // namespace onnxruntime
@@ -13,12 +13,18 @@ See the License for the specific language governing permissions and
 limitations under the License.
 ==============================================================================*/
 
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <limits>
 #include <memory>
 #include <optional>
+#include <sstream>
 
 #include "core/platform/threadpool.h"
 #include "core/common/common.h"
 #include "core/common/cpuid_info.h"
+#include "core/common/denormal.h"
 #include "core/common/eigen_common_wrapper.h"
 #include "core/platform/EigenNonBlockingThreadPool.h"
 #include "core/platform/ort_mutex.h"
@@ -172,7 +178,13 @@ std::string ThreadPoolProfiler::MainThreadStat::Reset() {
     ss << blocks_.back();
     blocks_.clear();
   }
-  ss << "], \"core\": " << core_ << ", ";
+  ss << "], \"core\": " << core_ << ", "
+     << "\"parallel_sections\": " << num_sections_ << ", "
+     << "\"tasks_started\": " << tasks_started_ << ", "
+     << "\"tasks_revoked\": " << tasks_revoked_ << ", ";
+  num_sections_ = 0;
+  tasks_started_ = 0;
+  tasks_revoked_ = 0;
   for (int i = 0; i < MAX_EVENT; ++i) {
     ss << "\"" << ThreadPoolProfiler::GetEventName(static_cast<ThreadPoolEvent>(i))
        << "\": " << events_[i] << ((i == MAX_EVENT - 1) ? std::string{} : ", ");
@@ -230,11 +242,53 @@ void ThreadPoolProfiler::LogRun(int thread_idx) {
   }
 }
 
+void ThreadPoolProfiler::LogSectionEnd(unsigned tasks_started, unsigned tasks_revoked) {
+  if (enabled_) {
+    MainThreadStat& stat = GetMainThreadStat();
+    stat.num_sections_++;
+    stat.tasks_started_ += tasks_started;
+    stat.tasks_revoked_ += tasks_revoked;
+  }
+}
+
+void ThreadPoolProfiler::LogSteal(int thread_idx, bool success) {
+  if (enabled_) {
+    if (success) {
+      child_thread_stats_[thread_idx].num_steals_++;
+    } else {
+      child_thread_stats_[thread_idx].num_failed_steals_++;
+    }
+  }
+}
+
+void ThreadPoolProfiler::LogSpinCycles(int thread_idx, uint64_t cycles) {
+  if (enabled_) {
+    child_thread_stats_[thread_idx].num_spin_cycles_ += cycles;
+  }
+}
+
+void ThreadPoolProfiler::LogPark(int thread_idx) {
+  if (enabled_) {
+    child_thread_stats_[thread_idx].num_parks_++;
+  }
+}
+
+void ThreadPoolProfiler::LogUnpark(int thread_idx) {
+  if (enabled_) {
+    child_thread_stats_[thread_idx].num_unparks_++;
+  }
+}
+
 std::string ThreadPoolProfiler::DumpChildThreadStat() {
   std::stringstream ss;
   for (int i = 0; i < num_threads_; ++i) {
     ss << "\"" << child_thread_stats_[i].thread_id_ << "\": {"
        << "\"num_run\": " << child_thread_stats_[i].num_run_ << ", "
+       << "\"num_steals\": " << child_thread_stats_[i].num_steals_ << ", "
+       << "\"num_failed_steals\": " << child_thread_stats_[i].num_failed_steals_ << ", "
+       << "\"num_spin_cycles\": " << child_thread_stats_[i].num_spin_cycles_ << ", "
+       << "\"num_parks\": " << child_thread_stats_[i].num_parks_ << ", "
+       << "\"num_unparks\": " << child_thread_stats_[i].num_unparks_ << ", "
        << "\"core\": " << child_thread_stats_[i].core_ << "}"
        << (i == num_threads_ - 1 ? "" : ",");
   }
@@ -369,38 +423,240 @@ class alignas(CACHE_LINE_BYTES) LoopCounter {
 #pragma warning(pop) /* Padding added in LoopCounterShard, LoopCounter */
 #endif
 
+// Online controller that learns an efficient degree of parallelism per bucket of loop cost
+// (see ThreadOptions::adaptive_degree).  DegreeOfParallelism is static per pool, so cheap
+// loops (small GEMMs and elementwise ops) fan out across the whole pool and can lose more to
+// synchronization than the extra threads contribute.  Loops are bucketed by the power of two
+// of their cost model estimate, so repeated dispatches of one kernel with the same shape land
+// in the same bucket.  Each bucket hill-climbs on the measured wall time of its dispatches:
+// phases of kSamplesPerPhase timed dispatches at the current degree and at a probe degree
+// (half or double of it) are compared, the probe is adopted when it is not materially slower
+// (downward) or clearly faster (upward), and after an unsuccessful probe the learned clamp is
+// reused unmeasured for a cooldown window.  Taking the minimum over each phase's samples
+// filters out interference from other loops running concurrently on the pool.
+class AdaptiveDegreeController {
+ public:
+  static constexpr int kCostBuckets = 48;
+  static constexpr int kSamplesPerPhase = 4;
+  static constexpr uint32_t kCooldownDispatches = 256;
+
+  explicit AdaptiveDegreeController(int max_degree) : max_degree_(max_degree) {
+  }
+
+  static int BucketOf(double total_cost_cycles) {
+    int bucket = total_cost_cycles >= 1.0 ? static_cast<int>(std::log2(total_cost_cycles)) : 0;
+    return std::min(kCostBuckets - 1, std::max(0, bucket));
+  }
+
+  // Returns the degree of parallelism to use for the next dispatch of this bucket, and
+  // whether the caller should time the dispatch and report it back via EndDispatch.
+  int BeginDispatch(int bucket_index, bool& measure) {
+    Bucket& bucket = buckets_[bucket_index];
+    std::lock_guard<OrtMutex> guard(bucket.lock);
+    bucket.dispatches++;
+    if (bucket.degree == 0) {
+      bucket.degree = max_degree_;
+    }
+    if (bucket.cooldown > 0) {
+      bucket.cooldown--;
+      measure = false;
+      return bucket.degree;
+    }
+    measure = true;
+    return bucket.phase == Phase::MeasureProbe ? bucket.probe_degree : bucket.degree;
+  }
+
+  void EndDispatch(int bucket_index, int degree, uint64_t elapsed_ns) {
+    Bucket& bucket = buckets_[bucket_index];
+    std::lock_guard<OrtMutex> guard(bucket.lock);
+
+    // Drop the sample if the bucket moved on while this dispatch ran (concurrent dispatches
+    // of the same bucket can overlap a phase transition).
+    const int expected = bucket.phase == Phase::MeasureProbe ? bucket.probe_degree : bucket.degree;
+    if (degree != expected || bucket.cooldown > 0) {
+      return;
+    }
+
+    uint64_t& best = bucket.phase == Phase::MeasureProbe ? bucket.best_probe_ns : bucket.best_current_ns;
+    best = std::min(best, elapsed_ns);
+    if (++bucket.samples < kSamplesPerPhase) {
+      return;
+    }
+    bucket.samples = 0;
+
+    if (bucket.phase == Phase::MeasureCurrent) {
+      int probe = bucket.probe_down ? bucket.degree / 2 : bucket.degree * 2;
+      probe = std::min(max_degree_, std::max(1, probe));
+      if (probe == bucket.degree) {
+        // Already at the end of the range in this direction; try the other one next time.
+        bucket.probe_down = !bucket.probe_down;
+        EnterCooldown(bucket);
+        return;
+      }
+      bucket.probe_degree = probe;
+      bucket.best_probe_ns = std::numeric_limits<uint64_t>::max();
+      bucket.phase = Phase::MeasureProbe;
+    } else {
+      // Fewer threads are adopted when not materially (5%) slower, since they free workers
+      // for other loops; more threads only when clearly faster.
+      const bool down = bucket.probe_degree < bucket.degree;
+      const bool adopt = down ? bucket.best_probe_ns <= bucket.best_current_ns + bucket.best_current_ns / 20
+                              : bucket.best_probe_ns + bucket.best_probe_ns / 20 < bucket.best_current_ns;
+      if (adopt) {
+        // Keep climbing in the same direction from the new degree.
+        bucket.degree = bucket.probe_degree;
+        bucket.best_current_ns = std::numeric_limits<uint64_t>::max();
+        bucket.phase = Phase::MeasureCurrent;
+      } else {
+        bucket.probe_down = !bucket.probe_down;
+        EnterCooldown(bucket);
+      }
+    }
+  }
+
+  // JSON array with the learned state of each active bucket, appended to the thread pool
+  // profiler output.
+  std::string Report() const {
+    std::ostringstream ss;
+    ss << "[";
+    bool first = true;
+    for (int i = 0; i < kCostBuckets; i++) {
+      const Bucket& bucket = buckets_[i];
+      std::lock_guard<OrtMutex> guard(bucket.lock);
+      if (bucket.dispatches == 0) {
+        continue;
+      }
+      if (!first) {
+        ss << ", ";
+      }
+      first = false;
+      ss << "{\"cost_bucket\": " << i << ", \"degree\": " << bucket.degree
+         << ", \"dispatches\": " << bucket.dispatches << "}";
+    }
+    ss << "]";
+    return ss.str();
+  }
+
+ private:
+  enum class Phase {
+    MeasureCurrent,
+    MeasureProbe,
+  };
+
+  struct Bucket {
+    mutable OrtMutex lock;
+    // 0 until the first dispatch initializes it to the pool's full degree.
+    int degree{0};
+    int probe_degree{0};
+    bool probe_down{true};
+    Phase phase{Phase::MeasureCurrent};
+    int samples{0};
+    uint64_t best_current_ns{std::numeric_limits<uint64_t>::max()};
+    uint64_t best_probe_ns{std::numeric_limits<uint64_t>::max()};
+    uint32_t cooldown{0};
+    uint64_t dispatches{0};
+  };
+
+  static void EnterCooldown(Bucket& bucket) {
+    bucket.phase = Phase::MeasureCurrent;
+    bucket.best_current_ns = std::numeric_limits<uint64_t>::max();
+    bucket.cooldown = kCooldownDispatches;
+  }
+
+  std::array<Bucket, kCostBuckets> buckets_;
+  const int max_degree_;
+};
+
 ThreadPool::ThreadPool(Env* env,
                        const ThreadOptions& thread_options,
                        const NAME_CHAR_TYPE* name,
                        int degree_of_parallelism,
                        bool low_latency_hint,
                        bool force_hybrid)
-    : thread_options_(thread_options), force_hybrid_(force_hybrid) {
+    : thread_options_(thread_options),
+      env_(env),
+      name_(name != nullptr ? name : std::basic_string<NAME_CHAR_TYPE>()),
+      low_latency_hint_(low_latency_hint),
+      force_hybrid_(force_hybrid) {
   // In the current implementation, a thread pool with degree_of_parallelism==1 uses
   // the caller as one of the threads for executing work.  Hence we only create
   // additional thread(s) for degree_of_parallelism>=2.
   assert(degree_of_parallelism >= 1);
   if (degree_of_parallelism >= 2) {
-    int threads_to_create = degree_of_parallelism - 1;
+    threads_to_create_ = degree_of_parallelism - 1;
 
     if (!thread_options_.affinities.empty()) {
       // Remove first affinity element as designated for the caller thread
       thread_options_.affinities.erase(thread_options_.affinities.begin());
-      assert(thread_options_.affinities.size() >= size_t(threads_to_create));
+      assert(thread_options_.affinities.size() >= size_t(threads_to_create_));
     }
 
     extended_eigen_threadpool_ =
         std::make_unique<ThreadPoolTempl<Env> >(name,
-                                                threads_to_create,
+                                                threads_to_create_,
                                                 low_latency_hint,
                                                 *env,
                                                 thread_options_);
     underlying_threadpool_ = extended_eigen_threadpool_.get();
+
+    if (thread_options_.small_loop_max_helpers > 0) {
+      CalibrateSmallLoopDispatchOverhead();
+    }
+
+    if (thread_options_.adaptive_degree) {
+      adaptive_degree_controller_ = std::make_unique<AdaptiveDegreeController>(DegreeOfParallelism(this));
+    }
+  }
+}
+
+void ThreadPool::CalibrateSmallLoopDispatchOverhead() {
+  // Measure the fixed fork/join cost of an empty dispatch to a single worker.  The first
+  // dispatches also warm up the worker threads (bringing spinning workers out of their
+  // initial wait), so take the minimum over a set of samples rather than the mean.
+  constexpr int kWarmupRuns = 2;
+  constexpr int kSamples = 10;
+  std::function<void(unsigned)> noop = [](unsigned) {};
+  for (int i = 0; i < kWarmupRuns; i++) {
+    RunInParallel(noop, 2, 1);
   }
+  uint64_t min_ns = std::numeric_limits<uint64_t>::max();
+  for (int i = 0; i < kSamples; i++) {
+    auto start = std::chrono::steady_clock::now();
+    RunInParallel(noop, 2, 1);
+    auto elapsed_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                          std::chrono::steady_clock::now() - start)
+                          .count();
+    min_ns = std::min(min_ns, static_cast<uint64_t>(elapsed_ns));
+  }
+  small_loop_dispatch_overhead_ns_ = min_ns;
 }
 
 ThreadPool::~ThreadPool() = default;
 
+void ThreadPool::Quiesce() {
+  if (extended_eigen_threadpool_) {
+    // the ThreadPoolTempl destructor signals the workers to exit and joins them.
+    // loops run while quiesced fall through to the sequential path in RunInParallel.
+    underlying_threadpool_ = nullptr;
+    extended_eigen_threadpool_.reset();
+  }
+}
+
+void ThreadPool::Resume() {
+  if (underlying_threadpool_ == nullptr && threads_to_create_ > 0) {
+    // thread_options_.affinities was already adjusted for the caller thread during construction.
+    // the dispatch overhead calibration and any learned degree-of-parallelism limits still apply to
+    // the restored process, so they are deliberately not re-run here.
+    extended_eigen_threadpool_ =
+        std::make_unique<ThreadPoolTempl<Env> >(name_.empty() ? nullptr : name_.c_str(),
+                                                threads_to_create_,
+                                                low_latency_hint_,
+                                                *env_,
+                                                thread_options_);
+    underlying_threadpool_ = extended_eigen_threadpool_.get();
+  }
+}
+
 // Base case for parallel loops, running iterations 0..total, divided into blocks
 // of block_size iterations, and calling into a function that takes a start..end
 // range of indices to run.
@@ -420,7 +676,9 @@ void ThreadPool::ParallelForFixedBlockSizeScheduling(const std::ptrdiff_t total,
     // Split the work across threads in the pool.  Each work item will run a loop claiming iterations,
     // hence we need at most one for each thread, even if the number of blocks of iterations is larger.
     auto num_blocks = total / block_size;
-    auto num_threads_inc_main = NumThreads() + 1;
+    // d_of_p exceeds the thread count on hybrid CPUs and falls below it when a
+    // DegreeOfParallelismCap is active, so bound the fork by both.
+    auto num_threads_inc_main = std::min(NumThreads() + 1, d_of_p);
     int num_work_items = static_cast<int>(std::min(static_cast<std::ptrdiff_t>(num_threads_inc_main), num_blocks));
     assert(num_work_items > 0);
 
@@ -459,10 +717,42 @@ void ThreadPool::ParallelForFixedBlockSizeScheduling(const std::ptrdiff_t total,
     };
     // Distribute task among all threads in the pool, reduce number of work items if
     // num_of_blocks is smaller than number of threads.
-    RunInParallel(run_work, std::min(NumThreads() + 1, num_of_blocks), base_block_size);
+    RunInParallel(run_work, std::min(std::min(NumThreads() + 1, d_of_p), num_of_blocks), base_block_size);
   }
 }
 
+// Degree-limited variant of the above, used by the small-loop fast path in ParallelFor.
+// The scheduling is identical to the fixed block size case, but the fork is capped at
+// max_d_of_p work items (including the caller) instead of fanning out across the whole
+// pool, keeping the fork/join cost proportionate to the amount of work available.
+void ThreadPool::ParallelForSmallLoopScheduling(const std::ptrdiff_t total, const std::ptrdiff_t block_size,
+                                                int max_d_of_p,
+                                                const std::function<void(std::ptrdiff_t, std::ptrdiff_t)>& fn) {
+  if (total <= 0)
+    return;
+
+  if (total <= block_size || max_d_of_p <= 1) {
+    fn(0, total);
+    return;
+  }
+
+  auto num_blocks = total / block_size;
+  int num_work_items = static_cast<int>(std::min(static_cast<std::ptrdiff_t>(max_d_of_p), num_blocks));
+  assert(num_work_items > 0);
+
+  LoopCounter lc(total, static_cast<uint64_t>(max_d_of_p), block_size);
+  std::function<void(unsigned)> run_work = [&](unsigned idx) {
+    unsigned my_home_shard = lc.GetHomeShard(idx);
+    unsigned my_shard = my_home_shard;
+    uint64_t my_iter_start, my_iter_end;
+    while (lc.ClaimIterations(my_home_shard, my_shard, my_iter_start, my_iter_end, block_size)) {
+      fn(static_cast<std::ptrdiff_t>(my_iter_start),
+         static_cast<std::ptrdiff_t>(my_iter_end));
+    }
+  };
+  RunInParallel(run_work, static_cast<unsigned>(num_work_items), block_size);
+}
+
 void ThreadPool::SimpleParallelFor(std::ptrdiff_t total, const std::function<void(std::ptrdiff_t)>& fn) {
   ParallelForFixedBlockSizeScheduling(total, 1, [&](std::ptrdiff_t first, std::ptrdiff_t last) {
     for (std::ptrdiff_t idx = first; idx < last; idx++) {
@@ -487,7 +777,12 @@ void ThreadPool::StartProfiling() {
 
 std::string ThreadPool::StopProfiling() {
   if (underlying_threadpool_) {
-    return underlying_threadpool_->StopProfiling();
+    auto stats = underlying_threadpool_->StopProfiling();
+    // Splice the adaptive degree report into the profiler's JSON object.
+    if (adaptive_degree_controller_ && !stats.empty() && stats.back() == '}') {
+      stats.insert(stats.size() - 1, ", \"adaptive_degree\": " + adaptive_degree_controller_->Report());
+    }
+    return stats;
   } else {
     return {};
   }
@@ -516,6 +811,14 @@ ThreadPool::ParallelSection::~ParallelSection() {
 }
 
 void ThreadPool::RunInParallel(std::function<void(unsigned idx)> fn, unsigned n, std::ptrdiff_t block_size) {
+  // The calling thread runs part of the loop. Pool threads apply the denormal-as-zero setting when they
+  // start, but an external caller (e.g. an application thread driving kernel execution through RunAsync
+  // callbacks) may not have it set, so apply it here for the duration of the parallel region.
+  std::optional<ScopedDenormalAsZero> denormal_scope;
+  if (thread_options_.set_denormal_as_zero && CurrentThreadId() == -1) {
+    denormal_scope.emplace(true);
+  }
+
   if (underlying_threadpool_) {
     if (current_parallel_section.has_value()) {
       underlying_threadpool_->RunInParallelSection(*current_parallel_section,
@@ -622,6 +925,62 @@ void ThreadPool::ParallelFor(std::ptrdiff_t n, const TensorOpCost& c,
     return;
   }
 
+  // Small-loop fast path: compare the loop's estimated cost against the fork/join overhead
+  // measured at pool construction.  Loops cheaper than the overhead itself run inline (the
+  // dispatch would cost more than it saves); loops that are only a small multiple of it fork
+  // to the caller plus at most small_loop_max_helpers workers rather than the whole pool.
+  // The limited fork is cheap when spinning is enabled, as the pre-woken workers pick the
+  // work up without a kernel-level wake.
+  if (thread_options_.small_loop_max_helpers > 0 && small_loop_dispatch_overhead_ns_ > 0) {
+    // The dispatch overhead is measured in nanoseconds while the cost model estimates are in
+    // (approximate) cycles.  The exact clock rate does not matter much; the thresholds only
+    // need a stable order of magnitude.
+    constexpr double kCyclesPerNanosecond = 2.0;
+    // Loops estimated below this multiple of the dispatch overhead take the limited fork.
+    constexpr double kSmallLoopCostMultiple = 16.0;
+
+    const double overhead_cycles = static_cast<double>(small_loop_dispatch_overhead_ns_) * kCyclesPerNanosecond;
+    const double total_cycles = CostModel::totalCost(static_cast<double>(n), cost);
+    if (total_cycles <= overhead_cycles) {
+      f(0, n);
+      return;
+    }
+    if (total_cycles < kSmallLoopCostMultiple * overhead_cycles) {
+      int max_d_of_p = std::min(d_of_p, thread_options_.small_loop_max_helpers + 1);
+      ptrdiff_t small_loop_block = CalculateParallelForBlock(n, cost, nullptr, max_d_of_p);
+      ParallelForSmallLoopScheduling(n, small_loop_block, max_d_of_p, f);
+      return;
+    }
+  }
+
+  // Adaptive degree controller: clamp the fan-out of this loop's cost bucket to the thread
+  // count it has been measured to scale to, and time a subset of the dispatches to keep the
+  // estimate current.
+  if (adaptive_degree_controller_) {
+    const int bucket = AdaptiveDegreeController::BucketOf(CostModel::totalCost(static_cast<double>(n), cost));
+    bool measure = false;
+    const int degree = std::min(d_of_p, adaptive_degree_controller_->BeginDispatch(bucket, measure));
+    ptrdiff_t adaptive_block = CalculateParallelForBlock(n, cost, nullptr, degree);
+    auto run_loop = [&]() {
+      if (degree < d_of_p) {
+        ParallelForSmallLoopScheduling(n, adaptive_block, degree, f);
+      } else {
+        ParallelForFixedBlockSizeScheduling(n, adaptive_block, f);
+      }
+    };
+    if (measure) {
+      auto start = std::chrono::steady_clock::now();
+      run_loop();
+      auto elapsed_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            std::chrono::steady_clock::now() - start)
+                            .count();
+      adaptive_degree_controller_->EndDispatch(bucket, degree, static_cast<uint64_t>(elapsed_ns));
+    } else {
+      run_loop();
+    }
+    return;
+  }
+
   ptrdiff_t block = CalculateParallelForBlock(n, cost, nullptr, d_of_p);
   ParallelForFixedBlockSizeScheduling(n, block, f);
 }
@@ -635,15 +994,37 @@ bool ThreadPool::ShouldParallelize(const concurrency::ThreadPool* tp) {
   return (DegreeOfParallelism(tp) != 1);
 }
 
+namespace {
+// Per-thread cap installed by ThreadPool::DegreeOfParallelismCap; 0 means no cap.
+thread_local int degree_of_parallelism_cap = 0;
+}  // namespace
+
+ThreadPool::DegreeOfParallelismCap::DegreeOfParallelismCap(int max_degree_of_parallelism)
+    : previous_cap_(degree_of_parallelism_cap) {
+  if (max_degree_of_parallelism > 0 &&
+      (previous_cap_ <= 0 || max_degree_of_parallelism < previous_cap_)) {
+    degree_of_parallelism_cap = max_degree_of_parallelism;
+  }
+}
+
+ThreadPool::DegreeOfParallelismCap::~DegreeOfParallelismCap() {
+  degree_of_parallelism_cap = previous_cap_;
+}
+
 int ThreadPool::DegreeOfParallelism(const concurrency::ThreadPool* tp) {
   // When not using OpenMP, we parallelize over the N threads created by the pool
   // tp, plus 1 for the thread entering a loop.
   if (tp) {
+    int d_of_p;
     if (tp->force_hybrid_ || CPUIDInfo::GetCPUIDInfo().IsHybrid()) {
-      return ((tp->NumThreads() + 1)) * TaskGranularityFactor;
+      d_of_p = ((tp->NumThreads() + 1)) * TaskGranularityFactor;
     } else {
-      return ((tp->NumThreads() + 1));
+      d_of_p = ((tp->NumThreads() + 1));
+    }
+    if (degree_of_parallelism_cap > 0) {
+      d_of_p = std::min(d_of_p, degree_of_parallelism_cap);
     }
+    return d_of_p;
   } else {
     return 1;
   }
@@ -675,6 +1056,12 @@ void ThreadPool::DisableSpinning() {
   }
 }
 
+void ThreadPool::SetThreadAffinities(std::vector<LogicalProcessors> affinities) {
+  if (extended_eigen_threadpool_) {
+    extended_eigen_threadpool_->SetThreadAffinities(std::move(affinities));
+  }
+}
+
 // Return the number of threads created by the pool.
 int ThreadPool::NumThreads() const {
   if (underlying_threadpool_) {
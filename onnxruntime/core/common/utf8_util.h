@@ -3,11 +3,37 @@
 
 #pragma once
 
+#include <cstdint>
+#include <cstring>
+
 #include "core/common/common.h"
 
 namespace onnxruntime {
 namespace utf8_util {
 
+/// <summary>
+/// Returns the number of leading ASCII bytes. Scans eight bytes per step by
+/// testing the high bit of a whole word, which compilers turn into vector
+/// compares; tokenizer inputs are overwhelmingly ASCII so this is the hot path
+/// for validation and length counting.
+/// </summary>
+inline size_t utf8_ascii_prefix(const unsigned char* s, size_t len) {
+  constexpr uint64_t high_bits = 0x8080808080808080ULL;
+  size_t idx = 0;
+  uint64_t word;
+  while (idx + sizeof(word) <= len) {
+    std::memcpy(&word, s + idx, sizeof(word));
+    if ((word & high_bits) != 0) {
+      break;
+    }
+    idx += sizeof(word);
+  }
+  while (idx < len && s[idx] < 0x80u) {
+    ++idx;
+  }
+  return idx;
+}
+
 /// <summary>
 /// Checks the extension bytes and returns a number of
 /// bytes in the UTF-8 character
@@ -40,6 +66,14 @@ inline bool utf8_bytes(unsigned char ch, size_t& len) {
 inline bool utf8_len(const unsigned char* s, size_t bytes, size_t& len) {
   size_t result = 0;
   while (bytes > 0) {
+    // ASCII runs count one character per byte and need no lead byte decoding
+    const size_t ascii_run = utf8_ascii_prefix(s, bytes);
+    result += ascii_run;
+    s += ascii_run;
+    bytes -= ascii_run;
+    if (bytes == 0) {
+      break;
+    }
     size_t char_bytes = 0;
     bool valid = utf8_bytes(*s, char_bytes);
     if (!valid || bytes < char_bytes) {
@@ -57,6 +91,13 @@ inline bool utf8_validate(const unsigned char* s, size_t len, size_t& utf8_chars
   size_t utf8_len = 0;
   size_t idx = 0;
   while (idx < len) {
+    // ASCII runs are valid by construction, one character per byte
+    const size_t ascii_run = utf8_ascii_prefix(s + idx, len - idx);
+    idx += ascii_run;
+    utf8_len += ascii_run;
+    if (idx >= len) {
+      break;
+    }
     size_t bytes = 0;
     auto ch = s[idx];
     if (utf8_bytes(ch, bytes)) {
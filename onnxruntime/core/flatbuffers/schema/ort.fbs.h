@@ -105,6 +105,15 @@ struct OpIdKernelTypeStrArgsEntryBuilder;
 struct KernelTypeStrResolver;
 struct KernelTypeStrResolverBuilder;
 
+struct PrePackedBuffer;
+struct PrePackedBufferBuilder;
+
+struct PrePackedWeightEntry;
+struct PrePackedWeightEntryBuilder;
+
+struct PrePackedWeightsForIsa;
+struct PrePackedWeightsForIsaBuilder;
+
 struct InferenceSession;
 struct InferenceSessionBuilder;
 
@@ -2971,12 +2980,215 @@ inline ::flatbuffers::Offset<KernelTypeStrResolver> CreateKernelTypeStrResolverD
       op_kernel_type_str_args__);
 }
 
+struct PrePackedBuffer FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef PrePackedBufferBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_IS_NULL = 4,
+    VT_DATA = 6
+  };
+  bool is_null() const {
+    return GetField<uint8_t>(VT_IS_NULL, 0) != 0;
+  }
+  const ::flatbuffers::Vector<uint8_t> *data() const {
+    return GetPointer<const ::flatbuffers::Vector<uint8_t> *>(VT_DATA);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint8_t>(verifier, VT_IS_NULL, 1) &&
+           VerifyOffset(verifier, VT_DATA) &&
+           verifier.VerifyVector(data()) &&
+           verifier.EndTable();
+  }
+};
+
+struct PrePackedBufferBuilder {
+  typedef PrePackedBuffer Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_is_null(bool is_null) {
+    fbb_.AddElement<uint8_t>(PrePackedBuffer::VT_IS_NULL, static_cast<uint8_t>(is_null), 0);
+  }
+  void add_data(::flatbuffers::Offset<::flatbuffers::Vector<uint8_t>> data) {
+    fbb_.AddOffset(PrePackedBuffer::VT_DATA, data);
+  }
+  explicit PrePackedBufferBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<PrePackedBuffer> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<PrePackedBuffer>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<PrePackedBuffer> CreatePrePackedBuffer(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    bool is_null = false,
+    ::flatbuffers::Offset<::flatbuffers::Vector<uint8_t>> data = 0) {
+  PrePackedBufferBuilder builder_(_fbb);
+  builder_.add_data(data);
+  builder_.add_is_null(is_null);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<PrePackedBuffer> CreatePrePackedBufferDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    bool is_null = false,
+    const std::vector<uint8_t> *data = nullptr) {
+  auto data__ = data ? _fbb.CreateVector<uint8_t>(*data) : 0;
+  return onnxruntime::fbs::CreatePrePackedBuffer(
+      _fbb,
+      is_null,
+      data__);
+}
+
+struct PrePackedWeightEntry FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef PrePackedWeightEntryBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_KEY = 4,
+    VT_BUFFERS = 6
+  };
+  const ::flatbuffers::String *key() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_KEY);
+  }
+  bool KeyCompareLessThan(const PrePackedWeightEntry * const o) const {
+    return *key() < *o->key();
+  }
+  int KeyCompareWithValue(const char *_key) const {
+    return strcmp(key()->c_str(), _key);
+  }
+  const ::flatbuffers::Vector<::flatbuffers::Offset<onnxruntime::fbs::PrePackedBuffer>> *buffers() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<onnxruntime::fbs::PrePackedBuffer>> *>(VT_BUFFERS);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffsetRequired(verifier, VT_KEY) &&
+           verifier.VerifyString(key()) &&
+           VerifyOffset(verifier, VT_BUFFERS) &&
+           verifier.VerifyVector(buffers()) &&
+           verifier.VerifyVectorOfTables(buffers()) &&
+           verifier.EndTable();
+  }
+};
+
+struct PrePackedWeightEntryBuilder {
+  typedef PrePackedWeightEntry Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_key(::flatbuffers::Offset<::flatbuffers::String> key) {
+    fbb_.AddOffset(PrePackedWeightEntry::VT_KEY, key);
+  }
+  void add_buffers(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<onnxruntime::fbs::PrePackedBuffer>>> buffers) {
+    fbb_.AddOffset(PrePackedWeightEntry::VT_BUFFERS, buffers);
+  }
+  explicit PrePackedWeightEntryBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<PrePackedWeightEntry> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<PrePackedWeightEntry>(end);
+    fbb_.Required(o, PrePackedWeightEntry::VT_KEY);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<PrePackedWeightEntry> CreatePrePackedWeightEntry(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::String> key = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<onnxruntime::fbs::PrePackedBuffer>>> buffers = 0) {
+  PrePackedWeightEntryBuilder builder_(_fbb);
+  builder_.add_buffers(buffers);
+  builder_.add_key(key);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<PrePackedWeightEntry> CreatePrePackedWeightEntryDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const char *key = nullptr,
+    const std::vector<::flatbuffers::Offset<onnxruntime::fbs::PrePackedBuffer>> *buffers = nullptr) {
+  auto key__ = key ? _fbb.CreateString(key) : 0;
+  auto buffers__ = buffers ? _fbb.CreateVector<::flatbuffers::Offset<onnxruntime::fbs::PrePackedBuffer>>(*buffers) : 0;
+  return onnxruntime::fbs::CreatePrePackedWeightEntry(
+      _fbb,
+      key__,
+      buffers__);
+}
+
+struct PrePackedWeightsForIsa FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef PrePackedWeightsForIsaBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_TARGET_ISA = 4,
+    VT_ENTRIES = 6
+  };
+  const ::flatbuffers::String *target_isa() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_TARGET_ISA);
+  }
+  const ::flatbuffers::Vector<::flatbuffers::Offset<onnxruntime::fbs::PrePackedWeightEntry>> *entries() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<onnxruntime::fbs::PrePackedWeightEntry>> *>(VT_ENTRIES);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_TARGET_ISA) &&
+           verifier.VerifyString(target_isa()) &&
+           VerifyOffset(verifier, VT_ENTRIES) &&
+           verifier.VerifyVector(entries()) &&
+           verifier.VerifyVectorOfTables(entries()) &&
+           verifier.EndTable();
+  }
+};
+
+struct PrePackedWeightsForIsaBuilder {
+  typedef PrePackedWeightsForIsa Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_target_isa(::flatbuffers::Offset<::flatbuffers::String> target_isa) {
+    fbb_.AddOffset(PrePackedWeightsForIsa::VT_TARGET_ISA, target_isa);
+  }
+  void add_entries(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<onnxruntime::fbs::PrePackedWeightEntry>>> entries) {
+    fbb_.AddOffset(PrePackedWeightsForIsa::VT_ENTRIES, entries);
+  }
+  explicit PrePackedWeightsForIsaBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<PrePackedWeightsForIsa> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<PrePackedWeightsForIsa>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<PrePackedWeightsForIsa> CreatePrePackedWeightsForIsa(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::String> target_isa = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<onnxruntime::fbs::PrePackedWeightEntry>>> entries = 0) {
+  PrePackedWeightsForIsaBuilder builder_(_fbb);
+  builder_.add_entries(entries);
+  builder_.add_target_isa(target_isa);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<PrePackedWeightsForIsa> CreatePrePackedWeightsForIsaDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const char *target_isa = nullptr,
+    std::vector<::flatbuffers::Offset<onnxruntime::fbs::PrePackedWeightEntry>> *entries = nullptr) {
+  auto target_isa__ = target_isa ? _fbb.CreateString(target_isa) : 0;
+  auto entries__ = entries ? _fbb.CreateVectorOfSortedTables<onnxruntime::fbs::PrePackedWeightEntry>(entries) : 0;
+  return onnxruntime::fbs::CreatePrePackedWeightsForIsa(
+      _fbb,
+      target_isa__,
+      entries__);
+}
+
 struct InferenceSession FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
   typedef InferenceSessionBuilder Builder;
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
     VT_ORT_VERSION = 4,
     VT_MODEL = 6,
-    VT_KERNEL_TYPE_STR_RESOLVER = 10
+    VT_KERNEL_TYPE_STR_RESOLVER = 10,
+    VT_PRE_PACKED_WEIGHTS = 12
   };
   const ::flatbuffers::String *ort_version() const {
     return GetPointer<const ::flatbuffers::String *>(VT_ORT_VERSION);
@@ -2987,6 +3199,9 @@ struct InferenceSession FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
   const onnxruntime::fbs::KernelTypeStrResolver *kernel_type_str_resolver() const {
     return GetPointer<const onnxruntime::fbs::KernelTypeStrResolver *>(VT_KERNEL_TYPE_STR_RESOLVER);
   }
+  const onnxruntime::fbs::PrePackedWeightsForIsa *pre_packed_weights() const {
+    return GetPointer<const onnxruntime::fbs::PrePackedWeightsForIsa *>(VT_PRE_PACKED_WEIGHTS);
+  }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffset(verifier, VT_ORT_VERSION) &&
@@ -2995,6 +3210,8 @@ struct InferenceSession FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
            verifier.VerifyTable(model()) &&
            VerifyOffset(verifier, VT_KERNEL_TYPE_STR_RESOLVER) &&
            verifier.VerifyTable(kernel_type_str_resolver()) &&
+           VerifyOffset(verifier, VT_PRE_PACKED_WEIGHTS) &&
+           verifier.VerifyTable(pre_packed_weights()) &&
            verifier.EndTable();
   }
 };
@@ -3012,6 +3229,9 @@ struct InferenceSessionBuilder {
   void add_kernel_type_str_resolver(::flatbuffers::Offset<onnxruntime::fbs::KernelTypeStrResolver> kernel_type_str_resolver) {
     fbb_.AddOffset(InferenceSession::VT_KERNEL_TYPE_STR_RESOLVER, kernel_type_str_resolver);
   }
+  void add_pre_packed_weights(::flatbuffers::Offset<onnxruntime::fbs::PrePackedWeightsForIsa> pre_packed_weights) {
+    fbb_.AddOffset(InferenceSession::VT_PRE_PACKED_WEIGHTS, pre_packed_weights);
+  }
   explicit InferenceSessionBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -3027,8 +3247,10 @@ inline ::flatbuffers::Offset<InferenceSession> CreateInferenceSession(
     ::flatbuffers::FlatBufferBuilder &_fbb,
     ::flatbuffers::Offset<::flatbuffers::String> ort_version = 0,
     ::flatbuffers::Offset<onnxruntime::fbs::Model> model = 0,
-    ::flatbuffers::Offset<onnxruntime::fbs::KernelTypeStrResolver> kernel_type_str_resolver = 0) {
+    ::flatbuffers::Offset<onnxruntime::fbs::KernelTypeStrResolver> kernel_type_str_resolver = 0,
+    ::flatbuffers::Offset<onnxruntime::fbs::PrePackedWeightsForIsa> pre_packed_weights = 0) {
   InferenceSessionBuilder builder_(_fbb);
+  builder_.add_pre_packed_weights(pre_packed_weights);
   builder_.add_kernel_type_str_resolver(kernel_type_str_resolver);
   builder_.add_model(model);
   builder_.add_ort_version(ort_version);
@@ -3039,13 +3261,15 @@ inline ::flatbuffers::Offset<InferenceSession> CreateInferenceSessionDirect(
     ::flatbuffers::FlatBufferBuilder &_fbb,
     const char *ort_version = nullptr,
     ::flatbuffers::Offset<onnxruntime::fbs::Model> model = 0,
-    ::flatbuffers::Offset<onnxruntime::fbs::KernelTypeStrResolver> kernel_type_str_resolver = 0) {
+    ::flatbuffers::Offset<onnxruntime::fbs::KernelTypeStrResolver> kernel_type_str_resolver = 0,
+    ::flatbuffers::Offset<onnxruntime::fbs::PrePackedWeightsForIsa> pre_packed_weights = 0) {
   auto ort_version__ = ort_version ? _fbb.CreateString(ort_version) : 0;
   return onnxruntime::fbs::CreateInferenceSession(
       _fbb,
       ort_version__,
       model,
-      kernel_type_str_resolver);
+      kernel_type_str_resolver,
+      pre_packed_weights);
 }
 
 inline bool VerifyTypeInfoValue(::flatbuffers::Verifier &verifier, const void *obj, TypeInfoValue type) {
@@ -4,10 +4,12 @@
 #include "core/framework/allocation_planner.h"
 #include <list>
 #include <algorithm>
+#include <limits>
 #include <deque>
 #include <sstream>
 #include <ctime>
 #include <iomanip>
+#include <string_view>
 #include "core/common/exceptions.h"
 #include "core/common/inlined_containers.h"
 #include "core/common/safeint.h"
@@ -183,6 +185,14 @@ class PlannerImpl {
   InlinedHashMap<onnxruntime::NodeIndex, InlinedHashSet<onnxruntime::NodeIndex>> dependence_graph_;
   InlinedHashMap<onnxruntime::OrtValueIndex, onnxruntime::NodeIndex> value_node_map_;
 
+  // Activation recomputation decisions made by BuildExecutionPlan and consumed by
+  // GenerateDeallocationPlan (see kOrtSessionOptionsActivationRecomputeMinGap):
+  // a recomputed value gets an extra release action after its first consumer ...
+  InlinedHashMap<OrtValueIndex, NodeIndex> recompute_early_release_;
+  // ... and the inputs of its producer are kept alive until the node ahead of which the
+  // producer is re-executed (the value's second consumer).
+  InlinedHashMap<NodeIndex, InlinedVector<OrtValueIndex>> recompute_extra_consumers_;
+
   // OrtValueInfo: Auxiliary information about an OrtValue used only during plan-generation:
   struct OrtValueInfo {
     const onnxruntime::NodeArg* p_def_site;  // the (unique) NodeArg corresponding to the MLValue
@@ -380,7 +390,32 @@ class PlannerImpl {
           if (p_input_arg->Exists()) {
             auto input_arg_index = Index(p_input_arg->Name());
             auto original = Buffer(input_arg_index);
-            if (1 == UseCount(original)) {
+            // The remaining use count covers consumers scheduled after this node - their reads
+            // would observe the in-place write, so they block reuse - but also this node's own
+            // input uses, which have not been decremented yet. The latter don't block reuse
+            // provided the kernel declared each of those inputs as an in-place candidate, as
+            // that declaration promises the kernel tolerates the output aliasing the input
+            // (e.g. both inputs of Add(X, X)). An undeclared input using the same buffer (say
+            // the updates of a Scatter) may be read in an order an aliasing write corrupts, and
+            // keeps the use count above the pending-use total so reuse stays disabled.
+            int pending_uses_by_this_node = 0;
+            for (size_t input_idx = 0; input_idx < input_args.size(); ++input_idx) {
+              const auto* p_other_arg = input_args[input_idx];
+              if (!p_other_arg->Exists() || Buffer(Index(p_other_arg->Name())) != original) {
+                continue;
+              }
+              bool declared_inplace = false;
+              for (auto& other_pair : inplace_map) {
+                if (other_pair.first == static_cast<int>(input_idx)) {
+                  declared_inplace = true;
+                  break;
+                }
+              }
+              if (declared_inplace) {
+                ++pending_uses_by_this_node;
+              }
+            }
+            if (UseCount(original) == pending_uses_by_this_node) {
               bool need_skip = false;
 #if !defined(ORT_MINIMAL_BUILD) || defined(ORT_EXTENDED_MINIMAL_BUILD)
               // If the producer node does not have external output, then we can reuse the input buffer; Otherwise,
@@ -1428,6 +1463,46 @@ class PlannerImpl {
   }
 #endif
 
+  // Tag the kAllocate tensor outputs of multi-output nodes with a shared group id so the memory
+  // pattern planner can place them back-to-back when tracing allocations (see
+  // MemPatternPlanner::TraceAllocation). Sibling outputs are allocated together and are live
+  // together, so lifetimes always permit adjacency; consumers that walk several sibling outputs
+  // (re-concatenation after Split, attention over Q/K/V projections) then read one coherent
+  // buffer instead of blocks scattered by best-fit placement.
+  void ComputeContiguousSiblingGroups() {
+    int next_group = 0;
+    for (const auto& node : graph_viewer_.Nodes()) {
+      InlinedVector<OrtValueIndex> group;
+      for (const auto* output_def : node.OutputDefs()) {
+        if (!output_def->Exists()) {
+          continue;
+        }
+        OrtValueIndex index = -1;
+        if (!ort_value_name_idx_map_.GetIdx(output_def->Name(), index).IsOK()) {
+          continue;
+        }
+        const auto& value_plan = AllocPlan(index);
+        if (value_plan.alloc_kind != AllocKind::kAllocate ||
+            value_plan.value_type == nullptr || !value_plan.value_type->IsTensorType()) {
+          continue;
+        }
+        // Only group outputs that land on the same device; patterns are per location.
+        if (!group.empty() && !(AllocPlan(group.front()).location == value_plan.location)) {
+          continue;
+        }
+        group.push_back(index);
+      }
+
+      if (group.size() < 2) {
+        continue;
+      }
+      for (OrtValueIndex index : group) {
+        AllocPlan(index).contiguous_sibling_group = next_group;
+      }
+      ++next_group;
+    }
+  }
+
   Status ComputeReusePlan() {
     gsl::not_null<const ISequentialPlannerContext*> backup_context = context_;
     SequentialPlannerContext no_mem_reuse_context(ExecutionMode::ORT_PARALLEL, ExecutionOrder::DEFAULT, false);
@@ -1789,6 +1864,53 @@ class PlannerImpl {
   }
 #endif
 
+  // Give the initializer inputs of nodes reported hot by profiling feedback allocation-order
+  // priority: they are traced first when the weight buffer is planned, so the hottest weights are
+  // packed together at the lowest offsets and span as few memory pages as possible.
+  // Appending to initializer_allocation_order after ComputeAllocationOrder means any contiguity
+  // requirements computed there always win; entries already present keep their position.
+  Status ComputeHotNodeAllocationOrder() {
+    const auto hot_node_names = context_->GetHotNodeNames();
+    if (hot_node_names.empty()) {
+      return Status::OK();
+    }
+
+    InlinedHashMap<std::string_view, const Node*> name_to_node;
+    name_to_node.reserve(static_cast<size_t>(graph_viewer_.NumberOfNodes()));
+    for (const auto& node : graph_viewer_.Nodes()) {
+      if (!node.Name().empty()) {
+        name_to_node.emplace(node.Name(), &node);
+      }
+    }
+
+    const auto& initialized_tensors = graph_viewer_.GetAllInitializedTensors();
+    std::vector<OrtValueIndex>& initializer_allocation_order(plan_.initializer_allocation_order);
+    for (const auto& hot_node_name : hot_node_names) {
+      auto node_it = name_to_node.find(std::string_view{hot_node_name});
+      if (node_it == name_to_node.end()) {
+        // the profile may have been collected against a differently optimized graph
+        continue;
+      }
+
+      for (const auto* node_input : node_it->second->InputDefs()) {
+        if (!node_input->Exists()) continue;
+        auto init_it = initialized_tensors.find(node_input->Name());
+        // string tensors cannot be traced by the pattern planner
+        if (init_it == initialized_tensors.end() ||
+            init_it->second->data_type() == ONNX_NAMESPACE::TensorProto_DataType_STRING) {
+          continue;
+        }
+        const auto current_idx = Index(node_input->Name());
+        if (AllocPlan(current_idx).alloc_kind != AllocKind::kAllocateStatically) continue;
+        if (std::find(initializer_allocation_order.begin(), initializer_allocation_order.end(), current_idx) ==
+            initializer_allocation_order.end()) {
+          initializer_allocation_order.push_back(current_idx);
+        }
+      }
+    }
+    return Status::OK();
+  }
+
   void VerifyMemoryTimeSchedule() {
     size_t idx = 0;
     for (const auto& entry : plan_.allocation_plan) {
@@ -1830,6 +1952,15 @@ class PlannerImpl {
 
         ORT_RETURN_IF_ERROR(Node::ForEachWithIndex(node->InputDefs(), process_input));
         ORT_RETURN_IF_ERROR(Node::ForEachWithIndex(node->ImplicitInputDefs(), process_input));
+
+        // the inputs of a producer scheduled for recomputation are re-read when the producer is
+        // re-executed ahead of this node, so this node acts as an extra consumer for them
+        auto extra_it = recompute_extra_consumers_.find(node_index);
+        if (extra_it != recompute_extra_consumers_.end()) {
+          for (auto value_idx : extra_it->second) {
+            ortvalue_to_consumers_map[value_idx].push_back(node_index);
+          }
+        }
       }
     }
     // 2. build the release actions and fill into node's release list
@@ -1863,6 +1994,13 @@ class PlannerImpl {
             process_consumer(release_action_idx, node_index);
           }
         }
+        // a value scheduled for recomputation additionally gets released right after its first
+        // consumer; the RecomputeKernelStep ahead of its second consumer re-creates it
+        auto early_it = recompute_early_release_.find(static_cast<OrtValueIndex>(i));
+        if (early_it != recompute_early_release_.end()) {
+          plan_.release_actions.push_back(SequentialExecutionPlan::ReleaseAction{i, 0});
+          process_consumer(plan_.release_actions.size() - 1, early_it->second);
+        }
       }
     }
     return Status::OK();
@@ -2064,6 +2202,209 @@ class PlannerImpl {
       }
     }
 
+    // 3.5 determine the activation offload candidates: non-CPU tensors whose first use is far
+    // enough after their producer get copied to a host staging buffer after the producing kernel
+    // and copied back right before their first consumer, so the device buffer can be reused in
+    // between. Restricted to values that are produced and consumed on a single logic stream, so
+    // the stream FIFO alone orders the copies against the kernels, and to values whose buffer no
+    // other value is planned to reuse, so releasing it early cannot break a reuse chain.
+    InlinedHashMap<NodeIndex, InlinedVector<std::pair<OrtValueIndex, size_t>>> node_to_offload;
+    InlinedHashMap<NodeIndex, InlinedVector<std::pair<OrtValueIndex, size_t>>> node_to_prefetch;
+    const size_t offload_min_gap = context_->GetActivationOffloadMinGap();
+    const size_t recompute_min_gap = context_->GetActivationRecomputeMinGap();
+    InlinedHashMap<NodeIndex, size_t> node_to_stream_position;
+    InlinedHashSet<OrtValueIndex> reused_buffers;
+    InlinedHashSet<OrtValueIndex> offloaded_values;
+    if (offload_min_gap > 0 || recompute_min_gap > 0) {
+      node_to_stream_position.reserve(graph_viewer_.NumberOfNodes());
+      for (size_t i = 0; i < num_logic_streams_; ++i) {
+        for (size_t j = 0; j < stream_nodes_[i].size(); ++j) {
+          node_to_stream_position[stream_nodes_[i][j]] = j;
+        }
+      }
+
+      for (const auto& value_plan : plan_.allocation_plan) {
+        if (value_plan.alloc_kind == AllocKind::kReuse || value_plan.alloc_kind == AllocKind::kShare) {
+          reused_buffers.insert(value_plan.reused_buffer);
+        }
+      }
+    }
+    if (offload_min_gap > 0) {
+      for (size_t i = 0; i < num_logic_streams_; ++i) {
+        for (auto node_index : stream_nodes_[i]) {
+          auto* node = graph_viewer_.GetNode(node_index);
+          for (auto* output : node->OutputDefs()) {
+            if (!output->Exists()) continue;
+            OrtValueIndex value_idx;
+            ORT_THROW_IF_ERROR(ort_value_name_idx_map_.GetIdx(output->Name(), value_idx));
+            const auto& value_plan = AllocPlan(value_idx);
+            if (value_plan.alloc_kind != AllocKind::kAllocate ||
+                value_plan.location.Type() == OrtDevice::CPU ||
+                value_plan.location.MemType() != OrtDevice::MemType::DEFAULT ||
+                value_plan.value_type == nullptr || !value_plan.value_type->IsTensorType() ||
+                reused_buffers.count(value_idx) != 0) {
+              continue;
+            }
+            bool all_consumers_on_stream = true;
+            size_t first_use_position = std::numeric_limits<size_t>::max();
+            NodeIndex first_consumer = 0;
+            for (auto it = node->OutputNodesBegin(); it != node->OutputNodesEnd(); ++it) {
+              const auto& input_defs = it->InputDefs();
+              const auto& implicit_input_defs = it->ImplicitInputDefs();
+              if (std::find(input_defs.begin(), input_defs.end(), output) == input_defs.end() &&
+                  std::find(implicit_input_defs.begin(), implicit_input_defs.end(), output) ==
+                      implicit_input_defs.end()) {
+                continue;
+              }
+              if (plan_.node_stream_map_[it->Index()] != i) {
+                all_consumers_on_stream = false;
+                break;
+              }
+              size_t position = node_to_stream_position[it->Index()];
+              if (position < first_use_position) {
+                first_use_position = position;
+                first_consumer = it->Index();
+              }
+            }
+            if (!all_consumers_on_stream ||
+                first_use_position == std::numeric_limits<size_t>::max() ||
+                first_use_position - node_to_stream_position[node_index] < offload_min_gap) {
+              continue;
+            }
+            size_t staging_slot = plan_.num_offload_slots++;
+            node_to_offload[node_index].push_back({value_idx, staging_slot});
+            node_to_prefetch[first_consumer].push_back({value_idx, staging_slot});
+            offloaded_values.insert(value_idx);
+          }
+        }
+      }
+    }
+
+    // 3.6 determine the activation recomputation candidates: values from cheap, deterministic
+    // producers with a long gap between their first and second consumer get released after the
+    // first consumer and re-created by re-executing the producer ahead of the second, so they
+    // do not stay live across the gap. Restricted like offloading to values produced and
+    // consumed on a single logic stream whose buffer no other value reuses; additionally the
+    // producer must have a single output, its inputs must not themselves be scheduled for
+    // recomputation (they have to be alive at the re-execution), and the value must not feed
+    // another recompute site or already be offloaded.
+    InlinedHashMap<NodeIndex, InlinedVector<NodeIndex>> node_to_recompute;
+    if (recompute_min_gap > 0) {
+      static const InlinedHashSet<std::string_view> recomputable_ops = {
+          "Abs", "Add", "Cast", "Clip", "Div", "Elu", "Erf", "Exp", "FastGelu", "Gelu",
+          "LayerNormalization", "LeakyRelu", "Mul", "Neg", "Relu", "Sigmoid",
+          "SimplifiedLayerNormalization", "Softplus", "Sqrt", "Sub", "Tanh"};
+      InlinedHashSet<OrtValueIndex> extended_inputs;
+      for (size_t i = 0; i < num_logic_streams_; ++i) {
+        for (auto node_index : stream_nodes_[i]) {
+          auto* node = graph_viewer_.GetNode(node_index);
+          if (recomputable_ops.count(node->OpType()) == 0) {
+            continue;
+          }
+          const NodeArg* output = nullptr;
+          bool single_output = true;
+          for (auto* output_def : node->OutputDefs()) {
+            if (output_def->Exists()) {
+              if (output != nullptr) {
+                single_output = false;
+                break;
+              }
+              output = output_def;
+            }
+          }
+          if (!single_output || output == nullptr) {
+            continue;
+          }
+          OrtValueIndex value_idx;
+          ORT_THROW_IF_ERROR(ort_value_name_idx_map_.GetIdx(output->Name(), value_idx));
+          const auto& value_plan = AllocPlan(value_idx);
+          if (value_plan.alloc_kind != AllocKind::kAllocate ||
+              value_plan.value_type == nullptr || !value_plan.value_type->IsTensorType() ||
+              reused_buffers.count(value_idx) != 0 ||
+              offloaded_values.count(value_idx) != 0 ||
+              extended_inputs.count(value_idx) != 0) {
+            continue;
+          }
+          // collect the distinct consumers; they all have to be on the producer's stream so the
+          // stream FIFO orders the early release and the re-execution against the kernels
+          bool all_consumers_on_stream = true;
+          InlinedHashMap<NodeIndex, size_t> consumer_positions;
+          for (auto it = node->OutputNodesBegin(); it != node->OutputNodesEnd(); ++it) {
+            const auto& input_defs = it->InputDefs();
+            const auto& implicit_input_defs = it->ImplicitInputDefs();
+            if (std::find(input_defs.begin(), input_defs.end(), output) == input_defs.end() &&
+                std::find(implicit_input_defs.begin(), implicit_input_defs.end(), output) ==
+                    implicit_input_defs.end()) {
+              continue;
+            }
+            if (plan_.node_stream_map_[it->Index()] != i) {
+              all_consumers_on_stream = false;
+              break;
+            }
+            consumer_positions[it->Index()] = node_to_stream_position[it->Index()];
+          }
+          if (!all_consumers_on_stream || consumer_positions.size() < 2) {
+            continue;
+          }
+          NodeIndex first_consumer = 0, second_consumer = 0;
+          size_t first_position = std::numeric_limits<size_t>::max();
+          size_t second_position = std::numeric_limits<size_t>::max();
+          for (const auto& [consumer, position] : consumer_positions) {
+            if (position < first_position) {
+              second_position = first_position;
+              second_consumer = first_consumer;
+              first_position = position;
+              first_consumer = consumer;
+            } else if (position < second_position) {
+              second_position = position;
+              second_consumer = consumer;
+            }
+          }
+          if (second_position - first_position < recompute_min_gap) {
+            continue;
+          }
+          // the producer's inputs are re-read at the re-execution; collect the origin buffers
+          // whose lifetime has to be extended and reject the candidate if one of them may not
+          // hold its value by then: an input scheduled for recomputation itself may already be
+          // released, a buffer another value reuses is overwritten by the reuser (deferring its
+          // release does not stop plan-level reuse), and an offloaded input's device buffer is
+          // released after its producer
+          bool inputs_alive_at_recompute = true;
+          InlinedVector<OrtValueIndex> input_origins;
+          auto process_input = [&](const NodeArg& input, size_t /*arg_idx*/) {
+            if (input.Exists()) {
+              int input_idx;
+              ORT_RETURN_IF_ERROR(ort_value_name_idx_map_.GetIdx(input.Name(), input_idx));
+              auto origin = AllocPlan(input_idx).reused_buffer;
+              if (AllocPlan(origin).alloc_kind == AllocKind::kAllocate ||
+                  AllocPlan(origin).alloc_kind == AllocKind::kAllocatedExternally) {
+                if (recompute_early_release_.count(origin) != 0 ||
+                    reused_buffers.count(origin) != 0 ||
+                    offloaded_values.count(origin) != 0) {
+                  inputs_alive_at_recompute = false;
+                } else {
+                  input_origins.push_back(origin);
+                }
+              }
+            }
+            return Status::OK();
+          };
+          ORT_THROW_IF_ERROR(Node::ForEachWithIndex(node->InputDefs(), process_input));
+          ORT_THROW_IF_ERROR(Node::ForEachWithIndex(node->ImplicitInputDefs(), process_input));
+          if (!inputs_alive_at_recompute) {
+            continue;
+          }
+          recompute_early_release_[value_idx] = first_consumer;
+          auto& extras = recompute_extra_consumers_[second_consumer];
+          for (auto origin : input_origins) {
+            extras.push_back(origin);
+            extended_inputs.insert(origin);
+          }
+          node_to_recompute[second_consumer].push_back(node_index);
+        }
+      }
+    }
+
     // 4. add commands to logic queue
     for (size_t i = 0; i < num_logic_streams_; ++i) {
       for (size_t j = 0; j < stream_nodes_[i].size(); ++j) {
@@ -2072,6 +2413,15 @@ class PlannerImpl {
           // add dependency for current logic stream
           dependence_graph_[node_index].insert(stream_nodes_[i][j - 1]);
         }
+        // copy offloaded activations this node consumes first back to the device, ahead of the
+        // barriers and the kernel launch
+        auto prefetch_it = node_to_prefetch.find(node_index);
+        if (prefetch_it != node_to_prefetch.end()) {
+          for (const auto& [value_idx, staging_slot] : prefetch_it->second) {
+            execution_plan[i]->steps_.emplace_back(std::make_unique<PrefetchFromHostStep>(value_idx, staging_slot,
+                                                                                          node_index));
+          }
+        }
         auto* node = graph_viewer_.GetNode(node_index);
         std::unordered_set<NodeIndex> visited;  // TODO(leca): See the bug description in PlannerTest.MultiStreamMultiOutput. Can remove this variable once this bug is fixed
         for (auto it = node->InputNodesBegin(); it != node->InputNodesEnd(); ++it) {
@@ -2109,12 +2459,34 @@ class PlannerImpl {
           // add dependency for model graph
           dependence_graph_[it->Index()].insert(node_index);
         }
+        // re-execute the cheap producers whose output was released after its first use, so the
+        // value is live again for this node; the kernel re-allocates its output lazily
+        auto recompute_it = node_to_recompute.find(node_index);
+        if (recompute_it != node_to_recompute.end()) {
+          for (auto producer_index : recompute_it->second) {
+#if defined(ORT_MINIMAL_BUILD)
+            execution_plan[i]->steps_.emplace_back(std::make_unique<RecomputeKernelStep>(producer_index));
+#else
+            execution_plan[i]->steps_.emplace_back(std::make_unique<RecomputeKernelStep>(producer_index,
+                                                                                         graph_viewer_.GetNode(producer_index)->Name()));
+#endif
+          }
+        }
 // push launch kernel command
 #if defined(ORT_MINIMAL_BUILD)
         execution_plan[i]->steps_.emplace_back(std::make_unique<LaunchKernelStep>(node_index));
 #else
         execution_plan[i]->steps_.emplace_back(std::make_unique<LaunchKernelStep>(node_index, graph_viewer_.GetNode(node_index)->Name()));
 #endif
+        // spill this node's cold outputs to host staging memory; the copy is enqueued on the
+        // stream right after the kernel, then the device buffer is released for reuse
+        auto offload_it = node_to_offload.find(node_index);
+        if (offload_it != node_to_offload.end()) {
+          for (const auto& [value_idx, staging_slot] : offload_it->second) {
+            execution_plan[i]->steps_.emplace_back(std::make_unique<OffloadToHostStep>(value_idx, staging_slot,
+                                                                                       node_index));
+          }
+        }
         // check if any notification generated by this node, if yes, push a activate
         auto notification_it = node_to_notification.find(node_index);
         if (notification_it != node_to_notification.end()) {
@@ -2306,6 +2678,9 @@ Status PlannerImpl::CreatePlan(
   // determine sharing/reuse among ml-values
   ORT_RETURN_IF_ERROR(ComputeReusePlan());
 
+  // group sibling outputs for contiguous placement by the memory pattern planner
+  ComputeContiguousSiblingGroups();
+
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
   // Adjust the allocate and lifetime intervals for all ml-values, based on their allocation kind.
   AdjustInplaceLifeIntervals();
@@ -2316,6 +2691,9 @@ Status PlannerImpl::CreatePlan(
   ORT_RETURN_IF_ERROR(ComputeAllocationOrder());
 #endif
 
+  // Give weights of profiled hot nodes allocation-order priority.
+  ORT_RETURN_IF_ERROR(ComputeHotNodeAllocationOrder());
+
   // convert information in the freelist_ into a deallocation plan in required format
   ORT_RETURN_IF_ERROR(GenerateDeallocationPlan());
 
@@ -2541,6 +2919,199 @@ void DeviceBasedPartitioner::SaveConfig() const {
   }
 }
 
+/*
+DependencyBasedPartitioner stores config in json format:
+------------------------------------------------------
+{
+"type":"DependencyBasedPartitioner",
+"max_streams_per_device":4,
+"min_nodes_per_stream":3
+}
+------------------------------------------------------
+Unlike DeviceBasedPartitioner, which gives each device a single stream, this partitioner
+decomposes the nodes of every device into dependency-linked chains: a node continues its
+producer's chain when that producer is still the chain's tail, otherwise it starts a new one.
+Independent branches of the graph thereby land in separate logic streams and execute
+concurrently on the inter-op thread pool, while the barrier/trigger steps the plan builder
+emits for cross-stream edges keep dependencies intact.
+"min_nodes_per_stream" is the cost threshold below which a chain is folded back into its
+producer's chain, so short runs of tiny kernels don't pay cross-stream synchronization;
+"max_streams_per_device" bounds the total parallelism per device.
+*/
+class DependencyBasedPartitioner : public IGraphPartitioner {
+ public:
+  DependencyBasedPartitioner(const logging::Logger& logger,
+                             const PathString& config_file) : IGraphPartitioner(logger, config_file) {
+    Initialize();
+  }
+
+  Status PartitionGraph(const onnxruntime::GraphViewer& graph_viewer,
+                        const ExecutionProviders& execution_providers,
+                        std::vector<InlinedVector<NodeIndex>>& stream_nodes,
+                        ExecutionOrder execution_order) override;
+
+  const char* Type() const override { return "DependencyBasedPartitioner"; }
+  size_t Streams() const override { return num_streams_; }
+
+ private:
+  void Initialize();
+
+  int max_streams_per_device_ = 4;
+  int min_nodes_per_stream_ = 3;
+  size_t num_streams_ = 0;
+};
+
+Status DependencyBasedPartitioner::PartitionGraph(const onnxruntime::GraphViewer& graph_viewer,
+                                                  const ExecutionProviders& execution_providers,
+                                                  std::vector<InlinedVector<NodeIndex>>& stream_nodes,
+                                                  ExecutionOrder execution_order) {
+  const auto& p_graph_nodes = graph_viewer.GetNodesInTopologicalOrder(execution_order);
+
+  struct Chain {
+    OrtDevice::DeviceType device;
+    NodeIndex head;
+    NodeIndex tail;
+    size_t size;
+    size_t merged_into;  // equals the chain's own index while the chain has not been folded
+  };
+  std::vector<Chain> chains;
+  InlinedHashMap<NodeIndex, size_t> node_chain;
+  node_chain.reserve(p_graph_nodes.size());
+
+  // 1. Decompose the nodes of each device into chains. Processing in topological order
+  // guarantees a producer's chain exists before any of its consumers is looked at.
+  for (auto node_index : p_graph_nodes) {
+    const auto* node = graph_viewer.GetNode(node_index);
+    auto* ep = execution_providers.Get(*node);
+    auto device_type = ep->GetOrtDeviceByMemType(OrtMemType::OrtMemTypeDefault).Type();
+
+    constexpr size_t kNoChain = std::numeric_limits<size_t>::max();
+    size_t chain = kNoChain;
+    for (auto it = node->InputNodesBegin(); it != node->InputNodesEnd(); ++it) {
+      auto producer_it = node_chain.find(it->Index());
+      if (producer_it != node_chain.end()) {
+        const auto& candidate = chains[producer_it->second];
+        if (candidate.device == device_type && candidate.tail == it->Index()) {
+          chain = producer_it->second;
+          break;
+        }
+      }
+    }
+
+    if (chain == kNoChain) {
+      chain = chains.size();
+      chains.push_back({device_type, node_index, node_index, 0, chain});
+    }
+
+    chains[chain].tail = node_index;
+    chains[chain].size += 1;
+    node_chain[node_index] = chain;
+  }
+
+  auto resolve = [&chains](size_t chain) {
+    while (chains[chain].merged_into != chain) {
+      chain = chains[chain].merged_into;
+    }
+    return chain;
+  };
+
+  // 2. Fold chains below the cost threshold into the chain of the head node's producer (or,
+  // failing that, an earlier chain on the same device). A producer's chain always has a smaller
+  // index than its consumers' chains, so the merge links cannot form a cycle.
+  for (size_t i = 0; i < chains.size(); ++i) {
+    if (chains[i].size >= static_cast<size_t>(min_nodes_per_stream_)) {
+      continue;
+    }
+    const auto* head = graph_viewer.GetNode(chains[i].head);
+    size_t target = i;
+    for (auto it = head->InputNodesBegin(); it != head->InputNodesEnd(); ++it) {
+      auto producer_it = node_chain.find(it->Index());
+      if (producer_it != node_chain.end()) {
+        size_t candidate = resolve(producer_it->second);
+        if (candidate != i && chains[candidate].device == chains[i].device) {
+          target = candidate;
+          break;
+        }
+      }
+    }
+    if (target == i) {
+      for (size_t j = 0; j < i; ++j) {
+        if (resolve(j) == j && chains[j].device == chains[i].device) {
+          target = j;
+          break;
+        }
+      }
+    }
+    if (target != i) {
+      chains[i].merged_into = target;
+      chains[target].size += chains[i].size;
+      chains[i].size = 0;
+    }
+  }
+
+  // 3. Cap the parallelism per device: keep the biggest chains as stream seeds and distribute
+  // the rest over them. The seeds are never folded afterwards, so these links stay acyclic too.
+  InlinedHashMap<OrtDevice::DeviceType, InlinedVector<size_t>> device_chains;
+  for (size_t i = 0; i < chains.size(); ++i) {
+    if (resolve(i) == i && chains[i].size > 0) {
+      device_chains[chains[i].device].push_back(i);
+    }
+  }
+  for (auto& device_entry : device_chains) {
+    auto& kept = device_entry.second;
+    const size_t max_streams = static_cast<size_t>(max_streams_per_device_);
+    if (kept.size() <= max_streams) {
+      continue;
+    }
+    std::sort(kept.begin(), kept.end(),
+              [&chains](size_t a, size_t b) { return chains[a].size > chains[b].size; });
+    for (size_t i = max_streams; i < kept.size(); ++i) {
+      chains[kept[i]].merged_into = kept[i % max_streams];
+    }
+  }
+
+  // 4. Emit the streams. Walking the topological order keeps every stream topologically
+  // sorted, which the in-order execution of a logic stream relies on.
+  stream_nodes.clear();
+  InlinedHashMap<size_t, size_t> chain_to_stream;
+  for (auto node_index : p_graph_nodes) {
+    size_t chain = resolve(node_chain[node_index]);
+    auto it = chain_to_stream.find(chain);
+    if (it == chain_to_stream.end()) {
+      it = chain_to_stream.emplace(chain, stream_nodes.size()).first;
+      stream_nodes.emplace_back();
+    }
+    stream_nodes[it->second].push_back(node_index);
+  }
+  num_streams_ = stream_nodes.size();
+
+  LOGS(logger_, INFO) << "DependencyBasedPartitioner partitioned " << p_graph_nodes.size()
+                      << " nodes into " << num_streams_ << " logic streams";
+  return Status::OK();
+}
+
+void DependencyBasedPartitioner::Initialize() {
+  if (config_file_.empty()) {
+    return;
+  }
+  std::ifstream if_stream(config_file_);
+  if (!if_stream.is_open()) {
+    return;
+  }
+  try {
+    json json_config = json::parse(if_stream);
+    if (json_config.contains("max_streams_per_device")) {
+      max_streams_per_device_ = std::max(1, json_config["max_streams_per_device"].get<int>());
+    }
+    if (json_config.contains("min_nodes_per_stream")) {
+      min_nodes_per_stream_ = std::max(1, json_config["min_nodes_per_stream"].get<int>());
+    }
+  } catch (const std::exception& ex) {
+    LOGS(logger_, WARNING) << "Caught exception when reading DependencyBasedPartitioner config: " << ex.what();
+  }
+  if_stream.close();
+}
+
 std::unique_ptr<IGraphPartitioner> IGraphPartitioner::CreateGraphPartitioner(const logging::Logger& logger,
                                                                              const PathString& config_file) {
   // use device based partitioner by default
@@ -2555,6 +3126,8 @@ std::unique_ptr<IGraphPartitioner> IGraphPartitioner::CreateGraphPartitioner(con
           auto type = json_config["type"];
           if (type == "DeviceBasedPartitioner") {
             partitioner_type = IGraphPartitioner::GraphPartitioningStrategy::DeviceBasedPartition;
+          } else if (type == "DependencyBasedPartitioner") {
+            partitioner_type = IGraphPartitioner::GraphPartitioningStrategy::DependencyBasedPartition;
           }
         }
       } catch (const std::exception& ex) {
@@ -2566,6 +3139,8 @@ std::unique_ptr<IGraphPartitioner> IGraphPartitioner::CreateGraphPartitioner(con
   if (partitioner_type == IGraphPartitioner::GraphPartitioningStrategy::DeviceBasedPartition) {
     LOGS(logger, INFO) << "Use DeviceBasedPartition as default";
     return std::make_unique<DeviceBasedPartitioner>(logger, config_file);
+  } else if (partitioner_type == IGraphPartitioner::GraphPartitioningStrategy::DependencyBasedPartition) {
+    return std::make_unique<DependencyBasedPartitioner>(logger, config_file);
   }  // else if other partitioner types ...
   ORT_THROW("Failed to create partitioner");
 }
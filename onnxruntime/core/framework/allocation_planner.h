@@ -46,15 +46,37 @@ class ISequentialPlannerContext {
   virtual ExecutionOrder GetExecutionOrder() const { return ExecutionOrder::DEFAULT; }
 
   virtual bool GetEnableMemoryReuse() const { return true; }
+
+  // Names of nodes reported hot by profiling feedback, ordered hottest first.
+  // The planner gives the initializer inputs of these nodes allocation-order priority.
+  // See kOrtSessionOptionsConfigProfilingHotNodeNames.
+  virtual gsl::span<const std::string> GetHotNodeNames() const { return {}; }
+
+  // Minimum number of nodes between a value's producer and its first consumer within a logic
+  // stream for the planner to spill the value to host memory in between. 0 disables activation
+  // offloading. See kOrtSessionOptionsActivationOffloadMinGap.
+  virtual size_t GetActivationOffloadMinGap() const { return 0; }
+
+  // Minimum number of nodes between a value's first and second consumer within a logic stream
+  // for the planner to release the value at the first use and recompute it ahead of the second.
+  // 0 disables activation recomputation. See kOrtSessionOptionsActivationRecomputeMinGap.
+  virtual size_t GetActivationRecomputeMinGap() const { return 0; }
+
   virtual ~ISequentialPlannerContext() = default;
 };
 
 class SequentialPlannerContext : public ISequentialPlannerContext {
  public:
-  SequentialPlannerContext(ExecutionMode execution_mode, ExecutionOrder execution_order, bool enable_memory_reuse)
+  SequentialPlannerContext(ExecutionMode execution_mode, ExecutionOrder execution_order, bool enable_memory_reuse,
+                           std::vector<std::string> hot_node_names = {},
+                           size_t activation_offload_min_gap = 0,
+                           size_t activation_recompute_min_gap = 0)
       : execution_mode_(execution_mode),
         execution_order_(execution_order),
-        enable_memory_reuse_(enable_memory_reuse) {
+        enable_memory_reuse_(enable_memory_reuse),
+        hot_node_names_(std::move(hot_node_names)),
+        activation_offload_min_gap_(activation_offload_min_gap),
+        activation_recompute_min_gap_(activation_recompute_min_gap) {
   }
 
   const ONNX_NAMESPACE::TensorShapeProto* GetShape(const onnxruntime::NodeArg& arg) const override {
@@ -67,10 +89,19 @@ class SequentialPlannerContext : public ISequentialPlannerContext {
 
   bool GetEnableMemoryReuse() const override { return enable_memory_reuse_; }
 
+  gsl::span<const std::string> GetHotNodeNames() const override { return hot_node_names_; }
+
+  size_t GetActivationOffloadMinGap() const override { return activation_offload_min_gap_; }
+
+  size_t GetActivationRecomputeMinGap() const override { return activation_recompute_min_gap_; }
+
  private:
   ExecutionMode execution_mode_ = ExecutionMode::ORT_SEQUENTIAL;
   ExecutionOrder execution_order_ = ExecutionOrder::DEFAULT;
   bool enable_memory_reuse_ = true;
+  std::vector<std::string> hot_node_names_;
+  size_t activation_offload_min_gap_ = 0;
+  size_t activation_recompute_min_gap_ = 0;
 };
 
 #ifdef ORT_ENABLE_STREAM
@@ -82,9 +113,11 @@ class IGraphPartitioner {
   // DeviceBasedPartitioner is the default, who partitions a graph based off device information.
   // i.e., given a graph which has CPU EP nodes, Cuda EP nodes and TRT EP nodes,
   // it will be partitioned as two sequences, one is for CPU EP nodes, another is for TRT and Cuda nodes.
-  // We will add more optimized partitioner later.
+  // DependencyBasedPartitioner additionally splits each device's nodes into dependency-linked
+  // chains, so independent branches of the graph get their own sequence and can run concurrently.
   enum GraphPartitioningStrategy {
     DeviceBasedPartition = 0,
+    DependencyBasedPartition,
     Unknown,
   };
   virtual ~IGraphPartitioner() = default;
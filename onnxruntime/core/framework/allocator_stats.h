@@ -22,6 +22,7 @@ struct AllocatorStats {
                                   // is known. Certain allocator may return 0 to indicate the limit is
                                   // unknown.
   int64_t bytes_limit;
+  int64_t largest_free_chunk_bytes;  // Size of the largest free chunk (Relevant only for arena based allocators)
 
   AllocatorStats() { Clear(); }
 
@@ -35,6 +36,7 @@ struct AllocatorStats {
     this->max_alloc_size = 0;
     this->bytes_limit = 0;
     this->total_allocated_bytes = 0;
+    this->largest_free_chunk_bytes = 0;
   }
 
   std::string DebugString() const {
@@ -47,7 +49,8 @@ struct AllocatorStats {
        << "NumReserves:              " << this->num_reserves << "\n"
        << "NumArenaExtensions:       " << this->num_arena_extensions << "\n"
        << "NumArenaShrinkages:       " << this->num_arena_shrinkages << "\n"
-       << "MaxAllocSize:             " << this->max_alloc_size << "\n";
+       << "MaxAllocSize:             " << this->max_alloc_size << "\n"
+       << "LargestFreeChunk:         " << this->largest_free_chunk_bytes << "\n";
     return ss.str();
   }
 };
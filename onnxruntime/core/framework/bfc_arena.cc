@@ -211,8 +211,15 @@ Status BFCArena::Extend(size_t rounded_bytes) {
 
   LOGS_DEFAULT(INFO) << "Allocated memory at " << mem_addr << " to "
                      << static_cast<void*>(static_cast<char*>(mem_addr) + bytes);
-  region_manager_.AddAllocationRegion(mem_addr, bytes, stats_.num_arena_extensions);
-  stats_.num_arena_extensions += 1;
+
+  // If the device allocator grows a single contiguous address range (e.g. a virtual memory
+  // backed allocator that maps physical pages into one reserved range), the new memory is
+  // adjacent to an existing region. Merge it into that region instead of creating a new one,
+  // so free memory can coalesce across the extension boundary and large requests don't fail
+  // with enough total free memory stranded in physically separate regions.
+  AllocationRegion* adjacent_region = device_allocator_->SupportsCoalescing()
+                                          ? region_manager_.FindRegionEndingAt(mem_addr)
+                                          : nullptr;
 
   // Create one large chunk for the whole memory space that will
   // be chunked later.
@@ -226,11 +233,28 @@ Status BFCArena::Extend(size_t rounded_bytes) {
   // assign the new created chunk to default stream, so it can be pick up by any stream
   c->stream = nullptr;
 
-  region_manager_.set_handle(c->ptr, h);
+  if (adjacent_region != nullptr) {
+    // Find the chunk that currently ends the region and link the new chunk after it, so
+    // Coalesce() can merge free space across the old region boundary.
+    ChunkHandle last_h = region_manager_.get_handle(adjacent_region->ptr());
+    while (ChunkFromHandle(last_h)->next != kInvalidChunkHandle) {
+      last_h = ChunkFromHandle(last_h)->next;
+    }
+    adjacent_region->Extend(bytes);
+    c->prev = last_h;
+    ChunkFromHandle(last_h)->next = h;
+
+    region_manager_.set_handle(c->ptr, h);
+    stats_.num_arena_extensions += 1;
+
+    InsertFreeChunkIntoBin(Coalesce(h));
+    return Status::OK();
+  }
 
-  // TODO(vrv): Try to merge this new region with an existing region,
-  // if the address space is contiguous, to avoid fragmentation
-  // across regions.
+  region_manager_.AddAllocationRegion(mem_addr, bytes, stats_.num_arena_extensions);
+  stats_.num_arena_extensions += 1;
+
+  region_manager_.set_handle(c->ptr, h);
 
   // Insert the chunk into the right bin.
   InsertFreeChunkIntoBin(h);
@@ -268,7 +292,36 @@ size_t BFCArena::RoundedBytes(size_t bytes) {
   return rounded_bytes;
 }
 
+void BFCArena::SetMemoryBudget(size_t budget_bytes, MemoryPressureCallback callback) {
+  std::lock_guard<OrtMutex> lock(lock_);
+  budget_bytes_ = budget_bytes;
+  memory_pressure_callback_ = std::move(callback);
+}
+
+void BFCArena::RelieveMemoryPressure(size_t num_bytes) {
+  size_t overage = 0;
+  MemoryPressureCallback callback;
+  {
+    std::lock_guard<OrtMutex> lock(lock_);
+    if (budget_bytes_ == 0 || !memory_pressure_callback_) {
+      return;
+    }
+
+    const size_t projected_bytes_in_use = static_cast<size_t>(stats_.bytes_in_use) + RoundedBytes(num_bytes);
+    if (projected_bytes_in_use <= budget_bytes_) {
+      return;
+    }
+
+    overage = projected_bytes_in_use - budget_bytes_;
+    callback = memory_pressure_callback_;
+  }
+
+  // invoked without lock_ so the callback can free memory owned by this arena
+  callback(overage);
+}
+
 void* BFCArena::Alloc(size_t size) {
+  RelieveMemoryPressure(size);
   return AllocateRawInternal(size, false, nullptr, false, nullptr);
 }
 
@@ -379,6 +432,18 @@ void* BFCArena::AllocateRawInternal(size_t num_bytes,
 void BFCArena::GetStats(AllocatorStats* stats) {
   std::lock_guard<OrtMutex> lock(lock_);
   *stats = stats_;
+  // The largest free chunk bounds the biggest request that can be satisfied without extending the
+  // arena; together with the total free bytes it gives the live fragmentation ratio. Bins are
+  // sorted by chunk size, so the largest free chunk is the last entry of the highest non-empty
+  // bin and the scan is O(kNumBins) - cheap enough to poll while inference is running.
+  stats->largest_free_chunk_bytes = 0;
+  for (BinNum bin_num = kNumBins - 1; bin_num >= 0; bin_num--) {
+    const Bin::FreeChunkSet& free_chunks = BinFromIndex(bin_num)->free_chunks;
+    if (!free_chunks.empty()) {
+      stats->largest_free_chunk_bytes = static_cast<int64_t>(ChunkFromHandle(*free_chunks.rbegin())->size);
+      break;
+    }
+  }
 }
 
 BFCArena::Chunk* BFCArena::SplitFreeChunkFromBin(BFCArena::Bin::FreeChunkSet* free_chunks,
@@ -517,6 +582,12 @@ Status BFCArena::Shrink() {
   region_sizes.reserve(num_regions);
 
   for (const auto& region : region_manager_.regions()) {
+    // A region that has been extended in place spans multiple allocations from the device
+    // allocator, so it cannot be returned with a single Free() of its base pointer - skip it.
+    // The device allocator releases the backing memory when the arena is destroyed.
+    if (region.extended()) {
+      continue;
+    }
     if (consider_first_allocation_region_for_shrinkage_ || region.id() != 0) {
       region_ptrs.push_back(region.ptr());
       region_sizes.push_back(region.memory_size());
@@ -868,6 +939,7 @@ StreamAwareArena::StreamAwareArena(std::unique_ptr<IAllocator> resource_allocato
 }
 
 void* StreamAwareArena::AllocOnStream(size_t size, Stream* current_stream, WaitNotificationFn wait_fn) {
+  RelieveMemoryPressure(size);
   return AllocateRawInternal(size, false, current_stream, enable_cross_stream_reusing_, wait_fn);
 }
 
@@ -16,6 +16,7 @@ limitations under the License.
 
 #pragma once
 #include <array>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <sstream>
@@ -103,6 +104,19 @@ class BFCArena : public IAllocator {
 
   ArenaType GetArenaType() const { return arena_type_; }
 
+  // Returns the number of bytes the callback released; see SetMemoryBudget.
+  using MemoryPressureCallback = std::function<size_t(size_t bytes_needed)>;
+
+  // Installs a soft byte budget below the arena's hard memory limit. Before an allocation that
+  // would push bytes_in_use past budget_bytes the callback is invoked - without the arena lock
+  // held, so it may free memory from this arena - with the number of bytes by which the budget
+  // would be exceeded, giving the owner a chance to evict reclaimable state (memoization
+  // caches, free arena regions) first. The allocation then proceeds regardless of how many
+  // bytes were released; the hard limit stays the max_mem the arena was created with.
+  // Pass 0 and nullptr to remove the budget. Install before the arena serves concurrent
+  // allocations; the callback itself must not allocate from this arena while over budget.
+  void SetMemoryBudget(size_t budget_bytes, MemoryPressureCallback callback);
+
   virtual void SecureTheChunk(Stream* /*chunk_stream*/,
                               Stream* /*target_stream*/,
                               WaitNotificationFn /*wait_fn*/) const {}
@@ -259,12 +273,32 @@ class BFCArena : public IAllocator {
     void* end_ptr() const { return end_ptr_; }
     size_t memory_size() const { return memory_size_; }
     int64_t id() const { return id_; }
+    bool extended() const { return extended_; }
     ChunkHandle get_handle(const void* p) const {
       return handles_[IndexFor(p)];
     }
     void set_handle(const void* p, ChunkHandle h) { handles_[IndexFor(p)] = h; }
     void erase(const void* p) { set_handle(p, kInvalidChunkHandle); }
 
+    // Grow the region by 'extension_size' bytes. Only valid if the memory directly following
+    // end_ptr() belongs to this arena, i.e. the device allocator returned an adjacent range.
+    void Extend(size_t extension_size) {
+      ORT_ENFORCE(0 == extension_size % kMinAllocationSize);
+      const size_t old_n_handles = memory_size_ / kMinAllocationSize;
+      memory_size_ += extension_size;
+      end_ptr_ = static_cast<void*>(static_cast<char*>(ptr_) + memory_size_);
+      const size_t n_handles = memory_size_ / kMinAllocationSize;
+      auto new_handles = std::make_unique<ChunkHandle[]>(n_handles);
+      for (size_t i = 0; i < old_n_handles; i++) {
+        new_handles[i] = handles_[i];
+      }
+      for (size_t i = old_n_handles; i < n_handles; i++) {
+        new_handles[i] = kInvalidChunkHandle;
+      }
+      handles_ = std::move(new_handles);
+      extended_ = true;
+    }
+
    private:
     void Swap(AllocationRegion& other) {
       std::swap(ptr_, other.ptr_);
@@ -272,6 +306,7 @@ class BFCArena : public IAllocator {
       std::swap(end_ptr_, other.end_ptr_);
       std::swap(id_, other.id_);
       std::swap(handles_, other.handles_);
+      std::swap(extended_, other.extended_);
     }
 
     int IndexFor(const void* p) const {
@@ -289,6 +324,9 @@ class BFCArena : public IAllocator {
     // A unique identifier for this allocation region
     // (May be used by the client to track which allocation region was allocated first, second, and so on)
     int64_t id_ = -1;
+    // True if the region has been grown via Extend(), in which case it spans more than one
+    // allocation from the device allocator.
+    bool extended_ = false;
 
     // Array of size "memory_size / kMinAllocationSize".  It is
     // indexed by (p-base) / kMinAllocationSize, contains ChunkHandle
@@ -333,6 +371,18 @@ class BFCArena : public IAllocator {
     }
     void erase(const void* p) { return MutableRegionFor(p)->erase(p); }
 
+    // Returns the region whose memory ends exactly at 'p', or nullptr if there is none.
+    // Used to detect that a new allocation from the device allocator is adjacent to an
+    // existing region so the two can be merged.
+    AllocationRegion* FindRegionEndingAt(const void* p) {
+      for (auto& region : regions_) {
+        if (region.end_ptr() == p) {
+          return &region;
+        }
+      }
+      return nullptr;
+    }
+
     const std::vector<AllocationRegion>& regions() const { return regions_; }
 
    private:
@@ -365,6 +415,10 @@ class BFCArena : public IAllocator {
   // Returns 'bytes' rounded up to the next highest kMinAllocationSize.
   size_t RoundedBytes(size_t bytes);
 
+  // Invokes the memory pressure callback when allocating num_bytes would push bytes_in_use past
+  // the budget. Called by Alloc/AllocOnStream before lock_ is taken; a no-op without a budget.
+  void RelieveMemoryPressure(size_t num_bytes);
+
   // Try to add a new memory region that can satisfy an allocation of
   // 'rounded_bytes' bytes.
   Status Extend(size_t rounded_bytes);
@@ -431,6 +485,10 @@ class BFCArena : public IAllocator {
 
   // Structures immutable after construction
   size_t memory_limit_ = 0;
+
+  // Soft budget; 0 means no budget. See SetMemoryBudget.
+  size_t budget_bytes_ = 0;
+  MemoryPressureCallback memory_pressure_callback_;
   ArenaExtendStrategy arena_extend_strategy_ = ArenaExtendStrategy::kNextPowerOfTwo;
 
   int Log2FloorNonZeroSlow(uint64_t n) {
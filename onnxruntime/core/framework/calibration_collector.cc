@@ -0,0 +1,67 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/calibration_collector.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "core/framework/tensor.h"
+
+namespace onnxruntime {
+
+namespace {
+
+// Single pass batch min/max. NaNs are skipped so a padded or partially initialized output does
+// not poison the running range. The straight-line loop vectorizes under the default build flags.
+template <typename T>
+void ScanMinMax(gsl::span<const T> data, double& batch_min, double& batch_max) {
+  T lo = std::numeric_limits<T>::infinity();
+  T hi = -std::numeric_limits<T>::infinity();
+  for (const T v : data) {
+    if (std::isnan(v)) {
+      continue;
+    }
+    lo = std::min(lo, v);
+    hi = std::max(hi, v);
+  }
+  batch_min = static_cast<double>(lo);
+  batch_max = static_cast<double>(hi);
+}
+
+}  // namespace
+
+void CalibrationCollector::Collect(const std::string& name, const Tensor& tensor) {
+  if (tensor.Location().device.Type() != OrtDevice::CPU || tensor.Shape().Size() == 0) {
+    return;
+  }
+
+  double batch_min = 0.0;
+  double batch_max = 0.0;
+  if (tensor.IsDataType<float>()) {
+    ScanMinMax<float>(tensor.DataAsSpan<float>(), batch_min, batch_max);
+  } else if (tensor.IsDataType<double>()) {
+    ScanMinMax<double>(tensor.DataAsSpan<double>(), batch_min, batch_max);
+  } else {
+    return;
+  }
+
+  if (batch_min > batch_max) {
+    return;  // all NaN
+  }
+
+  std::lock_guard<OrtMutex> guard(mutex_);
+  TensorStats& stats = stats_[name];
+  stats.min = std::min(stats.min, batch_min);
+  stats.max = std::max(stats.max, batch_max);
+  stats.absmax = std::max(stats.absmax, std::max(std::abs(batch_min), std::abs(batch_max)));
+  stats.num_elements += static_cast<uint64_t>(tensor.Shape().Size());
+  stats.num_updates += 1;
+}
+
+std::map<std::string, CalibrationCollector::TensorStats> CalibrationCollector::GetStats() const {
+  std::lock_guard<OrtMutex> guard(mutex_);
+  return stats_;
+}
+
+}  // namespace onnxruntime
@@ -0,0 +1,65 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <limits>
+#include <map>
+#include <string>
+
+#include "core/common/common.h"
+#include "core/common/inlined_containers.h"
+#include "core/platform/ort_mutex.h"
+
+namespace onnxruntime {
+class Tensor;
+
+/**
+ * Streaming min/max collector for quantization calibration, fed from node outputs during normal
+ * inference so calibration can run on production traffic instead of a separate dump-and-replay
+ * flow.
+ *
+ * Each observed tensor is scanned once for its batch min/max outside any lock; only the merge of
+ * those two scalars into the running statistics takes the mutex, so the per-node overhead is one
+ * pass over data that is typically still cache-resident from the kernel that produced it. Only
+ * float and double CPU tensors contribute; everything else is ignored.
+ *
+ * The collected ranges are what a MinMax calibrator needs to derive quantization parameters. A
+ * snapshot can be taken at any time while inference is running via GetStats(), exposed through
+ * OrtApi::SessionGetCalibrationStats.
+ */
+class CalibrationCollector {
+ public:
+  struct TensorStats {
+    double min = std::numeric_limits<double>::infinity();
+    double max = -std::numeric_limits<double>::infinity();
+    // Largest absolute value seen; convenient for symmetric quantization.
+    double absmax = 0.0;
+    uint64_t num_elements = 0;
+    uint64_t num_updates = 0;
+  };
+
+  // tensor_names: node output names to observe. An empty set observes every floating point
+  // output in the graph.
+  explicit CalibrationCollector(InlinedHashSet<std::string> tensor_names)
+      : tensor_names_(std::move(tensor_names)) {}
+
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(CalibrationCollector);
+
+  bool ShouldCollect(const std::string& name) const {
+    return tensor_names_.empty() || tensor_names_.find(name) != tensor_names_.end();
+  }
+
+  // Folds 'tensor' into the running statistics for 'name'. Thread-safe.
+  void Collect(const std::string& name, const Tensor& tensor);
+
+  // Copy of the current statistics, ordered by tensor name for stable output.
+  std::map<std::string, TensorStats> GetStats() const;
+
+ private:
+  InlinedHashSet<std::string> tensor_names_;
+  mutable OrtMutex mutex_;
+  std::map<std::string, TensorStats> stats_;
+};
+
+}  // namespace onnxruntime
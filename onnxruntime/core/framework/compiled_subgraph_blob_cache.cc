@@ -0,0 +1,264 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/compiled_subgraph_blob_cache.h"
+
+#if !defined(ORT_MINIMAL_BUILD) || defined(ORT_EXTENDED_MINIMAL_BUILD)
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+#include "core/framework/murmurhash3.h"
+#include "core/graph/graph_viewer.h"
+#include "core/graph/onnx_protobuf.h"
+#include "core/graph/op_identifier_utils.h"
+
+namespace onnxruntime {
+
+CompiledSubgraphBlobCache& CompiledSubgraphBlobCache::Instance() {
+  static CompiledSubgraphBlobCache instance;
+  return instance;
+}
+
+std::filesystem::path CompiledSubgraphBlobCache::BackingFilePath(HashValue key) const {
+  std::ostringstream oss;
+  oss << std::hex << std::setfill('0') << std::setw(16) << key << ".bin";
+  return backing_directory_ / oss.str();
+}
+
+bool CompiledSubgraphBlobCache::Get(HashValue key, std::string& blob) const {
+  std::lock_guard<OrtMutex> lock(mutex_);
+
+  auto it = blobs_.find(key);
+  if (it != blobs_.end()) {
+    blob = it->second;
+    return true;
+  }
+
+  if (backing_directory_.empty()) {
+    return false;
+  }
+
+  // possibly written by an earlier process; promote a disk hit into the in-memory map
+  std::ifstream file(BackingFilePath(key), std::ios::binary);
+  if (!file) {
+    return false;
+  }
+
+  std::ostringstream contents;
+  contents << file.rdbuf();
+  if (!file.good() && !file.eof()) {
+    return false;
+  }
+
+  blob = contents.str();
+  blobs_.emplace(key, blob);
+  return true;
+}
+
+void CompiledSubgraphBlobCache::Put(HashValue key, const std::string& blob) {
+  std::lock_guard<OrtMutex> lock(mutex_);
+
+  if (!blobs_.emplace(key, blob).second) {
+    return;  // content addressed, first write wins
+  }
+
+  if (backing_directory_.empty()) {
+    return;
+  }
+
+  std::error_code ec;
+  const auto target = BackingFilePath(key);
+  if (std::filesystem::exists(target, ec)) {
+    return;
+  }
+
+  // write to a unique temporary name and rename so concurrent processes never observe a
+  // partially written blob. failure to persist is not an error; the in-memory entry stands.
+  std::ostringstream tmp_suffix;
+  tmp_suffix << ".tmp." << std::chrono::steady_clock::now().time_since_epoch().count();
+  const auto tmp_path = std::filesystem::path{target}.concat(tmp_suffix.str());
+
+  {
+    std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+    file.write(blob.data(), static_cast<std::streamsize>(blob.size()));
+    if (!file.good()) {
+      file.close();
+      std::filesystem::remove(tmp_path, ec);
+      return;
+    }
+  }
+
+  std::filesystem::rename(tmp_path, target, ec);
+  if (ec) {
+    std::filesystem::remove(tmp_path, ec);
+  }
+}
+
+void CompiledSubgraphBlobCache::SetBackingDirectory(const std::filesystem::path& directory) {
+  std::lock_guard<OrtMutex> lock(mutex_);
+
+  if (!backing_directory_.empty() || directory.empty()) {
+    return;
+  }
+
+  std::error_code ec;
+  std::filesystem::create_directories(directory, ec);
+  if (!ec) {
+    backing_directory_ = directory;
+  }
+}
+
+namespace {
+
+// accumulates a running MurmurHash3 the same way ModelMetadefIdGenerator does: each call
+// uses the current hash value as the seed for the next block
+struct SubgraphHasher {
+  uint32_t hash[4] = {0, 0, 0, 0};
+
+  void AddBytes(const void* data, size_t size) {
+    // MurmurHash3 takes an int length, so feed oversized buffers in chunks
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    while (size > 0) {
+      const auto chunk = std::min(size, static_cast<size_t>(std::numeric_limits<int32_t>::max()));
+      MurmurHash3::x86_128(bytes, static_cast<int32_t>(chunk), hash[0], &hash);
+      bytes += chunk;
+      size -= chunk;
+    }
+  }
+
+  void AddString(const std::string& str) {
+    AddBytes(str.data(), str.size());
+  }
+
+  void AddInt(uint64_t value) {
+    AddBytes(&value, sizeof(value));
+  }
+
+  HashValue Result() const {
+    return hash[0] | (uint64_t(hash[1]) << 32);
+  }
+};
+
+// hashes the parts of a TensorProto that determine its value, skipping the name so that
+// identically valued initializers with different names hash the same
+void AddTensorProtoPayload(SubgraphHasher& hasher, const ONNX_NAMESPACE::TensorProto& tensor) {
+  hasher.AddInt(static_cast<uint64_t>(tensor.data_type()));
+  hasher.AddInt(static_cast<uint64_t>(tensor.dims_size()));
+  for (const auto dim : tensor.dims()) {
+    hasher.AddInt(static_cast<uint64_t>(dim));
+  }
+
+  if (tensor.has_data_location() && tensor.data_location() == ONNX_NAMESPACE::TensorProto_DataLocation_EXTERNAL) {
+    // external payloads are identified by their location rather than read back from disk
+    for (const auto& entry : tensor.external_data()) {
+      hasher.AddString(entry.key());
+      hasher.AddString(entry.value());
+    }
+  } else if (tensor.has_raw_data()) {
+    hasher.AddString(tensor.raw_data());
+  } else if (tensor.float_data_size() > 0) {
+    hasher.AddBytes(tensor.float_data().data(), tensor.float_data_size() * sizeof(float));
+  } else if (tensor.double_data_size() > 0) {
+    hasher.AddBytes(tensor.double_data().data(), tensor.double_data_size() * sizeof(double));
+  } else if (tensor.int32_data_size() > 0) {
+    hasher.AddBytes(tensor.int32_data().data(), tensor.int32_data_size() * sizeof(int32_t));
+  } else if (tensor.int64_data_size() > 0) {
+    hasher.AddBytes(tensor.int64_data().data(), tensor.int64_data_size() * sizeof(int64_t));
+  } else if (tensor.uint64_data_size() > 0) {
+    hasher.AddBytes(tensor.uint64_data().data(), tensor.uint64_data_size() * sizeof(uint64_t));
+  } else if (tensor.string_data_size() > 0) {
+    for (const auto& str : tensor.string_data()) {
+      hasher.AddString(str);
+    }
+  }
+}
+
+}  // namespace
+
+HashValue ComputeFusedSubgraphHash(const GraphViewer& graph_viewer) {
+  SubgraphHasher hasher;
+
+  // values are identified by the order in which they first appear instead of by name so
+  // that the hash is stable across models that only differ in naming
+  std::unordered_map<std::string_view, uint64_t> value_indexes;
+  std::unordered_set<std::string_view> hashed_initializers;
+
+  const auto add_def = [&](const NodeArg* def) {
+    if (def == nullptr || !def->Exists()) {
+      hasher.AddInt(std::numeric_limits<uint64_t>::max());  // missing optional input/output
+      return;
+    }
+
+    hasher.AddInt(value_indexes.emplace(def->Name(), value_indexes.size()).first->second);
+    if (const std::string* type = def->Type(); type != nullptr) {
+      hasher.AddString(*type);
+    }
+
+    // fold the payload of each consumed initializer into the hash, once per initializer
+    const ONNX_NAMESPACE::TensorProto* initializer = nullptr;
+    if (graph_viewer.GetInitializedTensor(def->Name(), initializer) &&
+        hashed_initializers.insert(def->Name()).second) {
+      AddTensorProtoPayload(hasher, *initializer);
+    }
+  };
+
+  // which values enter the subgraph from the outside, in order
+  for (const NodeArg* input : graph_viewer.GetInputsIncludingInitializers()) {
+    add_def(input);
+  }
+
+  for (const NodeIndex node_idx : graph_viewer.GetNodesInTopologicalOrder()) {
+    const Node& node = *graph_viewer.GetNode(node_idx);
+
+    const auto op_id = utils::MakeOpId(node);
+    hasher.AddString(op_id.domain);
+    hasher.AddString(op_id.op_type);
+    hasher.AddInt(static_cast<uint64_t>(op_id.since_version));
+
+    for (const NodeArg* def : node.InputDefs()) {
+      add_def(def);
+    }
+    for (const NodeArg* def : node.ImplicitInputDefs()) {
+      add_def(def);
+    }
+    for (const NodeArg* def : node.OutputDefs()) {
+      add_def(def);
+    }
+
+    // NodeAttributes is unordered; hash attributes sorted by name to be deterministic.
+    // serialized subgraph attributes (control flow bodies) embed internal value names, so
+    // those only match within the same model.
+    const auto& attributes = node.GetAttributes();
+    std::vector<const std::string*> attribute_names;
+    attribute_names.reserve(attributes.size());
+    for (const auto& entry : attributes) {
+      attribute_names.push_back(&entry.first);
+    }
+    std::sort(attribute_names.begin(), attribute_names.end(),
+              [](const std::string* a, const std::string* b) { return *a < *b; });
+
+    for (const std::string* name : attribute_names) {
+      hasher.AddString(*name);
+      hasher.AddString(attributes.at(*name).SerializeAsString());
+    }
+  }
+
+  // which values the subgraph produces, in order
+  for (const NodeArg* output : graph_viewer.GetOutputs()) {
+    add_def(output);
+  }
+
+  return hasher.Result();
+}
+
+}  // namespace onnxruntime
+
+#endif  // !defined(ORT_MINIMAL_BUILD) || defined(ORT_EXTENDED_MINIMAL_BUILD)
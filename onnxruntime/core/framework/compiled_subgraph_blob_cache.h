@@ -0,0 +1,70 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#if !defined(ORT_MINIMAL_BUILD) || defined(ORT_EXTENDED_MINIMAL_BUILD)
+
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+
+#include "core/common/common.h"
+#include "core/framework/compiled_subgraph_blob_store.h"
+#include "core/platform/ort_mutex.h"
+
+namespace onnxruntime {
+
+class GraphViewer;
+
+/**
+ * Process wide CompiledSubgraphBlobStore implementation used by the graph partitioner.
+ *
+ * Entries live in memory for the lifetime of the process so sessions created later can
+ * reuse blobs compiled earlier. When a backing directory is configured
+ * (kOrtSessionOptionsCompiledSubgraphBlobCacheDir) entries are additionally mirrored to
+ * disk as '<key as 16 hex digits>.bin' files, which lets separate processes share
+ * compilations.
+ */
+class CompiledSubgraphBlobCache final : public CompiledSubgraphBlobStore {
+ public:
+  CompiledSubgraphBlobCache() = default;
+
+  /** The process wide instance that the graph partitioner hands to EPs. */
+  static CompiledSubgraphBlobCache& Instance();
+
+  bool Get(HashValue key, std::string& blob) const override;
+
+  void Put(HashValue key, const std::string& blob) override;
+
+  /** Mirror entries to 'directory' so the cache survives the process and can be shared
+      between processes. The directory is created if needed. The first directory set wins;
+      later calls with a different directory are ignored. */
+  void SetBackingDirectory(const std::filesystem::path& directory);
+
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(CompiledSubgraphBlobCache);
+
+ private:
+  std::filesystem::path BackingFilePath(HashValue key) const;
+
+  mutable OrtMutex mutex_;
+  std::filesystem::path backing_directory_;
+  mutable std::unordered_map<HashValue, std::string> blobs_;
+};
+
+/**
+ * Computes a content hash of the nodes covered by 'graph_viewer'.
+ *
+ * The hash covers the graph structure (connectivity via canonical value indexes rather
+ * than value names), each node's operator identity (domain, op type, opset version),
+ * attributes, and the payload of consumed initializers, so two structurally identical
+ * subgraphs from different models hash the same even though their node and value names
+ * differ. Note that it reads every consumed initializer's payload, and that subgraph
+ * valued attributes (control flow bodies) are hashed by serialized proto, which embeds
+ * internal names and so only matches within the same model.
+ */
+HashValue ComputeFusedSubgraphHash(const GraphViewer& graph_viewer);
+
+}  // namespace onnxruntime
+
+#endif  // !defined(ORT_MINIMAL_BUILD) || defined(ORT_EXTENDED_MINIMAL_BUILD)
@@ -0,0 +1,288 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/delta_execution_manager.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include "core/framework/execution_frame.h"
+#include "core/framework/murmurhash3.h"
+#include "core/framework/tensor.h"
+
+namespace onnxruntime {
+
+DeltaExecutionManager::DeltaExecutionManager(std::vector<NodeEntry> nodes,
+                                             InlinedHashMap<std::string, size_t> feed_name_to_position,
+                                             AllocatorPtr allocator,
+                                             size_t cache_budget_bytes)
+    : nodes_(std::move(nodes)),
+      feed_name_to_position_(std::move(feed_name_to_position)),
+      allocator_(std::move(allocator)),
+      cache_budget_bytes_(cache_budget_bytes),
+      dirty_(nodes_.size(), true),
+      cache_(nodes_.size()) {
+  node_to_position_.reserve(nodes_.size());
+  for (size_t position = 0; position < nodes_.size(); ++position) {
+    const NodeEntry& node = nodes_[position];
+    for (size_t producer : node.producers) {
+      ORT_ENFORCE(producer < position, "Node entries must be in topological order.");
+    }
+    node_to_position_.emplace(node.node_index, position);
+  }
+}
+
+bool DeltaExecutionManager::FingerprintValue(const OrtValue& value, Fingerprint& fingerprint) {
+  if (!value.IsAllocated() || !value.IsTensor()) {
+    return false;
+  }
+
+  const auto& tensor = value.Get<Tensor>();
+  if (tensor.Location().device.Type() != OrtDevice::CPU || tensor.IsDataTypeString()) {
+    return false;
+  }
+
+  uint32_t hash[4] = {0, 0, 0, 0};
+
+  // chain the hash across buffers, re-seeding with the previous value as
+  // SubgraphResultCache::FingerprintFeeds does. MurmurHash3 takes an int length, so walk very
+  // large tensors in chunks.
+  auto hash_buffer = [&hash](const void* data, size_t len) {
+    const auto* bytes = static_cast<const char*>(data);
+    while (len > 0) {
+      const size_t chunk = std::min(len, static_cast<size_t>(std::numeric_limits<int>::max()));
+      MurmurHash3::x86_128(bytes, static_cast<int>(chunk), hash[0], &hash);
+      bytes += chunk;
+      len -= chunk;
+    }
+  };
+
+  const int32_t elem_type = tensor.GetElementType();
+  hash_buffer(&elem_type, sizeof(elem_type));
+
+  const auto dims = tensor.Shape().GetDims();
+  if (!dims.empty()) {
+    hash_buffer(dims.data(), dims.size() * sizeof(int64_t));
+  }
+
+  if (tensor.SizeInBytes() > 0) {
+    hash_buffer(tensor.DataRaw(), tensor.SizeInBytes());
+  }
+
+  static_assert(sizeof(hash) == sizeof(Fingerprint), "fingerprint must hold the full 128-bit hash");
+  memcpy(fingerprint.data(), hash, sizeof(hash));
+  return true;
+}
+
+bool DeltaExecutionManager::FeedUnchanged(const FeedState& previous, const FeedState& current) {
+  if (previous.kind != current.kind) {
+    return false;
+  }
+  switch (current.kind) {
+    case FeedState::Kind::kNotFed:
+      return true;  // both runs used the initializer default
+    case FeedState::Kind::kHashed:
+      return previous.fingerprint == current.fingerprint;
+    case FeedState::Kind::kUnhashable:
+    default:
+      return false;  // cannot tell, assume changed
+  }
+}
+
+void DeltaExecutionManager::DropCacheLocked() {
+  std::fill(cache_.begin(), cache_.end(), std::nullopt);
+  cache_bytes_ = 0;
+  have_baseline_ = false;
+}
+
+void DeltaExecutionManager::BeginRun(gsl::span<const std::string> feed_names,
+                                     gsl::span<const OrtValue> feeds) {
+  std::lock_guard<OrtMutex> lock(mutex_);
+
+  ++active_runs_;
+  if (active_runs_ > 1) {
+    // interleaved Runs make "previous run" ill-defined and the cache entries could mix values
+    // from different runs; execute everything until the session is sequential again.
+    skipping_enabled_this_run_ = false;
+    DropCacheLocked();
+    return;
+  }
+
+  current_feeds_.assign(feed_name_to_position_.size(), FeedState{});
+  for (size_t i = 0; i < feed_names.size() && i < feeds.size(); ++i) {
+    auto it = feed_name_to_position_.find(feed_names[i]);
+    if (it == feed_name_to_position_.end()) {
+      continue;  // unknown names are rejected by Run validation
+    }
+    FeedState& state = current_feeds_[it->second];
+    state.kind = FingerprintValue(feeds[i], state.fingerprint) ? FeedState::Kind::kHashed
+                                                               : FeedState::Kind::kUnhashable;
+  }
+
+  if (!have_baseline_) {
+    std::fill(dirty_.begin(), dirty_.end(), true);
+  } else {
+    // one topological pass: a node is dirty when it is non-deterministic, reads a changed graph
+    // input, or consumes the output of a dirty node.
+    for (size_t position = 0; position < nodes_.size(); ++position) {
+      const NodeEntry& node = nodes_[position];
+      bool dirty = !node.deterministic;
+      for (size_t i = 0, end = node.feeds.size(); !dirty && i < end; ++i) {
+        const size_t feed = node.feeds[i];
+        dirty = !FeedUnchanged(baseline_feeds_[feed], current_feeds_[feed]);
+      }
+      for (size_t i = 0, end = node.producers.size(); !dirty && i < end; ++i) {
+        dirty = dirty_[node.producers[i]];
+      }
+      dirty_[position] = dirty;
+    }
+  }
+
+  skipping_enabled_this_run_ = true;
+}
+
+void DeltaExecutionManager::EndRun(bool run_succeeded) {
+  std::lock_guard<OrtMutex> lock(mutex_);
+
+  if (active_runs_ > 0) {
+    --active_runs_;
+  }
+
+  if (!run_succeeded) {
+    // a failed run may have refreshed only part of the cache; start over
+    DropCacheLocked();
+  } else if (skipping_enabled_this_run_) {
+    baseline_feeds_ = std::move(current_feeds_);
+    have_baseline_ = true;
+  }
+
+  skipping_enabled_this_run_ = false;
+}
+
+Status DeltaExecutionManager::TrySkipNode(NodeIndex node_index, IExecutionFrame& frame, bool& skipped) {
+  skipped = false;
+
+  std::lock_guard<OrtMutex> lock(mutex_);
+  if (!skipping_enabled_this_run_) {
+    return Status::OK();
+  }
+
+  auto it = node_to_position_.find(node_index);
+  if (it == node_to_position_.end()) {
+    return Status::OK();
+  }
+  const size_t position = it->second;
+
+  if (dirty_[position]) {
+    return Status::OK();
+  }
+
+  const std::optional<CacheEntry>& entry = cache_[position];
+  if (!entry.has_value()) {
+    return Status::OK();
+  }
+
+  const NodeEntry& node = nodes_[position];
+  const int node_offset = frame.GetNodeOffset(node.node_index);
+
+  // gather the output slots first: when any of them is pre-allocated (a graph output bound to a
+  // caller-provided buffer) the node executes normally and writes into that buffer.
+  InlinedVector<OrtValue*> slots;
+  slots.reserve(node.output_args.size());
+  for (int output_arg : node.output_args) {
+    OrtValue* slot =
+        frame.GetMutableNodeInputOrOutputMLValue(node_offset + static_cast<int>(node.output_start) + output_arg);
+    if (slot == nullptr || slot->IsAllocated()) {
+      return Status::OK();
+    }
+    slots.push_back(slot);
+  }
+
+  // inject deep copies rather than sharing the cache-owned buffers: the allocation plan may
+  // reuse a node's output buffer for a downstream in-place output, which would scribble over
+  // the cache.
+  for (size_t i = 0; i < slots.size(); ++i) {
+    const auto& src = entry->outputs[i].Get<Tensor>();
+    OrtValue copy;
+    Tensor::InitOrtValue(src.DataType(), src.Shape(), allocator_, copy);
+    if (src.SizeInBytes() > 0) {
+      memcpy(copy.GetMutable<Tensor>()->MutableDataRaw(), src.DataRaw(), src.SizeInBytes());
+    }
+    *slots[i] = std::move(copy);
+  }
+
+  skipped = true;
+  return Status::OK();
+}
+
+void DeltaExecutionManager::OnNodeExecuted(NodeIndex node_index, gsl::span<const OrtValue* const> outputs) {
+  std::lock_guard<OrtMutex> lock(mutex_);
+  if (!skipping_enabled_this_run_) {
+    return;
+  }
+
+  auto it = node_to_position_.find(node_index);
+  if (it == node_to_position_.end()) {
+    return;
+  }
+  const size_t position = it->second;
+  const NodeEntry& node = nodes_[position];
+
+  // the node just produced fresh values, so any previous copies are stale either way
+  if (cache_[position].has_value()) {
+    cache_bytes_ -= cache_[position]->bytes;
+    cache_[position].reset();
+  }
+
+  CacheEntry entry;
+  entry.outputs.reserve(node.output_args.size());
+  for (int output_arg : node.output_args) {
+    const OrtValue* value =
+        static_cast<size_t>(output_arg) < outputs.size() ? outputs[output_arg] : nullptr;
+    if (value == nullptr || !value->IsAllocated() || !value->IsTensor()) {
+      return;
+    }
+
+    const auto& src = value->Get<Tensor>();
+    if (src.Location().device.Type() != OrtDevice::CPU || src.IsDataTypeString()) {
+      return;
+    }
+
+    entry.bytes += src.SizeInBytes();
+    if (cache_bytes_ + entry.bytes > cache_budget_bytes_) {
+      return;  // over budget; the node keeps executing on every run
+    }
+
+    OrtValue copy;
+    Tensor::InitOrtValue(src.DataType(), src.Shape(), allocator_, copy);
+    if (src.SizeInBytes() > 0) {
+      memcpy(copy.GetMutable<Tensor>()->MutableDataRaw(), src.DataRaw(), src.SizeInBytes());
+    }
+    entry.outputs.push_back(std::move(copy));
+  }
+
+  cache_bytes_ += entry.bytes;
+  cache_[position] = std::move(entry);
+}
+
+size_t DeltaExecutionManager::EvictCache() {
+  std::lock_guard<OrtMutex> lock(mutex_);
+  const size_t released = cache_bytes_;
+  DropCacheLocked();
+  return released;
+}
+
+bool DeltaExecutionManager::IsNodeDirty(NodeIndex node_index) const {
+  std::lock_guard<OrtMutex> lock(mutex_);
+  auto it = node_to_position_.find(node_index);
+  return it == node_to_position_.end() || dirty_[it->second];
+}
+
+bool DeltaExecutionManager::HasCachedOutputs(NodeIndex node_index) const {
+  std::lock_guard<OrtMutex> lock(mutex_);
+  auto it = node_to_position_.find(node_index);
+  return it != node_to_position_.end() && cache_[it->second].has_value();
+}
+
+}  // namespace onnxruntime
@@ -0,0 +1,134 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <array>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <gsl/gsl>
+
+#include "core/common/common.h"
+#include "core/common/inlined_containers.h"
+#include "core/framework/allocator.h"
+#include "core/framework/ort_value.h"
+#include "core/graph/basic_types.h"
+#include "core/platform/ort_mutex.h"
+
+namespace onnxruntime {
+
+class IExecutionFrame;
+
+/**
+ * Opt-in run-to-run incremental execution for workloads whose consecutive Runs feed mostly
+ * identical inputs. Each feed is fingerprinted at the start of a Run; a node whose transitive
+ * graph inputs are all unchanged since the previous Run (and which contains only deterministic
+ * ops) is clean, and when its outputs were cached on the run that last executed it, the cached
+ * values are written into its frame slots and the kernel is skipped. Only the dirty suffix of
+ * the graph recomputes. Enabled with kOrtSessionOptionsEnableDeltaExecution.
+ *
+ * Cached outputs are deep copies of CPU tensors allocated from the session allocator, never the
+ * execution frame's OrtValues, whose buffers are reused by later runs; the total copy size is
+ * bounded by kOrtSessionOptionsDeltaExecutionCacheBudgetBytes and nodes whose outputs do not fit
+ * (or are not CPU tensors) simply always execute. Overlapping Runs disable skipping and drop the
+ * cache until the session is back to sequential Runs, since "previous run" is only well defined
+ * when Runs do not interleave.
+ */
+class DeltaExecutionManager {
+ public:
+  using Fingerprint = std::array<uint64_t, 2>;
+
+  // Per-node metadata captured from the graph at session initialization, in topological order.
+  struct NodeEntry {
+    NodeIndex node_index;
+    // positions (into the topologically ordered entry list) of the nodes producing this node's
+    // inputs, including implicit inputs of control flow nodes
+    InlinedVector<size_t> producers;
+    // positions (into the feed table) of the graph inputs this node reads directly
+    InlinedVector<size_t> feeds;
+    // offset of the node's first output slot relative to the frame's node offset
+    // (input count + implicit input count)
+    size_t output_start;
+    // output arg positions that exist (missing optional outputs are excluded)
+    InlinedVector<int> output_args;
+    // whether the node's outputs are a pure function of its inputs
+    bool deterministic;
+  };
+
+  DeltaExecutionManager(std::vector<NodeEntry> nodes,
+                        InlinedHashMap<std::string, size_t> feed_name_to_position,
+                        AllocatorPtr allocator,
+                        size_t cache_budget_bytes);
+
+  // Fingerprints the feeds and computes this run's dirty node set: a node is dirty when this is
+  // the first run, when any graph input it transitively depends on changed (or could not be
+  // fingerprinted), or when it transitively depends on a non-deterministic node. Skipping is
+  // disabled and the cache dropped when another Run is already in flight.
+  void BeginRun(gsl::span<const std::string> feed_names, gsl::span<const OrtValue> feeds);
+
+  // Commits this run's feed fingerprints as the baseline for the next run. On failure the cache
+  // and the baseline are dropped so the next run re-executes everything.
+  void EndRun(bool run_succeeded);
+
+  // When the node is clean and its outputs are cached, writes copies of the cached values into
+  // the node's output slots of the frame and reports skipped = true; the caller must not execute
+  // the node.
+  // Falls back to normal execution (skipped = false) when an output slot is already allocated,
+  // e.g. a graph output bound to a caller-provided buffer.
+  Status TrySkipNode(NodeIndex node_index, IExecutionFrame& frame, bool& skipped);
+
+  // Called after a node executed. Deep-copies its CPU tensor outputs into the cache within the
+  // byte budget so the node can be skipped while it stays clean; outputs that cannot be cached
+  // drop any stale entry instead.
+  void OnNodeExecuted(NodeIndex node_index, gsl::span<const OrtValue* const> outputs);
+
+  // Drops every cached output and the feed baseline, so the next Run re-executes the whole
+  // graph once and then rebuilds the cache. Returns the number of bytes that were cached.
+  // Used as an eviction callback under memory pressure; see SessionMemoryBudget.
+  size_t EvictCache();
+
+  // introspection, also used by the tests
+  bool IsNodeDirty(NodeIndex node_index) const;
+  bool HasCachedOutputs(NodeIndex node_index) const;
+
+ private:
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(DeltaExecutionManager);
+
+  // How a graph input position was fed in one run. Two states compare as unchanged only when
+  // both are kNotFed (the initializer default was used) or both hashed to the same fingerprint.
+  struct FeedState {
+    enum class Kind : uint8_t { kNotFed, kHashed, kUnhashable };
+    Kind kind = Kind::kNotFed;
+    Fingerprint fingerprint{};
+  };
+
+  struct CacheEntry {
+    InlinedVector<OrtValue> outputs;  // parallel to NodeEntry::output_args
+    size_t bytes = 0;
+  };
+
+  static bool FingerprintValue(const OrtValue& value, Fingerprint& fingerprint);
+  static bool FeedUnchanged(const FeedState& previous, const FeedState& current);
+
+  void DropCacheLocked();
+
+  std::vector<NodeEntry> nodes_;
+  InlinedHashMap<std::string, size_t> feed_name_to_position_;
+  InlinedHashMap<NodeIndex, size_t> node_to_position_;
+  AllocatorPtr allocator_;
+  size_t cache_budget_bytes_;
+
+  mutable OrtMutex mutex_;
+  size_t active_runs_{0};
+  bool skipping_enabled_this_run_{false};
+  bool have_baseline_{false};
+  std::vector<FeedState> baseline_feeds_;
+  std::vector<FeedState> current_feeds_;
+  std::vector<bool> dirty_;  // per node position, for the current run
+  std::vector<std::optional<CacheEntry>> cache_;
+  size_t cache_bytes_{0};
+};
+
+}  // namespace onnxruntime
@@ -0,0 +1,25 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/ep_boundary_stats.h"
+
+namespace onnxruntime {
+
+void EpBoundaryStats::Record(const std::string& transition, uint64_t bytes, bool from_memcpy,
+                             uint64_t time_ns) {
+  std::lock_guard<OrtMutex> lock(mutex_);
+  TransitionStats& stats = stats_[transition];
+  ++stats.crossings;
+  stats.bytes += bytes;
+  if (from_memcpy) {
+    ++stats.memcpy_count;
+    stats.memcpy_time_ns += time_ns;
+  }
+}
+
+std::map<std::string, EpBoundaryStats::TransitionStats> EpBoundaryStats::GetStats() const {
+  std::lock_guard<OrtMutex> lock(mutex_);
+  return stats_;
+}
+
+}  // namespace onnxruntime
@@ -0,0 +1,71 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <utility>
+
+#include "core/common/common.h"
+#include "core/common/inlined_containers.h"
+#include "core/graph/basic_types.h"
+#include "core/platform/ort_mutex.h"
+
+namespace onnxruntime {
+
+/**
+ * Accumulates the cost of execution provider boundaries: the MemcpyFromHost/MemcpyToHost nodes
+ * the partitioner inserts and every edge whose producer and consumer were assigned to different
+ * EPs. Without this the cost of an EP-assignment change is spread over anonymous Memcpy entries
+ * in the profile and has to be reconstructed by hand; with it a placement regression shows up as
+ * a per-transition byte and time total that can be asserted on.
+ *
+ * The boundary structure of the graph is fixed once partitioning has run, so it is classified
+ * once at session initialization into a NodeIndex keyed map; executing a non-boundary node costs
+ * one hash lookup. Boundary nodes fold their input bytes (and, for Memcpy nodes, the wall time
+ * of the copy) into per-transition totals under a mutex.
+ *
+ * The totals are exposed through OrtApi::SessionGetEpBoundaryReport and also tag the
+ * corresponding kernel_time events when profiling is enabled.
+ */
+class EpBoundaryStats {
+ public:
+  struct TransitionStats {
+    uint64_t crossings = 0;       // boundary node executions that moved data over this transition
+    uint64_t bytes = 0;           // total bytes that crossed
+    uint64_t memcpy_count = 0;    // executions of partitioner-inserted Memcpy nodes
+    uint64_t memcpy_time_ns = 0;  // wall time spent in those Memcpy nodes
+  };
+
+  struct NodeBoundary {
+    // Input index paired with the "<src EP> -> <dst EP>" transition its value crosses.
+    InlinedVector<std::pair<int, std::string>> crossing_inputs;
+    // True for MemcpyFromHost/MemcpyToHost; only those attribute their wall time as copy cost.
+    bool is_memcpy = false;
+  };
+
+  explicit EpBoundaryStats(InlinedHashMap<NodeIndex, NodeBoundary> node_boundaries)
+      : node_boundaries_(std::move(node_boundaries)) {}
+
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(EpBoundaryStats);
+
+  // Boundary classification of 'node_index', or nullptr if the node is not on an EP boundary.
+  const NodeBoundary* GetNodeBoundary(NodeIndex node_index) const {
+    auto it = node_boundaries_.find(node_index);
+    return it == node_boundaries_.end() ? nullptr : &it->second;
+  }
+
+  // Folds one executed crossing into the totals for 'transition'. Thread-safe.
+  void Record(const std::string& transition, uint64_t bytes, bool from_memcpy, uint64_t time_ns);
+
+  // Copy of the current totals, ordered by transition name for stable output.
+  std::map<std::string, TransitionStats> GetStats() const;
+
+ private:
+  InlinedHashMap<NodeIndex, NodeBoundary> node_boundaries_;
+  mutable OrtMutex mutex_;
+  std::map<std::string, TransitionStats> stats_;
+};
+
+}  // namespace onnxruntime
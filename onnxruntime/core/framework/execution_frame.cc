@@ -3,7 +3,9 @@
 
 #include "core/framework/execution_frame.h"
 
+#include <algorithm>
 #include <sstream>
+#include <utility>
 
 #include "core/framework/mem_pattern_planner.h"
 #include "core/framework/execution_plan_base.h"
@@ -17,6 +19,7 @@
 #include "core/framework/session_state.h"
 #include "core/framework/TensorSeq.h"
 #include "core/framework/utils.h"
+#include "core/session/onnxruntime_session_options_config_keys.h"
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
 #include "core/framework/memory_info.h"
 #endif
@@ -39,16 +42,26 @@ static StreamAwareArena* AsStreamBasedAllocator(AllocatorPtr allocator) {
 
 IExecutionFrame::IExecutionFrame(const OrtValueNameIdxMap& ort_value_idx_map,
                                  const NodeIndexInfo& node_index_info,
-                                 gsl::span<const int> fetch_mlvalue_idxs)
+                                 gsl::span<const int> fetch_mlvalue_idxs,
+                                 OrtValueBufferPool* value_buffer_pool)
     : node_index_info_(node_index_info),
+      value_buffer_pool_(value_buffer_pool),
       all_values_size_(static_cast<size_t>(ort_value_idx_map.MaxIdx()) + 1),
       fetch_mlvalue_idxs_(fetch_mlvalue_idxs.begin(), fetch_mlvalue_idxs.end()),
       ort_value_idx_map_(ort_value_idx_map) {
   ORT_ENFORCE(node_index_info_.GetMaxMLValueIdx() == ort_value_idx_map.MaxIdx(),
               "node_index_info and ort_value_idx_map are out of sync and cannot be used");
+
+  if (value_buffer_pool_ != nullptr) {
+    all_values_ = value_buffer_pool_->Acquire();
+  }
 }
 
-IExecutionFrame::~IExecutionFrame() = default;
+IExecutionFrame::~IExecutionFrame() {
+  if (value_buffer_pool_ != nullptr) {
+    value_buffer_pool_->Release(std::move(all_values_));
+  }
+}
 
 #ifdef ENABLE_ATEN
 Status IExecutionFrame::SetOutputMLValue(int index, const OrtValue& ort_value) {
@@ -352,12 +365,61 @@ ExecutionFrame::ExecutionFrame(gsl::span<const int> feed_mlvalue_idxs, gsl::span
                                const DeviceStreamCollection* device_streams,
 #endif
                                const SessionState& session_state)
-    : IExecutionFrame(session_state.GetOrtValueNameIdxMap(), session_state.GetNodeIndexInfo(), fetch_mlvalue_idxs),
+    : IExecutionFrame(session_state.GetOrtValueNameIdxMap(), session_state.GetNodeIndexInfo(), fetch_mlvalue_idxs,
+                      &session_state.GetOrtValueBufferPool()),
 #ifdef ORT_ENABLE_STREAM
       device_streams_(device_streams),
 #endif
       session_state_(session_state),
       mem_patterns_(nullptr) {
+  // Watermark tracking only covers the main graph frame. Subgraph frames are created per control
+  // flow op invocation, so their peaks are not meaningful in isolation and are left out.
+  if (session_state.GetGraphViewer().ParentNode() == nullptr) {
+    const auto& allocators = session_state.GetAllocators();
+    num_device_watermarks_ = allocators.size();
+    device_watermarks_ = std::make_unique<DeviceWatermark[]>(num_device_watermarks_);
+    size_t slot = 0;
+    for (const auto& entry : allocators) {
+      device_watermarks_[slot++].device = entry.first;
+    }
+
+    // Build a stable signature from the fed tensor shapes, sorted by input name so callers that
+    // order the feeds differently between runs land in the same bucket.
+    InlinedVector<std::pair<std::string, size_t>> named_feeds;
+    named_feeds.reserve(feeds.size());
+    for (size_t i = 0; i < feed_mlvalue_idxs.size() && i < feeds.size(); ++i) {
+      std::string name;
+      if (session_state.GetOrtValueNameIdxMap().GetName(feed_mlvalue_idxs[i], name).IsOK()) {
+        named_feeds.emplace_back(std::move(name), i);
+      }
+    }
+    std::sort(named_feeds.begin(), named_feeds.end());
+    std::ostringstream signature;
+    for (const auto& named_feed : named_feeds) {
+      signature << named_feed.first << ':';
+      if (feeds[named_feed.second].IsTensor()) {
+        signature << feeds[named_feed.second].Get<Tensor>().Shape().ToString();
+      }
+      signature << ';';
+    }
+    input_shape_signature_ = signature.str();
+
+    // Optional per-run scratch arena: one slab sized from the scratch peak recorded for this
+    // signature, bump-allocated by CPU kernels via GetTempSpaceAllocator and released in one
+    // shot when this frame is torn down (see RunScratchArena).
+    if (session_state.GetSessionOptions().config_options.GetConfigOrDefault(
+            kOrtSessionOptionsEnableRunScratchArena, "0") == "1") {
+      AllocatorPtr cpu_allocator = session_state.GetAllocator(OrtDevice());
+      if (cpu_allocator != nullptr) {
+        size_t slab_bytes = 0;
+        if (auto* watermarks = session_state.GetRunMemoryWatermarks(); watermarks != nullptr) {
+          slab_bytes = watermarks->GetPeak(input_shape_signature_, RunScratchArena::kWatermarkLocation);
+        }
+        scratch_arena_ = std::make_shared<RunScratchArena>(std::move(cpu_allocator), slab_bytes);
+      }
+    }
+  }
+
   Init(
       feed_mlvalue_idxs, feeds, session_state.GetInitializedTensors(),
 #if !defined(DISABLE_SPARSE_TENSORS)
@@ -470,6 +532,8 @@ ExecutionFrame::ExecutionFrame(gsl::span<const int> feed_mlvalue_idxs, gsl::span
 
             if (buffer != nullptr) {
               buffers_[location] = BufferUniquePtr(buffer, BufferDeleter(alloc));
+              // the chunk lives until the frame is destroyed, so no matching RecordFreedBytes
+              RecordAllocatedBytes(location, mem_patterns_->patterns[i].PeakSize());
             }
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
             // Record activation memory pattern
@@ -492,7 +556,27 @@ ExecutionFrame::ExecutionFrame(gsl::span<const int> feed_mlvalue_idxs, gsl::span
   }
 }
 
-ExecutionFrame::~ExecutionFrame() = default;
+ExecutionFrame::~ExecutionFrame() {
+  // Publish the per-device peaks of this run. The watermark slots are only built for the main
+  // graph frame, so subgraph frames skip this entirely.
+  auto* watermarks = session_state_.GetRunMemoryWatermarks();
+  if (watermarks != nullptr) {
+    for (size_t i = 0; i < num_device_watermarks_; ++i) {
+      const size_t peak = device_watermarks_[i].peak_bytes.load(std::memory_order_relaxed);
+      if (peak > 0) {
+        watermarks->Record(input_shape_signature_, device_watermarks_[i].device.ToString(), peak);
+      }
+    }
+
+    // publish this run's scratch total so the next run with the same signature pre-sizes its slab
+    if (scratch_arena_ != nullptr) {
+      const size_t scratch_peak = scratch_arena_->TotalBytes();
+      if (scratch_peak > 0) {
+        watermarks->Record(input_shape_signature_, RunScratchArena::kWatermarkLocation, scratch_peak);
+      }
+    }
+  }
+}
 
 Status ExecutionFrame::CopyTensor(const Tensor& src, Tensor& dest) const {
   return session_state_.GetDataTransferMgr().CopyTensor(src, dest);
@@ -508,6 +592,65 @@ Status ExecutionFrame::AllocateMLValueTensorSelfOwnBuffer(OrtValue& ort_value, i
   return AllocateMLValueTensorSelfOwnBufferHelper(ort_value, ort_value_index, element_type, location, shape);
 }
 
+AllocatorPtr ExecutionFrame::GetHostStagingAllocator(const OrtDevice& device) const {
+  // Prefer a pinned allocator registered for the device so the offload copies can run as
+  // asynchronous DMA transfers; fall back to the plain CPU allocator.
+  for (auto mem_type : {OrtDevice::MemType::CUDA_PINNED, OrtDevice::MemType::HIP_PINNED,
+                        OrtDevice::MemType::CANN_PINNED}) {
+    auto allocator = GetAllocator(OrtDevice(OrtDevice::CPU, mem_type, device.Id()));
+    if (allocator != nullptr) {
+      return allocator;
+    }
+  }
+
+  return GetAllocator(OrtDevice());
+}
+
+Status ExecutionFrame::OffloadToHost(int ort_value_idx, OrtValue& host_staging, Stream* stream) {
+  const OrtValue& value = GetMutableMLValue(ort_value_idx);
+  if (!value.IsAllocated() || !value.IsTensor()) {
+    // unused optional output that was never materialized; the prefetch side skips it as well
+    return Status::OK();
+  }
+
+  const auto& device_tensor = value.Get<Tensor>();
+  AllocatorPtr staging_allocator = GetHostStagingAllocator(device_tensor.Location().device);
+  ORT_RETURN_IF(staging_allocator == nullptr, "Failed to get a host staging allocator for ",
+                device_tensor.Location().device.ToString());
+
+  Tensor host_tensor(device_tensor.DataType(), device_tensor.Shape(), staging_allocator);
+  const auto& data_transfer_mgr = session_state_.GetDataTransferMgr();
+  if (stream != nullptr) {
+    ORT_RETURN_IF_ERROR(data_transfer_mgr.CopyTensorAsync(device_tensor, host_tensor, *stream));
+  } else {
+    ORT_RETURN_IF_ERROR(data_transfer_mgr.CopyTensor(device_tensor, host_tensor));
+  }
+
+  Tensor::InitOrtValue(std::move(host_tensor), host_staging);
+  return ReleaseMLValue(ort_value_idx);
+}
+
+Status ExecutionFrame::PrefetchFromHost(int ort_value_idx, const OrtValue& host_staging, Stream* stream) {
+  if (!host_staging.IsAllocated()) {
+    // the offload side skipped the value
+    return Status::OK();
+  }
+
+  const auto& host_tensor = host_staging.Get<Tensor>();
+  OrtValue& value = GetMutableMLValue(ort_value_idx);
+  const auto& per_alloc_plan = GetAllocationPlan(ort_value_idx);
+  ORT_RETURN_IF_ERROR(AllocateMLValueTensorSelfOwnBuffer(value, ort_value_idx, host_tensor.DataType(),
+                                                         per_alloc_plan.location, host_tensor.Shape()));
+
+  Tensor& device_tensor = *value.GetMutable<Tensor>();
+  const auto& data_transfer_mgr = session_state_.GetDataTransferMgr();
+  if (stream != nullptr) {
+    return data_transfer_mgr.CopyTensorAsync(host_tensor, device_tensor, *stream);
+  }
+
+  return data_transfer_mgr.CopyTensor(host_tensor, device_tensor);
+}
+
 Stream* ExecutionFrame::GetValueStream(int ort_value_idx) const {
 #ifdef ORT_ENABLE_STREAM
   const auto& value_to_stream_map = const_cast<SessionState&>(session_state_).GetExecutionPlan()->GetValueToStreamMap();
@@ -601,6 +744,7 @@ Status ExecutionFrame::AllocateMLValueTensorSelfOwnBufferHelper(OrtValue& ort_va
   // placement new, we don't support it in memory pattern optimization.
   if (!utils::IsDataTypeString(element_type)) {
     TraceAllocate(ort_value_index, size);
+    RecordAllocatedBytes(location, size);
   }
 
   {
@@ -827,12 +971,22 @@ AllocatorPtr ExecutionFrame::GetAllocatorImpl(const OrtDevice& info) const {
   return session_state_.GetAllocator(info);
 }
 
+AllocatorPtr ExecutionFrame::GetRunScratchAllocator(const OrtDevice& device) const {
+  if (scratch_arena_ != nullptr && device.Type() == OrtDevice::CPU) {
+    return scratch_arena_;
+  }
+  return nullptr;
+}
+
 // This method is not thread safe!
 // Return S_OK and nullptr if index map to a value that is an unused optional input/output
 Status ExecutionFrame::CreateNodeOutputMLValueImpl(OrtValue& ort_value, int ort_value_idx, const TensorShape* shape) {
 #ifdef ENABLE_TRAINING
   try {
     auto status = AllocateAsPerAllocationPlan(ort_value, ort_value_idx, shape);
+    if (status.IsOK()) {
+      RecordObservedShape(ort_value_idx, shape);
+    }
     return status;
   } catch (const std::exception& e) {
     LOGS(session_state_.Logger(), WARNING)
@@ -842,10 +996,73 @@ Status ExecutionFrame::CreateNodeOutputMLValueImpl(OrtValue& ort_value, int ort_
     return Status(ONNXRUNTIME, FAIL, e.what());
   }
 #else
-  return AllocateAsPerAllocationPlan(ort_value, ort_value_idx, shape);
+  auto status = AllocateAsPerAllocationPlan(ort_value, ort_value_idx, shape);
+  if (status.IsOK()) {
+    RecordObservedShape(ort_value_idx, shape);
+  }
+  return status;
 #endif
 }
 
+// Record the concrete shape of a tensor allocated while a new memory pattern is being traced,
+// so the session can cache it for later runs with the same input-shape signature. Only shapes
+// the feeds' dimensions fully determine are recorded: consumers of TryGetInferredShape treat
+// the result as authoritative, so replaying a data-dependent shape would be a correctness bug.
+void ExecutionFrame::RecordObservedShape(int ort_value_idx, const TensorShape* shape) {
+  if (!planner_.has_value() || shape == nullptr) {
+    return;
+  }
+
+  const auto& per_alloc_plan = GetAllocationPlan(ort_value_idx);
+  const auto* ml_type = per_alloc_plan.value_type;
+  if (ml_type == nullptr || !ml_type->IsTensorType()) {
+    return;
+  }
+
+  if (IsShapeSignatureDeterministic(ort_value_idx)) {
+    observed_shapes_.emplace(ort_value_idx, *shape);
+  }
+}
+
+bool ExecutionFrame::IsShapeSignatureDeterministic(int ort_value_idx) {
+  const auto& graph_viewer = session_state_.GetGraphViewer();
+
+  std::string name;
+  if (!session_state_.GetOrtValueNameIdxMap().GetName(ort_value_idx, name).IsOK()) {
+    return false;
+  }
+
+  const auto* node_arg = graph_viewer.GetNodeArg(name);
+  if (node_arg == nullptr || node_arg->Shape() == nullptr) {
+    return false;
+  }
+
+  if (!input_dim_params_.has_value()) {
+    input_dim_params_.emplace();
+    for (const auto* input : graph_viewer.GetInputs()) {
+      if (const auto* input_shape = input->Shape()) {
+        for (const auto& dim : input_shape->dim()) {
+          if (dim.has_dim_param()) {
+            input_dim_params_->insert(dim.dim_param());
+          }
+        }
+      }
+    }
+  }
+
+  // every dimension must be a fixed value or a symbol an input dimension binds
+  for (const auto& dim : node_arg->Shape()->dim()) {
+    if (dim.has_dim_value()) {
+      continue;
+    }
+    if (!dim.has_dim_param() || input_dim_params_->count(dim.dim_param()) == 0) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
 void ExecutionFrame::VerifyOutputSizes(int output_index, const Node& node, const TensorShape& output_shape) {
   const NodeArg* output_def = node.OutputDefs()[output_index];
   const auto* expected_shape = output_def->Shape();
@@ -875,6 +1092,22 @@ void ExecutionFrame::VerifyOutputSizes(int output_index, const Node& node, const
 
 // do not call this in ParallExecutionPlan
 Status ExecutionFrame::ReleaseMLValueImpl(int ort_value_idx) {
+  // Record the released bytes before the base implementation resets the value. Only tensors that
+  // own their buffer are counted: values reusing another value's buffer or carved out of a memory
+  // pattern chunk were never counted individually on allocation.
+  if (num_device_watermarks_ > 0 && IsValidOrtValueIndex(ort_value_idx)) {
+    const OrtValue& ort_value = GetMutableMLValue(ort_value_idx);
+    if (ort_value.IsAllocated() && ort_value.IsTensor()) {
+      const auto& tensor = ort_value.Get<Tensor>();
+      if (tensor.OwnsBuffer() && !tensor.IsDataTypeString()) {
+        size_t size = 0;
+        if (Tensor::CalculateTensorStorageSize(tensor.DataType(), tensor.Shape(), kAllocAlignment, size).IsOK()) {
+          RecordFreedBytes(tensor.Location().device, size);
+        }
+      }
+    }
+  }
+
   ORT_RETURN_IF_ERROR(IExecutionFrame::ReleaseMLValueImpl(ort_value_idx));
   TraceFree(ort_value_idx);
   return Status::OK();
@@ -892,7 +1125,7 @@ void ExecutionFrame::TraceAllocate(int ort_value_idx, size_t size) {
         allocation_plan.alloc_kind == AllocKind::kAllocatedExternally) {
       return;
     }
-    auto status = planner_->TraceAllocation(ort_value_idx, size);
+    auto status = planner_->TraceAllocation(ort_value_idx, size, allocation_plan.contiguous_sibling_group);
     if (!status.IsOK()) {
       LOGS(session_state_.Logger(), WARNING) << "TraceAllocation for ort_value_idx=" << ort_value_idx
                                              << " size=" << size << " failed: " << status.ErrorMessage();
@@ -926,6 +1159,29 @@ void ExecutionFrame::TraceFree(int ort_value_idx) {
   }
 }
 
+void ExecutionFrame::RecordAllocatedBytes(const OrtDevice& device, size_t size) {
+  for (size_t i = 0; i < num_device_watermarks_; ++i) {
+    auto& watermark = device_watermarks_[i];
+    if (watermark.device == device) {
+      const size_t live = watermark.live_bytes.fetch_add(size, std::memory_order_relaxed) + size;
+      size_t peak = watermark.peak_bytes.load(std::memory_order_relaxed);
+      while (live > peak && !watermark.peak_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+      }
+      return;
+    }
+  }
+}
+
+void ExecutionFrame::RecordFreedBytes(const OrtDevice& device, size_t size) {
+  for (size_t i = 0; i < num_device_watermarks_; ++i) {
+    auto& watermark = device_watermarks_[i];
+    if (watermark.device == device) {
+      watermark.live_bytes.fetch_sub(size, std::memory_order_relaxed);
+      return;
+    }
+  }
+}
+
 // generate memory pattern based on the tracing of memory allocation/free in current execution
 // return error if the planner is not setup.
 Status ExecutionFrame::GeneratePatterns(MemoryPatternGroup& out) {
@@ -3,7 +3,10 @@
 
 #pragma once
 
+#include <atomic>
+#include <memory>
 #include <mutex>
+#include <string>
 #include <vector>
 
 #include "core/common/common.h"
@@ -11,8 +14,10 @@
 #include "core/common/status.h"
 #include "core/framework/iexecutor.h"
 #include "core/framework/ort_value.h"
+#include "core/framework/ort_value_buffer_pool.h"
 #include "core/framework/node_index_info.h"
 #include "core/framework/ort_value_pattern_planner.h"
+#include "core/framework/run_scratch_arena.h"
 #include "core/framework/sequential_execution_plan.h"
 #include "core/framework/tensor.h"
 #include "core/graph/graph_viewer.h"
@@ -33,9 +38,13 @@ class IExecutionFrame {
  protected:
   // Derived class must call Init in its ctor. We need to use some of the virtual methods in Init and those aren't
   // initialized until the derived class is constructed.
+  // If value_buffer_pool is non-null, the storage for all_values_ is acquired
+  // from the pool and returned to it on destruction, so repeated runs reuse
+  // the same allocation.
   IExecutionFrame(const OrtValueNameIdxMap& ort_value_idx_map,
                   const NodeIndexInfo& node_index_info,
-                  gsl::span<const int> fetch_mlvalue_idxs);
+                  gsl::span<const int> fetch_mlvalue_idxs,
+                  OrtValueBufferPool* value_buffer_pool = nullptr);
 
   void Init(gsl::span<const int> feed_mlvalue_idxs, gsl::span<const OrtValue> feeds,
             const std::unordered_map<int, OrtValue>& initializers,
@@ -90,6 +99,11 @@ class IExecutionFrame {
 
   AllocatorPtr GetAllocator(const OrtDevice& info) const;
 
+  // Allocator serving transient kernel scratch for this run, or nullptr when the regular
+  // allocator should be used. Only the main graph ExecutionFrame provides one, and only when
+  // kOrtSessionOptionsEnableRunScratchArena is set (see RunScratchArena).
+  virtual AllocatorPtr GetRunScratchAllocator(const OrtDevice& /*device*/) const { return nullptr; }
+
   Status ReleaseMLValue(int ort_value_idx);
 
  protected:
@@ -103,6 +117,11 @@ class IExecutionFrame {
   // returns true if the ort_value_idx is an output from the graph
   bool IsOutput(int ort_value_idx) const;
 
+  // returns true if the ort_value_idx can be passed to GetMLValue/GetMutableMLValue
+  bool IsValidOrtValueIndex(int ort_value_idx) const {
+    return ort_value_idx != NodeIndexInfo::kInvalidEntry && static_cast<size_t>(ort_value_idx) < all_values_size_;
+  }
+
  private:
   ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(IExecutionFrame);
 
@@ -129,6 +148,10 @@ class IExecutionFrame {
   // Input and Output values are passed in by executors
   InlinedVector<OrtValue> all_values_;
 
+  // Optional pool the storage of all_values_ was acquired from and is returned
+  // to on destruction.
+  OrtValueBufferPool* value_buffer_pool_;
+
   // perf optimization to avoid calling all_values_.size() repeatedly as the size is fixed once constructed
   const size_t all_values_size_;
 
@@ -159,9 +182,31 @@ class ExecutionFrame final : public IExecutionFrame {
                                                 const OrtDevice& location, const TensorShape& shape,
                                                 bool is_strided_tensor = false);
 
+  // Copies the tensor behind ort_value_idx into a host staging OrtValue and releases its device
+  // buffer, so the memory can be reused while the value is cold. The copy is enqueued on 'stream'
+  // when one is given, which orders it after the producing kernel; the stream-aware arena makes
+  // releasing the buffer before the copy completes safe for same-stream reuse (this mirrors how
+  // RecycleNodeInputs releases inputs right after an asynchronous kernel launch).
+  // A no-op if the value was never materialized (e.g. a missing optional output).
+  Status OffloadToHost(int ort_value_idx, OrtValue& host_staging, Stream* stream);
+
+  // Re-materializes an offloaded value on its planned device location and enqueues the copy back
+  // from the host staging OrtValue. A no-op if the matching OffloadToHost skipped the value.
+  // The staging value is intentionally left alive: an asynchronous copy may still read from it,
+  // so it is only released together with the execution context at the end of the run.
+  Status PrefetchFromHost(int ort_value_idx, const OrtValue& host_staging, Stream* stream);
+
   // thread-safe
   Status GeneratePatterns(MemoryPatternGroup& out);
 
+  // Returns the per-run scratch arena for CPU kernels when one was built for this frame.
+  AllocatorPtr GetRunScratchAllocator(const OrtDevice& device) const override;
+
+  // Shapes recorded while the planner was tracing a new memory pattern. The session caches them
+  // alongside the generated pattern so later runs with the same input-shape signature can serve
+  // TryGetInferredShape without re-deriving shapes.
+  InlinedHashMap<int, TensorShape> TakeObservedShapes() { return std::move(observed_shapes_); }
+
   bool HasMemoryPatternPlanner() const {
     return planner_.has_value();
   }
@@ -202,6 +247,9 @@ class ExecutionFrame final : public IExecutionFrame {
   Status CopyTensor(const Tensor& src, Tensor& dest) const override;
   const DataTransferManager& GetDataTransferManager() const override;
 
+  // Pinned allocator registered for 'device' if there is one, the plain CPU allocator otherwise.
+  AllocatorPtr GetHostStagingAllocator(const OrtDevice& device) const;
+
   common::Status AllocateReusedOrtValueIfNotAllocatedHelper(int reuse_mlvalue_index, const TensorShape* shape);
 
   common::Status AllocateAsPerAllocationPlan(OrtValue& ort_value, int ort_value_index, const TensorShape* shape);
@@ -215,6 +263,15 @@ class ExecutionFrame final : public IExecutionFrame {
   void TraceAllocate(int ort_value_idx, size_t size);
   void TraceFree(int ort_value_idx);
 
+  void RecordAllocatedBytes(const OrtDevice& device, size_t size);
+  void RecordFreedBytes(const OrtDevice& device, size_t size);
+
+  void RecordObservedShape(int ort_value_idx, const TensorShape* shape);
+
+  // Returns true if the value's symbolic shape is fully determined by the dimensions of the
+  // graph inputs, i.e. every run with the same input-shape signature produces the same shape.
+  bool IsShapeSignatureDeterministic(int ort_value_idx);
+
   const AllocPlanPerValue& GetAllocationPlan(int ort_value_idx);
 
   Stream* GetValueStream(int ort_value_idx) const;
@@ -247,6 +304,35 @@ class ExecutionFrame final : public IExecutionFrame {
   // It is never updated after creation
   const InlinedHashMap<int, TensorShape>* inferred_shapes_{nullptr};
 
+  // Shapes observed for tensors allocated while planner_ was tracing a new memory pattern.
+  // Only values whose symbolic shape is fully determined by the feeds' dimensions are recorded,
+  // so a data-dependent shape (e.g. a NonZero output) is never replayed into a later run.
+  InlinedHashMap<int, TensorShape> observed_shapes_;
+
+  // dim_params appearing on graph inputs; built lazily the first time a shape is recorded.
+  std::optional<InlinedHashSet<std::string>> input_dim_params_;
+
+  // Bytes of live frame-owned allocations and the peak observed so far, per device. The slots are
+  // fixed at construction from the session's registered allocators, so recording an allocation is
+  // a linear scan over a handful of entries plus two relaxed atomic updates and is safe from the
+  // parallel executor's threads. Only built for the main graph frame; the peaks are published to
+  // the session's RunMemoryWatermarks on destruction.
+  struct DeviceWatermark {
+    OrtDevice device;
+    std::atomic<size_t> live_bytes{0};
+    std::atomic<size_t> peak_bytes{0};
+  };
+  std::unique_ptr<DeviceWatermark[]> device_watermarks_;
+  size_t num_device_watermarks_{0};
+
+  // shape signature of the feeds this frame was created with, used to attribute the watermarks
+  std::string input_shape_signature_;
+
+  // Per-run bump allocator for CPU kernel scratch; only built for the main graph frame when
+  // kOrtSessionOptionsEnableRunScratchArena is set. Its peak is published to the session's
+  // RunMemoryWatermarks on destruction so the next run with the same signature pre-sizes its slab.
+  std::shared_ptr<RunScratchArena> scratch_arena_;
+
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
   // Size of virtual memory allocated before any kernel execution.
   // This field is not physical memory size.
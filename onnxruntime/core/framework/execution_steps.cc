@@ -83,6 +83,35 @@ std::string LaunchKernelStep::ToString() const {
 #endif
 }
 
+#if defined(ORT_MINIMAL_BUILD)
+RecomputeKernelStep::RecomputeKernelStep(NodeIndex index)
+    : SequentialExecutionPlan::ExecutionStep(index) {}
+#else
+RecomputeKernelStep::RecomputeKernelStep(NodeIndex index, std::string_view node_name)
+    : SequentialExecutionPlan::ExecutionStep(index), node_name_(node_name) {}
+#endif
+
+Status RecomputeKernelStep::Execute(StreamExecutionContext& ctx,
+                                    size_t stream_idx,
+                                    SessionScope& session_scope,
+                                    const bool& terminate_flag,
+                                    bool& continue_flag) {
+  Status status = ExecuteKernel(ctx, node_index_, stream_idx, terminate_flag, session_scope,
+                                /*is_recompute*/ true);
+  LOGS(ctx.GetLogger(), VERBOSE) << "stream " << stream_idx
+                                 << " recompute node " << node_index_;
+  continue_flag = status.IsOK();
+  return status;
+}
+
+std::string RecomputeKernelStep::ToString() const {
+#if defined(ORT_MINIMAL_BUILD)
+  return MakeString("RecomputeKernel - ", "NodeIndex: ", node_index_);
+#else
+  return MakeString("RecomputeKernel - ", "NodeIndex: ", node_index_, ", Name: ", node_name_);
+#endif
+}
+
 ActivateNotificationStep::ActivateNotificationStep(
     NotificationIndex notification_index, NodeIndex node_index) : SequentialExecutionPlan::ExecutionStep(node_index),
                                                                   notification_idx_(notification_index) {}
@@ -106,6 +135,52 @@ std::string ActivateNotificationStep::ToString() const {
   return MakeString("ActivateNotification - NotificationId: ", notification_idx_);
 }
 
+OffloadToHostStep::OffloadToHostStep(OrtValueIndex value_index, size_t staging_slot, NodeIndex node_index)
+    : SequentialExecutionPlan::ExecutionStep(node_index),
+      value_index_(value_index),
+      staging_slot_(staging_slot) {}
+
+Status OffloadToHostStep::Execute(StreamExecutionContext& ctx,
+                                  size_t stream_idx,
+                                  SessionScope& /*session_scope*/,
+                                  const bool& /*terminate_flag*/,
+                                  bool& continue_flag) {
+  Status status = ctx.GetExecutionFrame().OffloadToHost(value_index_,
+                                                        ctx.GetOffloadStagingValue(staging_slot_),
+                                                        ctx.GetDeviceStream(stream_idx));
+  LOGS(ctx.GetLogger(), VERBOSE) << "stream " << stream_idx
+                                 << " offload value " << value_index_ << " to host";
+  continue_flag = status.IsOK();
+  return status;
+}
+
+std::string OffloadToHostStep::ToString() const {
+  return MakeString("OffloadToHost - OrtValueIndex: ", value_index_, ", StagingSlot: ", staging_slot_);
+}
+
+PrefetchFromHostStep::PrefetchFromHostStep(OrtValueIndex value_index, size_t staging_slot, NodeIndex node_index)
+    : SequentialExecutionPlan::ExecutionStep(node_index),
+      value_index_(value_index),
+      staging_slot_(staging_slot) {}
+
+Status PrefetchFromHostStep::Execute(StreamExecutionContext& ctx,
+                                     size_t stream_idx,
+                                     SessionScope& /*session_scope*/,
+                                     const bool& /*terminate_flag*/,
+                                     bool& continue_flag) {
+  Status status = ctx.GetExecutionFrame().PrefetchFromHost(value_index_,
+                                                           ctx.GetOffloadStagingValue(staging_slot_),
+                                                           ctx.GetDeviceStream(stream_idx));
+  LOGS(ctx.GetLogger(), VERBOSE) << "stream " << stream_idx
+                                 << " prefetch value " << value_index_ << " from host";
+  continue_flag = status.IsOK();
+  return status;
+}
+
+std::string PrefetchFromHostStep::ToString() const {
+  return MakeString("PrefetchFromHost - OrtValueIndex: ", value_index_, ", StagingSlot: ", staging_slot_);
+}
+
 TriggerDownstreamStep::TriggerDownstreamStep(size_t trigger_point_index, NodeIndex node_index)
     : SequentialExecutionPlan::ExecutionStep(node_index), trigger_point_index_(trigger_point_index) {}
 
@@ -64,6 +64,32 @@ class LaunchKernelStep : public SequentialExecutionPlan::ExecutionStep {
 #endif
 };
 
+// Re-executes a cheap producer whose output the plan released after its first consumer, so the
+// value is live again ahead of its second consumer. Unlike LaunchKernelStep it does not recycle
+// the node's inputs or fire output notifications; that already happened at the first execution.
+// See kOrtSessionOptionsActivationRecomputeMinGap.
+class RecomputeKernelStep : public SequentialExecutionPlan::ExecutionStep {
+ public:
+#if defined(ORT_MINIMAL_BUILD)
+  RecomputeKernelStep(NodeIndex index);
+#else
+  RecomputeKernelStep(NodeIndex index, std::string_view node_name);
+#endif
+
+  Status Execute(StreamExecutionContext& ctx,
+                 size_t stream_idx,
+                 SessionScope& session_scope,
+                 const bool& terminate_flag,
+                 bool& continue_flag) override;
+
+  std::string ToString() const override;
+
+#if !defined(ORT_MINIMAL_BUILD)
+ private:
+  std::string node_name_;
+#endif
+};
+
 class ActivateNotificationStep : public SequentialExecutionPlan::ExecutionStep {
  public:
   ActivateNotificationStep(NotificationIndex notification_index, NodeIndex node_index);
@@ -80,6 +106,44 @@ class ActivateNotificationStep : public SequentialExecutionPlan::ExecutionStep {
   NotificationIndex notification_idx_;
 };
 
+// Spills an activation to a host staging buffer right after its producer launched, releasing
+// the device buffer until the matching PrefetchFromHostStep copies the value back.
+// See kOrtSessionOptionsActivationOffloadMinGap.
+class OffloadToHostStep : public SequentialExecutionPlan::ExecutionStep {
+ public:
+  OffloadToHostStep(OrtValueIndex value_index, size_t staging_slot, NodeIndex node_index);
+
+  Status Execute(StreamExecutionContext& ctx,
+                 size_t stream_idx,
+                 SessionScope& /*session_scope*/,
+                 const bool& /*terminate_flag*/,
+                 bool& continue_flag) override;
+
+  std::string ToString() const override;
+
+ private:
+  OrtValueIndex value_index_;
+  size_t staging_slot_;
+};
+
+// Copies an offloaded activation back to its planned device location ahead of the first consumer.
+class PrefetchFromHostStep : public SequentialExecutionPlan::ExecutionStep {
+ public:
+  PrefetchFromHostStep(OrtValueIndex value_index, size_t staging_slot, NodeIndex node_index);
+
+  Status Execute(StreamExecutionContext& ctx,
+                 size_t stream_idx,
+                 SessionScope& /*session_scope*/,
+                 const bool& /*terminate_flag*/,
+                 bool& continue_flag) override;
+
+  std::string ToString() const override;
+
+ private:
+  OrtValueIndex value_index_;
+  size_t staging_slot_;
+};
+
 class TriggerDownstreamStep : public SequentialExecutionPlan::ExecutionStep {
  public:
   TriggerDownstreamStep(size_t trigger_point_index, NodeIndex node_index);
@@ -4,11 +4,14 @@
 #include "core/framework/fallback_cpu_capability.h"
 #include "core/common/inlined_containers.h"
 
+#include <algorithm>
 #include <queue>
 
 #include "onnx/defs/data_type_utils.h"
 
+#include "core/framework/node_cost_model.h"
 #include "core/framework/op_kernel.h"
+#include "core/framework/tensorprotoutils.h"
 #include "core/framework/utils.h"
 
 using namespace ONNX_NAMESPACE::Utils;
@@ -37,6 +40,36 @@ static bool IsSmallInitializer(const onnxruntime::GraphViewer& graph, const Node
 
   return size <= kSmallInitializerThreshold;
 }
+
+// Types that the CPU EP has poor (or no) kernel coverage for; never force such nodes to CPU.
+static bool IsCpuUnfriendlyType(const NodeArg* arg) {
+  return arg->Type() == DataTypeUtils::ToType("float16") ||
+         arg->Type() == DataTypeUtils::ToType("bfloat16") ||
+         arg->Type() == DataTypeUtils::ToType("float8e4m3fn") ||
+         arg->Type() == DataTypeUtils::ToType("float8e4m3fnuz") ||
+         arg->Type() == DataTypeUtils::ToType("float8e5m2") ||
+         arg->Type() == DataTypeUtils::ToType("float8e5m2fnuz");
+}
+
+// Size of the tensor behind 'arg' in bytes, or 0 if the shape is not fully known statically.
+static int64_t EstimateTensorBytes(const NodeArg* arg) {
+  const auto* type_proto = arg->TypeAsProto();
+  if (type_proto == nullptr || !utils::HasTensorType(*type_proto) ||
+      !utils::HasElemType(type_proto->tensor_type()) || !utils::HasShape(type_proto->tensor_type())) {
+    return 0;
+  }
+
+  int64_t elements = 1;
+  for (const auto& dim : type_proto->tensor_type().shape().dim()) {
+    if (!utils::HasDimValue(dim)) {
+      return 0;
+    }
+    elements *= dim.dim_value();
+  }
+
+  const auto* tensor_type = DataTypeImpl::TensorTypeFromONNXEnum(type_proto->tensor_type().elem_type());
+  return elements * static_cast<int64_t>(tensor_type->GetElementType()->Size());
+}
 }  // namespace
 
 std::unordered_set<NodeIndex> GetCpuPreferredNodes(const onnxruntime::GraphViewer& graph,
@@ -128,12 +161,7 @@ std::unordered_set<NodeIndex> GetCpuPreferredNodes(const onnxruntime::GraphViewe
       auto* input = node->InputDefs()[i];
 
       // skip placing on CPU if the data typs is float16 or bfloat16 or float8e4m3fn, float8e4m3fnuz, floate5m2, floate5m2fnuz
-      if (input->Type() == DataTypeUtils::ToType("float16") ||
-          input->Type() == DataTypeUtils::ToType("bfloat16") ||
-          input->Type() == DataTypeUtils::ToType("float8e4m3fn") ||
-          input->Type() == DataTypeUtils::ToType("float8e4m3fnuz") ||
-          input->Type() == DataTypeUtils::ToType("float8e5m2") ||
-          input->Type() == DataTypeUtils::ToType("float8e5m2fnuz")) {
+      if (IsCpuUnfriendlyType(input)) {
         place_in_cpu = false;
         break;
       }
@@ -171,6 +199,92 @@ std::unordered_set<NodeIndex> GetCpuPreferredNodes(const onnxruntime::GraphViewe
     }
   }
 
+  // Second, measured-cost pass. When a calibrated cost model is available (see
+  // NodeCostModel::FromEnvironment) also place a node on CPU whenever its measured CPU time
+  // plus the host/device copies that placement causes beats its measured device time plus the
+  // copies the device placement causes. Decisions are made greedily in topological order so a
+  // node sees the final placement of all of its producers; consumer-side copies are not
+  // anticipated, which keeps this linear instead of solving a cut problem.
+  const NodeCostModel* cost_model = NodeCostModel::FromEnvironment();
+  if (cost_model != nullptr) {
+    for (const NodeIndex node_id : ordered_nodes) {
+      if (provider_nodes.find(node_id) == provider_nodes.end() ||
+          cpu_nodes.find(node_id) != cpu_nodes.end()) {
+        continue;
+      }
+
+      const Node& node = *graph.GetNode(node_id);
+      const auto* op_cost = cost_model->LookUp(node.OpType());
+      if (op_cost == nullptr) {
+        continue;  // not calibrated, leave to the heuristics above
+      }
+
+      const auto defs_are_cpu_friendly = [](ConstPointerContainer<std::vector<NodeArg*>> defs) {
+        return std::none_of(defs.begin(), defs.end(),
+                            [](const NodeArg* def) { return def->Exists() && IsCpuUnfriendlyType(def); });
+      };
+      if (!defs_are_cpu_friendly(node.InputDefs()) || !defs_are_cpu_friendly(node.OutputDefs())) {
+        continue;
+      }
+
+      double cpu_total_us = op_cost->cpu_us;
+      double device_total_us = op_cost->device_us;
+
+      for (const auto* input : node.InputDefs()) {
+        if (!input->Exists()) {
+          continue;
+        }
+
+        // initializers are uploaded once at session initialization, not per run
+        if (graph.GetGraph().GetInitializer(input->Name(), true) != nullptr) {
+          continue;
+        }
+
+        bool input_on_cpu;
+        if (cpu_output_args.find(input) != cpu_output_args.end() ||
+            std::find(graph_inputs.begin(), graph_inputs.end(), input) != graph_inputs.end()) {
+          input_on_cpu = true;
+        } else {
+          const Node* producer = graph.GetProducerNode(input->Name());
+          if (producer == nullptr) {
+            input_on_cpu = true;  // implicit input from an outer scope; fed from host memory
+          } else if (provider_nodes.find(producer->Index()) != provider_nodes.end()) {
+            input_on_cpu = cpu_nodes.find(producer->Index()) != cpu_nodes.end();
+          } else {
+            input_on_cpu = producer->GetExecutionProviderType().empty() ||
+                           producer->GetExecutionProviderType() == kCpuExecutionProvider;
+          }
+        }
+
+        const int64_t bytes = EstimateTensorBytes(input);
+        if (input_on_cpu) {
+          device_total_us += cost_model->TransferCost(bytes);
+        } else {
+          cpu_total_us += cost_model->TransferCost(bytes);
+        }
+      }
+
+      // graph outputs end up in host memory either way, so a device placement pays the download
+      const auto& graph_outputs = graph.GetOutputs();
+      for (const auto* output : node.OutputDefs()) {
+        if (output->Exists() &&
+            std::find(graph_outputs.begin(), graph_outputs.end(), output) != graph_outputs.end()) {
+          device_total_us += cost_model->TransferCost(EstimateTensorBytes(output));
+        }
+      }
+
+      if (cpu_total_us < device_total_us) {
+        cpu_nodes.insert(node_id);
+        for (const auto* output : node.OutputDefs()) {
+          cpu_output_args.insert(output);
+        }
+        LOGS_DEFAULT(INFO) << "ORT optimization- Force fallback to CPU execution for node: " << node.Name()
+                           << " because the calibrated cost model estimates CPU execution at " << cpu_total_us
+                           << "us vs " << device_total_us << "us on the target EP including transfers";
+      }
+    }
+  }
+
   return cpu_nodes;
 }
 
@@ -13,6 +13,8 @@ namespace onnxruntime {
 /**
   Returns a list of nodes that are preferred on CPU.
   They are commonly shape-related computation subgraphs.
+  When a calibrated node cost model is available (NodeCostModel::FromEnvironment) nodes whose
+  measured CPU time plus host/device copies beats their measured device time are also returned.
   @param graph Graph viewer
   @param kernel_lookup The kernel lookup for the target execution provider
   @param tentative_nodes Nodes that are tentative to be placed on on target EP
@@ -5,7 +5,9 @@
 
 #include <cassert>
 #include <functional>
+#include <sstream>
 
+#include "core/framework/compiled_subgraph_blob_cache.h"
 #include "core/framework/compute_capability.h"
 #include "core/framework/execution_providers.h"
 #include "core/framework/func_kernel.h"
@@ -58,6 +60,9 @@ struct PartitionParams {
   std::reference_wrapper<int> fused_node_unique_id;
   std::reference_wrapper<const layout_transformation::TransformLayoutFunction> transform_layout_function;
   std::reference_wrapper<const layout_transformation::DebugGraphFn> debug_graph_fn;
+  // apply the layout transformation even in kAssignOnly mode so that an ORT format model is saved with the
+  // transformed layout and pre-transposed initializers baked in
+  bool transform_layout_when_assign_only{false};
 #endif  // !defined(ORT_MINIMAL_BUILD) || defined(ORT_EXTENDED_MINIMAL_BUILD)
 };
 }  // namespace
@@ -130,6 +135,7 @@ struct GetCapabilityForEPParams {
   GraphPartitioner::Mode mode;
   std::reference_wrapper<const layout_transformation::TransformLayoutFunction> transform_layout;
   std::reference_wrapper<const layout_transformation::DebugGraphFn> debug_graph_fn;
+  bool transform_layout_when_assign_only{false};
 #endif  // !defined(ORT_MINIMAL_BUILD) || defined(ORT_EXTENDED_MINIMAL_BUILD)
 };
 
@@ -182,7 +188,10 @@ static Status GetCapabilityForEP(const GetCapabilityForEPParams& params) {
 #if !defined(ORT_MINIMAL_BUILD) || defined(ORT_EXTENDED_MINIMAL_BUILD)
   // Run layout transformer for EPs with preferred layout of NHWC
   // CPU EP layout transformation happens later when level 3 transformers are run.
-  if (params.mode != GraphPartitioner::Mode::kAssignOnly && params.transform_layout.get() &&
+  // In kAssignOnly mode (ORT format save) the transformation is normally deferred to load time, but it can be
+  // baked into the saved model via transform_layout_when_assign_only.
+  if ((params.mode != GraphPartitioner::Mode::kAssignOnly || params.transform_layout_when_assign_only) &&
+      params.transform_layout.get() &&
       current_ep.GetPreferredLayout() == DataLayout::NHWC) {
     for (auto& capability : capabilities) {
       TryAssignNodes(graph, *capability->sub_graph, ep_type);
@@ -359,7 +368,8 @@ static Status PartitionOnnxFormatModelImpl(Graph& graph, FuncManager& func_mgr,
                                            GraphPartitioner::Mode mode,
                                            int& fused_node_unique_id,
                                            const layout_transformation::TransformLayoutFunction& transform_layout_fn,
-                                           const layout_transformation::DebugGraphFn& debug_graph_fn) {
+                                           const layout_transformation::DebugGraphFn& debug_graph_fn,
+                                           bool transform_layout_when_assign_only) {
   // handle testing edge case where optimizers or constant lifting results in graph with no nodes.
   // doing it here saves all providers checking for this in GetCapability
   if (graph.NumberOfNodes() == 0) {
@@ -373,7 +383,8 @@ static Status PartitionOnnxFormatModelImpl(Graph& graph, FuncManager& func_mgr,
       // we pass through the FuncManager from the top level graph
       ORT_RETURN_IF_ERROR(PartitionOnnxFormatModelImpl(*subgraph, func_mgr, kernel_registry_mgr,
                                                        fused_kernel_registry, current_ep, mode, fused_node_unique_id,
-                                                       transform_layout_fn, debug_graph_fn));
+                                                       transform_layout_fn, debug_graph_fn,
+                                                       transform_layout_when_assign_only));
     }
   }
 
@@ -396,7 +407,8 @@ static Status PartitionOnnxFormatModelImpl(Graph& graph, FuncManager& func_mgr,
       std::ref(capabilities),
       mode,
       std::cref(transform_layout_fn),
-      std::cref(debug_graph_fn)};
+      std::cref(debug_graph_fn),
+      transform_layout_when_assign_only};
 
   ORT_RETURN_IF_ERROR(GetCapabilityForEP(get_capability_params));
   if (capabilities.empty()) {
@@ -456,7 +468,8 @@ static Status PartitionOnnxFormatModelImpl(Graph& graph, FuncManager& func_mgr,
         auto* node = nodes_to_compile[j];
         const auto& cur_capability = *capabilities_to_compile[j];
         viewers.push_back(std::make_unique<GraphViewer>(graph, *cur_capability.sub_graph));
-        nodes_and_viewers.push_back(IExecutionProvider::FusedNodeAndGraph{*node, *viewers.back()});
+        nodes_and_viewers.push_back(IExecutionProvider::FusedNodeAndGraph{*node, *viewers.back(),
+                                                                          ComputeFusedSubgraphHash(*viewers.back())});
       }
 
       ORT_RETURN_IF_ERROR(current_ep.Compile(nodes_and_viewers, node_compute_funcs));
@@ -742,7 +755,8 @@ static Status PartitionOnnxFormatModel(const PartitionParams& partition_params,
       ORT_RETURN_IF_ERROR(PartitionOnnxFormatModelImpl(graph, func_mgr, kernel_registry_manager,
                                                        fused_kernel_registry, *ep, mode, fused_node_unique_id,
                                                        transform_layout_function,
-                                                       partition_params.debug_graph_fn));
+                                                       partition_params.debug_graph_fn,
+                                                       partition_params.transform_layout_when_assign_only));
     }
 
     // expand any nodes that have an ONNX function definition but no matching ORT kernel.
@@ -842,7 +856,9 @@ static Status PartitionOrtFormatModelImpl(const PartitionParams& partition_param
   for (const auto& compilation_entry : compilation_entries) {
     Node& node = compilation_entry.fused_node;
     std::vector<NodeComputeInfo> single_node_compute_func;
-    ORT_RETURN_IF_ERROR(current_ep.Compile({IExecutionProvider::FusedNodeAndGraph{node, *compilation_entry.viewer}},
+    ORT_RETURN_IF_ERROR(current_ep.Compile({IExecutionProvider::FusedNodeAndGraph{
+                                               node, *compilation_entry.viewer,
+                                               ComputeFusedSubgraphHash(*compilation_entry.viewer)}},
                                            single_node_compute_func));
 
     ORT_RETURN_IF(single_node_compute_func.empty(), "single_node_compute_func should have 1 element.");
@@ -927,6 +943,70 @@ Status GraphPartitioner::InlineFunctionsAOT(Model& model,
   return Status::OK();
 }
 
+// assign nodes pinned via kOrtSessionOptionsPartitionPinnedNodes, recursing into nested
+// subgraphs so control flow body nodes can be pinned too
+static void AssignPinnedNodesImpl(Graph& graph, const InlinedHashMap<std::string, std::string>& pins,
+                                  InlinedHashSet<std::string>& assigned) {
+  for (auto& node : graph.Nodes()) {
+    auto it = pins.find(node.Name());
+    if (it != pins.end()) {
+      node.SetExecutionProviderType(it->second);
+      assigned.insert(it->first);
+    }
+
+    for (auto& entry : node.GetAttributeNameToMutableSubgraphMap()) {
+      AssignPinnedNodesImpl(*entry.second, pins, assigned);
+    }
+  }
+}
+
+// Honor explicit "<node name>:<provider type>" placement requests before the capability based
+// pass runs. The capability pass never reassigns an assigned node (see TryAssignNodes), so this
+// lets users split a model layer-wise across the session's providers; the usual memcpy transform
+// passes insert any cross device transfers the split requires.
+static Status AssignPinnedNodes(Graph& graph, const ExecutionProviders& providers,
+                                const ConfigOptions& config_options) {
+  const std::string pinned = config_options.GetConfigOrDefault(kOrtSessionOptionsPartitionPinnedNodes, "");
+  if (pinned.empty()) {
+    return Status::OK();
+  }
+
+  InlinedHashMap<std::string, std::string> pins;
+  std::istringstream stream{pinned};
+  std::string entry;
+  while (std::getline(stream, entry, ';')) {
+    if (entry.empty()) {
+      continue;
+    }
+
+    // split on the last ':' as ONNX node names may themselves contain ':'
+    auto sep = entry.rfind(':');
+    ORT_RETURN_IF(sep == std::string::npos || sep == 0 || sep + 1 == entry.size(),
+                  "Invalid ", kOrtSessionOptionsPartitionPinnedNodes, " entry '", entry,
+                  "'. Expected <node name>:<execution provider type>.");
+
+    std::string ep_type = entry.substr(sep + 1);
+    ORT_RETURN_IF(providers.Get(ep_type) == nullptr,
+                  "Execution provider '", ep_type, "' requested for pinned node '", entry.substr(0, sep),
+                  "' is not registered in this session.");
+
+    pins.insert_or_assign(entry.substr(0, sep), std::move(ep_type));
+  }
+
+  InlinedHashSet<std::string> assigned;
+  assigned.reserve(pins.size());
+  AssignPinnedNodesImpl(graph, pins, assigned);
+
+  // a silently ignored pin (e.g. a typo in the node name) would defeat the point of an explicit
+  // placement, so fail instead
+  for (const auto& pin : pins) {
+    ORT_RETURN_IF(assigned.find(pin.first) == assigned.end(),
+                  "Pinned node '", pin.first, "' was not found in the model.");
+  }
+
+  return Status::OK();
+}
+
 #endif
 
 Status GraphPartitioner::Partition(Graph& graph, FuncManager& func_mgr,
@@ -948,6 +1028,19 @@ Status GraphPartitioner::Partition(Graph& graph, FuncManager& func_mgr,
   }
 
 #if !defined(ORT_MINIMAL_BUILD) || defined(ORT_EXTENDED_MINIMAL_BUILD)
+  // hand every EP the process wide compiled subgraph blob store so compiling EPs can reuse
+  // compiled blobs across sessions, and across processes when a backing directory is configured
+  auto& compiled_blob_cache = CompiledSubgraphBlobCache::Instance();
+  const std::string compiled_blob_cache_dir =
+      config_options.GetConfigOrDefault(kOrtSessionOptionsCompiledSubgraphBlobCacheDir, "");
+  if (!compiled_blob_cache_dir.empty()) {
+    compiled_blob_cache.SetBackingDirectory(compiled_blob_cache_dir);
+  }
+
+  for (const auto& ep : providers_) {
+    ep->SetCompiledSubgraphBlobStore(&compiled_blob_cache);
+  }
+
   // fused_kernel_registry is preparing the kernels created on the fly for fused sub graph.
   // It is only visible for current session.
   std::shared_ptr<KernelRegistry> fused_kernel_registry = std::make_shared<KernelRegistry>();
@@ -955,6 +1048,12 @@ Status GraphPartitioner::Partition(Graph& graph, FuncManager& func_mgr,
   // we make sure each fused node name is unique across the entire model for clarity
   int fused_node_unique_id = 0;
 
+  // when saving an ORT format model the layout transformation can optionally be applied up front so the
+  // transformed layout and pre-transposed initializers are baked into the saved model
+  const bool transform_layout_when_assign_only =
+      mode == Mode::kAssignOnly &&
+      config_options.GetConfigOrDefault(kOrtSessionOptionsSaveOrtFormatApplyLayoutTransformation, "0") == "1";
+
   PartitionParams partition_params{
       std::ref(graph),
       std::ref(func_mgr),
@@ -962,6 +1061,7 @@ Status GraphPartitioner::Partition(Graph& graph, FuncManager& func_mgr,
       std::ref(fused_node_unique_id),
       std::cref(transform_layout_function),
       std::cref(debug_graph_fn),
+      transform_layout_when_assign_only,
   };
 
 #else  // !defined(ORT_MINIMAL_BUILD) || defined(ORT_EXTENDED_MINIMAL_BUILD)
@@ -977,6 +1077,8 @@ Status GraphPartitioner::Partition(Graph& graph, FuncManager& func_mgr,
 
   if (mode == Mode::kNormal || mode == Mode::kAssignOnly) {
 #if !defined(ORT_MINIMAL_BUILD)
+    ORT_RETURN_IF_ERROR(AssignPinnedNodes(graph, providers_, config_options));
+
     ORT_RETURN_IF_ERROR(PartitionOnnxFormatModel(partition_params, mode,
                                                  providers_, kernel_registry_mgr_));
 
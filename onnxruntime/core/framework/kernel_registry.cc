@@ -14,8 +14,9 @@
 namespace onnxruntime {
 
 namespace {
+// mismatch_reason may be nullptr when the caller does not need an explanation.
 bool IsTypeProtoCompatible(gsl::span<const MLDataType> enabled_types, const ONNX_NAMESPACE::TypeProto& actual_type,
-                           std::string& mismatch_reason) {
+                           std::string* mismatch_reason) {
   const bool is_type_compatible = std::any_of(
       enabled_types.begin(), enabled_types.end(),
       [&actual_type](const DataTypeImpl* expected_type) {
@@ -24,15 +25,17 @@ bool IsTypeProtoCompatible(gsl::span<const MLDataType> enabled_types, const ONNX
       });
 
   if (!is_type_compatible) {
-    std::ostringstream ostr;
-    ostr << "This op has been implemented only for the following types (";
-    for (const auto& enabled_type : enabled_types) {
-      ostr << DataTypeImpl::ToString(enabled_type) << ",";
+    if (mismatch_reason != nullptr) {
+      std::ostringstream ostr;
+      ostr << "This op has been implemented only for the following types (";
+      for (const auto& enabled_type : enabled_types) {
+        ostr << DataTypeImpl::ToString(enabled_type) << ",";
+      }
+      ostr << "),";
+      const char* actual_type_str = DataTypeImpl::ToString(DataTypeImpl::TypeFromProto(actual_type));
+      ostr << " but the node in the model has the following type (" << actual_type_str << ")";
+      *mismatch_reason = ostr.str();
     }
-    ostr << "),";
-    const char* actual_type_str = DataTypeImpl::ToString(DataTypeImpl::TypeFromProto(actual_type));
-    ostr << " but the node in the model has the following type (" << actual_type_str << ")";
-    mismatch_reason = ostr.str();
     return false;
   }
 
@@ -43,7 +46,7 @@ bool IsTypeProtoCompatible(gsl::span<const MLDataType> enabled_types, const ONNX
 bool MatchKernelDefTypes(const Node& node,
                          const std::unordered_map<std::string, std::vector<MLDataType>>& kernel_type_constraints,
                          const IKernelTypeStrResolver& kernel_type_str_resolver,
-                         std::string& mismatch_reason) {
+                         std::string* mismatch_reason) {
   const auto actual_inputs = node.InputDefs();
   const auto actual_outputs = node.OutputDefs();
   const auto& actual_input_arg_counts = node.InputArgCount();
@@ -116,7 +119,8 @@ bool MatchKernelDefTypes(const std::unordered_map<std::string, std::vector<MLDat
 }
 }  // namespace
 
-static bool VerifyVersion(int since_ver, const KernelDef& kernel_def, std::string& error_str) {
+// error_str may be nullptr when the caller does not need an explanation.
+static bool VerifyVersion(int since_ver, const KernelDef& kernel_def, std::string* error_str) {
   // check if version matches
   int kernel_start_version;
   int kernel_end_version;
@@ -131,13 +135,13 @@ static bool VerifyVersion(int since_ver, const KernelDef& kernel_def, std::strin
       (kernel_end_version != INT_MAX &&
        kernel_start_version <= since_ver && kernel_end_version >= since_ver);
 
-  if (!valid_version) {
+  if (!valid_version && error_str != nullptr) {
     std::ostringstream ostr;
     ostr << " Version mismatch."
          << " node_version: " << since_ver
          << " kernel start version: " << kernel_start_version
          << " kernel_end_version: " << kernel_end_version;
-    error_str = ostr.str();
+    *error_str = ostr.str();
   }
   return valid_version;
 }
@@ -146,7 +150,7 @@ bool KernelRegistry::VerifyKernelDef(const Node& node,
                                      const KernelDef& kernel_def,
                                      const IKernelTypeStrResolver* kernel_type_str_resolver,
                                      const TypeConstraintMap* type_constraint_values,
-                                     std::string& error_str) {
+                                     std::string* error_str) {
   // check if version matches
   bool valid_version = VerifyVersion(node.SinceVersion(), kernel_def, error_str);
 
@@ -159,15 +163,15 @@ bool KernelRegistry::VerifyKernelDef(const Node& node,
 
   bool matched = type_constraint_values ? MatchKernelDefTypes(kernel_type_constraints, *type_constraint_values)
                                         : MatchKernelDefTypes(node, kernel_type_constraints, *kernel_type_str_resolver,
-                                                              mismatch_reason);
+                                                              error_str != nullptr ? &mismatch_reason : nullptr);
 
-  if (!matched) {
+  if (!matched && error_str != nullptr) {
     std::ostringstream ostr;
     ostr << "Kernel found kernel"
          << " in the supported version range"
          << " (node_version: " << node.SinceVersion() << ")."
          << " However the types are incompatible. " << mismatch_reason;
-    error_str = ostr.str();
+    *error_str = ostr.str();
   }
 
   return matched;
@@ -186,21 +190,29 @@ Status KernelRegistry::TryFindKernelImpl(const Node& node,
   const auto& node_provider = node.GetExecutionProviderType();
   const auto& expected_provider = (node_provider.empty() ? exec_provider : node_provider);
 
-  auto range = kernel_creator_fn_map_.equal_range(GetMapKey(node.OpType(), node.Domain(), expected_provider));
+  const auto index_entry = kernel_index_.find(GetMapKey(node.OpType(), node.Domain(), expected_provider));
   if (out) *out = nullptr;
 
   std::vector<std::string> verify_kernel_def_error_strs;
 
-  for (auto i = range.first; i != range.second; ++i) {
-    std::string error_str;
-    if (VerifyKernelDef(node, *i->second.kernel_def, kernel_type_str_resolver, type_constraints, error_str)) {
-      if (out) {
-        *out = &i->second;
+  if (index_entry != kernel_index_.end()) {
+    // Fast pass without diagnostics: resolution runs for every node against every candidate kernel
+    // and most rejections (wrong opset version or types) are expected, so the mismatch
+    // explanations are only built if the lookup fails outright.
+    for (const KernelCreateInfo* candidate : index_entry->second) {
+      if (VerifyKernelDef(node, *candidate->kernel_def, kernel_type_str_resolver, type_constraints, nullptr)) {
+        if (out) {
+          *out = candidate;
+        }
+        return Status::OK();
       }
-      return Status::OK();
     }
 
-    verify_kernel_def_error_strs.push_back(error_str);
+    for (const KernelCreateInfo* candidate : index_entry->second) {
+      std::string error_str;
+      VerifyKernelDef(node, *candidate->kernel_def, kernel_type_str_resolver, type_constraints, &error_str);
+      verify_kernel_def_error_strs.push_back(std::move(error_str));
+    }
   }
 
   if (!verify_kernel_def_error_strs.empty()) {
@@ -233,9 +245,10 @@ Status KernelRegistry::TryFindKernel(const Node& node, ProviderType exec_provide
   return TryFindKernelImpl(node, exec_provider, nullptr, &type_constraints, out);
 }
 
+// error_str may be nullptr when the caller does not need an explanation.
 static bool KernelDefCompatible(int version, const KernelDef& kernel_def,
                                 const KernelRegistry::TypeConstraintMap& type_constraint_values,
-                                std::string& error_str) {
+                                std::string* error_str) {
   if (!VerifyVersion(version, kernel_def, error_str)) {
     return false;
   }
@@ -243,13 +256,13 @@ static bool KernelDefCompatible(int version, const KernelDef& kernel_def,
   const auto& kernel_type_constraints = kernel_def.TypeConstraints();
   bool matched = MatchKernelDefTypes(kernel_type_constraints, type_constraint_values);
 
-  if (!matched) {
+  if (!matched && error_str != nullptr) {
     std::ostringstream ostr;
     ostr << "Kernel found kernel"
          << " in the supported version range"
          << " (node_version: " << version << ")."
          << " However the types are incompatible.";
-    error_str = ostr.str();
+    *error_str = ostr.str();
   }
 
   return matched;
@@ -261,21 +274,27 @@ Status KernelRegistry::TryFindKernel(ProviderType exec_provider,
                                      int version,
                                      const KernelRegistry::TypeConstraintMap& type_constraints,
                                      const KernelCreateInfo** out) const {
-  auto range = kernel_creator_fn_map_.equal_range(GetMapKey(op_type, domain, exec_provider));
+  const auto index_entry = kernel_index_.find(GetMapKey(op_type, domain, exec_provider));
   if (out) *out = nullptr;
 
   std::vector<std::string> verify_kernel_def_error_strs;
 
-  for (auto i = range.first; i != range.second; ++i) {
-    std::string error_str;
-    if (KernelDefCompatible(version, *i->second.kernel_def, type_constraints, error_str)) {
-      if (out) {
-        *out = &i->second;
+  if (index_entry != kernel_index_.end()) {
+    // Fast pass without diagnostics; see TryFindKernelImpl.
+    for (const KernelCreateInfo* candidate : index_entry->second) {
+      if (KernelDefCompatible(version, *candidate->kernel_def, type_constraints, nullptr)) {
+        if (out) {
+          *out = candidate;
+        }
+        return Status::OK();
       }
-      return Status::OK();
     }
 
-    verify_kernel_def_error_strs.push_back(error_str);
+    for (const KernelCreateInfo* candidate : index_entry->second) {
+      std::string error_str;
+      KernelDefCompatible(version, *candidate->kernel_def, type_constraints, &error_str);
+      verify_kernel_def_error_strs.push_back(std::move(error_str));
+    }
   }
 
   if (!verify_kernel_def_error_strs.empty()) {
@@ -306,20 +325,43 @@ Status KernelRegistry::Register(KernelCreateInfo&& create_info) {
   }
   const std::string key = GetMapKey(*create_info.kernel_def);
   // Check op version conflicts.
-  const auto range = kernel_creator_fn_map_.equal_range(key);
-  for (auto i = range.first; i != range.second; ++i) {
-    if (i->second.kernel_def &&
-        i->second.kernel_def->IsConflict(*create_info.kernel_def)) {
-      return Status(common::ONNXRUNTIME, common::FAIL,
-                    "Failed to add kernel for " + key +
-                        ": Conflicting with a registered kernel with op versions.");
+  const auto index_entry = kernel_index_.find(key);
+  if (index_entry != kernel_index_.end()) {
+    for (const KernelCreateInfo* registered : index_entry->second) {
+      if (registered->kernel_def &&
+          registered->kernel_def->IsConflict(*create_info.kernel_def)) {
+        return Status(common::ONNXRUNTIME, common::FAIL,
+                      "Failed to add kernel for " + key +
+                          ": Conflicting with a registered kernel with op versions.");
+      }
     }
   }
 
   // Register the kernel.
   // Ownership of the KernelDef is transferred to kernel_creator_fn_map_.
-  kernel_creator_fn_map_.emplace(key, std::move(create_info));
+  auto iter = kernel_creator_fn_map_.emplace(key, std::move(create_info));
+  kernel_index_[key].push_back(&iter->second);
   return Status::OK();
 }
 
+void KernelRegistry::Trim(const InlinedHashSet<const KernelCreateInfo*>& kernels_to_keep) {
+  // erasing from the multimap only invalidates the erased entries, so pointers to the kept
+  // KernelCreateInfos (held by session states) stay valid
+  for (auto it = kernel_creator_fn_map_.begin(); it != kernel_creator_fn_map_.end();) {
+    if (kernels_to_keep.find(&it->second) == kernels_to_keep.end()) {
+      it = kernel_creator_fn_map_.erase(it);
+      trimmed_ = true;
+    } else {
+      ++it;
+    }
+  }
+
+  if (trimmed_) {
+    kernel_index_.clear();
+    for (auto& [key, create_info] : kernel_creator_fn_map_) {
+      kernel_index_[key].push_back(&create_info);
+    }
+  }
+}
+
 }  // namespace onnxruntime
@@ -104,6 +104,25 @@ Status KernelRegistryManager::SearchKernelRegistry(const Node& node,
   return Status(ONNXRUNTIME, NOT_IMPLEMENTED, create_error_message("Failed to find kernel for "));
 }
 
+void KernelRegistryManager::TrimKernelRegistries(const InlinedHashSet<const KernelCreateInfo*>& kernels_to_keep) {
+  auto trim_if_exclusive = [&kernels_to_keep](const std::shared_ptr<KernelRegistry>& registry) {
+    // a registry another session (or an EP's registry cache) still references must keep its
+    // full kernel set; use_count() == 1 means this manager holds the only reference
+    if (registry.use_count() == 1) {
+      registry->Trim(kernels_to_keep);
+    }
+  };
+
+  for (auto& [provider_type, registry] : provider_type_to_registry_) {
+    ORT_UNUSED_PARAMETER(provider_type);
+    trim_if_exclusive(registry);
+  }
+
+  for (auto& registry : custom_kernel_registries_) {
+    trim_if_exclusive(registry);
+  }
+}
+
 bool KernelRegistryManager::HasImplementationOf(const KernelRegistryManager& r, const Node& node, const std::string& provider_type) {
   const auto kernel_registries = r.GetKernelRegistriesByProviderType(provider_type);
   return std::any_of(kernel_registries.begin(), kernel_registries.end(), [&](const KernelRegistry* kernel_registry) {
@@ -80,6 +80,15 @@ class KernelRegistryManager {
                       SessionState& session_state,
                       const KernelCreateInfo& kernel_create_info, std::unique_ptr<OpKernel>& out) const;
 
+  /**
+   * Removes every kernel that is not in kernels_to_keep from the registries this manager
+   * exclusively owns, returning the memory of the kernels the session can never reach.
+   * Only call after session initialization is complete: kernel lookups for ops outside
+   * kernels_to_keep will fail afterwards. Registries that are shared (still referenced by
+   * another session or cached by an execution provider) are left untouched.
+   */
+  void TrimKernelRegistries(const InlinedHashSet<const KernelCreateInfo*>& kernels_to_keep);
+
   const IKernelTypeStrResolver& GetKernelTypeStrResolver() const {
     return std::visit([](auto&& r) -> const IKernelTypeStrResolver& { return r; }, kernel_type_str_resolver_variant_);
   }
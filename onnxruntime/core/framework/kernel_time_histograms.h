@@ -0,0 +1,79 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+#include "core/common/common.h"
+
+namespace onnxruntime {
+
+/**
+ * Lock-free per-node latency histograms, cheap enough to leave enabled in production.
+ *
+ * Unlike the session Profiler, which records a JSON trace event with formatted metadata for every
+ * node, this collector only does a handful of relaxed atomic increments per sampled invocation and
+ * never allocates after construction. The storage is a flat array indexed by NodeIndex that is
+ * sized once when the kernels are created, so readers and writers never contend on a lock and a
+ * snapshot can be taken while inference is running (counters in a snapshot are individually
+ * consistent, not a consistent cut across nodes).
+ *
+ * Latencies are wall-clock time of OpKernel::Compute on the launching thread, bucketed by
+ * power-of-two nanoseconds: bucket b counts sampled invocations in [2^b, 2^(b+1)) ns, with the
+ * last bucket absorbing anything larger.
+ */
+class KernelTimeHistograms {
+ public:
+  // 2^39 ns is ~9 minutes; no sane kernel latency lands above the last bucket.
+  static constexpr size_t kNumBuckets = 40;
+
+  struct Histogram {
+    // Total invocations, whether or not they were sampled.
+    std::atomic<uint64_t> invocations{0};
+    // Invocations that were timed and contributed to total_ns/buckets.
+    std::atomic<uint64_t> sampled{0};
+    std::atomic<uint64_t> total_ns{0};
+    std::atomic<uint64_t> buckets[kNumBuckets]{};
+  };
+
+  KernelTimeHistograms(size_t num_nodes, uint64_t sampling_interval)
+      : histograms_(std::make_unique<Histogram[]>(num_nodes)),
+        num_nodes_(num_nodes),
+        sampling_interval_(sampling_interval == 0 ? 1 : sampling_interval) {}
+
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(KernelTimeHistograms);
+
+  // Counts the invocation and returns true when this one should be timed. Sampling is per node so
+  // rarely executed nodes still accumulate data at any interval.
+  bool ShouldSample(size_t node_index) {
+    const uint64_t n = histograms_[node_index].invocations.fetch_add(1, std::memory_order_relaxed);
+    return n % sampling_interval_ == 0;
+  }
+
+  void Record(size_t node_index, uint64_t elapsed_ns) {
+    size_t bucket = 0;
+    for (uint64_t v = elapsed_ns; v > 1 && bucket < kNumBuckets - 1; v >>= 1) {
+      ++bucket;
+    }
+    auto& histogram = histograms_[node_index];
+    histogram.sampled.fetch_add(1, std::memory_order_relaxed);
+    histogram.total_ns.fetch_add(elapsed_ns, std::memory_order_relaxed);
+    histogram.buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+  }
+
+  const Histogram& GetHistogram(size_t node_index) const { return histograms_[node_index]; }
+
+  size_t NumNodes() const { return num_nodes_; }
+
+  uint64_t SamplingInterval() const { return sampling_interval_; }
+
+ private:
+  std::unique_ptr<Histogram[]> histograms_;
+  size_t num_nodes_;
+  uint64_t sampling_interval_;
+};
+
+}  // namespace onnxruntime
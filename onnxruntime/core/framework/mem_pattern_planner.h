@@ -130,7 +130,12 @@ class MemPatternPlanner {
   }
 #endif
 
-  void TraceAllocation(int ml_value_idx, size_t size) {
+  // contiguous_group (-1 for ungrouped) identifies allocations that should be laid out
+  // back-to-back, e.g. the sibling outputs of one node (see
+  // AllocPlanPerValue::contiguous_sibling_group). When this allocation directly follows another
+  // one of the same group, it is placed at the end of that block if the space is free, in
+  // preference to best-fit placement into an arbitrary gap.
+  void TraceAllocation(int ml_value_idx, size_t size, int contiguous_group = -1) {
     ORT_ENFORCE(!using_counters_);
 
     std::lock_guard<OrtMutex> lock(lock_);
@@ -140,6 +145,57 @@ class MemPatternPlanner {
       return;
     }
 
+    size_t best_offset = 0;
+    bool best_offset_found = false;
+
+    if (contiguous_group >= 0 && contiguous_group == last_contiguous_group_) {
+      // Adjacency is safe iff no live block overlaps the candidate range; same invariant the
+      // best-fit search below maintains.
+      const size_t candidate = last_contiguous_end_;
+      bool is_free = true;
+      for (auto it = blocks_.begin(); it != blocks_.end(); it++) {
+        const auto& block = allocs_[*it].block_;
+        if (block.offset_ < candidate + size && candidate < block.offset_ + block.size_) {
+          is_free = false;
+          break;
+        }
+      }
+      if (is_free) {
+        best_offset = candidate;
+        best_offset_found = true;
+      }
+    }
+
+    if (!best_offset_found) {
+      best_offset = BestFitOffset(size);
+    }
+
+    // we only need to bounds check the addition of size to best_offset as that is the only time we extend
+    // the maximum size of the buffer.
+    buffer_size_ = std::max(buffer_size_, SafeInt<size_t>(best_offset) + size);
+    allocs_.emplace_back(ml_value_idx, MemoryBlock(best_offset, size));
+    std::list<int>::iterator best_fit_it = blocks_.end();
+    for (auto it = blocks_.begin(); it != blocks_.end(); it++) {
+      if (allocs_[*it].block_.offset_ < best_offset)
+        continue;
+
+      if ((allocs_[*it].block_.offset_ > best_offset) || (allocs_[*it].block_.size_ >= size)) {
+        best_fit_it = it;
+        break;
+      }
+    }
+
+    blocks_.insert(best_fit_it, (static_cast<int>(allocs_.size()) - 1));
+
+    if (contiguous_group >= 0) {
+      last_contiguous_group_ = contiguous_group;
+      last_contiguous_end_ = best_offset + size;
+    }
+  }
+
+ private:
+  // Best-fit placement over the gaps between live blocks, falling back to the end of the buffer.
+  size_t BestFitOffset(size_t size) {
     size_t current = 0;
     size_t waste_bytes = std::numeric_limits<size_t>::max();
     size_t best_offset = 0;
@@ -171,24 +227,10 @@ class MemPatternPlanner {
       best_offset = current;
     }
 
-    // we only need to bounds check the addition of size to best_offset as that is the only time we extend
-    // the maximum size of the buffer.
-    buffer_size_ = std::max(buffer_size_, SafeInt<size_t>(best_offset) + size);
-    allocs_.emplace_back(ml_value_idx, MemoryBlock(best_offset, size));
-    std::list<int>::iterator best_fit_it = blocks_.end();
-    for (auto it = blocks_.begin(); it != blocks_.end(); it++) {
-      if (allocs_[*it].block_.offset_ < best_offset)
-        continue;
-
-      if ((allocs_[*it].block_.offset_ > best_offset) || (allocs_[*it].block_.size_ >= size)) {
-        best_fit_it = it;
-        break;
-      }
-    }
-
-    blocks_.insert(best_fit_it, (static_cast<int>(allocs_.size()) - 1));
+    return best_offset;
   }
 
+ public:
   void TraceFree(int ml_value_index) {
     std::lock_guard<OrtMutex> lock(lock_);
 
@@ -261,6 +303,10 @@ class MemPatternPlanner {
   std::list<int> blocks_;
   SafeInt<size_t> buffer_size_{0};
   bool using_counters_;
+  // contiguous group and end offset of the most recently placed grouped allocation; the next
+  // allocation of the same group is placed right behind it when that space is free
+  int last_contiguous_group_{-1};
+  size_t last_contiguous_end_{0};
   mutable OrtMutex lock_;
 };
 
@@ -0,0 +1,47 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/memory_budget.h"
+
+namespace onnxruntime {
+
+void SessionMemoryBudget::RegisterEvictionCallback(const std::string& name, EvictionCallback callback) {
+  ORT_ENFORCE(callback != nullptr, "Eviction callback must not be null: ", name);
+  std::lock_guard<OrtMutex> lock(mutex_);
+  entries_.push_back(Entry{name, std::move(callback), 0, 0});
+}
+
+size_t SessionMemoryBudget::Relieve(size_t bytes_needed) {
+  std::lock_guard<OrtMutex> lock(mutex_);
+  ++pressure_events_;
+
+  size_t released = 0;
+  for (Entry& entry : entries_) {
+    if (released >= bytes_needed) {
+      break;
+    }
+
+    const size_t from_callback = entry.callback(bytes_needed - released);
+    ++entry.invocations;
+    entry.released_bytes += from_callback;
+    released += from_callback;
+  }
+
+  released_bytes_ += released;
+  return released;
+}
+
+SessionMemoryBudget::Stats SessionMemoryBudget::GetStats() const {
+  std::lock_guard<OrtMutex> lock(mutex_);
+  Stats stats;
+  stats.budget_bytes = budget_bytes_;
+  stats.pressure_events = pressure_events_;
+  stats.released_bytes = released_bytes_;
+  stats.callbacks.reserve(entries_.size());
+  for (const Entry& entry : entries_) {
+    stats.callbacks.push_back(CallbackStats{entry.name, entry.invocations, entry.released_bytes});
+  }
+  return stats;
+}
+
+}  // namespace onnxruntime
@@ -0,0 +1,81 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "core/common/common.h"
+#include "core/platform/ort_mutex.h"
+
+namespace onnxruntime {
+
+/**
+ * Opt-in per-session soft memory cap for multi-tenant hosts. The budget does not make
+ * allocations fail: when the session's arena is about to grow past the configured byte count it
+ * asks the budget to relieve the overage, and the budget walks the registered eviction callbacks
+ * in registration order until enough bytes were released (or every callback ran). Callbacks drop
+ * state that can be rebuilt at a latency cost - memoization caches, free arena regions - so a
+ * shape spike degrades that session's latency instead of pushing the process towards the hard
+ * arena limit. Enabled with kOrtSessionOptionsMemoryBudgetBytes.
+ *
+ * Callbacks run outside the arena lock and may free arena memory, but must not allocate from
+ * the budgeted arena; an allocation above the budget from inside a callback would re-enter
+ * Relieve. Thread-safe.
+ */
+class SessionMemoryBudget {
+ public:
+  /// Returns the number of bytes the callback released. Called with the number of bytes still
+  /// needed to get back under the budget; a callback with nothing to release returns 0.
+  using EvictionCallback = std::function<size_t(size_t bytes_needed)>;
+
+  explicit SessionMemoryBudget(size_t budget_bytes) : budget_bytes_(budget_bytes) {}
+
+  /// Registers a callback under a stable name for reporting. Callbacks are invoked in
+  /// registration order, so register the cheapest-to-rebuild state first. Registration is
+  /// expected to happen during session initialization, before Relieve can run.
+  void RegisterEvictionCallback(const std::string& name, EvictionCallback callback);
+
+  /// Invokes the eviction callbacks in registration order until at least bytes_needed bytes
+  /// were released or every callback ran. Returns the total bytes released.
+  size_t Relieve(size_t bytes_needed);
+
+  size_t BudgetBytes() const { return budget_bytes_; }
+
+  struct CallbackStats {
+    std::string name;
+    size_t invocations = 0;
+    size_t released_bytes = 0;
+  };
+
+  struct Stats {
+    size_t budget_bytes = 0;
+    // number of Relieve calls, i.e. allocations that would have pushed the arena past the budget
+    size_t pressure_events = 0;
+    size_t released_bytes = 0;
+    std::vector<CallbackStats> callbacks;
+  };
+
+  Stats GetStats() const;
+
+ private:
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(SessionMemoryBudget);
+
+  struct Entry {
+    std::string name;
+    EvictionCallback callback;
+    size_t invocations = 0;
+    size_t released_bytes = 0;
+  };
+
+  const size_t budget_bytes_;
+
+  mutable OrtMutex mutex_;
+  std::vector<Entry> entries_;
+  size_t pressure_events_ = 0;
+  size_t released_bytes_ = 0;
+};
+
+}  // namespace onnxruntime
@@ -0,0 +1,78 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/node_cost_model.h"
+
+#include <fstream>
+#include <memory>
+#include <sstream>
+
+#include "core/common/logging/logging.h"
+#include "core/platform/env.h"
+
+namespace onnxruntime {
+
+Status NodeCostModel::Load(const std::filesystem::path& path) {
+  std::ifstream file(path);
+  ORT_RETURN_IF_NOT(file, "Failed to open node cost model file: ", path.string());
+
+  std::string line;
+  size_t line_number = 0;
+  while (std::getline(file, line)) {
+    ++line_number;
+
+    const auto comment_pos = line.find('#');
+    if (comment_pos != std::string::npos) {
+      line.resize(comment_pos);
+    }
+
+    std::istringstream tokens(line);
+    std::string key;
+    if (!(tokens >> key)) {
+      continue;  // blank or comment-only line
+    }
+
+    if (key == "transfer_latency_us") {
+      ORT_RETURN_IF_NOT(tokens >> transfer_latency_us_ && transfer_latency_us_ >= 0.0,
+                        "Invalid transfer_latency_us at line ", line_number, " of ", path.string());
+    } else if (key == "transfer_bandwidth_bytes_per_us") {
+      ORT_RETURN_IF_NOT(tokens >> transfer_bandwidth_bytes_per_us_ && transfer_bandwidth_bytes_per_us_ > 0.0,
+                        "Invalid transfer_bandwidth_bytes_per_us at line ", line_number, " of ", path.string());
+    } else {
+      OpCost cost{};
+      ORT_RETURN_IF_NOT(tokens >> cost.cpu_us >> cost.device_us && cost.cpu_us >= 0.0 && cost.device_us >= 0.0,
+                        "Invalid cost entry for op '", key, "' at line ", line_number, " of ", path.string());
+      op_costs_[key] = cost;  // last entry for an op wins
+    }
+  }
+
+  return Status::OK();
+}
+
+const NodeCostModel::OpCost* NodeCostModel::LookUp(const std::string& op_type) const {
+  auto it = op_costs_.find(op_type);
+  return it != op_costs_.end() ? &it->second : nullptr;
+}
+
+const NodeCostModel* NodeCostModel::FromEnvironment() {
+  static const std::unique_ptr<NodeCostModel> instance = []() -> std::unique_ptr<NodeCostModel> {
+    const std::string path = Env::Default().GetEnvironmentVar("ORT_NODE_COST_MODEL_PATH");
+    if (path.empty()) {
+      return nullptr;
+    }
+
+    auto model = std::make_unique<NodeCostModel>();
+    const auto status = model->Load(path);
+    if (!status.IsOK()) {
+      LOGS_DEFAULT(WARNING) << "Ignoring node cost model: " << status.ErrorMessage();
+      return nullptr;
+    }
+
+    LOGS_DEFAULT(INFO) << "Loaded node cost model from " << path;
+    return model;
+  }();
+
+  return instance.get();
+}
+
+}  // namespace onnxruntime
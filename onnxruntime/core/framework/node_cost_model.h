@@ -0,0 +1,64 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+
+#include "core/common/common.h"
+
+namespace onnxruntime {
+
+/**
+ * Per-op execution cost estimates used to decide CPU vs device placement of nodes that a
+ * device EP could run (see GetCpuPreferredNodes). The numbers are measured, not modeled:
+ * they come from a calibration file that is typically produced by profiling a
+ * representative run on both providers (the ORT profiler's per-node timings reduce
+ * directly to the file format below).
+ *
+ * File format, one entry per line, '#' starts a comment:
+ *
+ *   transfer_latency_us <fixed cost of one host/device copy, microseconds>
+ *   transfer_bandwidth_bytes_per_us <sustained copy bandwidth>
+ *   <op_type> <cpu microseconds> <device microseconds>
+ *
+ * Ops without an entry are left to the existing placement heuristics.
+ */
+class NodeCostModel {
+ public:
+  struct OpCost {
+    double cpu_us;
+    double device_us;
+  };
+
+  NodeCostModel() = default;
+
+  Status Load(const std::filesystem::path& path);
+
+  /** Measured costs for 'op_type', or nullptr if the op was not calibrated. */
+  const OpCost* LookUp(const std::string& op_type) const;
+
+  /** Estimated cost in microseconds of copying 'bytes' between host and device.
+      'bytes' may be 0 when the tensor size is not statically known; the fixed
+      per-copy latency still applies. */
+  double TransferCost(int64_t bytes) const {
+    return transfer_latency_us_ + static_cast<double>(bytes) / transfer_bandwidth_bytes_per_us_;
+  }
+
+  /**
+   * The process wide cost model loaded from the file named by the ORT_NODE_COST_MODEL_PATH
+   * environment variable, or nullptr if the variable is unset or loading failed.
+   * Loaded once on first use.
+   */
+  static const NodeCostModel* FromEnvironment();
+
+ private:
+  std::unordered_map<std::string, OpCost> op_costs_;
+  double transfer_latency_us_ = 10.0;
+  // default is in the ballpark of PCIe gen3 x16
+  double transfer_bandwidth_bytes_per_us_ = 10000.0;
+};
+
+}  // namespace onnxruntime
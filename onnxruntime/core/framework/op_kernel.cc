@@ -93,7 +93,13 @@ int OpKernelContext::NumVariadicInputs(size_t arg_num) const {
 }
 
 Status OpKernelContext::GetTempSpaceAllocator(AllocatorPtr* output) const {
-  *output = GetAllocator(kernel_->GetDevice(OrtMemTypeDefault));
+  const auto& device = kernel_->GetDevice(OrtMemTypeDefault);
+  // serve transient scratch from the run's bump allocator when one was built for this frame
+  // (see kOrtSessionOptionsEnableRunScratchArena)
+  *output = execution_frame_->GetRunScratchAllocator(device);
+  if (*output)
+    return Status::OK();
+  *output = GetAllocator(device);
   if (!*output)
     return Status(common::ONNXRUNTIME, common::FAIL, "TempSpace allocator not found");
   return Status::OK();
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <functional>
 #include "core/framework/op_kernel.h"
 #include "core/framework/session_state.h"
@@ -22,10 +23,13 @@ class OpKernelContextInternal : public OpKernelContext {
                                    const OpKernel& kernel,
                                    const logging::Logger& logger,
                                    const bool& terminate_flag,
-                                   Stream* stream)
+                                   Stream* stream,
+                                   std::chrono::steady_clock::time_point deadline =
+                                       std::chrono::steady_clock::time_point::max())
       : OpKernelContext(&frame, &kernel, stream, session_state.GetThreadPool(), logger),
         session_state_(session_state),
-        terminate_flag_(terminate_flag) {
+        terminate_flag_(terminate_flag),
+        deadline_(deadline) {
     const auto& implicit_inputs = kernel.Node().ImplicitInputDefs();
     int num_implicit_inputs = static_cast<int>(implicit_inputs.size());
     implicit_input_values_.reserve(num_implicit_inputs);
@@ -71,9 +75,21 @@ class OpKernelContextInternal : public OpKernelContext {
 
   const bool& GetTerminateFlag() const noexcept { return terminate_flag_; }
 
+  // Deadline for the Run() this kernel executes under (see kOrtRunOptionsConfigDeadlineMs).
+  // steady_clock::time_point::max() means no deadline. Control flow kernels propagate this
+  // into their subgraph executions so iteration loops stop cooperatively when time runs out.
+  std::chrono::steady_clock::time_point GetDeadline() const noexcept { return deadline_; }
+
+  // Returns true if a deadline is set and has passed. Does not read the clock when no deadline is set.
+  bool DeadlineExpired() const {
+    return deadline_ != std::chrono::steady_clock::time_point::max() &&
+           std::chrono::steady_clock::now() >= deadline_;
+  }
+
  private:
   const SessionState& session_state_;
   const bool& terminate_flag_;
+  std::chrono::steady_clock::time_point deadline_;
   std::vector<const OrtValue*> implicit_input_values_;
 };
 
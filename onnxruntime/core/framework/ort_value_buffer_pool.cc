@@ -0,0 +1,29 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/ort_value_buffer_pool.h"
+
+namespace onnxruntime {
+
+InlinedVector<OrtValue> OrtValueBufferPool::Acquire() {
+  std::lock_guard<OrtMutex> lock(mutex_);
+  if (buffers_.empty()) {
+    return {};
+  }
+
+  InlinedVector<OrtValue> buffer = std::move(buffers_.back());
+  buffers_.pop_back();
+  return buffer;
+}
+
+void OrtValueBufferPool::Release(InlinedVector<OrtValue>&& buffer) {
+  // Destroy the values outside of the lock; only the empty storage is pooled.
+  buffer.clear();
+
+  std::lock_guard<OrtMutex> lock(mutex_);
+  if (buffers_.size() < kMaxPooledBuffers) {
+    buffers_.push_back(std::move(buffer));
+  }
+}
+
+}  // namespace onnxruntime
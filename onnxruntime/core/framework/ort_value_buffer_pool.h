@@ -0,0 +1,43 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/common/common.h"
+#include "core/common/inlined_containers.h"
+#include "core/framework/ort_value.h"
+#include "core/platform/ort_mutex.h"
+
+namespace onnxruntime {
+
+/**
+ * Recycles the OrtValue storage that an execution frame uses for all the
+ * values in the graph, so that the steady-state Run path does not reallocate
+ * it on every call.  The pool keeps the capacity of released buffers; the
+ * OrtValues themselves are destroyed on release, exactly as they would be when
+ * the frame is destroyed.  Thread-safe; one instance is owned per SessionState.
+ */
+class OrtValueBufferPool {
+ public:
+  OrtValueBufferPool() = default;
+
+  /// Returns an empty buffer, reusing the capacity of a previously released
+  /// buffer when one is available.
+  InlinedVector<OrtValue> Acquire();
+
+  /// Destroys the values held by the buffer and retains its capacity for a
+  /// later Acquire. Buffers beyond a small bound are dropped.
+  void Release(InlinedVector<OrtValue>&& buffer);
+
+ private:
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(OrtValueBufferPool);
+
+  // Covers typical numbers of concurrent Run calls; buffers released while the
+  // pool is full are freed instead of retained.
+  static constexpr size_t kMaxPooledBuffers = 8;
+
+  OrtMutex mutex_;
+  InlinedVector<InlinedVector<OrtValue>, kMaxPooledBuffers> buffers_;
+};
+
+}  // namespace onnxruntime
@@ -30,14 +30,14 @@ common::Status OrtValuePatternPlanner::TraceAllocation(int ort_value_idx,
 }
 #endif
 
-common::Status OrtValuePatternPlanner::TraceAllocation(int ort_value_idx, size_t size) {
+common::Status OrtValuePatternPlanner::TraceAllocation(int ort_value_idx, size_t size, int contiguous_group) {
   const auto& location = execution_planner_.GetLocation(ort_value_idx);
   auto it = planner_map_.find(location);
   if (it == planner_map_.end()) {
     return common::Status(common::ONNXRUNTIME, common::INVALID_ARGUMENT);
   }
 
-  it->second.TraceAllocation(ort_value_idx, size);
+  it->second.TraceAllocation(ort_value_idx, size, contiguous_group);
   return common::Status::OK();
 }
 
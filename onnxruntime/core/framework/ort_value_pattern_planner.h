@@ -25,7 +25,8 @@ class OrtValuePatternPlanner {
 #ifdef ENABLE_TRAINING
   common::Status TraceAllocation(int ort_value_idx, const AllocPlanPerValue::ProgramCounter& counter, size_t size);
 #endif
-  common::Status TraceAllocation(int ort_value_idx, size_t size);
+  // contiguous_group: see MemPatternPlanner::TraceAllocation.
+  common::Status TraceAllocation(int ort_value_idx, size_t size, int contiguous_group = -1);
   common::Status TraceFree(int ort_value_index);
   common::Status GeneratePatterns(MemoryPatternGroup& out);
   ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(OrtValuePatternPlanner);
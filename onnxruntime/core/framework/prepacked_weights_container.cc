@@ -4,8 +4,206 @@
 #include "core/framework/prepacked_weights_container.h"
 #include "core/framework/allocator_utils.h"
 
+#if !defined(_WIN32) && !defined(__ANDROID__) && !defined(__EMSCRIPTEN__)
+#define ORT_PREPACKED_WEIGHTS_SHM_AVAILABLE
+#endif
+
+#if defined(ORT_PREPACKED_WEIGHTS_SHM_AVAILABLE)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#endif
+
 namespace onnxruntime {
 
+#if defined(ORT_PREPACKED_WEIGHTS_SHM_AVAILABLE)
+
+namespace {
+
+// Layout of a shared memory segment backing one PrePackedWeights instance:
+// a header followed by the raw buffer payloads, each aligned to 64 bytes.
+// The magic field is written last so that a reader racing with the writer
+// can detect an incomplete segment and fall back to a process local copy.
+constexpr uint32_t kSharedWeightsMagic = 0x54575053;  // 'SPWT'
+constexpr size_t kSharedWeightsAlignment = 64;
+
+// A null "place-holder" buffer (see PrePackedWeights::buffers_) is recorded
+// by setting the top bit of its size entry and storing no payload for it.
+constexpr uint64_t kNullBufferFlag = uint64_t(1) << 63;
+
+struct SharedWeightsHeader {
+  uint32_t magic;
+  uint32_t num_buffers;
+  // Followed by num_buffers uint64_t size entries and then the payloads.
+};
+
+size_t AlignUpToSharedWeightsAlignment(size_t size) {
+  return (size + kSharedWeightsAlignment - 1) & ~(kSharedWeightsAlignment - 1);
+}
+
+size_t ComputeHeaderSize(size_t num_buffers) {
+  return AlignUpToSharedWeightsAlignment(sizeof(SharedWeightsHeader) + num_buffers * sizeof(uint64_t));
+}
+
+size_t ComputeSegmentSize(const PrePackedWeights& packed_weight) {
+  size_t segment_size = ComputeHeaderSize(packed_weight.buffers_.size());
+  for (size_t iter = 0; iter < packed_weight.buffers_.size(); ++iter) {
+    if (packed_weight.buffers_[iter].get() != nullptr) {
+      segment_size += AlignUpToSharedWeightsAlignment(packed_weight.buffer_sizes_[iter]);
+    }
+  }
+  return segment_size;
+}
+
+// The shm name is limited to NAME_MAX, so the (unbounded) container key is
+// folded into a hash rather than embedded directly.
+std::string GenerateSharedSegmentName(const std::string& prefix, const std::string& key) {
+  std::ostringstream name;
+  name << "/" << prefix << "." << std::hex << std::hash<std::string>{}(key);
+  return name.str();
+}
+
+// Maps an existing, fully written segment read-only and wraps the payloads
+// in the provided PrePackedWeights instance. The mapping is shared between
+// the buffers and released when the last of them is destroyed.
+bool TryMapSharedWeight(const std::string& segment_name, PrePackedWeights& mapped_weight) {
+  int fd = shm_open(segment_name.c_str(), O_RDONLY, 0);
+  if (fd < 0) {
+    return false;
+  }
+
+  struct stat segment_stat;
+  if (fstat(fd, &segment_stat) != 0) {
+    close(fd);
+    return false;
+  }
+
+  const size_t segment_size = static_cast<size_t>(segment_stat.st_size);
+  if (segment_size < sizeof(SharedWeightsHeader)) {
+    close(fd);
+    return false;
+  }
+
+  void* base = mmap(nullptr, segment_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (base == MAP_FAILED) {
+    return false;
+  }
+
+  std::shared_ptr<void> mapping(base, [segment_size](void* p) { munmap(p, segment_size); });
+
+  std::atomic_thread_fence(std::memory_order_acquire);
+  const auto* header = static_cast<const SharedWeightsHeader*>(base);
+  if (header->magic != kSharedWeightsMagic) {
+    // The writing process has not finished publishing the segment yet.
+    return false;
+  }
+
+  const size_t num_buffers = header->num_buffers;
+  const size_t header_size = ComputeHeaderSize(num_buffers);
+  if (header_size > segment_size) {
+    return false;
+  }
+
+  const auto* size_entries = reinterpret_cast<const uint64_t*>(header + 1);
+  size_t offset = header_size;
+
+  for (size_t iter = 0; iter < num_buffers; ++iter) {
+    const uint64_t size_entry = size_entries[iter];
+    const size_t buffer_size = static_cast<size_t>(size_entry & ~kNullBufferFlag);
+
+    if ((size_entry & kNullBufferFlag) != 0) {
+      mapped_weight.buffers_.emplace_back(nullptr, [](void*) {});
+      mapped_weight.buffer_sizes_.push_back(buffer_size);
+      continue;
+    }
+
+    if (offset + buffer_size > segment_size) {
+      mapped_weight.buffers_.clear();
+      mapped_weight.buffer_sizes_.clear();
+      return false;
+    }
+
+    void* buffer = static_cast<uint8_t*>(base) + offset;
+    // The deleter keeps the mapping alive for as long as any buffer is in use.
+    mapped_weight.buffers_.emplace_back(buffer, [mapping](void*) {});
+    mapped_weight.buffer_sizes_.push_back(buffer_size);
+    offset += AlignUpToSharedWeightsAlignment(buffer_size);
+  }
+
+  return true;
+}
+
+// Creates the segment and copies the packed buffers into it. Fails if the
+// segment already exists (another process won the race to publish), in which
+// case the caller should map the existing segment instead.
+bool TryPublishSharedWeight(const std::string& segment_name, const PrePackedWeights& packed_weight) {
+  int fd = shm_open(segment_name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+  if (fd < 0) {
+    return false;
+  }
+
+  const size_t segment_size = ComputeSegmentSize(packed_weight);
+  if (ftruncate(fd, static_cast<off_t>(segment_size)) != 0) {
+    close(fd);
+    shm_unlink(segment_name.c_str());
+    return false;
+  }
+
+  void* base = mmap(nullptr, segment_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (base == MAP_FAILED) {
+    shm_unlink(segment_name.c_str());
+    return false;
+  }
+
+  auto* header = static_cast<SharedWeightsHeader*>(base);
+  header->num_buffers = static_cast<uint32_t>(packed_weight.buffers_.size());
+
+  auto* size_entries = reinterpret_cast<uint64_t*>(header + 1);
+  size_t offset = ComputeHeaderSize(packed_weight.buffers_.size());
+
+  for (size_t iter = 0; iter < packed_weight.buffers_.size(); ++iter) {
+    const size_t buffer_size = packed_weight.buffer_sizes_[iter];
+    if (packed_weight.buffers_[iter].get() == nullptr) {
+      size_entries[iter] = static_cast<uint64_t>(buffer_size) | kNullBufferFlag;
+      continue;
+    }
+
+    size_entries[iter] = static_cast<uint64_t>(buffer_size);
+    std::memcpy(static_cast<uint8_t*>(base) + offset, packed_weight.buffers_[iter].get(), buffer_size);
+    offset += AlignUpToSharedWeightsAlignment(buffer_size);
+  }
+
+  // Publish the magic last so readers never observe a partially written segment.
+  std::atomic_thread_fence(std::memory_order_release);
+  header->magic = kSharedWeightsMagic;
+
+  munmap(base, segment_size);
+  return true;
+}
+
+}  // namespace
+
+#endif  // defined(ORT_PREPACKED_WEIGHTS_SHM_AVAILABLE)
+
+PrepackedWeightsContainer::PrepackedWeightsContainer(const std::string& shared_memory_prefix)
+    : shared_memory_prefix_(shared_memory_prefix) {
+#if defined(ORT_PREPACKED_WEIGHTS_SHM_AVAILABLE)
+  ORT_ENFORCE(!shared_memory_prefix_.empty(),
+              "The shared memory prefix for the pre-packed weights container cannot be empty");
+#else
+  ORT_THROW("Cross-process sharing of pre-packed weights requires POSIX shared memory, ",
+            "which is not available on this platform");
+#endif
+}
+
 AllocatorPtr PrepackedWeightsContainer::GetOrCreateAllocator(const std::string& device_name) {
   auto iter = allocators_.find(device_name);
 
@@ -36,17 +234,64 @@ const PrePackedWeights& PrepackedWeightsContainer::GetWeight(const std::string&
 }
 
 bool PrepackedWeightsContainer::WriteWeight(const std::string& key, PrePackedWeights&& packed_weight) {
+#if defined(ORT_PREPACKED_WEIGHTS_SHM_AVAILABLE)
+  if (!shared_memory_prefix_.empty()) {
+    const std::string segment_name = GenerateSharedSegmentName(shared_memory_prefix_, key);
+
+    // Publish the weight (or discover that another process already has) and
+    // use the segment backed copy so that identical weights share physical
+    // memory across processes.
+    TryPublishSharedWeight(segment_name, packed_weight);
+
+    PrePackedWeights mapped_weight;
+    if (TryMapSharedWeight(segment_name, mapped_weight) &&
+        mapped_weight.buffer_sizes_ == packed_weight.buffer_sizes_) {
+      shared_segment_names_.push_back(segment_name);
+      auto ret = prepacked_weights_map_.insert(std::make_pair(key, std::move(mapped_weight)));
+      return ret.second;
+    }
+    // Fall through to a process local copy if the segment could not be
+    // published or mapped (e.g. a racing writer has not finished yet).
+  }
+#endif
+
   auto ret = prepacked_weights_map_.insert(std::make_pair(key, std::move(packed_weight)));
   return ret.second;
 }
 
-bool PrepackedWeightsContainer::HasWeight(const std::string& key) const {
-  return prepacked_weights_map_.find(key) !=
-         prepacked_weights_map_.end();
+bool PrepackedWeightsContainer::HasWeight(const std::string& key) {
+  if (prepacked_weights_map_.find(key) !=
+      prepacked_weights_map_.end()) {
+    return true;
+  }
+
+#if defined(ORT_PREPACKED_WEIGHTS_SHM_AVAILABLE)
+  if (!shared_memory_prefix_.empty()) {
+    const std::string segment_name = GenerateSharedSegmentName(shared_memory_prefix_, key);
+
+    PrePackedWeights mapped_weight;
+    if (TryMapSharedWeight(segment_name, mapped_weight)) {
+      shared_segment_names_.push_back(segment_name);
+      prepacked_weights_map_.insert(std::make_pair(key, std::move(mapped_weight)));
+      return true;
+    }
+  }
+#endif
+
+  return false;
 }
 
 size_t PrepackedWeightsContainer::GetNumberOfElements() const {
   return prepacked_weights_map_.size();
 }
 
+void PrepackedWeightsContainer::UnlinkSharedSegments() {
+#if defined(ORT_PREPACKED_WEIGHTS_SHM_AVAILABLE)
+  for (const auto& segment_name : shared_segment_names_) {
+    shm_unlink(segment_name.c_str());
+  }
+#endif
+  shared_segment_names_.clear();
+}
+
 }  // namespace onnxruntime
@@ -6,6 +6,7 @@
 #include <unordered_map>
 #include <unordered_set>
 #include <string>
+#include <vector>
 #include <cstdint>
 
 #include "core/framework/buffer_deleter.h"
@@ -21,6 +22,16 @@ class PrepackedWeightsContainer final {
   PrepackedWeightsContainer() {
   }
 
+  // Creates a container whose cached weights are backed by named shared memory
+  // segments so that they can be shared across processes. The first process to
+  // write a given weight publishes it into a segment named after the provided
+  // prefix and the container key, and subsequent processes (using a container
+  // created with the same prefix) map the segment read-only instead of keeping
+  // their own copy.
+  // Only supported on platforms providing POSIX shared memory (shm_open) -
+  // throws on other platforms.
+  explicit PrepackedWeightsContainer(const std::string& shared_memory_prefix);
+
   ~PrepackedWeightsContainer() = default;
 
   // Returns an allocator keyed by device name.
@@ -40,13 +51,20 @@ class PrepackedWeightsContainer final {
   bool WriteWeight(const std::string& key, PrePackedWeights&& packed_weight);
 
   // Returns a boolean indicating if there is a PrePackedWeights instance
-  // pertaining to the provided key.
+  // pertaining to the provided key, looking in the shared memory backing
+  // store (if one was configured) for weights published by other processes.
   // The key is : op_type + "+" + hash_of_prepacked_buffers_in_the_PrepackedWeights_instance.
-  bool HasWeight(const std::string& key) const;
+  bool HasWeight(const std::string& key);
 
   // Returns the number of elements in the container
   size_t GetNumberOfElements() const;
 
+  // Removes the shared memory segments this container has created or mapped.
+  // The segments otherwise persist beyond the lifetime of all the processes
+  // sharing them. To be called by the process that owns the lifetime of the
+  // shared cache once the weights are no longer needed by any process.
+  void UnlinkSharedSegments();
+
   ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(PrepackedWeightsContainer);
 
   // Resource to be acquired by the method that is going to invoke calls to the kernels'
@@ -64,6 +82,14 @@ class PrepackedWeightsContainer final {
   // to PrePackedWeights instances.
   // The key is : op_type + "+" + hash_of_prepacked_buffers_in_the_PrepackedWeights_instance.
   std::unordered_map<std::string, PrePackedWeights> prepacked_weights_map_;
+
+  // Name prefix for the shared memory segments backing this container.
+  // Empty when cross-process sharing is not enabled.
+  std::string shared_memory_prefix_;
+
+  // Names of the shared memory segments this container has created or mapped,
+  // kept so that UnlinkSharedSegments() can remove them.
+  std::vector<std::string> shared_segment_names_;
 };
 
 }  // namespace onnxruntime
@@ -0,0 +1,76 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+
+#include "core/common/common.h"
+
+namespace onnxruntime {
+
+/**
+ * Per-run memory high-water marks keyed by the input-shape signature of the run's feeds.
+ *
+ * ExecutionFrame tracks the bytes of live frame-owned allocations per device with a couple of
+ * relaxed atomic updates per allocation, and publishes the observed peak here when the frame is
+ * torn down at the end of a run. The collector's lock is therefore taken once per run, not per
+ * allocation, so tracking is cheap enough to stay always on and be polled from a monitoring
+ * thread while inference is running.
+ *
+ * Keying by shape signature shows which request shapes drive memory. AllocatorStats only exposes
+ * a lifetime max_bytes_in_use, which never comes back down and says nothing about the traffic
+ * that caused it.
+ */
+class RunMemoryWatermarks {
+ public:
+  struct Watermark {
+    // Highest per-run peak observed for this signature and location.
+    size_t peak_bytes{0};
+    // Peak of the most recent run, to spot drift against peak_bytes.
+    size_t last_peak_bytes{0};
+    uint64_t runs{0};
+  };
+
+  // signature -> location -> watermark. std::map keeps snapshots deterministically ordered.
+  using Snapshot = std::map<std::string, std::map<std::string, Watermark>>;
+
+  RunMemoryWatermarks() = default;
+
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(RunMemoryWatermarks);
+
+  void Record(const std::string& shape_signature, const std::string& location, size_t peak_bytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Watermark& watermark = watermarks_[shape_signature][location];
+    watermark.peak_bytes = std::max(watermark.peak_bytes, peak_bytes);
+    watermark.last_peak_bytes = peak_bytes;
+    ++watermark.runs;
+  }
+
+  Snapshot GetSnapshot() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return watermarks_;
+  }
+
+  // Highest peak recorded so far for the given signature and location, or 0 when no run with that
+  // signature has published one yet. Used to pre-size per-run buffers (see RunScratchArena).
+  size_t GetPeak(const std::string& shape_signature, const std::string& location) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto signature_it = watermarks_.find(shape_signature);
+    if (signature_it == watermarks_.end()) {
+      return 0;
+    }
+    auto location_it = signature_it->second.find(location);
+    return location_it == signature_it->second.end() ? 0 : location_it->second.peak_bytes;
+  }
+
+ private:
+  mutable std::mutex mutex_;
+  Snapshot watermarks_;
+};
+
+}  // namespace onnxruntime
@@ -0,0 +1,98 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+#include "core/common/common.h"
+#include "core/framework/allocator.h"
+
+namespace onnxruntime {
+
+/**
+ * Per-run bump allocator for transient kernel scratch (see kOrtSessionOptionsEnableRunScratchArena).
+ *
+ * One slab is carved from the upstream allocator when the run's ExecutionFrame is built, sized from
+ * the scratch peak recorded for the run's input-shape signature in RunMemoryWatermarks. Allocations
+ * are served by bumping an atomic offset into the slab, so kernel scratch never contends on the
+ * shared arena's lock, and Free on slab memory is a no-op — everything is released in one shot when
+ * the frame is torn down. Requests that do not fit the slab (including every request of a
+ * signature's first run, which has no recorded peak yet) fall through to the upstream allocator, so
+ * behavior degrades to today's path rather than failing.
+ *
+ * Because frees do not reclaim space, the recorded peak is the sum of the run's scratch requests
+ * rather than the maximum live at any instant. That is the size the bump scheme itself needs, so
+ * sizing the next run's slab from it is exact, not an over-estimate.
+ */
+class RunScratchArena final : public IAllocator {
+ public:
+  // Location label under which the per-run scratch peak is recorded in RunMemoryWatermarks.
+  static constexpr const char* kWatermarkLocation = "CPU scratch";
+
+  RunScratchArena(AllocatorPtr upstream, size_t slab_bytes)
+      : IAllocator(upstream->Info()), upstream_(std::move(upstream)) {
+    if (slab_bytes > 0) {
+      slab_ = static_cast<char*>(upstream_->Alloc(slab_bytes));
+      if (slab_ != nullptr) {
+        slab_bytes_ = slab_bytes;
+      }
+    }
+  }
+
+  ~RunScratchArena() override {
+    if (slab_ != nullptr) {
+      upstream_->Free(slab_);
+    }
+  }
+
+  void* Alloc(size_t size) override {
+    if (size == 0) {
+      return nullptr;
+    }
+
+    // keep every bump-allocated block aligned the same way the arena allocators align
+    const size_t aligned_size = (size + kAllocAlignment - 1) & ~(kAllocAlignment - 1);
+    total_bytes_.fetch_add(aligned_size, std::memory_order_relaxed);
+
+    if (slab_ != nullptr) {
+      const size_t offset = offset_.fetch_add(aligned_size, std::memory_order_relaxed);
+      if (offset + aligned_size <= slab_bytes_) {
+        return slab_ + offset;
+      }
+      // leave offset_ past the end; later smaller requests would not fit contiguously anyway
+      // and the total is tracked separately for sizing the next run's slab.
+    }
+
+    return upstream_->Alloc(size);
+  }
+
+  void Free(void* p) override {
+    // slab memory is reclaimed wholesale when the frame is torn down
+    if (p == nullptr || (p >= slab_ && p < slab_ + slab_bytes_)) {
+      return;
+    }
+    upstream_->Free(p);
+  }
+
+  void* Reserve(size_t size) override {
+    // Reserve requests deliberately bypass arenas; keep them out of the slab too.
+    return upstream_->Reserve(size);
+  }
+
+  // Total scratch bytes requested during the run (slab hits and overflow), i.e. the slab size
+  // that would have served every request. Published to RunMemoryWatermarks on frame teardown.
+  size_t TotalBytes() const {
+    return total_bytes_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  AllocatorPtr upstream_;
+  char* slab_{nullptr};
+  size_t slab_bytes_{0};
+  std::atomic<size_t> offset_{0};
+  std::atomic<size_t> total_bytes_{0};
+};
+
+}  // namespace onnxruntime
@@ -35,6 +35,11 @@ struct AllocPlanPerValue {
   // reused_buffer is valid only if alloc_kind == kReuse. It indicates
   // which OrtValue's buffer must be reused for this OrtValue.
   OrtValueIndex reused_buffer{0};
+  // kAllocate tensor outputs of the same node share a group id (-1 means ungrouped) so the memory
+  // pattern planner can lay them out back-to-back; consumers that walk several sibling outputs
+  // (re-concatenation after Split, attention over Q/K/V projections) then read one coherent
+  // buffer. See PlannerImpl::ComputeContiguousSiblingGroups.
+  int contiguous_sibling_group{-1};
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
   IntervalT life_interval{0, 0};
   IntervalT allocate_interval{0, 0};
@@ -165,6 +170,11 @@ struct SequentialExecutionPlan : public ExecutionPlanBase {
 
   size_t num_barriers{0};
 
+  // Number of host staging slots used by OffloadToHostStep/PrefetchFromHostStep pairs.
+  // Each value the planner decided to offload owns one slot in the per-run staging vector
+  // (see StreamExecutionContext::GetOffloadStagingValue).
+  size_t num_offload_slots{0};
+
 #ifdef ENABLE_TRAINING
   InlinedVector<NodeIndex> node_execution_order_in_training;
   InlinedHashMap<NodeIndex, size_t> node_index_2_toposort_index;
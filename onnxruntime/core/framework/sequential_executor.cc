@@ -15,6 +15,11 @@
 #include "core/framework/session_state.h"
 #include "core/framework/op_kernel_context_internal.h"
 #include "core/framework/utils.h"
+#include "core/common/parse_string.h"
+#include "core/framework/ep_boundary_stats.h"
+#include "core/platform/hardware_perf_counters.h"
+#include "core/platform/threadpool.h"
+#include "core/session/onnxruntime_session_options_config_keys.h"
 
 #if defined DEBUG_NODE_INPUTS_OUTPUTS
 #include "core/framework/debug_node_inputs_outputs_utils.h"
@@ -178,6 +183,25 @@ class SessionScope {
   {
     if (session_state_.Profiler().IsEnabled()) {
       session_start_ = session_state.Profiler().Start();
+
+      // Optionally capture hardware perf counters around each kernel on every Nth profiled Run.
+      // The counter group is opened once per thread and runs continuously; kernels take Read()
+      // deltas, so nested scopes (control flow subgraphs) stay consistent and unsampled runs
+      // pay nothing.
+      int64_t hw_counter_interval = 0;
+      if (TryParseStringWithClassicLocale(
+              session_state_.GetSessionOptions().config_options.GetConfigOrDefault(
+                  kOrtSessionOptionsProfileHwPerfCountersRunInterval, "0"),
+              hw_counter_interval) &&
+          hw_counter_interval > 0) {
+        static std::atomic<uint64_t> hw_counter_run_index{0};
+        if (hw_counter_run_index++ % static_cast<uint64_t>(hw_counter_interval) == 0) {
+          static thread_local profiling::HardwarePerfCounters hw_counters;
+          if (hw_counters.IsSupported()) {
+            hw_counters_ = &hw_counters;
+          }
+        }
+      }
     }
 
     auto& logger = session_state_.Logger();
@@ -250,6 +274,8 @@ class SessionScope {
  private:
   const SessionState& session_state_;
   TimePoint session_start_;
+  // Non-null when this run samples hardware perf counters; points at a thread local counter group.
+  const profiling::HardwarePerfCounters* hw_counters_{nullptr};
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
   const ExecutionFrame& frame_;
   // Whether memory profiler need create events and flush to file.
@@ -332,6 +358,11 @@ class KernelScope {
     utils::DumpNodeInputs(dump_context_, kernel_context_, kernel_.Node(), session_state_);
 #endif
 
+    if (WeightResidencyManager* weight_residency = session_state_.GetWeightResidencyManager();
+        weight_residency != nullptr) {
+      weight_residency->OnNodeExecute(kernel_.Node().Index());
+    }
+
 #ifdef ENABLE_NVTX_PROFILE
     node_compute_range_.Begin();
 #endif
@@ -351,36 +382,108 @@ class KernelScope {
       CalculateTotalInputSizes(&kernel_context, &kernel_,
                                input_activation_sizes_, input_parameter_sizes_,
                                node_name_, input_type_shape_);
+      if (session_scope_.hw_counters_ != nullptr) {
+        hw_counters_start_ = session_scope_.hw_counters_->Read();
+      }
+    }
+
+    if (auto* histograms = session_state_.GetKernelTimeHistograms(); histograms != nullptr) {
+      sample_kernel_time_ = histograms->ShouldSample(kernel_.Node().Index());
+      if (sample_kernel_time_) {
+        kernel_time_sample_start_ = std::chrono::high_resolution_clock::now();
+      }
+    }
+
+    if (auto* boundary_stats = session_state_.GetEpBoundaryStats(); boundary_stats != nullptr) {
+      boundary_ = boundary_stats->GetNodeBoundary(kernel_.Node().Index());
+      if (boundary_ != nullptr && boundary_->is_memcpy) {
+        boundary_time_start_ = std::chrono::high_resolution_clock::now();
+      }
     }
   }
 
   ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(KernelScope);
 
   ~KernelScope() {
+    // Take the latency sample before any profiler bookkeeping below so it reflects the kernel only.
+    if (sample_kernel_time_) {
+      const auto elapsed_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                  std::chrono::high_resolution_clock::now() - kernel_time_sample_start_)
+                                  .count();
+      session_state_.GetKernelTimeHistograms()->Record(kernel_.Node().Index(), static_cast<uint64_t>(elapsed_ns));
+    }
+
+    // Fold this node's EP boundary crossings into the per-transition totals. The wall time is
+    // taken before the profiler bookkeeping below so Memcpy nodes account only the copy itself.
+    std::string boundary_transitions;
+    uint64_t boundary_bytes = 0;
+    if (boundary_ != nullptr) {
+      uint64_t memcpy_time_ns = 0;
+      if (boundary_->is_memcpy) {
+        memcpy_time_ns = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                   std::chrono::high_resolution_clock::now() - boundary_time_start_)
+                                                   .count());
+      }
+      auto* boundary_stats = session_state_.GetEpBoundaryStats();
+      for (const auto& [input_index, transition] : boundary_->crossing_inputs) {
+        uint64_t bytes = 0;
+        const OrtValue* value = kernel_context_.GetInputMLValue(input_index);
+        if (value != nullptr && value->IsAllocated() && value->IsTensor()) {
+          bytes = value->Get<Tensor>().SizeInBytes();
+        }
+        boundary_stats->Record(transition, bytes, boundary_->is_memcpy, memcpy_time_ns);
+        memcpy_time_ns = 0;  // only attribute the node's wall time once
+        boundary_bytes += bytes;
+        if (!boundary_transitions.empty()) {
+          boundary_transitions += ';';
+        }
+        boundary_transitions += transition;
+      }
+    }
+
 #ifdef ENABLE_NVTX_PROFILE
     node_compute_range_.End();
 #endif
 
     if (session_state_.Profiler().IsEnabled()) {
       auto& profiler = session_state_.Profiler();
+      // Sample the counters before the output size bookkeeping below so the delta covers the
+      // kernel only.
+      profiling::HardwarePerfCounters::Values hw_delta;
+      if (session_scope_.hw_counters_ != nullptr) {
+        hw_delta = session_scope_.hw_counters_->Read() - hw_counters_start_;
+      }
       std::string output_type_shape_;
       CalculateTotalOutputSizes(&kernel_context_, total_output_sizes_, node_name_, output_type_shape_);
+      // Log additional operation args / info.
+      std::unordered_map<std::string, std::string> event_args = {
+          {"op_name", kernel_.KernelDef().OpName()},
+          {"provider", kernel_.KernelDef().Provider()},
+          {"node_index", std::to_string(kernel_.Node().Index())},
+          {"activation_size", std::to_string(input_activation_sizes_)},
+          {"parameter_size", std::to_string(input_parameter_sizes_)},
+          {"output_size", std::to_string(total_output_sizes_)},
+          {"input_type_shape", input_type_shape_},
+          {"output_type_shape", output_type_shape_},
+          {"thread_scheduling_stats",
+           concurrency::ThreadPool::StopProfiling(session_state_.GetThreadPool())},
+          // chain of control flow parents ("my_loop#3"), empty for
+          // top level nodes. also drives the .folded aggregation.
+          {"stack", profiling::ScopedProfileFrame::CurrentStack()},
+      };
+      if (session_scope_.hw_counters_ != nullptr) {
+        event_args.emplace("hw_instructions", std::to_string(hw_delta.instructions));
+        event_args.emplace("hw_llc_misses", std::to_string(hw_delta.llc_misses));
+        event_args.emplace("hw_stalled_cycles", std::to_string(hw_delta.stalled_cycles));
+      }
+      if (boundary_ != nullptr) {
+        event_args.emplace("ep_boundary", boundary_transitions);
+        event_args.emplace("ep_boundary_bytes", std::to_string(boundary_bytes));
+      }
       profiler.EndTimeAndRecordEvent(profiling::NODE_EVENT,
                                      node_name_ + "_kernel_time",
                                      kernel_begin_time_,
-                                     // Log additional operation args / info.
-                                     {
-                                         {"op_name", kernel_.KernelDef().OpName()},
-                                         {"provider", kernel_.KernelDef().Provider()},
-                                         {"node_index", std::to_string(kernel_.Node().Index())},
-                                         {"activation_size", std::to_string(input_activation_sizes_)},
-                                         {"parameter_size", std::to_string(input_parameter_sizes_)},
-                                         {"output_size", std::to_string(total_output_sizes_)},
-                                         {"input_type_shape", input_type_shape_},
-                                         {"output_type_shape", output_type_shape_},
-                                         {"thread_scheduling_stats",
-                                          concurrency::ThreadPool::StopProfiling(session_state_.GetThreadPool())},
-                                     });
+                                     std::move(event_args));
       auto sync_time_begin = profiler.Start();
       profiler.EndTimeAndRecordEvent(profiling::NODE_EVENT,
                                      node_name_ + "_fence_after",
@@ -402,6 +505,33 @@ class KernelScope {
                       TraceLoggingValue(elapsed.QuadPart, "time"));
 #endif
 
+    if (auto* collector = session_state_.GetCalibrationCollector(); collector != nullptr) {
+      const auto& output_defs = kernel_.Node().OutputDefs();
+      for (int i = 0, end = kernel_context_.OutputCount(); i < end; ++i) {
+        if (static_cast<size_t>(i) >= output_defs.size() || !output_defs[i]->Exists()) {
+          continue;
+        }
+        const std::string& output_name = output_defs[i]->Name();
+        if (!collector->ShouldCollect(output_name)) {
+          continue;
+        }
+        const OrtValue* p_output = kernel_context_.GetOutputMLValue(i);
+        if (p_output != nullptr && p_output->IsAllocated() && p_output->IsTensor()) {
+          collector->Collect(output_name, p_output->Get<Tensor>());
+        }
+      }
+    }
+
+    if (auto* delta = session_state_.GetDeltaExecutionManager(); delta != nullptr) {
+      InlinedVector<const OrtValue*> outputs;
+      const int output_count = kernel_context_.OutputCount();
+      outputs.reserve(static_cast<size_t>(output_count));
+      for (int i = 0; i < output_count; ++i) {
+        outputs.push_back(kernel_context_.GetOutputMLValue(i));
+      }
+      delta->OnNodeExecuted(kernel_.Node().Index(), outputs);
+    }
+
 #ifdef DEBUG_NODE_INPUTS_OUTPUTS
     utils::DumpNodeOutputs(dump_context_, kernel_context_, kernel_.Node(), session_state_);
 #endif
@@ -420,6 +550,14 @@ class KernelScope {
   size_t total_output_sizes_{};
   std::string input_type_shape_;
 
+  bool sample_kernel_time_ = false;
+  TimePoint kernel_time_sample_start_;
+  profiling::HardwarePerfCounters::Values hw_counters_start_;
+
+  // Non-null when boundary stats collection is enabled and this node sits on an EP boundary.
+  const EpBoundaryStats::NodeBoundary* boundary_{nullptr};
+  TimePoint boundary_time_start_;
+
 #ifdef CONCURRENCY_VISUALIZER
   diagnostic::span span_;
 #endif
@@ -437,7 +575,8 @@ onnxruntime::Status ExecuteKernel(StreamExecutionContext& ctx,
                                   NodeIndex idx,
                                   size_t stream_idx,
                                   const bool& terminate_flag,
-                                  SessionScope& session_scope) {
+                                  SessionScope& session_scope,
+                                  bool is_recompute) {
   auto* p_kernel = ctx.GetSessionState().GetKernel(idx);
   if (p_kernel->KernelDef().OpName() == "YieldOp") {
     // Do not execute YieldOp (it is an no-op anyways).
@@ -448,18 +587,35 @@ onnxruntime::Status ExecuteKernel(StreamExecutionContext& ctx,
     ctx.RecycleNodeInputs(idx);
     return Status::OK();
   }
+
+  if (auto* delta = ctx.GetSessionState().GetDeltaExecutionManager(); delta != nullptr) {
+    bool skipped = false;
+    ORT_RETURN_IF_ERROR(delta->TrySkipNode(idx, ctx.GetExecutionFrame(), skipped));
+    if (skipped) {
+      // cached outputs were written into the frame; release inputs as a normal execution would
+      ctx.RecycleNodeInputs(idx);
+      return Status::OK();
+    }
+  }
+
   // TODO: set terminate flag from run_option
   OpKernelContextInternal kernel_ctx(ctx.GetSessionState(),
                                      ctx.GetExecutionFrame(),
                                      *p_kernel,
                                      ctx.GetLogger(),
                                      terminate_flag,
-                                     ctx.GetDeviceStream(stream_idx));
+                                     ctx.GetDeviceStream(stream_idx),
+                                     ctx.GetDeadline());
   onnxruntime::Status status;
   auto& logger = ctx.GetLogger();
   if (p_kernel->IsAsync()) {
     ORT_THROW("Async Kernel Support is not implemented yet.");
   } else {
+    // Apply this run's intra-op degree-of-parallelism cap for the duration of the kernel
+    // (see kOrtRunOptionsConfigIntraOpMaxDegreeOfParallelism). Caps only tighten, so a
+    // subgraph execution launched by a control flow kernel on this thread (whose own
+    // context carries cap 0) keeps the enclosing run's cap.
+    concurrency::ThreadPool::DegreeOfParallelismCap dop_cap(ctx.GetIntraOpDegreeOfParallelismCap());
     KernelScope kernel_scope(session_scope, kernel_ctx, *p_kernel);
     ORT_TRY {
 #ifdef ENABLE_TRAINING
@@ -516,7 +672,10 @@ onnxruntime::Status ExecuteKernel(StreamExecutionContext& ctx,
     LOGS(logger, ERROR) << msg_string;
     return Status(status.Category(), status.Code(), msg_string);
   }
-  ctx.RecycleNodeInputs(idx);
+  if (!is_recompute) {
+    ctx.RecycleNodeInputs(idx);
+    ctx.NotifyOutputsReady(idx);
+  }
   VLOGS(logger, 0) << "stream " << stream_idx << " launch kernel with idx " << idx;
   return Status::OK();
 }
@@ -531,7 +690,10 @@ onnxruntime::Status ExecuteThePlan(const SessionState& session_state, gsl::span<
 #endif
                                    const bool& terminate_flag,
                                    const bool only_execute_path_to_fetches,
-                                   bool single_thread_mode) {
+                                   bool single_thread_mode,
+                                   const RunOptions::OutputReadyCallback& output_ready_callback,
+                                   std::chrono::steady_clock::time_point deadline,
+                                   int intra_op_dop_cap) {
   auto* execution_plan = session_state.GetExecutionPlan();
   VLOGS(logger, 0) << "Number of streams: " << execution_plan->execution_plan.size();
   int32_t valid_streams = 0;
@@ -574,20 +736,52 @@ onnxruntime::Status ExecuteThePlan(const SessionState& session_state, gsl::span<
   ORT_UNUSED_PARAMETER(only_execute_path_to_fetches);
 #endif
 
+  ctx.SetOutputReadyCallback(output_ready_callback, fetch_mlvalue_idxs);
+  ctx.SetDeadline(deadline);
+  ctx.SetIntraOpDegreeOfParallelismCap(intra_op_dop_cap);
+
   SessionScope session_scope(session_state, ctx.GetExecutionFrame());
 
   auto* tp = single_thread_mode ? nullptr : session_state.GetInterOpThreadPool();
 
-  for (size_t i = 0; i < execution_plan->execution_plan.size(); ++i) {
-    if (execution_plan->execution_plan[i]->steps_.empty()) {
-      // execution context is initialized with number of valid streams
-      // for invalid stream (0 steps), it doesn't count in number of tasks
-      // so don't need to invoke CompleteTask here
-      // ctx.CompleteTask();
-    } else {
-      concurrency::ThreadPool::Schedule(tp, [i, &ctx, &terminate_flag, &session_scope]() {
+  if (valid_streams == 1) {
+    // Single logic stream fast path (e.g. a pure CPU model with no control flow): run the flattened
+    // step list inline on the calling thread. This avoids the inter-op thread pool handoff and the
+    // std::function allocation per Run, and WaitAll() below returns without spinning because the
+    // task count has already dropped to zero.
+    for (size_t i = 0; i < execution_plan->execution_plan.size(); ++i) {
+      if (!execution_plan->execution_plan[i]->steps_.empty()) {
         RunSince(i, ctx, session_scope, terminate_flag, 0);
-      });
+        break;
+      }
+    }
+  } else {
+    // Multiple logic streams: keep one stream for the calling thread and hand the rest to the
+    // inter-op pool, so the caller participates in execution instead of parking in WaitAll() below
+    // for the whole run. This matters most for RunAsync, where the caller is itself a pool thread:
+    // an in-flight request then holds a thread only while it has runnable work. A stream that hits
+    // a not-ready barrier returns from RunSince and is resumed via ScheduleDownstream, so running
+    // one of them inline cannot deadlock.
+    size_t inline_stream_idx = execution_plan->execution_plan.size();
+    for (size_t i = 0; i < execution_plan->execution_plan.size(); ++i) {
+      if (execution_plan->execution_plan[i]->steps_.empty()) {
+        // execution context is initialized with number of valid streams
+        // for invalid stream (0 steps), it doesn't count in number of tasks
+        // so don't need to invoke CompleteTask here
+        // ctx.CompleteTask();
+      } else if (inline_stream_idx == execution_plan->execution_plan.size()) {
+        inline_stream_idx = i;
+      } else {
+        concurrency::ThreadPool::Schedule(tp, [i, &ctx, &terminate_flag, &session_scope]() {
+          RunSince(i, ctx, session_scope, terminate_flag, 0);
+        });
+      }
+    }
+    // Graphs with no runnable steps (e.g. an If subgraph that forwards an input or an
+    // initializer) plan only empty streams; there is nothing to run inline and WaitAll()
+    // below returns immediately.
+    if (inline_stream_idx != execution_plan->execution_plan.size()) {
+      RunSince(inline_stream_idx, ctx, session_scope, terminate_flag, 0);
     }
   }
 
@@ -606,7 +800,8 @@ onnxruntime::Status ExecuteThePlan(const SessionState& session_state, gsl::span<
     if (all_tensors) {
       MemoryPatternGroup mem_patterns;
       ORT_RETURN_IF_ERROR(ctx.GetExecutionFrame().GeneratePatterns(mem_patterns));
-      ORT_RETURN_IF_ERROR(session_state.UpdateMemoryPatternGroupCache(feeds, std::move(mem_patterns)));
+      ORT_RETURN_IF_ERROR(session_state.UpdateMemoryPatternGroupCache(feeds, std::move(mem_patterns),
+                                                                     ctx.GetExecutionFrame().TakeObservedShapes()));
     }
   }
 
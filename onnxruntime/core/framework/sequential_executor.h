@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <vector>
 #include "core/common/common.h"
 #include "core/common/status.h"
@@ -10,6 +11,7 @@
 #include "core/framework/iexecutor.h"
 #include "core/framework/framework_common.h"
 #include "core/framework/ort_value.h"
+#include "core/framework/run_options.h"
 #include "core/framework/session_state.h"
 #include "core/graph/graph_viewer.h"
 #include "core/framework/op_kernel_context_internal.h"
@@ -30,11 +32,16 @@ using OrtValueCache = InlinedHashMap<std::string, OrtValue>;
 using OrtValueCachePtr = std::shared_ptr<OrtValueCache>;
 #endif
 
+// Execute the kernel of node 'idx' on logic stream 'stream_idx'. When 'is_recompute' is set the
+// node is re-executed by a RecomputeKernelStep to re-create an activation the plan released
+// early; input recycling and output notifications already happened at the first execution and
+// must not run again.
 onnxruntime::Status ExecuteKernel(StreamExecutionContext& ctx,
                                   NodeIndex idx,
                                   size_t stream_idx,
                                   const bool& terminate_flag,
-                                  SessionScope& session_scope);
+                                  SessionScope& session_scope,
+                                  bool is_recompute = false);
 
 onnxruntime::Status ExecuteThePlan(const SessionState& session_state, gsl::span<const int> feed_mlvalue_idxs,
                                    gsl::span<const OrtValue> feeds, gsl::span<const int> fetch_mlvalue_idxs,
@@ -46,7 +53,13 @@ onnxruntime::Status ExecuteThePlan(const SessionState& session_state, gsl::span<
 #endif
                                    const bool& terminate_flag,
                                    const bool only_execute_path_to_fetches,
-                                   bool single_thread_mode);
+                                   bool single_thread_mode,
+                                   const RunOptions::OutputReadyCallback& output_ready_callback = {},
+                                   std::chrono::steady_clock::time_point deadline =
+                                       std::chrono::steady_clock::time_point::max(),
+                                   /*per-run cap on the intra-op degree of parallelism
+                                   (see kOrtRunOptionsConfigIntraOpMaxDegreeOfParallelism); 0 means no cap*/
+                                   int intra_op_dop_cap = 0);
 
 #ifdef ENABLE_TRAINING
 onnxruntime::Status PartialExecuteThePlan(const SessionState& session_state, gsl::span<const int> feed_mlvalue_idxs,
@@ -3,11 +3,14 @@
 
 #include "core/framework/session_state.h"
 
+#include <array>
 #include <sstream>
 
 #include "core/platform/ort_mutex.h"
 #include "core/common/logging/logging.h"
+#include "core/common/parse_string.h"
 #include "core/common/safeint.h"
+#include "core/common/string_utils.h"
 #include "core/flatbuffers/schema/ort.fbs.h"
 #include "core/framework/allocator.h"
 #include "core/framework/node_index_info.h"
@@ -235,6 +238,68 @@ Status SessionState::CreateKernels(const KernelRegistryManager& kernel_registry_
       // assumes vector is already resize()'ed to the number of nodes in the graph
       ORT_RETURN_IF_ERROR(kernel_registry_manager.CreateKernel(node, exec_provider, *this, kci, session_kernels_[node.Index()]));
     }
+
+    const std::string sampling_interval_str = sess_options_.config_options.GetConfigOrDefault(
+        kOrtSessionOptionsKernelTimeHistogramSamplingInterval, "0");
+    uint64_t sampling_interval = 0;
+    if (!TryParseStringWithClassicLocale<uint64_t>(sampling_interval_str, sampling_interval)) {
+      LOGS(logger_, WARNING) << "Invalid value for " << kOrtSessionOptionsKernelTimeHistogramSamplingInterval
+                             << ": " << sampling_interval_str << ". Kernel time histograms are disabled.";
+    } else if (sampling_interval > 0) {
+      kernel_time_histograms_ = std::make_unique<KernelTimeHistograms>(session_kernels_.size(), sampling_interval);
+    }
+
+    if (sess_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsEnableCalibrationCollection, "0") == "1") {
+      const std::string tensor_names_str = sess_options_.config_options.GetConfigOrDefault(
+          kOrtSessionOptionsCalibrationTensorNames, "");
+      InlinedHashSet<std::string> tensor_names;
+      for (size_t start = 0; start < tensor_names_str.size();) {
+        size_t end = tensor_names_str.find(';', start);
+        if (end == std::string::npos) {
+          end = tensor_names_str.size();
+        }
+        if (end > start) {
+          tensor_names.emplace(tensor_names_str.substr(start, end - start));
+        }
+        start = end + 1;
+      }
+      calibration_collector_ = std::make_unique<CalibrationCollector>(std::move(tensor_names));
+    }
+
+    if (sess_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsEnableEpBoundaryStats, "0") == "1") {
+      // Partitioning has already run, so the boundary structure is fixed: classify it once here
+      // so executing a non-boundary node only costs a hash lookup.
+      InlinedHashMap<NodeIndex, EpBoundaryStats::NodeBoundary> node_boundaries;
+      for (const auto& node : nodes) {
+        EpBoundaryStats::NodeBoundary boundary;
+        boundary.is_memcpy = node.OpType() == "MemcpyFromHost" || node.OpType() == "MemcpyToHost";
+        const auto& dst_provider = node.GetExecutionProviderType();
+        for (auto it = node.InputEdgesBegin(), end = node.InputEdgesEnd(); it != end; ++it) {
+          const auto& src_provider = it->GetNode().GetExecutionProviderType();
+          if (src_provider != dst_provider) {
+            boundary.crossing_inputs.emplace_back(it->GetDstArgIndex(),
+                                                  src_provider + " -> " + dst_provider);
+          }
+        }
+
+        // MemcpyToHost runs on the device EP with a same-EP producer; the transition it pays for
+        // is towards the EP of its consumer, so classify it from its output edges instead.
+        if (boundary.is_memcpy && boundary.crossing_inputs.empty()) {
+          for (auto it = node.OutputEdgesBegin(), end = node.OutputEdgesEnd(); it != end; ++it) {
+            const auto& consumer_provider = it->GetNode().GetExecutionProviderType();
+            if (consumer_provider != dst_provider) {
+              boundary.crossing_inputs.emplace_back(0, dst_provider + " -> " + consumer_provider);
+              break;
+            }
+          }
+        }
+
+        if (!boundary.crossing_inputs.empty()) {
+          node_boundaries.emplace(node.Index(), std::move(boundary));
+        }
+      }
+      ep_boundary_stats_ = std::make_unique<EpBoundaryStats>(std::move(node_boundaries));
+    }
   }
   node_index_info_.emplace(*graph_viewer_, ort_value_name_idx_map_);
   return Status::OK();
@@ -396,9 +461,62 @@ static std::string GenerateKeyForPrepackedWeightsMap(const std::string& op_type,
   return ss_1.str();
 }
 
+// Key for the pre-packed weights stored in (or loaded from) an ORT format model.
+// Unlike the shared container key it must be computable without running PrePack(), so it is
+// derived from the consuming node input rather than from the packed buffer contents.
+static std::string GenerateKeyForModelPrePackedWeightsMap(const std::string& op_type,
+                                                          NodeIndex node_index,
+                                                          int input_idx) {
+  std::ostringstream ss_1;
+  ss_1 << op_type;
+  ss_1 << ":";
+  ss_1 << node_index;
+  ss_1 << ":";
+  ss_1 << input_idx;
+
+  return ss_1.str();
+}
+
+static Status KernelUseSavedPrePackedBuffers(OpKernel& kernel, const Tensor& tensor, int input_idx,
+                                             const PrePackedWeights& prepacked_weights,
+                                             /*out*/ bool& used_saved_buffers) {
+  std::vector<BufferUniquePtr> saved_prepacked_buffers;
+  saved_prepacked_buffers.reserve(4);  // Unlikely to see more than 4 prepacked buffers per initializer
+
+  for (const auto& prepacked_buffer : prepacked_weights.buffers_) {
+    // BufferDeleter is nullptr because the kernel should not delete the loaded buffer - it is owned
+    // by the session state
+    saved_prepacked_buffers.emplace_back(prepacked_buffer.get(), BufferDeleter(nullptr));
+  }
+
+  // Unlike the shared pre-packed weights case it is not an error if the kernel declines the
+  // buffers (most kernels cannot adopt them without running PrePack()) - the initializer will
+  // simply be packed as usual.
+  return kernel.UseSavedPrePackedBuffers(tensor, input_idx, saved_prepacked_buffers, used_saved_buffers);
+}
+
+// Creates a non-owning view of the given pre-packed weight. Used when an instance owned
+// elsewhere (e.g. by a shared container that outlives the session) needs to be referenced
+// from the serialization map as well.
+static PrePackedWeights CreateNonOwningCopyOfPrePackedWeights(const PrePackedWeights& prepacked_weights) {
+  PrePackedWeights non_owning_copy;
+  for (const auto& buffer : prepacked_weights.buffers_) {
+    non_owning_copy.buffers_.emplace_back(buffer.get(), [](void*) {});
+  }
+  non_owning_copy.buffer_sizes_ = prepacked_weights.buffer_sizes_;
+  return non_owning_copy;
+}
+
 Status SessionState::PrepackConstantInitializedTensors(InlinedHashMap<std::string, size_t>& constant_initializers_use_count,
                                                        const std::unordered_map<std::string, const OrtValue*>& initializers_to_share_map) {
-  auto prepacked_constant_weights = [this, &constant_initializers_use_count, &initializers_to_share_map](
+  // Capturing pre-packed weights for serialization into an ORT format model is restricted to the
+  // main graph - subgraph node indices are graph-local and would produce ambiguous keys.
+  const bool save_prepacked_initializers =
+      parent_ == nullptr &&
+      !sess_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigPrepackedWeightsTargetIsa, "").empty();
+
+  auto prepacked_constant_weights = [this, &constant_initializers_use_count, &initializers_to_share_map,
+                                     save_prepacked_initializers](
                                         bool should_cache_prepacked_weights_for_shared_initializers) -> Status {
     for (auto& node : GetGraphViewer().Nodes()) {
       auto kernel = GetMutableKernel(node.Index());
@@ -421,9 +539,35 @@ Status SessionState::PrepackConstantInitializedTensors(InlinedHashMap<std::strin
                 auto iter = initializers_to_share_map.find(input_name);
                 bool is_shared_initializer = (iter != initializers_to_share_map.end());
 
-                // Caching pre-packed weights is limited to shared initializers associated with the CPU EP for now
-                if (is_shared_initializer && should_cache_prepacked_weights_for_shared_initializers &&
-                    node.GetExecutionProviderType() == kCpuExecutionProvider) {  // caching of pre-packed weights' turned ON
+                // Pre-packed weights loaded from the model (if any) take precedence: a kernel
+                // that can adopt them skips the packing computation altogether.
+                if (!prepacked_weights_from_model_.empty()) {
+                  auto loaded_iter = prepacked_weights_from_model_.find(
+                      GenerateKeyForModelPrePackedWeightsMap(node.OpType(), node.Index(), input_idx));
+
+                  if (loaded_iter != prepacked_weights_from_model_.end()) {
+                    bool used_model_prepacked_weight = false;
+                    ORT_RETURN_IF_ERROR(KernelUseSavedPrePackedBuffers(*kernel, const_initialized_tensor,
+                                                                       input_idx, loaded_iter->second,
+                                                                       used_model_prepacked_weight));
+
+                    if (used_model_prepacked_weight) {
+                      LOGS(logger_, INFO) << "Using pre-packed weight stored in the model for constant initializer: "
+                                          << input_name << " used in the node: " << node.Name()
+                                          << " which is of op type: " << node.OpType();
+
+                      is_packed = true;
+                      ++used_model_pre_packed_weights_counter_;
+                    }
+                  }
+                }
+
+                if (is_packed) {
+                  // the kernel adopted a pre-packed weight loaded from the model - nothing further to do
+
+                  // Caching pre-packed weights is limited to shared initializers associated with the CPU EP for now
+                } else if (is_shared_initializer && should_cache_prepacked_weights_for_shared_initializers &&
+                           node.GetExecutionProviderType() == kCpuExecutionProvider) {  // caching of pre-packed weights' turned ON
 
                   AllocatorPtr allocator_for_caching = prepacked_weights_container_->GetOrCreateAllocator(CPU);
                   ORT_ENFORCE(allocator_for_caching.get() != nullptr);
@@ -476,15 +620,40 @@ Status SessionState::PrepackConstantInitializedTensors(InlinedHashMap<std::strin
                                                                           prepacked_weights_container_->GetWeight(prepacked_weights_container_key),
                                                                           node.Name()));
                     }
+
+                    if (save_prepacked_initializers) {
+                      // the container (whose life-cycle is managed by the user) outlives the session,
+                      // so a non-owning view is sufficient for serialization
+                      prepacked_weights_for_serialization_.emplace(
+                          GenerateKeyForModelPrePackedWeightsMap(op_type, node.Index(), input_idx),
+                          CreateNonOwningCopyOfPrePackedWeights(
+                              prepacked_weights_container_->GetWeight(prepacked_weights_container_key)));
+                    }
                   }
 
                 } else {  // caching of pre-packed weights' turned OFF
                   AllocatorPtr session_cpu_alloc = GetAllocator(kernel->Info().GetDevice(OrtMemType::OrtMemTypeDefault));
+
+                  PrePackedWeights weights_to_be_serialized;
                   ORT_RETURN_IF_ERROR(kernel->PrePack(const_initialized_tensor, input_idx,
                                                       session_cpu_alloc,  // use allocator tied to this session
                                                       is_packed,
-                                                      nullptr  // no caching required
+                                                      save_prepacked_initializers
+                                                          ? &weights_to_be_serialized
+                                                          : nullptr  // no caching required
                                                       ));
+
+                  if (is_packed && save_prepacked_initializers && !weights_to_be_serialized.buffers_.empty()) {
+                    // the kernel moved its packed buffers into weights_to_be_serialized - keep them
+                    // for serialization and hand non-owning views back to the kernel
+                    auto insert_result = prepacked_weights_for_serialization_.emplace(
+                        GenerateKeyForModelPrePackedWeightsMap(node.OpType(), node.Index(), input_idx),
+                        std::move(weights_to_be_serialized));
+
+                    ORT_RETURN_IF_ERROR(KernelUseSharedPrePackedBuffers(*kernel, input_idx,
+                                                                        insert_result.first->second,
+                                                                        node.Name()));
+                  }
                 }
                 if (is_packed) {
                   ++number_of_prepacks_counter_;
@@ -526,11 +695,23 @@ Status SessionState::PrepackConstantInitializedTensors(InlinedHashMap<std::strin
 }
 
 static int64_t CalculateMemoryPatternsKey(const gsl::span<const OrtValue>& tensor_inputs) {
-  int64_t key = 0;
+  // FNV-1a over the rank and dims of every input. The previous implementation XOR'ed all dims into the
+  // key, which collides for permuted shapes (e.g. [2,8] vs [8,2]) and self-cancelling dims (e.g. [4,4]
+  // vs [2,2]). A collision makes a run with one shape signature adopt the pattern planned for another,
+  // so dynamic-dim models kept losing the planned-allocation fast path and fell back to per-Run arena
+  // allocations.
+  uint64_t key = 14695981039346656037ULL;
+  const auto hash_value = [&key](uint64_t v) {
+    key = (key ^ v) * 1099511628211ULL;
+  };
   for (const auto& input : tensor_inputs) {
-    for (auto dim : input.Get<Tensor>().Shape().GetDims()) key ^= dim;
+    const auto dims = input.Get<Tensor>().Shape().GetDims();
+    hash_value(static_cast<uint64_t>(dims.size()));
+    for (auto dim : dims) {
+      hash_value(static_cast<uint64_t>(dim));
+    }
   }
-  return key;
+  return static_cast<int64_t>(key);
 }
 
 #ifdef ENABLE_TRAINING
@@ -848,12 +1029,14 @@ void SessionState::ResolveMemoryPatternFlag() {
 }
 
 Status SessionState::UpdateMemoryPatternGroupCache(gsl::span<const OrtValue> tensor_inputs,
-                                                   MemoryPatternGroup mem_patterns) const {
+                                                   MemoryPatternGroup mem_patterns,
+                                                   InlinedHashMap<int, TensorShape> inferred_shapes) const {
   int64_t key = CalculateMemoryPatternsKey(tensor_inputs);
 
   std::lock_guard<OrtMutex> lock(mem_patterns_lock_);
   // Do not update if present, as the pointer to the existing one is cached
   mem_patterns_.emplace(key, std::move(mem_patterns));
+  shape_patterns_.emplace(key, std::move(inferred_shapes));
   return Status::OK();
 }
 
@@ -986,6 +1169,50 @@ const NodeIndexInfo& SessionState::GetNodeIndexInfo() const {
   return *node_index_info_;
 }
 
+SubgraphResultCache* SessionState::GetSubgraphResultCache() const {
+  std::lock_guard<OrtMutex> lock(subgraph_result_cache_lock_);
+
+  if (!subgraph_result_cache_initialized_) {
+    subgraph_result_cache_initialized_ = true;
+
+    if (sess_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsEnableSubgraphMemoization, "0") == "1") {
+      size_t max_entries = 16;
+      ORT_IGNORE_RETURN_VALUE(TryParseStringWithClassicLocale(
+          sess_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsSubgraphMemoizationMaxEntries, "16"),
+          max_entries));
+
+      if (max_entries > 0) {
+        subgraph_result_cache_ = std::make_unique<SubgraphResultCache>(GetAllocator(OrtDevice()), max_entries);
+      }
+    }
+  }
+
+  return subgraph_result_cache_.get();
+}
+
+size_t SessionState::EvictMemoryCaches() const {
+  size_t released = 0;
+
+  if (delta_execution_manager_) {
+    released += delta_execution_manager_->EvictCache();
+  }
+
+  {
+    std::lock_guard<OrtMutex> lock(subgraph_result_cache_lock_);
+    if (subgraph_result_cache_) {
+      released += subgraph_result_cache_->EvictAll();
+    }
+  }
+
+  for (const auto& node_entry : subgraph_session_states_) {
+    for (const auto& attribute_entry : node_entry.second) {
+      released += attribute_entry.second->EvictMemoryCaches();
+    }
+  }
+
+  return released;
+}
+
 #ifdef ENABLE_TRAINING
 void SessionState::UpdateToBeExecutedRange(gsl::span<int const> fetch_mlvalue_idxs) {
   InlinedVector<int> sorted_idxs;
@@ -1188,8 +1415,253 @@ Status SessionState::FinalizeSessionState(const std::basic_string<PATH_CHAR_TYPE
 
   InlinedHashMap<std::string, size_t> constant_initializers_use_count;
   ComputeConstantInitializerUseCount(graph_, constant_initializers_use_count);
-  return FinalizeSessionStateImpl(graph_location, kernel_registry_manager, nullptr, sess_options_,
-                                  remove_initializers, constant_initializers_use_count);
+
+  // when enabled, duplicated constant initializers alias one buffer. the context spans the
+  // subgraph recursion so a weight embedded both in the main graph and in a control flow
+  // subgraph is still loaded only once.
+  session_state_utils::InitializerDedupContext initializer_dedup_context;
+  const bool share_duplicate_initializers =
+      sess_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsShareDuplicateInitializers, "0") == "1";
+
+  ORT_RETURN_IF_ERROR(FinalizeSessionStateImpl(graph_location, kernel_registry_manager, nullptr, sess_options_,
+                                               remove_initializers, constant_initializers_use_count,
+                                               /*outer_scope_node_arg_to_location_map*/ {},
+                                               /*graph_info_already_created*/ false,
+                                               share_duplicate_initializers ? &initializer_dedup_context : nullptr));
+
+  if (share_duplicate_initializers && initializer_dedup_context.shared_count > 0) {
+    LOGS(logger_, INFO) << "Shared " << initializer_dedup_context.shared_count
+                        << " duplicated initializers, saving "
+                        << initializer_dedup_context.shared_bytes << " bytes.";
+  }
+
+  if (sess_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigBackgroundInitializerPrefetch,
+                                                      "0") == "1") {
+    StartInitializerPrefetch();
+  }
+
+  if (sess_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsEnableWeightStreaming, "0") == "1") {
+    constexpr size_t kDefaultPrefetchBudgetBytes = size_t{1} << 30;
+    size_t prefetch_budget_bytes = kDefaultPrefetchBudgetBytes;
+    const std::string budget_str =
+        sess_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsWeightStreamingBudgetBytes, "");
+    if (!budget_str.empty()) {
+      ORT_RETURN_IF_NOT(TryParseStringWithClassicLocale<size_t>(budget_str, prefetch_budget_bytes) &&
+                            prefetch_budget_bytes > 0,
+                        "Invalid ", kOrtSessionOptionsWeightStreamingBudgetBytes, " value: ", budget_str);
+    }
+    CreateWeightResidencyManager(prefetch_budget_bytes);
+  }
+
+  if (sess_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsEnableDeltaExecution, "0") == "1") {
+    constexpr size_t kDefaultCacheBudgetBytes = size_t{256} << 20;
+    size_t cache_budget_bytes = kDefaultCacheBudgetBytes;
+    const std::string budget_str =
+        sess_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsDeltaExecutionCacheBudgetBytes, "");
+    if (!budget_str.empty()) {
+      ORT_RETURN_IF_NOT(TryParseStringWithClassicLocale<size_t>(budget_str, cache_budget_bytes) &&
+                            cache_budget_bytes > 0,
+                        "Invalid ", kOrtSessionOptionsDeltaExecutionCacheBudgetBytes, " value: ", budget_str);
+    }
+    CreateDeltaExecutionManager(cache_budget_bytes);
+  }
+
+  return Status::OK();
+}
+
+void SessionState::StartInitializerPrefetch() {
+  // Gather the CPU initializers in the order the execution plan first consumes
+  // them. The list is built up front on this thread so the prefetch thread
+  // never touches graph structures.
+  InlinedVector<const Tensor*> tensors;
+  tensors.reserve(initialized_tensors_.size());
+  InlinedHashSet<int> seen;
+  seen.reserve(initialized_tensors_.size());
+
+  for (NodeIndex node_index : graph_viewer_->GetNodesInTopologicalOrder()) {
+    const Node* node = graph_viewer_->GetNode(node_index);
+    if (node == nullptr) {
+      continue;
+    }
+
+    for (const NodeArg* input : node->InputDefs()) {
+      int ort_value_idx = -1;
+      if (!input->Exists() || !ort_value_name_idx_map_.GetIdx(input->Name(), ort_value_idx).IsOK() ||
+          !seen.insert(ort_value_idx).second) {
+        continue;
+      }
+
+      auto it = initialized_tensors_.find(ort_value_idx);
+      if (it == initialized_tensors_.end() || !it->second.IsTensor()) {
+        continue;
+      }
+
+      const Tensor& tensor = it->second.Get<Tensor>();
+      if (tensor.Location().device.Type() != OrtDevice::CPU || tensor.IsDataTypeString() ||
+          tensor.SizeInBytes() == 0) {
+        continue;
+      }
+
+      tensors.push_back(&tensor);
+    }
+  }
+
+  if (tensors.empty()) {
+    return;
+  }
+
+  initializer_prefetch_thread_ = std::thread([this, tensors = std::move(tensors)]() {
+    // Reading one byte per page is enough to fault the page in.
+    constexpr size_t kPageSize = 4096;
+    volatile char sink = 0;
+    for (const Tensor* tensor : tensors) {
+      if (initializer_prefetch_cancelled_.load(std::memory_order_relaxed)) {
+        return;
+      }
+
+      const char* data = static_cast<const char*>(tensor->DataRaw());
+      const size_t size = tensor->SizeInBytes();
+      for (size_t offset = 0; offset < size; offset += kPageSize) {
+        sink = sink + data[offset];
+      }
+    }
+  });
+}
+
+void SessionState::CreateWeightResidencyManager(size_t prefetch_budget_bytes) {
+  // advising sub-page ranges is pointless, and tiny weights are cheap to keep resident
+  constexpr size_t kMinStreamedWeightBytes = 4096;
+
+  std::vector<WeightResidencyManager::Weight> weights;
+  InlinedHashMap<int, size_t> ort_value_to_weight;
+  InlinedHashMap<NodeIndex, size_t> node_to_position;
+
+  size_t position = 0;
+  for (NodeIndex node_index : graph_viewer_->GetNodesInTopologicalOrder()) {
+    const Node* node = graph_viewer_->GetNode(node_index);
+    if (node == nullptr) {
+      continue;
+    }
+
+    node_to_position.emplace(node_index, position);
+
+    for (const NodeArg* input : node->InputDefs()) {
+      int ort_value_idx = -1;
+      if (!input->Exists() || !ort_value_name_idx_map_.GetIdx(input->Name(), ort_value_idx).IsOK()) {
+        continue;
+      }
+
+      auto weight_it = ort_value_to_weight.find(ort_value_idx);
+      if (weight_it != ort_value_to_weight.end()) {
+        weights[weight_it->second].last_use = position;
+        continue;
+      }
+
+      auto it = initialized_tensors_.find(ort_value_idx);
+      if (it == initialized_tensors_.end() || !it->second.IsTensor()) {
+        continue;
+      }
+
+      const Tensor& tensor = it->second.Get<Tensor>();
+      if (tensor.Location().device.Type() != OrtDevice::CPU || tensor.IsDataTypeString() ||
+          tensor.SizeInBytes() < kMinStreamedWeightBytes) {
+        continue;
+      }
+
+      ort_value_to_weight.emplace(ort_value_idx, weights.size());
+      weights.push_back(WeightResidencyManager::Weight{tensor.DataRaw(), tensor.SizeInBytes(),
+                                                       position, position});
+    }
+
+    ++position;
+  }
+
+  if (weights.empty() || position == 0) {
+    return;
+  }
+
+  weight_residency_manager_ = std::make_unique<WeightResidencyManager>(
+      std::move(weights), std::move(node_to_position), position, prefetch_budget_bytes);
+}
+
+// Whether the node's outputs are a pure function of its inputs. Mirrors the non-deterministic
+// operator list in core/optimizer/utils.cc, which is not visible from the framework layer;
+// unknown domains are conservatively treated as non-deterministic, as are control flow nodes,
+// whose subgraph bodies execute against their own session states and are not tracked here.
+static bool IsDeterministicForDeltaExecution(const Node& node) {
+  if (node.ContainsSubgraph() || node.Domain() != kOnnxDomain) {
+    return false;
+  }
+
+  constexpr std::array kOnnxDomainNonDeterministicOps{"RandomUniform", "RandomNormal", "RandomUniformLike",
+                                                      "RandomNormalLike", "Multinomial", "Dropout"};
+  return std::find(kOnnxDomainNonDeterministicOps.begin(), kOnnxDomainNonDeterministicOps.end(),
+                   node.OpType()) == kOnnxDomainNonDeterministicOps.end();
+}
+
+void SessionState::CreateDeltaExecutionManager(size_t cache_budget_bytes) {
+  // graph inputs and overridable initializers are what a Run call can feed
+  InlinedHashMap<std::string, size_t> feed_name_to_position;
+  for (const NodeArg* input : graph_viewer_->GetInputsIncludingInitializers()) {
+    if (input->Exists()) {
+      feed_name_to_position.emplace(input->Name(), feed_name_to_position.size());
+    }
+  }
+
+  std::vector<DeltaExecutionManager::NodeEntry> entries;
+  InlinedHashMap<std::string, size_t> output_name_to_position;
+
+  for (NodeIndex node_index : graph_viewer_->GetNodesInTopologicalOrder()) {
+    const Node* node = graph_viewer_->GetNode(node_index);
+    if (node == nullptr) {
+      continue;
+    }
+
+    DeltaExecutionManager::NodeEntry entry;
+    entry.node_index = node_index;
+    entry.output_start = node->InputDefs().size() + node->ImplicitInputDefs().size();
+    entry.deterministic = IsDeterministicForDeltaExecution(*node);
+
+    auto record_dependency = [&](const NodeArg* input) {
+      if (!input->Exists()) {
+        return;
+      }
+      auto producer_it = output_name_to_position.find(input->Name());
+      if (producer_it != output_name_to_position.end()) {
+        entry.producers.push_back(producer_it->second);
+        return;
+      }
+      auto feed_it = feed_name_to_position.find(input->Name());
+      if (feed_it != feed_name_to_position.end()) {
+        entry.feeds.push_back(feed_it->second);
+      }
+      // anything else is a constant initializer, identical across runs
+    };
+
+    for (const NodeArg* input : node->InputDefs()) {
+      record_dependency(input);
+    }
+    for (const NodeArg* input : node->ImplicitInputDefs()) {
+      record_dependency(input);
+    }
+
+    const auto output_defs = node->OutputDefs();
+    for (size_t i = 0; i < output_defs.size(); ++i) {
+      if (output_defs[i]->Exists()) {
+        entry.output_args.push_back(static_cast<int>(i));
+        output_name_to_position.emplace(output_defs[i]->Name(), entries.size());
+      }
+    }
+
+    entries.push_back(std::move(entry));
+  }
+
+  if (entries.empty()) {
+    return;
+  }
+
+  delta_execution_manager_ = std::make_unique<DeltaExecutionManager>(
+      std::move(entries), std::move(feed_name_to_position), GetAllocator(OrtDevice()), cache_budget_bytes);
 }
 
 static Status Index(const OrtValueNameIdxMap& ort_value_name_idx_map,
@@ -1324,7 +1796,8 @@ Status SessionState::FinalizeSessionStateImpl(const std::basic_string<PATH_CHAR_
                                               bool remove_initializers,
                                               InlinedHashMap<std::string, size_t>& constant_initializers_use_count,
                                               const InlinedHashMap<OrtValueName, OrtDevice>& outer_scope_node_arg_to_location_map,
-                                              bool graph_info_already_created) {
+                                              bool graph_info_already_created,
+                                              session_state_utils::InitializerDedupContext* initializer_dedup_context) {
   if (!graph_info_already_created) {
     CreateGraphInfo();
   }
@@ -1378,9 +1851,45 @@ Status SessionState::FinalizeSessionStateImpl(const std::basic_string<PATH_CHAR_
   SubgraphsKernelCreateInfoMaps subgraphs_kernel_create_info_maps;
   AccumulateAllNestedSubgraphsInfo(*this, "", 0, subgraphs_kernel_create_info_maps);
 
+  // Node names reported hot by profiling feedback; the planner packs their initializer inputs at
+  // the front of the weight buffer. See kOrtSessionOptionsConfigProfilingHotNodeNames.
+  std::vector<std::string> hot_node_names;
+  const std::string hot_node_names_str =
+      session_options.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigProfilingHotNodeNames, "");
+  if (!hot_node_names_str.empty()) {
+    for (const auto name : utils::SplitString(hot_node_names_str, ";")) {
+      hot_node_names.emplace_back(name);
+    }
+  }
+
+  // Minimum producer-to-first-consumer distance for spilling an activation to host memory.
+  // See kOrtSessionOptionsActivationOffloadMinGap.
+  const std::string offload_min_gap_str = session_options.config_options.GetConfigOrDefault(
+      kOrtSessionOptionsActivationOffloadMinGap, "0");
+  size_t activation_offload_min_gap = 0;
+  if (!TryParseStringWithClassicLocale<size_t>(offload_min_gap_str, activation_offload_min_gap)) {
+    LOGS(logger_, WARNING) << "Invalid value for " << kOrtSessionOptionsActivationOffloadMinGap
+                           << ": " << offload_min_gap_str << ". Activation offloading is disabled.";
+    activation_offload_min_gap = 0;
+  }
+
+  // Minimum first-to-second-consumer distance for recomputing an activation instead of keeping
+  // it live. See kOrtSessionOptionsActivationRecomputeMinGap.
+  const std::string recompute_min_gap_str = session_options.config_options.GetConfigOrDefault(
+      kOrtSessionOptionsActivationRecomputeMinGap, "0");
+  size_t activation_recompute_min_gap = 0;
+  if (!TryParseStringWithClassicLocale<size_t>(recompute_min_gap_str, activation_recompute_min_gap)) {
+    LOGS(logger_, WARNING) << "Invalid value for " << kOrtSessionOptionsActivationRecomputeMinGap
+                           << ": " << recompute_min_gap_str << ". Activation recomputation is disabled.";
+    activation_recompute_min_gap = 0;
+  }
+
   SequentialPlannerContext context(session_options.execution_mode,
                                    session_options.execution_order,
-                                   session_options.enable_mem_reuse);
+                                   session_options.enable_mem_reuse,
+                                   std::move(hot_node_names),
+                                   activation_offload_min_gap,
+                                   activation_recompute_min_gap);
 
 #ifdef _WIN32
 
@@ -1489,7 +1998,7 @@ Status SessionState::FinalizeSessionStateImpl(const std::basic_string<PATH_CHAR_
             return Status::OK();
           },
           logger_, data_transfer_mgr_, external_data_loader_mgr_, *p_seq_exec_plan_, session_options,
-          memory_profile_func, name_to_buffered_tensor_));
+          memory_profile_func, name_to_buffered_tensor_, initializer_dedup_context));
 
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
   // Record Weight allocation info on device
@@ -1546,7 +2055,8 @@ Status SessionState::FinalizeSessionStateImpl(const std::basic_string<PATH_CHAR_
                                                                subgraph_outer_scope_node_arg_to_location_map));
       ORT_RETURN_IF_ERROR(subgraph_session_state.FinalizeSessionStateImpl(
           graph_location, kernel_registry_manager, &node, subgraph_session_options, remove_initializers,
-          constant_initializers_use_count, subgraph_outer_scope_node_arg_to_location_map, true));
+          constant_initializers_use_count, subgraph_outer_scope_node_arg_to_location_map, true,
+          initializer_dedup_context));
 
       // setup all the info for handling the feeds and fetches used in subgraph execution
       auto* p_op_kernel = GetMutableKernel(node.Index());
@@ -1588,15 +2098,33 @@ static void BindToDeviceStream(const SequentialExecutionPlan& execution_plan,
 
 std::unique_ptr<DeviceStreamCollection> SessionState::AcquireDeviceStreamCollection() const {
   if (has_device_stream_enabled_ep_) {
-    std::lock_guard<onnxruntime::OrtMutex> lock(device_stream_pool_mutex_);
-    if (!device_stream_pool_.empty()) {
-      auto device_stream = std::move(device_stream_pool_.back());
-      device_stream_pool_.pop_back();
-      return device_stream;
-    } else {
-      auto device_stream = std::make_unique<DeviceStreamCollection>(this->GetExecutionPlan()->execution_plan.size(), *allocators_, graph_viewer_->ParentNode() == nullptr);
-      BindToDeviceStream(*this->GetExecutionPlan(), *device_stream, *stream_handles_registry_);
-      return device_stream;
+    size_t pool_limit = 0;
+    const std::string pool_limit_str = sess_options_.config_options.GetConfigOrDefault(
+        kOrtSessionOptionsDeviceStreamPoolSize, "0");
+    if (!TryParseStringWithClassicLocale<size_t>(pool_limit_str, pool_limit)) {
+      LOGS(logger_, WARNING) << "Invalid value for " << kOrtSessionOptionsDeviceStreamPoolSize
+                             << ": " << pool_limit_str << ". The device stream pool is unbounded.";
+      pool_limit = 0;
+    }
+
+    std::unique_lock<onnxruntime::OrtMutex> lock(device_stream_pool_mutex_);
+    while (true) {
+      if (!device_stream_pool_.empty()) {
+        auto device_stream = std::move(device_stream_pool_.back());
+        device_stream_pool_.pop_back();
+        return device_stream;
+      }
+
+      if (pool_limit == 0 || device_stream_collections_created_ < pool_limit) {
+        ++device_stream_collections_created_;
+        auto device_stream = std::make_unique<DeviceStreamCollection>(this->GetExecutionPlan()->execution_plan.size(), *allocators_, graph_viewer_->ParentNode() == nullptr);
+        BindToDeviceStream(*this->GetExecutionPlan(), *device_stream, *stream_handles_registry_);
+        return device_stream;
+      }
+
+      // the cap is reached and every collection is checked out by a concurrent Run;
+      // wait for one to be recycled rather than growing device memory past pool_limit x peak
+      device_stream_pool_cv_.wait(lock);
     }
   } else {
     // no reusing of device stream is needed, just return nullptr, the caller will handle it
@@ -1607,8 +2135,11 @@ std::unique_ptr<DeviceStreamCollection> SessionState::AcquireDeviceStreamCollect
 void SessionState::RecycleDeviceStreamCollection(std::unique_ptr<DeviceStreamCollection> device_stream_collection) const {
   // if no need to reuse the device stream, don't perform the recycle
   if (has_device_stream_enabled_ep_) {
-    std::lock_guard<onnxruntime::OrtMutex> lock(device_stream_pool_mutex_);
-    device_stream_pool_.push_back(std::move(device_stream_collection));
+    {
+      std::lock_guard<onnxruntime::OrtMutex> lock(device_stream_pool_mutex_);
+      device_stream_pool_.push_back(std::move(device_stream_collection));
+    }
+    device_stream_pool_cv_.notify_one();
   } else {
     device_stream_collection.reset(nullptr);
   }
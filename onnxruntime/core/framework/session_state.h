@@ -3,8 +3,10 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <map>
+#include <thread>
 #include <unordered_map>
 #include <string>
 #include <vector>
@@ -28,8 +30,16 @@
 #include "core/framework/prepacked_weights_container.h"
 #include "core/framework/fuse_nodes_funcs.h"
 #include "core/framework/kernel_registry_manager.h"
+#include "core/framework/calibration_collector.h"
+#include "core/framework/delta_execution_manager.h"
+#include "core/framework/ep_boundary_stats.h"
+#include "core/framework/kernel_time_histograms.h"
+#include "core/framework/weight_residency_manager.h"
+#include "core/framework/run_memory_watermarks.h"
 #include "core/framework/mem_pattern.h"
 #include "core/framework/ort_value.h"
+#include "core/framework/ort_value_buffer_pool.h"
+#include "core/framework/subgraph_result_cache.h"
 #include "core/framework/node_index_info.h"
 #include "core/framework/op_kernel.h"
 #include "core/framework/ort_value_name_idx_map.h"
@@ -64,6 +74,10 @@ class DeviceStreamCollection;
 class MemoryInfo;
 #endif
 
+namespace session_state_utils {
+struct InitializerDedupContext;
+}
+
 /**
  * SessionState should be modified by the inference session class only.
  * It is supposed to be passed by const-ref only to all the executors.
@@ -102,6 +116,13 @@ class SessionState {
                AllocatorMap* parent_allocators = nullptr);
 
   ~SessionState() {
+    // the prefetch thread reads initialized tensor data, so it must finish
+    // before any of the deleters below run
+    initializer_prefetch_cancelled_ = true;
+    if (initializer_prefetch_thread_.joinable()) {
+      initializer_prefetch_thread_.join();
+    }
+
     for (auto& kvp : deleter_for_initialized_tensors_) {
       kvp.second.f(kvp.second.param);
     }
@@ -121,6 +142,36 @@ class SessionState {
     return (node_id < session_kernels_.size()) ? session_kernels_[node_id].get() : nullptr;
   }
 
+  // Per-node latency histograms. nullptr unless enabled via
+  // kOrtSessionOptionsKernelTimeHistogramSamplingInterval; created in CreateKernels.
+  KernelTimeHistograms* GetKernelTimeHistograms() const { return kernel_time_histograms_.get(); }
+
+  // Always-on per-run memory watermarks. The main graph ExecutionFrame publishes its per-device
+  // peak into this when it is destroyed at the end of a run.
+  RunMemoryWatermarks* GetRunMemoryWatermarks() const { return run_memory_watermarks_.get(); }
+
+  // Streaming min/max statistics of node outputs for quantization calibration. nullptr unless
+  // enabled via kOrtSessionOptionsEnableCalibrationCollection; created in CreateKernels.
+  CalibrationCollector* GetCalibrationCollector() const { return calibration_collector_.get(); }
+
+  // Per-transition byte/time totals for EP boundaries (Memcpy nodes and cross-EP edges). nullptr
+  // unless enabled via kOrtSessionOptionsEnableEpBoundaryStats; created in CreateKernels.
+  EpBoundaryStats* GetEpBoundaryStats() const { return ep_boundary_stats_.get(); }
+
+  // Weight page residency hints for models larger than RAM. nullptr unless enabled via
+  // kOrtSessionOptionsEnableWeightStreaming; created in FinalizeSessionState.
+  WeightResidencyManager* GetWeightResidencyManager() const { return weight_residency_manager_.get(); }
+
+  // Run-to-run skipping of nodes whose transitive inputs are unchanged. nullptr unless enabled
+  // via kOrtSessionOptionsEnableDeltaExecution; created in FinalizeSessionState.
+  DeltaExecutionManager* GetDeltaExecutionManager() const { return delta_execution_manager_.get(); }
+
+  // Drops the session-owned caches that can be rebuilt at a latency cost - the delta-execution
+  // output cache and memoized subgraph results - in this session state and, recursively, in
+  // every subgraph session state. Returns the number of bytes released. Used as an eviction
+  // callback under memory pressure; see SessionMemoryBudget.
+  size_t EvictMemoryCaches() const;
+
   const ExecutionProviders& GetExecutionProviders() const noexcept { return execution_providers_; }
 
   /**
@@ -229,12 +280,15 @@ class SessionState {
       const InlinedHashMap<int, TensorShape>*& inferred_shapes) const;
 
   /**
-  Set generated memory pattern with a given input shapes.
+  Set generated memory pattern with a given input shapes,
+  along with the concrete shapes observed for the planned values
+  so later runs with the same signature can serve TryGetInferredShape.
   Const as it's an internal cache update only.
   All inputs must represent Tensors
   */
   Status UpdateMemoryPatternGroupCache(gsl::span<const OrtValue> tensor_inputs,
-                                       MemoryPatternGroup mem_patterns) const;
+                                       MemoryPatternGroup mem_patterns,
+                                       InlinedHashMap<int, TensorShape> inferred_shapes) const;
 
   bool GetUseDeterministicCompute() const { return sess_options_.use_deterministic_compute; }
 
@@ -303,6 +357,16 @@ class SessionState {
   InlinedVector<BufferUniquePtr>& GetMutableWeightsBuffers() noexcept { return weights_buffers_; }
 
   const NodeIndexInfo& GetNodeIndexInfo() const;
+
+  // Pool that recycles the OrtValue storage of execution frames across Run
+  // calls. Mutable as acquiring/releasing buffers does not change the logical
+  // state of the session.
+  OrtValueBufferPool& GetOrtValueBufferPool() const noexcept { return ort_value_buffer_pool_; }
+
+  // Cache of the outputs of this session state's (pure) subgraph, created on first use when
+  // kOrtSessionOptionsEnableSubgraphMemoization is set. Returns nullptr when memoization is
+  // disabled. Only meaningful on subgraph session states; see SubgraphResultCache.
+  SubgraphResultCache* GetSubgraphResultCache() const;
 #ifdef ENABLE_TRAINING
   void UpdateToBeExecutedRange(gsl::span<int const> fetch_mlvalue_idxs);
   const InlinedHashSet<NodeIndex>* GetToBeExecutedRange(gsl::span<int const> fetch_mlvalue_idxs) const;
@@ -333,6 +397,24 @@ class SessionState {
     return used_shared_pre_packed_weights_counter_;
   }
 
+  size_t GetUsedModelPrePackedWeightCounter() const {
+    return used_model_pre_packed_weights_counter_;
+  }
+
+  // Provide pre-packed weights that were loaded from an ORT format model.
+  // They are consumed during FinalizeSessionState() by kernels that can adopt them
+  // instead of re-running PrePack(). To be called before FinalizeSessionState().
+  void SetPrePackedWeightsFromModel(std::unordered_map<std::string, PrePackedWeights>&& prepacked_weights) {
+    prepacked_weights_from_model_ = std::move(prepacked_weights);
+  }
+
+  // Pre-packed weights captured while finalizing the session state for serialization into
+  // an ORT format model. Only populated when kOrtSessionOptionsConfigPrepackedWeightsTargetIsa
+  // is set in the session options.
+  const std::unordered_map<std::string, PrePackedWeights>& GetPrePackedWeightsForSerialization() const {
+    return prepacked_weights_for_serialization_;
+  }
+
   const KernelCreateInfoMap& GetKernelCreateInfoMap() const {
     return kernel_create_info_map_;
   }
@@ -342,6 +424,11 @@ class SessionState {
   }
 
 #ifdef ORT_ENABLE_STREAM
+  // Checks a device stream collection out of the session's pool, creating one if none is cached.
+  // When kOrtSessionOptionsDeviceStreamPoolSize caps the pool, at most that many collections exist
+  // at once and this call blocks until a concurrent Run returns one; since each collection's
+  // streams retain their arena memory across runs, the cap bounds total device activation memory
+  // at pool_size x per-run peak under burst load.
   std::unique_ptr<DeviceStreamCollection> AcquireDeviceStreamCollection() const;
 
   void RecycleDeviceStreamCollection(std::unique_ptr<DeviceStreamCollection> device_stream_collection) const;
@@ -401,7 +488,25 @@ class SessionState {
                                   bool remove_initializers,
                                   InlinedHashMap<std::string, size_t>& constant_initializers_use_count,
                                   const InlinedHashMap<OrtValueName, OrtDevice>& outer_scope_node_arg_to_location_map = {},
-                                  bool graph_info_already_created = false);
+                                  bool graph_info_already_created = false,
+                                  // shared across the subgraph recursion so duplicated initializers
+                                  // alias one buffer; nullptr when sharing is disabled
+                                  session_state_utils::InitializerDedupContext* initializer_dedup_context = nullptr);
+
+  // Start a background thread that touches the pages of CPU initializers in
+  // execution plan order. Initializers backed by a memory-mapped file are
+  // materialized lazily by the OS; prefetching them in the order the plan
+  // consumes them hides the page-fault cost from the first Run.
+  void StartInitializerPrefetch();
+
+  // Build the weight residency manager from the initialized tensors and the topological node
+  // order. Weights smaller than a page are skipped; see WeightResidencyManager.
+  void CreateWeightResidencyManager(size_t prefetch_budget_bytes);
+
+  // Build the delta execution manager from the graph's dependency structure: per node, the
+  // producers of its inputs, the graph inputs it reads directly and whether its op is
+  // deterministic. See DeltaExecutionManager.
+  void CreateDeltaExecutionManager(size_t cache_budget_bytes);
 
 #ifdef ENABLE_TRAINING
   Status GeneratePatternGroupCache(
@@ -419,6 +524,24 @@ class SessionState {
 
   // cache of the constructed kernels to avoid spending construction time per executor
   std::vector<std::unique_ptr<OpKernel>> session_kernels_;
+
+  // optional per-node latency histograms, indexed by NodeIndex like session_kernels_
+  std::unique_ptr<KernelTimeHistograms> kernel_time_histograms_;
+
+  // optional streaming calibration statistics, fed from node outputs as kernels complete
+  std::unique_ptr<CalibrationCollector> calibration_collector_;
+
+  // optional EP boundary cost accounting, fed from KernelScope as boundary nodes execute
+  std::unique_ptr<EpBoundaryStats> ep_boundary_stats_;
+
+  // optional weight page residency hints, driven from KernelScope as nodes execute
+  std::unique_ptr<WeightResidencyManager> weight_residency_manager_;
+
+  // optional run-to-run node skipping, consulted from ExecuteKernel and fed from KernelScope
+  std::unique_ptr<DeltaExecutionManager> delta_execution_manager_;
+
+  // per-run memory watermarks keyed by input-shape signature; only populated for the main graph
+  std::unique_ptr<RunMemoryWatermarks> run_memory_watermarks_ = std::make_unique<RunMemoryWatermarks>();
   Graph& graph_;
   std::optional<GraphViewer> graph_viewer_;  // GraphViewer for const access to Graph
 
@@ -498,13 +621,10 @@ class SessionState {
   // cache for the generated mem_patterns. key is calculated based on input shapes.
   // must be a node based container as a pointer is cached.
   mutable NodeHashMap<int64_t, MemoryPatternGroup> mem_patterns_;
-  // This is mutable under mutex in training scenarios so execution frame would make a copy
-  // of the value when created.
-#ifdef ENABLE_TRAINING
+  // Updated under mem_patterns_lock_: up front in training scenarios (execution frame makes a
+  // copy of the value when created), and from the post-run cache update in inference scenarios.
+  // Must be a node based container as a pointer into it is handed to the execution frame.
   mutable NodeHashMap<int64_t, InlinedHashMap<int, TensorShape>> shape_patterns_;
-#else
-  NodeHashMap<int64_t, InlinedHashMap<int, TensorShape>> shape_patterns_;
-#endif
 
   NameNodeInfoMapType input_names_to_nodeinfo_mapping_;
   NameNodeInfoMapType output_names_to_nodeinfo_mapping_;
@@ -522,6 +642,17 @@ class SessionState {
   const SessionOptions& sess_options_;
 
   std::optional<NodeIndexInfo> node_index_info_;
+  mutable OrtValueBufferPool ort_value_buffer_pool_;
+
+  // lazily created by GetSubgraphResultCache. the 'initialized' flag distinguishes "not created
+  // yet" from "memoization is disabled", so the config options are only consulted once.
+  mutable OrtMutex subgraph_result_cache_lock_;
+  mutable std::unique_ptr<SubgraphResultCache> subgraph_result_cache_;
+  mutable bool subgraph_result_cache_initialized_{false};
+
+  // see StartInitializerPrefetch
+  std::thread initializer_prefetch_thread_;
+  std::atomic<bool> initializer_prefetch_cancelled_{false};
 
   // Container to store pre-packed weights to share between sessions.
   // The life-cycle of the cache itself is maintained by the user and the user will ensure
@@ -559,6 +690,19 @@ class SessionState {
   // a constant initialized weight was used by the session state
   size_t used_shared_pre_packed_weights_counter_ = 0;
 
+  // Counter for number of times a pre-packed weight loaded from the model (ORT format)
+  // was adopted by a kernel, skipping the packing computation
+  size_t used_model_pre_packed_weights_counter_ = 0;
+
+  // Pre-packed weights loaded from an ORT format model, keyed by the consuming node input
+  // ("<op type>:<node index>:<input index>" in the main graph). Only used by the root
+  // session state - subgraph node indices are graph-local and would be ambiguous.
+  std::unordered_map<std::string, PrePackedWeights> prepacked_weights_from_model_;
+
+  // Pre-packed weights captured while finalizing the session state, keyed the same way,
+  // for serialization into an ORT format model
+  std::unordered_map<std::string, PrePackedWeights> prepacked_weights_for_serialization_;
+
 #ifdef DEBUG_NODE_INPUTS_OUTPUTS
   // Counter for number of times the session graph has been executed
   size_t graph_executions_counter_ = 0;
@@ -570,6 +714,10 @@ class SessionState {
   // lock for the device stream pool
   mutable OrtMutex device_stream_pool_mutex_;
   mutable std::vector<std::unique_ptr<DeviceStreamCollection>> device_stream_pool_;
+  // signalled when a collection is recycled, so acquires blocked on a full pool can proceed
+  mutable OrtCondVar device_stream_pool_cv_;
+  // number of collections handed out or cached; only grows while below the configured cap
+  mutable size_t device_stream_collections_created_ = 0;
   // flag to indicate whether current session using any EP that create device stream dynamically.
   bool has_device_stream_enabled_ep_ = false;
 #endif
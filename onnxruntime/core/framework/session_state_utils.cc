@@ -1,9 +1,11 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#include <cstring>
 #include <functional>
 #include <limits>
 #include <memory>
+#include <string_view>
 #include <unordered_map>
 #include <utility>
 
@@ -72,6 +74,7 @@ static inline common::Status ExtDataTensorProtoToTensor(const Env& env,
                                                         const std::basic_string<PATH_CHAR_TYPE>& proto_path,
                                                         const ONNX_NAMESPACE::TensorProto& tensor_proto,
                                                         Tensor& tensor, OrtCallback& ext_data_deleter,
+                                                        bool verify_checksum,
                                                         Tensor* buffered_tensor = nullptr) {
   ORT_ENFORCE(utils::HasExternalData(tensor_proto));
 
@@ -81,6 +84,11 @@ static inline common::Status ExtDataTensorProtoToTensor(const Env& env,
                                                        ext_data_buf, ext_data_len, ext_data_deleter,
                                                        buffered_tensor));
 
+  if (verify_checksum) {
+    // verify right after the read while the pages are warm, so this stays one pass over the bytes
+    ORT_RETURN_IF_ERROR(utils::VerifyExternalDataChecksum(tensor_proto, ext_data_buf, ext_data_len));
+  }
+
   // NB: creating a do-nothing allocator per tensor is wasteful; can perhaps be
   // avoided if the Tensor class implements the do-nothing behavior when given a
   // nullptr for the allocator argument
@@ -101,6 +109,7 @@ static common::Status DeserializeTensorProto(const Env& env, const std::basic_st
                                              OrtValue& ort_value, const DataTransferManager& data_transfer_mgr,
                                              const ExternalDataLoaderManager& external_data_loader_mgr,
                                              bool use_device_allocator_for_initializers = false,
+                                             bool verify_external_data_checksum = false,
                                              Tensor* buffered_tensor = nullptr) {
   if (bool(alloc) == (m != nullptr)) {
     return Status(common::ONNXRUNTIME, common::INVALID_ARGUMENT,
@@ -139,7 +148,8 @@ static common::Status DeserializeTensorProto(const Env& env, const std::basic_st
       // TensorProtoToTensor it would copy the data, causing unnecessary overhead
       OrtCallback ext_data_deleter;
       ORT_RETURN_IF_ERROR(ExtDataTensorProtoToTensor(env, proto_path, tensor_proto, *p_tensor,
-                                                     ext_data_deleter, buffered_tensor));
+                                                     ext_data_deleter, verify_external_data_checksum,
+                                                     buffered_tensor));
 
       ExtDataValueDeleter deleter{ext_data_deleter, p_tensor.get()};
       MLDataType ml_tensor_type = DataTypeImpl::GetType<Tensor>();
@@ -163,7 +173,8 @@ static common::Status DeserializeTensorProto(const Env& env, const std::basic_st
       OrtCallback ext_data_deleter;
       std::optional<ScopedOrtCallbackInvoker> scoped_ort_callback_invoker;
       ORT_RETURN_IF_ERROR(ExtDataTensorProtoToTensor(env, proto_path, tensor_proto, *p_deserialize_tensor,
-                                                     ext_data_deleter, buffered_tensor));
+                                                     ext_data_deleter, verify_external_data_checksum,
+                                                     buffered_tensor));
       scoped_ort_callback_invoker = ScopedOrtCallbackInvoker(ext_data_deleter);
       // TODO!! Need a temp buffer allocator for non-escape buffers that maybe too big for stack allocation.
 
@@ -272,7 +283,8 @@ common::Status SaveInitializedTensors(
     const ExecutionPlanBase& exec_plan,
     const SessionOptions& session_options,
     const MemoryProfileFunction& memory_profile_func,
-    std::unordered_map<std::string, std::unique_ptr<Tensor>>& buffered_tensors) {
+    std::unordered_map<std::string, std::unique_ptr<Tensor>>& buffered_tensors,
+    InitializerDedupContext* dedup_context) {
   LOGS(logger, INFO) << "Saving initialized tensors.";
   ORT_ENFORCE(ort_value_name_idx_map.MaxIdx() > -1, "OrtValue indexes should have been populated.");
 
@@ -322,6 +334,100 @@ common::Status SaveInitializedTensors(
     id_to_initialized_tensor[ort_value_index] = entry.second;
   }
 
+  // When duplicate-initializer sharing is enabled, find constant CPU initializers whose bytes match
+  // an already materialized initializer - from this graph, or from an earlier finalized graph when
+  // the model has control flow - and alias them to that single buffer instead of planning,
+  // allocating and deserializing a second copy. Only embedded raw_data payloads of a meaningful
+  // size take part: external data on CPU is memory mapped and already page-shared by the OS, and
+  // small typed-field initializers are the ConstantSharing transformer's territory.
+  InlinedHashMap<int, OrtValue> cross_graph_aliases;  // ort value index -> canonical value
+  InlinedHashMap<int, int> local_aliases;             // ort value index -> representative's index
+  struct LocalRep {
+    // only valid during the scan below: save_tensor_func may free the proto later on
+    const ONNX_NAMESPACE::TensorProto* tensor_proto;
+    int ort_value_index;
+    // copied out of the proto for registering the representative once it is materialized
+    int32_t data_type;
+    InlinedVector<int64_t> dims;
+  };
+  InlinedHashMap<uint64_t, InlinedVector<LocalRep>> local_reps;  // keyed by content hash
+  if (dedup_context != nullptr) {
+    constexpr size_t kMinInitializerBytesToDedup = 1024;
+
+    for (const auto& entry : id_to_initialized_tensor) {
+      const int ort_value_index = entry.first;
+      const ONNX_NAMESPACE::TensorProto& tensor_proto = *entry.second;
+      const std::string& name = tensor_proto.name();
+
+      if (name.empty() ||
+          !tensor_proto.has_raw_data() ||
+          tensor_proto.raw_data().size() < kMinInitializerBytesToDedup ||
+          !graph.IsConstantInitializer(name, /*check_outer_scope*/ false) ||
+          user_supplied_initializer_ids.find(ort_value_index) != user_supplied_initializer_ids.end() ||
+          buffered_tensors.find(name) != buffered_tensors.end() ||
+          exec_plan.GetLocation(ort_value_index).Type() != OrtDevice::CPU) {
+        continue;
+      }
+#if !defined(DISABLE_SPARSE_TENSORS)
+      if (graph.GetGraph().IsSparseInitializer(name)) {
+        continue;
+      }
+#endif
+
+      const std::string& bytes = tensor_proto.raw_data();
+      const uint64_t content_hash = std::hash<std::string_view>{}(std::string_view{bytes});
+
+      auto dims_equal = [](const auto& a, const auto& b) {
+        return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin());
+      };
+
+      // a hash hit is only a candidate; aliasing requires the type, shape and bytes to match
+      bool aliased = false;
+      if (auto ctx_it = dedup_context->entries.find(content_hash); ctx_it != dedup_context->entries.end()) {
+        for (const auto& canonical : ctx_it->second) {
+          if (canonical.data_type == tensor_proto.data_type() &&
+              dims_equal(canonical.dims, tensor_proto.dims()) &&
+              canonical.value.Get<Tensor>().SizeInBytes() == bytes.size() &&
+              memcmp(canonical.value.Get<Tensor>().DataRaw(), bytes.data(), bytes.size()) == 0) {
+            cross_graph_aliases.emplace(ort_value_index, canonical.value);
+            aliased = true;
+            break;
+          }
+        }
+      }
+      if (!aliased) {
+        for (const auto& rep : local_reps[content_hash]) {
+          if (rep.tensor_proto->data_type() == tensor_proto.data_type() &&
+              dims_equal(rep.tensor_proto->dims(), tensor_proto.dims()) &&
+              rep.tensor_proto->raw_data() == bytes) {
+            local_aliases.emplace(ort_value_index, rep.ort_value_index);
+            aliased = true;
+            break;
+          }
+        }
+      }
+
+      if (aliased) {
+        dedup_context->shared_count += 1;
+        dedup_context->shared_bytes += bytes.size();
+      } else {
+        LocalRep rep{&tensor_proto, ort_value_index, tensor_proto.data_type(), {}};
+        rep.dims.assign(tensor_proto.dims().begin(), tensor_proto.dims().end());
+        local_reps[content_hash].push_back(std::move(rep));
+      }
+    }
+
+    if (!cross_graph_aliases.empty() || !local_aliases.empty()) {
+      LOGS(logger, INFO) << "Aliasing " << cross_graph_aliases.size() + local_aliases.size()
+                         << " duplicated initializers to shared buffers.";
+    }
+  }
+
+  auto is_aliased = [&cross_graph_aliases, &local_aliases](int ort_value_index) {
+    return cross_graph_aliases.find(ort_value_index) != cross_graph_aliases.end() ||
+           local_aliases.find(ort_value_index) != local_aliases.end();
+  };
+
   // tensors requiring a specific allocation order are traced first, to ensure they are allocated in order
   // NB1: vector with init allocation order may contain a subset of all tensors (or none at all)
   // NB2: only skip tracing and planning memory when data is external (i.e mmap) and on CPU.
@@ -331,7 +437,8 @@ common::Status SaveInitializedTensors(
     const auto entry = initialized_tensors_to_allocate.find(ort_value_index);
     ORT_ENFORCE(entry != initialized_tensors_to_allocate.end(),
                 "OrtValue index: ", ort_value_index, " from initializer_allocation_order not found among initialized tensors");
-    if (!(utils::HasExternalData(*entry->second) && exec_plan.GetLocation(ort_value_index).Type() == OrtDevice::CPU)) {
+    if (!is_aliased(ort_value_index) &&
+        !(utils::HasExternalData(*entry->second) && exec_plan.GetLocation(ort_value_index).Type() == OrtDevice::CPU)) {
       // can not trace string tensor
       ORT_ENFORCE(entry->second->data_type() != ONNX_NAMESPACE::TensorProto_DataType_STRING, "Can not trace string tensor");
       ORT_RETURN_IF_ERROR(planner.Trace(entry->first, entry->second));
@@ -344,6 +451,10 @@ common::Status SaveInitializedTensors(
     if (user_supplied_initializer_ids.find(entry.first) != user_supplied_initializer_ids.end()) {
       continue;
     }
+    // Duplicates alias an already planned buffer, so they need no allocation of their own.
+    if (is_aliased(entry.first)) {
+      continue;
+    }
     if (entry.second->data_type() == ONNX_NAMESPACE::TensorProto_DataType_STRING) {
       // do not trace string tensor
       continue;
@@ -367,6 +478,16 @@ common::Status SaveInitializedTensors(
 
   OrtCallback deleter{nullptr, nullptr};
 
+  // representatives that duplicates in this graph or in later finalized subgraphs will alias
+  InlinedHashSet<int> local_rep_indices;
+  for (const auto& reps : local_reps) {
+    for (const auto& rep : reps.second) {
+      local_rep_indices.insert(rep.ort_value_index);
+    }
+  }
+  InlinedHashMap<int, OrtValue> materialized_reps;
+  InlinedVector<int> deferred_local_aliases;
+
   // 3. create weight tensors based on weights buffer
   for (const auto& entry : id_to_initialized_tensor) {
     int ort_value_index = entry.first;
@@ -379,7 +500,14 @@ common::Status SaveInitializedTensors(
 
     OrtValue ort_value;
 
-    if (user_supplied_initializer_ids.find(entry.first) != user_supplied_initializer_ids.end()) {
+    if (auto alias_it = cross_graph_aliases.find(ort_value_index); alias_it != cross_graph_aliases.end()) {
+      // duplicate of an initializer materialized for an earlier finalized graph; share its buffer
+      ort_value = alias_it->second;
+    } else if (local_aliases.find(ort_value_index) != local_aliases.end()) {
+      // the representative lives in this graph but may not be materialized yet; resolve below
+      deferred_local_aliases.push_back(ort_value_index);
+      continue;
+    } else if (user_supplied_initializer_ids.find(entry.first) != user_supplied_initializer_ids.end()) {
       ort_value = *(session_options.initializers_to_share_map.at(name));
       LOGS(logger, INFO) << "Using user supplied initializer with name (" << name << ").";
     } else {
@@ -391,6 +519,8 @@ common::Status SaveInitializedTensors(
       ORT_RETURN_IF_ERROR(planner.GetPreallocatedBuffer(ort_value_index, name, m, alloc));
       bool use_device_allocator_for_initializers =
           session_options.config_options.GetConfigOrDefault(kOrtSessionOptionsUseDeviceAllocatorForInitializers, "0") == "1";
+      bool verify_external_data_checksum =
+          session_options.config_options.GetConfigOrDefault(kOrtSessionOptionsVerifyExternalDataChecksum, "0") == "1";
 
       Tensor* p_tensor = nullptr;
       if (auto iter = buffered_tensors.find(name);
@@ -401,7 +531,8 @@ common::Status SaveInitializedTensors(
 
       Status st = DeserializeTensorProto(env, graph_loc, tensor_proto, (m.has_value()) ? &*m : nullptr, alloc,
                                          default_cpu_alloc, ort_value, data_transfer_mgr, external_data_loader_mgr,
-                                         use_device_allocator_for_initializers, p_tensor);
+                                         use_device_allocator_for_initializers, verify_external_data_checksum,
+                                         p_tensor);
       if (!st.IsOK()) {
         std::ostringstream oss;
         oss << "Deserialize tensor " << name << " failed." << st.ErrorMessage();
@@ -409,6 +540,10 @@ common::Status SaveInitializedTensors(
       }
     }
 
+    if (local_rep_indices.find(ort_value_index) != local_rep_indices.end()) {
+      materialized_reps.emplace(ort_value_index, ort_value);
+    }
+
     // 'name' is a reference to a string within the TensorProto that save_tensor_func may free
     // so we need to output this message prior to calling save_tensor_func
     VLOGS(logger, 1) << "Adding weight with name : " << name << " with index: " << ort_value_index;
@@ -424,6 +559,35 @@ common::Status SaveInitializedTensors(
 #endif
   }
 
+  // duplicates whose representative lives in this graph alias its OrtValue now that every
+  // representative has been materialized
+  for (int ort_value_index : deferred_local_aliases) {
+    const ONNX_NAMESPACE::TensorProto& tensor_proto = *id_to_initialized_tensor.find(ort_value_index)->second;
+    const std::string& name = tensor_proto.name();
+    const OrtValue& ort_value = materialized_reps.find(local_aliases.find(ort_value_index)->second)->second;
+
+    VLOGS(logger, 1) << "Adding weight with name : " << name << " with index: " << ort_value_index
+                     << " as an alias of an identical initializer";
+
+    // eligibility above restricted aliasing to constant, non-sparse initializers
+    ORT_RETURN_IF_ERROR(save_tensor_func(name, ort_value_index, ort_value, deleter, /*constant*/ true,
+                                         /*sparse*/ false));
+  }
+
+  // register this graph's representatives so duplicates in subgraphs finalized later can alias them
+  if (dedup_context != nullptr) {
+    for (auto& reps : local_reps) {
+      for (auto& rep : reps.second) {
+        auto mat_it = materialized_reps.find(rep.ort_value_index);
+        if (mat_it == materialized_reps.end()) {
+          continue;
+        }
+        dedup_context->entries[reps.first].push_back(
+            InitializerDedupContext::Entry{mat_it->second, rep.data_type, std::move(rep.dims)});
+      }
+    }
+  }
+
   LOGS(logger, INFO) << "Done saving initialized tensors";
   return common::Status::OK();
 }
@@ -8,7 +8,9 @@
 #include <unordered_map>
 
 #include "core/common/const_pointer_container.h"
+#include "core/common/inlined_containers.h"
 #include "core/framework/allocator.h"
+#include "core/framework/ort_value.h"
 #include "core/framework/tensor.h"
 #include "core/framework/tensor_allocator.h"
 #include "core/framework/session_options.h"
@@ -38,6 +40,26 @@ using SaveTensorFunction = std::function<Status(const std::string& name, int idx
                                                 const OrtCallback& d, bool constant, bool sparse)>;
 using MemoryProfileFunction = std::function<void(ITensorAllocator& planner)>;
 
+// Content-addressed registry of initializers that have already been materialized as OrtValues.
+// When kOrtSessionOptionsShareDuplicateInitializers is enabled one instance is created per
+// FinalizeSessionState call and threaded through the subgraph recursion, so a weight embedded
+// several times - in the main graph or in control flow subgraphs - is loaded once and every
+// duplicate aliases the same buffer. Entries are keyed by a hash of the initializer bytes and
+// verified with a full type/shape/byte comparison before aliasing.
+struct InitializerDedupContext {
+  struct Entry {
+    OrtValue value;  // CPU tensor holding the canonical copy
+    int32_t data_type;
+    InlinedVector<int64_t> dims;
+  };
+
+  InlinedHashMap<uint64_t, InlinedVector<Entry>> entries;
+
+  // running totals across the main graph and all subgraphs, for logging
+  size_t shared_count{0};
+  size_t shared_bytes{0};
+};
+
 common::Status SaveInitializedTensors(
     const Env& env, const std::basic_string<PATH_CHAR_TYPE>& graph_loc,
     const GraphViewer& graph, const AllocatorPtr& default_cpu_memory_info,
@@ -50,7 +72,8 @@ common::Status SaveInitializedTensors(
     const ExecutionPlanBase& exec_plan,
     const SessionOptions& session_options,
     const MemoryProfileFunction& memory_profile_func,
-    std::unordered_map<std::string, std::unique_ptr<Tensor>>& buffered_tensors);
+    std::unordered_map<std::string, std::unique_ptr<Tensor>>& buffered_tensors,
+    InitializerDedupContext* dedup_context = nullptr);
 
 common::Status AllocateTensor(
     const onnxruntime::MemBuffer* m,
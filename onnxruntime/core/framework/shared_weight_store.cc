@@ -0,0 +1,75 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/shared_weight_store.h"
+
+#if !defined(ORT_MINIMAL_BUILD)
+
+#include <utility>
+
+#include "core/framework/mem_buffer.h"
+#include "core/framework/session_options.h"
+#include "core/framework/tensorprotoutils.h"
+#include "core/graph/model.h"
+#include "core/graph/onnx_protobuf.h"
+#include "core/platform/env.h"
+
+namespace onnxruntime {
+
+SharedWeightStore::SharedWeightStore() : allocator_(std::make_shared<CPUAllocator>()) {
+}
+
+Status SharedWeightStore::Load(const PathString& model_path) {
+  ONNX_NAMESPACE::ModelProto model_proto;
+  ORT_RETURN_IF_ERROR(Model::Load(model_path, model_proto));
+  return Load(model_proto, std::filesystem::path(model_path));
+}
+
+Status SharedWeightStore::Load(const ONNX_NAMESPACE::ModelProto& model_proto,
+                               const std::filesystem::path& model_path) {
+  ORT_RETURN_IF_NOT(weights_.empty(), "SharedWeightStore::Load may only be called once.");
+
+  const auto& graph_proto = model_proto.graph();
+  buffers_.reserve(graph_proto.initializer_size());
+  weights_.reserve(graph_proto.initializer_size());
+
+  const OrtMemoryInfo& memory_info = allocator_->Info();
+  for (const auto& tensor_proto : graph_proto.initializer()) {
+    // String tensors need per-element allocations and can't be handed out as a flat
+    // buffer; sessions keep their own copy of those.
+    if (tensor_proto.data_type() == ONNX_NAMESPACE::TensorProto_DataType_STRING) {
+      continue;
+    }
+
+    size_t size_in_bytes = 0;
+    ORT_RETURN_IF_ERROR(utils::GetSizeInBytesFromTensorProto(tensor_proto, &size_in_bytes));
+    IAllocatorUniquePtr<void> buffer = IAllocator::MakeUniquePtr<void>(allocator_, size_in_bytes);
+
+    OrtValue value;
+    ORT_RETURN_IF_ERROR(utils::TensorProtoToOrtValue(Env::Default(), model_path, tensor_proto,
+                                                     MemBuffer(buffer.get(), size_in_bytes, memory_info),
+                                                     value));
+
+    ORT_RETURN_IF_NOT(weights_.emplace(tensor_proto.name(), std::move(value)).second,
+                      "Duplicate initializer name in model: ", tensor_proto.name());
+    buffers_.push_back(std::move(buffer));
+  }
+
+  return Status::OK();
+}
+
+Status SharedWeightStore::AddToSessionOptions(SessionOptions& session_options) const {
+  for (const auto& [name, value] : weights_) {
+    ORT_RETURN_IF_ERROR(session_options.AddInitializer(name.c_str(), &value));
+  }
+  return Status::OK();
+}
+
+const OrtValue* SharedWeightStore::GetWeight(const std::string& name) const {
+  auto it = weights_.find(name);
+  return it == weights_.end() ? nullptr : &it->second;
+}
+
+}  // namespace onnxruntime
+
+#endif  // !defined(ORT_MINIMAL_BUILD)
@@ -0,0 +1,77 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#if !defined(ORT_MINIMAL_BUILD)
+
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "core/common/common.h"
+#include "core/common/path_string.h"
+#include "core/framework/allocator.h"
+#include "core/framework/ort_value.h"
+
+namespace ONNX_NAMESPACE {
+class ModelProto;
+}
+
+namespace onnxruntime {
+
+struct SessionOptions;
+
+// Loads a model's initializers once into CPU memory so that many sessions running the
+// same model can reference a single copy of the weights instead of each deserializing
+// their own. This is the model-wide form of SessionOptions::AddInitializer: the store
+// owns the weight buffers and hands out non-owning OrtValue views, and
+// AddToSessionOptions() registers every loaded weight with a SessionOptions so a
+// session created from it adopts the shared copies during initialization (see
+// SaveInitializedTensors in session_state_utils.cc). Because sessions reference the
+// store's buffers directly, the store must outlive every session created with it.
+class SharedWeightStore final {
+ public:
+  SharedWeightStore();
+
+  ~SharedWeightStore() = default;
+
+  // Loads every dense, non-string initializer of the main graph of the model at
+  // 'model_path' into memory owned by this store. May only be called once.
+  Status Load(const PathString& model_path);
+
+  // Same, from an already parsed ModelProto. 'model_path' is the path the model was
+  // loaded from and is used to resolve external data; it may be empty if the model
+  // has no external data.
+  Status Load(const ONNX_NAMESPACE::ModelProto& model_proto,
+              const std::filesystem::path& model_path);
+
+  // Registers every loaded weight with 'session_options' via AddInitializer.
+  // May be called for any number of SessionOptions instances; each session created
+  // from them shares the store's single copy of the weights.
+  Status AddToSessionOptions(SessionOptions& session_options) const;
+
+  // Returns the loaded weight with the given name, or nullptr if there is none.
+  const OrtValue* GetWeight(const std::string& name) const;
+
+  // Returns the number of loaded weights.
+  size_t GetNumberOfWeights() const { return weights_.size(); }
+
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(SharedWeightStore);
+
+ private:
+  // Define the allocator ahead of the buffers it backs so the buffers are freed
+  // before it is destructed.
+  AllocatorPtr allocator_;
+
+  // The raw buffers backing the weights. The OrtValues view this memory without
+  // owning it, which is what SessionOptions::AddInitializer requires.
+  std::vector<IAllocatorUniquePtr<void>> buffers_;
+
+  std::unordered_map<std::string, OrtValue> weights_;
+};
+
+}  // namespace onnxruntime
+
+#endif  // !defined(ORT_MINIMAL_BUILD)
@@ -51,6 +51,8 @@ StreamExecutionContext::StreamExecutionContext(const SessionState& sess_state,
 #pragma warning(pop)
 #endif
 
+  offload_staging_values_.resize(sess_state.GetExecutionPlan()->num_offload_slots);
+
   // init barriers
   for (size_t i = 0; i < num_barriers; ++i) {
     count_down_barriers_[i].Set(2);
@@ -173,6 +175,48 @@ void StreamExecutionContext::RecycleNodeInputs(onnxruntime::NodeIndex node_index
   }
 }
 
+void StreamExecutionContext::SetOutputReadyCallback(const RunOptions::OutputReadyCallback& callback,
+                                                    gsl::span<const int> fetch_mlvalue_idxs) {
+  if (!callback) {
+    return;
+  }
+
+  const auto& name_idx_map = session_state_->GetOrtValueNameIdxMap();
+  const auto& graph_viewer = session_state_->GetGraphViewer();
+  for (int fetch_mlvalue_idx : fetch_mlvalue_idxs) {
+    std::string name;
+    if (!name_idx_map.GetName(fetch_mlvalue_idx, name).IsOK()) {
+      continue;
+    }
+    // outputs without a producing node (fed-through inputs, constant initializers) are not
+    // streamed; they are available to the caller when Run() returns
+    const Node* producer = graph_viewer.GetProducerNode(name);
+    if (producer == nullptr) {
+      continue;
+    }
+    node_to_ready_fetches_[producer->Index()].emplace_back(fetch_mlvalue_idx, std::move(name));
+  }
+
+  if (!node_to_ready_fetches_.empty()) {
+    output_ready_callback_ = callback;
+  }
+}
+
+void StreamExecutionContext::NotifyOutputsReady(onnxruntime::NodeIndex node_index) {
+  if (!output_ready_callback_) {
+    return;
+  }
+
+  auto it = node_to_ready_fetches_.find(node_index);
+  if (it == node_to_ready_fetches_.end()) {
+    return;
+  }
+
+  for (const auto& [fetch_mlvalue_idx, name] : it->second) {
+    output_ready_callback_(name, frame_.GetMLValue(fetch_mlvalue_idx));
+  }
+}
+
 void RunSince(size_t stream_idx, StreamExecutionContext& ctx, SessionScope& session_scope, const bool& terminate_flag, size_t since) {
   if (!ctx.TaskStatus().IsOK()) {
     // already in bad status, terminate it
@@ -216,6 +260,12 @@ void RunSince(size_t stream_idx, StreamExecutionContext& ctx, SessionScope& sess
       ctx.CompleteTask();
       return;
     }
+    if (ctx.DeadlineExpired()) {
+      Status status_made = ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Exiting due to the run deadline being exceeded.");
+      ctx.SetStatus(status_made);
+      ctx.CompleteTask();
+      return;
+    }
     bool continue_flag = true;
     Status status;
     ORT_TRY {
@@ -6,10 +6,12 @@
 #include "core/framework/execution_frame.h"
 #include "core/framework/ort_value.h"
 #include "core/framework/iexecutor.h"
+#include "core/framework/run_options.h"
 #include "core/framework/stream_handles.h"
 #include "core/graph/basic_types.h"
 #include "core/common/inlined_containers.h"
 #include "core/framework/memory_info.h"
+#include <chrono>
 #ifdef ENABLE_TRAINING
 #include "core/framework/partial_graph_execution_state.h"
 #endif
@@ -116,6 +118,48 @@ class StreamExecutionContext {
   // Release the OrtValues after a step, based on the execution plan.
   void RecycleNodeInputs(onnxruntime::NodeIndex node_index);
 
+  // Host staging value for an activation the plan offloads (see OffloadToHostStep /
+  // PrefetchFromHostStep). Slots are assigned by the planner, one per offloaded value, and the
+  // offload and prefetch for a slot run on the same logic stream so no locking is needed.
+  OrtValue& GetOffloadStagingValue(size_t slot) {
+    return offload_staging_values_[slot];
+  }
+
+  // Set the per-output streaming callback (see RunOptions::output_ready_callback) and record which
+  // node produces each requested fetch. No-op when the callback is empty.
+  void SetOutputReadyCallback(const RunOptions::OutputReadyCallback& callback,
+                              gsl::span<const int> fetch_mlvalue_idxs);
+
+  // Fire the streaming callback for any requested fetch produced by the given node.
+  // Called by ExecuteKernel after the kernel completed successfully.
+  void NotifyOutputsReady(onnxruntime::NodeIndex node_index);
+
+  // Set the deadline for this run (see kOrtRunOptionsConfigDeadlineMs).
+  // steady_clock::time_point::max() means no deadline.
+  void SetDeadline(std::chrono::steady_clock::time_point deadline) {
+    deadline_ = deadline;
+  }
+
+  std::chrono::steady_clock::time_point GetDeadline() const {
+    return deadline_;
+  }
+
+  // Returns true if a deadline is set and has passed. Does not read the clock when no deadline is set.
+  bool DeadlineExpired() const {
+    return deadline_ != std::chrono::steady_clock::time_point::max() &&
+           std::chrono::steady_clock::now() >= deadline_;
+  }
+
+  // Set the intra-op degree-of-parallelism cap for this run
+  // (see kOrtRunOptionsConfigIntraOpMaxDegreeOfParallelism). 0 means no cap.
+  void SetIntraOpDegreeOfParallelismCap(int cap) {
+    intra_op_dop_cap_ = cap;
+  }
+
+  int GetIntraOpDegreeOfParallelismCap() const {
+    return intra_op_dop_cap_;
+  }
+
 #ifdef ENABLE_TRAINING
   void SetOrtValueCache(OrtValueCachePtr cache) {
     cache_ = std::move(cache);
@@ -156,10 +200,20 @@ class StreamExecutionContext {
 
   std::unique_ptr<std::atomic_int[]> release_plan_;
 
+  // indexed by the staging slots the planner assigned to offloaded activations. Entries stay
+  // alive until the run completes so asynchronous copies back to the device can finish.
+  InlinedVector<OrtValue> offload_staging_values_;
+
   CountDownBarrier remain_tasks_;
 
   Status task_status_{Status::OK()};
 
+  RunOptions::OutputReadyCallback output_ready_callback_;
+
+  // producing node -> (ort value index, output name) of the requested fetches, only populated
+  // when output_ready_callback_ is set.
+  InlinedHashMap<NodeIndex, InlinedVector<std::pair<int, std::string>>> node_to_ready_fetches_;
+
 #ifdef ENABLE_TRAINING
   const ProgramRegion* program_range_{nullptr};
 
@@ -169,6 +223,10 @@ class StreamExecutionContext {
   // Should we deprecate it?
   const InlinedHashSet<NodeIndex>* node_to_execute_{nullptr};
 #endif
+  std::chrono::steady_clock::time_point deadline_{std::chrono::steady_clock::time_point::max()};
+
+  int intra_op_dop_cap_{0};
+
   const bool single_thread_mode_;
 
 #ifdef ORT_ENABLE_STREAM
@@ -0,0 +1,129 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/subgraph_result_cache.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include "core/framework/murmurhash3.h"
+#include "core/framework/tensor.h"
+
+namespace onnxruntime {
+
+bool SubgraphResultCache::FingerprintFeeds(gsl::span<const OrtValue> feeds, Fingerprint& fingerprint) {
+  uint32_t hash[4] = {0, 0, 0, 0};
+
+  // chain the hash across buffers, re-seeding with the previous value as PrePackedWeights::GetHash does.
+  // MurmurHash3 takes an int length, so walk very large tensors in chunks.
+  auto hash_buffer = [&hash](const void* data, size_t len) {
+    const auto* bytes = static_cast<const char*>(data);
+    while (len > 0) {
+      const size_t chunk = std::min(len, static_cast<size_t>(std::numeric_limits<int>::max()));
+      MurmurHash3::x86_128(bytes, static_cast<int>(chunk), hash[0], &hash);
+      bytes += chunk;
+      len -= chunk;
+    }
+  };
+
+  for (const OrtValue& feed : feeds) {
+    if (!feed.IsAllocated() || !feed.IsTensor()) {
+      return false;
+    }
+
+    const auto& tensor = feed.Get<Tensor>();
+    if (tensor.Location().device.Type() != OrtDevice::CPU || tensor.IsDataTypeString()) {
+      return false;
+    }
+
+    const int32_t elem_type = tensor.GetElementType();
+    hash_buffer(&elem_type, sizeof(elem_type));
+
+    const auto dims = tensor.Shape().GetDims();
+    if (!dims.empty()) {
+      hash_buffer(dims.data(), dims.size() * sizeof(int64_t));
+    }
+
+    if (tensor.SizeInBytes() > 0) {
+      hash_buffer(tensor.DataRaw(), tensor.SizeInBytes());
+    }
+  }
+
+  static_assert(sizeof(hash) == sizeof(Fingerprint), "fingerprint must hold the full 128-bit hash");
+  memcpy(fingerprint.data(), hash, sizeof(hash));
+  return true;
+}
+
+std::optional<InlinedVector<OrtValue>> SubgraphResultCache::Lookup(const Fingerprint& fingerprint) {
+  std::lock_guard<OrtMutex> lock(mutex_);
+
+  for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+    if (it->first == fingerprint) {
+      entries_.splice(entries_.begin(), entries_, it);
+      return entries_.front().second;
+    }
+  }
+
+  return std::nullopt;
+}
+
+void SubgraphResultCache::Store(const Fingerprint& fingerprint, gsl::span<const OrtValue> fetches) {
+  InlinedVector<OrtValue> copies;
+  copies.reserve(fetches.size());
+
+  // copy outside of the lock. the frame-owned fetches may alias memory that a later run reuses,
+  // so the cache keeps its own buffers.
+  for (const OrtValue& fetch : fetches) {
+    if (!fetch.IsAllocated() || !fetch.IsTensor()) {
+      return;
+    }
+
+    const auto& src = fetch.Get<Tensor>();
+    if (src.Location().device.Type() != OrtDevice::CPU || src.IsDataTypeString()) {
+      return;
+    }
+
+    OrtValue copy;
+    Tensor::InitOrtValue(src.DataType(), src.Shape(), allocator_, copy);
+    if (src.SizeInBytes() > 0) {
+      memcpy(copy.GetMutable<Tensor>()->MutableDataRaw(), src.DataRaw(), src.SizeInBytes());
+    }
+
+    copies.push_back(std::move(copy));
+  }
+
+  std::lock_guard<OrtMutex> lock(mutex_);
+
+  for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+    if (it->first == fingerprint) {
+      // a concurrent execution stored the same results while we were copying; keep the existing
+      // entry and just refresh its position.
+      entries_.splice(entries_.begin(), entries_, it);
+      return;
+    }
+  }
+
+  entries_.emplace_front(fingerprint, std::move(copies));
+  if (entries_.size() > max_entries_) {
+    entries_.pop_back();
+  }
+}
+
+size_t SubgraphResultCache::EvictAll() {
+  std::lock_guard<OrtMutex> lock(mutex_);
+
+  size_t released = 0;
+  for (const auto& entry : entries_) {
+    for (const OrtValue& output : entry.second) {
+      if (output.IsAllocated() && output.IsTensor()) {
+        released += output.Get<Tensor>().SizeInBytes();
+      }
+    }
+  }
+
+  entries_.clear();
+  return released;
+}
+
+}  // namespace onnxruntime
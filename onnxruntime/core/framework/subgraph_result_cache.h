@@ -0,0 +1,69 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <array>
+#include <list>
+#include <optional>
+
+#include <gsl/gsl>
+
+#include "core/common/common.h"
+#include "core/common/inlined_containers.h"
+#include "core/framework/allocator.h"
+#include "core/framework/ort_value.h"
+#include "core/platform/ort_mutex.h"
+
+namespace onnxruntime {
+
+/**
+ * Opt-in LRU cache of the outputs of pure control-flow subgraphs, keyed by a 128-bit content
+ * fingerprint of the feeds. Enabled with kOrtSessionOptionsEnableSubgraphMemoization; one
+ * instance is owned per subgraph SessionState so the 'then' and 'else' bodies of an If node
+ * never share entries.
+ *
+ * Cached outputs are deep copies allocated from the session's CPU allocator (the arena when one
+ * is enabled), never the execution frame's OrtValues, whose buffers are reused by later runs.
+ * Matching is by fingerprint only, so a hash collision would return the wrong outputs; the
+ * feature is off by default for that reason. Thread-safe.
+ */
+class SubgraphResultCache {
+ public:
+  SubgraphResultCache(AllocatorPtr allocator, size_t max_entries)
+      : allocator_(std::move(allocator)), max_entries_(max_entries) {}
+
+  using Fingerprint = std::array<uint64_t, 2>;
+
+  /// Computes a content fingerprint of the feeds covering the element type, shape and raw bytes
+  /// of every tensor. Returns false when a feed cannot be fingerprinted (a non-tensor or
+  /// string tensor, or data that is not in CPU accessible memory).
+  static bool FingerprintFeeds(gsl::span<const OrtValue> feeds, Fingerprint& fingerprint);
+
+  /// Returns copies of the cached output values, or nullopt on a miss. The returned OrtValues
+  /// share the cache-owned buffers and remain valid if the entry is evicted afterwards.
+  std::optional<InlinedVector<OrtValue>> Lookup(const Fingerprint& fingerprint);
+
+  /// Deep-copies the fetches into cache-owned buffers and stores them under the fingerprint,
+  /// evicting the least recently used entry when the cache is full. A no-op when any fetch is
+  /// not an allocated CPU tensor or holds strings.
+  void Store(const Fingerprint& fingerprint, gsl::span<const OrtValue> fetches);
+
+  /// Drops every cached entry and returns the number of tensor bytes that were cached. Later
+  /// subgraph executions repopulate the cache. Used as an eviction callback under memory
+  /// pressure; see SessionMemoryBudget.
+  size_t EvictAll();
+
+ private:
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(SubgraphResultCache);
+
+  AllocatorPtr allocator_;
+  size_t max_entries_;
+
+  OrtMutex mutex_;
+  // most recently used entry at the front. the cache is sized for a handful of entries
+  // (kOrtSessionOptionsSubgraphMemoizationMaxEntries), so a linear scan is fine.
+  std::list<std::pair<Fingerprint, InlinedVector<OrtValue>>> entries_;
+};
+
+}  // namespace onnxruntime
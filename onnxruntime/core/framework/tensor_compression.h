@@ -0,0 +1,52 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstdint>
+
+#include "core/common/common.h"
+#include "core/framework/allocator.h"
+
+namespace onnxruntime {
+
+/**
+ * Block based zero suppression codec for tensor payloads.
+ *
+ * The payload is split into 32 byte blocks. A bitmap holds one bit per block
+ * (set when the block contains any non-zero byte) followed by the non-zero
+ * blocks stored verbatim; a tail shorter than a block is always stored
+ * verbatim. Both directions run at memcmp/memcpy speed, so the codec costs a
+ * fraction of the copy it replaces and vectorizes without explicit
+ * intrinsics.
+ *
+ * This wins on payloads with zero runs of at least a block - padded
+ * activations, masked regions, sparse state - and leaves dense data slightly
+ * larger than the input (the bitmap, ~0.4%). Callers are expected to measure
+ * the achieved ratio and keep the original bytes when compression does not
+ * pay; see the scan output handling in the Loop kernel.
+ */
+class CompressedTensorData {
+ public:
+  CompressedTensorData() = default;
+
+  /**
+   * Compresses size_bytes bytes at src, replacing the contents of out.
+   * The compressed buffer is allocated from the given allocator.
+   */
+  static Status Compress(const void* src, size_t size_bytes, const AllocatorPtr& allocator,
+                         CompressedTensorData& out);
+
+  /** Reconstructs the original bytes. dst_size_bytes must match the compressed payload's size. */
+  Status Decompress(void* dst, size_t dst_size_bytes) const;
+
+  size_t CompressedSizeBytes() const { return compressed_size_; }
+  size_t UncompressedSizeBytes() const { return uncompressed_size_; }
+
+ private:
+  IAllocatorUniquePtr<uint8_t> buffer_;
+  size_t compressed_size_{0};
+  size_t uncompressed_size_{0};
+};
+
+}  // namespace onnxruntime
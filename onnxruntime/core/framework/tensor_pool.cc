@@ -0,0 +1,85 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/tensor_pool.h"
+
+namespace onnxruntime {
+
+TensorPoolAllocator::TensorPoolAllocator(AllocatorPtr upstream)
+    : IAllocator(upstream->Info()), upstream_(std::move(upstream)) {
+}
+
+TensorPoolAllocator::~TensorPoolAllocator() {
+  // Live tensors hold a shared_ptr to this allocator, so by the time the destructor runs only
+  // cached buffers remain.
+  Clear();
+}
+
+size_t TensorPoolAllocator::BucketOf(size_t size) {
+  size_t bucket = kMinBucketSize;
+  while (bucket < size) {
+    bucket <<= 1;
+  }
+  return bucket;
+}
+
+void* TensorPoolAllocator::Alloc(size_t size) {
+  if (size == 0) {
+    return nullptr;
+  }
+
+  size_t bucket = BucketOf(size);
+  {
+    std::lock_guard<OrtMutex> lock(mutex_);
+    auto it = free_buffers_.find(bucket);
+    if (it != free_buffers_.end() && !it->second.empty()) {
+      void* p = it->second.back();
+      it->second.pop_back();
+      live_buffers_.emplace(p, bucket);
+      return p;
+    }
+  }
+
+  // Allocate the full bucket so the buffer is reusable for any request that maps to it.
+  void* p = upstream_->Alloc(bucket);
+  if (p != nullptr) {
+    std::lock_guard<OrtMutex> lock(mutex_);
+    live_buffers_.emplace(p, bucket);
+  }
+  return p;
+}
+
+void TensorPoolAllocator::Free(void* p) {
+  if (p == nullptr) {
+    return;
+  }
+
+  {
+    std::lock_guard<OrtMutex> lock(mutex_);
+    auto it = live_buffers_.find(p);
+    if (it != live_buffers_.end()) {
+      free_buffers_[it->second].push_back(p);
+      live_buffers_.erase(it);
+      return;
+    }
+  }
+
+  // Not one of ours (should not happen); hand it to the upstream allocator rather than leak it.
+  upstream_->Free(p);
+}
+
+void TensorPoolAllocator::Clear() {
+  std::unordered_map<size_t, std::vector<void*>> cached;
+  {
+    std::lock_guard<OrtMutex> lock(mutex_);
+    cached.swap(free_buffers_);
+  }
+
+  for (auto& bucket : cached) {
+    for (void* p : bucket.second) {
+      upstream_->Free(p);
+    }
+  }
+}
+
+}  // namespace onnxruntime
@@ -0,0 +1,51 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include "core/framework/allocator.h"
+#include "core/platform/ort_mutex.h"
+
+namespace onnxruntime {
+
+// Size-bucketed buffer pool behind the OrtTensorPool C API object. Serving callers allocate
+// input/output tensors of the same handful of shapes on every request; this allocator keeps
+// freed buffers in per-bucket free lists (bucketed by byte size, rounded up to a power of two)
+// and hands them back on the next allocation instead of going through the upstream allocator.
+// Recycled buffers are returned as-is: they are not zeroed, so reuse costs neither a memset nor
+// a page fault.
+//
+// Tensors created from the pool hold a shared_ptr to this allocator, so the pool's memory stays
+// valid until the last pooled tensor is released, even if the OrtTensorPool handle is released
+// first.
+class TensorPoolAllocator : public IAllocator {
+ public:
+  explicit TensorPoolAllocator(AllocatorPtr upstream);
+  ~TensorPoolAllocator() override;
+
+  void* Alloc(size_t size) override;
+  void Free(void* p) override;
+
+  void GetStats(AllocatorStats* stats) override { upstream_->GetStats(stats); }
+
+  // Returns all cached (currently unused) buffers to the upstream allocator. Buffers backing
+  // live tensors are unaffected; they rejoin the pool when those tensors are released.
+  void Clear();
+
+ private:
+  // Smallest bucket. Requests below this are rounded up to it so a few distinct small shapes
+  // share one free list.
+  static constexpr size_t kMinBucketSize = 256;
+
+  static size_t BucketOf(size_t size);
+
+  AllocatorPtr upstream_;
+  OrtMutex mutex_;
+  std::unordered_map<size_t, std::vector<void*>> free_buffers_;  // bucket byte size -> buffers
+  std::unordered_map<void*, size_t> live_buffers_;               // outstanding buffer -> bucket byte size
+};
+
+}  // namespace onnxruntime
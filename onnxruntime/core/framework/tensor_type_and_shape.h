@@ -17,6 +17,10 @@ namespace onnxruntime {
 class DataTypeImpl;
 }
 
+// Maps an ORT data type to the C API element type enum.
+// Returns ONNX_TENSOR_ELEMENT_DATA_TYPE_UNDEFINED for non-primitive types.
+ONNXTensorElementDataType MLDataTypeToOnnxRuntimeTensorElementDataType(const onnxruntime::DataTypeImpl* cpp_type);
+
 struct OrtTensorTypeAndShapeInfo {
  public:
   ONNXTensorElementDataType type = ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT;
@@ -13,6 +13,7 @@
 #endif
 
 #include <gsl/gsl>
+#include "core/common/crc32c.h"
 #include "core/common/logging/logging.h"
 #include "core/common/narrow.h"
 #include "core/common/span_utils.h"
@@ -1048,6 +1049,31 @@ Status GetExtDataFromTensorProto(const Env& env, const std::filesystem::path& mo
   return Status::OK();
 }
 
+Status VerifyExternalDataChecksum(const ONNX_NAMESPACE::TensorProto& tensor_proto,
+                                  const void* data, size_t length) {
+  std::unique_ptr<onnxruntime::ExternalDataInfo> external_data_info;
+  ORT_RETURN_IF_ERROR(onnxruntime::ExternalDataInfo::Create(tensor_proto.external_data(), external_data_info));
+
+  const std::string& checksum = external_data_info->GetChecksum();
+  if (checksum.empty()) {
+    return Status::OK();
+  }
+
+  // the checksum is the CRC32C of the data segment, as eight hex digits
+  char* end;
+  const unsigned long expected = strtoul(checksum.c_str(), &end, 16);
+  ORT_RETURN_IF(end != checksum.c_str() + checksum.length() || checksum.length() > 8,
+                "TensorProto: ", tensor_proto.name(),
+                " has an external data checksum that is not a CRC32C hex value: ", checksum);
+
+  const uint32_t actual = ComputeCrc32c(data, length);
+  ORT_RETURN_IF(static_cast<uint32_t>(expected) != actual,
+                "TensorProto: ", tensor_proto.name(), " external data checksum mismatch. Expected: ", checksum,
+                ", computed: ", actual, ". The weight file is corrupt or does not match the model.");
+
+  return Status::OK();
+}
+
 Status LoadExtDataToTensorFromTensorProto(const Env& env, const std::filesystem::path& model_path,
                                           const ONNX_NAMESPACE::TensorProto& tensor_proto,
                                           const IExternalDataLoader& ext_data_loader,
@@ -160,6 +160,12 @@ common::Status GetExtDataFromTensorProto(const Env& env, const std::filesystem::
                                          OrtCallback& ext_data_deleter,
                                          Tensor* buffered_tensor = nullptr);
 
+// Verifies the CRC32C checksum recorded in the "checksum" entry of the tensor proto's external
+// data against the loaded bytes. Returns OK when no checksum is recorded. Intended to run right
+// after the external data is read, while the pages are still warm.
+common::Status VerifyExternalDataChecksum(const ONNX_NAMESPACE::TensorProto& tensor_proto,
+                                          const void* data, size_t length);
+
 // Given a tensor proto with external data obtain a tensor using the specified custom external data loader.
 common::Status LoadExtDataToTensorFromTensorProto(const Env& env, const std::filesystem::path& model_path,
                                                   const ONNX_NAMESPACE::TensorProto& tensor_proto,
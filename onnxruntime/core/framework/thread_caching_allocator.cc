@@ -0,0 +1,174 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/thread_caching_allocator.h"
+
+#include <array>
+#include <limits>
+#include <unordered_map>
+
+#include "core/common/inlined_containers.h"
+
+namespace onnxruntime {
+
+namespace {
+
+// Size classes are powers of two covering [kMinCachedSize, kMaxCachedSize].
+constexpr size_t kNumSizeClasses = 5;  // 256, 512, 1024, 2048, 4096
+
+// The header precedes every block handed out by the wrapper and records the size class so
+// Free() can route the block without a lookup in the upstream allocator. It is kAllocAlignment
+// bytes so the payload keeps the alignment the upstream allocator guarantees.
+constexpr size_t kHeaderSize = kAllocAlignment;
+
+// Size class marker for blocks that bypassed the caches (large allocations and Reserve() calls).
+constexpr uint32_t kUncached = std::numeric_limits<uint32_t>::max();
+
+size_t ClassSize(size_t size_class) {
+  return ThreadCachingAllocator::kMinCachedSize << size_class;
+}
+
+// Returns the smallest size class whose payload fits 'size', or -1 if the request is too large
+// to cache.
+int SizeClassFor(size_t size) {
+  if (size > ThreadCachingAllocator::kMaxCachedSize) {
+    return -1;
+  }
+
+  int size_class = 0;
+  while (ClassSize(size_class) < size) {
+    ++size_class;
+  }
+
+  return size_class;
+}
+
+uint32_t ReadHeader(void* block) {
+  return *reinterpret_cast<const uint32_t*>(block);
+}
+
+void* AttachHeader(void* block, uint32_t size_class) {
+  if (block == nullptr) {
+    return nullptr;
+  }
+
+  *reinterpret_cast<uint32_t*>(block) = size_class;
+  return static_cast<char*>(block) + kHeaderSize;
+}
+
+struct ThreadCache {
+  // Keeps the upstream allocator alive while this thread still holds blocks carved out of it,
+  // even if the ThreadCachingAllocator itself has been destroyed.
+  AllocatorPtr upstream;
+  std::array<InlinedVector<void*, ThreadCachingAllocator::kMaxBlocksPerClass>, kNumSizeClasses> free_lists;
+
+  ThreadCache() = default;
+  ThreadCache(const ThreadCache&) = delete;
+  ThreadCache& operator=(const ThreadCache&) = delete;
+
+  ~ThreadCache() {
+    Flush();
+  }
+
+  void Flush() {
+    for (auto& free_list : free_lists) {
+      for (void* block : free_list) {
+        upstream->Free(block);
+      }
+      free_list.clear();
+    }
+  }
+};
+
+// Per-thread caches keyed by allocator id. Entries are flushed and dropped when the thread
+// exits, and lazily when a lookup notices the owning allocator is gone (the cache then holds
+// the last reference to the upstream allocator).
+ThreadCache& GetThreadCache(uint64_t id, const AllocatorPtr& upstream) {
+  thread_local std::unordered_map<uint64_t, ThreadCache> caches;
+
+  auto it = caches.find(id);
+  if (it == caches.end()) {
+    // Creating an entry for a new allocator is a good time to drop caches that are only keeping
+    // a dead allocator's memory alive, so a long-lived thread serving many sessions doesn't pin
+    // the arenas of sessions that have been released.
+    for (auto cur = caches.begin(); cur != caches.end();) {
+      if (cur->second.upstream.use_count() == 1) {
+        cur = caches.erase(cur);
+      } else {
+        ++cur;
+      }
+    }
+
+    it = caches.try_emplace(id).first;
+    it->second.upstream = upstream;
+  }
+
+  return it->second;
+}
+
+}  // namespace
+
+ThreadCachingAllocator::ThreadCachingAllocator(AllocatorPtr upstream)
+    : IAllocator(OrtMemoryInfo(upstream->Info().name,
+                               // report OrtDeviceAllocator so callers don't take the arena-only
+                               // paths (e.g. casting to BFCArena) through this wrapper
+                               OrtAllocatorType::OrtDeviceAllocator,
+                               upstream->Info().device,
+                               upstream->Info().id,
+                               upstream->Info().mem_type)),
+      upstream_(std::move(upstream)) {
+  static std::atomic<uint64_t> counter{0};
+  id_ = ++counter;
+}
+
+void* ThreadCachingAllocator::Alloc(size_t size) {
+  if (size == 0) {
+    return nullptr;
+  }
+
+  const int size_class = SizeClassFor(size);
+  if (size_class < 0) {
+    return AttachHeader(upstream_->Alloc(size + kHeaderSize), kUncached);
+  }
+
+  auto& free_list = GetThreadCache(id_, upstream_).free_lists[size_class];
+  if (!free_list.empty()) {
+    void* block = free_list.back();
+    free_list.pop_back();
+    // the header survives from the previous use of the block
+    return static_cast<char*>(block) + kHeaderSize;
+  }
+
+  return AttachHeader(upstream_->Alloc(ClassSize(size_class) + kHeaderSize),
+                      static_cast<uint32_t>(size_class));
+}
+
+void ThreadCachingAllocator::Free(void* p) {
+  if (p == nullptr) {
+    return;
+  }
+
+  void* block = static_cast<char*>(p) - kHeaderSize;
+  const uint32_t size_class = ReadHeader(block);
+  if (size_class == kUncached) {
+    upstream_->Free(block);
+    return;
+  }
+
+  auto& free_list = GetThreadCache(id_, upstream_).free_lists[size_class];
+  if (free_list.size() >= kMaxBlocksPerClass) {
+    upstream_->Free(block);
+  } else {
+    free_list.push_back(block);
+  }
+}
+
+void* ThreadCachingAllocator::Reserve(size_t size) {
+  if (size == 0) {
+    return nullptr;
+  }
+
+  return AttachHeader(upstream_->Reserve(size + kHeaderSize), kUncached);
+}
+
+}  // namespace onnxruntime
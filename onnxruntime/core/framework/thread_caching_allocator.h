@@ -0,0 +1,54 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <atomic>
+
+#include "core/framework/allocator.h"
+
+namespace onnxruntime {
+
+// tcmalloc-style per-thread size-class cache layered over another allocator (typically the CPU
+// BFCArena). Small allocations are rounded up to a power-of-two size class and served from free
+// lists owned by the calling thread, so the frequent tiny tensors produced by shape computations
+// and control flow never contend on the upstream allocator's lock. Blocks freed on a thread go
+// into that thread's cache (wherever they were allocated) and are returned to the upstream
+// allocator when a free list reaches its cap, when the cache notices its allocator is gone, or
+// when the thread exits.
+//
+// Every allocation carries a small header so Free() can recover the size class without asking
+// the upstream allocator; the header size is chosen to preserve the upstream alignment guarantee.
+// The per-thread caches hold a reference to the upstream allocator, so cached blocks remain valid
+// even if they outlive this wrapper.
+class ThreadCachingAllocator : public IAllocator {
+ public:
+  // Largest request size served from the per-thread caches; bigger requests go straight to the
+  // upstream allocator.
+  static constexpr size_t kMaxCachedSize = 4096;
+
+  // Smallest size class. Requests below this are rounded up to it.
+  static constexpr size_t kMinCachedSize = 256;
+
+  // Cap on the number of blocks a thread may cache per size class. Bounds the memory a thread
+  // can hold outside the upstream allocator to a few hundred KB.
+  static constexpr size_t kMaxBlocksPerClass = 16;
+
+  explicit ThreadCachingAllocator(AllocatorPtr upstream);
+
+  void* Alloc(size_t size) override;
+  void Free(void* p) override;
+
+  // Reserve() exists to bypass pooling logic, so it goes straight to the upstream allocator
+  // (with the header attached so Free() can tell the block was not cached).
+  void* Reserve(size_t size) override;
+
+  void GetStats(AllocatorStats* stats) override { upstream_->GetStats(stats); }
+
+ private:
+  AllocatorPtr upstream_;
+  // Identifies this allocator in the per-thread cache maps. Never reused, unlike addresses.
+  uint64_t id_;
+};
+
+}  // namespace onnxruntime
@@ -20,6 +20,7 @@
 #include "core/framework/tensorprotoutils.h"
 #include "core/mlas/inc/mlas.h"
 #include "core/framework/TensorSeq.h"
+#include "core/common/parse_string.h"
 #include "core/framework/run_options.h"
 #include "core/session/onnxruntime_run_options_config_keys.h"
 #ifdef ENABLE_TRAINING
@@ -448,13 +449,45 @@ static void FinalizeFeedFetchCopyInfo(FeedsFetchesManager& feeds_fetches_manager
   FinalizeFeedFetchCopyInfo(feeds_fetches_manager, feed_locations, fetch_alloc_info);
 }
 
+bool SubgraphFeedCopyCache::TryReuse(size_t idx, const OrtValue& source, OrtValue& target) const {
+  if (idx >= entries_.size()) {
+    return false;
+  }
+
+  const auto& entry = entries_[idx];
+  if (!entry.immutable || !entry.copy.IsAllocated() ||
+      !source.IsTensor() || !entry.source.IsTensor() ||
+      &entry.source.Get<Tensor>() != &source.Get<Tensor>()) {
+    return false;
+  }
+
+  target = entry.copy;
+  return true;
+}
+
+void SubgraphFeedCopyCache::Store(size_t idx, const OrtValue& source, const OrtValue& target) {
+  if (idx >= entries_.size()) {
+    return;
+  }
+
+  auto& entry = entries_[idx];
+  // only tensors have the shared-instance identity TryReuse relies on
+  if (!entry.immutable || !source.IsTensor()) {
+    return;
+  }
+
+  entry.source = source;
+  entry.copy = target;
+}
+
 static common::Status CopyInputsAcrossDevices(const SessionState& session_state,
                                               gsl::span<const OrtValue> orig_feeds,
                                               std::vector<OrtValue>& new_feeds,
 #ifdef ORT_ENABLE_STREAM
                                               DeviceStreamCollection* device_stream_collection,
 #endif
-                                              gsl::span<const MLValueCopyInfo> copy_info) {
+                                              gsl::span<const MLValueCopyInfo> copy_info,
+                                              SubgraphFeedCopyCache* feed_copy_cache = nullptr) {
   size_t num_feeds = orig_feeds.size();
   ORT_ENFORCE(copy_info.size() == num_feeds);
 
@@ -466,6 +499,12 @@ static common::Status CopyInputsAcrossDevices(const SessionState& session_state,
 
   std::unordered_set<Stream*> stream_to_flush;
   for (size_t idx = 0; idx < num_feeds; ++idx) {
+    const bool needs_device_copy = copy_info[idx].source_device != copy_info[idx].target_device;
+    if (feed_copy_cache != nullptr && needs_device_copy &&
+        feed_copy_cache->TryReuse(idx, orig_feeds[idx], new_feeds[idx])) {
+      continue;
+    }
+
     Stream* copy_this_feed = nullptr;
 #ifdef ORT_ENABLE_STREAM
     if (device_stream_collection) {
@@ -492,6 +531,12 @@ static common::Status CopyInputsAcrossDevices(const SessionState& session_state,
                                            copy_this_feed,
                                            &batched_data_transfers));
 #endif
+
+    if (feed_copy_cache != nullptr && needs_device_copy) {
+      // the batched transfer completes before this call returns, so the copy can be
+      // served from the cache on the next iteration
+      feed_copy_cache->Store(idx, orig_feeds[idx], new_feeds[idx]);
+    }
   }
 
   if (!batched_data_transfers.empty()) {
@@ -540,7 +585,8 @@ static void UpdateWithParentStream(DeviceStreamCollection& device_stream_collect
 
 // public method to do a single copy. used by external partners
 common::Status CopyOneInputAcrossDevices(const SessionState& session_state, const std::string& input_name,
-                                         const OrtValue& orig_mlvalue, OrtValue& new_mlvalue) {
+                                         const OrtValue& orig_mlvalue, OrtValue& new_mlvalue,
+                                         const GetCopyStreamFn& get_copy_stream) {
   if (!orig_mlvalue.IsTensor() && !orig_mlvalue.IsSparseTensor()) {
     new_mlvalue = orig_mlvalue;
     return Status::OK();
@@ -559,8 +605,15 @@ common::Status CopyOneInputAcrossDevices(const SessionState& session_state, cons
 
   Stream* device_stream = nullptr;
 #ifdef ORT_ENABLE_STREAM
+  // Prefer a caller-supplied copy stream so uploads can overlap compute running on the
+  // session's streams; the caller is responsible for synchronizing it before the value is
+  // consumed.
+  if (get_copy_stream && copy_info.source_device != copy_info.target_device) {
+    device_stream = get_copy_stream(copy_info.target_device);
+  }
+
   DeviceStreamCollectionHolder device_stream_collection_holder(&session_state);
-  if (device_stream_collection_holder.p_ != nullptr) {
+  if (device_stream == nullptr && device_stream_collection_holder.p_ != nullptr) {
     DeviceStreamCollection* device_stream_collection = device_stream_collection_holder.p_.get();
     size_t num_streams = device_stream_collection->NumStreams();
     for (size_t i = 0; i < num_streams; i++) {
@@ -577,6 +630,11 @@ common::Status CopyOneInputAcrossDevices(const SessionState& session_state, cons
   return BatchOrCopyMLValue(session_state, copy_info, orig_mlvalue, new_mlvalue, device_stream);
 }
 
+common::Status CopyOneInputAcrossDevices(const SessionState& session_state, const std::string& input_name,
+                                         const OrtValue& orig_mlvalue, OrtValue& new_mlvalue) {
+  return CopyOneInputAcrossDevices(session_state, input_name, orig_mlvalue, new_mlvalue, nullptr);
+}
+
 static common::Status CopyOutputsAcrossDevices(const SessionState& session_state,
                                                gsl::span<const OrtValue> fetches,
                                                std::vector<OrtValue>& user_fetches,
@@ -624,7 +682,12 @@ ExecuteGraphImpl(const SessionState& session_state,
                  DeviceStreamCollection* device_stream_collection,
 #endif
                  const bool only_execute_path_to_fetches = false,
-                 Stream* parent_stream = nullptr) {
+                 Stream* parent_stream = nullptr,
+                 const RunOptions::OutputReadyCallback& output_ready_callback = {},
+                 SubgraphFeedCopyCache* feed_copy_cache = nullptr,
+                 std::chrono::steady_clock::time_point deadline =
+                     std::chrono::steady_clock::time_point::max(),
+                 int intra_op_dop_cap = 0) {
   const auto& feeds_fetches_info = feeds_fetches_manager.GetFeedsFetchesInfo();
   const auto& device_copy_checks = feeds_fetches_manager.GetDeviceCopyChecks();
 #ifdef ORT_ENABLE_STREAM
@@ -656,7 +719,10 @@ ExecuteGraphImpl(const SessionState& session_state,
                                   terminate_flag,
                                   only_execute_path_to_fetches,
                                   // single thread mode
-                                  single_thread_mode));
+                                  single_thread_mode,
+                                  output_ready_callback,
+                                  deadline,
+                                  intra_op_dop_cap));
     ORT_RETURN_IF_ERROR(status);
   } else {
     auto feeds_to_use = feeds;
@@ -670,7 +736,7 @@ ExecuteGraphImpl(const SessionState& session_state,
 #ifdef ORT_ENABLE_STREAM
                                             device_stream_collection,
 #endif
-                                            feed_copy_info);
+                                            feed_copy_info, feed_copy_cache);
       ORT_RETURN_IF_ERROR(status);
       feeds_to_use = device_feeds;
     }
@@ -704,7 +770,10 @@ ExecuteGraphImpl(const SessionState& session_state,
 #endif
                                   terminate_flag,
                                   only_execute_path_to_fetches,
-                                  single_thread_mode));
+                                  single_thread_mode,
+                                  output_ready_callback,
+                                  deadline,
+                                  intra_op_dop_cap));
     ORT_RETURN_IF_ERROR(status);
     InlinedVector<Stream*> fetches_streams;
     fetches_streams.reserve(feeds_fetches_info.fetches_mlvalue_idxs.size());
@@ -742,7 +811,10 @@ common::Status ExecuteGraph(const SessionState& session_state,
                             DeviceStreamCollectionHolder& device_stream_collection_holder,
 #endif
                             bool only_execute_path_to_fetches,
-                            Stream* parent_stream) {
+                            Stream* parent_stream,
+                            const RunOptions::OutputReadyCallback& output_ready_callback,
+                            std::chrono::steady_clock::time_point deadline,
+                            int intra_op_dop_cap) {
   ORT_RETURN_IF_ERROR(utils::InitializeFeedFetchCopyInfo(session_state, feeds_fetches_manager));
 
   // finalize the copy info using the provided feeds and fetches. will update device_copy_checks in the background
@@ -753,13 +825,21 @@ common::Status ExecuteGraph(const SessionState& session_state,
                                  execution_mode, terminate_flag, logger,
                                  device_stream_collection,
                                  only_execute_path_to_fetches,
-                                 parent_stream);
+                                 parent_stream,
+                                 output_ready_callback,
+                                 /*feed_copy_cache*/ nullptr,
+                                 deadline,
+                                 intra_op_dop_cap);
   return retval;
 #else
   return ExecuteGraphImpl(session_state, feeds_fetches_manager, feeds, fetches, {},
                           execution_mode, terminate_flag, logger,
                           only_execute_path_to_fetches,
-                          parent_stream);
+                          parent_stream,
+                          output_ready_callback,
+                          /*feed_copy_cache*/ nullptr,
+                          deadline,
+                          intra_op_dop_cap);
 #endif
 }
 
@@ -771,6 +851,26 @@ common::Status ExecuteGraph(const SessionState& session_state,
                             DeviceStreamCollectionHolder& device_stream_collection_holder,
 #endif
                             const logging::Logger& logger) {
+  // translate the optional per-run time budget into an absolute deadline. it is checked before
+  // every kernel launch (see RunSince) and propagated into control flow subgraph executions.
+  auto deadline = std::chrono::steady_clock::time_point::max();
+  const std::string deadline_ms_str =
+      run_options.config_options.GetConfigOrDefault(kOrtRunOptionsConfigDeadlineMs, "0");
+  int64_t deadline_ms = 0;
+  ORT_RETURN_IF_NOT(TryParseStringWithClassicLocale(deadline_ms_str, deadline_ms) && deadline_ms >= 0,
+                    "Invalid value for ", kOrtRunOptionsConfigDeadlineMs, ": ", deadline_ms_str);
+  if (deadline_ms > 0) {
+    deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(deadline_ms);
+  }
+
+  // optional per-run cap on the intra-op degree of parallelism. installed around each kernel
+  // launch (see ExecuteKernel) so latency-bound runs can limit fan-out without resizing the pool.
+  const std::string dop_cap_str =
+      run_options.config_options.GetConfigOrDefault(kOrtRunOptionsConfigIntraOpMaxDegreeOfParallelism, "0");
+  int intra_op_dop_cap = 0;
+  ORT_RETURN_IF_NOT(TryParseStringWithClassicLocale(dop_cap_str, intra_op_dop_cap) && intra_op_dop_cap >= 0,
+                    "Invalid value for ", kOrtRunOptionsConfigIntraOpMaxDegreeOfParallelism, ": ", dop_cap_str);
+
   return ExecuteGraph(session_state,
                       feeds_fetches_manager,
                       feeds, fetches,
@@ -780,7 +880,11 @@ common::Status ExecuteGraph(const SessionState& session_state,
 #ifdef ORT_ENABLE_STREAM
                       device_stream_collection_holder,
 #endif
-                      run_options.only_execute_path_to_fetches);
+                      run_options.only_execute_path_to_fetches,
+                      /*parent_stream*/ nullptr,
+                      run_options.output_ready_callback,
+                      deadline,
+                      intra_op_dop_cap);
 }
 
 #ifdef ENABLE_TRAINING
@@ -903,18 +1007,22 @@ common::Status ExecuteSubgraph(const SessionState& session_state, const FeedsFet
                                const std::unordered_map<size_t, IExecutor::CustomAllocator>& fetch_allocators,
                                ExecutionMode execution_mode, const bool& terminate_flag, const logging::Logger& logger,
                                Stream* parent_stream,
-                               bool sync_subgraph_fetches) {
+                               bool sync_subgraph_fetches,
+                               SubgraphFeedCopyCache* feed_copy_cache,
+                               std::chrono::steady_clock::time_point deadline) {
 #ifdef ORT_ENABLE_STREAM
   DeviceStreamCollectionHolder device_stream_collection_holder(&session_state);
   DeviceStreamCollection* device_stream_collection = device_stream_collection_holder.p_.get();
 
   auto retval = ExecuteGraphImpl(session_state, feeds_fetches_manager, feeds, fetches, fetch_allocators,
-                                 execution_mode, terminate_flag, logger, device_stream_collection, false, parent_stream);
+                                 execution_mode, terminate_flag, logger, device_stream_collection, false, parent_stream,
+                                 {}, feed_copy_cache, deadline);
   if (device_stream_collection)
     ORT_CHECK_AND_SET_RETVAL(device_stream_collection->CleanUp(false));
 #else
   auto retval = ExecuteGraphImpl(session_state, feeds_fetches_manager, feeds, fetches, fetch_allocators,
-                                 execution_mode, terminate_flag, logger, false, parent_stream);
+                                 execution_mode, terminate_flag, logger, false, parent_stream,
+                                 {}, feed_copy_cache, deadline);
 #endif
   if (retval.IsOK() && sync_subgraph_fetches && parent_stream) {
     parent_stream->Flush();
@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <chrono>
+
 #include "core/graph/basic_types.h"
 #include "core/framework/allocator.h"
 #include "core/framework/data_types.h"
@@ -21,6 +23,7 @@ class KernelDef;
 class KernelRegistryManager;
 class IExecutionProvider;
 class Node;
+class Stream;
 class Tensor;
 struct KernelCreateInfo;
 #ifdef ENABLE_TRAINING
@@ -65,6 +68,18 @@ bool ProviderIsCpuBased(const std::string& provider_type);
 common::Status CopyOneInputAcrossDevices(const SessionState& session_state, const std::string& input_name,
                                          const OrtValue& orig_mlvalue, OrtValue& new_mlvalue);
 
+// Returns the stream the device copy for a feed should be issued on, given the copy target
+// device, or nullptr to fall back to a synchronous copy.
+using GetCopyStreamFn = std::function<Stream*(const OrtDevice& target_device)>;
+
+// Variant of the above that issues any device copy asynchronously on the stream supplied by
+// `get_copy_stream`, letting callers such as IOBinding pipeline input uploads on a dedicated
+// copy stream instead of borrowing one from the session's pool. The caller owns the stream and
+// must synchronize it before the copied value is consumed.
+common::Status CopyOneInputAcrossDevices(const SessionState& session_state, const std::string& input_name,
+                                         const OrtValue& orig_mlvalue, OrtValue& new_mlvalue,
+                                         const GetCopyStreamFn& get_copy_stream);
+
 // Searches the allocation plan from the session_state to find the OrtMemoryInfo for the value 'name'.
 const OrtDevice& FindDeviceForValue(const SessionState& session_state, std::string_view name);
 
@@ -88,7 +103,15 @@ common::Status ExecuteGraph(const SessionState& session_state, FeedsFetchesManag
                             DeviceStreamCollectionHolder& device_stream_collection_holder,
 #endif
                             bool only_execute_path_to_fetches = false,
-                            Stream* parent_stream = nullptr);
+                            Stream* parent_stream = nullptr,
+                            const RunOptions::OutputReadyCallback& output_ready_callback = {},
+                            /*absolute deadline for this run. checked before every kernel launch;
+                            steady_clock::time_point::max() means no deadline*/
+                            std::chrono::steady_clock::time_point deadline =
+                                std::chrono::steady_clock::time_point::max(),
+                            /*per-run cap on the intra-op degree of parallelism
+                            (see kOrtRunOptionsConfigIntraOpMaxDegreeOfParallelism); 0 means no cap*/
+                            int intra_op_dop_cap = 0);
 
 common::Status ExecuteGraph(const SessionState& session_state, FeedsFetchesManager& feeds_fetches_manager,
                             gsl::span<const OrtValue> feeds, std::vector<OrtValue>& fetches,
@@ -108,6 +131,43 @@ common::Status ExecutePartialGraph(const SessionState& session_state, FeedsFetch
                                    Stream* parent_stream);
 #endif
 
+// Caches the cross-device copies made for control-flow subgraph feeds so that feeds which
+// are unchanged from one iteration to the next (e.g. the implicit inputs of Loop and Scan)
+// are copied to the target device once instead of once per iteration. Within one device
+// there is no copy to elide - same-device feeds alias the parent frame's tensor via the
+// OrtValue refcount and are only replaced, never rewritten, by the subgraph.
+//
+// The owning kernel marks the feeds whose contents it never mutates in place. A marked
+// feed is matched by tensor identity: OrtValue copies share the underlying Tensor
+// instance, so a matching pointer means the parent passed the exact value the cached
+// copy was made from. Feeds the parent republishes each iteration (loop carried values)
+// fail that check and are copied as before. An instance is only valid for the single
+// Compute call it was created for.
+class SubgraphFeedCopyCache {
+ public:
+  explicit SubgraphFeedCopyCache(size_t num_feeds) : entries_(num_feeds) {}
+
+  // Marks the feed at 'idx' as safe to cache: the parent kernel passes the same OrtValue
+  // every iteration and never mutates its contents in place.
+  void MarkImmutable(size_t idx) { entries_[idx].immutable = true; }
+
+  // If a copy of 'source' made on an earlier iteration is available, assigns it to
+  // 'target' and returns true.
+  bool TryReuse(size_t idx, const OrtValue& source, OrtValue& target) const;
+
+  // Records the device copy 'target' that was made for 'source'.
+  void Store(size_t idx, const OrtValue& source, const OrtValue& target);
+
+ private:
+  struct Entry {
+    bool immutable = false;
+    OrtValue source;
+    OrtValue copy;
+  };
+
+  std::vector<Entry> entries_;
+};
+
 // Execute a subgraph. The feeds_fetches_manager should have been finalized prior to calling this function.
 // See IControlFlowNode::SetupSubgraphExecutionInfo usage in the control flow kernels.
 common::Status ExecuteSubgraph(const SessionState& session_state, const FeedsFetchesManager& feeds_fetches_manager,
@@ -118,7 +178,15 @@ common::Status ExecuteSubgraph(const SessionState& session_state, const FeedsFet
                                /*when this is enabled, we will sync the parent stream to make sure the subgraph fetches
                                is complete. this is mainly used when the parent kernel depends on the CPU value of the
                                subgraph fetches, i.e. the loop condition*/
-                               bool sync_subgraph_fetches = false);
+                               bool sync_subgraph_fetches = false,
+                               /*cache of cross-device feed copies owned by the calling kernel. see
+                               SubgraphFeedCopyCache*/
+                               SubgraphFeedCopyCache* feed_copy_cache = nullptr,
+                               /*deadline of the enclosing run, taken from the parent kernel context
+                               (OpKernelContextInternal::GetDeadline) so per-kernel deadline checks
+                               keep firing inside control flow subgraphs*/
+                               std::chrono::steady_clock::time_point deadline =
+                                   std::chrono::steady_clock::time_point::max());
 
 bool IsInputOnCpu(const Node& node, const KernelCreateInfo* p_kci, size_t index);
 bool IsOutputOnCpu(const Node& node, const KernelCreateInfo* p_kci, size_t index);
@@ -0,0 +1,143 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/weight_residency_manager.h"
+
+#if defined(_WIN32)
+#include <Windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+namespace onnxruntime {
+
+namespace {
+
+constexpr size_t kPageSize = 4096;
+
+// Hints that the range will be needed soon so the OS reads it ahead of first access.
+void AdviseWillNeed(const void* data, size_t length) {
+#if defined(_WIN32)
+  // no portable read-ahead hint that is safe across supported Windows versions; the pages are
+  // faulted on first access instead
+  ORT_UNUSED_PARAMETER(data);
+  ORT_UNUSED_PARAMETER(length);
+#else
+  const uintptr_t start = reinterpret_cast<uintptr_t>(data) & ~(kPageSize - 1);
+  const uintptr_t end = reinterpret_cast<uintptr_t>(data) + length;
+  if (end > start) {
+    madvise(reinterpret_cast<void*>(start), end - start, MADV_WILLNEED);
+  }
+#endif
+}
+
+// Hints that the range is no longer needed. Only content-preserving advice is used: file-backed
+// clean pages may be dropped and anonymous pages may be paged out, but a later access always
+// sees the original data.
+void AdviseDone(const void* data, size_t length) {
+#if defined(_WIN32)
+  // removing the range from the working set lets the memory manager reclaim it under pressure
+  VirtualUnlock(const_cast<void*>(data), length);
+#elif defined(__linux__) && defined(MADV_PAGEOUT)
+  const uintptr_t start = reinterpret_cast<uintptr_t>(data) & ~(kPageSize - 1);
+  const uintptr_t end = reinterpret_cast<uintptr_t>(data) + length;
+  if (end > start) {
+    madvise(reinterpret_cast<void*>(start), end - start, MADV_PAGEOUT);
+  }
+#elif defined(__linux__) && defined(MADV_COLD)
+  const uintptr_t start = reinterpret_cast<uintptr_t>(data) & ~(kPageSize - 1);
+  const uintptr_t end = reinterpret_cast<uintptr_t>(data) + length;
+  if (end > start) {
+    madvise(reinterpret_cast<void*>(start), end - start, MADV_COLD);
+  }
+#else
+  ORT_UNUSED_PARAMETER(data);
+  ORT_UNUSED_PARAMETER(length);
+#endif
+}
+
+}  // namespace
+
+WeightResidencyManager::WeightResidencyManager(std::vector<Weight> weights,
+                                               InlinedHashMap<NodeIndex, size_t> node_to_position,
+                                               size_t num_positions,
+                                               size_t prefetch_budget_bytes)
+    : weights_(std::move(weights)),
+      node_to_position_(std::move(node_to_position)),
+      num_positions_(num_positions),
+      prefetch_budget_bytes_(prefetch_budget_bytes),
+      first_use_at_(num_positions),
+      last_use_at_(num_positions),
+      prefetched_(weights_.size(), false) {
+  for (size_t id = 0; id < weights_.size(); ++id) {
+    const Weight& weight = weights_[id];
+    ORT_ENFORCE(weight.first_use <= weight.last_use && weight.last_use < num_positions_);
+    first_use_at_[weight.first_use].push_back(id);
+    last_use_at_[weight.last_use].push_back(id);
+  }
+}
+
+void WeightResidencyManager::Reset() {
+  cursor_ = 0;
+  prefetch_pos_ = 0;
+  std::fill(prefetched_.begin(), prefetched_.end(), false);
+  stats_.prefetched_bytes_in_window = 0;
+}
+
+void WeightResidencyManager::OnNodeExecute(NodeIndex node_index) {
+  std::lock_guard<OrtMutex> lock(mutex_);
+
+  auto it = node_to_position_.find(node_index);
+  if (it == node_to_position_.end()) {
+    return;
+  }
+  const size_t position = it->second;
+
+  // a position behind the cursor means a new Run started; restart the window
+  if (position < cursor_) {
+    Reset();
+  }
+
+  // retire positions up to (but not including) the executing one, evicting weights whose last
+  // consumer has run
+  while (cursor_ < position) {
+    for (size_t id : last_use_at_[cursor_]) {
+      const Weight& weight = weights_[id];
+      AdviseDone(weight.data, weight.size_in_bytes);
+      ++stats_.num_evictions;
+      if (prefetched_[id]) {
+        prefetched_[id] = false;
+        stats_.prefetched_bytes_in_window -= weight.size_in_bytes;
+      }
+    }
+    ++cursor_;
+  }
+
+  // read ahead of the wavefront, stopping at the first weight that would exceed the budget
+  if (prefetch_pos_ <= position) {
+    prefetch_pos_ = position + 1;
+  }
+  while (prefetch_pos_ < num_positions_) {
+    for (size_t id : first_use_at_[prefetch_pos_]) {
+      const Weight& weight = weights_[id];
+      if (prefetched_[id]) {
+        continue;
+      }
+      if (stats_.prefetched_bytes_in_window + weight.size_in_bytes > prefetch_budget_bytes_) {
+        return;
+      }
+      AdviseWillNeed(weight.data, weight.size_in_bytes);
+      prefetched_[id] = true;
+      ++stats_.num_prefetches;
+      stats_.prefetched_bytes_in_window += weight.size_in_bytes;
+    }
+    ++prefetch_pos_;
+  }
+}
+
+WeightResidencyManager::Stats WeightResidencyManager::GetStats() const {
+  std::lock_guard<OrtMutex> lock(mutex_);
+  return stats_;
+}
+
+}  // namespace onnxruntime
@@ -0,0 +1,74 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "core/common/common.h"
+#include "core/common/inlined_containers.h"
+#include "core/graph/basic_types.h"
+#include "core/platform/ort_mutex.h"
+
+namespace onnxruntime {
+
+// Keeps the resident set of weight pages close to the execution wavefront when a model's
+// weights exceed RAM.
+//
+// Weights loaded from external data are memory mapped, so their pages can be dropped and
+// re-faulted from the file transparently. As each node executes, the manager advises the OS to
+// read ahead the weights of upcoming nodes (bounded by a byte budget) and to reclaim the pages
+// of weights whose last consumer has already run. All advice is content preserving — a wrong or
+// ignored hint costs a page fault, never correctness — so the same path is safe for weights
+// that were loaded with a copying fallback rather than a mapping.
+//
+// The schedule is the topological node order the sequential executor uses. Concurrent Runs
+// share the manager; the window simply tracks the most recently started Run.
+class WeightResidencyManager {
+ public:
+  struct Weight {
+    const void* data;
+    size_t size_in_bytes;
+    size_t first_use;  // schedule position of the first consuming node
+    size_t last_use;   // schedule position of the last consuming node
+  };
+
+  struct Stats {
+    size_t num_prefetches{0};
+    size_t num_evictions{0};
+    size_t prefetched_bytes_in_window{0};
+  };
+
+  WeightResidencyManager(std::vector<Weight> weights,
+                         InlinedHashMap<NodeIndex, size_t> node_to_position,
+                         size_t num_positions,
+                         size_t prefetch_budget_bytes);
+
+  // Called as the node starts executing. Evicts weights fully consumed before this position and
+  // prefetches weights of upcoming positions while within the budget.
+  void OnNodeExecute(NodeIndex node_index);
+
+  Stats GetStats() const;
+
+ private:
+  void Reset();
+
+  const std::vector<Weight> weights_;
+  const InlinedHashMap<NodeIndex, size_t> node_to_position_;
+  const size_t num_positions_;
+  const size_t prefetch_budget_bytes_;
+
+  // weight ids grouped by the schedule position of their first/last use
+  std::vector<InlinedVector<size_t>> first_use_at_;
+  std::vector<InlinedVector<size_t>> last_use_at_;
+
+  // window state, guarded by mutex_
+  size_t cursor_{0};        // next schedule position to retire
+  size_t prefetch_pos_{0};  // next schedule position to prefetch
+  std::vector<bool> prefetched_;
+  Stats stats_;
+  mutable OrtMutex mutex_;
+};
+
+}  // namespace onnxruntime
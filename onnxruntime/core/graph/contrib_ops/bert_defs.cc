@@ -320,6 +320,13 @@ void GroupQueryAttentionTypeAndShapeInference(ONNX_NAMESPACE::InferenceContext&
   // TODO(aciddelgado): propagate output shapes depending if kv-share buffer is on or not
   constexpr int use_max_past_present_buffer = -1;
   BaseGroupQueryAttentionTypeAndShapeInference(ctx, past_key_index, use_max_past_present_buffer);
+
+  // With a quantized KV cache the present cache is int8 rather than the query type the base
+  // inference propagated.
+  if (getAttribute(ctx, "kv_cache_quant_type", 0) == 1 && ctx.getNumOutputs() > 2) {
+    ONNX_NAMESPACE::updateOutputElemType(ctx, 1, ONNX_NAMESPACE::TensorProto::INT8);
+    ONNX_NAMESPACE::updateOutputElemType(ctx, 2, ONNX_NAMESPACE::TensorProto::INT8);
+  }
 }
 
 void SparseAttentionTypeAndShapeInference(ONNX_NAMESPACE::InferenceContext& ctx, int past_key_index) {
@@ -1050,6 +1057,21 @@ Only supports causal and local attention.
 Supports rotary position embedding for CPU and CUDA.
 Supports packed input for CPU and CUDA.
 Supports continuous decoding for batch_size == 1 for CPU and CUDA.
+Supports batched multi-token passes over past context on CPU, e.g. verifying k draft tokens from a speculative
+decoding draft model in a single call: causal masking over the new tokens is applied per sequence, and passing
+seqlens_k as the accepted token count on the next call rewinds the shared KV cache in place, overwriting the
+rejected entries without any cache copies.
+Supports a paged KV cache for CPU. When block_table is provided, past_key and past_value are a page pool with
+shape (num_pages, kv_num_heads, page_size, head_size) shared by all sequences, and block_table maps each
+sequence to the pages holding its KV entries in order.
+Supports a sliding-window ring KV cache with optional attention-sink tokens for CPU. When local_window_size
+is set and the shared past/present cache buffer is allocated with exactly num_sink_tokens + local_window_size
+entries, token generation past the window overwrites the oldest non-sink cache slot in place, so cache memory
+stays capped regardless of total sequence length.
+Supports an int8-quantized KV cache for CPU. When kv_cache_quant_type is 1, past_key/past_value and
+present_key/present_value are int8 tensors with last dimension head_size + 4: each cache row stores head_size
+int8 values followed by that row's float32 dequantization scale (one scale per head per token), shrinking the
+cache 4x versus fp32. The rows are dequantized on the fly inside the attention computation.
 
 )DOC";
 
@@ -1071,6 +1093,11 @@ ONNX_MS_OPERATOR_SET_SCHEMA(
               "left_window_size for local attention (like Mistral). Default value is -1 meaning unused.",
               AttributeProto::INT,
               static_cast<int64_t>(-1))
+        .Attr("num_sink_tokens",
+              "Number of initial tokens kept attendable alongside the local attention window (attention sinks). "
+              "Requires local_window_size to be set. Default value is 0.",
+              AttributeProto::INT,
+              static_cast<int64_t>(0))
         .Attr("do_rotary",
               "Whether to use rotary position embedding. Default value is 0.",
               AttributeProto::INT,
@@ -1083,6 +1110,12 @@ ONNX_MS_OPERATOR_SET_SCHEMA(
               "Use a smooth factor in softmax.",
               AttributeProto::INT,
               static_cast<int64_t>(-1))
+        .Attr("kv_cache_quant_type",
+              "KV cache storage type. 0 (default): the cache has the same type as query. 1: int8 cache rows with "
+              "one float32 scale per head per token stored in the last 4 bytes of each row, so the cache tensors "
+              "are int8 with last dimension head_size + 4. CPU only. Value 2 is reserved for int4.",
+              AttributeProto::INT,
+              static_cast<int64_t>(0))
         .Input(0,
                "query",
                "Query with shape (batch_size, sequence_length, hidden_size), or packed QKV with shape"
@@ -1101,14 +1134,16 @@ ONNX_MS_OPERATOR_SET_SCHEMA(
         .Input(3,
                "past_key",
                "past state key with support for format BNSH. When past_key uses same tensor as present_key"
-               "(k-v cache), it is of length max_sequence_length... otherwise of length past_sequence_length.",
-               "T",
+               "(k-v cache), it is of length max_sequence_length... otherwise of length past_sequence_length. "
+               "int8 with last dimension head_size + 4 when kv_cache_quant_type is 1.",
+               "T_cache",
                OpSchema::Optional)
         .Input(4,
                "past_value",
                "past state value with support for format BNSH. When past_value uses same tensor as present_value"
-               "(k-v cache), it is of length max_sequence_length... otherwise of length past_sequence_length.",
-               "T",
+               "(k-v cache), it is of length max_sequence_length... otherwise of length past_sequence_length. "
+               "int8 with last dimension head_size + 4 when kv_cache_quant_type is 1.",
+               "T_cache",
                OpSchema::Optional)
         .Input(5,
                "seqlens_k",
@@ -1129,6 +1164,13 @@ ONNX_MS_OPERATOR_SET_SCHEMA(
                "2D tensor with shape (max_sequence_length, head_size / 2).",
                "T",
                OpSchema::Optional)
+        .Input(9,
+               "block_table",
+               "2D tensor with shape (batch_size, max_blocks_per_sequence). When provided, past_key and past_value "
+               "are a paged KV pool with shape (num_pages, kv_num_heads, page_size, head_size) and block_table lists, "
+               "in order, the pages holding each sequence's KV entries. CPU only.",
+               "M",
+               OpSchema::Optional)
         .Output(0,
                 "output",
                 "3D output tensor with shape (batch_size, sequence_length, hidden_size)",
@@ -1138,14 +1180,17 @@ ONNX_MS_OPERATOR_SET_SCHEMA(
                 "present state key with support for format BNSH. When past_key uses same tensor as present_key"
                 "(k-v buffer), it is of length max_sequence_length... otherwise of length past_sequence_length +"
                 "kv_sequence_length.",
-                "T")
+                "T_cache")
         .Output(2,
                 "present_value",
                 "present state value with support for format BNSH. When past_value uses same tensor as present_value"
                 "(k-v buffer), it is of length max_sequence_length... otherwise of length past_sequence_length +"
                 "kv_sequence_length.",
-                "T")
+                "T_cache")
         .TypeConstraint("T", {"tensor(float16)", "tensor(bfloat16)", "tensor(float)"}, "Constrain input and output to float tensors.")
+        .TypeConstraint("T_cache",
+                        {"tensor(float16)", "tensor(bfloat16)", "tensor(float)", "tensor(int8)"},
+                        "Constrain the KV cache to float tensors, or int8 when kv_cache_quant_type is 1.")
         .TypeConstraint("M", {"tensor(int32)"}, "Constrain mask to int tensor.")
         .TypeAndShapeInferenceFunction([](ONNX_NAMESPACE::InferenceContext& ctx) {
           GroupQueryAttentionTypeAndShapeInference(ctx, 3);
@@ -1665,6 +1665,18 @@ activation.)DOC")
                                     "",
                                     AttributeProto::FLOATS,
                                     OPTIONAL_VALUE)
+                                .Attr(
+                                    "post_ops",
+                                    "Ordered chain of elementwise ops applied to the output. Supported entries are the "
+                                    "fusable activations plus Mul and Add with a scalar constant. Used instead of "
+                                    "'activation' when more than one op was absorbed.",
+                                    AttributeProto::STRINGS,
+                                    OPTIONAL_VALUE)
+                                .Attr(
+                                    "post_op_params",
+                                    "Parameters of the post_ops entries, flattened in stage order.",
+                                    AttributeProto::FLOATS,
+                                    OPTIONAL_VALUE)
                                 .Input(
                                     0,
                                     "X",
@@ -1798,6 +1810,125 @@ activation and leaky_relu_alpha.)DOC")
                                   }
                                 }));
 
+ONNX_MS_OPERATOR_SET_SCHEMA(FusedImputerScaler, 1,
+                            OpSchema()
+                                .SetDoc(R"DOC(
+Fusion of an ai.onnx.ml Imputer followed by a Scaler. Each element is imputed and rescaled
+in a single pass: y = (impute(x) - offset[f]) * scale[f] where f is the feature index.
+The imputer and scaler attributes keep the semantics of the original ops.)DOC")
+                                .Input(0, "X", "Data to be imputed and scaled", "T")
+                                .Output(0, "Y", "Imputed and scaled output data", "T")
+                                .TypeConstraint("T", {"tensor(float)"}, "Constrain input and output types to float tensors.")
+                                .Attr(
+                                    "imputed_value_floats",
+                                    "Value(s) to change to, one per feature or a single shared value",
+                                    AttributeProto::FLOATS)
+                                .Attr(
+                                    "replaced_value_float",
+                                    "Value that needs replacing",
+                                    AttributeProto::FLOAT,
+                                    0.f)
+                                .Attr(
+                                    "scale",
+                                    "Multiply by this, one per feature or a single shared value",
+                                    AttributeProto::FLOATS)
+                                .Attr(
+                                    "offset",
+                                    "Subtract this before scaling, must be same length as scale",
+                                    AttributeProto::FLOATS)
+                                .TypeAndShapeInferenceFunction([](ONNX_NAMESPACE::InferenceContext& ctx) {
+                                  propagateElemTypeFromInputToOutput(ctx, 0, 0);
+                                  if (hasInputShape(ctx, 0)) {
+                                    propagateShapeFromInputToOutput(ctx, 0, 0);
+                                  }
+                                }));
+
+constexpr const char* FusedElementwise_ver1_doc = R"DOC(
+Applies a chain of elementwise operations to the input tensor in a single streaming pass.
+The chain is described as a per-element program: steps[i] names the operation applied at
+step i, scalars[i] holds the constant scalar operand of a binary step (ignored for unary
+steps), and scalar_first[i] is non-zero when the scalar was the first input of a
+non-commutative binary step (e.g. scalar - x rather than x - scalar).
+This operator is produced by the ElementwiseFusion graph transformer and is not intended
+to be used directly in models.)DOC";
+
+ONNX_MS_OPERATOR_SET_SCHEMA(FusedElementwise, 1,
+                            OpSchema()
+                                .SetDoc(FusedElementwise_ver1_doc)
+                                .Attr(
+                                    "steps",
+                                    "Elementwise operation applied at each step, in order. One of "
+                                    "Add, Sub, Mul, Div, Neg, Abs, Sqrt, Exp, Sigmoid, Tanh, Relu.",
+                                    AttributeProto::STRINGS)
+                                .Attr(
+                                    "scalars",
+                                    "Constant scalar operand for each step. Ignored for unary steps.",
+                                    AttributeProto::FLOATS)
+                                .Attr(
+                                    "scalar_first",
+                                    "For each step, non-zero if the scalar was the first input of the "
+                                    "binary operation. Ignored for unary steps.",
+                                    AttributeProto::INTS)
+                                .Input(0, "X", "The input data as Tensor.", "T")
+                                .Output(0, "Y", "The output.", "T")
+                                .TypeConstraint(
+                                    "T",
+                                    {"tensor(float)"},
+                                    "Constrain input and output types to float tensors.")
+                                .TypeAndShapeInferenceFunction(ONNX_NAMESPACE::propagateShapeAndTypeFromFirstInput));
+
+constexpr const char* EmbeddingBag_ver1_doc = R"DOC(
+Pools rows of a 2-D embedding table selected by an integer index tensor. Equivalent to
+Gather(weight, indices, axis=0) followed by ReduceSum or ReduceMean over the last index
+dimension, but the gathered matrix is never materialized: each bag's rows are accumulated
+directly into the pooled output row. The last dimension of 'indices' is the bag, i.e.
+output[d0, ..., dk, :] pools weight[indices[d0, ..., dk, j], :] over j.
+This operator is produced by the EmbeddingBagFusion graph transformer and is not intended
+to be used directly in models.)DOC";
+
+ONNX_MS_OPERATOR_SET_SCHEMA(EmbeddingBag, 1,
+                            OpSchema()
+                                .SetDoc(EmbeddingBag_ver1_doc)
+                                .Attr(
+                                    "mode",
+                                    "Pooling applied over each bag: 'sum' or 'mean'.",
+                                    AttributeProto::STRING,
+                                    std::string("sum"))
+                                .Input(0, "weight", "2-D embedding table of shape (num_embeddings, embedding_dim).", "T")
+                                .Input(1, "indices",
+                                       "Integer tensor of rank >= 1; the last dimension holds the rows pooled "
+                                       "into one bag.",
+                                       "Tind")
+                                .Output(0, "output", "Pooled embeddings of shape indices.shape[:-1] x (embedding_dim,).", "T")
+                                .TypeConstraint(
+                                    "T",
+                                    {"tensor(float)"},
+                                    "Constrain weight and output types to float tensors.")
+                                .TypeConstraint(
+                                    "Tind",
+                                    {"tensor(int32)", "tensor(int64)"},
+                                    "Constrain indices to integer types.")
+                                .TypeAndShapeInferenceFunction([](ONNX_NAMESPACE::InferenceContext& ctx) {
+                                  propagateElemTypeFromInputToOutput(ctx, 0, 0);
+                                  if (!hasInputShape(ctx, 0) || !hasInputShape(ctx, 1)) {
+                                    return;
+                                  }
+                                  auto& weight_shape = getInputShape(ctx, 0);
+                                  auto& indices_shape = getInputShape(ctx, 1);
+                                  if (weight_shape.dim_size() != 2) {
+                                    fail_shape_inference("weight must be a 2-D tensor");
+                                  }
+                                  if (indices_shape.dim_size() < 1) {
+                                    fail_shape_inference("indices must have rank >= 1");
+                                  }
+                                  ONNX_NAMESPACE::TensorShapeProto output_shape;
+                                  for (int i = 0; i < indices_shape.dim_size() - 1; ++i) {
+                                    *output_shape.add_dim() = indices_shape.dim(i);
+                                  }
+                                  *output_shape.add_dim() = weight_shape.dim(1);
+                                  updateOutputShape(ctx, 0, output_shape);
+                                }));
+
 ONNX_MS_OPERATOR_SET_SCHEMA(ExpandDims, 1,
                             OpSchema()
                                 .Input(0, "X", "input", "T")
@@ -2686,6 +2817,65 @@ ONNX_MS_OPERATOR_SET_SCHEMA(CropAndResize, 1,
   {"tensor(float16)", "tensor(bfloat16)", "tensor(float)"}
 #endif
 
+constexpr const char* GemmTopK_ver1_doc = R"DOC(
+Computes MatMul(A, B) over a 2-D A of shape (M, K) and B of shape (K, N) and returns only
+the top k entries of each output row, like TopK over the last axis of the product. The GEMM
+is tiled along N and each tile's results are folded into per-row streaming top-k selections
+while still cache resident, so the full (M, N) product is never materialized - intended for
+classification heads whose label dimension dwarfs k. Ties prefer the lower column index and
+the outputs are always sorted.
+This operator is produced by the MatMulTopKFusion graph transformer and is not intended to
+be used directly in models.)DOC";
+
+ONNX_MS_OPERATOR_SET_SCHEMA(GemmTopK, 1,
+                            OpSchema()
+                                .SetDoc(GemmTopK_ver1_doc)
+                                .Attr(
+                                    "k",
+                                    "Number of top entries to retain per row. Must be positive and "
+                                    "must not exceed N.",
+                                    AttributeProto::INT)
+                                .Attr(
+                                    "largest",
+                                    "Whether to return the largest (1) or smallest (0) entries.",
+                                    AttributeProto::INT,
+                                    static_cast<int64_t>(1))
+                                .Attr(
+                                    "sorted",
+                                    "Carried over from the fused TopK node; the outputs are always "
+                                    "sorted regardless of its value.",
+                                    AttributeProto::INT,
+                                    static_cast<int64_t>(1))
+                                .Input(0, "A", "2-D input tensor of shape (M, K).", "T")
+                                .Input(1, "B", "2-D weight tensor of shape (K, N).", "T")
+                                .Output(0, "Values", "Top k values of each product row, shape (M, k).", "T")
+                                .Output(1, "Indices", "Column indices of the top k values, shape (M, k).", "I")
+                                .TypeConstraint(
+                                    "T",
+                                    {"tensor(float)"},
+                                    "Constrain inputs and values output to float tensors.")
+                                .TypeConstraint(
+                                    "I",
+                                    {"tensor(int64)"},
+                                    "Constrain indices output to int64 tensors.")
+                                .TypeAndShapeInferenceFunction([](ONNX_NAMESPACE::InferenceContext& ctx) {
+                                  propagateElemTypeFromInputToOutput(ctx, 0, 0);
+                                  updateOutputElemType(ctx, 1, ONNX_NAMESPACE::TensorProto::INT64);
+                                  const auto* k_attr = ctx.getAttribute("k");
+                                  if (k_attr == nullptr || !hasInputShape(ctx, 0)) {
+                                    return;
+                                  }
+                                  auto& a_shape = getInputShape(ctx, 0);
+                                  if (a_shape.dim_size() != 2) {
+                                    fail_shape_inference("A must be a 2-D tensor");
+                                  }
+                                  ONNX_NAMESPACE::TensorShapeProto output_shape;
+                                  *output_shape.add_dim() = a_shape.dim(0);
+                                  output_shape.add_dim()->set_dim_value(k_attr->i());
+                                  updateOutputShape(ctx, 0, output_shape);
+                                  updateOutputShape(ctx, 1, output_shape);
+                                }));
+
 ONNX_MS_OPERATOR_SET_SCHEMA(GemmFloat8, 1,
                             OpSchema()
                                 .SetDoc(R"DOC(Generic Gemm for float and float 8.)DOC")
@@ -3461,6 +3651,10 @@ Input zero_points is stored as uint8_t or same as type(A). It has the same packi
             "computation. 4 means input A can be quantized with the same block_size to int8 internally from "
             "type T1.",
             AttributeProto::INT, static_cast<int64_t>(0))
+      .Attr("activation",
+            "Activation to apply to the output, one of: 'Relu', 'Sigmoid', 'Tanh', 'Gelu', 'FastGelu', 'Silu'. "
+            "Populated by graph fusions; the default is no activation.",
+            AttributeProto::STRING, OPTIONAL_VALUE)
       .Input(0, "A", "The input tensor, not quantized", "T1")
       .Input(1, "B", "1 or 2 dimensional data blob", "T2")
       .Input(2, "scales", "quantization scale", "T1")
@@ -3568,6 +3762,7 @@ GatherBlockQuantized is a Gather with data quantized. It is similar to Gather (h
   3. During the op execution, `data` and `indices` are first used to generate the quantized output. Then, `scales` and `zero_points` are used
      to dequantize the output.
   4. The `output` and `scales` have the same type. The `data` and `zero_points` have the same type.
+  5. `data` may be 4-bit (two elements packed per byte) or 8-bit (one element per byte).
 )DOC";
 
   ONNX_CONTRIB_OPERATOR_SCHEMA(GatherBlockQuantized)
@@ -3595,7 +3790,8 @@ GatherBlockQuantized is a Gather with data quantized. It is similar to Gather (h
       .Input(2, "scales", "quantization scale", "T2")
       .Input(3, "zero_points", "quantization zero points", "T1", OpSchema::Optional)
       .Output(0, "output", "Dequantized output tensor of rank q + (r - 1).", "T2")
-      .TypeConstraint("T1", {"tensor(int4)", "tensor(uint4)"}, "Constrain quantized types.")
+      .TypeConstraint("T1", {"tensor(int4)", "tensor(uint4)", "tensor(int8)", "tensor(uint8)"},
+                      "Constrain quantized types.")
       .TypeConstraint("T2", {"tensor(float)", "tensor(float16)", "tensor(bfloat16)"}, "Constrain dequantized types.")
       .TypeConstraint("Tind", {"tensor(int32)", "tensor(int64)"}, "Constrain indices to integer types.")
       .TypeAndShapeInferenceFunction([](ONNX_NAMESPACE::InferenceContext& ctx) {
@@ -3787,7 +3983,8 @@ Having this op allows runtime to do operator re-ordering to reduce compute FLOPs
   }
 #endif
 
-#ifdef ORT_USE_NCCL
+// the collectives run over NCCL on CUDA and directly over MPI on CPU
+#if defined(ORT_USE_NCCL) || defined(USE_MPI)
   RegisterCollectiveOps();
 #endif
 }
@@ -654,6 +654,44 @@ The output tensor has the same shape.
           propagateShapeFromInputToOutput(ctx, 0, 0);
         }));
 
+ONNX_MS_OPERATOR_SET_SCHEMA(
+    QLinearLayerNormalization, 1,
+    OpSchema()
+        .SetDoc(R"DOC(
+QLinearLayerNormalization applies layer normalization directly to quantized activations:
+Y = quantize(LayerNormalization(dequantize(X), Scale, B)).
+The row mean and variance are computed from the quantized values (the zero point cancels in the
+mean subtraction), so no dequantized copy of X is materialized. The "axis" attribute selects the
+first normalization dimension, as in LayerNormalization.
+)DOC")
+        .Attr("axis", "The first normalization dimension.", AttributeProto::INT, static_cast<int64_t>(-1))
+        .Attr("epsilon", "The epsilon value to use to avoid division by zero.", AttributeProto::FLOAT, 1e-5f)
+        .Attr("stash_type",
+              "Carried over from LayerNormalization when fused; the mean and variance are always "
+              "accumulated at full precision, so this attribute is ignored.",
+              AttributeProto::INT, static_cast<int64_t>(1))
+        .Input(0, "X", "The input tensor", "T")
+        .Input(1, "X_scale", "Scale of quantized input 'X'. It must be a scalar.", "tensor(float)")
+        .Input(2, "X_zero_point",
+               "Zero point tensor for input 'X'. It must be a scalar.",
+               "T", OpSchema::Optional)
+        .Input(3, "Scale", "Scale tensor with the shape of the normalized dimensions.", "F")
+        .Input(4, "B", "Bias tensor with the shape of the normalized dimensions.", "F", OpSchema::Optional)
+        .Input(5, "Y_scale", "Scale of quantized output 'Y'. It must be a scalar.", "tensor(float)")
+        .Input(6, "Y_zero_point",
+               "Zero point tensor for output 'Y'. It must be a scalar.",
+               "T")
+        .Output(0, "Y", "Output tensor with the same shape as 'X'.", "T")
+        .TypeConstraint("T", {"tensor(uint8)", "tensor(int8)"},
+                        "Constrain input and output types to signed/unsigned int8 tensors.")
+        .TypeConstraint("F", {"tensor(float)"}, "Constrain scale and bias to float tensors.")
+        .TypeAndShapeInferenceFunction([](ONNX_NAMESPACE::InferenceContext& ctx) {
+          propagateElemTypeFromInputToOutput(ctx, 0, 0);
+          if (hasNInputShapes(ctx, 1)) {
+            propagateShapeFromInputToOutput(ctx, 0, 0);
+          }
+        }));
+
 ONNX_MS_OPERATOR_SET_SCHEMA(
     DynamicQuantizeLSTM, 1,
     OpSchema()
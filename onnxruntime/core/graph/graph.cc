@@ -20,6 +20,7 @@
 #include "core/framework/tensor_shape.h"
 #include "core/framework/tensorprotoutils.h"
 #include "core/framework/utils.h"
+#include "core/platform/threadpool.h"
 #include "core/graph/graph_flatbuffers_utils.h"
 #include "core/graph/graph_viewer.h"
 #include "core/graph/indexed_sub_graph.h"
@@ -777,13 +778,6 @@ flatbuffers::Offset<fbs::NodeEdge> Node::SaveEdgesToOrtFormat(flatbuffers::FlatB
 
 #endif  // !defined(ORT_MINIMAL_BUILD)
 
-Status Node::LoadFromOrtFormat(const onnxruntime::fbs::Node& fbs_node, Graph& graph,
-                               const OrtFormatLoadOptions& load_options,
-                               const logging::Logger& logger, std::unique_ptr<Node>& node) {
-  node = std::make_unique<Node>(fbs_node.index(), graph);
-  return node->LoadFromOrtFormat(fbs_node, load_options, logger);
-}
-
 Status Node::LoadFromOrtFormat(const onnxruntime::fbs::Node& fbs_node,
                                const OrtFormatLoadOptions& load_options,
                                const logging::Logger& logger) {
@@ -1315,7 +1309,34 @@ Graph::Graph(const Model& owning_model,
   }
 
   // Copy initial tensors to a map.
-  for (auto& tensor : graph_proto_->initializer()) {
+  // Deserializing the per-initializer type/shape information is independent work and dominates construction
+  // time for transformer-scale graphs with thousands of initializers. Build the TypeProtos in parallel on a
+  // transient pool, then do the map/NodeArg linkage below in a single-threaded pass.
+  auto& initializer_list = *graph_proto_->mutable_initializer();
+  const int num_initializers = initializer_list.size();
+  std::vector<TypeProto> initializer_types(static_cast<size_t>(num_initializers));
+  {
+    const auto build_type = [&](std::ptrdiff_t i) {
+      initializer_types[static_cast<size_t>(i)] = TypeProtoFromTensorProto(initializer_list[static_cast<int>(i)]);
+    };
+
+    // Keep the threshold high enough that small graphs never pay the pool construction cost.
+    constexpr int kMinInitializersForParallelLoad = 512;
+    const int degree_of_parallelism =
+        std::min(Env::Default().GetNumPhysicalCpuCores(), num_initializers / kMinInitializersForParallelLoad);
+    if (degree_of_parallelism > 1) {
+      concurrency::ThreadPool pool(&Env::Default(), ThreadOptions{}, ORT_TSTR("GraphLoad"),
+                                   degree_of_parallelism, /*low_latency_hint=*/true);
+      concurrency::ThreadPool::TrySimpleParallelFor(&pool, num_initializers, build_type);
+    } else {
+      for (std::ptrdiff_t i = 0; i < num_initializers; ++i) {
+        build_type(i);
+      }
+    }
+  }
+
+  for (int initializer_idx = 0; initializer_idx < num_initializers; ++initializer_idx) {
+    auto& tensor = initializer_list[initializer_idx];
     auto p = name_to_initial_tensor_.emplace(tensor.name(), &tensor);
     if (!p.second) {
       LOGS(logger_, WARNING) << "Duplicate initializer (dense, sparse or ConstantNode): '" << tensor.name()
@@ -1325,7 +1346,7 @@ Graph::Graph(const Model& owning_model,
     }
 
     NodeArg* matching_graph_input = GetNodeArg(tensor.name());
-    TypeProto t{TypeProtoFromTensorProto(tensor)};
+    TypeProto& t = initializer_types[static_cast<size_t>(initializer_idx)];
 
     if (!utils::HasElemType(t.tensor_type())) {
       ORT_THROW("This is an invalid model. Tensor does not have type information.");
@@ -3081,6 +3102,81 @@ common::Status Graph::TypeCheckInputsAndInitializers() {
   return Status::OK();
 }
 
+Status Graph::InferAndVerifyTypeMatchByLevels(const ResolveOptions& options) {
+  // Group the topologically sorted nodes into levels where every node's inputs are produced at an
+  // earlier level, then infer each level with independent nodes running concurrently. Nodes that
+  // recurse into subgraph inferencing (control flow) or may expand a function body are inferred
+  // serially at their level, so the recursion and any graph mutation stay on this thread.
+  std::vector<size_t> node_level(MaxNodeIndex(), 0);
+  size_t max_level = 0;
+  for (auto node_index : nodes_in_topological_order_) {
+    const Node& node = *GetNode(node_index);
+    size_t level = 0;
+    for (auto edge_it = node.InputEdgesBegin(), end = node.InputEdgesEnd(); edge_it != end; ++edge_it) {
+      level = std::max(level, node_level[edge_it->GetNode().Index()] + 1);
+    }
+    node_level[node_index] = level;
+    max_level = std::max(max_level, level);
+  }
+
+  std::vector<InlinedVector<NodeIndex>> levels(max_level + 1);
+  for (auto node_index : nodes_in_topological_order_) {
+    levels[node_level[node_index]].push_back(node_index);
+  }
+
+  auto is_parallel_safe = [](const Node& node) {
+    if (node.ContainsSubgraph()) {
+      return false;
+    }
+    const auto* schema = node.Op();
+    return schema != nullptr && !schema->HasFunction() && !schema->HasContextDependentFunction();
+  };
+
+  for (const auto& level_nodes : levels) {
+    InlinedVector<NodeIndex> parallel_nodes;
+    parallel_nodes.reserve(level_nodes.size());
+
+    for (auto node_index : level_nodes) {
+      Node& node = *GetNode(node_index);
+      if (is_parallel_safe(node)) {
+        parallel_nodes.push_back(node_index);
+      } else {
+        NO_CHANGE_ON_SYNC_FLAG(ORT_RETURN_IF_ERROR(InferAndVerifyTypeMatch(node, *node.Op(), options)));
+      }
+    }
+
+    if (parallel_nodes.size() == 1) {
+      Node& node = *GetNode(parallel_nodes.front());
+      NO_CHANGE_ON_SYNC_FLAG(ORT_RETURN_IF_ERROR(InferAndVerifyTypeMatch(node, *node.Op(), options)));
+    } else if (!parallel_nodes.empty()) {
+      std::vector<Status> statuses(parallel_nodes.size());
+      const bool sync_needed = GraphProtoSyncNeeded();
+      concurrency::ThreadPool::TrySimpleParallelFor(
+          options.thread_pool, narrow<std::ptrdiff_t>(parallel_nodes.size()),
+          [&](std::ptrdiff_t idx) {
+            Node& node = *GetNode(parallel_nodes[idx]);
+            ORT_TRY {
+              statuses[idx] = InferAndVerifyTypeMatch(node, *node.Op(), options);
+            }
+            ORT_CATCH(const std::exception& ex) {
+              ORT_HANDLE_EXCEPTION([&]() {
+                statuses[idx] = ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Node (", node.Name(), ") Op (", node.OpType(),
+                                                ") ", ex.what());
+              });
+            }
+          });
+      GraphProtoSyncNeeded(sync_needed);
+
+      // report the failure of the earliest node in the level, as the serial pass would
+      for (const auto& status : statuses) {
+        ORT_RETURN_IF_ERROR(status);
+      }
+    }
+  }
+
+  return Status::OK();
+}
+
 Status Graph::VerifyNodeAndOpMatch(const ResolveOptions& options) {
   CheckerContext ctx;
   ctx.set_ir_version(gsl::narrow_cast<int>(IrVersion()));
@@ -3113,6 +3209,12 @@ Status Graph::VerifyNodeAndOpMatch(const ResolveOptions& options) {
     lsc.output_names.insert(std::string(input));
   }
 
+  // With a thread pool, type/shape inference is pulled out of the per-node validation loop below
+  // (which is inherently serial since the lexical scope accumulates node outputs) and run in a
+  // level-synchronous pass where independent nodes are inferred concurrently. The checker and
+  // attribute handling below do not depend on inferred types, so deferring inference is safe.
+  const bool deferred_type_inference = options.thread_pool != nullptr && nodes_in_topological_order_.size() > 1;
+
   for (auto node_index : nodes_in_topological_order_) {
     // Node verification.
     auto& node = *GetNode(node_index);
@@ -3202,7 +3304,9 @@ Status Graph::VerifyNodeAndOpMatch(const ResolveOptions& options) {
       }
     }
 
-    NO_CHANGE_ON_SYNC_FLAG(ORT_RETURN_IF_ERROR(InferAndVerifyTypeMatch(node, *p_op, options)));
+    if (!deferred_type_inference) {
+      NO_CHANGE_ON_SYNC_FLAG(ORT_RETURN_IF_ERROR(InferAndVerifyTypeMatch(node, *p_op, options)));
+    }
 
     // Accumulate output names of the iterated Node
     for (const auto& output : node.OutputDefs()) {
@@ -3210,6 +3314,10 @@ Status Graph::VerifyNodeAndOpMatch(const ResolveOptions& options) {
     }
   }
 
+  if (deferred_type_inference) {
+    ORT_RETURN_IF_ERROR(InferAndVerifyTypeMatchByLevels(options));
+  }
+
   // verify subgraphs
   for (auto node_index : nodes_in_topological_order_) {
     auto& node = *GetNode(node_index);
@@ -4571,7 +4679,7 @@ Status Graph::PopulateNodeArgToProducerConsumerLookupsFromNodes() {
 GSL_SUPPRESS(r .11)
 gsl::not_null<Node*> Graph::AllocateNode() {
   ORT_ENFORCE(nodes_.size() < static_cast<unsigned int>(std::numeric_limits<int>::max()));
-  std::unique_ptr<Node> new_node(new Node(nodes_.size(), *this));
+  GraphArenaPtr<Node> new_node{graph_arena_.Make<Node>(nodes_.size(), *this)};
   Node* node{new_node.get()};
 
   nodes_.push_back(std::move(new_node));
@@ -5495,7 +5603,8 @@ common::Status Graph::LoadFromOrtFormat(const onnxruntime::fbs::Graph& fbs_graph
       ORT_RETURN_IF(nullptr == fbs_value_info, "NodeArg is missing. Invalid ORT format model.");
       NodeArgInfo node_arg_info;
       ORT_RETURN_IF_ERROR(fbs::utils::LoadValueInfoOrtFormat(*fbs_value_info, node_arg_info));
-      node_args_[fbs_value_info->name()->str()] = std::make_unique<NodeArg>(std::move(node_arg_info));
+      node_args_[fbs_value_info->name()->str()] =
+          GraphArenaPtr<NodeArg>{graph_arena_.Make<NodeArg>(std::move(node_arg_info))};
     }
   }
 
@@ -5512,8 +5621,8 @@ common::Status Graph::LoadFromOrtFormat(const onnxruntime::fbs::Graph& fbs_graph
   if (fbs_nodes != nullptr) {
     for (const auto* fbs_node : *fbs_nodes) {
       ORT_RETURN_IF(nullptr == fbs_node, "Node is missing. Invalid ORT format model.");
-      std::unique_ptr<Node> node;
-      ORT_RETURN_IF_ERROR(Node::LoadFromOrtFormat(*fbs_node, *this, load_options, logger_, node));
+      GraphArenaPtr<Node> node{graph_arena_.Make<Node>(fbs_node->index(), *this)};
+      ORT_RETURN_IF_ERROR(node->LoadFromOrtFormat(*fbs_node, load_options, logger_));
       ORT_RETURN_IF(node->Index() >= fbs_graph.max_node_index(), "Node index is out of range");
       nodes_[node->Index()] = std::move(node);
       ++num_of_nodes_;
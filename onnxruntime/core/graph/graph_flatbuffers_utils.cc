@@ -3,6 +3,8 @@
 
 #include "graph_flatbuffers_utils.h"
 
+#include <cstring>
+
 #include "core/common/flatbuffers.h"
 
 #include "core/common/narrow.h"
@@ -58,6 +60,13 @@ Status SaveInitializerOrtFormat(flatbuffers::FlatBufferBuilder& builder,
       ORT_RETURN_IF_ERROR(external_writer(src_type, unpacked_tensor, offset));
       external_data_offset = onnxruntime::narrow<int64_t>(offset);  // offset in fb is int64_t so -1 can mark not in use
     } else {
+      if (unpacked_tensor.size() >= kMinimumSizeForInPlaceUsage) {
+        // pad so the data is aligned when used in place from a memory mapped model file.
+        // see the can_use_flatbuffer_for_initializers handling in LoadInitializerOrtFormat.
+        // smaller initializers are copied at load time so padding them would only grow the model.
+        builder.ForceVectorAlignment(unpacked_tensor.size(), sizeof(uint8_t), kInitializerRawDataAlignment);
+      }
+
       raw_data = builder.CreateVector(unpacked_tensor.data(), unpacked_tensor.size());
     }
   }
@@ -193,6 +202,41 @@ Status SaveAttributeOrtFormat(flatbuffers::FlatBufferBuilder& builder,
 #undef GET_FBS_ATTR
 #undef GET_DATA_VEC
 
+Status SavePrePackedWeightsOrtFormat(flatbuffers::FlatBufferBuilder& builder,
+                                     const std::string& target_isa,
+                                     const std::unordered_map<std::string, PrePackedWeights>& prepacked_weights,
+                                     flatbuffers::Offset<fbs::PrePackedWeightsForIsa>& fbs_prepacked_weights) {
+  std::vector<flatbuffers::Offset<fbs::PrePackedWeightEntry>> entries;
+  entries.reserve(prepacked_weights.size());
+
+  for (const auto& [key, packed_weight] : prepacked_weights) {
+    ORT_RETURN_IF_NOT(packed_weight.buffers_.size() == packed_weight.buffer_sizes_.size(),
+                      "Mismatch between the number of pre-packed buffers and buffer sizes for ", key);
+
+    std::vector<flatbuffers::Offset<fbs::PrePackedBuffer>> buffers;
+    buffers.reserve(packed_weight.buffers_.size());
+
+    for (size_t i = 0; i < packed_weight.buffers_.size(); ++i) {
+      const void* buffer_data = packed_weight.buffers_[i].get();
+      if (buffer_data == nullptr) {
+        // preserve the null place-holder some kernels record for buffer positions they don't populate
+        buffers.push_back(fbs::CreatePrePackedBuffer(builder, true /* is_null */));
+      } else {
+        auto data = builder.CreateVector(static_cast<const uint8_t*>(buffer_data),
+                                         packed_weight.buffer_sizes_[i]);
+        buffers.push_back(fbs::CreatePrePackedBuffer(builder, false /* is_null */, data));
+      }
+    }
+
+    auto fbs_key = builder.CreateString(key);
+    entries.push_back(fbs::CreatePrePackedWeightEntry(builder, fbs_key, builder.CreateVector(buffers)));
+  }
+
+  fbs_prepacked_weights = fbs::CreatePrePackedWeightsForIsaDirect(builder, target_isa.c_str(), &entries);
+
+  return Status::OK();
+}
+
 #endif
 
 /**
@@ -299,7 +343,7 @@ Status LoadInitializerOrtFormat(const fbs::Tensor& fbs_tensor, TensorProto& init
   } else {
     const auto* fbs_raw_data = fbs_tensor.raw_data();
     if (fbs_raw_data) {
-      if (load_options.can_use_flatbuffer_for_initializers && fbs_raw_data->size() > 127) {
+      if (load_options.can_use_flatbuffer_for_initializers && fbs_raw_data->size() >= kMinimumSizeForInPlaceUsage) {
         initializer.set_data_location(ONNX_NAMESPACE::TensorProto_DataLocation_EXTERNAL);
 
         static_assert(sizeof(void*) <= sizeof(ExternalDataInfo::OFFSET_TYPE));
@@ -457,6 +501,64 @@ Status LoadAttributeOrtFormat(const fbs::Attribute& fbs_attr,
   return Status::OK();
 }
 
+Status LoadPrePackedWeightsOrtFormat(const fbs::PrePackedWeightsForIsa& fbs_prepacked_weights,
+                                     const std::string& target_isa,
+                                     const AllocatorPtr& allocator,
+                                     std::unordered_map<std::string, PrePackedWeights>& prepacked_weights) {
+  const auto* fbs_target_isa = fbs_prepacked_weights.target_isa();
+  if (fbs_target_isa == nullptr || fbs_target_isa->string_view() != target_isa) {
+    // the weights were packed for a different ISA - ignore them and let the kernels pack as usual
+    return Status::OK();
+  }
+
+  const auto* fbs_entries = fbs_prepacked_weights.entries();
+  if (fbs_entries == nullptr) {
+    return Status::OK();
+  }
+
+  for (const auto* fbs_entry : *fbs_entries) {
+    ORT_RETURN_IF(nullptr == fbs_entry, "Missing pre-packed weight entry. Invalid ORT format model.");
+
+    const auto* fbs_key = fbs_entry->key();
+    ORT_RETURN_IF(nullptr == fbs_key, "Missing pre-packed weight entry key. Invalid ORT format model.");
+
+    const auto* fbs_buffers = fbs_entry->buffers();
+    ORT_RETURN_IF(nullptr == fbs_buffers, "Missing pre-packed weight buffers for ", fbs_key->str(),
+                  ". Invalid ORT format model.");
+
+    PrePackedWeights packed_weight;
+    packed_weight.buffers_.reserve(fbs_buffers->size());
+    packed_weight.buffer_sizes_.reserve(fbs_buffers->size());
+
+    for (const auto* fbs_buffer : *fbs_buffers) {
+      ORT_RETURN_IF(nullptr == fbs_buffer, "Missing pre-packed buffer for ", fbs_key->str(),
+                    ". Invalid ORT format model.");
+
+      if (fbs_buffer->is_null()) {
+        packed_weight.buffers_.push_back(IAllocatorUniquePtr<void>());
+        packed_weight.buffer_sizes_.push_back(0);
+        continue;
+      }
+
+      const auto* fbs_data = fbs_buffer->data();
+      ORT_RETURN_IF(nullptr == fbs_data, "Missing pre-packed buffer data for ", fbs_key->str(),
+                    ". Invalid ORT format model.");
+
+      // copy the buffer contents out of the flatbuffer so the loaded weights do not depend on it
+      // staying alive
+      auto buffer = IAllocator::MakeUniquePtr<void>(allocator, fbs_data->size(), true);
+      memcpy(buffer.get(), fbs_data->data(), fbs_data->size());
+
+      packed_weight.buffers_.push_back(std::move(buffer));
+      packed_weight.buffer_sizes_.push_back(fbs_data->size());
+    }
+
+    prepacked_weights.emplace(fbs_key->str(), std::move(packed_weight));
+  }
+
+  return Status::OK();
+}
+
 #ifdef ENABLE_TRAINING_APIS
 
 Status SaveOrtTensorOrtFormat(
@@ -5,11 +5,14 @@
 
 #include <memory>
 #include <filesystem>
+#include <string>
+#include <unordered_map>
 
 #include "core/common/flatbuffers.h"
 
 #include "core/common/status.h"
 #include "core/graph/ort_format_load_options.h"
+#include "core/framework/prepacked_weights.h"
 #include "core/framework/tensor.h"
 
 namespace ONNX_NAMESPACE {
@@ -33,6 +36,7 @@ class Logger;
 
 namespace fbs {
 struct Attribute;
+struct PrePackedWeightsForIsa;
 struct Tensor;
 
 #if !defined(DISABLE_SPARSE_TENSORS)
@@ -61,6 +65,19 @@ using ExternalDataReader = std::function<Status(uint64_t offset, gsl::span<uint8
 /// </remarks>
 constexpr uint32_t kMinimumSizeForExternalData = 64;
 
+/// <summary>
+/// Minimum number of bytes for initializer data stored in the flatbuffer to be used in place at load time
+/// instead of being copied. See OrtFormatLoadOptions::can_use_flatbuffer_for_initializers.
+/// </summary>
+constexpr uint32_t kMinimumSizeForInPlaceUsage = 128;
+
+/// <summary>
+/// Alignment for initializer raw data written to the flatbuffer.
+/// Initializers that are large enough to be used in place are padded to this boundary so that the pointers
+/// handed to kernels satisfy the preferred buffer alignment when the serialized bytes are memory mapped.
+/// </summary>
+constexpr size_t kInitializerRawDataAlignment = 64;
+
 /// <summary>
 /// Save an initializer to an ORT format flatbuffer.
 /// </summary>
@@ -90,6 +107,18 @@ Status SaveAttributeOrtFormat(
     flatbuffers::Offset<fbs::Attribute>& fbs_attr, const std::filesystem::path& model_path,
     const onnxruntime::Graph* subgraph);
 
+/// <summary>
+/// Save pre-packed weights captured during session initialization to an ORT format flatbuffer.
+/// </summary>
+/// <param name="builder">Builder to write the pre-packed weights with.</param>
+/// <param name="target_isa">Opaque string declaring the ISA the weights were packed for.</param>
+/// <param name="prepacked_weights">Pre-packed weights keyed by the consuming node input.</param>
+/// <param name="fbs_prepacked_weights">PrePackedWeightsForIsa in flatbuffer.</param>
+Status SavePrePackedWeightsOrtFormat(
+    flatbuffers::FlatBufferBuilder& builder, const std::string& target_isa,
+    const std::unordered_map<std::string, PrePackedWeights>& prepacked_weights,
+    flatbuffers::Offset<fbs::PrePackedWeightsForIsa>& fbs_prepacked_weights);
+
 /// <summary>
 /// Load an initializer from an ORT format flatbuffer.
 /// </summary>
@@ -109,6 +138,22 @@ Status LoadSparseInitializerOrtFormat(const fbs::SparseTensor& fbs_sparse_tensor
                                       const OrtFormatLoadOptions& load_options);
 #endif  // !defined(DISABLE_SPARSE_TENSORS)
 
+/// <summary>
+/// Load pre-packed weights from an ORT format flatbuffer.
+/// The buffer contents are copied out using `allocator` so the loaded weights do not depend on the
+/// flatbuffer staying alive.
+/// `prepacked_weights` is only populated if the serialized target ISA matches `target_isa`.
+/// </summary>
+/// <param name="fbs_prepacked_weights">Flatbuffer PrePackedWeightsForIsa</param>
+/// <param name="target_isa">Opaque string declaring the ISA this session expects the weights to be packed for.</param>
+/// <param name="allocator">Allocator to use for the buffer copies.</param>
+/// <param name="prepacked_weights">Pre-packed weights keyed by the consuming node input.</param>
+/// <returns>Status</returns>
+Status LoadPrePackedWeightsOrtFormat(const fbs::PrePackedWeightsForIsa& fbs_prepacked_weights,
+                                     const std::string& target_isa,
+                                     const AllocatorPtr& allocator,
+                                     std::unordered_map<std::string, PrePackedWeights>& prepacked_weights);
+
 // Load a give fbs::Attribute into AttributeProto
 // Note, If the attribute type is a graph, we will leave an empty graph in attr_proto,
 //       and set the deserialized Graph to the param graph
@@ -134,6 +134,52 @@ MlasGetPreferredBufferAlignment(
     void
     );
 
+/**
+ * @brief Returns a space separated list of the instruction set tiers the
+ *        library selected for this process, e.g. "sse2 avx avx2 avx512f".
+ *        Empty on targets without runtime dispatch decisions. Useful for
+ *        verifying at startup that a deployment landed on hardware with the
+ *        expected capabilities.
+*/
+const char*
+MLASCALL
+MlasGetDispatchSummary(
+    void
+    );
+
+/**
+ * @brief Returns a space separated list of the instruction set tiers the
+ *        current hardware supports, including tiers that were disabled via
+ *        MlasSetDisabledDispatchTiers. Tiers that stack on a disabled tier
+ *        are not probed and do not appear in the list. Comparing this
+ *        against MlasGetDispatchSummary shows which tiers an override
+ *        removed.
+*/
+const char*
+MLASCALL
+MlasGetSupportedDispatchTiers(
+    void
+    );
+
+/**
+ * @brief Disables the named instruction set tiers, space separated, e.g.
+ *        "avx512f amx-int8"; the library falls back to the next lower tier
+ *        as if the hardware lacked the capability. Tiers that stack on a
+ *        disabled tier are disabled with it, and baseline tiers ("sse2",
+ *        "neon") cannot be disabled. Intended for comparing kernel tiers on
+ *        the same hardware and for rolling back a problematic tier without
+ *        rebuilding. Must be called before any other MLAS routine runs;
+ *        pass nullptr or an empty string to clear.
+ *
+ * @return true if the override was stored, false if the dispatch tables
+ *         were already initialized (the override is ignored).
+*/
+bool
+MLASCALL
+MlasSetDisabledDispatchTiers(
+    const char* Tiers
+    );
+
 #ifdef MLAS_TARGET_AMD64_IX86
 
 /**
@@ -162,6 +208,7 @@ enum MLAS_ACTIVATION_KIND {
     MlasLogisticActivation,
     MlasClipActivation,
     MlasHardSigmoidActivation,
+    MlasAffineActivation,
     MlasActivationKindCount,
 };
 
@@ -179,6 +226,10 @@ struct MLAS_ACTIVATION {
             float alpha;
             float beta;
         } HardSigmoid;
+        struct {
+            float alpha;
+            float beta;
+        } Affine;
         float Values[2];
     } Parameters;
 };
@@ -194,6 +245,18 @@ MlasActivation(
     size_t ldc
     );
 
+void
+MLASCALL
+MlasActivationChain(
+    const MLAS_ACTIVATION* Activations,
+    size_t ActivationCount,
+    float* Buffer,
+    const float* Bias,
+    size_t M,
+    size_t N,
+    size_t ldc
+    );
+
 //
 // Matrix/matrix multiply routines.
 // C := alpha * op(A) * op(B) + beta * C
@@ -242,6 +305,43 @@ MlasGemmBatch(
     MLAS_THREADPOOL* ThreadPool
     );
 
+/**
+ * @brief Supply the shape and data information of one group to the grouped
+ *        single precision gemm function.
+ */
+struct MLAS_SGEMM_GROUP_PARAMS {
+    size_t M = 0;                 /**< Supplies the number of rows of matrix A and matrix C. */
+    size_t N = 0;                 /**< Supplies the number of columns of matrix B and matrix C. */
+    size_t K = 0;                 /**< Supplies the number of columns of matrix A and rows of matrix B. */
+    MLAS_SGEMM_DATA_PARAMS Data;  /**< Supplies the matrices data parameters. */
+};
+
+/**
+ * @brief  Grouped single precision matrix/matrix multiply operation (SGEMM)
+ *
+ * Unlike MlasGemmBatch, every group carries its own M/N/K, so ragged batches
+ * (mixture-of-experts FFNs, per-image proposals, uneven attention heads) run
+ * through a single thread pool dispatch instead of one MlasGemm call per
+ * group. Threads are budgeted per group in proportion to its arithmetic
+ * complexity, using the same partitioning as MlasGemmBatch within each group.
+ *
+ * @param TransA     Supplies the transpose operation for the A matrices.
+ * @param TransB     Supplies the transpose operation for the B matrices.
+ * @param Groups     A array of per-group shapes and matrices data parameters.
+ * @param GroupCount Supplies the number of groups.
+ * @param ThreadPool Supplies the thread pool object to use, else nullptr if the
+                     base library threading support should be used.
+ */
+void
+MLASCALL
+MlasGemmGrouped(
+    CBLAS_TRANSPOSE TransA,
+    CBLAS_TRANSPOSE TransB,
+    const MLAS_SGEMM_GROUP_PARAMS* Groups,
+    size_t GroupCount,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
 /**
  * @brief  Single precision matrix/matrix multiply operation (SGEMM)
  *
@@ -755,6 +855,7 @@ enum MLAS_CONV_ALGORITHM {
     MlasConvAlgorithmGemmDirect,
     MlasConvAlgorithmExpandThenGemm,
     MlasConvAlgorithmExpandThenGemmSegmented,
+    MlasConvAlgorithmWinograd,
 #if defined(MLAS_TARGET_WASM_SCALAR)
     MlasConvAlgorithmDepthwise,
 #endif
@@ -762,6 +863,10 @@ enum MLAS_CONV_ALGORITHM {
 
 struct MLAS_CONV_PARAMETERS {
     const MLAS_ACTIVATION* Activation;
+    // Number of post operation stages at Activation. MlasConvPrepare sets this to 1; callers
+    // fusing a chain of elementwise stages point Activation at a contiguous array and update
+    // the count before calling MlasConv.
+    size_t ActivationCount;
     size_t Dimensions;
     size_t BatchCount;
     size_t GroupCount;
@@ -787,6 +892,11 @@ struct MLAS_CONV_PARAMETERS {
         struct {
             size_t ThreadStrideN;
         } ExpandThenGemmSegmented;
+        struct {
+            size_t TilesH;
+            size_t TilesW;
+            size_t TileCount;
+        } Winograd;
     } u;
 };
 
@@ -808,6 +918,15 @@ MlasConvPrepare(MLAS_CONV_PARAMETERS* Parameters,
                 float Beta,
                 MLAS_THREADPOOL* ThreadPool);
 
+bool
+MLASCALL
+MlasConvOverrideAlgorithm(
+    MLAS_CONV_PARAMETERS* Parameters,
+    MLAS_CONV_ALGORITHM Algorithm,
+    size_t* WorkingBufferSize,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
 void
 MLASCALL
 MlasConv(
@@ -1643,7 +1762,7 @@ MlasHalfGemmConvertPackB(
     void* PackedB
     );
 
-#if defined(__aarch64__) && defined(__linux__)
+#if (defined(__aarch64__) || defined(__x86_64__)) && defined(__linux__)
 /**
  * @brief Whether current CPU supports Bfloat16(bf16) acceleration.
  */
@@ -1754,7 +1873,7 @@ MlasSBGemmPackBSize(size_t N, size_t K);
  */
 void MLASCALL
 MlasSBGemmConvertPackB(size_t N, size_t K, const float* B, size_t ldb, void* PackedB);
-#endif
+#endif  // (defined(__aarch64__) || defined(__x86_64__)) && defined(__linux__)
 
 /**
  * @brief Indirect Depthwise convolution for fp16
@@ -1855,6 +1974,12 @@ struct MlasFlashAttentionThreadedArgs {
     const float* key;
     const float* value;
     float* output;
+    const float* attention_bias;          // optional additive bias for QK^T scores with shape
+                                          // [batch or 1, num_heads or 1, q_sequence_length, kv_sequence_length],
+                                          // or nullptr
+    bool broadcast_attention_bias_batch;  // attention_bias batch dimension is 1
+    bool broadcast_attention_bias_head;   // attention_bias head dimension is 1
+    bool causal;                          // apply a lower triangular (unidirectional) mask to the scores
 };
 
 /**
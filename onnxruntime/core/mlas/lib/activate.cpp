@@ -234,6 +234,33 @@ struct MLAS_ACTIVATION_FUNCTION<MlasHardSigmoidActivation>
     }
 };
 
+template<>
+struct MLAS_ACTIVATION_FUNCTION<MlasAffineActivation>
+{
+    MLAS_FLOAT32X4 AlphaBroadcast;
+    MLAS_FLOAT32X4 BetaBroadcast;
+
+    MLAS_ACTIVATION_FUNCTION(const MLAS_ACTIVATION* Activation)
+    {
+        AlphaBroadcast = MlasBroadcastFloat32x4(&Activation->Parameters.Affine.alpha);
+        BetaBroadcast = MlasBroadcastFloat32x4(&Activation->Parameters.Affine.beta);
+    }
+
+    MLAS_FLOAT32X4 Activate(MLAS_FLOAT32X4 Value)
+    {
+        return MlasMultiplyAddFloat32x4(Value, AlphaBroadcast, BetaBroadcast);
+    }
+
+    float Activate(float Value)
+    {
+#if defined(MLAS_SSE2_INTRINSICS)
+        return _mm_cvtss_f32(Activate(_mm_set_ss(Value)));
+#else
+        return MlasExtractLaneFloat32x4<0>(AlphaBroadcast) * Value + MlasExtractLaneFloat32x4<0>(BetaBroadcast);
+#endif
+    }
+};
+
 template<MLAS_ACTIVATION_KIND ActivationKind, bool AddBias>
 void
 MlasActivationKernel(
@@ -512,6 +539,12 @@ Return Value:
             break;
         }
 
+        case MlasAffineActivation:
+        {
+            MlasActivationKernel<MlasAffineActivation>(Activation, Buffer, Bias, M, N, ldc);
+            break;
+        }
+
         case MlasActivationKindCount:
         {
             MLAS_THROW_EX(std::runtime_error, "bad mlas activation kind");
@@ -519,3 +552,66 @@ Return Value:
         }
     }
 }
+
+void
+MLASCALL
+MlasActivationChain(
+    const MLAS_ACTIVATION* Activations,
+    size_t ActivationCount,
+    float* Buffer,
+    const float* Bias,
+    size_t M,
+    size_t N,
+    size_t ldc
+    )
+/*++
+
+Routine Description:
+
+    This routine applies a chain of elementwise post operations to the output
+    matrix after optionally adding a bias vector. The first stage is fused with
+    the bias addition; each remaining stage is one vectorized pass over the
+    same output tile, which the caller typically invokes per segment while the
+    tile is still cache resident.
+
+Arguments:
+
+    Activations - Supplies the parameters for the post operation stages,
+        applied in order.
+
+    ActivationCount - Supplies the number of stages.
+
+    Buffer - Supplies the output matrix.
+
+    Bias - Supplies the optional bias vector.
+
+    M - Supplies the number of elements of the bias vector and the number of
+        rows in the output matrix.
+
+    N - Supplies the number of columns of the output matrix.
+
+    ldc - Supplies the number of elements per row of the output matrix.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    if (ActivationCount == 0) {
+
+        if (Bias != nullptr) {
+            MLAS_ACTIVATION IdentityActivation;
+            IdentityActivation.ActivationKind = MlasIdentityActivation;
+            MlasActivation(&IdentityActivation, Buffer, Bias, M, N, ldc);
+        }
+
+        return;
+    }
+
+    MlasActivation(&Activations[0], Buffer, Bias, M, N, ldc);
+
+    for (size_t i = 1; i < ActivationCount; i++) {
+        MlasActivation(&Activations[i], Buffer, nullptr, M, N, ldc);
+    }
+}
@@ -487,6 +487,151 @@ Return Value:
     return Accumulator;
 }
 
+float
+MlasComputeOnlineMaxSumExpF32Kernel(
+    const float* Input,
+    size_t N,
+    float* Maximum
+)
+/*++
+
+Routine Description:
+
+    This routine computes the maximum value of the supplied buffer and the sum
+    of exp(Input[i] - Maximum) in a single streaming pass over the input using
+    the online softmax recurrence: whenever the running maximum rises, the
+    accumulated sum is rescaled by exp(OldMaximum - NewMaximum).
+
+    For rows too large to stay resident in cache this halves the memory
+    traffic of the separate maximum and sum-of-exponentials sweeps.
+
+Arguments:
+
+    Input - Supplies the input buffer.
+
+    N - Supplies the number of elements to process.
+
+    Maximum - Receives the maximum value of the supplied buffer.
+
+Return Value:
+
+    Returns the sum of the shifted exponential functions of the input buffer.
+
+--*/
+{
+    float RowMaximum = MlasMinimumF32Value;
+    float Accumulation = 0.0f;
+
+    if (N >= 4) {
+        MLAS_FLOAT32X4 MaximumVector = MlasBroadcastFloat32x4(RowMaximum);
+        MLAS_FLOAT32X4 AccumulatorVector = MlasZeroFloat32x4();
+
+        while (N >= 4) {
+            MLAS_FLOAT32X4 Vector = MlasLoadFloat32x4(Input);
+            MLAS_FLOAT32X4 NewMaximumVector = MlasMaximumFloat32x4(MaximumVector, Vector);
+
+            MLAS_FLOAT32X4 Correction =
+                MlasComputeExpVector(MlasSubtractFloat32x4(MaximumVector, NewMaximumVector));
+            AccumulatorVector = MlasMultiplyAddFloat32x4(
+                AccumulatorVector, Correction,
+                MlasComputeExpVector(MlasSubtractFloat32x4(Vector, NewMaximumVector)));
+
+            MaximumVector = NewMaximumVector;
+
+            Input += 4;
+            N -= 4;
+        }
+
+        //
+        // Reduce the per-lane maximums and rescale each lane's accumulation to
+        // be relative to the shared row maximum before reducing the sum.
+        //
+
+        RowMaximum = MlasReduceMaximumFloat32x4(MaximumVector);
+
+        MLAS_FLOAT32X4 RowMaximumVector = MlasBroadcastFloat32x4(RowMaximum);
+        AccumulatorVector = MlasMultiplyFloat32x4(
+            AccumulatorVector, MlasComputeExpVector(MlasSubtractFloat32x4(MaximumVector, RowMaximumVector)));
+        Accumulation = MlasReduceAddFloat32x4(AccumulatorVector);
+    }
+
+    while (N > 0) {
+        float Value = *Input;
+
+        if (Value > RowMaximum) {
+            Accumulation *= expf(RowMaximum - Value);
+            RowMaximum = Value;
+        }
+
+        Accumulation += expf(Value - RowMaximum);
+
+        Input += 1;
+        N -= 1;
+    }
+
+    *Maximum = RowMaximum;
+
+    return Accumulation;
+}
+
+void
+MlasComputeExpScaleF32Kernel(
+    const float* Input,
+    float* Output,
+    size_t N,
+    float NegativeMaximum,
+    float Scale
+)
+/*++
+
+Routine Description:
+
+    This routine computes Output[i] = exp(Input[i] + NegativeMaximum) * Scale.
+
+    It produces the normalized softmax output directly from the input buffer,
+    for use with MlasComputeOnlineMaxSumExpF32Kernel which does not store the
+    intermediate exponentials.
+
+Arguments:
+
+    Input - Supplies the input buffer.
+
+    Output - Supplies the output buffer.
+
+    N - Supplies the number of elements to process.
+
+    NegativeMaximum - Supplies the negated maximum value of the input buffer.
+
+    Scale - Supplies the reciprocal of the sum of the shifted exponentials.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const MLAS_FLOAT32X4 NegativeMaximumVector = MlasBroadcastFloat32x4(NegativeMaximum);
+    const MLAS_FLOAT32X4 ScaleVector = MlasBroadcastFloat32x4(Scale);
+
+    while (N >= 4) {
+        MLAS_FLOAT32X4 Vector = MlasAddFloat32x4(MlasLoadFloat32x4(Input), NegativeMaximumVector);
+        Vector = MlasMultiplyFloat32x4(MlasComputeExpVector(Vector), ScaleVector);
+        MlasStoreFloat32x4(Output, Vector);
+
+        Input += 4;
+        Output += 4;
+        N -= 4;
+    }
+
+    while (N > 0) {
+        *Output = expf(*Input + NegativeMaximum) * Scale;
+
+        Input += 1;
+        Output += 1;
+        N -= 1;
+    }
+}
+
 float
 MLASCALL
 MlasReduceMaximumF32Kernel(
@@ -829,6 +974,18 @@ Return Value:
     const float* Input = WorkBlock->Input + n * D;
     float* Output = WorkBlock->Output + n * D;
 
+    //
+    // For rows too large to stay resident in the fastest cache levels the
+    // separate maximum/sum/normalize sweeps become memory bound, so fuse the
+    // maximum and sum-of-exponentials sweeps into a single streaming pass
+    // using the online softmax recurrence. The smooth softmax variant clamps
+    // the maximum before accumulating, which the online recurrence does not
+    // support, so it keeps the multi-pass path.
+    //
+
+    constexpr size_t OnlineSoftmaxMinimumDimension = 4096;
+    const bool UseOnlineSoftmax = !SmoothSoftmax && (D >= OnlineSoftmaxMinimumDimension);
+
 #if defined(MLAS_SSE2_INTRINSICS)
     // TODO: Use std::hardware_constructive_interference_size
     constexpr size_t CacheLineSize = 64;
@@ -846,6 +1003,28 @@ Return Value:
         }
 #endif
 
+        if (UseOnlineSoftmax) {
+            float Maximum;
+            float Accumulation = MlasComputeOnlineMaxSumExpF32Kernel(Input, D, &Maximum);
+
+            if (LogSoftmax) {
+                float Parameters[] = {-Maximum, std::log(Accumulation)};
+
+#if defined(MLAS_TARGET_AMD64) || defined(MLAS_TARGET_LARCH64)
+                GetMlasPlatform().ComputeLogSoftmaxOutputF32Kernel(Input, Output, D, Parameters);
+#else
+                MlasComputeLogSoftmaxOutputF32Kernel(Input, Output, D, Parameters);
+#endif
+            } else {
+                MlasComputeExpScaleF32Kernel(Input, Output, D, -Maximum, 1.0f / Accumulation);
+            }
+
+            Input += D;
+            Output += D;
+            CountN--;
+            continue;
+        }
+
         //
         // Find the maximum value for the row.
         //
@@ -601,7 +601,7 @@ Return Value:
         // Apply the activation with optional bias.
         //
 
-        MlasActivation(Parameters->Activation, SegmentOutput, Bias, FilterCount,
+        MlasActivationChain(Parameters->Activation, Parameters->ActivationCount, SegmentOutput, Bias, FilterCount,
             CountN, OutputSize);
     }
 }
@@ -724,7 +724,7 @@ Return Value:
             bias += group * FilterCount;
         }
 
-        MlasActivation(Parameters->Activation, output, bias, FilterCount,
+        MlasActivationChain(Parameters->Activation, Parameters->ActivationCount, output, bias, FilterCount,
             OutputSize, OutputSize);
     }
 }
@@ -943,7 +943,7 @@ Return Value:
                     // Apply the activation with optional bias.
                     //
 
-                    MlasActivation(Parameters->Activation, Output, bias, FilterCount,
+                    MlasActivationChain(Parameters->Activation, Parameters->ActivationCount, Output, bias, FilterCount,
                         OutputSize, OutputSize);
 
                     break;
@@ -970,7 +970,7 @@ Return Value:
                     // Apply the activation with optional bias.
                     //
 
-                    MlasActivation(Parameters->Activation, Output, bias, FilterCount,
+                    MlasActivationChain(Parameters->Activation, Parameters->ActivationCount, Output, bias, FilterCount,
                         OutputSize, OutputSize);
 
                     break;
@@ -981,12 +981,32 @@ Return Value:
                 case MlasConvAlgorithmDepthwise:
                 {
                     MlasConvDepthwiseFloat_CHW(Parameters, Input, filter, Output, WorkingBuffer);
-                    MlasActivation(Parameters->Activation, Output, bias, FilterCount, OutputSize, OutputSize);
+                    MlasActivationChain(Parameters->Activation, Parameters->ActivationCount, Output, bias, FilterCount, OutputSize, OutputSize);
                     break;
                 }
 
 #endif
 
+                case MlasConvAlgorithmWinograd:
+                {
+                    //
+                    // Transform the input and filter tensors, batch the
+                    // element-wise products as GEMM operations, and transform
+                    // the results back to the output tensor.
+                    //
+
+                    MlasConvWinograd(Parameters, Input, filter, WorkingBuffer, Output, ThreadPool);
+
+                    //
+                    // Apply the activation with optional bias.
+                    //
+
+                    MlasActivationChain(Parameters->Activation, Parameters->ActivationCount, Output, bias, FilterCount,
+                        OutputSize, OutputSize);
+
+                    break;
+                }
+
                 case MlasConvAlgorithmExpandThenGemmSegmented:
                 {
                     //
@@ -1023,6 +1043,95 @@ Return Value:
 // Chance of arithmetic overflow could be reduced
 #pragma warning(disable : 26451)
 #endif
+
+static
+void
+MlasConvPrepareExpandThenGemmSegmented(
+    MLAS_CONV_PARAMETERS* Parameters,
+    size_t* WorkingBufferSize,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine computes the thread partitioning parameters and working
+    buffer size for the segmented expand then GEMM algorithm.
+
+Arguments:
+
+    Parameters - Supplies the structure that stores the provided and computed
+        parameters for the convolution operation.
+
+    WorkingBufferSize - Receives the number of elements to allocate for the
+        working buffer for intermediate results.
+
+    ThreadPool - Supplies the thread pool object to use, else nullptr if the
+        base library threading support should be used.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const size_t FilterCount = Parameters->FilterCount;
+    const size_t OutputSize = Parameters->OutputSize;
+    const size_t K = Parameters->K;
+
+    //
+    // Segment the operation across multiple threads by slicing the N
+    // dimension (see MlasSgemmTryMultithread).
+    //
+    // Compute the number of target threads given the complexity of the
+    // convolution operation. Small requests should run using the single
+    // threaded path.
+    //
+
+    ptrdiff_t TargetThreadCount;
+    double Complexity = double(FilterCount) * double(OutputSize) * double(K);
+
+    if (Complexity < double(MLAS_SGEMM_THREAD_COMPLEXITY * MLAS_MAXIMUM_THREAD_COUNT)) {
+        TargetThreadCount = ptrdiff_t(Complexity / double(MLAS_SGEMM_THREAD_COMPLEXITY)) + 1;
+    } else {
+        TargetThreadCount = MLAS_MAXIMUM_THREAD_COUNT;
+    }
+
+    ptrdiff_t MaximumThreadCount = MlasGetMaximumThreadCount(ThreadPool);
+
+    if (TargetThreadCount >= MaximumThreadCount) {
+        TargetThreadCount = MaximumThreadCount;
+    }
+
+    //
+    // Compute the thread stride for slicing the N dimension.
+    //
+
+    size_t StrideN = OutputSize / TargetThreadCount;
+
+    if ((StrideN * TargetThreadCount) != OutputSize) {
+        StrideN++;
+    }
+
+    if (TargetThreadCount > 1) {
+
+        StrideN = (StrideN + MLAS_SGEMM_STRIDEN_THREAD_ALIGN - 1) & ~(MLAS_SGEMM_STRIDEN_THREAD_ALIGN - 1);
+
+        if (StrideN >= OutputSize) {
+            TargetThreadCount = 1;
+        } else if (StrideN * (TargetThreadCount - 1) >= OutputSize) {
+            TargetThreadCount--;
+        }
+    }
+
+    Parameters->ThreadCount = TargetThreadCount;
+
+    Parameters->Algorithm = MlasConvAlgorithmExpandThenGemmSegmented;
+    Parameters->u.ExpandThenGemmSegmented.ThreadStrideN = StrideN;
+
+    *WorkingBufferSize = TargetThreadCount * MLAS_CONV_WORKING_BUFFER_SIZE_PER_THREAD;
+}
+
 void
 MLASCALL
 MlasConvPrepare(
@@ -1099,6 +1208,7 @@ Return Value:
     //
 
     Parameters->Activation = Activation;
+    Parameters->ActivationCount = 1;
     Parameters->BatchCount = BatchCount;
     Parameters->GroupCount = GroupCount;
     Parameters->InputChannels = InputChannels;
@@ -1211,6 +1321,34 @@ Return Value:
         }
     }
 
+    //
+    // Detect 3x3 stride-1 convolutions that benefit from the Winograd
+    // F(2x2,3x3) transform. The channel and output size thresholds keep
+    // the transform overhead small relative to the 2.25x reduction of the
+    // GEMM arithmetic, and exclude depthwise and other narrow shapes that
+    // are better served by the direct paths below.
+    //
+
+    if (Dimensions == 2 && AllStridesAreOne && AllDilationsAreOne &&
+        Parameters->KernelShape[0] == 3 && Parameters->KernelShape[1] == 3 &&
+        InputChannels >= 32 && FilterCount >= 32 && OutputSize >= 196) {
+
+        const size_t TilesH = (Parameters->OutputShape[0] + 1) / 2;
+        const size_t TilesW = (Parameters->OutputShape[1] + 1) / 2;
+        const size_t TileCount = TilesH * TilesW;
+
+        Parameters->Algorithm = MlasConvAlgorithmWinograd;
+        Parameters->u.Winograd.TilesH = TilesH;
+        Parameters->u.Winograd.TilesW = TilesW;
+        Parameters->u.Winograd.TileCount = TileCount;
+
+        *WorkingBufferSize = 16 * (FilterCount * InputChannels +
+                                   InputChannels * TileCount +
+                                   FilterCount * TileCount);
+
+        return;
+    }
+
     if (FilterCount > OutputSize) {
 
         //
@@ -1244,57 +1382,159 @@ Return Value:
 
 #endif
 
-        //
-        // Segment the operation across multiple threads by slicing the N
-        // dimension (see MlasSgemmTryMultithread).
-        //
-        // Compute the number of target threads given the complexity of the
-        // convolution operation. Small requests should run using the single
-        // threaded path.
-        //
+        MlasConvPrepareExpandThenGemmSegmented(Parameters, WorkingBufferSize, ThreadPool);
+    }
+}
+
+bool
+MLASCALL
+MlasConvOverrideAlgorithm(
+    MLAS_CONV_PARAMETERS* Parameters,
+    MLAS_CONV_ALGORITHM Algorithm,
+    size_t* WorkingBufferSize,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
 
-        ptrdiff_t TargetThreadCount;
-        double Complexity = double(FilterCount) * double(OutputSize) * double(K);
+Routine Description:
 
-        if (Complexity < double(MLAS_SGEMM_THREAD_COMPLEXITY * MLAS_MAXIMUM_THREAD_COUNT)) {
-            TargetThreadCount = ptrdiff_t(Complexity / double(MLAS_SGEMM_THREAD_COMPLEXITY)) + 1;
-        } else {
-            TargetThreadCount = MLAS_MAXIMUM_THREAD_COUNT;
-        }
+    This routine attempts to override the algorithm selected by
+    MlasConvPrepare with the supplied algorithm. Callers that profile the
+    candidate algorithms against each other (such as an auto-tuner) can use
+    this routine to replay a previously measured choice instead of the
+    built-in heuristics.
+
+Arguments:
+
+    Parameters - Supplies the structure initialized by MlasConvPrepare. On
+        success, the algorithm selection and the algorithm specific fields
+        are updated in place.
+
+    Algorithm - Supplies the algorithm to select.
+
+    WorkingBufferSize - Receives the number of elements to allocate for the
+        working buffer for intermediate results.
+
+    ThreadPool - Supplies the thread pool object to use, else nullptr if the
+        base library threading support should be used.
+
+Return Value:
+
+    Returns true if the supplied algorithm can compute the prepared
+    convolution, else false and the parameters are unmodified.
+
+--*/
+{
+    const size_t Dimensions = Parameters->Dimensions;
+    const size_t InputChannels = Parameters->InputChannels;
+    const size_t FilterCount = Parameters->FilterCount;
+    const size_t OutputSize = Parameters->OutputSize;
+    const size_t K = Parameters->K;
+
+    bool AllStridesAreOne = true;
+    bool AllDilationsAreOne = true;
+    bool AllPaddingIsZero = true;
 
-        ptrdiff_t MaximumThreadCount = MlasGetMaximumThreadCount(ThreadPool);
+    for (size_t dim = 0; dim < Dimensions; dim++) {
+        AllStridesAreOne &= (Parameters->StrideShape[dim] == 1);
+        AllDilationsAreOne &= (Parameters->DilationShape[dim] == 1);
+        AllPaddingIsZero &= (Parameters->Padding[dim] == 0 && Parameters->Padding[dim + Dimensions] == 0);
+    }
+
+    switch (Algorithm) {
+
+        case MlasConvAlgorithmGemmDirect:
+        {
+            //
+            // Repeat the shape tests from MlasConvPrepare: the input can only
+            // be used as the GEMM B matrix without expansion for pointwise
+            // convolutions and for kernels covering the entire input width or
+            // height.
+            //
+
+            if (!AllStridesAreOne || !AllPaddingIsZero) {
+                return false;
+            }
+
+            if (K == InputChannels) {
+
+                Parameters->u.GemmDirect.TransB = CblasNoTrans;
+                Parameters->u.GemmDirect.ldb = OutputSize;
+
+            } else if (Dimensions == 2 && AllDilationsAreOne && InputChannels == 1 &&
+                Parameters->KernelShape[1] == Parameters->InputShape[1]) {
+
+                Parameters->u.GemmDirect.TransB = CblasTrans;
+                Parameters->u.GemmDirect.ldb = Parameters->InputShape[1];
+
+            } else if (Dimensions == 2 && AllDilationsAreOne && InputChannels == 1 &&
+                Parameters->KernelShape[0] == Parameters->InputShape[0] &&
+                Parameters->KernelShape[1] == 1) {
 
-        if (TargetThreadCount >= MaximumThreadCount) {
-            TargetThreadCount = MaximumThreadCount;
+                Parameters->u.GemmDirect.TransB = CblasNoTrans;
+                Parameters->u.GemmDirect.ldb = Parameters->InputShape[1];
+
+            } else {
+                return false;
+            }
+
+            Parameters->Algorithm = MlasConvAlgorithmGemmDirect;
+
+            *WorkingBufferSize = 0;
+
+            return true;
         }
 
-        //
-        // Compute the thread stride for slicing the N dimension.
-        //
+        case MlasConvAlgorithmExpandThenGemm:
+        {
+            Parameters->Algorithm = MlasConvAlgorithmExpandThenGemm;
 
-        size_t StrideN = OutputSize / TargetThreadCount;
+            *WorkingBufferSize = OutputSize * K;
 
-        if ((StrideN * TargetThreadCount) != OutputSize) {
-            StrideN++;
+            return true;
         }
 
-        if (TargetThreadCount > 1) {
+        case MlasConvAlgorithmExpandThenGemmSegmented:
+        {
+            MlasConvPrepareExpandThenGemmSegmented(Parameters, WorkingBufferSize, ThreadPool);
+
+            return true;
+        }
 
-            StrideN = (StrideN + MLAS_SGEMM_STRIDEN_THREAD_ALIGN - 1) & ~(MLAS_SGEMM_STRIDEN_THREAD_ALIGN - 1);
+        case MlasConvAlgorithmWinograd:
+        {
+            //
+            // The Winograd transform only covers 3x3 stride-1 dilation-1
+            // convolutions, but no size thresholds are applied here: the
+            // caller is expected to have measured the candidates instead of
+            // relying on the heuristics of MlasConvPrepare.
+            //
 
-            if (StrideN >= OutputSize) {
-                TargetThreadCount = 1;
-            } else if (StrideN * (TargetThreadCount - 1) >= OutputSize) {
-                TargetThreadCount--;
+            if (Dimensions != 2 || !AllStridesAreOne || !AllDilationsAreOne ||
+                Parameters->KernelShape[0] != 3 || Parameters->KernelShape[1] != 3) {
+                return false;
             }
-        }
 
-        Parameters->ThreadCount = TargetThreadCount;
+            const size_t TilesH = (Parameters->OutputShape[0] + 1) / 2;
+            const size_t TilesW = (Parameters->OutputShape[1] + 1) / 2;
+            const size_t TileCount = TilesH * TilesW;
+
+            Parameters->Algorithm = MlasConvAlgorithmWinograd;
+            Parameters->u.Winograd.TilesH = TilesH;
+            Parameters->u.Winograd.TilesW = TilesW;
+            Parameters->u.Winograd.TileCount = TileCount;
 
-        Parameters->Algorithm = MlasConvAlgorithmExpandThenGemmSegmented;
-        Parameters->u.ExpandThenGemmSegmented.ThreadStrideN = StrideN;
+            *WorkingBufferSize = 16 * (FilterCount * InputChannels +
+                                       InputChannels * TileCount +
+                                       FilterCount * TileCount);
 
-        *WorkingBufferSize = TargetThreadCount * MLAS_CONV_WORKING_BUFFER_SIZE_PER_THREAD;
+            return true;
+        }
+
+        default:
+        {
+            return false;
+        }
     }
 }
 #if defined(_MSC_VER) && !defined(__clang__)
@@ -24,6 +24,11 @@ MlasFlashAttentionThreaded(
     const float* key = args->key;
     const float* value = args->value;
     float* output = args->output;
+    const float* attention_bias = args->attention_bias;
+    bool causal = args->causal;
+    ptrdiff_t bias_num_heads = args->broadcast_attention_bias_head ? 1 : num_heads;
+    // For causal attention, query at position i may only attend key positions [0, i + causal_offset].
+    ptrdiff_t causal_offset = kv_sequence_length - q_sequence_length;
 
 #if defined(MLAS_TARGET_AMD64) || defined(MLAS_TARGET_LARCH64)
     auto&& mlas_platform = GetMlasPlatform();
@@ -61,7 +66,17 @@ MlasFlashAttentionThreaded(
         float* temp_output = intermediate + q_block_size * kv_block_size;
         float negmax = 0;
 
-        for (ptrdiff_t ir = 0; ir < kv_sequence_length; ir += kv_block_size) {
+        ptrdiff_t row_size_q_valid = std::min(q_block_size, q_sequence_length - q_idx);
+
+        // Key positions strictly above the diagonal never contribute for the causal case,
+        // so the key/value walk can stop after the last block this query chunk attends.
+        ptrdiff_t kv_limit = kv_sequence_length;
+        if (causal) {
+            kv_limit = std::min(kv_limit, q_idx + row_size_q_valid + causal_offset);
+            kv_limit = std::max<ptrdiff_t>(kv_limit, 1);
+        }
+
+        for (ptrdiff_t ir = 0; ir < kv_limit; ir += kv_block_size) {
             /*
                 S = Q[batch_idx, head_idx, q_idx:q_idx+q_block_size, :] * (K[batch_idx, head_idx, ir:ir+kv_block_size, :]).T
                 old_m = m
@@ -93,9 +108,33 @@ MlasFlashAttentionThreaded(
                      intermediate,
                      row_size_kv_capped);
 
+            if (attention_bias != nullptr) {
+                ptrdiff_t bias_batch_idx = args->broadcast_attention_bias_batch ? 0 : batch_idx;
+                ptrdiff_t bias_head_idx = args->broadcast_attention_bias_head ? 0 : head_idx;
+                const float* bias_base = attention_bias +
+                    ((bias_batch_idx * bias_num_heads + bias_head_idx) * q_sequence_length + q_idx) * kv_sequence_length + ir;
+                for (ptrdiff_t irow = 0; irow < static_cast<ptrdiff_t>(row_size_q_capped); ++irow) {
+                    float* p = intermediate + irow * row_size_kv_capped;
+                    const float* bias_row = bias_base + irow * kv_sequence_length;
+                    for (ptrdiff_t icol = 0; icol < static_cast<ptrdiff_t>(row_size_kv_capped); ++icol) {
+                        p[icol] += bias_row[icol];
+                    }
+                }
+            }
+
             for (ptrdiff_t irow = 0; irow < static_cast<ptrdiff_t>(row_size_q_capped); ++irow) {
                 float* p = intermediate + irow * row_size_kv_capped;
 
+                if (causal) {
+                    // Zero out (via lowest float, which exp() flushes to zero) the score of any
+                    // key position above the diagonal for this query row.
+                    ptrdiff_t valid = q_idx + irow + causal_offset - ir + 1;
+                    for (ptrdiff_t icol = std::max<ptrdiff_t>(valid, 0);
+                         icol < static_cast<ptrdiff_t>(row_size_kv_capped); ++icol) {
+                        p[icol] = std::numeric_limits<float>::lowest();
+                    }
+                }
+
 #if defined(MLAS_TARGET_AMD64) || defined(MLAS_TARGET_LARCH64)
                 float rowmax = mlas_platform.ReduceMaximumF32Kernel(p, row_size_kv_capped);
 #else
@@ -141,7 +180,6 @@ MlasFlashAttentionThreaded(
         }
 
         float* output_row = output + ((batch_idx * q_sequence_length + q_idx) * num_heads + head_idx) * v_head_size;
-        ptrdiff_t row_size_q_valid = std::min(q_block_size, q_sequence_length - q_idx);
         // TODO: leverage advanced instruction sets
         for (ptrdiff_t irow = 0; irow < row_size_q_valid; ++irow) {
             for (ptrdiff_t icol = 0; icol < v_head_size; ++icol) {
@@ -0,0 +1,224 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    qdwconv_avx512.cpp
+
+Abstract:
+
+    This module implements the quantized integer depthwise convolution kernels.
+
+    This implementation uses AVX512 core (AVX512BW/AVX512VL) instructions.
+
+--*/
+
+#include "mlasi.h"
+
+template<typename InputType, typename FilterType>
+void
+MLASCALL
+MlasConvDepthwiseKernelAvx512Core(
+    const InputType* const* Input,
+    InputType InputZeroPoint,
+    const FilterType* Filter,
+    FilterType FilterZeroPoint,
+    int32_t* Output,
+    size_t Channels,
+    size_t OutputCount,
+    size_t KernelSize
+    )
+{
+    const __m512i InputZeroPointVector = _mm512_set1_epi32(InputZeroPoint);
+    const __m512i FilterZeroPointVector = _mm512_set1_epi32(FilterZeroPoint);
+
+    while (OutputCount > 0) {
+
+        size_t ChannelOffset = 0;
+        size_t c = Channels;
+
+        while (c >= 32) {
+
+            __m512i Accumulator0 = _mm512_setzero_si512();
+            __m512i Accumulator1 = _mm512_setzero_si512();
+            size_t ChannelKernelOffset = ChannelOffset;
+
+            for (size_t k = 0; k < KernelSize; k++) {
+
+                __m512i InputVector0;
+                __m512i InputVector1;
+                if (std::is_signed<InputType>::value) {
+                    InputVector0 = _mm512_cvtepi8_epi32(_mm_loadu_si128((const __m128i*)&Input[k][ChannelOffset]));
+                    InputVector1 = _mm512_cvtepi8_epi32(_mm_loadu_si128((const __m128i*)&Input[k][ChannelOffset + 16]));
+                } else {
+                    InputVector0 = _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i*)&Input[k][ChannelOffset]));
+                    InputVector1 = _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i*)&Input[k][ChannelOffset + 16]));
+                }
+
+                __m512i FilterVector0;
+                __m512i FilterVector1;
+                if (std::is_signed<FilterType>::value) {
+                    FilterVector0 = _mm512_cvtepi8_epi32(_mm_loadu_si128((const __m128i*)&Filter[ChannelKernelOffset]));
+                    FilterVector1 = _mm512_cvtepi8_epi32(_mm_loadu_si128((const __m128i*)&Filter[ChannelKernelOffset + 16]));
+                } else {
+                    FilterVector0 = _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i*)&Filter[ChannelKernelOffset]));
+                    FilterVector1 = _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i*)&Filter[ChannelKernelOffset + 16]));
+                }
+
+                InputVector0 = _mm512_sub_epi32(InputVector0, InputZeroPointVector);
+                InputVector1 = _mm512_sub_epi32(InputVector1, InputZeroPointVector);
+                FilterVector0 = _mm512_sub_epi32(FilterVector0, FilterZeroPointVector);
+                FilterVector1 = _mm512_sub_epi32(FilterVector1, FilterZeroPointVector);
+
+                // N.B. Unlike the AVX2 implementation, the products are formed
+                // directly in 32-bit lanes, so the accumulators stay in
+                // sequential channel order and no reordering store is needed.
+                Accumulator0 = _mm512_add_epi32(Accumulator0, _mm512_mullo_epi32(InputVector0, FilterVector0));
+                Accumulator1 = _mm512_add_epi32(Accumulator1, _mm512_mullo_epi32(InputVector1, FilterVector1));
+
+                ChannelKernelOffset += Channels;
+            }
+
+            _mm512_storeu_si512((__m512i*)&Output[0], Accumulator0);
+            _mm512_storeu_si512((__m512i*)&Output[16], Accumulator1);
+            Output += 32;
+
+            ChannelOffset += 32;
+            c -= 32;
+        }
+
+        if (c >= 16) {
+
+            __m512i Accumulator = _mm512_setzero_si512();
+            size_t ChannelKernelOffset = ChannelOffset;
+
+            for (size_t k = 0; k < KernelSize; k++) {
+
+                __m512i InputVector;
+                if (std::is_signed<InputType>::value) {
+                    InputVector = _mm512_cvtepi8_epi32(_mm_loadu_si128((const __m128i*)&Input[k][ChannelOffset]));
+                } else {
+                    InputVector = _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i*)&Input[k][ChannelOffset]));
+                }
+
+                __m512i FilterVector;
+                if (std::is_signed<FilterType>::value) {
+                    FilterVector = _mm512_cvtepi8_epi32(_mm_loadu_si128((const __m128i*)&Filter[ChannelKernelOffset]));
+                } else {
+                    FilterVector = _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i*)&Filter[ChannelKernelOffset]));
+                }
+
+                InputVector = _mm512_sub_epi32(InputVector, InputZeroPointVector);
+                FilterVector = _mm512_sub_epi32(FilterVector, FilterZeroPointVector);
+
+                Accumulator = _mm512_add_epi32(Accumulator, _mm512_mullo_epi32(InputVector, FilterVector));
+
+                ChannelKernelOffset += Channels;
+            }
+
+            _mm512_storeu_si512((__m512i*)&Output[0], Accumulator);
+            Output += 16;
+
+            ChannelOffset += 16;
+            c -= 16;
+        }
+
+        if (c > 0) {
+
+            // Handle the remaining channels with a single masked iteration.
+            const __mmask16 TailMask = _cvtu32_mask16((1u << c) - 1);
+
+            __m512i Accumulator = _mm512_setzero_si512();
+            size_t ChannelKernelOffset = ChannelOffset;
+
+            for (size_t k = 0; k < KernelSize; k++) {
+
+                __m512i InputVector;
+                if (std::is_signed<InputType>::value) {
+                    InputVector = _mm512_cvtepi8_epi32(_mm_maskz_loadu_epi8(TailMask, &Input[k][ChannelOffset]));
+                } else {
+                    InputVector = _mm512_cvtepu8_epi32(_mm_maskz_loadu_epi8(TailMask, &Input[k][ChannelOffset]));
+                }
+
+                __m512i FilterVector;
+                if (std::is_signed<FilterType>::value) {
+                    FilterVector = _mm512_cvtepi8_epi32(_mm_maskz_loadu_epi8(TailMask, &Filter[ChannelKernelOffset]));
+                } else {
+                    FilterVector = _mm512_cvtepu8_epi32(_mm_maskz_loadu_epi8(TailMask, &Filter[ChannelKernelOffset]));
+                }
+
+                InputVector = _mm512_sub_epi32(InputVector, InputZeroPointVector);
+                FilterVector = _mm512_sub_epi32(FilterVector, FilterZeroPointVector);
+
+                Accumulator = _mm512_add_epi32(Accumulator, _mm512_mullo_epi32(InputVector, FilterVector));
+
+                ChannelKernelOffset += Channels;
+            }
+
+            _mm512_mask_storeu_epi32(&Output[0], TailMask, Accumulator);
+            Output += c;
+        }
+
+        Input += KernelSize;
+        OutputCount -= 1;
+    }
+}
+
+template
+void
+MLASCALL
+MlasConvDepthwiseKernelAvx512Core<uint8_t, int8_t>(
+    const uint8_t* const* Input,
+    uint8_t InputZeroPoint,
+    const int8_t* Filter,
+    int8_t FilterZeroPoint,
+    int32_t* Output,
+    size_t Channels,
+    size_t OutputCount,
+    size_t KernelSize
+    );
+
+template
+void
+MLASCALL
+MlasConvDepthwiseKernelAvx512Core<uint8_t, uint8_t>(
+    const uint8_t* const* Input,
+    uint8_t InputZeroPoint,
+    const uint8_t* Filter,
+    uint8_t FilterZeroPoint,
+    int32_t* Output,
+    size_t Channels,
+    size_t OutputCount,
+    size_t KernelSize
+    );
+
+template
+void
+MLASCALL
+MlasConvDepthwiseKernelAvx512Core<int8_t, int8_t>(
+    const int8_t* const* Input,
+    int8_t InputZeroPoint,
+    const int8_t* Filter,
+    int8_t FilterZeroPoint,
+    int32_t* Output,
+    size_t Channels,
+    size_t OutputCount,
+    size_t KernelSize
+    );
+
+template
+void
+MLASCALL
+MlasConvDepthwiseKernelAvx512Core<int8_t, uint8_t>(
+    const int8_t* const* Input,
+    int8_t InputZeroPoint,
+    const uint8_t* Filter,
+    uint8_t FilterZeroPoint,
+    int32_t* Output,
+    size_t Channels,
+    size_t OutputCount,
+    size_t KernelSize
+    );
@@ -191,18 +191,27 @@ class MLASCPUIDInfo
 
     bool HasArmNeon_I8MM() const { return has_arm_neon_i8mm_; }
 
+    bool HasArmSVE() const { return has_arm_sve_; }
+
     bool HasArmSVE_I8MM() const { return has_arm_sve_i8mm_; }
 
     bool HasArmNeon_BF16() const { return has_arm_neon_bf16_; }
 
+    bool HasArmSME() const { return has_arm_sme_; }
+
+    bool HasArmSME2() const { return has_arm_sme2_; }
+
    private:
     MLASCPUIDInfo();
 
     bool has_arm_neon_dot_{false};
     bool has_fp16_{false};
     bool has_arm_neon_i8mm_{false};
+    bool has_arm_sve_{false};
     bool has_arm_sve_i8mm_{false};
     bool has_arm_neon_bf16_{false};
+    bool has_arm_sme_{false};
+    bool has_arm_sme2_{false};
 };
 using MLAS_CPUIDINFO = MLASCPUIDInfo;
 
@@ -778,6 +787,12 @@ extern "C" {
 #if defined(__aarch64__) && defined(__linux__)
     MLAS_SBGEMM_FLOAT_KERNEL MlasSbgemmKernelZero;
     MLAS_SBGEMM_FLOAT_KERNEL MlasSbgemmKernelAdd;
+    MLAS_GEMM_FLOAT_KERNEL MlasSgemmKernelZeroSve;
+    MLAS_GEMM_FLOAT_KERNEL MlasSgemmKernelAddSve;
+    size_t MLASCALL MlasSgemmKernelSveVectorWidth(void);
+    MLAS_GEMM_FLOAT_KERNEL MlasSgemmKernelZeroSme2;
+    MLAS_GEMM_FLOAT_KERNEL MlasSgemmKernelAddSme2;
+    size_t MLASCALL MlasSgemmKernelSme2VectorWidth(void);
 #endif
     MLAS_GEMM_DOUBLE_KERNEL MlasDgemmKernelZero;
     MLAS_GEMM_DOUBLE_KERNEL MlasDgemmKernelAdd;
@@ -1061,6 +1076,20 @@ MlasConvDepthwiseKernelAvx2(
     size_t KernelSize
     );
 
+template <typename InputType, typename FilterType>
+void
+MLASCALL
+MlasConvDepthwiseKernelAvx512Core(
+    const InputType* const* Input,
+    InputType InputZeroPoint,
+    const FilterType* Filter,
+    FilterType FilterZeroPoint,
+    int32_t* Output,
+    size_t Channels,
+    size_t OutputCount,
+    size_t KernelSize
+    );
+
 //
 // Define the kernel flags for conv sym
 //
@@ -1091,6 +1120,8 @@ struct MLAS_PLATFORM {
 
     MLAS_PLATFORM(void);
 
+    bool EnableDispatchTier(const char* Tier);
+
 #if defined(MLAS_TARGET_AMD64_IX86) || defined(MLAS_TARGET_POWER)
     MLAS_GEMM_FLOAT_KERNEL* GemmFloatKernel;
 #endif
@@ -1119,6 +1150,8 @@ struct MLAS_PLATFORM {
     const MLAS_GEMM_QUANT_DISPATCH* GemmU8U8Dispatch;
     const MLAS_GEMM_QUANT_DISPATCH* GemmU8S8Dispatch;
     const MLAS_GEMM_QUANT_DISPATCH* GemmS8S8Dispatch;
+    MLAS_GEMM_FLOAT_KERNEL* GemmFloatKernelZero{&MlasSgemmKernelZero};
+    MLAS_GEMM_FLOAT_KERNEL* GemmFloatKernelAdd{&MlasSgemmKernelAdd};
 #endif
     const MLAS_SYMM_QGEMM_DISPATCH* SymmQgemmDispatch{nullptr};
 
@@ -1175,6 +1208,7 @@ struct MLAS_PLATFORM {
     uint32_t NchwcBlockSize;
     uint32_t PreferredBufferAlignment;
     int32_t MaximumThreadCount;
+    bool AmxBf16Supported{false};
 #elif defined(MLAS_TARGET_ARM64)
     static constexpr int32_t MaximumThreadCount = MLAS_MAXIMUM_THREAD_COUNT * 4;
 #else
@@ -1188,6 +1222,21 @@ struct MLAS_PLATFORM {
 
     MLAS_CAST_F16_TO_F32_KERNEL* CastF16ToF32Kernel;
     MLAS_CAST_F32_TO_F16_KERNEL* CastF32ToF16Kernel;
+
+    //
+    // Space separated list of the instruction set tiers selected above, built
+    // as the constructor makes its decisions. Exposed via MlasGetDispatchSummary.
+    //
+
+    char DispatchSummary[128];
+
+    //
+    // Space separated list of the instruction set tiers the hardware supports,
+    // including tiers skipped because they were disabled via
+    // MlasSetDisabledDispatchTiers. Exposed via MlasGetSupportedDispatchTiers.
+    //
+
+    char SupportedSummary[128];
 };
 
 inline
@@ -1352,6 +1401,16 @@ MlasConvDepthwiseFloat_CHW(
 
 #endif
 
+void
+MlasConvWinograd(
+    const MLAS_CONV_PARAMETERS* Parameters,
+    const float* Input,
+    const float* Filter,
+    float* WorkingBuffer,
+    float* Output,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
 
 //
 // Define the missing ARM64 NEON intrinsic macros from arm64_neon.h that enable
@@ -17,6 +17,7 @@ Abstract:
 
 #include "mlasi.h"
 
+#include <cstring>
 #include <thread>
 #include <mutex>
 
@@ -63,6 +64,10 @@ MLASCPUIDInfo::MLASCPUIDInfo()
 #define HWCAP2_I8MM (1 << 13)
 #endif
 
+#ifndef HWCAP_SVE
+#define HWCAP_SVE (1 << 22)
+#endif
+
 #ifndef HWCAP2_SVEI8MM
 #define HWCAP2_SVEI8MM (1 << 9)
 #endif
@@ -71,6 +76,14 @@ MLASCPUIDInfo::MLASCPUIDInfo()
 #define HWCAP2_BF16 (1 << 14)
 #endif
 
+#ifndef HWCAP2_SME
+#define HWCAP2_SME (1 << 23)
+#endif
+
+#ifndef HWCAP2_SME2
+#define HWCAP2_SME2 (1UL << 37)
+#endif
+
 #if defined(BUILD_MLAS_NO_ONNXRUNTIME)
 MLASCPUIDInfo::MLASCPUIDInfo()
 {
@@ -80,9 +93,13 @@ MLASCPUIDInfo::MLASCPUIDInfo()
     has_fp16_ = has_arm_neon_dot_;
 
     has_arm_neon_i8mm_ = ((getauxval(AT_HWCAP2) & HWCAP2_I8MM) != 0);
+    has_arm_sve_ = ((getauxval(AT_HWCAP) & HWCAP_SVE) != 0);
     has_arm_sve_i8mm_ = ((getauxval(AT_HWCAP2) & HWCAP2_SVEI8MM) != 0);
 
     has_arm_neon_bf16_ = ((getauxval(AT_HWCAP2) & HWCAP2_BF16) != 0);
+
+    has_arm_sme_ = ((getauxval(AT_HWCAP2) & HWCAP2_SME) != 0);
+    has_arm_sme2_ = ((getauxval(AT_HWCAP2) & HWCAP2_SME2) != 0);
 }
 #endif
 
@@ -220,6 +237,135 @@ MLAS_INTERNAL_DATA MLAS_DECLSPEC_ALIGN(const uint32_t MlasMaskMoveTableLasx[16],
 };
 
 #endif
+
+//
+// Stores the optional space separated list of instruction set tiers disabled
+// via MlasSetDisabledDispatchTiers, and whether the platform constructor has
+// already committed its dispatch selections.
+//
+
+static char MlasDisabledDispatchTiers[128];
+static bool MlasPlatformInitialized = false;
+
+static
+bool
+MlasDispatchTokenListed(
+    const char* List,
+    const char* Token
+    )
+/*++
+
+Routine Description:
+
+    This routine tests whether a token appears in a space separated token
+    list using exact token matches.
+
+Arguments:
+
+    List - Supplies the space separated token list.
+
+    Token - Supplies the token to look for.
+
+Return Value:
+
+    Returns true if the token is present in the list.
+
+--*/
+{
+    size_t TokenLength = strlen(Token);
+    const char* Current = List;
+
+    while (*Current != '\0') {
+
+        const char* End = strchr(Current, ' ');
+        size_t Length = (End != nullptr) ? size_t(End - Current) : strlen(Current);
+
+        if (Length == TokenLength && memcmp(Current, Token, TokenLength) == 0) {
+            return true;
+        }
+
+        if (End == nullptr) {
+            break;
+        }
+
+        Current = End + 1;
+    }
+
+    return false;
+}
+
+static
+void
+MlasAppendDispatchToken(
+    char* Summary,
+    size_t SummaryLength,
+    const char* Token
+    )
+/*++
+
+Routine Description:
+
+    This routine appends an instruction set tier token to the dispatch summary
+    built while the platform constructor makes its selections. Tokens that do
+    not fit are silently dropped.
+
+Arguments:
+
+    Summary - Supplies the summary buffer.
+
+    SummaryLength - Supplies the size of the summary buffer in bytes.
+
+    Token - Supplies the token to append.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    size_t Current = strlen(Summary);
+    size_t TokenLength = strlen(Token);
+
+    if (Current + TokenLength + 2 > SummaryLength) {
+        return;
+    }
+
+    if (Current > 0) {
+        Summary[Current++] = ' ';
+    }
+
+    memcpy(&Summary[Current], Token, TokenLength + 1);
+}
+
+bool
+MLAS_PLATFORM::EnableDispatchTier(
+    const char* Tier
+    )
+/*++
+
+Routine Description:
+
+    This routine records an instruction set tier the hardware was found to
+    support and decides whether the constructor may select it. Tiers listed
+    in the disabled set are reported as supported but are not selected, so
+    the constructor keeps the next lower tier as if the hardware lacked the
+    capability.
+
+Arguments:
+
+    Tier - Supplies the tier token, e.g. "avx2".
+
+Return Value:
+
+    Returns true if the tier may be selected.
+
+--*/
+{
+    MlasAppendDispatchToken(this->SupportedSummary, sizeof(this->SupportedSummary), Tier);
+
+    return !MlasDispatchTokenListed(MlasDisabledDispatchTiers, Tier);
+}
+
 MLAS_PLATFORM::MLAS_PLATFORM(
     void
     )
@@ -240,6 +386,9 @@ Return Value:
 --*/
 {
 
+    this->DispatchSummary[0] = '\0';
+    this->SupportedSummary[0] = '\0';
+
     this->ConvDepthwiseU8S8Kernel = MlasConvDepthwiseKernel<uint8_t, int8_t>;
     this->ConvDepthwiseU8U8Kernel = MlasConvDepthwiseKernel<uint8_t, uint8_t>;
     this->ConvDepthwiseS8S8Kernel = MlasConvDepthwiseKernel<int8_t, int8_t>;
@@ -257,6 +406,9 @@ Return Value:
     this->GemmU8S8Dispatch = &MlasGemmU8X8DispatchSse;
     this->GemmU8U8Dispatch = &MlasGemmU8X8DispatchSse;
 
+    MlasAppendDispatchToken(this->DispatchSummary, sizeof(this->DispatchSummary), "sse2");
+    this->EnableDispatchTier("sse2");  // baseline tier, cannot be disabled
+
 #if defined(MLAS_TARGET_AMD64)
 
     this->TransposePackB16x4Routine = MlasSgemmTransposePackB16x4Sse;
@@ -309,8 +461,9 @@ Return Value:
     // Check if the processor supports SSE 4.1 instructions.
     //
 
-    if ((Cpuid1[2] & 0x80000) != 0) {
+    if ((Cpuid1[2] & 0x80000) != 0 && this->EnableDispatchTier("sse4.1")) {
         this->GemmU8S8Dispatch = &MlasGemmU8S8DispatchSse41;
+        MlasAppendDispatchToken(this->DispatchSummary, sizeof(this->DispatchSummary), "sse4.1");
     }
 
 #endif
@@ -327,10 +480,12 @@ Return Value:
 
         uint64_t xcr0 = MlasReadExtendedControlRegister(_XCR_XFEATURE_ENABLED_MASK);
 
-        if ((xcr0 & 0x6) == 0x6) {
+        if ((xcr0 & 0x6) == 0x6 && this->EnableDispatchTier("avx")) {
 
             this->GemmFloatKernel = MlasGemmFloatKernelAvx;
 
+            MlasAppendDispatchToken(this->DispatchSummary, sizeof(this->DispatchSummary), "avx");
+
 #if defined(MLAS_TARGET_AMD64)
 
             this->KernelM1Routine = MlasSgemmKernelM1Avx;
@@ -361,7 +516,8 @@ Return Value:
             __cpuid_count(7, 0, Cpuid7[0], Cpuid7[1], Cpuid7[2], Cpuid7[3]);
 #endif
 
-            if (((Cpuid1[2] & 0x1000) != 0) && ((Cpuid7[1] & 0x20) != 0)) {
+            if (((Cpuid1[2] & 0x1000) != 0) && ((Cpuid7[1] & 0x20) != 0) &&
+                this->EnableDispatchTier("avx2")) {
 
                 this->GemmU8S8Dispatch = &MlasGemmU8S8DispatchAvx2;
                 this->GemmU8S8Kernel = MlasGemmU8S8KernelAvx2;
@@ -391,6 +547,7 @@ Return Value:
                 this->CastF16ToF32Kernel = &MlasCastF16ToF32KernelAvx2;
                 this->CastF32ToF16Kernel = &MlasCastF32ToF16KernelAvx2;
 
+                MlasAppendDispatchToken(this->DispatchSummary, sizeof(this->DispatchSummary), "avx2");
 
                 //
                 // Check if the processor supports Hybrid core architecture.
@@ -411,13 +568,14 @@ Return Value:
                 __cpuid_count(7, 1, Cpuid7_1[0], Cpuid7_1[1], Cpuid7_1[2], Cpuid7_1[3]);
 #endif
 
-                if ((Cpuid7_1[0] & 0x10) != 0) {
+                if ((Cpuid7_1[0] & 0x10) != 0 && this->EnableDispatchTier("avx-vnni")) {
 
                     this->GemmU8U8Dispatch = &MlasGemmU8S8DispatchAvx2;
                     this->GemmU8S8Kernel = MlasGemmU8S8KernelAvxVnni;
                     this->GemvU8S8Kernel = MlasGemvU8S8KernelAvxVnni;
                     this->ConvSymU8S8Dispatch = &MlasConvSymDispatchAvxVnni;
                     this->SQNBitGemmDispatch = &MlasSQNBitGemmDispatchAvx2vnni;
+                    MlasAppendDispatchToken(this->DispatchSummary, sizeof(this->DispatchSummary), "avx-vnni");
                 }
 
 #if !defined(ORT_MINIMAL_BUILD)
@@ -427,7 +585,8 @@ Return Value:
                 // operating system supports saving AVX512F state.
                 //
 
-                if (((Cpuid7[1] & 0x10000) != 0) && ((xcr0 & 0xE0) == 0xE0)) {
+                if (((Cpuid7[1] & 0x10000) != 0) && ((xcr0 & 0xE0) == 0xE0) &&
+                    this->EnableDispatchTier("avx512f")) {
 
                     this->GemmFloatKernel = MlasGemmFloatKernelAvx512F;
                     this->GemmDoubleKernel = MlasGemmDoubleKernelAvx512F;
@@ -446,12 +605,15 @@ Return Value:
                     this->NchwcBlockSize = 16;
                     this->PreferredBufferAlignment = 64;
 
+                    MlasAppendDispatchToken(this->DispatchSummary, sizeof(this->DispatchSummary), "avx512f");
+
                     //
                     // Check if the processor supports AVX512 core features
                     // (AVX512BW/AVX512DQ/AVX512VL).
                     //
 
-                    if ((Cpuid7[1] & 0xC0020000) == 0xC0020000) {
+                    if ((Cpuid7[1] & 0xC0020000) == 0xC0020000 &&
+                        this->EnableDispatchTier("avx512-core")) {
 
                         this->GemmU8S8Kernel = MlasGemmU8S8KernelAvx512Core;
                         this->GemvU8S8Kernel = MlasGemvU8S8KernelAvx512Core;
@@ -459,12 +621,18 @@ Return Value:
                         this->ConvSymU8S8Dispatch = &MlasConvSymDispatchAvx512Core;
                         this->FpQ4GemmDispatch = &MlasFpQ4GemmDispatchAvx512;
                         this->SQNBitGemmDispatch = &MlasSQNBitGemmDispatchAvx512;
+                        this->ConvDepthwiseU8S8Kernel = MlasConvDepthwiseKernelAvx512Core<uint8_t, int8_t>;
+                        this->ConvDepthwiseU8U8Kernel = MlasConvDepthwiseKernelAvx512Core<uint8_t, uint8_t>;
+                        this->ConvDepthwiseS8S8Kernel = MlasConvDepthwiseKernelAvx512Core<int8_t, int8_t>;
+                        this->ConvDepthwiseS8U8Kernel = MlasConvDepthwiseKernelAvx512Core<int8_t, uint8_t>;
+
+                        MlasAppendDispatchToken(this->DispatchSummary, sizeof(this->DispatchSummary), "avx512-core");
 
                         //
                         // Check if the processor supports AVX512VNNI.
                         //
 
-                        if ((Cpuid7[2] & 0x800) != 0) {
+                        if ((Cpuid7[2] & 0x800) != 0 && this->EnableDispatchTier("avx512-vnni")) {
 
                             this->GemmU8U8Dispatch = &MlasGemmU8S8DispatchAvx2;
                             this->GemmU8S8Kernel = MlasGemmU8S8KernelAvx512Vnni;
@@ -472,6 +640,7 @@ Return Value:
                             this->ConvSymU8S8Dispatch = &MlasConvSymDispatchAvx512Vnni;
                             this->Q8Q4GemmDispatch = &MlasQ8Q4GemmDispatchAvx512vnni;
                             this->SQNBitGemmDispatch = &MlasSQNBitGemmDispatchAvx512vnni;
+                            MlasAppendDispatchToken(this->DispatchSummary, sizeof(this->DispatchSummary), "avx512-vnni");
                         }
                     }
                 }
@@ -479,12 +648,13 @@ Return Value:
                 //
                 // Check if the processor supports AVX-VNNI-INT8
                 //
-                if ((Cpuid7_1[3] & 0x10) != 0) {
+                if ((Cpuid7_1[3] & 0x10) != 0 && this->EnableDispatchTier("avx-vnni-int8")) {
                     this->GemmU8U8Dispatch = &MlasGemmU8U8DispatchAvx2Vnni;
                     this->GemmS8S8Dispatch = &MlasGemmS8S8DispatchAvx2Vnni;
                     this->GemmS8S8Kernel = MlasGemmS8S8KernelAvx2Vnni;
                     this->GemmS8U8Dispatch = &MlasGemmS8U8DispatchAvx2Vnni;
                     this->GemmS8U8Kernel = MlasGemmS8U8KernelAvx2Vnni;
+                    MlasAppendDispatchToken(this->DispatchSummary, sizeof(this->DispatchSummary), "avx-vnni-int8");
                 }
 
 #ifndef __APPLE__
@@ -505,9 +675,22 @@ Return Value:
                 if ((Cpuid7[3] & 0b1 << 24) != 0 &&
                     (Cpuid7[3] & 0b1 << 25) != 0 &&
                     (xcr0 & XFEATURE_MASK_XTILE) == XFEATURE_MASK_XTILE) {
-                    if (MlasInitAMX()) {
+                    if (MlasInitAMX() && this->EnableDispatchTier("amx-int8")) {
                         this->GemmU8U8Dispatch = &MlasGemmU8S8DispatchAmx;
                         this->GemmU8S8Dispatch = &MlasGemmU8S8DispatchAmx;
+
+                        MlasAppendDispatchToken(this->DispatchSummary, sizeof(this->DispatchSummary), "amx-int8");
+
+                        //
+                        // Check if the processor also supports AMX-BF16,
+                        // which shares the tile state initialized above.
+                        //
+                        this->AmxBf16Supported = (Cpuid7[3] & 0b1 << 22) != 0 &&
+                                                 this->EnableDispatchTier("amx-bf16");
+
+                        if (this->AmxBf16Supported) {
+                            MlasAppendDispatchToken(this->DispatchSummary, sizeof(this->DispatchSummary), "amx-bf16");
+                        }
                     }
                 }
 #endif // __APPLE__
@@ -532,6 +715,9 @@ Return Value:
     this->ConvSymU8S8Dispatch = &MlasConvSymU8DispatchNeon;
     this->ConvSymS8S8Dispatch = &MlasConvSymS8DispatchNeon;
 
+    MlasAppendDispatchToken(this->DispatchSummary, sizeof(this->DispatchSummary), "neon");
+    this->EnableDispatchTier("neon");  // baseline tier, cannot be disabled
+
     //
     // Check if the processor supports ASIMD dot product instructions.
     //
@@ -553,7 +739,7 @@ Return Value:
     HasDotProductInstructions = MLAS_CPUIDINFO::GetCPUIDInfo().HasArmNeonDot();
 #endif
 
-    if (HasDotProductInstructions) {
+    if (HasDotProductInstructions && this->EnableDispatchTier("dotprod")) {
         this->GemmU8U8Dispatch = &MlasGemmU8X8DispatchUdot;
         this->GemmU8S8Dispatch = &MlasGemmU8X8DispatchUdot;
         this->GemmS8S8Dispatch = &MlasGemmS8S8DispatchSdot;
@@ -563,16 +749,46 @@ Return Value:
 
         // MlasSQNBitGemmDispatchNeon has a dependency on dot product instructions
         this->SQNBitGemmDispatch = &MlasSQNBitGemmDispatchNeon;
+
+        MlasAppendDispatchToken(this->DispatchSummary, sizeof(this->DispatchSummary), "dotprod");
     }
 
 #if defined(__linux__)
     //
     // Check if the processor supports ASIMD I8MM instructions.
     //
-    if (MLAS_CPUIDINFO::GetCPUIDInfo().HasArmNeon_I8MM()) {
+    if (MLAS_CPUIDINFO::GetCPUIDInfo().HasArmNeon_I8MM() && this->EnableDispatchTier("i8mm")) {
         this->GemmU8U8Dispatch = &MlasGemmU8X8DispatchUmmla;
         this->GemmU8S8Dispatch = &MlasGemmU8X8DispatchUmmla;
         this->GemmS8S8Dispatch = &MlasGemmS8S8DispatchSmmla;
+        MlasAppendDispatchToken(this->DispatchSummary, sizeof(this->DispatchSummary), "i8mm");
+    }
+
+    //
+    // Check if the processor supports SVE with vectors wider than ASIMD. On
+    // parts with 128-bit SVE implementations the hand tuned ASIMD kernels
+    // remain the better choice.
+    //
+    if (MLAS_CPUIDINFO::GetCPUIDInfo().HasArmSVE() &&
+        MlasSgemmKernelSveVectorWidth() > 4 &&
+        this->EnableDispatchTier("sve")) {
+        this->GemmFloatKernelZero = MlasSgemmKernelZeroSve;
+        this->GemmFloatKernelAdd = MlasSgemmKernelAddSve;
+        MlasAppendDispatchToken(this->DispatchSummary, sizeof(this->DispatchSummary), "sve");
+    }
+
+    //
+    // Check if the processor supports SME2. The streaming-mode outer product
+    // kernel covers a full 16 column packed panel per FMOPA, so it needs a
+    // streaming vector length of at least 512 bits; implementations with a
+    // narrower streaming vector length keep the SVE or ASIMD kernels.
+    //
+    if (MLAS_CPUIDINFO::GetCPUIDInfo().HasArmSME2() &&
+        MlasSgemmKernelSme2VectorWidth() >= 16 &&
+        this->EnableDispatchTier("sme2")) {
+        this->GemmFloatKernelZero = MlasSgemmKernelZeroSme2;
+        this->GemmFloatKernelAdd = MlasSgemmKernelAddSme2;
+        MlasAppendDispatchToken(this->DispatchSummary, sizeof(this->DispatchSummary), "sme2");
     }
 #endif
 
@@ -599,9 +815,10 @@ Return Value:
 #elif defined(_AIX)
     bool HasP9Instructions = __power_9_andup();
 #endif // __linux__
-    if (HasP9Instructions) {
+    if (HasP9Instructions && this->EnableDispatchTier("power9")) {
         this->QuantizeLinearS8Kernel = MlasQuantizeLinearS8KernelVSX;
         this->QuantizeLinearU8Kernel = MlasQuantizeLinearU8KernelVSX;
+        MlasAppendDispatchToken(this->DispatchSummary, sizeof(this->DispatchSummary), "power9");
     }
 
 #if defined(POWER10)
@@ -612,10 +829,11 @@ Return Value:
 #elif defined(_AIX)
     bool HasP10Instructions = (__power_10_andup() && __power_mma_version() == MMA_V31);
 #endif // __linux__
-    if (HasP10Instructions) {
+    if (HasP10Instructions && this->EnableDispatchTier("power10")) {
         this->GemmFloatKernel = MlasSgemmKernelPOWER10;
         this->GemmDoubleKernel = MlasDgemmKernelPOWER10;
         this->GemmU8X8Dispatch = &MlasGemm8X8DispatchPOWER10;
+        MlasAppendDispatchToken(this->DispatchSummary, sizeof(this->DispatchSummary), "power10");
     }
 #endif
 #endif
@@ -632,7 +850,8 @@ Return Value:
     bool cap_lasx = hwcap & HWCAP_LOONGARCH_LASX;
     bool cap_lsx = hwcap & HWCAP_LOONGARCH_LSX;
 
-    if( cap_lasx ){
+    if( cap_lasx && this->EnableDispatchTier("lasx") ){
+        MlasAppendDispatchToken(this->DispatchSummary, sizeof(this->DispatchSummary), "lasx");
         this->GemmFloatKernel = MlasGemmFloatKernelLasx;
         this->GemmDoubleKernel = MlasGemmDoubleKernelLasx;
         this->ConvNchwFloatKernel = MlasConvNchwFloatKernelLasx;
@@ -649,7 +868,8 @@ Return Value:
 
         this->GemmU8S8Dispatch = &MlasGemmU8X8DispatchLSX;
         this->GemmU8U8Dispatch = &MlasGemmU8X8DispatchLSX;
-    }else if( cap_lsx ){
+    }else if( cap_lsx && this->EnableDispatchTier("lsx") ){
+        MlasAppendDispatchToken(this->DispatchSummary, sizeof(this->DispatchSummary), "lsx");
         this->GemmFloatKernel = MlasGemmFloatKernelLSX;
         this->GemmU8S8Dispatch = &MlasGemmU8X8DispatchLSX;
         this->GemmU8U8Dispatch = &MlasGemmU8X8DispatchLSX;
@@ -679,6 +899,7 @@ Return Value:
 
 #endif // MLAS_TARGET_LARCH64
 
+    MlasPlatformInitialized = true;
 }
 
 size_t
@@ -711,6 +932,111 @@ Return Value:
 #endif
 }
 
+const char*
+MLASCALL
+MlasGetDispatchSummary(
+    void
+    )
+/*++
+
+Routine Description:
+
+    This routine returns a space separated list of the instruction set tiers
+    the library selected for this process, e.g. "sse2 avx avx2 avx512f". The
+    string is empty on targets where the library makes no runtime dispatch
+    decisions.
+
+Arguments:
+
+    None.
+
+Return Value:
+
+    Returns the dispatch summary. The storage is owned by the library.
+
+--*/
+{
+    return GetMlasPlatform().DispatchSummary;
+}
+
+const char*
+MLASCALL
+MlasGetSupportedDispatchTiers(
+    void
+    )
+/*++
+
+Routine Description:
+
+    This routine returns a space separated list of the instruction set tiers
+    the current hardware supports, including tiers that were skipped because
+    they were disabled via MlasSetDisabledDispatchTiers. Tiers that stack on
+    a disabled tier are not probed and do not appear in the list.
+
+Arguments:
+
+    None.
+
+Return Value:
+
+    Returns the supported tier list. The storage is owned by the library.
+
+--*/
+{
+    return GetMlasPlatform().SupportedSummary;
+}
+
+bool
+MLASCALL
+MlasSetDisabledDispatchTiers(
+    const char* Tiers
+    )
+/*++
+
+Routine Description:
+
+    This routine stores a space separated list of instruction set tiers that
+    the platform constructor must not select, e.g. "avx512f amx-int8". The
+    library then falls back to the next lower tier as if the hardware lacked
+    the capability. Tiers that stack on a disabled tier are disabled with it
+    and baseline tiers ("sse2", "neon") cannot be disabled.
+
+    The override only takes effect if it is stored before the first call to
+    any routine that touches the dispatch tables, including the query
+    routines above.
+
+Arguments:
+
+    Tiers - Supplies the space separated tier list, or nullptr or an empty
+        string to clear a previously stored list.
+
+Return Value:
+
+    Returns true if the override was stored, false if the dispatch tables
+    were already initialized or the list does not fit, in which case the
+    override is ignored.
+
+--*/
+{
+    if (MlasPlatformInitialized) {
+        return false;
+    }
+
+    if (Tiers == nullptr) {
+        MlasDisabledDispatchTiers[0] = '\0';
+        return true;
+    }
+
+    size_t Length = strlen(Tiers);
+
+    if (Length >= sizeof(MlasDisabledDispatchTiers)) {
+        return false;
+    }
+
+    memcpy(MlasDisabledDispatchTiers, Tiers, Length + 1);
+    return true;
+}
+
 #ifdef MLAS_TARGET_AMD64_IX86
 
 bool
@@ -30,7 +30,7 @@ Abstract:
         MLAS_SBGEMM_STRIDES Strides{128, 128, 256};
 --*/
 
-#if defined(__aarch64__) && defined(__linux__)
+#if (defined(__aarch64__) || defined(__x86_64__)) && defined(__linux__)
 
 #pragma once
 
@@ -39,6 +39,15 @@ Abstract:
 
 #include "mlasi.h"
 
+#if defined(MLAS_TARGET_AMD64)
+//
+// The x86-64 compilers do not provide an Arm style bfloat16_t type. The
+// packed buffers only ever hold raw bit patterns, so a plain 16-bit
+// integer works as the storage type.
+//
+typedef uint16_t bfloat16_t;
+#endif
+
 /**
  * @brief Define the default striding parameters for
  *        the bfloat16 precision gemm operation
@@ -284,6 +293,7 @@ struct MLAS_SBGEMM_DISPATCH {
 };
 
 extern const MLAS_SBGEMM_DISPATCH MlasSBGemmDispatchNeon;
+extern const MLAS_SBGEMM_DISPATCH MlasSBGemmDispatchAmx;
 
 MLAS_FORCEINLINE
 const MLAS_SBGEMM_DISPATCH*
@@ -291,8 +301,10 @@ MlasSBGemmGetDispatch()
 {
 #if defined(MLAS_TARGET_ARM64)
     return &MlasSBGemmDispatchNeon;
+#elif defined(MLAS_TARGET_AMD64)
+    return &MlasSBGemmDispatchAmx;
 #else
-    std::cerr << "SBGemm Kernel is supported only on ARM64 platform.";
+    std::cerr << "SBGemm Kernel is supported only on ARM64 and AMD64 platforms.";
     exit(1);
 #endif
 }
@@ -396,4 +408,4 @@ MlasSBGemmBatch(const size_t M, const size_t N, const size_t K, const size_t Bat
         }
     );
 }
-#endif  // defined(__aarch64__) && defined(__linux__)
+#endif  // (defined(__aarch64__) || defined(__x86_64__)) && defined(__linux__)
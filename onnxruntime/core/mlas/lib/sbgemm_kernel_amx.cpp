@@ -0,0 +1,383 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    sbgemm_kernel_amx.cpp
+
+Abstract:
+
+    This module implements bfloat16 precision GEMM kernel for amx.
+
+--*/
+
+#if defined(__x86_64__) && defined(__linux__)
+
+#include <cstring>
+
+#include "mlasi.h"
+#include "sbgemm.h"
+#include "amx_common.h"
+
+#define TMM0 0
+#define TMM1 1
+#define TMM2 2
+#define TMM3 3
+#define TMM4 4
+#define TMM5 5
+#define TMM6 6
+#define TMM7 7
+
+#define TILE_M 16
+#define TILE_N 16
+#define TILE_K 32
+
+struct MLAS_SBGEMM_KERNEL_AMX {
+    static constexpr bool PackNeeded = true;
+    static constexpr size_t KernelMaxM = 16;  // max # rows the tile kernel can process
+    static constexpr size_t PackedK = 2;
+    static constexpr size_t PackedN = MLAS_SGEMM_STRIDEN_THREAD_ALIGN;
+    static constexpr MLAS_SBGEMM_STRIDES Strides{128, 128, 256};  // M:N:K
+};
+
+bool MLASCALL
+MlasBf16AccelerationSupported()
+{
+#if defined(MLAS_TARGET_AMD64)
+    return GetMlasPlatform().AmxBf16Supported;
+#else
+    return false;
+#endif
+}
+
+/*
+    Convert 16 single precision lanes to bfloat16 with round to nearest even,
+    leaving the results in the low 16 bits of each 32-bit lane.
+*/
+MLAS_FORCEINLINE
+__m512i
+MlasSBGemmConvertF32ToBF16Bits(__m512 Value)
+{
+    __m512i bits = _mm512_castps_si512(Value);
+    const __m512i lsb = _mm512_and_si512(_mm512_srli_epi32(bits, 16), _mm512_set1_epi32(1));
+    const __m512i rounding = _mm512_add_epi32(lsb, _mm512_set1_epi32(0x7FFF));
+    bits = _mm512_add_epi32(bits, rounding);
+    return _mm512_srli_epi32(bits, 16);
+}
+
+/*
+    This routine converts a row of matrix A from fp32 to bf16. The converted
+    row is padded with zeros up to AlignedK elements so that full tiles can
+    be loaded for the K remainder without contributing to the dot products.
+*/
+static
+void
+MlasSBGemmConvertCopyRowAmx(bfloat16_t* D, const float* a, size_t CountK, size_t AlignedK)
+{
+    size_t k = 0;
+    for (; k + 16 <= CountK; k += 16) {
+        const __m512i bits = MlasSBGemmConvertF32ToBF16Bits(_mm512_loadu_ps(&a[k]));
+        _mm256_storeu_si256((__m256i*)&D[k], _mm512_cvtepi32_epi16(bits));
+    }
+    if (k < CountK) {
+        const uint16_t mask = static_cast<uint16_t>(0xFFFF >> (16 - (CountK - k)));
+        const __m512i bits = MlasSBGemmConvertF32ToBF16Bits(_mm512_maskz_loadu_ps(mask, &a[k]));
+        _mm256_storeu_si256((__m256i*)&D[k], _mm512_cvtepi32_epi16(bits));
+        k += 16;
+    }
+    for (; k < AlignedK; k += 16) {
+        _mm256_storeu_si256((__m256i*)&D[k], _mm256_setzero_si256());
+    }
+}
+
+/*
+    This routine converts fp32 to bf16 and copies elements from the source
+    matrix to the destination packed buffer.
+
+    The tile multiply instruction consumes B as 16 column dwords per row,
+    each dword holding a vertical pair of K elements. Columns are grouped
+    in panels of 16, and both the columns and the K pairs are zero padded
+    so the panels can always be loaded with full width tiles.
+*/
+static
+void
+MlasSBGemmConvertCopyPackBAmx(bfloat16_t* D, const float* B, size_t ldb, size_t CountN, size_t CountK)
+{
+    const size_t PairRows = (CountK + 1) / 2;
+
+    for (size_t n = 0; n < CountN; n += TILE_N) {
+        const size_t cols = std::min(CountN - n, size_t(TILE_N));
+        const uint16_t mask = static_cast<uint16_t>(0xFFFF >> (TILE_N - cols));
+
+        const float* b = B + n;
+        bfloat16_t* d = D;
+
+        for (size_t k = 0; k < CountK; k += 2) {
+            const __m512i lo = MlasSBGemmConvertF32ToBF16Bits(_mm512_maskz_loadu_ps(mask, b));
+            __m512i hi = _mm512_setzero_si512();
+            if (k + 1 < CountK) {
+                hi = MlasSBGemmConvertF32ToBF16Bits(_mm512_maskz_loadu_ps(mask, &b[ldb]));
+            }
+            _mm512_storeu_si512((void*)d, _mm512_or_si512(lo, _mm512_slli_epi32(hi, 16)));
+            d += 2 * TILE_N;
+            b += 2 * ldb;
+        }
+
+        D += PairRows * 2 * TILE_N;
+    }
+}
+
+template <typename KernelType>
+void
+MlasSBGemmConvertPackB(
+    bfloat16_t* PackedB, const float* B, size_t ldb, size_t CountN, size_t CountK
+)
+{
+    const auto* dispatch = MlasSBGemmGetDispatch();
+    if (dispatch == nullptr) return;
+
+    const auto PackedN = dispatch->PackedN;
+
+    const size_t AlignedN = (CountN + PackedN - 1) & ~(PackedN - 1);
+
+    //
+    // Step through each slice of matrix B along the K dimension.
+    //
+    size_t K_block_size;
+    constexpr MLAS_SBGEMM_STRIDES Strides = KernelType::Strides;
+
+    for (size_t k = 0; k < CountK; k += K_block_size) {
+        K_block_size = std::min(CountK - k, Strides.K);
+
+        MlasSBGemmConvertCopyPackBAmx((bfloat16_t*)PackedB, B + k * ldb, ldb, CountN, K_block_size);
+        PackedB = (bfloat16_t*)PackedB + AlignedN * K_block_size;
+    }
+}
+
+// Tile configure structure
+struct tileconfig_t {
+    uint8_t palette_id = 0;
+    uint8_t start_row = 0;
+    uint8_t reserved1[14] = {0};
+    uint16_t colb[8] = {0};
+    uint8_t reserved2[16] = {0};
+    uint8_t rows[8] = {0};
+    uint8_t reserved3[8] = {0};
+};
+
+static
+void
+MlasSBGemmTileConfigAmx()
+{
+    static thread_local struct tileconfig_t tc = {0};
+    struct tileconfig_t current_tc = {0};
+    tile_storeconfig(&current_tc);
+
+    if (tc.palette_id == 0 || (std::memcmp(&current_tc.colb, &tc.colb, sizeof(uint16_t) * 8) != 0 &&
+                               std::memcmp(&current_tc.rows, &tc.rows, sizeof(uint8_t) * 8) != 0)) {
+        // Filling tile configure structure.
+        tc.palette_id = 1;
+        for (int t = 0; t < 8; t++) {
+            tc.rows[t] = 16;
+            tc.colb[t] = 64;
+        }
+
+        tile_loadconfig(&tc);
+    }
+}
+
+/*
+    Initialize an accumulator tile buffer with the bias vector and, when
+    accumulating on top of existing output, the current contents of C. Rows
+    beyond cntM are zero filled so the full tile can be loaded.
+*/
+static inline
+void
+InitTile(
+    float* Tile,
+    size_t cntM,
+    uint16_t MaskN,
+    const float* bias_ptr,
+    const float* c_blk,
+    size_t ldc,
+    bool ZeroMode
+    )
+{
+    __m512 bias = _mm512_setzero_ps();
+    if (bias_ptr != nullptr) {
+        bias = _mm512_maskz_loadu_ps(MaskN, bias_ptr);
+    }
+    for (size_t m = 0; m < cntM; m++) {
+        __m512 row = bias;
+        if (!ZeroMode) {
+            row = _mm512_add_ps(row, _mm512_maskz_loadu_ps(MaskN, c_blk));
+        }
+        _mm512_storeu_ps(Tile, row);
+        Tile += TILE_N;
+        c_blk += ldc;
+    }
+    for (size_t m = cntM; m < TILE_M; m++) {
+        _mm512_storeu_ps(Tile, _mm512_setzero_ps());
+        Tile += TILE_N;
+    }
+}
+
+/**
+ * @brief move data from Tile buffer to C
+ *
+ */
+static inline
+void
+MoveTile(const float* Tile, size_t cntM, uint16_t MaskN, float* c_ptr, size_t ldc)
+{
+    for (size_t m = 0; m < cntM; m++) {
+        __m512 c = _mm512_maskz_loadu_ps(MaskN, Tile);
+        Tile += TILE_N;
+        _mm512_mask_storeu_ps(c_ptr, MaskN, c);
+        c_ptr += ldc;
+    }
+}
+
+/*
+    Compute up to a 16 row block of the output. The B buffer was converted
+    and packed by MlasSBGemmConvertCopyPackBAmx in slices of Strides.K rows,
+    with each slice holding panels of 16 columns. A is converted to bf16 on
+    the fly, one slice at a time, with zero padding to full tiles. Returns
+    the number of rows handled.
+*/
+static
+size_t
+MlasSBGemmKernelAmxBlock(
+    const float* A,
+    const bfloat16_t* B,
+    float* C,
+    size_t CountK,
+    size_t CountM,
+    size_t CountN,
+    size_t lda,
+    size_t ldc,
+    const float* Bias,
+    bool ZeroMode
+    )
+{
+    constexpr size_t SliceK = MLAS_SBGEMM_KERNEL_AMX::Strides.K;
+
+    const size_t m = std::min(CountM, size_t(TILE_M));
+    const size_t AlignedN = (CountN + TILE_N - 1) & ~size_t(TILE_N - 1);
+
+    bfloat16_t ABuffer[TILE_M * SliceK];
+    bfloat16_t BStage[(TILE_K / 2) * TILE_N * 2];
+    float Tile4[TILE_M * TILE_N];
+    float Tile6[TILE_M * TILE_N];
+
+    float* c_blk = C;
+    size_t n = 0;
+    while (n < CountN) {
+        const size_t cols = CountN - n;
+        const size_t cols0 = std::min(cols, size_t(TILE_N));
+        const bool two_tiles = cols > TILE_N;
+        const size_t cols1 = two_tiles ? std::min(cols - TILE_N, size_t(TILE_N)) : 0;
+        const uint16_t mask0 = static_cast<uint16_t>(0xFFFF >> (TILE_N - cols0));
+        const uint16_t mask1 =
+            two_tiles ? static_cast<uint16_t>(0xFFFF >> (TILE_N - cols1)) : 0;
+
+        InitTile(Tile4, m, mask0, (Bias != nullptr) ? Bias + n : nullptr, c_blk, ldc, ZeroMode);
+        tile_loadd(TMM4, Tile4, TILE_N * sizeof(float));
+        if (two_tiles) {
+            InitTile(Tile6, m, mask1, (Bias != nullptr) ? Bias + n + TILE_N : nullptr,
+                     c_blk + TILE_N, ldc, ZeroMode);
+            tile_loadd(TMM6, Tile6, TILE_N * sizeof(float));
+        }
+
+        const bfloat16_t* b_slice = B;
+        for (size_t k0 = 0; k0 < CountK; k0 += SliceK) {
+            const size_t ck = std::min(CountK - k0, SliceK);
+            const size_t AlignedCk = (ck + TILE_K - 1) & ~size_t(TILE_K - 1);
+            const size_t PanelStride = ((ck + 1) & ~size_t(1)) * TILE_N;
+
+            for (size_t i = 0; i < m; i++) {
+                MlasSBGemmConvertCopyRowAmx(&ABuffer[i * AlignedCk], A + i * lda + k0, ck, AlignedCk);
+            }
+
+            const bfloat16_t* b_panel0 = b_slice + (n / TILE_N) * PanelStride;
+            const bfloat16_t* b_panel1 = b_panel0 + PanelStride;
+            for (size_t k = 0; k < ck; k += TILE_K) {
+                const size_t PairOffset = (k / 2) * (TILE_N * 2);
+                const size_t PairsLeft = (ck - k + 1) / 2;
+
+                tile_loadd(TMM2, &ABuffer[k], static_cast<long>(AlignedCk * sizeof(bfloat16_t)));
+                if (PairsLeft >= TILE_K / 2) {
+                    tile_loadd(TMM0, b_panel0 + PairOffset, TILE_N * 2 * sizeof(bfloat16_t));
+                } else {
+                    // Stage the K remainder so the full height tile load does
+                    // not read past the end of the packed buffer. The padded
+                    // rows multiply against the zero padded columns of A.
+                    std::memcpy(BStage, b_panel0 + PairOffset,
+                                PairsLeft * TILE_N * 2 * sizeof(bfloat16_t));
+                    tile_loadd(TMM0, BStage, TILE_N * 2 * sizeof(bfloat16_t));
+                }
+                tile_dpbf16ps(TMM4, TMM2, TMM0);
+                if (two_tiles) {
+                    if (PairsLeft >= TILE_K / 2) {
+                        tile_loadd(TMM1, b_panel1 + PairOffset, TILE_N * 2 * sizeof(bfloat16_t));
+                    } else {
+                        std::memcpy(BStage, b_panel1 + PairOffset,
+                                    PairsLeft * TILE_N * 2 * sizeof(bfloat16_t));
+                        tile_loadd(TMM1, BStage, TILE_N * 2 * sizeof(bfloat16_t));
+                    }
+                    tile_dpbf16ps(TMM6, TMM2, TMM1);
+                }
+            }
+
+            b_slice += AlignedN * ck;
+        }
+
+        if (m == TILE_M && cols0 == TILE_N) {
+            tile_stored(TMM4, c_blk, static_cast<int>(ldc * sizeof(float)));
+        } else {
+            tile_stored(TMM4, Tile4, TILE_N * sizeof(float));
+            MoveTile(Tile4, m, mask0, c_blk, ldc);
+        }
+        if (two_tiles) {
+            if (m == TILE_M && cols1 == TILE_N) {
+                tile_stored(TMM6, c_blk + TILE_N, static_cast<int>(ldc * sizeof(float)));
+            } else {
+                tile_stored(TMM6, Tile6, TILE_N * sizeof(float));
+                MoveTile(Tile6, m, mask1, c_blk + TILE_N, ldc);
+            }
+        }
+
+        c_blk += 2 * TILE_N;
+        n += 2 * TILE_N;
+    }
+
+    return m;
+}
+
+template <>
+MLAS_FORCEINLINE void
+MlasSBGemmKernel<MLAS_SBGEMM_KERNEL_AMX>(size_t CountM, size_t CountN, size_t CountK, const float* A, size_t lda, const bfloat16_t* B, float* C, size_t ldc, const float* Bias, const bool ZeroMode)
+{
+    MlasSBGemmTileConfigAmx();
+
+    while (CountM > 0) {
+        size_t RowsHandled =
+            MlasSBGemmKernelAmxBlock(A, B, C, CountK, CountM, CountN, lda, ldc, Bias, ZeroMode);
+        C += ldc * RowsHandled;
+        A += lda * RowsHandled;
+        CountM -= RowsHandled;
+    }
+}
+
+const MLAS_SBGEMM_DISPATCH MlasSBGemmDispatchAmx = {
+    MlasSBGemmOperation<MLAS_SBGEMM_KERNEL_AMX>,
+    MlasSBGemmConvertPackB<MLAS_SBGEMM_KERNEL_AMX>,
+    MLAS_SBGEMM_KERNEL_AMX::PackedK,
+    MLAS_SBGEMM_KERNEL_AMX::PackedN,
+    MLAS_SBGEMM_KERNEL_AMX::KernelMaxM,
+    32  // kernel may read beyond buffer end by 32 bytes
+};
+#endif  // defined(__x86_64__) && defined(__linux__)
@@ -17,6 +17,8 @@ Abstract:
 
 #include "mlasi.h"
 
+#include <vector>
+
 //
 // Define the number of rows from matrix A to transpose to a local buffer.
 //
@@ -1063,6 +1065,12 @@ Return Value:
 
 #if defined(MLAS_TARGET_AMD64_IX86) || defined(MLAS_TARGET_POWER) || defined(MLAS_TARGET_LARCH64)
         RowsHandled = GetMlasPlatform().GemmFloatKernel(A, B, C, CountK, CountM, CountN, lda, ldc, alpha, ZeroMode);
+#elif defined(MLAS_TARGET_ARM64)
+        if (ZeroMode) {
+            RowsHandled = GetMlasPlatform().GemmFloatKernelZero(A, B, C, CountK, CountM, CountN, lda, ldc, alpha);
+        } else {
+            RowsHandled = GetMlasPlatform().GemmFloatKernelAdd(A, B, C, CountK, CountM, CountN, lda, ldc, alpha);
+        }
 #else
         if (ZeroMode) {
             RowsHandled = MlasSgemmKernelZero(A, B, C, CountK, CountM, CountN, lda, ldc, alpha);
@@ -1635,6 +1643,116 @@ MlasGemmBatch(
             TransA, TransB, M, N, K, &(Data[GemmIdx]), ThreadIdx);
     });
 }
+
+void
+MLASCALL
+MlasGemmGrouped(
+    CBLAS_TRANSPOSE TransA,
+    CBLAS_TRANSPOSE TransB,
+    const MLAS_SGEMM_GROUP_PARAMS* Groups,
+    size_t GroupCount,
+    MLAS_THREADPOOL* ThreadPool
+    )
+{
+    if (GroupCount == 0) {
+        return;
+    }
+
+    const ptrdiff_t MaximumThreadCount = MlasGetMaximumThreadCount(ThreadPool);
+
+    //
+    // Budget threads for each group with the same complexity heuristic that
+    // MlasGemmBatch applies to its uniform shape, and partition each group
+    // along the M or N dimension exactly as the batched path does. The
+    // per-group segments are then issued as one flat task range, so the
+    // thread pool dispatch overhead is paid once for the whole group list
+    // rather than once per group.
+    //
+
+    struct GROUP_SCHEDULE {
+        ptrdiff_t TaskStart;
+        ptrdiff_t ThreadCountM;
+        ptrdiff_t ThreadCountN;
+    };
+
+    std::vector<GROUP_SCHEDULE> Schedule(GroupCount + 1);
+
+    ptrdiff_t TaskCount = 0;
+
+    for (size_t GroupIdx = 0; GroupIdx < GroupCount; GroupIdx++) {
+
+        const MLAS_SGEMM_GROUP_PARAMS& Group = Groups[GroupIdx];
+        GROUP_SCHEDULE& Sched = Schedule[GroupIdx];
+
+        const double Complexity = double(Group.M) * double(Group.N) * double(Group.K);
+
+        ptrdiff_t ThreadsPerGroup;
+
+        if (Complexity < double(MLAS_SGEMM_THREAD_COMPLEXITY) * double(MaximumThreadCount)) {
+            ThreadsPerGroup = ptrdiff_t(Complexity / double(MLAS_SGEMM_THREAD_COMPLEXITY)) + 1;
+        } else {
+            ThreadsPerGroup = MaximumThreadCount;
+        }
+
+        if (ThreadsPerGroup >= MaximumThreadCount) {
+            ThreadsPerGroup = MaximumThreadCount;
+        }
+
+        if (Group.N > Group.M) {
+
+            const size_t BlockedN = (Group.N + MLAS_SGEMM_STRIDEN_THREAD_ALIGN - 1) /
+                MLAS_SGEMM_STRIDEN_THREAD_ALIGN;
+
+            if (size_t(ThreadsPerGroup) > BlockedN) {
+                ThreadsPerGroup = ptrdiff_t(BlockedN);
+            }
+
+            Sched.ThreadCountM = 1;
+            Sched.ThreadCountN = ThreadsPerGroup;
+
+        } else {
+
+            if (size_t(ThreadsPerGroup) > Group.M) {
+                ThreadsPerGroup = ptrdiff_t(Group.M);
+            }
+
+            Sched.ThreadCountM = ThreadsPerGroup;
+            Sched.ThreadCountN = 1;
+        }
+
+        //
+        // An empty group (M or N of zero) contributes no tasks.
+        //
+
+        Sched.TaskStart = TaskCount;
+        TaskCount += Sched.ThreadCountM * Sched.ThreadCountN;
+    }
+
+    Schedule[GroupCount].TaskStart = TaskCount;
+
+    if (TaskCount == 0) {
+        return;
+    }
+
+    MlasTrySimpleParallel(ThreadPool, TaskCount, [&](ptrdiff_t tid)
+    {
+        //
+        // Locate the group owning this task. Groups that contributed no tasks
+        // share their start offset with the following group and are skipped.
+        //
+
+        auto it = std::upper_bound(Schedule.begin(), Schedule.end(), tid,
+            [](ptrdiff_t Value, const GROUP_SCHEDULE& Entry) { return Value < Entry.TaskStart; });
+        const size_t GroupIdx = size_t(it - Schedule.begin()) - 1;
+
+        const GROUP_SCHEDULE& Sched = Schedule[GroupIdx];
+        const MLAS_SGEMM_GROUP_PARAMS& Group = Groups[GroupIdx];
+
+        MlasSgemmThreaded(Sched.ThreadCountM, Sched.ThreadCountN,
+            TransA, TransB, Group.M, Group.N, Group.K, &Group.Data,
+            tid - Sched.TaskStart);
+    });
+}
 #if defined(_MSC_VER) && !defined(__clang__)
 #pragma warning(pop)
 #endif
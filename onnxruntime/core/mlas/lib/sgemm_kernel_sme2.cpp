@@ -0,0 +1,247 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    sgemm_kernel_sme2.cpp
+
+Abstract:
+
+    This module implements the kernels for the single precision matrix/matrix
+    multiply operation (SGEMM) using SME2 streaming mode intrinsics.
+
+    The kernels accumulate an entire block of output rows per panel with the
+    FMOPA outer product instruction: each iteration over K rank-1 updates the
+    ZA tile with a column of matrix A against a row of the 16 column panels
+    produced by MlasSgemmCopyPackB. The dispatch logic only selects these
+    kernels when the streaming vector length is at least 512 bits, so a single
+    predicated vector always covers one packed panel.
+
+    Entering and leaving streaming mode and allocating the ZA tile state is
+    managed by the compiler through the locally-streaming and new-ZA function
+    attributes, so lazy ZA save/restore interacts correctly with signal
+    handlers and context switches. This translation unit must be compiled with
+    SME2 enabled (-march=armv9.2-a+sme2); callers are expected to verify SME2
+    support at runtime before dispatching here.
+
+--*/
+
+#include "mlasi.h"
+
+#include <arm_sme.h>
+
+template<bool ZeroMode>
+__arm_locally_streaming
+__arm_new("za")
+size_t
+MlasSgemmKernelSme2(
+    const float* A,
+    const float* B,
+    float* C,
+    size_t CountK,
+    size_t CountM,
+    size_t CountN,
+    size_t lda,
+    size_t ldc,
+    float alpha
+    )
+/*++
+
+Routine Description:
+
+    This routine is an inner kernel to compute matrix multiplication for a
+    block of rows via ZA tile outer products.
+
+Arguments:
+
+    A - Supplies the address of matrix A.
+
+    B - Supplies the address of matrix B. The matrix data has been packed using
+        MlasSgemmCopyPackB or MlasSgemmTransposePackB.
+
+    C - Supplies the address of matrix C.
+
+    CountK - Supplies the number of columns from matrix A and the number of rows
+        from matrix B to iterate over.
+
+    CountM - Supplies the number of rows from matrix A and matrix C to iterate
+        over.
+
+    CountN - Supplies the number of columns from matrix B and matrix C to
+        iterate over.
+
+    lda - Supplies the first dimension of matrix A.
+
+    ldc - Supplies the first dimension of matrix C.
+
+    alpha - Supplies the scalar multiplier (see SGEMM definition).
+
+Return Value:
+
+    Returns the number of rows handled.
+
+--*/
+{
+    //
+    // Process up to one packed panel worth of rows per invocation. Matrix A is
+    // row major, while FMOPA consumes a column of A per update, so each column
+    // is staged through a small contiguous buffer; the 16 scalar copies are
+    // amortized against the 16x16 multiply-accumulates of the outer product.
+    //
+
+    const size_t RowCount = (CountM < 16) ? CountM : 16;
+
+    const svbool_t RowPred = svwhilelt_b32(uint64_t(0), uint64_t(RowCount));
+
+    float ColumnBuffer[16];
+
+    do {
+
+        const uint64_t Columns = (CountN < 16) ? CountN : 16;
+
+        const svbool_t ColumnPred = svwhilelt_b32(uint64_t(0), Columns);
+
+        svzero_za();
+
+        const float* a = A;
+        const float* b = B;
+
+        for (size_t k = 0; k < CountK; k++) {
+
+            for (size_t m = 0; m < RowCount; m++) {
+                ColumnBuffer[m] = a[m * lda];
+            }
+
+            svfloat32_t AColumn = svld1_f32(RowPred, ColumnBuffer);
+            svfloat32_t BRow = svld1_f32(ColumnPred, b);
+
+            svmopa_za32_f32_m(0, RowPred, ColumnPred, AColumn, BRow);
+
+            a += 1;
+            b += 16;
+        }
+
+        //
+        // Extract the accumulated rows from the ZA tile, multiply by the alpha
+        // value and store to matrix C, accumulating into the existing contents
+        // of matrix C if requested. Lanes beyond CountN are disabled so
+        // partial panels never access matrix C out of bounds.
+        //
+
+        for (size_t m = 0; m < RowCount; m++) {
+
+            svfloat32_t Accumulators =
+                svread_hor_za32_f32_m(svdup_f32(0.0f), ColumnPred, 0, static_cast<uint32_t>(m));
+
+            Accumulators = svmul_n_f32_x(ColumnPred, Accumulators, alpha);
+
+            if (!ZeroMode) {
+                Accumulators = svadd_f32_x(ColumnPred, Accumulators, svld1_f32(ColumnPred, C + m * ldc));
+            }
+
+            svst1_f32(ColumnPred, C + m * ldc, Accumulators);
+        }
+
+        if (CountN <= 16) {
+            break;
+        }
+
+        B += CountK * 16;
+        C += 16;
+        CountN -= 16;
+
+    } while (CountN > 0);
+
+    return RowCount;
+}
+
+size_t
+MLASCALL
+MlasSgemmKernelZeroSme2(
+    const float* A,
+    const float* B,
+    float* C,
+    size_t CountK,
+    size_t CountM,
+    size_t CountN,
+    size_t lda,
+    size_t ldc,
+    float alpha
+    )
+/*++
+
+Routine Description:
+
+    This routine is an inner kernel to compute matrix multiplication for a
+    block of rows, zero initializing the output matrix.
+
+Arguments:
+
+    See MlasSgemmKernelSme2.
+
+Return Value:
+
+    Returns the number of rows handled.
+
+--*/
+{
+    return MlasSgemmKernelSme2<true>(A, B, C, CountK, CountM, CountN, lda, ldc, alpha);
+}
+
+size_t
+MLASCALL
+MlasSgemmKernelAddSme2(
+    const float* A,
+    const float* B,
+    float* C,
+    size_t CountK,
+    size_t CountM,
+    size_t CountN,
+    size_t lda,
+    size_t ldc,
+    float alpha
+    )
+/*++
+
+Routine Description:
+
+    This routine is an inner kernel to compute matrix multiplication for a
+    block of rows, accumulating into the output matrix.
+
+Arguments:
+
+    See MlasSgemmKernelSme2.
+
+Return Value:
+
+    Returns the number of rows handled.
+
+--*/
+{
+    return MlasSgemmKernelSme2<false>(A, B, C, CountK, CountM, CountN, lda, ldc, alpha);
+}
+
+size_t
+MLASCALL
+MlasSgemmKernelSme2VectorWidth(
+    void
+    )
+/*++
+
+Routine Description:
+
+    This routine returns the number of 32-bit lanes per streaming mode vector.
+    It is streaming-compatible and may be called from normal mode before any
+    kernel has been dispatched.
+
+Return Value:
+
+    Returns the number of 32-bit lanes per streaming mode vector.
+
+--*/
+{
+    return svcntsw();
+}
@@ -0,0 +1,322 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    sgemm_kernel_sve.cpp
+
+Abstract:
+
+    This module implements the kernels for the single precision matrix/matrix
+    multiply operation (SGEMM) using SVE intrinsics.
+
+    The kernels are vector length agnostic: predicated loads and stores cover
+    the 16 column panels produced by MlasSgemmCopyPackB with however many
+    32-bit lanes the implementation provides. This translation unit must be
+    compiled with SVE enabled (-march=armv8.2-a+sve); callers are expected to
+    verify SVE support at runtime before dispatching here.
+
+--*/
+
+#include "mlasi.h"
+
+#include <arm_sve.h>
+
+template<bool ZeroMode, bool ProcessTwoRows>
+size_t
+MlasSgemmKernelSve(
+    const float* A,
+    const float* B,
+    float* C,
+    size_t CountK,
+    size_t CountN,
+    size_t lda,
+    size_t ldc,
+    float alpha
+    )
+/*++
+
+Routine Description:
+
+    This routine is an inner kernel to compute matrix multiplication for a
+    set of rows.
+
+Arguments:
+
+    A - Supplies the address of matrix A.
+
+    B - Supplies the address of matrix B. The matrix data has been packed using
+        MlasSgemmCopyPackB or MlasSgemmTransposePackB.
+
+    C - Supplies the address of matrix C.
+
+    CountK - Supplies the number of columns from matrix A and the number of rows
+        from matrix B to iterate over.
+
+    CountN - Supplies the number of columns from matrix B and matrix C to
+        iterate over.
+
+    lda - Supplies the first dimension of matrix A.
+
+    ldc - Supplies the first dimension of matrix C.
+
+    alpha - Supplies the scalar multiplier (see SGEMM definition).
+
+Return Value:
+
+    Returns the number of rows handled.
+
+--*/
+{
+    const uint64_t VectorWidth = svcntw();
+
+    do {
+
+        const float* a = A;
+        size_t k = CountK;
+
+        //
+        // Two predicated vectors cover the 16 column panel whenever the
+        // vector length is at least 256 bits, which the dispatch logic
+        // guarantees. Lanes beyond CountN are disabled so partial panels
+        // never access matrix C out of bounds; the packed panel itself is
+        // always 16 elements wide and zero padded.
+        //
+
+        const uint64_t Columns = (CountN < 16) ? CountN : 16;
+
+        const svbool_t Pred0 = svwhilelt_b32(uint64_t(0), Columns);
+        const svbool_t Pred1 = svwhilelt_b32(VectorWidth, Columns);
+
+        svfloat32_t Row0Block0 = svdup_f32(0.0f);
+        svfloat32_t Row0Block1 = svdup_f32(0.0f);
+
+        svfloat32_t Row1Block0 = svdup_f32(0.0f);
+        svfloat32_t Row1Block1 = svdup_f32(0.0f);
+
+        while (k >= 2) {
+
+            float Row0AElement0 = a[0];
+            float Row0AElement1 = a[1];
+
+            float Row1AElement0;
+            float Row1AElement1;
+
+            if (ProcessTwoRows) {
+                Row1AElement0 = a[lda];
+                Row1AElement1 = a[lda + 1];
+            }
+
+            svfloat32_t BElements0 = svld1_f32(Pred0, B);
+            svfloat32_t BElements1 = svld1_f32(Pred1, B + VectorWidth);
+
+            Row0Block0 = svmla_n_f32_x(Pred0, Row0Block0, BElements0, Row0AElement0);
+            Row0Block1 = svmla_n_f32_x(Pred1, Row0Block1, BElements1, Row0AElement0);
+
+            if (ProcessTwoRows) {
+                Row1Block0 = svmla_n_f32_x(Pred0, Row1Block0, BElements0, Row1AElement0);
+                Row1Block1 = svmla_n_f32_x(Pred1, Row1Block1, BElements1, Row1AElement0);
+            }
+
+            BElements0 = svld1_f32(Pred0, B + 16);
+            BElements1 = svld1_f32(Pred1, B + 16 + VectorWidth);
+
+            Row0Block0 = svmla_n_f32_x(Pred0, Row0Block0, BElements0, Row0AElement1);
+            Row0Block1 = svmla_n_f32_x(Pred1, Row0Block1, BElements1, Row0AElement1);
+
+            if (ProcessTwoRows) {
+                Row1Block0 = svmla_n_f32_x(Pred0, Row1Block0, BElements0, Row1AElement1);
+                Row1Block1 = svmla_n_f32_x(Pred1, Row1Block1, BElements1, Row1AElement1);
+            }
+
+            a += 2;
+            B += 32;
+            k -= 2;
+        }
+
+        if (k > 0) {
+
+            float Row0AElement0 = a[0];
+
+            float Row1AElement0;
+
+            if (ProcessTwoRows) {
+                Row1AElement0 = a[lda];
+            }
+
+            svfloat32_t BElements0 = svld1_f32(Pred0, B);
+            svfloat32_t BElements1 = svld1_f32(Pred1, B + VectorWidth);
+
+            Row0Block0 = svmla_n_f32_x(Pred0, Row0Block0, BElements0, Row0AElement0);
+            Row0Block1 = svmla_n_f32_x(Pred1, Row0Block1, BElements1, Row0AElement0);
+
+            if (ProcessTwoRows) {
+                Row1Block0 = svmla_n_f32_x(Pred0, Row1Block0, BElements0, Row1AElement0);
+                Row1Block1 = svmla_n_f32_x(Pred1, Row1Block1, BElements1, Row1AElement0);
+            }
+
+            B += 16;
+        }
+
+        //
+        // Multiply by the alpha value.
+        //
+
+        Row0Block0 = svmul_n_f32_x(Pred0, Row0Block0, alpha);
+        Row0Block1 = svmul_n_f32_x(Pred1, Row0Block1, alpha);
+
+        if (ProcessTwoRows) {
+            Row1Block0 = svmul_n_f32_x(Pred0, Row1Block0, alpha);
+            Row1Block1 = svmul_n_f32_x(Pred1, Row1Block1, alpha);
+        }
+
+        //
+        // Store the output block with the same predicates, accumulating into
+        // the existing contents of matrix C if requested.
+        //
+
+        if (!ZeroMode) {
+            Row0Block0 = svadd_f32_x(Pred0, Row0Block0, svld1_f32(Pred0, C));
+            Row0Block1 = svadd_f32_x(Pred1, Row0Block1, svld1_f32(Pred1, C + VectorWidth));
+        }
+
+        svst1_f32(Pred0, C, Row0Block0);
+        svst1_f32(Pred1, C + VectorWidth, Row0Block1);
+
+        if (ProcessTwoRows) {
+
+            if (!ZeroMode) {
+                Row1Block0 = svadd_f32_x(Pred0, Row1Block0, svld1_f32(Pred0, C + ldc));
+                Row1Block1 = svadd_f32_x(Pred1, Row1Block1, svld1_f32(Pred1, C + ldc + VectorWidth));
+            }
+
+            svst1_f32(Pred0, C + ldc, Row1Block0);
+            svst1_f32(Pred1, C + ldc + VectorWidth, Row1Block1);
+        }
+
+        if (CountN <= 16) {
+            break;
+        }
+
+        C += 16;
+        CountN -= 16;
+
+    } while (CountN > 0);
+
+    return ProcessTwoRows ? 2 : 1;
+}
+
+template<bool ZeroMode>
+size_t
+MlasSgemmKernelSve(
+    const float* A,
+    const float* B,
+    float* C,
+    size_t CountK,
+    size_t CountM,
+    size_t CountN,
+    size_t lda,
+    size_t ldc,
+    float alpha
+    )
+{
+    size_t RowsHandled;
+
+    if (CountM >= 2) {
+        RowsHandled = MlasSgemmKernelSve<ZeroMode, true>(A, B, C, CountK, CountN, lda, ldc, alpha);
+    } else {
+        RowsHandled = MlasSgemmKernelSve<ZeroMode, false>(A, B, C, CountK, CountN, lda, ldc, alpha);
+    }
+
+    return RowsHandled;
+}
+
+size_t
+MLASCALL
+MlasSgemmKernelZeroSve(
+    const float* A,
+    const float* B,
+    float* C,
+    size_t CountK,
+    size_t CountM,
+    size_t CountN,
+    size_t lda,
+    size_t ldc,
+    float alpha
+    )
+/*++
+
+Routine Description:
+
+    This routine is an inner kernel to compute matrix multiplication for a
+    set of rows, zero initializing the output matrix.
+
+Arguments:
+
+    See MlasSgemmKernelSve.
+
+Return Value:
+
+    Returns the number of rows handled.
+
+--*/
+{
+    return MlasSgemmKernelSve<true>(A, B, C, CountK, CountM, CountN, lda, ldc, alpha);
+}
+
+size_t
+MLASCALL
+MlasSgemmKernelAddSve(
+    const float* A,
+    const float* B,
+    float* C,
+    size_t CountK,
+    size_t CountM,
+    size_t CountN,
+    size_t lda,
+    size_t ldc,
+    float alpha
+    )
+/*++
+
+Routine Description:
+
+    This routine is an inner kernel to compute matrix multiplication for a
+    set of rows, accumulating into the output matrix.
+
+Arguments:
+
+    See MlasSgemmKernelSve.
+
+Return Value:
+
+    Returns the number of rows handled.
+
+--*/
+{
+    return MlasSgemmKernelSve<false>(A, B, C, CountK, CountM, CountN, lda, ldc, alpha);
+}
+
+size_t
+MLASCALL
+MlasSgemmKernelSveVectorWidth(
+    void
+    )
+/*++
+
+Routine Description:
+
+    This routine returns the number of 32-bit lanes per SVE vector. It must
+    only be called after verifying that the processor supports SVE.
+
+Return Value:
+
+    Returns the number of 32-bit lanes per SVE vector.
+
+--*/
+{
+    return svcntw();
+}
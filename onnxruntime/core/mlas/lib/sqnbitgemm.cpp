@@ -587,37 +587,33 @@ InitializeWorkspace_CompInt8(
     const size_t BlockCountK = MlasDivRoundup(K, BlkLen);
     const size_t QuantAStride = BlockCountK * Q8BlkSize(BlkLen);
 
-    // TODO: try parallel on BatchN * M threads because BatchN is usually 1.
+    // Each row of A quantizes independently, so parallelize over all rows of all
+    // GEMMs in the batch rather than just the (usually single element) batch.
     if (QuantizeARow) {
-        MlasTrySimpleParallel(ThreadPool, BatchN, [&](ptrdiff_t gemm_idx) {
+        MlasTrySimpleParallel(ThreadPool, static_cast<ptrdiff_t>(BatchN * M), [&](ptrdiff_t tid) {
+            const size_t gemm_idx = static_cast<size_t>(tid) / M;
+            const size_t m = static_cast<size_t>(tid) % M;
             const auto& data = DataParams[gemm_idx];
 
-            const float* ARowPtr = data.A;
-            std::byte* QuantARowPtr = static_cast<std::byte*>(Workspace) + gemm_idx * PerGemmWorkspaceStride;
-            for (size_t m = 0; m < M; ++m) {
-                QuantizeARow(BlkLen, ARowPtr, K, QuantARowPtr);
-
-                ARowPtr += data.lda;
-                QuantARowPtr += QuantAStride;
-            }
+            const float* ARowPtr = data.A + m * data.lda;
+            std::byte* QuantARowPtr =
+                static_cast<std::byte*>(Workspace) + gemm_idx * PerGemmWorkspaceStride + m * QuantAStride;
+            QuantizeARow(BlkLen, ARowPtr, K, QuantARowPtr);
         });
     } else {
-        MlasTrySimpleParallel(ThreadPool, BatchN, [&](ptrdiff_t gemm_idx) {
+        MlasTrySimpleParallel(ThreadPool, static_cast<ptrdiff_t>(BatchN * M), [&](ptrdiff_t tid) {
+            const size_t gemm_idx = static_cast<size_t>(tid) / M;
+            const size_t m = static_cast<size_t>(tid) % M;
             const auto& data = DataParams[gemm_idx];
-            const float* ARowPtr = data.A;
+
+            const float* ARowPtr = data.A + m * data.lda;
 
             void* PerGemmWorkspace = static_cast<std::byte*>(Workspace) + gemm_idx * PerGemmWorkspaceStride;
             PerGemmQuantAWorkspace quant_a_data(PerGemmWorkspace, M, BlockCountK, BlkLen);
-            std::byte* QuantARowPtr = quant_a_data.QuantData;
-            float* QuantARowScalePtr = quant_a_data.QuantScale;
-            float* QuantARowBlkSum = quant_a_data.BlockSum;
-            for (size_t m = 0; m < M; ++m) {
-                QuantizeARow2(BlkLen, ARowPtr, K, QuantARowPtr, QuantARowScalePtr, QuantARowBlkSum);
-                ARowPtr += data.lda;
-                QuantARowPtr += BlockCountK * BlkLen;
-                QuantARowScalePtr += BlockCountK;
-                QuantARowBlkSum += BlockCountK;
-            }
+            std::byte* QuantARowPtr = quant_a_data.QuantData + m * BlockCountK * BlkLen;
+            float* QuantARowScalePtr = quant_a_data.QuantScale + m * BlockCountK;
+            float* QuantARowBlkSum = quant_a_data.BlockSum + m * BlockCountK;
+            QuantizeARow2(BlkLen, ARowPtr, K, QuantARowPtr, QuantARowScalePtr, QuantARowBlkSum);
         });
     }
 }
@@ -680,16 +676,30 @@ MlasSQNBitGemmBatch(
 
     const size_t BlockCountK = MlasDivRoundup(K, BlkLen);
 
+    //
+    // Fix up the packed quantized B pointers once per GEMM, up front, so the
+    // worker threads below do not redundantly recompute them per tile.
+    //
+
+    const bool UseQuantAWorkspace =
+        ComputeType == CompInt8 && GetMlasPlatform().SQNBitGemmDispatch->SQ4BitGemmPackQuantBDataAndBlkSum != nullptr;
+
+    if (UseQuantAWorkspace) {
+        for (size_t gemm_i = 0; gemm_i < BatchN; gemm_i++) {
+            const auto* Data = &DataParams[gemm_i];
+            PackedQuantBDataStruct packed_quant_b(const_cast<void*>(Data->QuantBDataWorkspace), N, BlockCountK, BlkLen);
+            const_cast<MLAS_SQNBIT_GEMM_DATA_PARAMS*>(Data)->PackedQuantBData = packed_quant_b.PackedQuantBData;
+            const_cast<MLAS_SQNBIT_GEMM_DATA_PARAMS*>(Data)->QuantBBlkSum = packed_quant_b.QuantBBlkSum;
+            const_cast<MLAS_SQNBIT_GEMM_DATA_PARAMS*>(Data)->QuantBScale = packed_quant_b.PackedQuantBScale;
+        }
+    }
+
     if (ThreadPool == nullptr) {
         for (size_t gemm_i = 0; gemm_i < BatchN; gemm_i++) {
             const auto* Data = &DataParams[gemm_i];
             void* PerGemmWorkspace =
                 reinterpret_cast<std::byte*>(Workspace) + gemm_i * PerGemmWorkspaceStride;
-            if (ComputeType == CompInt8 && GetMlasPlatform().SQNBitGemmDispatch->SQ4BitGemmPackQuantBDataAndBlkSum != nullptr) {
-                PackedQuantBDataStruct packed_quant_b(const_cast<void*>(Data->QuantBDataWorkspace), N, BlockCountK, BlkLen);
-                const_cast<MLAS_SQNBIT_GEMM_DATA_PARAMS*>(Data)->PackedQuantBData = packed_quant_b.PackedQuantBData;
-                const_cast<MLAS_SQNBIT_GEMM_DATA_PARAMS*>(Data)->QuantBBlkSum = packed_quant_b.QuantBBlkSum;
-                const_cast<MLAS_SQNBIT_GEMM_DATA_PARAMS*>(Data)->QuantBScale = packed_quant_b.PackedQuantBScale;
+            if (UseQuantAWorkspace) {
                 PerGemmQuantAWorkspace per_gemm_quant_a_workspace(PerGemmWorkspace, M, BlockCountK, BlkLen);
                 ComputeOperation(BlkLen, K, Data, &per_gemm_quant_a_workspace, 0, M, 0, N);
             } else {
@@ -708,7 +718,22 @@ MlasSQNBitGemmBatch(
 
     ptrdiff_t TargetThreadCount = ptrdiff_t(Complexity / double(MLAS_QGEMM_THREAD_COMPLEXITY)) + 1;
 
-    ptrdiff_t MaximumThreadCount = MlasGetMaximumThreadCount(ThreadPool) * 8;
+    //
+    // In the LLM decode loop M is tiny (a handful of in-flight tokens), the
+    // GEMM degenerates to a GEMV bound by streaming the packed B data, and
+    // each call is latency critical. Cap the task count at the physical
+    // thread count so each persistent worker handles a single contiguous N
+    // slice per call instead of paying dispatch overhead for oversubscribed
+    // tiles. For larger M keep the oversubscription, which helps load
+    // balancing when tiles have non-uniform cost.
+    //
+
+    constexpr size_t SmallMThreshold = 8;
+
+    ptrdiff_t MaximumThreadCount = MlasGetMaximumThreadCount(ThreadPool);
+    if (M > SmallMThreshold) {
+        MaximumThreadCount *= 8;
+    }
 
     if (TargetThreadCount >= MaximumThreadCount) {
         TargetThreadCount = MaximumThreadCount;
@@ -756,12 +781,7 @@ MlasSQNBitGemmBatch(
 
         void* PerGemmWorkspace =
             reinterpret_cast<std::byte*>(Workspace) + gemm_i * PerGemmWorkspaceStride;
-        if (ComputeType == CompInt8 && GetMlasPlatform().SQNBitGemmDispatch->SQ4BitGemmPackQuantBDataAndBlkSum != nullptr) {
-            PackedQuantBDataStruct packed_quant_b(const_cast<void*>(Data->QuantBDataWorkspace), N, BlockCountK, BlkLen);
-            const_cast<MLAS_SQNBIT_GEMM_DATA_PARAMS*>(Data)->PackedQuantBData = packed_quant_b.PackedQuantBData;
-            const_cast<MLAS_SQNBIT_GEMM_DATA_PARAMS*>(Data)->QuantBBlkSum = packed_quant_b.QuantBBlkSum;
-            const_cast<MLAS_SQNBIT_GEMM_DATA_PARAMS*>(Data)->QuantBScale = packed_quant_b.PackedQuantBScale;
-
+        if (UseQuantAWorkspace) {
             PerGemmQuantAWorkspace per_gemm_quant_a_workspace(PerGemmWorkspace, M, BlockCountK, BlkLen);
             ComputeOperation(BlkLen, K, Data, &per_gemm_quant_a_workspace, RangeStartM, RangeCountM, RangeStartN, RangeCountN);
         } else {
@@ -0,0 +1,112 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/optimizer/cast_gemm_fusion.h"
+
+#include "core/graph/graph_utils.h"
+#include "core/optimizer/utils.h"
+
+using namespace ONNX_NAMESPACE;
+using namespace ::onnxruntime::common;
+namespace onnxruntime {
+
+namespace {
+
+bool HasElementType(const NodeArg& node_arg, ONNX_NAMESPACE::TensorProto_DataType data_type) {
+  const auto* type = node_arg.TypeAsProto();
+  return type != nullptr && type->tensor_type().elem_type() == data_type;
+}
+
+// Matches a Cast node converting 'from_type' to 'to_type' whose output feeds a single node.
+bool IsSingleUseCast(const Graph& graph, const Node& cast_node,
+                     ONNX_NAMESPACE::TensorProto_DataType from_type,
+                     ONNX_NAMESPACE::TensorProto_DataType to_type) {
+  return graph_utils::IsSupportedOptypeVersionAndDomain(cast_node, "Cast", {6, 9, 13, 19}) &&
+         optimizer_utils::CheckOutputEdges(graph, cast_node, 1) &&
+         HasElementType(*cast_node.InputDefs()[0], from_type) &&
+         HasElementType(*cast_node.OutputDefs()[0], to_type);
+}
+
+}  // namespace
+
+Status CastGemmFusion::ApplyImpl(Graph& graph, bool& modified, int graph_level,
+                                 const logging::Logger& logger) const {
+  GraphViewer graph_viewer(graph);
+  const auto& order = graph_viewer.GetNodesInTopologicalOrder();
+  InlinedVector<std::reference_wrapper<Node>> nodes_to_remove;
+
+  for (auto index : order) {
+    auto* node_ptr = graph.GetNode(index);
+    if (!node_ptr)
+      continue;  // node was removed
+
+    auto& gemm_node = *node_ptr;
+    ORT_RETURN_IF_ERROR(Recurse(gemm_node, modified, graph_level, logger));
+
+    if (!graph_utils::IsSupportedOptypeVersionAndDomain(gemm_node, "Gemm", {7, 9, 11, 13}) ||
+        !graph_utils::IsSupportedProvider(gemm_node, GetCompatibleExecutionProviders()) ||
+        !HasElementType(*gemm_node.OutputDefs()[0], ONNX_NAMESPACE::TensorProto_DataType_FLOAT)) {
+      continue;
+    }
+
+    // all data inputs (A, B and the optional C) must come from single-use float16 -> float Casts
+    // assigned to the same provider, otherwise absorbing them would not remove the conversion
+    InlinedVector<Node*> input_casts;
+    bool all_inputs_cast = true;
+    for (const auto* input_def : gemm_node.InputDefs()) {
+      Node* producer = graph.GetMutableProducerNode(input_def->Name());
+      if (producer == nullptr ||
+          producer->GetExecutionProviderType() != gemm_node.GetExecutionProviderType() ||
+          !IsSingleUseCast(graph, *producer,
+                           ONNX_NAMESPACE::TensorProto_DataType_FLOAT16,
+                           ONNX_NAMESPACE::TensorProto_DataType_FLOAT)) {
+        all_inputs_cast = false;
+        break;
+      }
+      input_casts.push_back(producer);
+    }
+
+    if (!all_inputs_cast || !optimizer_utils::CheckOutputEdges(graph, gemm_node, 1)) {
+      continue;
+    }
+
+    // the only consumer must cast the result straight back to float16
+    Node& output_cast = *graph.GetNode(gemm_node.OutputNodesBegin()->Index());
+    if (output_cast.GetExecutionProviderType() != gemm_node.GetExecutionProviderType() ||
+        !graph_utils::IsSupportedOptypeVersionAndDomain(output_cast, "Cast", {6, 9, 13, 19}) ||
+        !HasElementType(*output_cast.OutputDefs()[0], ONNX_NAMESPACE::TensorProto_DataType_FLOAT16)) {
+      continue;
+    }
+
+    InlinedVector<NodeArg*> input_defs;
+    input_defs.reserve(input_casts.size());
+    for (Node* cast : input_casts) {
+      input_defs.push_back(cast->MutableInputDefs()[0]);
+    }
+
+    Node& fused_gemm = graph.AddNode(graph.GenerateNodeName(gemm_node.Name() + "_fp16"), "Gemm",
+                                     "float16 Gemm absorbing Casts around " + gemm_node.Name(),
+                                     input_defs, output_cast.MutableOutputDefs(),
+                                     &gemm_node.GetAttributes(), kOnnxDomain);
+
+    // Assign provider to this new node. Provider should be same as the provider for old node.
+    fused_gemm.SetExecutionProviderType(gemm_node.GetExecutionProviderType());
+
+    for (Node* cast : input_casts) {
+      nodes_to_remove.push_back(*cast);
+    }
+    nodes_to_remove.push_back(gemm_node);
+    nodes_to_remove.push_back(output_cast);
+  }
+
+  modified = modified || !nodes_to_remove.empty();
+
+  for (const auto& node : nodes_to_remove) {
+    graph_utils::RemoveNodeOutputEdges(graph, node);
+    graph.RemoveNode(node.get().Index());
+  }
+
+  return Status::OK();
+}
+
+}  // namespace onnxruntime
@@ -0,0 +1,30 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/optimizer/graph_transformer.h"
+
+namespace onnxruntime {
+
+/**
+@Class CastGemmFusion
+
+Rewrite a float Gemm whose data inputs are all produced by Cast(float16 -> float) nodes and whose
+only consumer is a Cast(float -> float16) back to a float16 Gemm, absorbing the Casts. Each
+absorbed Cast saves a full read and write of the tensor it streams; the CPU float16 Gemm kernel
+converts on the fly while packing instead. The graph-visible types are unchanged since the
+surrounding tensors were float16 already. If the CPU kernel for float16 Gemm is not available in
+the current build, the cast insertion pass that runs after partitioning restores the float
+computation, so the rewrite is never worse than the original graph.
+*/
+class CastGemmFusion : public GraphTransformer {
+ public:
+  CastGemmFusion(const InlinedHashSet<std::string_view>& compatible_execution_providers = {}) noexcept
+      : GraphTransformer("CastGemmFusion", compatible_execution_providers) {
+  }
+
+  Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+};
+
+}  // namespace onnxruntime
@@ -9,8 +9,11 @@
 #include "core/graph/graph_utils.h"
 #include "core/optimizer/optimizer_execution_frame.h"
 #include "core/optimizer/utils.h"
+#include "core/common/parse_string.h"
 #include "core/framework/op_kernel.h"
 #include "core/framework/tensorprotoutils.h"
+#include "core/platform/threadpool.h"
+#include "core/session/onnxruntime_session_options_config_keys.h"
 
 using namespace onnxruntime::common;
 
@@ -20,12 +23,18 @@ ConstantFolding::ConstantFolding(const IExecutionProvider& execution_provider,
                                  bool skip_dequantize_linear,
                                  const ConfigOptions& config_options,
                                  const InlinedHashSet<std::string_view>& compatible_execution_providers,
-                                 const InlinedHashSet<std::string>& excluded_initializers) noexcept
+                                 const InlinedHashSet<std::string>& excluded_initializers,
+                                 concurrency::ThreadPool* intra_op_thread_pool) noexcept
     : GraphTransformer("ConstantFolding", compatible_execution_providers),
       skip_dequantize_linear_(skip_dequantize_linear),
       config_options_(config_options),
       excluded_initializers_(excluded_initializers),
-      execution_provider_(execution_provider) {
+      execution_provider_(execution_provider),
+      intra_op_thread_pool_(intra_op_thread_pool),
+      folded_size_cap_bytes_(0) {
+  ORT_IGNORE_RETURN_VALUE(TryParseStringWithClassicLocale(
+      config_options.GetConfigOrDefault(kOrtSessionOptionsConstantFoldingSizeCapBytes, "0"),
+      folded_size_cap_bytes_));
 }
 
 // We need to handle a Shape node separately as the input doesn't need to be a constant initializer for
@@ -131,6 +140,122 @@ static Status ConstantFoldIfNode(Graph& graph, Node& if_node, const logging::Log
   return status;
 }
 
+// Check if constant folding can be applied on 'node'. constant_inputs is populated with the constant
+// initializers feeding the node unless skip_inputs_constant_check is set.
+static bool CanConstantFoldNode(const Graph& graph, const Node& node,
+                                const InlinedHashSet<std::string_view>& compatible_execution_providers,
+                                const InlinedHashSet<std::string>& excluded_initializers,
+                                InitializedTensorSet& constant_inputs,
+                                bool skip_inputs_constant_check = false) {
+  return graph_utils::IsSupportedProvider(node, compatible_execution_providers) &&
+         optimizer_utils::IsOperationDeterministic(node.Domain(), node.OpType()) &&
+         // constant folding does not support executing a node that includes subgraphs (control flow operators,
+         // such as If/Loop/Scan, fall into this category). individual nodes in the subgraph will be processed
+         // by the Recurse call in ApplyImpl
+         !node.ContainsSubgraph() &&
+         (skip_inputs_constant_check ||
+          graph_utils::AllNodeInputsAreConstant(graph, node, constant_inputs, excluded_initializers));
+}
+
+// If skip_dequantize_linear is true we want to maintain QDQ node units, so a DequantizeLinear node may only
+// be folded when the whole QDQ node unit can be folded with it.
+//
+// Simplest scenario where the whole QDQ node unit of (DQ -> X -> Q) can be constant folded is if:
+//   - the DQ node does not produce a graph output, and its output is only consumed by X
+//   - X is a deterministic node with a single input and single output
+//   - the output from X is not a graph output and is only consumed by a Q node
+static bool CanConstantFoldQDQNodeUnit(const Graph& graph, const Node& dq_node,
+                                       const InlinedHashSet<std::string_view>& compatible_execution_providers,
+                                       const InlinedHashSet<std::string>& excluded_initializers,
+                                       InitializedTensorSet& constant_inputs) {
+  if (optimizer_utils::CheckOutputEdges(graph, dq_node, 1)) {  // DQ does not produce graph output, single consumer
+    const Node& node_x = *dq_node.OutputNodesBegin();
+    if (node_x.InputDefs().size() == 1 &&
+        node_x.OutputDefs().size() == 1 &&
+        optimizer_utils::CheckOutputEdges(graph, node_x, 1)) {
+      const Node& probably_q = *node_x.OutputNodesBegin();
+
+      if (probably_q.OpType() == "QuantizeLinear") {
+        // the inputs to these nodes are not const yet, but will be if we constant fold,
+        // so set skip_const_check to simulate that having happened
+        constexpr bool skip_const_check = true;
+        return CanConstantFoldNode(graph, node_x, compatible_execution_providers, excluded_initializers,
+                                   constant_inputs, skip_const_check) &&
+               CanConstantFoldNode(graph, probably_q, compatible_execution_providers, excluded_initializers,
+                                   constant_inputs, skip_const_check);
+      }
+    }
+  }
+
+  return false;
+}
+
+// Execute 'node' with the CPU EP kernel and return the computed outputs in 'fetches'.
+// 'evaluated' is set to false (with an OK status) when no CPU kernel is available for the node.
+static Status EvaluateNodeOnCpuEp(const Graph& graph, Node& node,
+                                  const InitializedTensorSet& constant_inputs,
+                                  const IExecutionProvider& execution_provider,
+                                  const ConfigOptions& config_options,
+                                  const std::function<bool(const std::string&)>& is_sparse_initializer_check,
+                                  const logging::Logger& logger,
+                                  bool& evaluated,
+                                  std::vector<OrtValue>& fetches) {
+  evaluated = false;
+
+  // Create execution frame for executing constant nodes.
+  OptimizerExecutionFrame::Info info({&node}, constant_inputs, graph.ModelPath(), execution_provider,
+                                     is_sparse_initializer_check);
+
+  std::vector<int> fetch_mlvalue_idxs;
+  for (const auto* node_out : node.OutputDefs()) {
+    fetch_mlvalue_idxs.push_back(info.GetMLValueIndex(node_out->Name()));
+  }
+
+  const bool node_on_cpu_ep = node.GetExecutionProviderType() == kCpuExecutionProvider;
+
+  std::unique_ptr<const OpKernel> kernel;
+
+  if (!node_on_cpu_ep) {
+    // We need to copy the string here instead of taking a reference to it since node.SetExecutionProviderType
+    // will change the value of the reference
+    auto ep_type = node.GetExecutionProviderType();
+
+    // override the EP assigned to the node so that it will use the CPU kernel for Compute.
+    node.SetExecutionProviderType(kCpuExecutionProvider);
+
+    kernel = info.CreateKernel(&node, config_options);
+
+    // undo the EP change to the value that was assigned at graph partitioning time
+    node.SetExecutionProviderType(ep_type);
+  } else {
+    kernel = info.CreateKernel(&node, config_options);
+  }
+
+  // We currently constant fold using the CPU EP only.
+  // If we can't find a CPU kernel for this node, then we can't proceed with constant folding.
+  //
+  // TODO(adrianlizarraga): Support constant folding with other execution providers. For example, we may be able
+  // to use a CUDA kernel to constant fold operators with data types not supported by the CPU EP kernel.
+  if (kernel == nullptr) {
+    return Status::OK();
+  }
+
+  OptimizerExecutionFrame frame(info, fetch_mlvalue_idxs);
+#ifdef _WIN32
+#pragma warning(push)
+#pragma warning(disable : 6387)
+#endif
+  OpKernelContext op_kernel_context(&frame, kernel.get(), /*stream*/ nullptr, nullptr, logger);
+  ORT_RETURN_IF_ERROR(kernel->Compute(&op_kernel_context));
+#ifdef _WIN32
+#pragma warning(pop)
+#endif
+
+  ORT_RETURN_IF_ERROR(frame.GetOutputs(fetches));
+  evaluated = true;
+  return Status::OK();
+}
+
 Status ConstantFolding::ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const {
   bool have_updated_nodes = false;
   GraphViewer graph_viewer(graph);
@@ -140,8 +265,70 @@ Status ConstantFolding::ApplyImpl(Graph& graph, bool& modified, int graph_level,
   std::function<bool(const std::string&)> is_sparse_initializer_check = [&graph](const std::string& name) -> bool {
     return graph.IsSparseInitializer(name);
   };
+#else
+  std::function<bool(const std::string&)> is_sparse_initializer_check = [](const std::string&) -> bool {
+    return false;
+  };
 #endif
 
+  // Evaluate the kernels of the nodes that are already foldable in parallel before the sequential pass.
+  // Constant folding only ever adds initializers, so a node whose inputs are all constant now still
+  // qualifies when the sequential pass below reaches it and can reuse the pre-computed outputs. Nodes
+  // that only become foldable because an earlier node was folded are evaluated inline as before, as are
+  // nodes whose parallel evaluation failed for any reason.
+  InlinedHashMap<NodeIndex, std::vector<OrtValue>> precomputed_fetches;
+  if (concurrency::ThreadPool::DegreeOfParallelism(intra_op_thread_pool_) > 1) {
+    InlinedVector<std::pair<Node*, InitializedTensorSet>> candidates;
+    for (NodeIndex i : order) {
+      auto* node = graph.GetNode(i);
+      if (!node || node->OpType() == "If" || node->OpType() == "Shape") {
+        continue;
+      }
+
+      InitializedTensorSet constant_inputs;
+      if (!CanConstantFoldNode(graph, *node, GetCompatibleExecutionProviders(), excluded_initializers_,
+                               constant_inputs)) {
+        continue;
+      }
+
+      if (skip_dequantize_linear_ && node->OpType() == "DequantizeLinear" &&
+          !CanConstantFoldQDQNodeUnit(graph, *node, GetCompatibleExecutionProviders(), excluded_initializers_,
+                                      constant_inputs)) {
+        continue;
+      }
+
+      candidates.emplace_back(node, std::move(constant_inputs));
+    }
+
+    if (candidates.size() > 1) {
+      std::vector<std::vector<OrtValue>> results(candidates.size());
+      std::vector<char> succeeded(candidates.size(), 0);
+
+      concurrency::ThreadPool::TrySimpleParallelFor(
+          intra_op_thread_pool_, static_cast<std::ptrdiff_t>(candidates.size()),
+          [&](std::ptrdiff_t idx) {
+            bool evaluated = false;
+            std::vector<OrtValue> fetches;
+            // errors and missing kernels are not reported here; the sequential pass re-evaluates the
+            // node and surfaces them exactly as it did before
+            if (EvaluateNodeOnCpuEp(graph, *candidates[idx].first, candidates[idx].second, execution_provider_,
+                                    config_options_, is_sparse_initializer_check, logger, evaluated, fetches)
+                    .IsOK() &&
+                evaluated) {
+              results[idx] = std::move(fetches);
+              succeeded[idx] = 1;
+            }
+          });
+
+      precomputed_fetches.reserve(candidates.size());
+      for (size_t idx = 0; idx < candidates.size(); ++idx) {
+        if (succeeded[idx]) {
+          precomputed_fetches.emplace(candidates[idx].first->Index(), std::move(results[idx]));
+        }
+      }
+    }
+  }
+
   for (NodeIndex i : order) {
     auto* node = graph.GetNode(i);
     if (!node) {
@@ -177,114 +364,37 @@ Status ConstantFolding::ApplyImpl(Graph& graph, bool& modified, int graph_level,
     } else {
       InitializedTensorSet constant_inputs;
 
-      // Check if constant folding can be applied on this node.
-      const auto can_constant_fold_node = [&](const Node& n, bool skip_inputs_constant_check = false) {
-        return graph_utils::IsSupportedProvider(n, GetCompatibleExecutionProviders()) &&
-               optimizer_utils::IsOperationDeterministic(n.Domain(), n.OpType()) &&
-               // constant folding does not support executing a node that includes subgraphs (control flow operators,
-               // such as If/Loop/Scan, fall into this category). individual nodes in the subgraph will be processed
-               // by the Recurse call above
-               !n.ContainsSubgraph() &&
-               (skip_inputs_constant_check ||
-                graph_utils::AllNodeInputsAreConstant(graph, n, constant_inputs, excluded_initializers_));
-      };
-
-      if (!can_constant_fold_node(*node)) {
+      if (!CanConstantFoldNode(graph, *node, GetCompatibleExecutionProviders(), excluded_initializers_,
+                               constant_inputs)) {
         continue;
       }
 
       // if skip_dequantize_linear is true we want to maintain QDQ node units so avoid constant folding
       // DequantizeLinear unless we can fold the whole QDQ node unit
-      if (skip_dequantize_linear_ && node->OpType() == "DequantizeLinear") {
-        bool can_constant_fold_qdq_node_unit = false;
-
-        // Simplest scenario where the whole QDQ node unit of (DQ -> X -> Q) can be constant folded is if:
-        //   - the DQ node does not produce a graph output, and its output is only consumed by X
-        //   - X is a deterministic node with a single input and single output
-        //   - the output from X is not a graph output and is only consumed by a Q node
-        if (optimizer_utils::CheckOutputEdges(graph, *node, 1)) {  // DQ does not produce graph output, single consumer
-          const Node& node_x = *node->OutputNodesBegin();
-          if (node_x.InputDefs().size() == 1 &&
-              node_x.OutputDefs().size() == 1 &&
-              optimizer_utils::CheckOutputEdges(graph, node_x, 1)) {
-            const Node& probably_q = *node_x.OutputNodesBegin();
-
-            if (probably_q.OpType() == "QuantizeLinear") {
-              // the inputs to these nodes are not const yet, but will be if we constant fold,
-              // so set skip_const_check to simulate that having happened
-              constexpr bool skip_const_check = true;
-              can_constant_fold_qdq_node_unit = can_constant_fold_node(node_x, skip_const_check) &&
-                                                can_constant_fold_node(probably_q, skip_const_check);
-            }
-          }
-        }
-
-        if (!can_constant_fold_qdq_node_unit) {
-          continue;
-        }
-      }
-
-#if !defined(DISABLE_SPARSE_TENSORS)
-      // Create execution frame for executing constant nodes.
-      OptimizerExecutionFrame::Info info({node}, constant_inputs, graph.ModelPath(), execution_provider_,
-                                         is_sparse_initializer_check);
-#else
-      // Create execution frame for executing constant nodes.
-      OptimizerExecutionFrame::Info info({node}, constant_inputs, graph.ModelPath(), execution_provider_,
-                                         [](std::string const&) { return false; });
-#endif
-
-      std::vector<int> fetch_mlvalue_idxs;
-      for (const auto* node_out : node->OutputDefs()) {
-        fetch_mlvalue_idxs.push_back(info.GetMLValueIndex(node_out->Name()));
-      }
-
-      const bool node_on_cpu_ep = node->GetExecutionProviderType() == kCpuExecutionProvider;
-
-      std::unique_ptr<const OpKernel> kernel;
-
-      if (!node_on_cpu_ep) {
-        // We need to copy the string here instead of taking a reference to it since node->SetExecutionProviderType
-        // will change the value of the reference
-        auto ep_type = node->GetExecutionProviderType();
-
-        // override the EP assigned to the node so that it will use the CPU kernel for Compute.
-        node->SetExecutionProviderType(kCpuExecutionProvider);
-
-        kernel = info.CreateKernel(node, config_options_);
-
-        // undo the EP change to the value that was assigned at graph partitioning time
-        node->SetExecutionProviderType(ep_type);
-      } else {
-        kernel = info.CreateKernel(node, config_options_);
-      }
-
-      // We currently constant fold using the CPU EP only.
-      // If we can't find a CPU kernel for this node, then we can't proceed with constant folding.
-      //
-      // TODO(adrianlizarraga): Support constant folding with other execution providers. For example, we may be able
-      // to use a CUDA kernel to constant fold operators with data types not supported by the CPU EP kernel.
-      if (kernel == nullptr) {
-        LOGS(logger, WARNING) << "Could not find a CPU kernel and hence "
-                              << "can't constant fold " << node->OpType() << " node '" << node->Name() << "'";
-
-        // Move on to the next candidate node
+      if (skip_dequantize_linear_ && node->OpType() == "DequantizeLinear" &&
+          !CanConstantFoldQDQNodeUnit(graph, *node, GetCompatibleExecutionProviders(), excluded_initializers_,
+                                      constant_inputs)) {
         continue;
       }
 
-      OptimizerExecutionFrame frame(info, fetch_mlvalue_idxs);
-#ifdef _WIN32
-#pragma warning(push)
-#pragma warning(disable : 6387)
-#endif
-      OpKernelContext op_kernel_context(&frame, kernel.get(), /*stream*/ nullptr, nullptr, logger);
-      ORT_RETURN_IF_ERROR(kernel->Compute(&op_kernel_context));
-#ifdef _WIN32
-#pragma warning(pop)
-#endif
-
       std::vector<OrtValue> fetches;
-      ORT_RETURN_IF_ERROR(frame.GetOutputs(fetches));
+      auto precomputed = precomputed_fetches.find(node->Index());
+      if (precomputed != precomputed_fetches.end()) {
+        fetches = std::move(precomputed->second);
+        precomputed_fetches.erase(precomputed);
+      } else {
+        bool evaluated = false;
+        ORT_RETURN_IF_ERROR(EvaluateNodeOnCpuEp(graph, *node, constant_inputs, execution_provider_,
+                                                config_options_, is_sparse_initializer_check, logger,
+                                                evaluated, fetches));
+        if (!evaluated) {
+          LOGS(logger, WARNING) << "Could not find a CPU kernel and hence "
+                                << "can't constant fold " << node->OpType() << " node '" << node->Name() << "'";
+
+          // Move on to the next candidate node
+          continue;
+        }
+      }
 
       // Go over all output node args and substitute them with the newly computed tensors, which will be
       // added to the graph as initializers.
@@ -301,6 +411,20 @@ Status ConstantFolding::ApplyImpl(Graph& graph, bool& modified, int graph_level,
         }
       }
 
+      // enforce the folded tensor size cap so that folding large subgraphs stays memory-bounded
+      if (converted_to_constant && folded_size_cap_bytes_ > 0) {
+        for (size_t fetch_idx = 0; fetch_idx < fetches.size(); ++fetch_idx) {
+          const Tensor& out_tensor = fetches[fetch_idx].Get<Tensor>();
+          if (static_cast<uint64_t>(out_tensor.SizeInBytes()) > folded_size_cap_bytes_) {
+            LOGS(logger, INFO) << "Skip constant folding " << node->OpType() << " node '" << node->Name()
+                               << "': output " << fetch_idx << " is " << out_tensor.SizeInBytes()
+                               << " bytes which exceeds the configured cap of " << folded_size_cap_bytes_;
+            converted_to_constant = false;
+            break;
+          }
+        }
+      }
+
       if (converted_to_constant) {
         for (size_t fetch_idx = 0; fetch_idx < fetches.size(); ++fetch_idx) {
           OrtValue& ort_value = fetches[fetch_idx];
@@ -10,6 +10,10 @@
 
 namespace onnxruntime {
 
+namespace concurrency {
+class ThreadPool;
+}
+
 /**
 @class ConstantFolding
 
@@ -21,12 +25,14 @@ class ConstantFolding : public GraphTransformer {
   /*! Constant folding will not be applied to nodes that have one of initializers from excluded_initializers as input.
       For pre-training, the trainable weights are those initializers to be excluded.
       \param execution_provider Execution provider instance to execute constant folding.
+      \param intra_op_thread_pool Optional thread pool used to evaluate independent foldable nodes in parallel.
   */
   ConstantFolding(const IExecutionProvider& execution_provider,
                   bool skip_dequantize_linear,
                   const ConfigOptions& config_options,
                   const InlinedHashSet<std::string_view>& compatible_execution_providers = {},
-                  const InlinedHashSet<std::string>& excluded_initializers = {}) noexcept;
+                  const InlinedHashSet<std::string>& excluded_initializers = {},
+                  concurrency::ThreadPool* intra_op_thread_pool = nullptr) noexcept;
 
  private:
   Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
@@ -35,6 +41,11 @@ class ConstantFolding : public GraphTransformer {
   const ConfigOptions& config_options_;
   const InlinedHashSet<std::string> excluded_initializers_;
   const IExecutionProvider& execution_provider_;
+  concurrency::ThreadPool* intra_op_thread_pool_;
+
+  // Limit in bytes on any single tensor produced by folding, from
+  // kOrtSessionOptionsConstantFoldingSizeCapBytes. 0 means no limit.
+  uint64_t folded_size_cap_bytes_;
 };
 
 }  // namespace onnxruntime
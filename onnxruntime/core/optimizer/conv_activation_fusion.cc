@@ -10,6 +10,7 @@
 #include "core/mlas/inc/mlas.h"
 #include "core/graph/graph_utils.h"
 #include "core/graph/node_attr_utils.h"
+#include "core/optimizer/initializer.h"
 #include "core/optimizer/utils.h"
 #include "core/optimizer/selectors_actions/actions.h"
 
@@ -110,6 +111,23 @@ class ConvActivationSelector : public NodeSelector {
       return false;
     };
 
+    // Mul/Add with a scalar float constant operand can be absorbed into a FusedConv
+    // post op chain alongside the activations.
+    auto is_scalar_constant_mul_or_add = [&graph_viewer](const Node& candidate_node) {
+      if (!graph_utils::IsSupportedOptypeVersionAndDomain(candidate_node, "Mul", {7, 13, 14}) &&
+          !graph_utils::IsSupportedOptypeVersionAndDomain(candidate_node, "Add", {7, 13, 14})) {
+        return false;
+      }
+      for (const auto* input_def : candidate_node.InputDefs()) {
+        if (graph_utils::NodeArgIsConstant(graph_viewer.GetGraph(), *input_def) &&
+            optimizer_utils::IsScalar(*input_def) &&
+            HasElementDataType(*input_def, ONNX_NAMESPACE::TensorProto_DataType_FLOAT)) {
+          return true;
+        }
+      }
+      return false;
+    };
+
     if (!ConvFusionDataTypeCheck(node)) {
       return std::nullopt;
     }
@@ -122,6 +140,32 @@ class ConvActivationSelector : public NodeSelector {
         return std::nullopt;
       }
     } else if (node_ep.empty() || node_ep == kCpuExecutionProvider || node_ep == kJsExecutionProvider) {
+      // The CPU FusedConv kernel can absorb an ordered chain of elementwise consumers via
+      // the 'post_ops' attribute: the fusable activations plus Mul/Add with a scalar
+      // constant operand. Each stage must feed a lone consumer on the same EP, and only
+      // the float kernel understands the chain.
+      if (node_ep != kJsExecutionProvider && node.Domain() == kOnnxDomain &&
+          HasElementDataType(*node.InputDefs()[0], ONNX_NAMESPACE::TensorProto_DataType_FLOAT)) {
+        constexpr size_t max_post_ops = 4;
+        InlinedVector<const Node*> chain;
+        const Node* post_op = next_node;
+        while (post_op != nullptr && chain.size() < max_post_ops &&
+               post_op->GetExecutionProviderType() == node_ep &&
+               (is_supported_non_cuda_rocm_ep_activation(*post_op) ||
+                graph_utils::IsSupportedOptypeVersionAndDomain(*post_op, "HardSigmoid", {6}) ||
+                is_scalar_constant_mul_or_add(*post_op))) {
+          chain.push_back(post_op);
+          post_op = GetLoneConsumerNode(graph_viewer, *post_op);
+        }
+        if (chain.size() > 1) {
+          NodesToOptimizeIndicesBuilder builder{};
+          builder.target_node = node.Index();
+          for (const Node* chain_node : chain) {
+            builder.output_nodes.push_back(chain_node->Index());
+          }
+          return builder.Build();
+        }
+      }
       if (!is_supported_non_cuda_rocm_ep_activation(*next_node) &&
           !graph_utils::IsSupportedOptypeVersionAndDomain(*next_node, "HardSigmoid", {6})) {
         return std::nullopt;
@@ -145,6 +189,19 @@ class ConvActivationSelector : public NodeSelector {
 namespace actions {
 using NTO = NodesToOptimize;
 
+// Reads the scalar float constant feeding a Mul/Add node that the selector accepted
+// into a post op chain.
+float GetScalarConstantValue(const Graph& graph, const Node& node) {
+  for (const auto* input_def : node.InputDefs()) {
+    const auto* tensor_proto = graph_utils::GetConstantInitializer(graph, input_def->Name());
+    if (tensor_proto != nullptr) {
+      Initializer value{*tensor_proto, graph.ModelPath()};
+      return *value.data<float>();
+    }
+  }
+  ORT_THROW("Expected a scalar constant input on node: ", node.Name());
+}
+
 class FuseConvActivationAction : public ReplaceWithNew {
  private:
   std::string OpType(const RuntimeState& runtime_state) const override {
@@ -171,9 +228,54 @@ class FuseConvActivationAction : public ReplaceWithNew {
     return domain == kOnnxDomain ? kMSDomain : domain;
   }
 
+  // Appends the parameters for one absorbed node in the order the FusedConv kernel
+  // consumes them.
+  static void AppendPostOpParams(const Graph& graph, const Node& node, InlinedVector<float>& params) {
+    const auto& op_type = node.OpType();
+    if (op_type == "LeakyRelu") {
+      params.push_back(graph_utils::GetNodeAttribute(node, "alpha")->f());
+    } else if (op_type == "Clip") {
+      float min, max;
+      ORT_ENFORCE(optimizer_utils::GetClipConstantMinMax(graph, node, min, max),
+                  "Failed to get Clip min/max constants.");
+      params.push_back(min);
+      params.push_back(max);
+    } else if (op_type == "HardSigmoid") {
+      auto* alpha_attr = graph_utils::GetNodeAttribute(node, "alpha");
+      auto* beta_attr = graph_utils::GetNodeAttribute(node, "beta");
+      params.push_back(alpha_attr == nullptr ? 0.2f : alpha_attr->f());
+      params.push_back(beta_attr == nullptr ? 0.5f : beta_attr->f());
+    } else if (op_type == "Mul" || op_type == "Add") {
+      params.push_back(GetScalarConstantValue(graph, node));
+    }
+  }
+
   NodeAttributes ExtraAttributes(const RuntimeState& state) const override {
     NodeAttributes extra_fused_conv_attributes;
 
+    const auto num_post_ops = state.selected_nodes.num_outputs;
+    if (num_post_ops > 1) {
+      // A chain of absorbed consumers is described by the ordered 'post_ops' attribute,
+      // with the per-stage parameters flattened into 'post_op_params'.
+      InlinedVector<std::string> post_ops;
+      InlinedVector<float> post_op_params;
+      post_ops.reserve(static_cast<size_t>(num_post_ops));
+      for (int i = 0; i < num_post_ops; ++i) {
+        const auto* post_op = state.selected_nodes.Output(i);
+        ORT_ENFORCE(post_op != nullptr, "Expected post op node.");
+        AppendPostOpParams(state.graph, *post_op, post_op_params);
+        post_ops.push_back(post_op->OpType());
+      }
+
+      utils::SetNodeAttribute(utils::MakeAttribute("post_ops", post_ops), extra_fused_conv_attributes);
+      if (!post_op_params.empty()) {
+        utils::SetNodeAttribute(utils::MakeAttribute("post_op_params", post_op_params),
+                                extra_fused_conv_attributes);
+      }
+
+      return extra_fused_conv_attributes;
+    }
+
     const auto* activation = state.selected_nodes.Output(0);
     ORT_ENFORCE(activation != nullptr, "Expected activation node.");
 
@@ -181,22 +283,7 @@ class FuseConvActivationAction : public ReplaceWithNew {
     utils::SetNodeAttribute(utils::MakeAttribute("activation", activation_op_type), extra_fused_conv_attributes);
 
     InlinedVector<float> activation_params;
-    if (activation_op_type == "LeakyRelu") {
-      activation_params.push_back(graph_utils::GetNodeAttribute(*activation, "alpha")->f());
-    } else if (activation_op_type == "Clip") {
-      float min, max;
-      ORT_ENFORCE(optimizer_utils::GetClipConstantMinMax(state.graph, *activation, min, max),
-                  "Failed to get Clip min/max constants.");
-      activation_params.push_back(min);
-      activation_params.push_back(max);
-    } else if (activation_op_type == "HardSigmoid") {
-      auto* alpha_attr = graph_utils::GetNodeAttribute(*activation, "alpha");
-      auto* beta_attr = graph_utils::GetNodeAttribute(*activation, "beta");
-      float alpha = (alpha_attr == nullptr ? 0.2f : alpha_attr->f());
-      float beta = (beta_attr == nullptr ? 0.5f : beta_attr->f());
-      activation_params.push_back(alpha);
-      activation_params.push_back(beta);
-    }
+    AppendPostOpParams(state.graph, *activation, activation_params);
 
     if (!activation_params.empty()) {
       utils::SetNodeAttribute(utils::MakeAttribute("activation_params", activation_params),
@@ -206,13 +293,16 @@ class FuseConvActivationAction : public ReplaceWithNew {
     return extra_fused_conv_attributes;
   }
 
-  std::vector<NodeAndMoveInfo> ValueMoves(const RuntimeState&) const override {
+  std::vector<NodeAndMoveInfo> ValueMoves(const RuntimeState& state) const override {
     const NTO::NodeLocation conv{NTO::NodeType::kTarget, 0};
-    const NTO::NodeLocation activation{NTO::NodeType::kOutput, 0};
+    // The fused node takes its outputs from the last absorbed node. Scalar constant
+    // inputs of absorbed Mul/Add nodes are deliberately not moved: their values are
+    // baked into the 'post_op_params' attribute.
+    const NTO::NodeLocation last_post_op{NTO::NodeType::kOutput, state.selected_nodes.num_outputs - 1};
 
     return {
-        MoveAll(conv, ArgType::kInput),         // move all inputs from conv
-        MoveAll(activation, ArgType::kOutput),  // move all outputs from activation
+        MoveAll(conv, ArgType::kInput),           // move all inputs from conv
+        MoveAll(last_post_op, ArgType::kOutput),  // move all outputs from the last absorbed node
     };
   }
 };
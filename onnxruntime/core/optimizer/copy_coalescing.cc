@@ -0,0 +1,503 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/optimizer/copy_coalescing.h"
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <numeric>
+
+#include "core/framework/tensorprotoutils.h"
+#include "core/graph/graph.h"
+#include "core/graph/graph_utils.h"
+#include "core/optimizer/initializer.h"
+#include "core/optimizer/utils.h"
+
+namespace onnxruntime {
+
+namespace {
+
+constexpr int64_t kSliceToEnd = std::numeric_limits<int64_t>::max();
+
+// Returns a pointer to the corresponding NodeArg if input of the node at this index exists; otherwise, a nullptr.
+const NodeArg* GetInputIfExists(const Node& node, size_t input_idx) {
+  const auto& input_defs = node.InputDefs();
+  const NodeArg* input = (input_defs.size() > input_idx) ? input_defs[input_idx] : nullptr;
+  return (input == nullptr || !input->Exists()) ? nullptr : input;
+}
+
+// Reads an int32/int64 constant initializer input into 'values'. Returns false when the input is
+// missing or not a constant initializer.
+bool GetConstantInt64Input(const Graph& graph, const Node& node, size_t input_idx,
+                           InlinedVector<int64_t>& values) {
+  const NodeArg* input = GetInputIfExists(node, input_idx);
+  if (input == nullptr) {
+    return false;
+  }
+
+  const ONNX_NAMESPACE::TensorProto* initializer = graph_utils::GetConstantInitializer(graph, input->Name());
+  if (initializer == nullptr) {
+    return false;
+  }
+
+  Initializer init(*initializer, graph.ModelPath());
+  if (initializer->data_type() == ONNX_NAMESPACE::TensorProto::INT32) {
+    const int32_t* data = init.data<int32_t>();
+    values.assign(data, data + init.size());
+  } else if (initializer->data_type() == ONNX_NAMESPACE::TensorProto::INT64) {
+    const int64_t* data = init.data<int64_t>();
+    values.assign(data, data + init.size());
+  } else {
+    return false;
+  }
+
+  return true;
+}
+
+// Per-axis slice window, keyed by axis so windows of two nodes can be matched up.
+// Only populated by GetSliceWindows for slices whose composition is exact without knowing the
+// input shape: constant parameters, unit steps, non-negative starts and axes, and ends that are
+// non-negative or INT64_MAX ("to the end").
+using SliceWindows = std::map<int64_t, std::pair<int64_t, int64_t>>;
+
+bool GetSliceWindows(const Graph& graph, const Node& node, SliceWindows& windows) {
+  // only the opset >= 10 form with starts/ends/axes/steps as inputs
+  if (!graph_utils::IsSupportedOptypeVersionAndDomain(node, "Slice", {10, 11, 13})) {
+    return false;
+  }
+
+  InlinedVector<int64_t> starts;
+  InlinedVector<int64_t> ends;
+  if (!GetConstantInt64Input(graph, node, 1, starts) ||
+      !GetConstantInt64Input(graph, node, 2, ends) ||
+      starts.empty() || starts.size() != ends.size()) {
+    return false;
+  }
+
+  InlinedVector<int64_t> axes;
+  if (GetInputIfExists(node, 3) != nullptr) {
+    if (!GetConstantInt64Input(graph, node, 3, axes) || axes.size() != starts.size()) {
+      return false;
+    }
+  } else {
+    axes.resize(starts.size());
+    std::iota(axes.begin(), axes.end(), 0);
+  }
+
+  if (GetInputIfExists(node, 4) != nullptr) {
+    InlinedVector<int64_t> steps;
+    if (!GetConstantInt64Input(graph, node, 4, steps) || steps.size() != starts.size() ||
+        std::any_of(steps.begin(), steps.end(), [](int64_t step) { return step != 1; })) {
+      return false;
+    }
+  }
+
+  windows.clear();
+  for (size_t i = 0; i < starts.size(); ++i) {
+    if (axes[i] < 0 || starts[i] < 0 || (ends[i] < 0 && ends[i] != kSliceToEnd)) {
+      return false;
+    }
+    if (!windows.emplace(axes[i], std::make_pair(starts[i], ends[i])).second) {
+      return false;  // duplicate axis
+    }
+  }
+
+  return true;
+}
+
+struct PadParams {
+  std::string mode;
+  InlinedVector<int64_t> pads;
+  const NodeArg* value_arg = nullptr;  // optional constant_value input
+};
+
+bool GetPadParams(const Graph& graph, const Node& node, PadParams& params) {
+  // only the opset >= 11 form with pads as an input, and without the opset 18 axes input
+  if (!graph_utils::IsSupportedOptypeVersionAndDomain(node, "Pad", {11, 13, 18, 19}) ||
+      GetInputIfExists(node, 3) != nullptr) {
+    return false;
+  }
+
+  const auto& attributes = node.GetAttributes();
+  auto mode_it = attributes.find("mode");
+  params.mode = (mode_it != attributes.end()) ? mode_it->second.s() : "constant";
+
+  if (!GetConstantInt64Input(graph, node, 1, params.pads) ||
+      params.pads.empty() || params.pads.size() % 2 != 0) {
+    return false;
+  }
+
+  // negative pads crop rather than pad and do not compose by summation
+  if (std::any_of(params.pads.begin(), params.pads.end(), [](int64_t pad) { return pad < 0; })) {
+    return false;
+  }
+
+  params.value_arg = GetInputIfExists(node, 2);
+  if (params.value_arg != nullptr &&
+      graph_utils::GetConstantInitializer(graph, params.value_arg->Name()) == nullptr) {
+    return false;
+  }
+
+  return true;
+}
+
+// Whether two (possibly absent, meaning zero) constant_value inputs hold the same value.
+bool PadValuesEqual(const Graph& graph, const NodeArg* a, const NodeArg* b) {
+  auto is_zero = [&graph](const NodeArg* arg) {
+    if (arg == nullptr) {
+      return true;
+    }
+    Initializer init(*graph_utils::GetConstantInitializer(graph, arg->Name()), graph.ModelPath());
+    const auto bytes = init.DataAsByteSpan();
+    return std::all_of(bytes.begin(), bytes.end(), [](uint8_t byte) { return byte == 0; });
+  };
+
+  if (a == nullptr || b == nullptr) {
+    return is_zero(a) && is_zero(b);
+  }
+
+  Initializer init_a(*graph_utils::GetConstantInitializer(graph, a->Name()), graph.ModelPath());
+  Initializer init_b(*graph_utils::GetConstantInitializer(graph, b->Name()), graph.ModelPath());
+  const auto bytes_a = init_a.DataAsByteSpan();
+  const auto bytes_b = init_b.DataAsByteSpan();
+  return init_a.data_type() == init_b.data_type() &&
+         bytes_a.size() == bytes_b.size() &&
+         std::equal(bytes_a.begin(), bytes_a.end(), bytes_b.begin());
+}
+
+// The producer of the node's first input, if it can be folded into the node: single consumer and
+// not required as a graph output.
+const Node* GetCoalescableProducer(const Graph& graph, const Node& node) {
+  const Node* producer = graph_utils::GetInputNode(node, 0);
+  if (producer == nullptr || producer->GetOutputEdgesCount() != 1 ||
+      graph.NodeProducesGraphOutput(*producer)) {
+    return nullptr;
+  }
+  return producer;
+}
+
+NodeArg& AddInt64Initializer(Graph& graph, const std::string& name_hint, gsl::span<const int64_t> values) {
+  ONNX_NAMESPACE::TensorProto proto;
+  proto.set_name(graph.GenerateNodeArgName(name_hint));
+  proto.set_data_type(ONNX_NAMESPACE::TensorProto::INT64);
+  proto.add_dims(static_cast<int64_t>(values.size()));
+  for (int64_t value : values) {
+    proto.add_int64_data(value);
+  }
+  return graph_utils::AddInitializer(graph, proto);
+}
+
+// Builds a Slice node for the given windows, taking over 'output' which belongs to the node(s)
+// being replaced. The caller finalizes the fusion to move the edges.
+Node& AddSliceNode(Graph& graph, const std::string& name_hint, NodeArg& data, NodeArg* output,
+                   const SliceWindows& windows) {
+  InlinedVector<int64_t> starts, ends, axes;
+  starts.reserve(windows.size());
+  ends.reserve(windows.size());
+  axes.reserve(windows.size());
+  for (const auto& [axis, window] : windows) {
+    axes.push_back(axis);
+    starts.push_back(window.first);
+    ends.push_back(window.second);
+  }
+  InlinedVector<int64_t> steps(windows.size(), 1);
+
+  return graph.AddNode(graph.GenerateNodeName(name_hint), "Slice", "coalesced data movement",
+                       {&data,
+                        &AddInt64Initializer(graph, name_hint + "_starts", starts),
+                        &AddInt64Initializer(graph, name_hint + "_ends", ends),
+                        &AddInt64Initializer(graph, name_hint + "_axes", axes),
+                        &AddInt64Initializer(graph, name_hint + "_steps", steps)},
+                       {output});
+}
+
+int64_t SaturatingAdd(int64_t a, int64_t b) {
+  return (b > kSliceToEnd - a) ? kSliceToEnd : a + b;
+}
+
+// Composes two slice windows applied in sequence into one. With non-negative starts/ends and
+// unit steps, clamping to the (unknown) dimension commutes with the composition, so the result
+// is exact for any input shape.
+SliceWindows ComposeSliceWindows(const SliceWindows& first, const SliceWindows& second) {
+  SliceWindows composed = first;
+  for (const auto& [axis, window] : second) {
+    auto it = composed.find(axis);
+    if (it == composed.end()) {
+      composed.emplace(axis, window);
+      continue;
+    }
+
+    const auto [start1, end1] = it->second;
+    const auto [start2, end2] = window;
+    const int64_t start = SaturatingAdd(start1, start2);
+    int64_t end;
+    if (end2 == kSliceToEnd) {
+      end = end1;
+    } else if (end1 == kSliceToEnd) {
+      end = SaturatingAdd(start1, end2);
+    } else {
+      end = std::min(end1, SaturatingAdd(start1, end2));
+    }
+    it->second = {start, end};
+  }
+  return composed;
+}
+
+// Shifts the slice windows of 'slice' past the pads of 'pad', producing windows that apply
+// directly to the unpadded data. Returns false unless every window provably stays within the
+// original data (so the pad values are never read) and every padded axis is sliced.
+bool ComposePadSliceWindows(const Node& pad, const InlinedVector<int64_t>& pads,
+                            const SliceWindows& slice_windows, SliceWindows& composed) {
+  const size_t rank = pads.size() / 2;
+  const auto* data_shape = pad.InputDefs()[0]->Shape();
+
+  composed.clear();
+  for (const auto& [axis, window] : slice_windows) {
+    if (static_cast<size_t>(axis) >= rank) {
+      return false;
+    }
+
+    const int64_t pad_begin = pads[static_cast<size_t>(axis)];
+    const int64_t pad_end = pads[rank + static_cast<size_t>(axis)];
+    const auto [start, end] = window;
+
+    if (start < pad_begin) {
+      return false;  // the window starts inside the leading padding
+    }
+
+    int64_t new_end;
+    if (end == kSliceToEnd) {
+      if (pad_end != 0) {
+        return false;  // an open-ended window would include the trailing padding
+      }
+      new_end = kSliceToEnd;
+    } else {
+      if (pad_end != 0) {
+        // the window must provably end before the trailing padding, which needs the dimension
+        if (data_shape == nullptr || axis >= data_shape->dim_size() ||
+            !utils::HasDimValue(data_shape->dim(static_cast<int>(axis))) ||
+            end > pad_begin + data_shape->dim(static_cast<int>(axis)).dim_value()) {
+          return false;
+        }
+      }
+      new_end = end - pad_begin;
+    }
+
+    composed.emplace(axis, std::make_pair(start - pad_begin, new_end));
+  }
+
+  // axes that are not sliced keep their full padded extent, so they must be unpadded
+  for (size_t axis = 0; axis < rank; ++axis) {
+    if ((pads[axis] != 0 || pads[rank + axis] != 0) &&
+        composed.find(static_cast<int64_t>(axis)) == composed.end()) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+}  // namespace
+
+bool SliceSliceCoalescing::SatisfyCondition(const Graph& graph, const Node& node, const logging::Logger&) const {
+  SliceWindows downstream;
+  if (!GetSliceWindows(graph, node, downstream)) {
+    return false;
+  }
+
+  const Node* producer = GetCoalescableProducer(graph, node);
+  SliceWindows upstream;
+  return producer != nullptr && GetSliceWindows(graph, *producer, upstream);
+}
+
+Status SliceSliceCoalescing::Apply(Graph& graph, Node& node, RewriteRuleEffect& rule_effect, const logging::Logger&) const {
+  Node& producer = *graph.GetNode(GetCoalescableProducer(graph, node)->Index());
+
+  SliceWindows upstream, downstream;
+  ORT_ENFORCE(GetSliceWindows(graph, producer, upstream) && GetSliceWindows(graph, node, downstream));
+
+  Node& replacement = AddSliceNode(graph, node.Name() + "_coalesced", *producer.MutableInputDefs()[0],
+                                   node.MutableOutputDefs()[0], ComposeSliceWindows(upstream, downstream));
+  replacement.SetExecutionProviderType(node.GetExecutionProviderType());
+  graph_utils::FinalizeNodeFusion(graph, {producer, node}, replacement);
+
+  rule_effect = RewriteRuleEffect::kRemovedCurrentNode;
+  return Status::OK();
+}
+
+bool PadPadCoalescing::SatisfyCondition(const Graph& graph, const Node& node, const logging::Logger&) const {
+  PadParams downstream;
+  if (!GetPadParams(graph, node, downstream)) {
+    return false;
+  }
+
+  const Node* producer = GetCoalescableProducer(graph, node);
+  PadParams upstream;
+  if (producer == nullptr || !GetPadParams(graph, *producer, upstream) ||
+      upstream.mode != downstream.mode || upstream.pads.size() != downstream.pads.size()) {
+    return false;
+  }
+
+  // stacking pads is only equivalent to padding once when the border values agree: always for
+  // "edge", for "constant" when both nodes pad with the same value, never for "reflect"/"wrap"
+  if (downstream.mode == "edge") {
+    return true;
+  }
+  return downstream.mode == "constant" && PadValuesEqual(graph, upstream.value_arg, downstream.value_arg);
+}
+
+Status PadPadCoalescing::Apply(Graph& graph, Node& node, RewriteRuleEffect& rule_effect, const logging::Logger&) const {
+  Node& producer = *graph.GetNode(GetCoalescableProducer(graph, node)->Index());
+
+  PadParams upstream, downstream;
+  ORT_ENFORCE(GetPadParams(graph, producer, upstream) && GetPadParams(graph, node, downstream));
+
+  InlinedVector<int64_t> summed_pads(upstream.pads.size());
+  for (size_t i = 0; i < summed_pads.size(); ++i) {
+    summed_pads[i] = upstream.pads[i] + downstream.pads[i];
+  }
+
+  const std::string name_hint = node.Name() + "_coalesced";
+  InlinedVector<NodeArg*> input_defs{producer.MutableInputDefs()[0],
+                                     &AddInt64Initializer(graph, name_hint + "_pads", summed_pads)};
+  if (downstream.value_arg != nullptr) {
+    input_defs.push_back(node.MutableInputDefs()[2]);
+  } else if (upstream.value_arg != nullptr) {
+    input_defs.push_back(producer.MutableInputDefs()[2]);
+  }
+
+  Node& replacement = graph.AddNode(graph.GenerateNodeName(name_hint), "Pad", "coalesced data movement",
+                                    input_defs, {node.MutableOutputDefs()[0]});
+  replacement.AddAttribute("mode", downstream.mode);
+  replacement.SetExecutionProviderType(node.GetExecutionProviderType());
+  graph_utils::FinalizeNodeFusion(graph, {producer, node}, replacement);
+
+  rule_effect = RewriteRuleEffect::kRemovedCurrentNode;
+  return Status::OK();
+}
+
+bool PadSliceCoalescing::SatisfyCondition(const Graph& graph, const Node& node, const logging::Logger&) const {
+  SliceWindows slice_windows;
+  if (!GetSliceWindows(graph, node, slice_windows)) {
+    return false;
+  }
+
+  const Node* producer = GetCoalescableProducer(graph, node);
+  PadParams pad_params;
+  SliceWindows composed;
+  return producer != nullptr && GetPadParams(graph, *producer, pad_params) &&
+         ComposePadSliceWindows(*producer, pad_params.pads, slice_windows, composed);
+}
+
+Status PadSliceCoalescing::Apply(Graph& graph, Node& node, RewriteRuleEffect& rule_effect, const logging::Logger&) const {
+  Node& producer = *graph.GetNode(GetCoalescableProducer(graph, node)->Index());
+
+  SliceWindows slice_windows, composed;
+  PadParams pad_params;
+  ORT_ENFORCE(GetSliceWindows(graph, node, slice_windows) &&
+              GetPadParams(graph, producer, pad_params) &&
+              ComposePadSliceWindows(producer, pad_params.pads, slice_windows, composed));
+
+  Node& replacement = AddSliceNode(graph, node.Name() + "_coalesced", *producer.MutableInputDefs()[0],
+                                   node.MutableOutputDefs()[0], composed);
+  replacement.SetExecutionProviderType(node.GetExecutionProviderType());
+  graph_utils::FinalizeNodeFusion(graph, {producer, node}, replacement);
+
+  rule_effect = RewriteRuleEffect::kRemovedCurrentNode;
+  return Status::OK();
+}
+
+// Collects the Slice producers of a Concat's inputs when they form one contiguous window:
+// same source tensor, identical windows except on the concat axis, and adjacent there in input
+// order. On success 'combined' holds the covering window.
+static bool MatchContiguousSlices(const Graph& graph, const Node& concat,
+                                  InlinedVector<const Node*>& slices, SliceWindows& combined) {
+  const auto* axis_attr = graph_utils::GetNodeAttribute(concat, "axis");
+  if (axis_attr == nullptr || !utils::HasInt(*axis_attr) || axis_attr->i() < 0) {
+    return false;
+  }
+  const int64_t concat_axis = axis_attr->i();
+
+  const size_t num_inputs = concat.InputDefs().size();
+  if (num_inputs < 2) {
+    return false;
+  }
+
+  slices.clear();
+  slices.reserve(num_inputs);
+  SliceWindows first_windows;
+
+  for (size_t i = 0; i < num_inputs; ++i) {
+    const Node* slice = graph_utils::GetInputNode(concat, static_cast<int>(i));
+    SliceWindows windows;
+    if (slice == nullptr || slice->GetOutputEdgesCount() != 1 || graph.NodeProducesGraphOutput(*slice) ||
+        !GetSliceWindows(graph, *slice, windows) ||
+        windows.find(concat_axis) == windows.end()) {
+      return false;
+    }
+
+    if (i == 0) {
+      first_windows = windows;
+      combined = std::move(windows);
+      slices.push_back(slice);
+      continue;
+    }
+
+    // same source tensor and identical windows on every axis but the concat axis
+    if (slice->InputDefs()[0]->Name() != slices.front()->InputDefs()[0]->Name() ||
+        windows.size() != first_windows.size()) {
+      return false;
+    }
+    for (const auto& [axis, window] : windows) {
+      auto it = first_windows.find(axis);
+      if (it == first_windows.end() || (axis != concat_axis && window != it->second)) {
+        return false;
+      }
+    }
+
+    // adjacent on the concat axis: this window starts where the previous one ended
+    auto& combined_window = combined[concat_axis];
+    if (combined_window.second == kSliceToEnd || combined_window.second != windows[concat_axis].first) {
+      return false;
+    }
+    combined_window.second = windows[concat_axis].second;
+    slices.push_back(slice);
+  }
+
+  return true;
+}
+
+bool ConcatSliceCoalescing::SatisfyCondition(const Graph& graph, const Node& node, const logging::Logger&) const {
+  if (!graph_utils::IsSupportedOptypeVersionAndDomain(node, "Concat", {4, 11, 13})) {
+    return false;
+  }
+
+  InlinedVector<const Node*> slices;
+  SliceWindows combined;
+  return MatchContiguousSlices(graph, node, slices, combined);
+}
+
+Status ConcatSliceCoalescing::Apply(Graph& graph, Node& node, RewriteRuleEffect& rule_effect, const logging::Logger&) const {
+  InlinedVector<const Node*> slices;
+  SliceWindows combined;
+  ORT_ENFORCE(MatchContiguousSlices(graph, node, slices, combined));
+
+  Node& first_slice = *graph.GetNode(slices.front()->Index());
+  Node& replacement = AddSliceNode(graph, node.Name() + "_coalesced", *first_slice.MutableInputDefs()[0],
+                                   node.MutableOutputDefs()[0], combined);
+  replacement.SetExecutionProviderType(node.GetExecutionProviderType());
+
+  InlinedVector<std::reference_wrapper<Node>> nodes_to_remove;
+  nodes_to_remove.reserve(slices.size() + 1);
+  for (const Node* slice : slices) {
+    nodes_to_remove.push_back(*graph.GetNode(slice->Index()));
+  }
+  nodes_to_remove.push_back(node);
+  graph_utils::FinalizeNodeFusion(graph, nodes_to_remove, replacement);
+
+  rule_effect = RewriteRuleEffect::kRemovedCurrentNode;
+  return Status::OK();
+}
+
+}  // namespace onnxruntime
@@ -0,0 +1,103 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/optimizer/rewrite_rule.h"
+
+namespace onnxruntime {
+
+/**
+@Class SliceSliceCoalescing
+
+Rewrite rule that composes a Slice whose input is produced by another Slice into a single Slice,
+so the chain costs one copy instead of two. Requires constant starts/ends/axes with unit steps
+and non-negative starts and ends (or INT64_MAX for "to the end") on both nodes, which makes the
+composition exact without knowing the input shape.
+
+It is attempted to be triggered only on nodes with op type "Slice".
+*/
+class SliceSliceCoalescing : public RewriteRule {
+ public:
+  SliceSliceCoalescing() noexcept : RewriteRule("SliceSliceCoalescing") {}
+
+  std::vector<std::string> TargetOpTypes() const noexcept override {
+    return {"Slice"};
+  }
+
+ private:
+  bool SatisfyCondition(const Graph& graph, const Node& node, const logging::Logger& logger) const override;
+
+  Status Apply(Graph& graph, Node& node, RewriteRuleEffect& rule_effect, const logging::Logger& logger) const override;
+};
+
+/**
+@Class PadPadCoalescing
+
+Rewrite rule that composes a Pad whose input is produced by another Pad into a single Pad with
+the elementwise sum of the two pads vectors. Supported for "edge" mode and for "constant" mode
+when both nodes pad with the same value, where stacking pads is equivalent to padding once.
+
+It is attempted to be triggered only on nodes with op type "Pad".
+*/
+class PadPadCoalescing : public RewriteRule {
+ public:
+  PadPadCoalescing() noexcept : RewriteRule("PadPadCoalescing") {}
+
+  std::vector<std::string> TargetOpTypes() const noexcept override {
+    return {"Pad"};
+  }
+
+ private:
+  bool SatisfyCondition(const Graph& graph, const Node& node, const logging::Logger& logger) const override;
+
+  Status Apply(Graph& graph, Node& node, RewriteRuleEffect& rule_effect, const logging::Logger& logger) const override;
+};
+
+/**
+@Class PadSliceCoalescing
+
+Rewrite rule that drops a Pad feeding a Slice when the slice window lies entirely within the
+original (unpadded) data, shifting the slice starts/ends by the leading pads. The pad values are
+never read in that case, so the pair collapses to a single Slice regardless of the pad mode.
+
+It is attempted to be triggered only on nodes with op type "Slice".
+*/
+class PadSliceCoalescing : public RewriteRule {
+ public:
+  PadSliceCoalescing() noexcept : RewriteRule("PadSliceCoalescing") {}
+
+  std::vector<std::string> TargetOpTypes() const noexcept override {
+    return {"Slice"};
+  }
+
+ private:
+  bool SatisfyCondition(const Graph& graph, const Node& node, const logging::Logger& logger) const override;
+
+  Status Apply(Graph& graph, Node& node, RewriteRuleEffect& rule_effect, const logging::Logger& logger) const override;
+};
+
+/**
+@Class ConcatSliceCoalescing
+
+Rewrite rule that replaces a Concat of adjacent Slices of the same tensor with a single Slice
+covering the combined window. The slices must use identical axes and unit steps, differ only on
+the concat axis, and be contiguous there (each window ends where the next one starts).
+
+It is attempted to be triggered only on nodes with op type "Concat".
+*/
+class ConcatSliceCoalescing : public RewriteRule {
+ public:
+  ConcatSliceCoalescing() noexcept : RewriteRule("ConcatSliceCoalescing") {}
+
+  std::vector<std::string> TargetOpTypes() const noexcept override {
+    return {"Concat"};
+  }
+
+ private:
+  bool SatisfyCondition(const Graph& graph, const Node& node, const logging::Logger& logger) const override;
+
+  Status Apply(Graph& graph, Node& node, RewriteRuleEffect& rule_effect, const logging::Logger& logger) const override;
+};
+
+}  // namespace onnxruntime
@@ -0,0 +1,145 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/optimizer/elementwise_fusion.h"
+
+#include "core/graph/graph_utils.h"
+#include "core/optimizer/utils.h"
+
+using namespace ONNX_NAMESPACE;
+using namespace ::onnxruntime::common;
+namespace onnxruntime {
+
+namespace {
+
+// The supported ops must match the steps implemented by the FusedElementwise CPU kernel.
+// If an op has multiple versions, a single implementation must work across all of them,
+// because the fusion discards the op version information.
+bool IsFusableUnary(const Node& node) {
+  return graph_utils::IsSupportedOptypeVersionAndDomain(node, "Sigmoid", {6, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Tanh", {6, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Relu", {6, 13, 14}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Exp", {6, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Sqrt", {6, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Neg", {6, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Abs", {6, 13});
+}
+
+bool IsFusableBinary(const Node& node) {
+  return graph_utils::IsSupportedOptypeVersionAndDomain(node, "Add", {7, 13, 14}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Sub", {7, 13, 14}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Mul", {7, 13, 14}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Div", {7, 13, 14});
+}
+
+// Returns the index of the input that carries the streamed tensor, or -1 if the node
+// cannot be a step of a fused chain. For binary nodes the other input must be a constant
+// float scalar initializer; its value and position are returned in scalar/scalar_first.
+int GetStreamedInputIndex(const Graph& graph, const Node& node, float& scalar, bool& scalar_first) {
+  scalar = 0.f;
+  scalar_first = false;
+
+  if (IsFusableUnary(node)) {
+    return 0;
+  }
+
+  if (IsFusableBinary(node)) {
+    if (optimizer_utils::GetScalarInitializerValue<float>(graph, *node.InputDefs()[1], scalar, true)) {
+      return 0;
+    }
+    if (optimizer_utils::GetScalarInitializerValue<float>(graph, *node.InputDefs()[0], scalar, true)) {
+      scalar_first = true;
+      return 1;
+    }
+  }
+
+  return -1;
+}
+
+}  // namespace
+
+Status ElementwiseFusion::ApplyImpl(Graph& graph, bool& modified, int graph_level,
+                                    const logging::Logger& logger) const {
+  GraphViewer graph_viewer(graph);
+  const auto& order = graph_viewer.GetNodesInTopologicalOrder();
+
+  for (auto index : order) {
+    auto* node_ptr = graph.GetNode(index);
+    if (!node_ptr)
+      continue;  // node was removed as part of an earlier fusion
+
+    auto& node = *node_ptr;
+    ORT_RETURN_IF_ERROR(Recurse(node, modified, graph_level, logger));
+
+    if (!graph_utils::IsSupportedProvider(node, GetCompatibleExecutionProviders())) {
+      continue;
+    }
+
+    float scalar = 0.f;
+    bool scalar_first = false;
+    int streamed_input_idx = GetStreamedInputIndex(graph, node, scalar, scalar_first);
+    if (streamed_input_idx < 0) {
+      continue;
+    }
+
+    NodeArg* streamed_input = node.MutableInputDefs()[streamed_input_idx];
+    const auto* type_proto = streamed_input->TypeAsProto();
+    if (type_proto == nullptr ||
+        type_proto->tensor_type().elem_type() != ONNX_NAMESPACE::TensorProto_DataType_FLOAT) {
+      // FusedElementwise is only registered for float in fused_elementwise.cc
+      continue;
+    }
+
+    // Grow the chain downwards for as long as the current tail has a single consumer
+    // which is itself a fusable step over the tail's output. Since we visit nodes in
+    // topological order the resulting chain is maximal.
+    InlinedVector<std::reference_wrapper<Node>> chain{node};
+    InlinedVector<std::string> step_ops{node.OpType()};
+    InlinedVector<float> step_scalars{scalar};
+    InlinedVector<int64_t> step_scalar_first{scalar_first ? int64_t(1) : int64_t(0)};
+
+    Node* tail = &node;
+    while (tail->GetOutputEdgesCount() == 1 && !graph.NodeProducesGraphOutput(*tail)) {
+      Node& next = *graph.GetNode(tail->OutputNodesBegin()->Index());
+      if (next.GetExecutionProviderType() != node.GetExecutionProviderType()) {
+        break;
+      }
+
+      float next_scalar = 0.f;
+      bool next_scalar_first = false;
+      int next_streamed_idx = GetStreamedInputIndex(graph, next, next_scalar, next_scalar_first);
+      if (next_streamed_idx < 0 || next.InputDefs()[next_streamed_idx] != tail->OutputDefs()[0]) {
+        break;
+      }
+
+      chain.push_back(next);
+      step_ops.push_back(next.OpType());
+      step_scalars.push_back(next_scalar);
+      step_scalar_first.push_back(next_scalar_first ? 1 : 0);
+      tail = &next;
+    }
+
+    if (chain.size() < 2) {
+      continue;
+    }
+
+    Node& fused_node = graph.AddNode(graph.GenerateNodeName("FusedElementwise"),
+                                     "FusedElementwise",
+                                     "fused elementwise chain starting at " + node.Name(),
+                                     {streamed_input}, {}, nullptr, kMSDomain);
+    fused_node.AddAttribute("steps", gsl::span<const std::string>(step_ops.data(), step_ops.size()));
+    fused_node.AddAttribute("scalars", gsl::span<const float>(step_scalars.data(), step_scalars.size()));
+    fused_node.AddAttribute("scalar_first", gsl::span<const int64_t>(step_scalar_first.data(), step_scalar_first.size()));
+    fused_node.SetExecutionProviderType(node.GetExecutionProviderType());
+
+    // move the output definitions and edges from the chain's tail to the fused node and
+    // remove the chain
+    graph_utils::FinalizeNodeFusion(graph, chain, fused_node);
+
+    modified = true;
+  }
+
+  return Status::OK();
+}
+
+}  // namespace onnxruntime
@@ -0,0 +1,30 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/optimizer/graph_transformer.h"
+
+namespace onnxruntime {
+
+/**
+@Class ElementwiseFusion
+
+Transformer that collapses chains of elementwise nodes into a single
+com.microsoft.FusedElementwise node which executes the whole chain as a per-element
+program in one streaming pass over the tensor, instead of one full memory pass per node.
+
+A chain step is either a supported unary elementwise op (Sigmoid, Tanh, Relu, Exp, Sqrt,
+Neg, Abs) or a supported binary op (Add, Sub, Mul, Div) whose other input is a constant
+scalar initializer. Intermediate outputs must have a single consumer and must not be
+graph outputs.
+*/
+class ElementwiseFusion : public GraphTransformer {
+ public:
+  ElementwiseFusion(const InlinedHashSet<std::string_view>& compatible_execution_providers = {}) noexcept
+      : GraphTransformer("ElementwiseFusion", compatible_execution_providers) {}
+
+  Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+};
+
+}  // namespace onnxruntime
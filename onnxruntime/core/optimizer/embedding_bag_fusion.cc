@@ -0,0 +1,147 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/optimizer/embedding_bag_fusion.h"
+
+#include "core/graph/graph_utils.h"
+#include "core/optimizer/utils.h"
+
+using namespace ONNX_NAMESPACE;
+using namespace ::onnxruntime::common;
+namespace onnxruntime {
+
+namespace {
+
+// Returns true if 'node_arg' is a statically shaped tensor of the given element type
+// and rank, leaving the shape in 'shape'.
+bool GetTypedShape(const NodeArg& node_arg, int32_t elem_type, const TensorShapeProto*& shape) {
+  const auto* type_proto = node_arg.TypeAsProto();
+  if (type_proto == nullptr || type_proto->tensor_type().elem_type() != elem_type) {
+    return false;
+  }
+  shape = node_arg.Shape();
+  return shape != nullptr;
+}
+
+// Reads the reduction axes of 'reduce_node', which live in the 'axes' attribute for the
+// older opsets and in a second input for ReduceSum-13 / ReduceMean-18. Returns false if
+// they cannot be determined statically.
+bool GetReduceAxes(const Graph& graph, const Node& reduce_node, InlinedVector<int64_t>& axes) {
+  axes.clear();
+  const auto* axes_attr = graph_utils::GetNodeAttribute(reduce_node, "axes");
+  if (axes_attr != nullptr) {
+    axes.assign(axes_attr->ints().begin(), axes_attr->ints().end());
+    return !axes.empty();
+  }
+  if (reduce_node.InputDefs().size() < 2) {
+    return false;
+  }
+  return optimizer_utils::AppendTensorFromInitializer(graph, *reduce_node.InputDefs()[1], axes, true) &&
+         !axes.empty();
+}
+
+}  // namespace
+
+Status EmbeddingBagFusion::ApplyImpl(Graph& graph, bool& modified, int graph_level,
+                                     const logging::Logger& logger) const {
+  GraphViewer graph_viewer(graph);
+  const auto& order = graph_viewer.GetNodesInTopologicalOrder();
+
+  for (auto index : order) {
+    auto* node_ptr = graph.GetNode(index);
+    if (!node_ptr)
+      continue;  // node was removed as part of an earlier fusion
+
+    auto& gather = *node_ptr;
+    ORT_RETURN_IF_ERROR(Recurse(gather, modified, graph_level, logger));
+
+    if (!graph_utils::IsSupportedOptypeVersionAndDomain(gather, "Gather", {1, 11, 13}) ||
+        !graph_utils::IsSupportedProvider(gather, GetCompatibleExecutionProviders())) {
+      continue;
+    }
+
+    // The table must be gathered along axis 0.
+    const auto* axis_attr = graph_utils::GetNodeAttribute(gather, "axis");
+    if (axis_attr != nullptr && axis_attr->i() != 0) {
+      continue;
+    }
+
+    // EmbeddingBag is only registered for a 2-D float table; the indices need a known
+    // rank so the reduced axis can be checked against the bag dimension.
+    const TensorShapeProto* weight_shape = nullptr;
+    if (!GetTypedShape(*gather.InputDefs()[0], TensorProto_DataType_FLOAT, weight_shape) ||
+        weight_shape->dim_size() != 2) {
+      continue;
+    }
+    const auto* indices_type = gather.InputDefs()[1]->TypeAsProto();
+    if (indices_type == nullptr ||
+        (indices_type->tensor_type().elem_type() != TensorProto_DataType_INT32 &&
+         indices_type->tensor_type().elem_type() != TensorProto_DataType_INT64)) {
+      continue;
+    }
+    const TensorShapeProto* indices_shape = gather.InputDefs()[1]->Shape();
+    if (indices_shape == nullptr || indices_shape->dim_size() < 1) {
+      continue;
+    }
+    const int64_t indices_rank = indices_shape->dim_size();
+    // An empty bag would change ReduceMean semantics (0/0); require a static non-empty
+    // bag dimension.
+    const auto& bag_dim = indices_shape->dim(static_cast<int>(indices_rank - 1));
+    if (!bag_dim.has_dim_value() || bag_dim.dim_value() < 1) {
+      continue;
+    }
+
+    if (gather.GetOutputEdgesCount() != 1 || graph.NodeProducesGraphOutput(gather)) {
+      continue;
+    }
+
+    Node& reduce = *graph.GetNode(gather.OutputNodesBegin()->Index());
+    const bool is_sum = graph_utils::IsSupportedOptypeVersionAndDomain(reduce, "ReduceSum", {1, 11, 13});
+    const bool is_mean = graph_utils::IsSupportedOptypeVersionAndDomain(reduce, "ReduceMean", {1, 11, 13, 18});
+    if ((!is_sum && !is_mean) ||
+        reduce.GetExecutionProviderType() != gather.GetExecutionProviderType() ||
+        reduce.InputDefs()[0] != gather.OutputDefs()[0]) {
+      continue;
+    }
+
+    // The reduction must drop exactly the bag dimension.
+    const auto* keepdims_attr = graph_utils::GetNodeAttribute(reduce, "keepdims");
+    if (keepdims_attr == nullptr || keepdims_attr->i() != 0) {
+      continue;
+    }
+    const auto* noop_attr = graph_utils::GetNodeAttribute(reduce, "noop_with_empty_axes");
+    if (noop_attr != nullptr && noop_attr->i() != 0) {
+      continue;
+    }
+    InlinedVector<int64_t> axes;
+    if (!GetReduceAxes(graph, reduce, axes) || axes.size() != 1) {
+      continue;
+    }
+    // The gathered tensor has rank indices_rank + 1; the bag dimension is the last
+    // index dimension.
+    const int64_t gathered_rank = indices_rank + 1;
+    int64_t reduced_axis = axes[0] < 0 ? axes[0] + gathered_rank : axes[0];
+    if (reduced_axis != indices_rank - 1) {
+      continue;
+    }
+
+    Node& fused_node = graph.AddNode(graph.GenerateNodeName("EmbeddingBag"),
+                                     "EmbeddingBag",
+                                     "embedding bag fused from " + gather.Name() + " and " + reduce.Name(),
+                                     {gather.MutableInputDefs()[0], gather.MutableInputDefs()[1]},
+                                     {}, nullptr, kMSDomain);
+    fused_node.AddAttribute("mode", is_mean ? std::string("mean") : std::string("sum"));
+    fused_node.SetExecutionProviderType(gather.GetExecutionProviderType());
+
+    // move the output definitions and edges from the reduce node to the fused node and
+    // remove the original pair
+    InlinedVector<std::reference_wrapper<Node>> nodes{gather, reduce};
+    graph_utils::FinalizeNodeFusion(graph, nodes, fused_node);
+
+    modified = true;
+  }
+
+  return Status::OK();
+}
+
+}  // namespace onnxruntime
@@ -0,0 +1,30 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/optimizer/graph_transformer.h"
+
+namespace onnxruntime {
+
+/**
+@Class EmbeddingBagFusion
+
+Transformer that fuses an embedding-bag lookup - Gather(axis=0) over a 2-D float table
+followed by ReduceSum or ReduceMean over the last index dimension with keepdims=0 - into
+a single com.microsoft.EmbeddingBag node. The fused kernel accumulates the pooled rows
+directly into the output, so the gathered intermediate matrix is never materialized.
+
+The Gather output must have a single consumer and must not be a graph output, and the
+reduction axes must name exactly the last index dimension (for opset 13+ ReduceSum and
+opset 18+ ReduceMean the axes input must be a constant initializer).
+*/
+class EmbeddingBagFusion : public GraphTransformer {
+ public:
+  EmbeddingBagFusion(const InlinedHashSet<std::string_view>& compatible_execution_providers = {}) noexcept
+      : GraphTransformer("EmbeddingBagFusion", compatible_execution_providers) {}
+
+  Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+};
+
+}  // namespace onnxruntime
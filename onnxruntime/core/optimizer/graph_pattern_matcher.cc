@@ -0,0 +1,132 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#if !defined(ORT_MINIMAL_BUILD)
+
+#include "core/optimizer/graph_pattern_matcher.h"
+
+#include "core/graph/graph_utils.h"
+
+namespace onnxruntime {
+
+int PatternGraph::AddNode(const std::string& op_type,
+                          std::initializer_list<ONNX_NAMESPACE::OperatorSetVersion> versions,
+                          const std::string& domain,
+                          NodeConstraint constraint) {
+  ORT_ENFORCE(!nodes_.empty() || !op_type.empty(), "The root pattern node must specify an op type.");
+  nodes_.push_back(NodeSpec{op_type,
+                            InlinedVector<ONNX_NAMESPACE::OperatorSetVersion>(versions),
+                            domain,
+                            std::move(constraint)});
+  return static_cast<int>(nodes_.size()) - 1;
+}
+
+void PatternGraph::AddUpstreamEdge(int consumer, int consumer_input_index, int producer, bool single_consumer) {
+  const int num_nodes = static_cast<int>(nodes_.size());
+  ORT_ENFORCE(consumer >= 0 && consumer < num_nodes && producer >= 0 && producer < num_nodes &&
+                  consumer != producer,
+              "Invalid pattern node index.");
+  ORT_ENFORCE(consumer_input_index >= 0, "Invalid consumer input index.");
+  edges_.push_back(UpstreamEdge{consumer, consumer_input_index, producer, single_consumer});
+}
+
+bool PatternGraph::MatchesSpec(const Graph& graph, const Node& node, const NodeSpec& spec) const {
+  if (!spec.op_type.empty() &&
+      !graph_utils::IsSupportedOptypeVersionAndDomain(node, spec.op_type, spec.versions, spec.domain)) {
+    return false;
+  }
+
+  return spec.constraint == nullptr || spec.constraint(graph, node);
+}
+
+std::optional<InlinedVector<Node*>> PatternGraph::Match(Graph& graph, Node& root) const {
+  if (!MatchesSpec(graph, root, nodes_[kRootNodeIndex])) {
+    return std::nullopt;
+  }
+
+  InlinedVector<Node*> bound(nodes_.size(), nullptr);
+  bound[kRootNodeIndex] = &root;
+
+  for (const auto& edge : edges_) {
+    const Node* consumer = bound[edge.consumer];
+    ORT_ENFORCE(consumer != nullptr, "Pattern edges must be added consumer-first.");
+
+    const Node* producer = graph_utils::GetInputNode(*consumer, edge.consumer_input_index);
+    if (producer == nullptr) {
+      return std::nullopt;
+    }
+
+    // a pattern node reached through two paths (a diamond) must resolve to the same graph node
+    if (bound[edge.producer] != nullptr) {
+      if (bound[edge.producer]->Index() != producer->Index()) {
+        return std::nullopt;
+      }
+      continue;
+    }
+
+    if (!MatchesSpec(graph, *producer, nodes_[edge.producer]) ||
+        // fused groups must not span execution providers
+        producer->GetExecutionProviderType() != root.GetExecutionProviderType()) {
+      return std::nullopt;
+    }
+
+    if (edge.single_consumer &&
+        (producer->GetOutputEdgesCount() != 1 || graph.NodeProducesGraphOutput(*producer))) {
+      return std::nullopt;
+    }
+
+    bound[edge.producer] = graph.GetNode(producer->Index());
+  }
+
+  return bound;
+}
+
+void PatternGraphTransformer::RegisterPattern(PatternGraph pattern, RewriteFunc rewrite) {
+  const std::string& root_op_type = pattern.RootOpType();
+  entries_.push_back(Entry{std::move(pattern), std::move(rewrite)});
+  root_op_to_entry_.emplace(root_op_type, entries_.size() - 1);
+}
+
+Status PatternGraphTransformer::ApplyImpl(Graph& graph, bool& modified, int graph_level,
+                                          const logging::Logger& logger) const {
+  GraphViewer graph_viewer(graph);
+  const auto& node_topology_list = graph_viewer.GetNodesInTopologicalOrder();
+
+  for (auto node_index : node_topology_list) {
+    auto* node_ptr = graph.GetNode(node_index);
+    if (node_ptr == nullptr) {
+      continue;  // node was removed by an earlier rewrite
+    }
+
+    auto& node = *node_ptr;
+    ORT_RETURN_IF_ERROR(Recurse(node, modified, graph_level, logger));
+
+    if (!graph_utils::IsSupportedProvider(node, GetCompatibleExecutionProviders())) {
+      continue;
+    }
+
+    const auto range = root_op_to_entry_.equal_range(node.OpType());
+    for (auto it = range.first; it != range.second; ++it) {
+      const auto& entry = entries_[it->second];
+
+      auto matched_nodes = entry.pattern.Match(graph, node);
+      if (!matched_nodes.has_value()) {
+        continue;
+      }
+
+      bool rewritten = false;
+      ORT_RETURN_IF_ERROR(entry.rewrite(graph, *matched_nodes, rewritten));
+
+      if (rewritten) {
+        modified = true;
+        break;  // the root node was consumed by the rewrite
+      }
+    }
+  }
+
+  return Status::OK();
+}
+
+}  // namespace onnxruntime
+
+#endif  // !defined(ORT_MINIMAL_BUILD)
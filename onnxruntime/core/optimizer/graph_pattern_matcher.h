@@ -0,0 +1,130 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#if !defined(ORT_MINIMAL_BUILD)
+
+#include <functional>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "core/common/inlined_containers.h"
+#include "core/graph/graph.h"
+#include "core/optimizer/graph_transformer.h"
+
+namespace onnxruntime {
+
+/**
+A declarative description of a sub-graph rooted at a single node.
+
+A pattern is built once (typically in a transformer's constructor), compiled implicitly into
+its edge list, and matched against many candidate root nodes. Matching proceeds upstream from
+the root along input edges, which is the direction the hand-written fusion passes walk: the
+root is the last node of the fused group (e.g. the LayerNormalization of a SkipLayerNorm
+pattern) and each edge binds the producer of one of its inputs.
+
+Pattern nodes may be bound by more than one edge, so diamonds (a producer consumed through two
+paths) are expressed by adding two edges that name the same producer index; the match requires
+both paths to reach the same graph node.
+*/
+class PatternGraph {
+ public:
+  // Additional per-node predicate evaluated after the op type/version/domain checks pass,
+  // e.g. to require a constant initializer input or a specific attribute value.
+  using NodeConstraint = std::function<bool(const Graph& graph, const Node& node)>;
+
+  // The pattern node the candidate graph node is bound to. Must be added first.
+  static constexpr int kRootNodeIndex = 0;
+
+  /** Adds a pattern node and returns its index.
+  @param op_type operator type to match; empty matches any operator (not allowed for the root).
+  @param versions supported since-versions, as for graph_utils::IsSupportedOptypeVersionAndDomain.
+  @param domain operator domain; defaults to kOnnxDomain.
+  @param constraint optional extra predicate on the matched node.
+  */
+  int AddNode(const std::string& op_type,
+              std::initializer_list<ONNX_NAMESPACE::OperatorSetVersion> versions,
+              const std::string& domain = kOnnxDomain,
+              NodeConstraint constraint = nullptr);
+
+  /** Requires the node producing input `consumer_input_index` of pattern node `consumer` to match
+  pattern node `producer`.
+
+  Edges are evaluated in the order they are added and the consumer of each edge must already be
+  bound when it is evaluated (the root is bound first), so add edges consumer-first.
+
+  @param single_consumer when true, the producer's output must feed only the consumer and must not
+         be a graph output. This is the usual precondition for subsuming the producer into a fused
+         node; set it to false for pattern nodes that are kept alive by the rewrite.
+  */
+  void AddUpstreamEdge(int consumer, int consumer_input_index, int producer, bool single_consumer = true);
+
+  /** Attempts to match the pattern with `root` bound to pattern node kRootNodeIndex.
+  @returns the graph nodes bound to each pattern node, in pattern-node index order,
+           or std::nullopt if the pattern does not match.
+  */
+  std::optional<InlinedVector<Node*>> Match(Graph& graph, Node& root) const;
+
+  const std::string& RootOpType() const { return nodes_[kRootNodeIndex].op_type; }
+
+ private:
+  struct NodeSpec {
+    std::string op_type;
+    InlinedVector<ONNX_NAMESPACE::OperatorSetVersion> versions;
+    std::string domain;
+    NodeConstraint constraint;
+  };
+
+  struct UpstreamEdge {
+    int consumer;
+    int consumer_input_index;
+    int producer;
+    bool single_consumer;
+  };
+
+  bool MatchesSpec(const Graph& graph, const Node& node, const NodeSpec& spec) const;
+
+  std::vector<NodeSpec> nodes_;
+  std::vector<UpstreamEdge> edges_;
+};
+
+/**
+Graph transformer that evaluates a set of compiled patterns in a single walk over the graph.
+
+Patterns are dispatched by root op type, so each node is only tested against the patterns that
+can possibly match it; registering many patterns adds lookup cost, not traversal cost. This is
+the same single-walk structure SelectorActionTransformer uses for its selector registry, with
+the selector replaced by a declarative pattern.
+*/
+class PatternGraphTransformer : public GraphTransformer {
+ public:
+  // Rewrites the graph for one match. `matched_nodes` holds the nodes bound to each pattern node,
+  // in pattern-node index order. Set `rewritten` when the graph was changed; the root node is
+  // assumed consumed by the rewrite and no further patterns are tried against it.
+  using RewriteFunc = std::function<Status(Graph& graph, InlinedVector<Node*>& matched_nodes, bool& rewritten)>;
+
+  PatternGraphTransformer(const std::string& name,
+                          const InlinedHashSet<std::string_view>& compatible_execution_providers = {}) noexcept
+      : GraphTransformer(name, compatible_execution_providers) {}
+
+  void RegisterPattern(PatternGraph pattern, RewriteFunc rewrite);
+
+ private:
+  Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+
+  struct Entry {
+    PatternGraph pattern;
+    RewriteFunc rewrite;
+  };
+
+  std::vector<Entry> entries_;
+  // root op type -> index into entries_
+  std::unordered_multimap<std::string, size_t> root_op_to_entry_;
+};
+
+}  // namespace onnxruntime
+
+#endif  // !defined(ORT_MINIMAL_BUILD)
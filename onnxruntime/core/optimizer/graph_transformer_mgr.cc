@@ -26,14 +26,36 @@ common::Status GraphTransformerManager::ApplyTransformers(Graph& graph, Transfor
     return Status::OK();
   }
 
+  // Incremental fixpoint iteration: rather than re-running every transformer over the whole
+  // graph each step, track a graph version that advances whenever a transformer reports a
+  // modification, and skip a transformer while the version still matches what it last saw -
+  // the transformers are deterministic functions of the graph, so re-applying one to an
+  // unchanged graph cannot find anything new. A transformer whose own change advanced the
+  // version is re-applied, as its rewrite may enable further matches of its own patterns.
+  uint64_t graph_version = 0;
+  InlinedHashMap<const GraphTransformer*, uint64_t> version_last_seen;
+  version_last_seen.reserve(transformers->second.size());
+
   for (unsigned step = 0; step < steps_; ++step) {
     bool graph_changed = false;
     for (const auto& transformer : transformers->second) {
       if (step > 0 && transformer->ShouldOnlyApplyOnce())
         continue;
 
+      auto version_iter = version_last_seen.find(transformer.get());
+      if (version_iter != version_last_seen.end() && version_iter->second == graph_version) {
+        continue;  // graph unchanged since this transformer last ran
+      }
+
+      // record the version the transformer runs against; if it modifies the graph the version
+      // advances past this and the transformer remains eligible for the next step
+      version_last_seen[transformer.get()] = graph_version;
+
       bool modified = false;
       ORT_RETURN_IF_ERROR(transformer->Apply(graph, modified, logger));
+      if (modified) {
+        ++graph_version;
+      }
       graph_changed = graph_changed || modified;
     }
     if (!graph_changed) {
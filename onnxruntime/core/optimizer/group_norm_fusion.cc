@@ -0,0 +1,232 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/optimizer/group_norm_fusion.h"
+
+#include "core/graph/graph_utils.h"
+#include "core/optimizer/initializer.h"
+#include "core/optimizer/utils.h"
+
+using namespace ONNX_NAMESPACE;
+using namespace onnxruntime::common;
+namespace onnxruntime {
+
+namespace {
+
+// Checks that `node_arg` is a constant float initializer whose values are all `expected_value`.
+bool IsConstantFloatFilledWith(const Graph& graph, const NodeArg& node_arg, float expected_value) {
+  const auto* tensor_proto = graph_utils::GetConstantInitializer(graph, node_arg.Name());
+  if (tensor_proto == nullptr || tensor_proto->data_type() != TensorProto_DataType_FLOAT) {
+    return false;
+  }
+
+  Initializer initializer(*tensor_proto, graph.ModelPath());
+  const float* data = initializer.data<float>();
+  for (int64_t i = 0; i < initializer.size(); ++i) {
+    if (data[i] != expected_value) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// Checks that `node_arg` is a constant float initializer broadcastable as per-channel scale/bias
+// against NCHW data, i.e. with shape (C, 1, 1) or (1, C, 1, 1). Returns the TensorProto and C.
+const TensorProto* GetPerChannelInitializer(const Graph& graph, const NodeArg& node_arg,
+                                            int64_t& num_channels) {
+  const auto* tensor_proto = graph_utils::GetConstantInitializer(graph, node_arg.Name());
+  if (tensor_proto == nullptr || tensor_proto->data_type() != TensorProto_DataType_FLOAT) {
+    return nullptr;
+  }
+
+  const int dims = tensor_proto->dims_size();
+  const int channel_dim = dims - 3;
+  if ((dims != 3 && dims != 4) || (dims == 4 && tensor_proto->dims(0) != 1) ||
+      tensor_proto->dims(channel_dim + 1) != 1 || tensor_proto->dims(channel_dim + 2) != 1) {
+    return nullptr;
+  }
+
+  num_channels = tensor_proto->dims(channel_dim);
+  return tensor_proto;
+}
+
+// Copies a per-channel (C, 1, 1)-shaped initializer into a new 1D initializer of shape (C),
+// which is the layout the GroupNorm contrib op expects for gamma and beta.
+NodeArg& AddFlattenedInitializer(Graph& graph, const TensorProto& tensor_proto, int64_t num_channels,
+                                 const std::string& base_name) {
+  TensorProto flattened(tensor_proto);
+  flattened.set_name(graph.GenerateNodeArgName(base_name));
+  flattened.clear_dims();
+  flattened.add_dims(num_channels);
+  return graph_utils::AddInitializer(graph, flattened);
+}
+
+}  // namespace
+
+Status GroupNormFusion::ApplyImpl(Graph& graph, bool& modified, int graph_level,
+                                  const logging::Logger& logger) const {
+  GraphViewer graph_viewer(graph);
+  const auto& node_topology_list = graph_viewer.GetNodesInTopologicalOrder();
+
+  for (auto node_index : node_topology_list) {
+    auto* p_reshape1 = graph.GetNode(node_index);
+    if (p_reshape1 == nullptr) {
+      continue;  // node was removed as part of an earlier fusion
+    }
+
+    Node& reshape1 = *p_reshape1;
+    ORT_RETURN_IF_ERROR(Recurse(reshape1, modified, graph_level, logger));
+
+    if (!graph_utils::IsSupportedOptypeVersionAndDomain(reshape1, "Reshape", {5, 13, 14, 19, 21}) ||
+        !graph_utils::IsSupportedProvider(reshape1, GetCompatibleExecutionProviders()) ||
+        !optimizer_utils::CheckOutputEdges(graph, reshape1, 1)) {
+      continue;
+    }
+
+    // the CPU GroupNorm kernel only supports float
+    const NodeArg* x_def = reshape1.InputDefs()[0];
+    if (x_def->Type() == nullptr || *x_def->Type() != "tensor(float)") {
+      continue;
+    }
+
+    // GroupNorm operates on 4D activations
+    const auto* x_shape = x_def->Shape();
+    if (x_shape == nullptr || x_shape->dim_size() != 4) {
+      continue;
+    }
+
+    Node& instance_norm = *graph.GetNode(reshape1.OutputNodesBegin()->Index());
+    if (!graph_utils::IsSupportedOptypeVersionAndDomain(instance_norm, "InstanceNormalization", {1, 6}) ||
+        instance_norm.GetExecutionProviderType() != reshape1.GetExecutionProviderType() ||
+        !optimizer_utils::CheckOutputEdges(graph, instance_norm, 1)) {
+      continue;
+    }
+
+    // the InstanceNormalization must be a pure normalization: scale all ones, bias all zeros.
+    // its channel count is the number of groups.
+    const auto* scale_proto = graph_utils::GetConstantInitializer(graph, instance_norm.InputDefs()[1]->Name());
+    if (scale_proto == nullptr || scale_proto->dims_size() != 1) {
+      continue;
+    }
+    const int64_t num_groups = scale_proto->dims(0);
+    if (num_groups <= 0 ||
+        !IsConstantFloatFilledWith(graph, *instance_norm.InputDefs()[1], 1.0f) ||
+        !IsConstantFloatFilledWith(graph, *instance_norm.InputDefs()[2], 0.0f)) {
+      continue;
+    }
+
+    // the first Reshape must regroup channels as (N, num_groups, -1)
+    InlinedVector<int64_t> reshape1_dims;
+    if (!optimizer_utils::AppendTensorFromInitializer(graph, *reshape1.InputDefs()[1], reshape1_dims, true) ||
+        reshape1_dims.size() < 2 || reshape1_dims[1] != num_groups) {
+      continue;
+    }
+
+    Node& reshape2 = *graph.GetNode(instance_norm.OutputNodesBegin()->Index());
+    if (!graph_utils::IsSupportedOptypeVersionAndDomain(reshape2, "Reshape", {5, 13, 14, 19, 21}) ||
+        reshape2.GetExecutionProviderType() != reshape1.GetExecutionProviderType() ||
+        !optimizer_utils::CheckOutputEdges(graph, reshape2, 1)) {
+      continue;
+    }
+
+    Node& mul = *graph.GetNode(reshape2.OutputNodesBegin()->Index());
+    if (!graph_utils::IsSupportedOptypeVersionAndDomain(mul, "Mul", {7, 13, 14}) ||
+        mul.GetExecutionProviderType() != reshape1.GetExecutionProviderType() ||
+        !optimizer_utils::CheckOutputEdges(graph, mul, 1)) {
+      continue;
+    }
+
+    const int mul_const_input_index =
+        mul.InputDefs()[0]->Name() == reshape2.MutableOutputDefs()[0]->Name() ? 1 : 0;
+    int64_t num_channels = 0;
+    const auto* gamma_proto = GetPerChannelInitializer(graph, *mul.InputDefs()[mul_const_input_index],
+                                                       num_channels);
+    if (gamma_proto == nullptr || num_channels % num_groups != 0) {
+      continue;
+    }
+
+    // when the channel dim of the input is known it must match gamma
+    const auto& channel_dim = x_shape->dim(1);
+    if (channel_dim.has_dim_value() && channel_dim.dim_value() != num_channels) {
+      continue;
+    }
+
+    Node& add = *graph.GetNode(mul.OutputNodesBegin()->Index());
+    if (!graph_utils::IsSupportedOptypeVersionAndDomain(add, "Add", {7, 13, 14}) ||
+        add.GetExecutionProviderType() != reshape1.GetExecutionProviderType()) {
+      continue;
+    }
+
+    const int add_const_input_index =
+        add.InputDefs()[0]->Name() == mul.MutableOutputDefs()[0]->Name() ? 1 : 0;
+    int64_t beta_channels = 0;
+    const auto* beta_proto = GetPerChannelInitializer(graph, *add.InputDefs()[add_const_input_index],
+                                                      beta_channels);
+    if (beta_proto == nullptr || beta_channels != num_channels) {
+      continue;
+    }
+
+    // optional SiLU epilogue: the Add output consumed only by x * Sigmoid(x)
+    Node* p_sigmoid = nullptr;
+    Node* p_mul2 = nullptr;
+    if (add.GetOutputEdgesCount() == 2 && !graph.NodeProducesGraphOutput(add)) {
+      for (auto it = add.OutputNodesBegin(); it != add.OutputNodesEnd(); ++it) {
+        Node& consumer = *graph.GetNode(it->Index());
+        if (graph_utils::IsSupportedOptypeVersionAndDomain(consumer, "Sigmoid", {6, 13})) {
+          p_sigmoid = &consumer;
+        } else if (graph_utils::IsSupportedOptypeVersionAndDomain(consumer, "Mul", {7, 13, 14})) {
+          p_mul2 = &consumer;
+        }
+      }
+
+      if (p_sigmoid == nullptr || p_mul2 == nullptr ||
+          p_sigmoid->GetExecutionProviderType() != reshape1.GetExecutionProviderType() ||
+          p_mul2->GetExecutionProviderType() != reshape1.GetExecutionProviderType() ||
+          !optimizer_utils::CheckOutputEdges(graph, *p_sigmoid, 1) ||
+          p_sigmoid->OutputNodesBegin()->Index() != p_mul2->Index()) {
+        // not the SiLU shape; leave the Add as the last fused node only if it has a single use
+        p_sigmoid = nullptr;
+        p_mul2 = nullptr;
+      }
+    }
+
+    const bool has_silu = p_mul2 != nullptr;
+    Node& last_node = has_silu ? *p_mul2 : add;
+
+    NodeArg& gamma_arg = AddFlattenedInitializer(graph, *gamma_proto, num_channels, "group_norm_gamma");
+    NodeArg& beta_arg = AddFlattenedInitializer(graph, *beta_proto, num_channels, "group_norm_beta");
+
+    const std::array group_norm_input_defs{reshape1.MutableInputDefs()[0], &gamma_arg, &beta_arg};
+    const std::array group_norm_output_defs{last_node.MutableOutputDefs()[0]};
+    Node& group_norm_node = graph.AddNode(graph.GenerateNodeName("GroupNorm"),
+                                          "GroupNorm",
+                                          "fused GroupNorm subgraph",
+                                          group_norm_input_defs,
+                                          group_norm_output_defs,
+                                          nullptr,
+                                          kMSDomain);
+
+    const auto* epsilon_attr = graph_utils::GetNodeAttribute(instance_norm, "epsilon");
+    group_norm_node.AddAttribute("epsilon", epsilon_attr != nullptr ? epsilon_attr->f() : 1e-5f);
+    group_norm_node.AddAttribute("groups", num_groups);
+    group_norm_node.AddAttribute("activation", static_cast<int64_t>(has_silu ? 1 : 0));
+    group_norm_node.AddAttribute("channels_last", static_cast<int64_t>(0));
+
+    // Assign provider to this new node. Provider should be same as the provider for old node.
+    group_norm_node.SetExecutionProviderType(reshape1.GetExecutionProviderType());
+
+    if (has_silu) {
+      graph_utils::FinalizeNodeFusion(graph, {reshape1, instance_norm, reshape2, mul, add, *p_sigmoid, *p_mul2},
+                                      group_norm_node);
+    } else {
+      graph_utils::FinalizeNodeFusion(graph, {reshape1, instance_norm, reshape2, mul, add}, group_norm_node);
+    }
+
+    modified = true;
+  }
+
+  return Status::OK();
+}
+
+}  // namespace onnxruntime
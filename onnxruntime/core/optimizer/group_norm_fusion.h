@@ -0,0 +1,29 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/optimizer/graph_transformer.h"
+
+namespace onnxruntime {
+
+/**
+@Class GroupNormFusion
+
+Rewrite graph fusing the decomposed GroupNorm subgraph into a single GroupNorm node.
+
+Exporters emit GroupNorm as
+  Reshape(x, [N, groups, -1]) -> InstanceNormalization -> Reshape(back to x shape)
+    -> Mul(per-channel gamma) -> Add(per-channel beta)
+optionally followed by a SiLU activation (Sigmoid and Mul of the Add output), which the
+GroupNorm contrib op absorbs through its activation attribute.
+*/
+class GroupNormFusion : public GraphTransformer {
+ public:
+  GroupNormFusion(const InlinedHashSet<std::string_view>& compatible_execution_providers = {}) noexcept
+      : GraphTransformer("GroupNormFusion", compatible_execution_providers) {}
+
+  Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+};
+
+}  // namespace onnxruntime
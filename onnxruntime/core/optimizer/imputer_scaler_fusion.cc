@@ -0,0 +1,70 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/optimizer/imputer_scaler_fusion.h"
+#include "core/graph/graph_utils.h"
+
+using namespace ONNX_NAMESPACE;
+using namespace ::onnxruntime::common;
+namespace onnxruntime {
+
+Status ImputerScalerFusion::ApplyImpl(Graph& graph, bool& modified, int graph_level,
+                                      const logging::Logger& logger) const {
+  GraphViewer graph_viewer(graph);
+  const auto& order = graph_viewer.GetNodesInTopologicalOrder();
+
+  for (auto index : order) {
+    auto* node_ptr = graph.GetNode(index);
+    if (!node_ptr)
+      continue;  // node was removed
+
+    auto& node = *node_ptr;
+    ORT_RETURN_IF_ERROR(Recurse(node, modified, graph_level, logger));
+
+    if (!graph_utils::IsSupportedOptypeVersionAndDomain(node, "Imputer", {1}, kMLDomain) ||
+        !graph_utils::IsSupportedProvider(node, GetCompatibleExecutionProviders()) ||
+        node.GetOutputEdgesCount() != 1) {
+      continue;
+    }
+
+    // The fused kernel only handles the float variant of the Imputer.
+    const NodeAttributes& imputer_attrs = node.GetAttributes();
+    if (imputer_attrs.find("imputed_value_floats") == imputer_attrs.end()) {
+      continue;
+    }
+
+    const Node& next_node = *(node.OutputNodesBegin());
+    if (!graph_utils::IsSupportedOptypeVersionAndDomain(next_node, "Scaler", {1}, kMLDomain) ||
+        next_node.GetExecutionProviderType() != node.GetExecutionProviderType()) {
+      continue;
+    }
+
+    if (graph.NodeProducesGraphOutput(node)) {
+      continue;
+    }
+
+    Node& imputer_node = node;
+    Node& scaler_node = *graph.GetNode(next_node.Index());  // get mutable reference
+
+    Node& fused_node = graph.AddNode(graph.GenerateNodeName("fused " + imputer_node.Name()), "FusedImputerScaler",
+                                     "fused Imputer " + imputer_node.Name() + " with Scaler " + scaler_node.Name(),
+                                     imputer_node.MutableInputDefs(), {}, &imputer_node.GetAttributes(), kMSDomain);
+
+    // Carry over the scaler parameters; their attribute names do not collide with the imputer's.
+    const NodeAttributes& scaler_attrs = scaler_node.GetAttributes();
+    for (const auto& attr : scaler_attrs) {
+      fused_node.AddAttributeProto(AttributeProto(attr.second));
+    }
+
+    // Assign provider to this new node. Provider should be same as the provider for old node.
+    fused_node.SetExecutionProviderType(imputer_node.GetExecutionProviderType());
+
+    // move output definitions and edges from scaler_node to fused_node. delete imputer_node and scaler_node.
+    graph_utils::FinalizeNodeFusion(graph, {imputer_node, scaler_node}, fused_node);
+
+    modified = true;
+  }
+
+  return Status::OK();
+}
+}  // namespace onnxruntime
@@ -0,0 +1,25 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/optimizer/graph_transformer.h"
+
+namespace onnxruntime {
+
+/**
+@Class ImputerScalerFusion
+
+Transformer that fuses an ai.onnx.ml Imputer node followed by a Scaler node into a single
+com.microsoft FusedImputerScaler node, so tabular preprocessing pipelines traverse the
+batch once instead of once per op.
+*/
+class ImputerScalerFusion : public GraphTransformer {
+ public:
+  ImputerScalerFusion(const InlinedHashSet<std::string_view>& compatible_execution_providers = {}) noexcept
+      : GraphTransformer("ImputerScalerFusion", compatible_execution_providers) {}
+
+  Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+};
+
+}  // namespace onnxruntime
@@ -4,6 +4,7 @@
 #include "core/optimizer/matmul_nbits_fusion.h"
 
 #include "core/common/common.h"
+#include "core/graph/node_attr_utils.h"
 #include "core/optimizer/selectors_actions/actions.h"
 
 #if !defined(ORT_MINIMAL_BUILD)
@@ -71,6 +72,79 @@ class BiasFusion : public NodeSelector {
   }
 };
 
+class ActivationFusion : public NodeSelector {
+ public:
+  std::optional<NodesToOptimizeIndices> Select(const GraphViewer& graph_viewer,
+                                               const Node& node) const override {
+    // check if MatMulNBits node already has a fused activation
+    if (graph_utils::GetNodeAttribute(node, "activation") != nullptr) {
+      return std::nullopt;
+    }
+
+    const Graph& graph = graph_viewer.GetGraph();
+
+    // Mul(x, Sigmoid(x)) following the MatMulNBits is fused as SiLU.
+    if (node.GetOutputEdgesCount() == 2 && !graph.NodeProducesGraphOutput(node)) {
+      const Node* sigmoid = nullptr;
+      const Node* mul = nullptr;
+      for (auto edge = node.OutputEdgesBegin(); edge != node.OutputEdgesEnd(); ++edge) {
+        const Node& consumer = edge->GetNode();
+        if (graph_utils::IsSupportedOptypeVersionAndDomain(consumer, "Sigmoid", {6, 13})) {
+          sigmoid = &consumer;
+        } else if (graph_utils::IsSupportedOptypeVersionAndDomain(consumer, "Mul", {7, 13, 14})) {
+          mul = &consumer;
+        }
+      }
+
+      if (sigmoid == nullptr || mul == nullptr ||
+          sigmoid->GetExecutionProviderType() != node.GetExecutionProviderType() ||
+          mul->GetExecutionProviderType() != node.GetExecutionProviderType() ||
+          !optimizer_utils::CheckOutputEdges(graph, *sigmoid, 1)) {
+        return std::nullopt;
+      }
+
+      // the Mul inputs must be exactly the MatMulNBits output and the Sigmoid output
+      const NodeArg* x = node.OutputDefs()[0];
+      const NodeArg* sigmoid_x = sigmoid->OutputDefs()[0];
+      const auto& mul_inputs = mul->InputDefs();
+      if (!((mul_inputs[0] == x && mul_inputs[1] == sigmoid_x) ||
+            (mul_inputs[0] == sigmoid_x && mul_inputs[1] == x))) {
+        return std::nullopt;
+      }
+
+      NodesToOptimizeIndicesBuilder builder{};
+      builder.target_node = node.Index();
+      builder.output_nodes = {sigmoid->Index(), mul->Index()};
+      return builder.Build();
+    }
+
+    if (!optimizer_utils::CheckOutputEdges(graph, node, 1)) {
+      return std::nullopt;
+    }
+
+    const Node& next_node = *node.OutputNodesBegin();
+
+    const bool is_supported_activation =
+        graph_utils::IsSupportedOptypeVersionAndDomain(next_node, "Relu", {6, 13, 14}) ||
+        graph_utils::IsSupportedOptypeVersionAndDomain(next_node, "Sigmoid", {6, 13}) ||
+        graph_utils::IsSupportedOptypeVersionAndDomain(next_node, "Tanh", {6, 13}) ||
+        graph_utils::IsSupportedOptypeVersionAndDomain(next_node, "Gelu", {20}) ||
+        graph_utils::IsSupportedOptypeVersionAndDomain(next_node, "Gelu", {1}, kMSDomain) ||
+        (graph_utils::IsSupportedOptypeVersionAndDomain(next_node, "FastGelu", {1}, kMSDomain) &&
+         !(next_node.InputDefs().size() > 1 && next_node.InputDefs()[1]->Exists()));  // no FastGelu bias input
+
+    if (!is_supported_activation ||
+        node.GetExecutionProviderType() != next_node.GetExecutionProviderType()) {
+      return std::nullopt;
+    }
+
+    NodesToOptimizeIndicesBuilder builder{};
+    builder.target_node = node.Index();
+    builder.output_nodes = {next_node.Index()};
+    return builder.Build();
+  }
+};
+
 }  // namespace selectors
 
 #endif  // !defined(ORT_MINIMAL_BUILD)
@@ -98,6 +172,46 @@ struct BiasFusion : MergeIntoTarget {
   }
 };
 
+struct ActivationFusion : ReplaceWithNew {
+ private:
+  std::string OpType(const RuntimeState&) const override { return "MatMulNBits"; }
+
+  std::string Domain(const RuntimeState&) const override { return kMSDomain; }
+
+  NodeAttributes ExtraAttributes(const RuntimeState& state) const override {
+    NodeAttributes extra_attributes;
+
+    std::string activation;
+    if (state.selected_nodes.num_outputs == 2) {
+      // Sigmoid + Mul pair matched by the selector
+      activation = "Silu";
+    } else {
+      const Node& activation_node = *state.selected_nodes.Output(0);
+      activation = activation_node.OpType();
+      if (activation == "Gelu") {
+        // ONNX Gelu with approximate set to "tanh" computes what the FastGelu contrib op does
+        const auto* approximate = graph_utils::GetNodeAttribute(activation_node, "approximate");
+        if (approximate != nullptr && approximate->s() == "tanh") {
+          activation = "FastGelu";
+        }
+      }
+    }
+
+    utils::SetNodeAttribute(utils::MakeAttribute("activation", activation), extra_attributes);
+    return extra_attributes;
+  }
+
+  std::vector<NodeAndMoveInfo> ValueMoves(const RuntimeState& state) const override {
+    const NTO::NodeLocation matmul{NTO::NodeType::kTarget, 0};
+    const NTO::NodeLocation last_output{NTO::NodeType::kOutput, state.selected_nodes.num_outputs - 1};
+
+    return {
+        MoveAll(matmul, ArgType::kInput),        // move all inputs from MatMulNBits
+        MoveAll(last_output, ArgType::kOutput),  // move output from the (last) activation node
+    };
+  }
+};
+
 }  // namespace actions
 
 void BiasFusionRule(SelectorActionRegistry& registry) {
@@ -121,12 +235,34 @@ void BiasFusionRule(SelectorActionRegistry& registry) {
 #endif
 }
 
+void ActivationFusionRule(SelectorActionRegistry& registry) {
+  constexpr const char* name = "FuseActivation";
+
+  auto action = std::make_unique<actions::ActivationFusion>();
+
+#if !defined(ORT_MINIMAL_BUILD)
+
+  auto selector = std::make_unique<selectors::ActivationFusion>();
+
+  registry.RegisterSelectorAndAction(name,
+                                     {{SelectorActionRegistry::OpVersionsMapKey("MatMulNBits", kMSDomain), {}}},
+                                     std::move(selector),
+                                     std::move(action));
+
+#else
+
+  registry.RegisterAction(name, std::move(action));
+
+#endif
+}
+
 }  // namespace
 
 SelectorActionRegistry MatMulNBitsFusion::CreateSelectorActionRegistry() const {
   SelectorActionRegistry registry{};
 
   BiasFusionRule(registry);
+  ActivationFusionRule(registry);
 
   return registry;
 }
@@ -0,0 +1,107 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/optimizer/matmul_topk_fusion.h"
+
+#include "core/graph/graph_utils.h"
+#include "core/optimizer/utils.h"
+
+using namespace ONNX_NAMESPACE;
+using namespace ::onnxruntime::common;
+namespace onnxruntime {
+
+namespace {
+
+// Returns true if 'node_arg' is a float tensor with a static rank of 2.
+bool IsRank2Float(const NodeArg& node_arg) {
+  const auto* type_proto = node_arg.TypeAsProto();
+  if (type_proto == nullptr || type_proto->tensor_type().elem_type() != TensorProto_DataType_FLOAT) {
+    return false;
+  }
+  const auto* shape = node_arg.Shape();
+  return shape != nullptr && shape->dim_size() == 2;
+}
+
+}  // namespace
+
+Status MatMulTopKFusion::ApplyImpl(Graph& graph, bool& modified, int graph_level,
+                                   const logging::Logger& logger) const {
+  GraphViewer graph_viewer(graph);
+  const auto& order = graph_viewer.GetNodesInTopologicalOrder();
+
+  for (auto index : order) {
+    auto* node_ptr = graph.GetNode(index);
+    if (!node_ptr)
+      continue;  // node was removed as part of an earlier fusion
+
+    auto& matmul = *node_ptr;
+    ORT_RETURN_IF_ERROR(Recurse(matmul, modified, graph_level, logger));
+
+    if (!graph_utils::IsSupportedOptypeVersionAndDomain(matmul, "MatMul", {1, 9, 13}) ||
+        !graph_utils::IsSupportedProvider(matmul, GetCompatibleExecutionProviders())) {
+      continue;
+    }
+
+    // GemmTopK is only registered for a rank-2 float GEMM (a classification head); batched
+    // MatMuls are left alone.
+    if (!IsRank2Float(*matmul.InputDefs()[0]) || !IsRank2Float(*matmul.InputDefs()[1])) {
+      continue;
+    }
+
+    if (matmul.GetOutputEdgesCount() != 1 || graph.NodeProducesGraphOutput(matmul)) {
+      continue;
+    }
+
+    Node& topk = *graph.GetNode(matmul.OutputNodesBegin()->Index());
+    if (!graph_utils::IsSupportedOptypeVersionAndDomain(topk, "TopK", {10, 11}) ||
+        topk.GetExecutionProviderType() != matmul.GetExecutionProviderType() ||
+        topk.InputDefs()[0] != matmul.OutputDefs()[0]) {
+      continue;
+    }
+
+    // TopK must select along the last axis of the logits; the product is rank 2.
+    const auto* axis_attr = graph_utils::GetNodeAttribute(topk, "axis");
+    const int64_t axis = axis_attr == nullptr ? -1 : axis_attr->i();
+    if (axis != -1 && axis != 1) {
+      continue;
+    }
+
+    // k is baked into the fused node as an attribute, so it must be a constant scalar.
+    InlinedVector<int64_t> k_values;
+    if (!optimizer_utils::AppendTensorFromInitializer(graph, *topk.InputDefs()[1], k_values, true) ||
+        k_values.size() != 1 || k_values[0] < 1) {
+      continue;
+    }
+    const int64_t k = k_values[0];
+
+    // If the label dimension is known, a k that exceeds it must keep the TopK node so the
+    // original error surfaces at its usual place.
+    const auto& n_dim = matmul.InputDefs()[1]->Shape()->dim(1);
+    if (n_dim.has_dim_value() && k > n_dim.dim_value()) {
+      continue;
+    }
+
+    Node& fused_node = graph.AddNode(graph.GenerateNodeName("GemmTopK"),
+                                     "GemmTopK",
+                                     "gemm top-k fused from " + matmul.Name() + " and " + topk.Name(),
+                                     {matmul.MutableInputDefs()[0], matmul.MutableInputDefs()[1]},
+                                     {}, nullptr, kMSDomain);
+    fused_node.AddAttribute("k", k);
+    const auto* largest_attr = graph_utils::GetNodeAttribute(topk, "largest");
+    fused_node.AddAttribute("largest", largest_attr == nullptr ? int64_t{1} : largest_attr->i());
+    const auto* sorted_attr = graph_utils::GetNodeAttribute(topk, "sorted");
+    fused_node.AddAttribute("sorted", sorted_attr == nullptr ? int64_t{1} : sorted_attr->i());
+    fused_node.SetExecutionProviderType(matmul.GetExecutionProviderType());
+
+    // move the output definitions and edges from the TopK node to the fused node and
+    // remove the original pair
+    InlinedVector<std::reference_wrapper<Node>> nodes{matmul, topk};
+    graph_utils::FinalizeNodeFusion(graph, nodes, fused_node);
+
+    modified = true;
+  }
+
+  return Status::OK();
+}
+
+}  // namespace onnxruntime
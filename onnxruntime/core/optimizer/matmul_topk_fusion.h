@@ -0,0 +1,30 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/optimizer/graph_transformer.h"
+
+namespace onnxruntime {
+
+/**
+@Class MatMulTopKFusion
+
+Transformer that fuses a classification head - a 2-D float MatMul whose only consumer is
+TopK over the last axis with a constant k - into a single com.microsoft.GemmTopK node. The
+fused kernel tiles the GEMM along the label dimension and keeps per-row streaming top-k
+selections across tiles, so the full logit tensor is never materialized. The win grows with
+the ratio of the label dimension to k.
+
+The MatMul output must have a single consumer and must not be a graph output, and the TopK
+k input must be a constant initializer.
+*/
+class MatMulTopKFusion : public GraphTransformer {
+ public:
+  MatMulTopKFusion(const InlinedHashSet<std::string_view>& compatible_execution_providers = {}) noexcept
+      : GraphTransformer("MatMulTopKFusion", compatible_execution_providers) {}
+
+  Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+};
+
+}  // namespace onnxruntime
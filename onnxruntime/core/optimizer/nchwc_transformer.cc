@@ -321,6 +321,12 @@ void NchwcTransformerImpl::ConvPoolShapeInference(const Node& node,
 }
 
 void NchwcTransformerImpl::TransformConv(Node& node) {
+  // The NCHWc kernels only understand the single 'activation' attribute, so leave
+  // FusedConv nodes carrying a fused post operation chain in NCHW form.
+  if (graph_utils::GetNodeAttribute(node, "post_ops") != nullptr) {
+    return;
+  }
+
   auto& input_defs = node.MutableInputDefs();
   auto& output_defs = node.MutableOutputDefs();
 
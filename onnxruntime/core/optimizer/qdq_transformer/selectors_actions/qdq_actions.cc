@@ -78,6 +78,24 @@ std::vector<NodeAndMoveInfo> ConvMoves() {
 
   return moves;
 }
+// moves for replacing a LayerNormalization whose activation input has a DQ with the qlinear version.
+// Scale and B stay in float and come from the target node.
+std::vector<NodeAndMoveInfo> LayerNormMoves() {
+  NTO::NodeLocation dq{NTO::NodeType::kInput, 0};
+  NTO::NodeLocation target{NTO::NodeType::kTarget, 0};
+  NTO::NodeLocation q{NTO::NodeType::kOutput, 0};
+
+  std::vector<NodeAndMoveInfo> moves{
+      MoveAll(dq, ArgType::kInput),                                // append X, X_scale, X_zero_point from dq
+      MoveAndAppend(target, ArgType::kInput, 1, ArgType::kInput),  // append Scale from the target node
+      MoveAndAppend(target, ArgType::kInput, 2, ArgType::kInput),  // append B from the target node
+      MoveAndAppend(q, ArgType::kInput, 1, ArgType::kInput),       // append scale (input 1) from q
+      MoveAndAppend(q, ArgType::kInput, 2, ArgType::kInput),       // append zp (input 2) from q
+      MoveAll(q, ArgType::kOutput)};                               // and use the outputs from q
+
+  return moves;
+}
+
 std::vector<NodeAndMoveInfo> WhereMoves() {
   NTO::NodeLocation dq_x{NTO::NodeType::kInput, 0};
   NTO::NodeLocation dq_y{NTO::NodeType::kInput, 1};
@@ -253,6 +271,9 @@ ConvReplaceWithQLinear::ConvReplaceWithQLinear()
 WhereReplaceWithQLinear::WhereReplaceWithQLinear()
     : ReplaceWithQLinear(kMSDomain, WhereMoves()) {
 }
+LayerNormReplaceWithQLinear::LayerNormReplaceWithQLinear()
+    : ReplaceWithQLinear(kMSDomain, LayerNormMoves()) {
+}
 MatMulReplaceWithQLinear::MatMulReplaceWithQLinear()
     : matmul_int_to_float_replacer_{MatMulIntToFloatReplacer()},
       qlinear_matmul_replacer_{kOnnxDomain} {
@@ -345,6 +345,27 @@ void WhereQDQRules(SelectorActionRegistry& qdq_selector_action_registry) {
 #endif
 }
 
+void LayerNormalizationQDQRules(SelectorActionRegistry& qdq_selector_action_registry) {
+  // 3 nodes. DQ for the activation input, LayerNormalization, Q for the output.
+  // Scale and B stay in float, so the kernel computes the row statistics from the quantized
+  // activations and requantizes without a dequantized copy of the input.
+  // Replace with QLinearLayerNormalization. Delete all original nodes.
+  const std::string action_name{"LayerNorm"};
+  std::unique_ptr<Action> action = std::make_unique<QDQ::LayerNormReplaceWithQLinear>();
+
+#if !defined(ORT_MINIMAL_BUILD)
+  std::vector<const char*> providers = {kCpuExecutionProvider};
+  std::unique_ptr<NodeSelector> selector = std::make_unique<QDQ::LayerNormalizationSelector>(providers);
+  qdq_selector_action_registry.RegisterSelectorAndAction(action_name,
+                                                         {{"LayerNormalization", {}}},
+                                                         std::move(selector),
+                                                         std::move(action));
+
+#else
+  qdq_selector_action_registry.RegisterAction(action_name, std::move(action));
+#endif
+}
+
 SelectorActionRegistry CreateSelectorActionRegistry(
     bool is_int8_allowed,
     int64_t qdq_matmulnbits_accuracy_level,
@@ -361,6 +382,7 @@ SelectorActionRegistry CreateSelectorActionRegistry(
   MatMulQDQRules(qdq_selector_action_registry, is_int8_allowed);
   GemmQDQRules(qdq_selector_action_registry);
   WhereQDQRules(qdq_selector_action_registry);
+  LayerNormalizationQDQRules(qdq_selector_action_registry);
   DQMatMulToMatMulNBitsRules(qdq_selector_action_registry,
                              qdq_matmulnbits_accuracy_level,
                              intra_op_thread_pool,
@@ -635,6 +635,60 @@ bool InstanceAndLayerNormalizationNodeGroupSelector::Check(const GraphViewer& gr
          (has_bias ? dt_bias == ONNX_NAMESPACE::TensorProto_DataType::TensorProto_DataType_INT32 : true);
 }
 
+bool LayerNormalizationNodeGroupSelector::Check(const GraphViewer& graph_viewer,
+                                                const Node& node,
+                                                const std::vector<const Node*>& dq_nodes,
+                                                const std::vector<const Node*>& q_nodes) const {
+  // Only the activation comes through a DQ node; scale and B stay in float.
+  if (!CheckQDQNodes(graph_viewer, node, dq_nodes, q_nodes, 1)) {
+    return false;
+  }
+
+  // The DQ node must produce the activation (input 0), not the scale or bias.
+  bool dq_produces_activation = false;
+  for (auto edge = node.InputEdgesBegin(); edge != node.InputEdgesEnd(); ++edge) {
+    if (&edge->GetNode() == dq_nodes[0] && edge->GetDstArgIndex() == 0) {
+      dq_produces_activation = true;
+      break;
+    }
+  }
+  if (!dq_produces_activation) {
+    return false;
+  }
+
+  // The replacement inputs are built positionally, so the DQ zero point and the bias must both
+  // be present for the quantization parameters appended after them to land in the right slots.
+  if (dq_nodes[0]->InputDefs().size() != 3) {
+    return false;
+  }
+  const auto& input_defs = node.InputDefs();
+  if (input_defs.size() != 3 || !input_defs[2]->Exists()) {
+    return false;
+  }
+
+  int32_t dt_input = dq_nodes[0]->InputDefs()[0]->TypeAsProto()->tensor_type().elem_type();
+  int32_t dt_output = q_nodes[0]->OutputDefs()[0]->TypeAsProto()->tensor_type().elem_type();
+  if (dt_input != dt_output) {
+    return false;
+  }
+
+  // The CPU QLinearLayerNormalization kernel only handles 8-bit types.
+  if (Is16BitIntType(dt_input) || Is4BitIntType(dt_input)) {
+    return false;
+  }
+
+  // Scale and B must be float for the fused kernel.
+  for (size_t i = 1; i < 3; ++i) {
+    const auto* type_proto = input_defs[i]->TypeAsProto();
+    if (type_proto == nullptr ||
+        type_proto->tensor_type().elem_type() != ONNX_NAMESPACE::TensorProto_DataType::TensorProto_DataType_FLOAT) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
 bool BatchNormalizationNodeGroupSelector::Check(const GraphViewer& graph_viewer,
                                                 const Node& node,
                                                 const std::vector<const Node*>& dq_nodes,
@@ -239,6 +239,17 @@ class InstanceAndLayerNormalizationNodeGroupSelector : public NodeGroupSelector
              const std::vector<const Node*>& q_nodes) const override;
 };
 
+// Input: DQ node for the activation only; scale and B stay in float.
+// Output: Q node for output.
+// Used to fuse into the CPU QLinearLayerNormalization kernel; differs from
+// InstanceAndLayerNormalizationNodeGroupSelector, which expects DQ nodes on scale and B as well.
+class LayerNormalizationNodeGroupSelector : public NodeGroupSelector {
+ private:
+  bool Check(const GraphViewer& graph_viewer, const Node& node,
+             const std::vector<const Node*>& dq_nodes,
+             const std::vector<const Node*>& q_nodes) const override;
+};
+
 // DQ nodes for X, W and optionally B, not used for mean, var -> node -> Q
 class BatchNormalizationNodeGroupSelector : public NodeGroupSelector {
  public:
@@ -373,6 +384,13 @@ class WhereSelector : public BaseSelector {
       : BaseSelector(std::make_unique<WhereNodeGroupSelector>(allow_16bit, allow_4bit), compatible_providers) {}
 };
 
+// DQ node for the activation input -> LayerNormalization with float scale/B -> Q
+class LayerNormalizationSelector : public BaseSelector {
+ public:
+  explicit LayerNormalizationSelector(gsl::span<const char*> compatible_providers = {})
+      : BaseSelector(std::make_unique<LayerNormalizationNodeGroupSelector>(), compatible_providers) {}
+};
+
 // 2 DQ nodes for input -> node -> optional Q if QLinearMatMul, MatMulIntegerToFloat if not
 class MatMulSelector : public BaseSelector {
  public:
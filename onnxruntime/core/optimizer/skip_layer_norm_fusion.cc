@@ -62,33 +62,41 @@ static bool CheckFirstAdd(Node& add, ProviderType providertype) {
 }
 
 // Add2 is the 2nd add of the to be fused sub-graph
-// The 1st input should be a 3D tensor
-// The 2nd input should be a 1D constant value
-static bool CheckSecondAdd(Graph& graph, Node& add, ProviderType providertype) {
+// One input should be a 3D tensor and the other a 1D constant (the bias). Exporters emit the
+// bias as either operand (e.g. MatMul output + bias or bias + MatMul output), so both orders
+// are accepted; on success bias_input_index identifies the constant input.
+static bool CheckSecondAdd(Graph& graph, Node& add, ProviderType providertype, int& bias_input_index) {
   if (providertype != add.GetExecutionProviderType() ||
       !IsSupportedDataType(add) ||
       add.GetOutputEdgesCount() != 1) {
     return false;
   }
 
-  // The 2nd input should be a constant value
-  if (!graph_utils::NodeArgIsConstant(graph, *(add.MutableInputDefs()[1]))) {
-    return false;
-  }
+  for (int bias_index = 1; bias_index >= 0; --bias_index) {
+    // The bias input should be a constant value
+    if (!graph_utils::NodeArgIsConstant(graph, *(add.MutableInputDefs()[bias_index]))) {
+      continue;
+    }
 
-  // Check the input dimensions of the "Add" node.
-  const TensorShapeProto* add_input1_shape = add.MutableInputDefs()[0]->Shape();
-  const TensorShapeProto* add_input2_shape = add.MutableInputDefs()[1]->Shape();
+    // Check the input dimensions of the "Add" node.
+    const TensorShapeProto* data_shape = add.MutableInputDefs()[1 - bias_index]->Shape();
+    const TensorShapeProto* bias_shape = add.MutableInputDefs()[bias_index]->Shape();
 
-  if (add_input1_shape == nullptr || add_input2_shape == nullptr) {
-    return false;
+    if (data_shape == nullptr || bias_shape == nullptr) {
+      continue;
+    }
+
+    if (data_shape->dim_size() == 3 &&
+        bias_shape->dim_size() == 1 &&
+        utils::HasDimValue(data_shape->dim(2)) &&
+        utils::HasDimValue(bias_shape->dim(0)) &&
+        data_shape->dim(2).dim_value() == bias_shape->dim(0).dim_value()) {
+      bias_input_index = bias_index;
+      return true;
+    }
   }
 
-  return add_input1_shape->dim_size() == 3 &&
-         add_input2_shape->dim_size() == 1 &&
-         utils::HasDimValue(add_input1_shape->dim(2)) &&
-         utils::HasDimValue(add_input2_shape->dim(0)) &&
-         add_input1_shape->dim(2).dim_value() == add_input2_shape->dim(0).dim_value();
+  return false;
 }
 
 // Add a Cast to convert input from float16/bfloat16 to float when input type is different fromm output type
@@ -158,6 +166,10 @@ After fusion:
           \    /
     SkipLayerNormalization
 
+In Formats 1 and 2, C (the bias, a 1D constant) may be either operand of Add2. This covers the
+GEMM epilogue chain MatMul -> Add(bias) -> Add(residual) -> LayerNormalization regardless of the
+operand order the exporter used for the bias Add.
+
 Note: This fusion doesn't consider the following case:
       [Sub1]   [Sub2]
          \       /
@@ -196,6 +208,7 @@ Status SkipLayerNormFusion::ApplyImpl(Graph& graph, bool& modified, int graph_le
 
     Node* p_add1 = nullptr;
     Node* p_add2 = nullptr;
+    int add2_bias_input_index = 1;
     Format matched_format = Format::None;
 
     // Format 1
@@ -209,7 +222,7 @@ Status SkipLayerNormFusion::ApplyImpl(Graph& graph, bool& modified, int graph_le
       p_add2 = const_cast<Node*>(&edges[1]->GetNode());
 
       if (CheckFirstAdd(*p_add1, ln_node.GetExecutionProviderType()) &&
-          CheckSecondAdd(graph, *p_add2, ln_node.GetExecutionProviderType()) &&
+          CheckSecondAdd(graph, *p_add2, ln_node.GetExecutionProviderType(), add2_bias_input_index) &&
           !graph.NodeProducesGraphOutput(*p_add1) &&
           !graph.NodeProducesGraphOutput(*p_add2)) {
         matched_format = Format::Format1;
@@ -227,7 +240,7 @@ Status SkipLayerNormFusion::ApplyImpl(Graph& graph, bool& modified, int graph_le
         p_add2 = const_cast<Node*>(&edges[1]->GetNode());
 
         if (CheckFirstAdd(*p_add1, ln_node.GetExecutionProviderType()) &&
-            CheckSecondAdd(graph, *p_add2, ln_node.GetExecutionProviderType()) &&
+            CheckSecondAdd(graph, *p_add2, ln_node.GetExecutionProviderType(), add2_bias_input_index) &&
             !graph.NodeProducesGraphOutput(*p_add1) &&
             !graph.NodeProducesGraphOutput(*p_add2)) {
           matched_format = Format::Format2;
@@ -263,12 +276,12 @@ Status SkipLayerNormFusion::ApplyImpl(Graph& graph, bool& modified, int graph_le
                                                        ln_node.MutableInputDefs().size() == 2 ? &beta_place_holder : ln_node.MutableInputDefs()[2]};
 
     if (matched_format == Format::Format1) {
-      skip_layer_norm_input_defs[0] = p_add2->MutableInputDefs()[0];
-      skip_layer_norm_input_defs.push_back(p_add2->MutableInputDefs()[1]);
+      skip_layer_norm_input_defs[0] = p_add2->MutableInputDefs()[1 - add2_bias_input_index];
+      skip_layer_norm_input_defs.push_back(p_add2->MutableInputDefs()[add2_bias_input_index]);
       nodes_to_remove.push_back(*p_add2);
     } else if (matched_format == Format::Format2) {
-      skip_layer_norm_input_defs[1] = p_add2->MutableInputDefs()[0];
-      skip_layer_norm_input_defs.push_back(p_add2->MutableInputDefs()[1]);
+      skip_layer_norm_input_defs[1] = p_add2->MutableInputDefs()[1 - add2_bias_input_index];
+      skip_layer_norm_input_defs.push_back(p_add2->MutableInputDefs()[add2_bias_input_index]);
       nodes_to_remove.push_back(*p_add2);
     }
 
@@ -14,8 +14,9 @@ namespace onnxruntime {
 // note that GraphTransformer::Apply() is supposed to be stateless, so this cannot derive from GraphTransformer
 class TransformerMemcpyImpl {
  public:
-  TransformerMemcpyImpl(onnxruntime::Graph& graph, const std::string& provider)
-      : graph_(graph), provider_(provider) {}
+  TransformerMemcpyImpl(onnxruntime::Graph& graph, const std::string& provider,
+                        const InlinedHashSet<std::string>& device_resident_io)
+      : graph_(graph), provider_(provider), device_resident_io_(device_resident_io) {}
 
   bool ModifyGraph(const KernelRegistryManager& schema_registries, const logging::Logger& logger, int& copy_node_counter);
 
@@ -23,6 +24,7 @@ class TransformerMemcpyImpl {
   void ProcessDefs(onnxruntime::Node& node, const KernelRegistryManager& kernel_registries, InitializedTensorSet& initializers_consumed);
   void BuildDefsMapping(const onnxruntime::NodeArg* arg, const KernelRegistryManager& kernel_registries);
   void AddCopyNode(onnxruntime::NodeArg* arg, bool is_input, const logging::Logger& logger);
+  void AddCopyNodeForDeviceResidentDef(onnxruntime::NodeArg* arg, const logging::Logger& logger);
   bool ProcessInitializers(const KernelRegistryManager& kernel_registries, const InitializedTensorSet& initializers_consumed);
 
  private:
@@ -45,6 +47,8 @@ class TransformerMemcpyImpl {
 
   onnxruntime::Graph& graph_;
   std::string provider_;
+  // graph inputs/outputs the caller declared device-resident; see kOrtSessionOptionsDeviceResidentIo
+  const InlinedHashSet<std::string>& device_resident_io_;
 };
 
 /** Helper that returns a pointer to the corresponding TensorProto for a name if it is an initializer.
@@ -66,7 +70,11 @@ common::Status MemcpyTransformer::ApplyImpl(Graph& graph, bool& modified, int gr
                                             const logging::Logger& logger) const {
   for (auto& provider : provider_types_) {
     if (!utils::ProviderIsCpuBased(provider)) {
-      TransformerMemcpyImpl copy_impl(graph, provider);
+      // residency declarations only describe the model's own inputs/outputs; subgraph defs with
+      // matching names are fed by the parent control flow op, not by the caller
+      static const InlinedHashSet<std::string> empty_resident_io;
+      TransformerMemcpyImpl copy_impl(graph, provider,
+                                      graph.IsSubgraph() ? empty_resident_io : device_resident_io_);
 
       int copy_node_counter = 0;
       auto current_modified = copy_impl.ModifyGraph(registry_manager_, logger, copy_node_counter);
@@ -150,7 +158,15 @@ bool TransformerMemcpyImpl::ModifyGraph(const KernelRegistryManager& kernel_regi
     // For inputs we need to create a copy node only when the input is connected to both provider
     // and non-provider nodes. Otherwise utils::CopyInputsAcrossDevices() will do the job.
     if (provider_input_defs_.count(arg) && non_provider_input_defs_.count(arg)) {
-      AddCopyNode(const_cast<onnxruntime::NodeArg*>(arg), true, logger);
+      if (device_resident_io_.count(arg->Name())) {
+        // the caller binds this input in device memory: keep the provider consumers on the
+        // original def (so it is planned on the device and consumed in place) and give the
+        // CPU consumers a host copy, instead of staging the input on the host and copying
+        // it back to the device
+        AddCopyNodeForDeviceResidentDef(const_cast<onnxruntime::NodeArg*>(arg), logger);
+      } else {
+        AddCopyNode(const_cast<onnxruntime::NodeArg*>(arg), true, logger);
+      }
       copy_node_counter++;
       modified = true;
     }
@@ -164,7 +180,14 @@ bool TransformerMemcpyImpl::ModifyGraph(const KernelRegistryManager& kernel_regi
 
   for (auto arg : provider_output_defs_)
     if (non_provider_input_defs_.count(arg)) {
-      AddCopyNode(arg, false, logger);
+      if (graph_.IsOutput(arg) && device_resident_io_.count(arg->Name())) {
+        // the caller fetches this output in device memory: keep the producer writing the
+        // original def and copy to the host only for the CPU consumers, so the fetch does
+        // not force the output through host memory
+        AddCopyNodeForDeviceResidentDef(arg, logger);
+      } else {
+        AddCopyNode(arg, false, logger);
+      }
       copy_node_counter++;
       modified = true;
     }
@@ -346,6 +369,43 @@ void TransformerMemcpyImpl::AddCopyNode(onnxruntime::NodeArg* arg, bool is_input
   }
 }
 
+// Variant of AddCopyNode for graph inputs/outputs declared device-resident by the caller
+// (kOrtSessionOptionsDeviceResidentIo). The provider consumers (and the producer, for an output)
+// keep referencing 'arg' so it stays planned in provider memory and a device-resident binding is
+// used in place; every consumer that expects host data is redirected to a new MemcpyToHost copy.
+void TransformerMemcpyImpl::AddCopyNodeForDeviceResidentDef(onnxruntime::NodeArg* arg, const logging::Logger& logger) {
+  // create unique name for new def
+  std::string new_def_name = graph_.GenerateNodeArgName(arg->Name() + "_host");
+
+  auto* new_arg = &graph_.GetOrCreateNodeArg(new_def_name, arg->TypeAsProto());
+
+  // create unique name for copy node
+  std::string new_node_name = graph_.GenerateNodeName("Memcpy");
+
+  LOGS(logger, INFO) << "Add MemcpyToHost after device resident def " << arg->Name()
+                     << " for " << provider_;
+
+  auto& new_node = graph_.AddNode(new_node_name, "MemcpyToHost", "Copy from/to host memory",
+                                  std::vector<onnxruntime::NodeArg*>{arg},
+                                  std::vector<onnxruntime::NodeArg*>{new_arg});
+  new_node.SetExecutionProviderType(provider_);
+  std::map<const onnxruntime::NodeArg*, onnxruntime::NodeArg*> map = {{arg, new_arg}};
+
+  // provider consumers that want the def in provider memory keep the original; everything else
+  // that reads it (non-provider nodes and provider inputs pinned to CPU) moves to the host copy
+  const auto provider_consumers_it = provider_input_nodes_.find(arg);
+  for (auto& node : graph_.Nodes()) {
+    if (&node == &new_node) continue;
+    if (node.OpType() == "MemcpyFromHost" || node.OpType() == "MemcpyToHost") continue;
+    if (provider_consumers_it != provider_input_nodes_.end() && provider_consumers_it->second.count(&node)) continue;
+
+    const auto& input_defs = node.MutableInputDefs();
+    if (std::find(input_defs.begin(), input_defs.end(), arg) != input_defs.end()) {
+      node.ReplaceDefs(map);
+    }
+  }
+}
+
 template <typename NodeArgSetType>
 static const onnxruntime::NodeArg* FindNodeArg(const NodeArgSetType& def_set, const std::string& name) {
   NodeArg def(name, nullptr);
@@ -6,6 +6,7 @@
 #include <functional>
 
 #include "core/common/common.h"
+#include "core/common/inlined_containers.h"
 #include "core/framework/op_kernel.h"
 #include "core/framework/kernel_registry_manager.h"
 #include "core/optimizer/graph_transformer.h"
@@ -16,17 +17,26 @@ namespace onnxruntime {
 @Class MemcpyTransformer
 
 Transformer that inserts nodes to copy memory between devices when needed.
+
+'device_resident_io' names graph inputs/outputs the caller declared device-resident (see
+kOrtSessionOptionsDeviceResidentIo): for those the provider side keeps the original def so it is
+planned in device memory, and the CPU consumers read a MemcpyToHost copy instead.
 */
 class MemcpyTransformer : public GraphTransformer {
  public:
-  MemcpyTransformer(const std::vector<std::string>& provider_types, const KernelRegistryManager& registry_manager)
-      : GraphTransformer("MemcpyTransformer"), provider_types_(provider_types), registry_manager_(std::cref(registry_manager)) {}
+  MemcpyTransformer(const std::vector<std::string>& provider_types, const KernelRegistryManager& registry_manager,
+                    InlinedHashSet<std::string> device_resident_io = {})
+      : GraphTransformer("MemcpyTransformer"),
+        provider_types_(provider_types),
+        registry_manager_(std::cref(registry_manager)),
+        device_resident_io_(std::move(device_resident_io)) {}
 
  private:
   common::Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
 
   const std::vector<std::string> provider_types_;
   std::reference_wrapper<const KernelRegistryManager> registry_manager_;
+  const InlinedHashSet<std::string> device_resident_io_;
 };
 
 }  // namespace onnxruntime
@@ -2044,6 +2044,18 @@ static bool HandleQuantizeDequantizeLinear(HandlerArgs& args) {
     return false;
   }
 
+  // With blocked quantization (opset 21) scale and zero_point have the same rank as the input, so
+  // they must be permuted along with it. Per-tensor and per-axis params only need the axis update.
+  auto inputs = args.node.Inputs();
+  auto scale_shape = args.ctx.graph.GetValueInfo(inputs[1])->Shape();
+  if (scale_shape.has_value() && scale_shape->size() == args.perm.size() && args.perm.size() > 1) {
+    std::vector<size_t> param_indices{1};
+    if (inputs.size() > 2 && inputs[2] != "") {
+      param_indices.push_back(2);
+    }
+    TransposeInputs(args.ctx, args.node, args.perm_inv, param_indices);
+  }
+
   TransposeFirstInput(args.ctx, args.node, args.perm_inv);
   TransposeOutputs(args.ctx, args.node, args.perm);
 
@@ -34,6 +34,10 @@ std::ostream& operator<<(std::ostream& os, gsl::span<const LogicalProcessors> af
 
 Env::Env() = default;
 
+common::Status Env::SetSelfThreadAffinity(const LogicalProcessors& /*processors*/) const {
+  return ORT_MAKE_STATUS(ONNXRUNTIME, NOT_IMPLEMENTED, "Setting thread affinity is not supported on this platform.");
+}
+
 std::pair<int, std::string> GetErrnoInfo() {
   auto err = errno;
   std::string msg;
@@ -91,6 +91,26 @@ struct ThreadOptions {
   void* custom_thread_creation_options = nullptr;
   OrtCustomJoinThreadFn custom_join_thread_fn = nullptr;
   int dynamic_block_base_ = 0;
+
+  // Number of consecutive worker threads that form one steal domain. Work stealing prefers victims
+  // inside the caller's domain and only crosses domains when the whole domain is drained. On NUMA
+  // hosts, set this to the number of worker threads bound to one node (with the affinities above
+  // assigning consecutive threads to the same node) so steals stay node-local. 0 (default) keeps a
+  // single pool-wide domain.
+  int steal_domain_size = 0;
+
+  // Maximum number of worker threads (in addition to the caller) enlisted by the small-loop
+  // fast path in ThreadPool::ParallelFor. When > 0 the pool measures its dispatch overhead at
+  // construction, and loops whose estimated cost is small relative to that overhead are run
+  // either inline or with a fork limited to this many workers rather than fanning out across
+  // the whole pool. 0 (default) disables the fast path.
+  int small_loop_max_helpers = 0;
+
+  // Learn an efficient degree of parallelism per bucket of loop cost online, and clamp future
+  // parallel loops of that bucket to the thread count they have been measured to scale to.
+  // The learned clamps are reported in the thread pool profiler output. false (default)
+  // dispatches every loop across the pool's full degree of parallelism.
+  bool adaptive_degree = false;
 };
 
 std::ostream& operator<<(std::ostream& os, const LogicalProcessors&);
@@ -130,6 +150,13 @@ class Env {
                                   _In_ unsigned (*start_address)(int id, Eigen::ThreadPoolInterface* param),
                                   Eigen::ThreadPoolInterface* threadpool, const ThreadOptions& thread_options) = 0;
 
+  /**
+   * Set the affinity of the calling thread to the given set of logical processors.
+   * Used to re-pin thread pool worker threads after pool creation; the worker applies the
+   * new affinity to itself. The default implementation reports affinity setting as unsupported.
+   */
+  virtual common::Status SetSelfThreadAffinity(const LogicalProcessors& processors) const;
+
   /// \brief Returns a default environment suitable for the current operating
   /// system.
   ///
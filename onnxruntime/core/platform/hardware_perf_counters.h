@@ -0,0 +1,61 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstdint>
+
+#include "core/common/common.h"
+
+namespace onnxruntime {
+namespace profiling {
+
+/**
+ * Hardware performance counters for the calling thread.
+ *
+ * On Linux this opens a perf_event group counting retired instructions, last
+ * level cache misses and backend stall cycles for the calling thread, so the
+ * profiler can tell whether a kernel regressed because it executes more
+ * instructions, misses the cache more or stalls on memory bandwidth. On other
+ * platforms, and when the kernel refuses the counters (perf_event_paranoid,
+ * seccomp, missing PMU in a VM), IsSupported() returns false and Read()
+ * returns zeros; callers are expected to degrade to wall time only.
+ *
+ * The counters run continuously from construction, measure user space only
+ * and count the opening thread, so attribution works by taking Read() deltas
+ * around the region of interest on that thread. Work a kernel pushes to the
+ * thread pool is not counted; the numbers describe the calling thread, which
+ * for the sequential executor is the thread the kernel's Compute runs on.
+ */
+class HardwarePerfCounters {
+ public:
+  struct Values {
+    uint64_t instructions{0};
+    uint64_t llc_misses{0};
+    uint64_t stalled_cycles{0};
+
+    Values operator-(const Values& other) const {
+      return {instructions - other.instructions,
+              llc_misses - other.llc_misses,
+              stalled_cycles - other.stalled_cycles};
+    }
+  };
+
+  HardwarePerfCounters();
+  ~HardwarePerfCounters();
+
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(HardwarePerfCounters);
+
+  bool IsSupported() const { return group_fd_ != -1; }
+
+  /** Current accumulated counts for the owning thread since construction. */
+  Values Read() const;
+
+ private:
+  int group_fd_{-1};
+  int llc_miss_fd_{-1};
+  int stalled_cycles_fd_{-1};
+};
+
+}  // namespace profiling
+}  // namespace onnxruntime
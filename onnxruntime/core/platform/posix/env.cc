@@ -267,6 +267,33 @@ class PosixEnv : public Env {
     return new PosixThread(name_prefix, index, start_address, param, thread_options);
   }
 
+  common::Status SetSelfThreadAffinity(const LogicalProcessors& processors) const override {
+#if !defined(__APPLE__) && !defined(__ANDROID__) && !defined(__wasm__) && !defined(_AIX)
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    for (auto id : processors) {
+      if (id > -1 && id < CPU_SETSIZE) {
+        CPU_SET(id, &cpuset);
+      } else {
+        // Logical processor id starts from 0 internally, but in ort API, it starts from 1,
+        // that's why id need to increase by 1 when logging.
+        return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "cpu ", id + 1, " does not exist");
+      }
+    }
+    auto ret = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset);
+    if (0 != ret) {
+      errno = ret;
+      auto [err_no, err_msg] = GetErrnoInfo();
+      return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "pthread_setaffinity_np failed for thread: ",
+                             syscall(SYS_gettid), ", error code: ", err_no, " error msg: ", err_msg);
+    }
+    return Status::OK();
+#else
+    ORT_UNUSED_PARAMETER(processors);
+    return ORT_MAKE_STATUS(ONNXRUNTIME, NOT_IMPLEMENTED, "Setting thread affinity is not supported on this platform.");
+#endif
+  }
+
   // we are guessing the number of phys cores based on a popular HT case (2 logical proc per core)
   static int DefaultNumCores() {
     return std::max(1, static_cast<int>(std::thread::hardware_concurrency() / 2));
@@ -449,6 +476,13 @@ class PosixEnv : public Env {
       return ReportSystemError("mmap", file_path);
     }
 
+#if defined(MADV_WILLNEED)
+    // Hint the kernel to start reading the mapped region in ahead of first access. Initializers backed by the
+    // mapping are typically touched shortly after Load() so this hides most of the page-in latency. Failure is
+    // not fatal; the pages will simply be faulted in on demand.
+    (void)madvise(mapped_base, mapped_length, MADV_WILLNEED);
+#endif
+
     mapped_memory =
         MappedMemoryPtr{reinterpret_cast<char*>(mapped_base) + offset_to_page,
                         OrtCallbackInvoker{OrtCallback{UnmapFile, new UnmapFileParam{mapped_base, mapped_length}}}};
@@ -465,6 +465,16 @@ Status WindowsEnv::MapFileIntoMemory(_In_z_ const ORTCHAR_T* file_path,
                                           static_cast<DWORD>((mapped_offset >> 32) & 0xFFFFFFFF),
                                           static_cast<DWORD>(mapped_offset & 0xFFFFFFFF),
                                           mapped_length);
+#if defined(NTDDI_WIN8) && (NTDDI_VERSION >= NTDDI_WIN8) && WINAPI_FAMILY_PARTITION(WINAPI_PARTITION_DESKTOP)
+  // Ask the memory manager to start paging the view in now rather than on first touch. Initializers backed by
+  // the mapping are typically read shortly after Load(), so this hides most of the hard page fault latency.
+  // Best effort only; on failure the pages are faulted in on demand.
+  if (mapped_base != nullptr) {
+    WIN32_MEMORY_RANGE_ENTRY range{mapped_base, mapped_length};
+    (void)PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+  }
+#endif
+
   GSL_SUPPRESS(r.11)
   mapped_memory =
       MappedMemoryPtr{reinterpret_cast<char*>(mapped_base) + offset_to_page,
@@ -854,6 +864,46 @@ ProcessorInfo WindowsEnv::GetProcessorAffinityMask(int global_processor_id) cons
   }
 }
 
+common::Status WindowsEnv::SetSelfThreadAffinity(const LogicalProcessors& processors) const {
+  int group_id = -1;
+  KAFFINITY mask = 0;
+  constexpr KAFFINITY bit = 1;
+  for (auto global_processor_id : processors) {
+    auto processor_info = GetProcessorAffinityMask(global_processor_id);
+    if (processor_info.local_processor_id < 0 ||
+        processor_info.local_processor_id >= static_cast<int>(sizeof(KAFFINITY) * CHAR_BIT)) {
+      // Logical processor id starts from 0 internally, but in ort API, it starts from 1,
+      // that's why id need to increase by 1 when reporting.
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Cannot set affinity for thread ",
+                             GetCurrentThreadId(), ", processor ", global_processor_id + 1, " does not exist");
+    }
+    if (group_id == -1) {
+      group_id = processor_info.group_id;
+    } else if (group_id != processor_info.group_id) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Cannot set cross-group affinity for thread ",
+                             GetCurrentThreadId(), ", first on group ", group_id,
+                             ", then on ", processor_info.group_id);
+    }
+    mask |= bit << processor_info.local_processor_id;
+  }
+
+  if (group_id < 0 || mask == 0) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Empty affinity setting for thread ",
+                           GetCurrentThreadId());
+  }
+
+  GROUP_AFFINITY thread_affinity = {};
+  thread_affinity.Group = static_cast<WORD>(group_id);
+  thread_affinity.Mask = mask;
+  if (!SetThreadGroupAffinity(GetCurrentThread(), &thread_affinity, nullptr)) {
+    const auto error_code = GetLastError();
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "SetThreadGroupAffinity failed for thread: ",
+                           GetCurrentThreadId(), ", error code: ", error_code,
+                           ", error msg: ", std::system_category().message(error_code));
+  }
+  return Status::OK();
+}
+
 WindowsEnv::WindowsEnv() {
   l2_cache_size_ = 0;
   InitializeCpuInfo();
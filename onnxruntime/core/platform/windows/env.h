@@ -84,6 +84,7 @@ class WindowsEnv : public Env {
   std::string FormatLibraryFileName(const std::string& name, const std::string& version) const override;
   const Telemetry& GetTelemetryProvider() const override;
   std::string GetEnvironmentVar(const std::string& var_name) const override;
+  common::Status SetSelfThreadAffinity(const LogicalProcessors& processors) const override;
   ProcessorInfo GetProcessorAffinityMask(int global_processor_id) const;
 
  protected:
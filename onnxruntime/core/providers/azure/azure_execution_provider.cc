@@ -6,5 +6,6 @@
 
 namespace onnxruntime {
 AzureExecutionProvider::AzureExecutionProvider(const std::unordered_map<std::string, std::string>& config) : IExecutionProvider{onnxruntime::kAzureExecutionProvider}, config_(config) {
+  ORT_THROW_IF_ERROR(azure::ParseTransferCodec(config_, transfer_codec_));
 }
 }  // namespace onnxruntime
\ No newline at end of file
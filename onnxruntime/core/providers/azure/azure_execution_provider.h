@@ -4,6 +4,7 @@
 #pragma once
 
 #include "core/framework/execution_provider.h"
+#include "core/providers/azure/transfer_codec.h"
 
 namespace onnxruntime {
 
@@ -13,8 +14,12 @@ class AzureExecutionProvider : public IExecutionProvider {
   ~AzureExecutionProvider() = default;
   const std::unordered_map<std::string, std::string>& GetConfig() const { return config_; }
 
+  // how tensor bytes are encoded for transfer to the remote endpoint
+  azure::TransferCodec GetTransferCodec() const { return transfer_codec_; }
+
  private:
   std::unordered_map<std::string, std::string> config_;
+  azure::TransferCodec transfer_codec_{azure::TransferCodec::kNone};
 };
 
 }  // namespace onnxruntime
\ No newline at end of file
@@ -0,0 +1,70 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/providers/azure/transfer_codec.h"
+
+namespace onnxruntime {
+namespace azure {
+
+common::Status ParseTransferCodec(const std::unordered_map<std::string, std::string>& config,
+                                  TransferCodec& codec) {
+  codec = TransferCodec::kNone;
+
+  auto it = config.find(kTransferCodecConfigKey);
+  if (it == config.end() || it->second == "none") {
+    return common::Status::OK();
+  }
+
+  if (it->second == "byte_stream_split") {
+    codec = TransferCodec::kByteStreamSplit;
+    return common::Status::OK();
+  }
+
+  return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Unrecognized ", kTransferCodecConfigKey,
+                         " value: ", it->second);
+}
+
+static common::Status ValidateSplitArgs(gsl::span<const uint8_t> src, size_t element_size,
+                                        gsl::span<uint8_t> dst) {
+  ORT_RETURN_IF_NOT(element_size > 0, "element_size must be non-zero.");
+  ORT_RETURN_IF_NOT(src.size() % element_size == 0,
+                    "Buffer size ", src.size(), " is not a multiple of element size ", element_size);
+  ORT_RETURN_IF_NOT(src.size() == dst.size(),
+                    "Source size ", src.size(), " does not match destination size ", dst.size());
+  return common::Status::OK();
+}
+
+common::Status ByteStreamSplitEncode(gsl::span<const uint8_t> src, size_t element_size,
+                                     gsl::span<uint8_t> dst) {
+  ORT_RETURN_IF_ERROR(ValidateSplitArgs(src, element_size, dst));
+
+  const size_t num_elements = src.size() / element_size;
+  for (size_t plane = 0; plane < element_size; ++plane) {
+    uint8_t* plane_out = dst.data() + plane * num_elements;
+    const uint8_t* in = src.data() + plane;
+    for (size_t i = 0; i < num_elements; ++i) {
+      plane_out[i] = in[i * element_size];
+    }
+  }
+
+  return common::Status::OK();
+}
+
+common::Status ByteStreamSplitDecode(gsl::span<const uint8_t> src, size_t element_size,
+                                     gsl::span<uint8_t> dst) {
+  ORT_RETURN_IF_ERROR(ValidateSplitArgs(src, element_size, dst));
+
+  const size_t num_elements = src.size() / element_size;
+  for (size_t plane = 0; plane < element_size; ++plane) {
+    const uint8_t* plane_in = src.data() + plane * num_elements;
+    uint8_t* out = dst.data() + plane;
+    for (size_t i = 0; i < num_elements; ++i) {
+      out[i * element_size] = plane_in[i];
+    }
+  }
+
+  return common::Status::OK();
+}
+
+}  // namespace azure
+}  // namespace onnxruntime
@@ -0,0 +1,46 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+
+#include <gsl/gsl>
+
+#include "core/common/common.h"
+
+namespace onnxruntime {
+namespace azure {
+
+// Provider config key selecting how tensor bytes are encoded for the wire.
+// Accepted values: "none" (default) and "byte_stream_split".
+constexpr const char* kTransferCodecConfigKey = "transfer_codec";
+
+enum class TransferCodec {
+  kNone = 0,
+  // Splits each element into per-byte planes (all byte 0s, then all byte 1s, ...). For float
+  // tensors the exponent/high-mantissa planes are highly repetitive, so a general-purpose
+  // compressor on the transport (HTTP gzip/deflate at the endpoint or proxy) gets a far better
+  // ratio than on interleaved floats, at the cost of one in-memory shuffle per transfer.
+  kByteStreamSplit = 1,
+};
+
+/** Reads the transfer codec from the provider config.
+@returns an error for an unrecognized codec name; absent key selects TransferCodec::kNone.
+*/
+common::Status ParseTransferCodec(const std::unordered_map<std::string, std::string>& config,
+                                  TransferCodec& codec);
+
+/** Encodes `src` into `dst` by splitting elements of `element_size` bytes into byte planes.
+`dst` must be the same size as `src`, and `src` size must be a multiple of `element_size`.
+*/
+common::Status ByteStreamSplitEncode(gsl::span<const uint8_t> src, size_t element_size,
+                                     gsl::span<uint8_t> dst);
+
+/** Inverse of ByteStreamSplitEncode, with the same size requirements. */
+common::Status ByteStreamSplitDecode(gsl::span<const uint8_t> src, size_t element_size,
+                                     gsl::span<uint8_t> dst);
+
+}  // namespace azure
+}  // namespace onnxruntime
@@ -7,10 +7,16 @@
 #include "core/framework/framework_common.h"
 #include "core/framework/op_kernel_context_internal.h"
 #include "core/framework/session_state.h"
+#include "core/framework/subgraph_result_cache.h"
 #include "core/framework/tensorprotoutils.h"
 #include "core/framework/utils.h"
 #include "core/framework/session_options.h"
 
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <optional>
+
 using namespace ONNX_NAMESPACE;
 using namespace onnxruntime::common;
 
@@ -123,6 +129,55 @@ ONNX_CPU_OPERATOR_KERNEL(
         .TypeConstraint("V", DataTypeImpl::AllTensorAndSequenceTensorAndOptionalTypesIRv9()),
     If);
 
+namespace {
+// Touch one byte per page of every CPU initializer in the subgraph. This pre-faults weights that have
+// never been used (or that the OS paged out while the branch was cold) so the first execution after a
+// branch switch does not stall on page faults on top of the cold caches.
+void PrefaultSubgraphInitializers(const SessionState& session_state) {
+  constexpr size_t kPageSize = 4096;
+  uint8_t sink = 0;
+
+  for (const auto& entry : session_state.GetInitializedTensors()) {
+    const OrtValue& ort_value = entry.second;
+    if (!ort_value.IsAllocated() || !ort_value.IsTensor()) {
+      continue;
+    }
+
+    const auto& tensor = ort_value.Get<Tensor>();
+    if (tensor.Location().device.Type() != OrtDevice::CPU) {
+      continue;
+    }
+
+    const auto* data = static_cast<const uint8_t*>(tensor.DataRaw());
+    if (data == nullptr) {
+      continue;
+    }
+
+    for (size_t offset = 0, size = tensor.SizeInBytes(); offset < size; offset += kPageSize) {
+      sink ^= data[offset];
+    }
+  }
+
+  // keep the reads from being optimized away
+  static std::atomic<uint8_t> consume{0};
+  consume.fetch_xor(sink, std::memory_order_relaxed);
+}
+
+// Whether the node's outputs are a pure function of its inputs. Mirrors the non-deterministic
+// operator list in core/optimizer/utils.cc, which is not visible from the providers; unknown
+// domains are conservatively treated as non-deterministic.
+bool IsNodeDeterministic(const Node& node) {
+  if (node.Domain() != kOnnxDomain) {
+    return false;
+  }
+
+  constexpr std::array kOnnxDomainNonDeterministicOps{"RandomUniform", "RandomNormal", "RandomUniformLike",
+                                                      "RandomNormalLike", "Multinomial", "Dropout"};
+  return std::find(kOnnxDomainNonDeterministicOps.begin(), kOnnxDomainNonDeterministicOps.end(),
+                   node.OpType()) == kOnnxDomainNonDeterministicOps.end();
+}
+}  // namespace
+
 If::Info::Info(const onnxruntime::Node& node, const GraphViewer& subgraph_in) : subgraph(subgraph_in) {
   num_implicit_inputs = static_cast<int>(node.ImplicitInputDefs().size());
   used_implicit_inputs = std::vector<bool>(num_implicit_inputs, true);
@@ -204,6 +259,28 @@ common::Status If::SetupSubgraphExecutionInfo(const SessionState& session_state,
   const auto& node = Node();
   info = std::make_unique<If::Info>(node, subgraph_session_state.GetGraphViewer());
 
+  // determine whether the branch is eligible for runtime memoization: every node deterministic,
+  // no nested control flow (a nested subgraph could pull in state we don't fingerprint) and all
+  // outputs tensors. the flag only takes effect when kOrtSessionOptionsEnableSubgraphMemoization
+  // is set; see the cache handling in If::Compute.
+  info->is_pure = true;
+  for (const auto& subgraph_node : info->subgraph.Nodes()) {
+    if (subgraph_node.ContainsSubgraph() || !IsNodeDeterministic(subgraph_node)) {
+      info->is_pure = false;
+      break;
+    }
+  }
+
+  if (info->is_pure) {
+    for (const auto* output : info->subgraph.GetOutputs()) {
+      const auto* type = output->TypeAsProto();
+      if (type == nullptr || !type->has_tensor_type()) {
+        info->is_pure = false;
+        break;
+      }
+    }
+  }
+
   // all inputs for the If subgraph are implicit
   std::vector<std::string> feed_names;
   feed_names.reserve(info->num_implicit_inputs);
@@ -267,22 +344,117 @@ Status If::Compute(OpKernelContext* ctx) const {
 
   auto condition = *condition_tensor.Data<bool>();
 
+  // update the branch statistics, and once this node shows a strong bias pre-fault the cold branch's
+  // initializers. the one-time warm-up cost is paid here, on an execution of the hot branch, instead of
+  // showing up as a latency spike when the cold branch is eventually taken.
+  const uint64_t taken = (condition ? then_taken_ : else_taken_).fetch_add(1, std::memory_order_relaxed) + 1;
+  const uint64_t not_taken = (condition ? else_taken_ : then_taken_).load(std::memory_order_relaxed);
+  const uint64_t total = taken + not_taken;
+
+  constexpr uint64_t kMinExecutionsForWarmup = 16;
+  if (total >= kMinExecutionsForWarmup && not_taken * 10 < total) {
+    std::atomic<bool>& cold_branch_warmed = condition ? else_warmed_ : then_warmed_;
+    if (!cold_branch_warmed.exchange(true, std::memory_order_relaxed)) {
+      const auto* cold_attribute = condition ? "else_branch" : "then_branch";
+      if (const auto* cold_session_state = ctx_internal->SubgraphSessionState(cold_attribute)) {
+        VLOGS(ctx->Logger(), 1) << "Pre-faulting initializers of cold '" << cold_attribute
+                                << "' after " << total << " executions of If node '" << Node().Name() << "'";
+        PrefaultSubgraphInitializers(*cold_session_state);
+      }
+    }
+  }
+
   auto attribute = condition ? "then_branch" : "else_branch";
   auto* session_state = ctx_internal->SubgraphSessionState(attribute);
   ORT_ENFORCE(session_state, "Subgraph SessionState was not found for '", attribute, "' attribute.");
 
   const auto& info = condition ? then_info_ : else_info_;
+
+  // opt-in runtime memoization of pure branches. ensemble models evaluate identical
+  // feature-normalization subgraphs on the same inputs several times per run, and compile-time
+  // common subexpression elimination cannot merge them across branch bodies. when enabled and
+  // the branch is pure, look the outputs up by a content fingerprint of the feeds before
+  // executing the subgraph, and store them afterwards.
+  SubgraphResultCache* result_cache = info->is_pure ? session_state->GetSubgraphResultCache() : nullptr;
+  SubgraphResultCache::Fingerprint fingerprint{};
+  bool have_fingerprint = false;
+
+  if (result_cache) {
+    const auto& implicit_inputs = ctx_internal->GetImplicitInputs();
+    InlinedVector<OrtValue> feeds;
+    feeds.reserve(info->num_implicit_inputs);
+    for (size_t i = 0, end = info->used_implicit_inputs.size(); i < end; ++i) {
+      if (info->used_implicit_inputs[i]) {
+        feeds.push_back(*implicit_inputs[i]);
+      }
+    }
+
+    have_fingerprint = SubgraphResultCache::FingerprintFeeds(feeds, fingerprint);
+    if (have_fingerprint) {
+      if (auto cached = result_cache->Lookup(fingerprint)) {
+        bool wrote_all = true;
+        for (int i = 0; i < info->num_outputs; ++i) {
+          const auto& src = (*cached)[i].Get<Tensor>();
+          Tensor* dst = ctx->Output(i, src.Shape());
+          // fall back to executing the subgraph when an output is not a CPU tensor; the cached
+          // copies live in CPU memory.
+          if (dst == nullptr || dst->Location().device.Type() != OrtDevice::CPU) {
+            wrote_all = false;
+            break;
+          }
+          if (src.SizeInBytes() > 0) {
+            memcpy(dst->MutableDataRaw(), src.DataRaw(), src.SizeInBytes());
+          }
+        }
+
+        if (wrote_all) {
+          VLOGS(ctx->Logger(), 1) << "Using memoized '" << attribute << "' results for If node '"
+                                  << Node().Name() << "'";
+          return Status::OK();
+        }
+      }
+    }
+  }
+
   IfImpl impl{*ctx_internal, *session_state, *info};
 
   auto status = impl.Initialize();
   ORT_RETURN_IF_ERROR(status);
 
+  // scope the branch's profile events under the If node so they are attributable in the
+  // trace and the folded stack output
+  std::optional<profiling::ScopedProfileFrame> profile_frame;
+  if (session_state->Profiler().IsEnabled()) {
+    const auto& node_name = Node().Name();
+    profile_frame.emplace(MakeString(node_name.empty() ? MakeString(Node().OpType(), "_", Node().Index()) : node_name,
+                                     ":", attribute));
+  }
+
   if (condition) {
     status = impl.Execute(*then_feeds_fetches_manager_);
   } else {
     status = impl.Execute(*else_feeds_fetches_manager_);
   }
 
+  if (status.IsOK() && result_cache && have_fingerprint) {
+    InlinedVector<OrtValue> outputs;
+    outputs.reserve(info->num_outputs);
+    bool all_available = true;
+    for (int i = 0; i < info->num_outputs; ++i) {
+      const OrtValue* output = ctx_internal->GetOutputMLValue(i);
+      if (output == nullptr) {
+        all_available = false;
+        break;
+      }
+      outputs.push_back(*output);
+    }
+
+    // Store validates that every output is a CPU tensor and is a no-op otherwise.
+    if (all_available) {
+      result_cache->Store(fingerprint, outputs);
+    }
+  }
+
   return status;
 }
 
@@ -438,7 +610,10 @@ Status IfImpl::Execute(const FeedsFetchesManager& ffm) {
 
   status = utils::ExecuteSubgraph(session_state_, ffm, feeds, fetches, fetch_allocators,
                                   ExecutionMode::ORT_SEQUENTIAL, context_.GetTerminateFlag(),
-                                  context_.Logger(), context_.GetComputeStream());
+                                  context_.Logger(), context_.GetComputeStream(),
+                                  /*sync_subgraph_fetches*/ false,
+                                  /*feed_copy_cache*/ nullptr,
+                                  context_.GetDeadline());
 
   ORT_RETURN_IF_ERROR(status);
 
@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #pragma once
+#include <atomic>
 #include <functional>
 
 #include "core/providers/cpu/controlflow/utils.h"
@@ -29,6 +30,11 @@ class If : public controlflow::IControlFlowKernel {
     int num_outputs;
 
     std::vector<std::string> subgraph_output_names;
+
+    // true when every node in the subgraph is deterministic, there is no nested control flow and
+    // all outputs are tensors, so the branch's outputs are a pure function of its implicit inputs.
+    // Makes the branch eligible for runtime memoization. See SubgraphResultCache.
+    bool is_pure{false};
   };
 
  private:
@@ -37,5 +43,14 @@ class If : public controlflow::IControlFlowKernel {
   std::unique_ptr<Info> else_info_;
   std::unique_ptr<FeedsFetchesManager> then_feeds_fetches_manager_;
   std::unique_ptr<FeedsFetchesManager> else_feeds_fetches_manager_;
+
+  // Per-node branch statistics. Routing models take the same branch almost every time, and the first
+  // execution after a branch switch stalls on first-touch page faults of weights that have never been
+  // used. Once the statistics show a strong bias we pre-fault the cold branch's initializers so that
+  // cost is not paid at the switch. See the warm-up logic in If::Compute.
+  mutable std::atomic<uint64_t> then_taken_{0};
+  mutable std::atomic<uint64_t> else_taken_{0};
+  mutable std::atomic<bool> then_warmed_{false};
+  mutable std::atomic<bool> else_warmed_{false};
 };
 }  // namespace onnxruntime
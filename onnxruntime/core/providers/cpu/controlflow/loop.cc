@@ -20,10 +20,13 @@
 #include "core/framework/utils.h"
 #include "core/providers/cpu/tensor/utils.h"
 #include "core/framework/session_options.h"
+#include "core/framework/tensor_compression.h"
 #include "core/framework/TensorSeq.h"
 #include "core/providers/utils.h"
+#include "core/session/onnxruntime_session_options_config_keys.h"
 
 #include <gsl/gsl>
+#include <optional>
 
 #ifdef _MSC_VER
 #pragma warning(pop)
@@ -200,7 +203,8 @@ class LoopImpl {
   LoopImpl(OpKernelContextInternal& context,
            const SessionState& session_state,
            const Loop::Info& info,
-           const Loop::ConcatOutput& concat_output_func);
+           const Loop::ConcatOutput& concat_output_func,
+           bool compress_scan_outputs);
 
   // Initialize by validating all the inputs, and allocating the output tensors
   Status Initialize();
@@ -211,11 +215,18 @@ class LoopImpl {
 
  private:
   void CreateInitialFeeds(std::vector<OrtValue>& feeds);
-  void SaveOutputsAndUpdateFeeds(const std::vector<OrtValue>& last_outputs, std::vector<OrtValue>& next_inputs);
+  Status SaveOutputsAndUpdateFeeds(const std::vector<OrtValue>& last_outputs, std::vector<OrtValue>& next_inputs);
+
+  // store one iteration's value for scan output scan_output_index, either as-is in
+  // loop_output_tensors_ or compressed in compressed_scan_outputs_.
+  Status SaveScanOutput(ptrdiff_t scan_output_index, const OrtValue& value);
 
   // create the single Loop output from a collection of per-iteration outputs
   Status ConcatenateLoopOutput(std::vector<OrtValue>& per_iteration_output, int output_index);
 
+  // ConcatenateLoopOutput equivalent for a scan output whose slices were compressed.
+  Status ConcatenateCompressedLoopOutput(ptrdiff_t scan_output_index, int output_index);
+
   OpKernelContextInternal& context_;
   const SessionState& session_state_;
   const Loop::Info& info_;
@@ -232,6 +243,22 @@ class LoopImpl {
   // the order from the subgraph matches the order from the loop output
   std::vector<std::vector<OrtValue>> loop_output_tensors_;
 
+  // per scan output state when scan output compression is enabled. a scan output slice is
+  // written once by its iteration and not read again until the final concatenation, so when
+  // the trade wins we keep the compressed bytes instead of the OrtValue and let the
+  // iteration's buffer be freed. the first slice of an output decides for the whole output:
+  // an ineligible or poorly compressing first slice turns the output raw permanently
+  // (slices of one output share a shape, so the probe is representative).
+  struct CompressedScanOutput {
+    bool decided = false;
+    bool enabled = false;
+    std::vector<CompressedTensorData> slices;
+    TensorShape per_iteration_shape;
+  };
+  std::vector<CompressedScanOutput> compressed_scan_outputs_;
+
+  const bool compress_scan_outputs_;
+
   const Loop::ConcatOutput& concat_output_func_;
 };
 
@@ -276,6 +303,9 @@ void Loop::Init(const OpKernelInfo& info) {
   ORT_IGNORE_RETURN_VALUE(proto);
 
   concat_output_func_ = ConcatenateCpuOutput;
+
+  compress_scan_outputs_ =
+      info.GetConfigOptions().GetConfigEntry(kOrtSessionOptionsEnableLoopScanOutputCompression) == "1";
 }
 
 std::unique_ptr<OpKernel> Loop::Create(const OpKernelInfo& info, const ConcatOutput& concat_output_func, void* /*stream*/) {
@@ -370,7 +400,7 @@ Status Loop::Compute(OpKernelContext* ctx) const {
   ORT_ENFORCE(session_state, "Subgraph SessionState was not found for 'body' attribute.");
   ORT_ENFORCE(feeds_fetches_manager_, "CreateFeedsFetchesManager must be called prior to execution of graph.");
 
-  LoopImpl loop_impl{*ctx_internal, *session_state, *info_, concat_output_func_};
+  LoopImpl loop_impl{*ctx_internal, *session_state, *info_, concat_output_func_, compress_scan_outputs_};
 
   auto status = loop_impl.Initialize();
   ORT_RETURN_IF_ERROR(status);
@@ -383,11 +413,13 @@ Status Loop::Compute(OpKernelContext* ctx) const {
 LoopImpl::LoopImpl(OpKernelContextInternal& context,
                    const SessionState& session_state,
                    const Loop::Info& subgraph_info,
-                   const Loop::ConcatOutput& concat_output_func)
+                   const Loop::ConcatOutput& concat_output_func,
+                   bool compress_scan_outputs)
     : context_(context),
       session_state_(session_state),
       info_(subgraph_info),
       implicit_inputs_(context_.GetImplicitInputs()),
+      compress_scan_outputs_(compress_scan_outputs),
       concat_output_func_(concat_output_func) {
   auto* max_trip_count_tensor = context.Input<Tensor>(0);
   max_trip_count_ = max_trip_count_tensor ? *max_trip_count_tensor->Data<int64_t>() : INT64_MAX;
@@ -433,6 +465,9 @@ Status LoopImpl::Initialize() {
   condition_mlvalue_ = MakeScalarMLValue<bool>(cpu_allocator, condition_, condition_rank != 0);
 
   loop_output_tensors_.resize(static_cast<size_t>(info_.num_outputs) - info_.num_loop_carried_vars);
+  if (compress_scan_outputs_) {
+    compressed_scan_outputs_.resize(loop_output_tensors_.size());
+  }
 
   return status;
 }
@@ -455,8 +490,8 @@ void LoopImpl::CreateInitialFeeds(std::vector<OrtValue>& feeds) {
   }
 }
 
-void LoopImpl::SaveOutputsAndUpdateFeeds(const std::vector<OrtValue>& last_outputs,
-                                         std::vector<OrtValue>& next_inputs) {
+Status LoopImpl::SaveOutputsAndUpdateFeeds(const std::vector<OrtValue>& last_outputs,
+                                           std::vector<OrtValue>& next_inputs) {
   // last_output: cond, loop vars..., loop output...
   // next_input: iter_num, cond, loop_vars. iter_num is re-used
 
@@ -468,8 +503,96 @@ void LoopImpl::SaveOutputsAndUpdateFeeds(const std::vector<OrtValue>& last_outpu
   // save loop outputs as we have to concatenate at the end
   for (ptrdiff_t j = info_.num_loop_carried_vars; j < info_.num_outputs; ++j) {
     ORT_ENFORCE(last_outputs[j + 1].IsTensor(), "All scan outputs MUST be tensors");
-    loop_output_tensors_[j - info_.num_loop_carried_vars].push_back(last_outputs[j + 1]);  // skip 'cond' in output
+    ORT_RETURN_IF_ERROR(SaveScanOutput(j - info_.num_loop_carried_vars, last_outputs[j + 1]));  // skip 'cond' in output
   }
+
+  return Status::OK();
+}
+
+namespace {
+// a scan output slice smaller than this is not worth the codec's bookkeeping; the whole
+// feature targets loops whose slices dominate memory.
+constexpr size_t kMinScanOutputBytesToCompress = 64 * 1024;
+}  // namespace
+
+Status LoopImpl::SaveScanOutput(ptrdiff_t scan_output_index, const OrtValue& value) {
+  if (compress_scan_outputs_) {
+    auto& state = compressed_scan_outputs_[scan_output_index];
+
+    if (!state.decided) {
+      state.decided = true;
+      const auto& tensor = value.Get<Tensor>();
+      const size_t size_bytes = tensor.SizeInBytes();
+
+      // the codec works on raw bytes so only plain CPU tensors of a useful size qualify
+      if (tensor.Location().device.Type() == OrtDevice::CPU &&
+          !tensor.IsDataTypeString() &&
+          size_bytes >= kMinScanOutputBytesToCompress) {
+        AllocatorPtr alloc;
+        ORT_RETURN_IF_ERROR(context_.GetTempSpaceAllocator(&alloc));
+
+        CompressedTensorData compressed;
+        ORT_RETURN_IF_ERROR(CompressedTensorData::Compress(tensor.DataRaw(), size_bytes, alloc, compressed));
+
+        // only commit to compressing this output if the probe slice shrank by at least 1/8,
+        // otherwise we'd pay two extra passes per slice to hold roughly the same bytes
+        if (compressed.CompressedSizeBytes() <= size_bytes - size_bytes / 8) {
+          state.enabled = true;
+          state.per_iteration_shape = tensor.Shape();
+          state.slices.push_back(std::move(compressed));
+          return Status::OK();
+        }
+      }
+    } else if (state.enabled) {
+      const auto& tensor = value.Get<Tensor>();
+
+      // same consistency requirement the uncompressed concat enforces
+      if (tensor.SizeInBytes() != state.slices.front().UncompressedSizeBytes()) {
+        return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Inconsistent shape in loop output for output. ",
+                               " Expected:", state.per_iteration_shape, " Got:", tensor.Shape());
+      }
+
+      AllocatorPtr alloc;
+      ORT_RETURN_IF_ERROR(context_.GetTempSpaceAllocator(&alloc));
+
+      CompressedTensorData compressed;
+      ORT_RETURN_IF_ERROR(CompressedTensorData::Compress(tensor.DataRaw(), tensor.SizeInBytes(), alloc, compressed));
+      state.slices.push_back(std::move(compressed));
+      return Status::OK();
+    }
+  }
+
+  loop_output_tensors_[scan_output_index].push_back(value);
+  return Status::OK();
+}
+
+Status LoopImpl::ConcatenateCompressedLoopOutput(ptrdiff_t scan_output_index, int output_index) {
+  auto& state = compressed_scan_outputs_[scan_output_index];
+  const auto& per_iteration_dims = state.per_iteration_shape.GetDims();
+  const size_t bytes_per_iteration = state.slices.front().UncompressedSizeBytes();
+
+  std::vector<int64_t> dims;
+  dims.reserve(1 + per_iteration_dims.size());
+  dims.push_back(gsl::narrow_cast<int64_t>(state.slices.size()));
+  std::copy(per_iteration_dims.begin(), per_iteration_dims.end(), std::back_inserter(dims));
+
+  TensorShape output_shape{dims};
+  Tensor* output = context_.Output(output_index, output_shape);
+  ORT_RETURN_IF_NOT(output->SizeInBytes() == bytes_per_iteration * state.slices.size(),
+                    "Loop output size does not match the accumulated scan output slices.");
+
+  // decompress each slice straight into its span of the final output, so the full
+  // uncompressed collection never exists at once
+  auto* output_bytes = static_cast<uint8_t*>(output->MutableDataRaw());
+  for (size_t i = 0; i < state.slices.size(); ++i) {
+    ORT_RETURN_IF_ERROR(state.slices[i].Decompress(output_bytes + i * bytes_per_iteration, bytes_per_iteration));
+  }
+
+  // release the compressed bytes now rather than at the end of Compute
+  state.slices.clear();
+  state.slices.shrink_to_fit();
+
+  return Status::OK();
 }
 
 Status LoopImpl::ConcatenateLoopOutput(std::vector<OrtValue>& per_iteration_output, int output_index) {
@@ -500,20 +623,46 @@ Status LoopImpl::Execute(const FeedsFetchesManager& ffm) {
 
   CreateInitialFeeds(feeds);
 
+  // implicit inputs are read-only and passed unchanged every iteration, so any
+  // cross-device copies of them only need to be made on the first iteration.
+  // the other feeds can't be cached: iter_num is updated in place and cond and the
+  // loop carried values are replaced with new values each iteration.
+  utils::SubgraphFeedCopyCache feed_copy_cache{feeds.size()};
+  for (size_t i = static_cast<size_t>(info_.num_subgraph_inputs); i < feeds.size(); ++i) {
+    feed_copy_cache.MarkImmutable(i);
+  }
+
   auto& iter_num_value = *iter_num_mlvalue_.GetMutable<Tensor>()->MutableData<int64_t>();
 
   while (iter_num_value < max_trip_count_ && *condition_mlvalue_.GetMutable<Tensor>()->MutableData<bool>()) {
+    // the subgraph execution checks the deadline before each kernel, but also check here so a loop
+    // over a trivially small subgraph still gives up between iterations instead of running to
+    // max_trip_count.
+    if (context_.DeadlineExpired()) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Exiting due to the run deadline being exceeded.");
+    }
+
     if (iter_num_value != 0) {
-      SaveOutputsAndUpdateFeeds(fetches, feeds);
+      ORT_RETURN_IF_ERROR(SaveOutputsAndUpdateFeeds(fetches, feeds));
       fetches.clear();
     }
 
+    // scope this iteration's profile events under the Loop node so per-iteration cost is
+    // attributable in the trace and the folded stack output
+    std::optional<profiling::ScopedProfileFrame> profile_frame;
+    if (session_state_.Profiler().IsEnabled()) {
+      profile_frame.emplace(context_.GetNodeName().empty() ? context_.GetOpType() : context_.GetNodeName(),
+                            iter_num_value);
+    }
+
     status = utils::ExecuteSubgraph(session_state_, ffm, feeds, fetches, {},
                                     ExecutionMode::ORT_SEQUENTIAL, context_.GetTerminateFlag(), context_.Logger(),
                                     context_.GetComputeStream(),
                                     // because the fetch[0] is the loop condition which we need to access on CPU,
                                     // have to perofrm a stream sync to make sure the data arrived.
-                                    true);
+                                    true,
+                                    &feed_copy_cache,
+                                    context_.GetDeadline());
     ORT_RETURN_IF_ERROR(status);
 
     condition_mlvalue_ = fetches[0];
@@ -595,10 +744,14 @@ Status LoopImpl::Execute(const FeedsFetchesManager& ffm) {
 
     for (int i = info_.num_loop_carried_vars; i < info_.num_outputs; ++i) {
       // add last output
-      auto& per_iteration_outputs = loop_output_tensors_[static_cast<ptrdiff_t>(i) - info_.num_loop_carried_vars];
-      per_iteration_outputs.push_back(fetches[static_cast<ptrdiff_t>(i) + 1]);  // skip cond
+      const ptrdiff_t scan_output_index = static_cast<ptrdiff_t>(i) - info_.num_loop_carried_vars;
+      ORT_RETURN_IF_ERROR(SaveScanOutput(scan_output_index, fetches[static_cast<ptrdiff_t>(i) + 1]));  // skip cond
 
-      ORT_RETURN_IF_ERROR(ConcatenateLoopOutput(per_iteration_outputs, i));
+      if (compress_scan_outputs_ && compressed_scan_outputs_[scan_output_index].enabled) {
+        ORT_RETURN_IF_ERROR(ConcatenateCompressedLoopOutput(scan_output_index, i));
+      } else {
+        ORT_RETURN_IF_ERROR(ConcatenateLoopOutput(loop_output_tensors_[scan_output_index], i));
+      }
     }
   } else {
     // no iterations.
@@ -57,5 +57,9 @@ class Loop : public controlflow::IControlFlowKernel {
   std::unique_ptr<Info> info_;
   std::unique_ptr<FeedsFetchesManager> feeds_fetches_manager_;
   ConcatOutput concat_output_func_;
+
+  // opt-in via kOrtSessionOptionsEnableLoopScanOutputCompression. compress scan output slices
+  // as iterations produce them instead of keeping every slice live until the final concat.
+  bool compress_scan_outputs_{false};
 };
 }  // namespace onnxruntime
@@ -20,6 +20,8 @@
 #include "core/providers/cpu/controlflow/utils.h"
 #include "core/framework/session_options.h"
 
+#include <optional>
+
 #ifdef _MSC_VER
 #pragma warning(pop)
 #endif
@@ -208,6 +210,14 @@ Status IterateSequence(OpKernelContextInternal& context, const SessionState& ses
     feeds[num_variadic_inputs + i] = *implicit_inputs[i];
   }
 
+  // the implicit inputs are read-only and passed unchanged every iteration, so any
+  // cross-device copies of them only need to be made on the first iteration. the loop
+  // state variables and sliced inputs are replaced each iteration and can't be cached.
+  utils::SubgraphFeedCopyCache feed_copy_cache{num_inputs};
+  for (size_t i = static_cast<size_t>(num_variadic_inputs); i < num_inputs; ++i) {
+    feed_copy_cache.MarkImmutable(i);
+  }
+
   int64_t seq_no = 0;
   for (; seq_no < seq_length; ++seq_no) {
     for (int input = 0; input < num_variadic_inputs; ++input) {
@@ -269,10 +279,21 @@ Status IterateSequence(OpKernelContextInternal& context, const SessionState& ses
       }
     }
 
+    // scope this iteration's profile events under the Scan node so per-iteration cost is
+    // attributable in the trace and the folded stack output
+    std::optional<profiling::ScopedProfileFrame> profile_frame;
+    if (session_state.Profiler().IsEnabled()) {
+      profile_frame.emplace(context.GetNodeName().empty() ? context.GetOpType() : context.GetNodeName(),
+                            seq_no);
+    }
+
     // Create Executor and run graph.
     status = utils::ExecuteSubgraph(session_state, ffm, feeds, fetches, fetch_allocators,
                                     ExecutionMode::ORT_SEQUENTIAL, context.GetTerminateFlag(), context.Logger(),
-                                    context.GetComputeStream());
+                                    context.GetComputeStream(),
+                                    /*sync_subgraph_fetches*/ false,
+                                    &feed_copy_cache,
+                                    context.GetDeadline());
 
     ORT_RETURN_IF_ERROR(status);
 
@@ -5,15 +5,25 @@
 
 #include "core/framework/execution_provider.h"
 #include "core/graph/constants.h"
+#include "core/providers/cpu/tunable/cpu_tuning_context.h"
 
 namespace onnxruntime {
 
 // Information needed to construct CPU execution providers.
 struct CPUExecutionProviderInfo {
   bool create_arena{true};
-
-  explicit CPUExecutionProviderInfo(bool use_arena)
-      : create_arena(use_arena) {}
+  // Layer a per-thread size-class cache over the arena so small allocations don't contend on
+  // its lock. Only takes effect when the arena is created.
+  bool use_arena_thread_cache{false};
+  // TunableOp settings, mirroring the CUDA/ROCm providers. `tunable_op_enable` lets tuned ops
+  // use previously collected results, `tunable_op_tuning_enable` additionally allows online
+  // profiling of the candidate implementations.
+  bool tunable_op_enable{false};
+  bool tunable_op_tuning_enable{false};
+  int tunable_op_max_tuning_duration_ms{0};
+
+  explicit CPUExecutionProviderInfo(bool use_arena, bool use_arena_thread_cache_in = false)
+      : create_arena(use_arena), use_arena_thread_cache(use_arena_thread_cache_in) {}
 
   CPUExecutionProviderInfo() = default;
 };
@@ -32,9 +42,15 @@ class CPUExecutionProvider : public IExecutionProvider {
   std::unique_ptr<IDataTransfer> GetDataTransfer() const override;
   std::vector<AllocatorPtr> CreatePreferredAllocators() override;
 
+  ITuningContext* GetTuningContext() const override {
+    return const_cast<cpu::tunable::CpuTuningContext*>(&tuning_context_);
+  }
+
  private:
   CPUExecutionProviderInfo info_;
   std::vector<FuseRuleFn> fuse_rules_;
+  cpu::tunable::TunableOpInfo tunable_op_info_;
+  mutable cpu::tunable::CpuTuningContext tuning_context_;
 };
 
 // Registers all available CPU kernels
@@ -2,6 +2,9 @@
 // Licensed under the MIT License.
 
 #include "einsum_typed_compute_processor.h"
+
+#include <limits>
+
 #include "core/common/narrow.h"
 #include "core/common/span_utils.h"
 
@@ -72,6 +75,90 @@ void EinsumTypedComputeProcessor<T>::FinalizeOutput(const Tensor& candidate_outp
   }
 }
 
+// Pick the order in which the operands at indices 1 onwards are folded into the running result
+// (which is seeded with operand 0). The default left-to-right order can produce needlessly large
+// intermediates - e.g. an outer product of two operands sharing no labels that a later operand
+// would have contracted away. This is numpy.einsum_path's "greedy" strategy restricted to a left
+// fold: at every step the operand with the cheapest estimated contraction against the running
+// result is folded next, ties broken towards the smaller resulting intermediate. Costs are
+// estimated in double to sidestep overflow; they only need to order the candidates.
+static InlinedVector<int> ChooseFoldOrder(const std::vector<TensorShape>& homogenized_input_dims,
+                                          const std::vector<int64_t>& mapped_indices_to_last_input_index,
+                                          int64_t num_subscript_labels,
+                                          int num_inputs) {
+  InlinedVector<int> fold_order;
+  fold_order.reserve(static_cast<size_t>(num_inputs) - 1);
+  if (num_inputs <= 2) {
+    for (int input = 1; input < num_inputs; ++input) {
+      fold_order.push_back(input);
+    }
+    return fold_order;
+  }
+
+  TensorShapeVector result_dims(homogenized_input_dims[0].GetDims().begin(),
+                                homogenized_input_dims[0].GetDims().end());
+  InlinedVector<int> remaining;
+  remaining.reserve(static_cast<size_t>(num_inputs) - 1);
+  for (int input = 1; input < num_inputs; ++input) {
+    remaining.push_back(input);
+  }
+
+  while (!remaining.empty()) {
+    size_t best_position = 0;
+    double best_cost = std::numeric_limits<double>::infinity();
+    double best_size = std::numeric_limits<double>::infinity();
+    for (size_t position = 0; position < remaining.size(); ++position) {
+      const auto candidate_dims = homogenized_input_dims[remaining[position]].GetDims();
+      double cost = 1.0;
+      double size = 1.0;
+      for (int64_t dim = 0; dim < num_subscript_labels; ++dim) {
+        size_t dim_index = onnxruntime::narrow<size_t>(dim);
+        const auto merged_dim = std::max(result_dims[dim_index], candidate_dims[dim_index]);
+        cost *= static_cast<double>(merged_dim);
+        // once no operand left to fold carries the dim it gets reduced and stops contributing
+        // to the intermediate (-1 marks dims that survive into the output and never reduce)
+        bool used_later = false;
+        for (size_t other = 0; other < remaining.size(); ++other) {
+          if (other != position && homogenized_input_dims[remaining[other]].GetDims()[dim_index] > 1) {
+            used_later = true;
+            break;
+          }
+        }
+        if (mapped_indices_to_last_input_index[dim_index] == -1 || used_later) {
+          size *= static_cast<double>(merged_dim);
+        }
+      }
+      if (cost < best_cost || (cost == best_cost && size < best_size)) {
+        best_position = position;
+        best_cost = cost;
+        best_size = size;
+      }
+    }
+
+    int chosen = remaining[best_position];
+    remaining.erase(remaining.begin() + best_position);
+    const auto chosen_dims = homogenized_input_dims[chosen].GetDims();
+    for (int64_t dim = 0; dim < num_subscript_labels; ++dim) {
+      size_t dim_index = onnxruntime::narrow<size_t>(dim);
+      bool used_later = false;
+      for (auto other : remaining) {
+        if (homogenized_input_dims[other].GetDims()[dim_index] > 1) {
+          used_later = true;
+          break;
+        }
+      }
+      if (mapped_indices_to_last_input_index[dim_index] != -1 && !used_later) {
+        result_dims[dim_index] = 1;
+      } else {
+        result_dims[dim_index] = std::max(result_dims[dim_index], chosen_dims[dim_index]);
+      }
+    }
+    fold_order.push_back(chosen);
+  }
+
+  return fold_order;
+}
+
 static bool IsTransposeReshapeForEinsum(const gsl::span<const size_t>& perm,
                                         gsl::span<const int64_t> input_dims,
                                         TensorShapeVector& new_shape) {
@@ -357,6 +444,29 @@ Status EinsumTypedComputeProcessor<T>::Run() {
 
   auto num_inputs = context_->InputCount();
 
+  const InlinedVector<int> fold_order = ChooseFoldOrder(homogenized_input_dims,
+                                                        mapped_indices_to_last_input_index,
+                                                        num_subscript_labels, num_inputs);
+
+  // Position in the fold sequence [input 0, fold_order...] after which each subscript dim gets
+  // reduced: the last position whose operand has a non-trivial value along the dim. Occurrences
+  // of size 1 after that position are safe to ignore - summing a dim commutes with multiplying
+  // by broadcast (size 1) factors. Dims that survive into the output keep the -1 marker of
+  // mapped_indices_to_last_input_index and are never reduced mid-fold.
+  std::vector<int64_t> dim_last_fold_position(onnxruntime::narrow<size_t>(num_subscript_labels), -1);
+  for (size_t i = 0; i < onnxruntime::narrow<size_t>(num_subscript_labels); ++i) {
+    if (mapped_indices_to_last_input_index[i] == -1) {
+      continue;
+    }
+    int64_t last_fold_position = 0;
+    for (size_t position = 0; position < fold_order.size(); ++position) {
+      if (homogenized_input_dims[fold_order[position]].GetDims()[i] > 1) {
+        last_fold_position = static_cast<int64_t>(position) + 1;
+      }
+    }
+    dim_last_fold_position[i] = last_fold_position;
+  }
+
   // Pre-process the first input so as to reduce any dims that only it has
   std::unique_ptr<const Tensor> result;
 
@@ -368,7 +478,7 @@ Status EinsumTypedComputeProcessor<T>::Run() {
     preserved_dims.reserve(onnxruntime::narrow<size_t>(num_subscript_labels));  // num_subscript_labels is the upper bound. No harm in over-reserving.
 
     for (size_t i = 0; i < onnxruntime::narrow<size_t>(num_subscript_labels); ++i) {
-      if (mapped_indices_to_last_input_index[i] == 0) {
+      if (dim_last_fold_position[i] == 0) {
         reduced_dims.push_back(i);
       } else {
         preserved_dims.push_back(i);
@@ -398,20 +508,20 @@ Status EinsumTypedComputeProcessor<T>::Run() {
     }
   }
 
-  // Process the operands in a pair-wise fashion
+  // Process the operands in a pair-wise fashion, following the chosen fold order
   {
     bool is_final_pair = false;
-    // Keep processing each input pair-wise
-    for (int input = 1; input < num_inputs; ++input) {
+    for (size_t position = 0; position < fold_order.size(); ++position) {
+      int input = fold_order[position];
       TensorShapeVector reduced_dims;
       reduced_dims.reserve(onnxruntime::narrow<size_t>(num_subscript_labels));  // num_subscript_labels is the upper bound. No harm in over-reserving by a small margin.
       for (int64_t dim = 0; dim < num_subscript_labels; ++dim) {
-        if (mapped_indices_to_last_input_index[onnxruntime::narrow<size_t>(dim)] == input) {
-          // This is the last input we are seeing this dimension (and it doesn't occur in the output), so reduce along the dimension
+        if (dim_last_fold_position[onnxruntime::narrow<size_t>(dim)] == static_cast<int64_t>(position) + 1) {
+          // This is the last fold carrying this dimension (and it doesn't occur in the output), so reduce along the dimension
           reduced_dims.push_back(dim);
         }
       }
-      if (input == num_inputs - 1) {
+      if (position == fold_order.size() - 1) {
         is_final_pair = true;
       }
       // Use either the preprocessed inputs (if it is available) or the corresponding raw inputs
@@ -76,12 +76,30 @@ void Exp<float>::operator()(std::ptrdiff_t first, std::ptrdiff_t last) const {
 }
 }  // namespace functors
 
-#define REG_ELEMENTWISE_TYPED_KERNEL(OP_TYPE, VERSION, TYPE, KERNEL_CLASS)         \
-  ONNX_CPU_OPERATOR_TYPED_KERNEL(                                                  \
-      OP_TYPE,                                                                     \
-      VERSION,                                                                     \
-      TYPE,                                                                        \
-      KernelDefBuilder().TypeConstraint("T", DataTypeImpl::GetTensorType<TYPE>()), \
+// All of the kernels in this file compute each output element from the input elements at
+// the same (broadcast) position, so the output may safely share the buffer of an input
+// with the same shape. MayInplace(0, 0) declares that; the planner only acts on it when
+// the sizes match, so a broadcast input is never reused. The binary arithmetic ops also
+// declare MayInplace(1, 0) so the second input is a candidate too (e.g. Sub(scalar, X)).
+#define REG_ELEMENTWISE_TYPED_KERNEL(OP_TYPE, VERSION, TYPE, KERNEL_CLASS) \
+  ONNX_CPU_OPERATOR_TYPED_KERNEL(                                          \
+      OP_TYPE,                                                             \
+      VERSION,                                                             \
+      TYPE,                                                                \
+      KernelDefBuilder()                                                   \
+          .MayInplace(0, 0)                                                \
+          .TypeConstraint("T", DataTypeImpl::GetTensorType<TYPE>()),       \
+      KERNEL_CLASS<TYPE>);
+
+#define REG_ELEMENTWISE_BINARY_TYPED_KERNEL(OP_TYPE, VERSION, TYPE, KERNEL_CLASS) \
+  ONNX_CPU_OPERATOR_TYPED_KERNEL(                                                 \
+      OP_TYPE,                                                                    \
+      VERSION,                                                                    \
+      TYPE,                                                                       \
+      KernelDefBuilder()                                                          \
+          .MayInplace(0, 0)                                                       \
+          .MayInplace(1, 0)                                                       \
+          .TypeConstraint("T", DataTypeImpl::GetTensorType<TYPE>()),              \
       KERNEL_CLASS<TYPE>);
 
 #define REG_ELEMENTWISE_LOGICALOP_TYPED_KERNEL(OP_TYPE, VERSION, TYPE, KERNEL_CLASS) \
@@ -99,7 +117,20 @@ void Exp<float>::operator()(std::ptrdiff_t first, std::ptrdiff_t last) const {
       OP_TYPE,                                                                                        \
       VERSION_FROM, VERSION_TO,                                                                       \
       TYPE,                                                                                           \
-      KernelDefBuilder().TypeConstraint("T", DataTypeImpl::GetTensorType<TYPE>()),                    \
+      KernelDefBuilder()                                                                              \
+          .MayInplace(0, 0)                                                                           \
+          .TypeConstraint("T", DataTypeImpl::GetTensorType<TYPE>()),                                  \
+      KERNEL_CLASS<TYPE>);
+
+#define REG_ELEMENTWISE_BINARY_VERSIONED_TYPED_KERNEL(OP_TYPE, VERSION_FROM, VERSION_TO, TYPE, KERNEL_CLASS) \
+  ONNX_CPU_OPERATOR_VERSIONED_TYPED_KERNEL(                                                                  \
+      OP_TYPE,                                                                                               \
+      VERSION_FROM, VERSION_TO,                                                                              \
+      TYPE,                                                                                                  \
+      KernelDefBuilder()                                                                                     \
+          .MayInplace(0, 0)                                                                                  \
+          .MayInplace(1, 0)                                                                                  \
+          .TypeConstraint("T", DataTypeImpl::GetTensorType<TYPE>()),                                         \
       KERNEL_CLASS<TYPE>);
 
 #define REG_ELEMENTWISE_LOGICALOP_VERSIONED_TYPED_KERNEL(OP_TYPE, VERSION_FROM, VERSION_TO, TYPE, KERNEL_CLASS) \
@@ -117,6 +148,7 @@ void Exp<float>::operator()(std::ptrdiff_t first, std::ptrdiff_t last) const {
       OP_TYPE,                                                                   \
       VERSION,                                                                   \
       KernelDefBuilder()                                                         \
+          .MayInplace(0, 0)                                                      \
           .TypeConstraint("T", CONSTRAINTS),                                     \
       KERNEL_CLASS);
 
@@ -127,6 +159,7 @@ void Exp<float>::operator()(std::ptrdiff_t first, std::ptrdiff_t last) const {
       VERSION_FROM,                                                                            \
       VERSION_TO,                                                                              \
       KernelDefBuilder()                                                                       \
+          .MayInplace(0, 0)                                                                    \
           .TypeConstraint("T", CONSTRAINTS),                                                   \
       KERNEL_CLASS);
 
@@ -137,6 +170,7 @@ void Exp<float>::operator()(std::ptrdiff_t first, std::ptrdiff_t last) const {
       OP_TYPE,                                                        \
       VERSION,                                                        \
       KernelDefBuilder()                                              \
+          .MayInplace(0, 0)                                           \
           .TypeConstraint("T", T1_CONSTRAINTS)                        \
           .TypeConstraint("T1", T2_CONSTRAINTS),                      \
       KERNEL_CLASS);
@@ -149,61 +183,103 @@ void Exp<float>::operator()(std::ptrdiff_t first, std::ptrdiff_t last) const {
       VERSION_FROM,                                                                              \
       VERSION_TO,                                                                                \
       KernelDefBuilder()                                                                         \
+          .MayInplace(0, 0)                                                                      \
           .TypeConstraint("T", T1_CONSTRAINTS)                                                   \
           .TypeConstraint("T1", T2_CONSTRAINTS),                                                 \
       KERNEL_CLASS);
 
-REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Add, 7, 12, float, Add);
-REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Add, 7, 12, double, Add);
-REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Add, 7, 12, int32_t, Add);
-REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Add, 7, 12, int64_t, Add);
-REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Add, 13, 13, float, Add);
-REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Add, 13, 13, double, Add);
-REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Add, 13, 13, int32_t, Add);
-REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Add, 13, 13, int64_t, Add);
-REG_ELEMENTWISE_TYPED_KERNEL(Add, 14, float, Add);
-REG_ELEMENTWISE_TYPED_KERNEL(Add, 14, double, Add);
-REG_ELEMENTWISE_TYPED_KERNEL(Add, 14, int32_t, Add);
-REG_ELEMENTWISE_TYPED_KERNEL(Add, 14, int64_t, Add);
-
-REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Sub, 7, 12, float, Sub);
-REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Sub, 7, 12, double, Sub);
-REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Sub, 7, 12, int32_t, Sub);
-REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Sub, 7, 12, int64_t, Sub);
-REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Sub, 13, 13, float, Sub);
-REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Sub, 13, 13, double, Sub);
-REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Sub, 13, 13, int32_t, Sub);
-REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Sub, 13, 13, int64_t, Sub);
-REG_ELEMENTWISE_TYPED_KERNEL(Sub, 14, float, Sub);
-REG_ELEMENTWISE_TYPED_KERNEL(Sub, 14, double, Sub);
-REG_ELEMENTWISE_TYPED_KERNEL(Sub, 14, int32_t, Sub);
-REG_ELEMENTWISE_TYPED_KERNEL(Sub, 14, int64_t, Sub);
-
-REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Mul, 7, 12, float, Mul);
-REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Mul, 7, 12, double, Mul);
-REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Mul, 7, 12, int32_t, Mul);
-REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Mul, 7, 12, int64_t, Mul);
-REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Mul, 13, 13, float, Mul);
-REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Mul, 13, 13, double, Mul);
-REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Mul, 13, 13, int32_t, Mul);
-REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Mul, 13, 13, int64_t, Mul);
-REG_ELEMENTWISE_TYPED_KERNEL(Mul, 14, float, Mul);
-REG_ELEMENTWISE_TYPED_KERNEL(Mul, 14, double, Mul);
-REG_ELEMENTWISE_TYPED_KERNEL(Mul, 14, int32_t, Mul);
-REG_ELEMENTWISE_TYPED_KERNEL(Mul, 14, int64_t, Mul);
-
-REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Div, 7, 12, float, Div);
-REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Div, 7, 12, double, Div);
-REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Div, 7, 12, int32_t, Div);
-REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Div, 7, 12, int64_t, Div);
-REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Div, 13, 13, float, Div);
-REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Div, 13, 13, double, Div);
-REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Div, 13, 13, int32_t, Div);
-REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Div, 13, 13, int64_t, Div);
-REG_ELEMENTWISE_TYPED_KERNEL(Div, 14, float, Div);
-REG_ELEMENTWISE_TYPED_KERNEL(Div, 14, double, Div);
-REG_ELEMENTWISE_TYPED_KERNEL(Div, 14, int32_t, Div);
-REG_ELEMENTWISE_TYPED_KERNEL(Div, 14, int64_t, Div);
+// fp16/bf16 arithmetic is implemented with the Eigen 16-bit float types (see Binary16BitFloat
+// below), so declare the specializations before the kernel registrations instantiate the class
+// templates.
+template <>
+Status Add<MLFloat16>::Compute(OpKernelContext* context) const;
+template <>
+Status Sub<MLFloat16>::Compute(OpKernelContext* context) const;
+template <>
+Status Mul<MLFloat16>::Compute(OpKernelContext* context) const;
+template <>
+Status Div<MLFloat16>::Compute(OpKernelContext* context) const;
+template <>
+Status Add<BFloat16>::Compute(OpKernelContext* context) const;
+template <>
+Status Sub<BFloat16>::Compute(OpKernelContext* context) const;
+template <>
+Status Mul<BFloat16>::Compute(OpKernelContext* context) const;
+template <>
+Status Div<BFloat16>::Compute(OpKernelContext* context) const;
+
+REG_ELEMENTWISE_BINARY_VERSIONED_TYPED_KERNEL(Add, 7, 12, float, Add);
+REG_ELEMENTWISE_BINARY_VERSIONED_TYPED_KERNEL(Add, 7, 12, double, Add);
+REG_ELEMENTWISE_BINARY_VERSIONED_TYPED_KERNEL(Add, 7, 12, int32_t, Add);
+REG_ELEMENTWISE_BINARY_VERSIONED_TYPED_KERNEL(Add, 7, 12, int64_t, Add);
+REG_ELEMENTWISE_BINARY_VERSIONED_TYPED_KERNEL(Add, 13, 13, float, Add);
+REG_ELEMENTWISE_BINARY_VERSIONED_TYPED_KERNEL(Add, 13, 13, double, Add);
+REG_ELEMENTWISE_BINARY_VERSIONED_TYPED_KERNEL(Add, 13, 13, int32_t, Add);
+REG_ELEMENTWISE_BINARY_VERSIONED_TYPED_KERNEL(Add, 13, 13, int64_t, Add);
+REG_ELEMENTWISE_BINARY_TYPED_KERNEL(Add, 14, float, Add);
+REG_ELEMENTWISE_BINARY_TYPED_KERNEL(Add, 14, double, Add);
+REG_ELEMENTWISE_BINARY_TYPED_KERNEL(Add, 14, int32_t, Add);
+REG_ELEMENTWISE_BINARY_TYPED_KERNEL(Add, 14, int64_t, Add);
+REG_ELEMENTWISE_BINARY_VERSIONED_TYPED_KERNEL(Add, 7, 12, MLFloat16, Add);
+REG_ELEMENTWISE_BINARY_VERSIONED_TYPED_KERNEL(Add, 13, 13, MLFloat16, Add);
+REG_ELEMENTWISE_BINARY_TYPED_KERNEL(Add, 14, MLFloat16, Add);
+// bfloat16 joined the schema type constraints at opset 13
+REG_ELEMENTWISE_BINARY_VERSIONED_TYPED_KERNEL(Add, 13, 13, BFloat16, Add);
+REG_ELEMENTWISE_BINARY_TYPED_KERNEL(Add, 14, BFloat16, Add);
+
+REG_ELEMENTWISE_BINARY_VERSIONED_TYPED_KERNEL(Sub, 7, 12, float, Sub);
+REG_ELEMENTWISE_BINARY_VERSIONED_TYPED_KERNEL(Sub, 7, 12, double, Sub);
+REG_ELEMENTWISE_BINARY_VERSIONED_TYPED_KERNEL(Sub, 7, 12, int32_t, Sub);
+REG_ELEMENTWISE_BINARY_VERSIONED_TYPED_KERNEL(Sub, 7, 12, int64_t, Sub);
+REG_ELEMENTWISE_BINARY_VERSIONED_TYPED_KERNEL(Sub, 13, 13, float, Sub);
+REG_ELEMENTWISE_BINARY_VERSIONED_TYPED_KERNEL(Sub, 13, 13, double, Sub);
+REG_ELEMENTWISE_BINARY_VERSIONED_TYPED_KERNEL(Sub, 13, 13, int32_t, Sub);
+REG_ELEMENTWISE_BINARY_VERSIONED_TYPED_KERNEL(Sub, 13, 13, int64_t, Sub);
+REG_ELEMENTWISE_BINARY_TYPED_KERNEL(Sub, 14, float, Sub);
+REG_ELEMENTWISE_BINARY_TYPED_KERNEL(Sub, 14, double, Sub);
+REG_ELEMENTWISE_BINARY_TYPED_KERNEL(Sub, 14, int32_t, Sub);
+REG_ELEMENTWISE_BINARY_TYPED_KERNEL(Sub, 14, int64_t, Sub);
+REG_ELEMENTWISE_BINARY_VERSIONED_TYPED_KERNEL(Sub, 7, 12, MLFloat16, Sub);
+REG_ELEMENTWISE_BINARY_VERSIONED_TYPED_KERNEL(Sub, 13, 13, MLFloat16, Sub);
+REG_ELEMENTWISE_BINARY_TYPED_KERNEL(Sub, 14, MLFloat16, Sub);
+REG_ELEMENTWISE_BINARY_VERSIONED_TYPED_KERNEL(Sub, 13, 13, BFloat16, Sub);
+REG_ELEMENTWISE_BINARY_TYPED_KERNEL(Sub, 14, BFloat16, Sub);
+
+REG_ELEMENTWISE_BINARY_VERSIONED_TYPED_KERNEL(Mul, 7, 12, float, Mul);
+REG_ELEMENTWISE_BINARY_VERSIONED_TYPED_KERNEL(Mul, 7, 12, double, Mul);
+REG_ELEMENTWISE_BINARY_VERSIONED_TYPED_KERNEL(Mul, 7, 12, int32_t, Mul);
+REG_ELEMENTWISE_BINARY_VERSIONED_TYPED_KERNEL(Mul, 7, 12, int64_t, Mul);
+REG_ELEMENTWISE_BINARY_VERSIONED_TYPED_KERNEL(Mul, 13, 13, float, Mul);
+REG_ELEMENTWISE_BINARY_VERSIONED_TYPED_KERNEL(Mul, 13, 13, double, Mul);
+REG_ELEMENTWISE_BINARY_VERSIONED_TYPED_KERNEL(Mul, 13, 13, int32_t, Mul);
+REG_ELEMENTWISE_BINARY_VERSIONED_TYPED_KERNEL(Mul, 13, 13, int64_t, Mul);
+REG_ELEMENTWISE_BINARY_TYPED_KERNEL(Mul, 14, float, Mul);
+REG_ELEMENTWISE_BINARY_TYPED_KERNEL(Mul, 14, double, Mul);
+REG_ELEMENTWISE_BINARY_TYPED_KERNEL(Mul, 14, int32_t, Mul);
+REG_ELEMENTWISE_BINARY_TYPED_KERNEL(Mul, 14, int64_t, Mul);
+REG_ELEMENTWISE_BINARY_VERSIONED_TYPED_KERNEL(Mul, 7, 12, MLFloat16, Mul);
+REG_ELEMENTWISE_BINARY_VERSIONED_TYPED_KERNEL(Mul, 13, 13, MLFloat16, Mul);
+REG_ELEMENTWISE_BINARY_TYPED_KERNEL(Mul, 14, MLFloat16, Mul);
+REG_ELEMENTWISE_BINARY_VERSIONED_TYPED_KERNEL(Mul, 13, 13, BFloat16, Mul);
+REG_ELEMENTWISE_BINARY_TYPED_KERNEL(Mul, 14, BFloat16, Mul);
+
+REG_ELEMENTWISE_BINARY_VERSIONED_TYPED_KERNEL(Div, 7, 12, float, Div);
+REG_ELEMENTWISE_BINARY_VERSIONED_TYPED_KERNEL(Div, 7, 12, double, Div);
+REG_ELEMENTWISE_BINARY_VERSIONED_TYPED_KERNEL(Div, 7, 12, int32_t, Div);
+REG_ELEMENTWISE_BINARY_VERSIONED_TYPED_KERNEL(Div, 7, 12, int64_t, Div);
+REG_ELEMENTWISE_BINARY_VERSIONED_TYPED_KERNEL(Div, 13, 13, float, Div);
+REG_ELEMENTWISE_BINARY_VERSIONED_TYPED_KERNEL(Div, 13, 13, double, Div);
+REG_ELEMENTWISE_BINARY_VERSIONED_TYPED_KERNEL(Div, 13, 13, int32_t, Div);
+REG_ELEMENTWISE_BINARY_VERSIONED_TYPED_KERNEL(Div, 13, 13, int64_t, Div);
+REG_ELEMENTWISE_BINARY_TYPED_KERNEL(Div, 14, float, Div);
+REG_ELEMENTWISE_BINARY_TYPED_KERNEL(Div, 14, double, Div);
+REG_ELEMENTWISE_BINARY_TYPED_KERNEL(Div, 14, int32_t, Div);
+REG_ELEMENTWISE_BINARY_TYPED_KERNEL(Div, 14, int64_t, Div);
+REG_ELEMENTWISE_BINARY_VERSIONED_TYPED_KERNEL(Div, 7, 12, MLFloat16, Div);
+REG_ELEMENTWISE_BINARY_VERSIONED_TYPED_KERNEL(Div, 13, 13, MLFloat16, Div);
+REG_ELEMENTWISE_BINARY_TYPED_KERNEL(Div, 14, MLFloat16, Div);
+REG_ELEMENTWISE_BINARY_VERSIONED_TYPED_KERNEL(Div, 13, 13, BFloat16, Div);
+REG_ELEMENTWISE_BINARY_TYPED_KERNEL(Div, 14, BFloat16, Div);
 
 REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Abs, 6, 12, float, Abs);
 REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Abs, 6, 12, double, Abs);
@@ -533,6 +609,123 @@ Status Div<T>::Compute(OpKernelContext* context) const {
   return Status::OK();
 }
 
+namespace half_binary_internal {
+
+// Functors for Binary16BitFloat. Eigen accepts a scalar on either side of the array operators, so a
+// single Apply covers the scalar/array, array/scalar and array/array broadcast cases.
+struct HalfAdd {
+  template <typename A, typename B>
+  static auto Apply(const A& a, const B& b) { return a + b; }
+};
+
+struct HalfSub {
+  template <typename A, typename B>
+  static auto Apply(const A& a, const B& b) { return a - b; }
+};
+
+struct HalfMul {
+  template <typename A, typename B>
+  static auto Apply(const A& a, const B& b) { return a * b; }
+};
+
+struct HalfDiv {
+  template <typename A, typename B>
+  static auto Apply(const A& a, const B& b) { return a / b; }
+};
+
+// Performs the arithmetic for the fp16/bf16 Add/Sub/Mul/Div kernels by reinterpreting the data as
+// the matching Eigen 16-bit float type (Eigen::half or Eigen::bfloat16), in the same way as
+// MinMaxMLFloat16 below. This keeps reduced precision graphs on their native tensors instead of
+// relying on inserted Casts to fp32; both Eigen types do the per-element arithmetic in fp32 and
+// round the result back.
+template <typename Op, typename T, typename EigenT>
+static Status Binary16BitFloat(OpKernelContext& context) {
+  ProcessBroadcastSpanFuncs funcs{
+      [](BroadcastHelper& per_iter_bh) {
+        auto num_elements = per_iter_bh.EigenInput1<T>().rows();
+
+        const auto* input_1 = reinterpret_cast<const EigenT*>(per_iter_bh.EigenInput1<T>().data());
+        ConstEigenVectorArrayMap<EigenT> input_1_vec_map(input_1, num_elements);
+
+        auto* output = reinterpret_cast<EigenT*>(per_iter_bh.OutputEigen<T>().data());
+        EigenVectorArrayMap<EigenT> output_vec_map(output, num_elements);
+
+        output_vec_map = Op::Apply(EigenT(per_iter_bh.ScalarInput0<T>().ToFloat()),
+                                   input_1_vec_map);
+      },
+      [](BroadcastHelper& per_iter_bh) {
+        auto num_elements = per_iter_bh.EigenInput0<T>().rows();
+
+        const auto* input_0 = reinterpret_cast<const EigenT*>(per_iter_bh.EigenInput0<T>().data());
+        ConstEigenVectorArrayMap<EigenT> input_0_vec_map(input_0, num_elements);
+
+        auto* output = reinterpret_cast<EigenT*>(per_iter_bh.OutputEigen<T>().data());
+        EigenVectorArrayMap<EigenT> output_vec_map(output, num_elements);
+
+        output_vec_map = Op::Apply(input_0_vec_map,
+                                   EigenT(per_iter_bh.ScalarInput1<T>().ToFloat()));
+      },
+      [](BroadcastHelper& per_iter_bh) {
+        auto num_elements = per_iter_bh.EigenInput0<T>().rows();
+
+        const auto* input_0 = reinterpret_cast<const EigenT*>(per_iter_bh.EigenInput0<T>().data());
+        ConstEigenVectorArrayMap<EigenT> input_0_vec_map(input_0, num_elements);
+
+        const auto* input_1 = reinterpret_cast<const EigenT*>(per_iter_bh.EigenInput1<T>().data());
+        ConstEigenVectorArrayMap<EigenT> input_1_vec_map(input_1, num_elements);
+
+        auto* output = reinterpret_cast<EigenT*>(per_iter_bh.OutputEigen<T>().data());
+        EigenVectorArrayMap<EigenT> output_vec_map(output, num_elements);
+
+        output_vec_map = Op::Apply(input_0_vec_map, input_1_vec_map);
+      }};
+
+  UntypedBroadcastTwo(context, funcs, 1.0);
+  return Status::OK();
+}
+
+}  // namespace half_binary_internal
+
+template <>
+Status Add<MLFloat16>::Compute(OpKernelContext* context) const {
+  return half_binary_internal::Binary16BitFloat<half_binary_internal::HalfAdd, MLFloat16, Eigen::half>(*context);
+}
+
+template <>
+Status Sub<MLFloat16>::Compute(OpKernelContext* context) const {
+  return half_binary_internal::Binary16BitFloat<half_binary_internal::HalfSub, MLFloat16, Eigen::half>(*context);
+}
+
+template <>
+Status Mul<MLFloat16>::Compute(OpKernelContext* context) const {
+  return half_binary_internal::Binary16BitFloat<half_binary_internal::HalfMul, MLFloat16, Eigen::half>(*context);
+}
+
+template <>
+Status Div<MLFloat16>::Compute(OpKernelContext* context) const {
+  return half_binary_internal::Binary16BitFloat<half_binary_internal::HalfDiv, MLFloat16, Eigen::half>(*context);
+}
+
+template <>
+Status Add<BFloat16>::Compute(OpKernelContext* context) const {
+  return half_binary_internal::Binary16BitFloat<half_binary_internal::HalfAdd, BFloat16, Eigen::bfloat16>(*context);
+}
+
+template <>
+Status Sub<BFloat16>::Compute(OpKernelContext* context) const {
+  return half_binary_internal::Binary16BitFloat<half_binary_internal::HalfSub, BFloat16, Eigen::bfloat16>(*context);
+}
+
+template <>
+Status Mul<BFloat16>::Compute(OpKernelContext* context) const {
+  return half_binary_internal::Binary16BitFloat<half_binary_internal::HalfMul, BFloat16, Eigen::bfloat16>(*context);
+}
+
+template <>
+Status Div<BFloat16>::Compute(OpKernelContext* context) const {
+  return half_binary_internal::Binary16BitFloat<half_binary_internal::HalfDiv, BFloat16, Eigen::bfloat16>(*context);
+}
+
 namespace pow_internal {
 
 template <typename T, typename E>
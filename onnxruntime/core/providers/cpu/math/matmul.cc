@@ -1,19 +1,62 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#include <functional>
+#include <string_view>
+
 #include "core/providers/cpu/math/matmul.h"
 #include "core/providers/cpu/math/gemm_matmul_common.h"
 #include "core/providers/cpu/math/matmul_helper.h"
 #include "core/util/math.h"
 #include "core/util/math_cpuonly.h"
+#ifdef ENABLE_STRIDED_TENSORS
+#include "core/framework/copy.h"
+#include "core/framework/element_type_lists.h"
+#endif
 
 namespace onnxruntime {
 
+#ifdef ENABLE_STRIDED_TENSORS
+namespace {
+
+// Returns true if 'tensor' is a 2-D transposed view over a contiguous buffer, i.e. shape
+// [m, n] with strides [1, m]. Such a view feeds MLAS directly: the underlying buffer is the
+// [n, m] matrix and the transpose is expressed through the gemm's trans flag instead.
+bool Is2DTransposedView(const Tensor& tensor) {
+  if (tensor.IsContiguous() || tensor.Shape().NumDimensions() != 2) {
+    return false;
+  }
+  gsl::span<const int64_t> strides = tensor.Strides();
+  return strides[0] == 1 && strides[1] == tensor.Shape()[0];
+}
+
+// Materialize a contiguous copy of a non-contiguous view the gemm cannot consume in place.
+Status MaterializeContiguous(OpKernelContext* ctx, concurrency::ThreadPool* thread_pool,
+                             const Tensor& src, Tensor& dst) {
+  AllocatorPtr alloc;
+  ORT_RETURN_IF_ERROR(ctx->GetTempSpaceAllocator(&alloc));
+  dst = Tensor(src.DataType(), src.Shape(), alloc);
+  TensorShapeVector dst_strides = StridesForTensor(dst);
+  gsl::span<const int64_t> src_strides_span = src.Strides();
+  TensorShapeVector src_strides(src_strides_span.begin(), src_strides_span.end());
+  return DispatchStridedCopy<element_type_lists::All>(thread_pool, dst, 0, dst_strides, src.Shape(),
+                                                      src, 0, src_strides);
+}
+
+}  // namespace
+
+// With strided tensors enabled the inputs may be non-contiguous permuted views (e.g. produced
+// by a strided Transpose) instead of materialized copies.
+#define MATMUL_FLOAT_CPU_KERNEL_DEF KernelDefBuilder().MayStridedInput(0).MayStridedInput(1)
+#else
+#define MATMUL_FLOAT_CPU_KERNEL_DEF KernelDefBuilder()
+#endif
+
 ONNX_CPU_OPERATOR_VERSIONED_TYPED_KERNEL(
     MatMul,
     1, 8,
     float,
-    KernelDefBuilder().TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+    MATMUL_FLOAT_CPU_KERNEL_DEF.TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
     MatMul<float>);
 
 ONNX_CPU_OPERATOR_VERSIONED_TYPED_KERNEL(
@@ -29,7 +72,7 @@ ONNX_CPU_OPERATOR_VERSIONED_TYPED_KERNEL(
     9,
     12,
     float,
-    KernelDefBuilder().TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+    MATMUL_FLOAT_CPU_KERNEL_DEF.TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
     MatMul<float>);
 
 ONNX_CPU_OPERATOR_VERSIONED_TYPED_KERNEL(
@@ -62,7 +105,7 @@ ONNX_CPU_OPERATOR_TYPED_KERNEL(
     MatMul,
     13,
     float,
-    KernelDefBuilder().TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+    MATMUL_FLOAT_CPU_KERNEL_DEF.TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
     MatMul<float>);
 
 ONNX_CPU_OPERATOR_TYPED_KERNEL(
@@ -88,6 +131,8 @@ ONNX_CPU_OPERATOR_TYPED_KERNEL(
         .TypeConstraint("T", BuildKernelDefConstraints<int64_t, uint64_t>()),
     MatMul<int64_t>);
 
+#undef MATMUL_FLOAT_CPU_KERNEL_DEF
+
 template <typename T>
 Status MatMul<T>::Compute(OpKernelContext* ctx) const {
   concurrency::ThreadPool* thread_pool = ctx->GetOperatorThreadPool();
@@ -133,7 +178,7 @@ Status MatMul<T>::Compute(OpKernelContext* ctx) const {
 
   return Status::OK();
 }
-#if defined(__aarch64__) && defined(__linux__)
+#if (defined(__aarch64__) || defined(__x86_64__)) && defined(__linux__)
 bool GemmPackBBfloat16(AllocatorPtr& alloc,
                        const Tensor& tensor_b,
                        bool trans_b,
@@ -180,7 +225,7 @@ Status MatMul<float>::PrePack(const Tensor& tensor, int input_idx, /*out*/ Alloc
   // only pack Matrix B
   if (input_idx == 1) {
     size_t packed_b_size;
-#if defined(__aarch64__) && defined(__linux__)
+#if (defined(__aarch64__) || defined(__x86_64__)) && defined(__linux__)
     size_t dim1 = 0;
     size_t dim2 = 0;
     TensorShape b_shape = tensor.Shape();
@@ -220,19 +265,131 @@ Status MatMul<float>::UseSharedPrePackedBuffers(std::vector<BufferUniquePtr>& pr
   return Status::OK();
 }
 
+Status MatMul<float>::UseSavedPrePackedBuffers(const Tensor& tensor, int input_idx,
+                                               std::vector<BufferUniquePtr>& prepacked_buffers,
+                                               /*out*/ bool& used_saved_buffers) {
+  used_saved_buffers = false;
+
+  // PrePack() only ever packs a 2-D B matrix and records the shape it packed for.
+  // Since PrePack() is skipped when the packed buffer comes from the model, re-derive
+  // the shape from the initializer here.
+  if (input_idx == 1 && prepacked_buffers.size() == 1 && tensor.Shape().NumDimensions() == 2) {
+    used_saved_buffers = true;
+    b_shape_ = tensor.Shape();
+    packed_b_ = std::move(prepacked_buffers[0]);
+  }
+
+  return Status::OK();
+}
+
+Status MatMul<float>::GetOrCreateShapePlan(const TensorShape& a_shape, const TensorShape& b_shape,
+                                           bool trans_a, bool trans_b,
+                                           /*out*/ std::shared_ptr<const ShapePlan>& plan) const {
+  {
+    std::lock_guard<std::mutex> lock(plan_mutex_);
+    if (cached_plan_ && cached_plan_->trans_a == trans_a && cached_plan_->trans_b == trans_b &&
+        cached_plan_->a_shape == a_shape && cached_plan_->b_shape == b_shape) {
+      plan = cached_plan_;
+      return Status::OK();
+    }
+  }
+
+  auto new_plan = std::make_shared<ShapePlan>();
+  new_plan->a_shape = a_shape;
+  new_plan->b_shape = b_shape;
+  new_plan->trans_a = trans_a;
+  new_plan->trans_b = trans_b;
+  ORT_RETURN_IF_ERROR(new_plan->helper.Compute(a_shape, b_shape, trans_a, trans_b, trans_batch_a_, trans_batch_b_));
+  plan = std::move(new_plan);
+
+  std::lock_guard<std::mutex> lock(plan_mutex_);
+  cached_plan_ = plan;
+  return Status::OK();
+}
+
+Status MatMul<float>::GetOrCreateRuntimePackedB(const Tensor& b, bool trans_b,
+                                                /*out*/ std::shared_ptr<const RuntimePackedB>& packed) const {
+  packed = nullptr;
+
+  const uint64_t content_hash = std::hash<std::string_view>{}(
+      std::string_view(static_cast<const char*>(b.DataRaw()), b.SizeInBytes()));
+
+  {
+    std::lock_guard<std::mutex> lock(runtime_pack_mutex_);
+    if (cached_runtime_packed_b_ && cached_runtime_packed_b_->source_data == b.DataRaw() &&
+        cached_runtime_packed_b_->trans_b == trans_b &&
+        cached_runtime_packed_b_->source_shape == b.Shape() &&
+        cached_runtime_packed_b_->content_hash == content_hash) {
+      packed = cached_runtime_packed_b_;
+      return Status::OK();
+    }
+  }
+
+  AllocatorPtr alloc = Info().GetAllocator(OrtMemTypeDefault);
+  ORT_RETURN_IF(alloc == nullptr, "Failed to get an allocator for the runtime packed B cache.");
+
+  auto new_entry = std::make_shared<RuntimePackedB>();
+  size_t packed_b_size = 0;
+  TensorShape packed_b_shape;
+  if (!GemmPackBFp32(alloc, b, trans_b, new_entry->packed, packed_b_size, packed_b_shape)) {
+    // MLAS declined to pack this shape; the caller falls back to the unpacked gemm.
+    return Status::OK();
+  }
+
+  new_entry->source_data = b.DataRaw();
+  new_entry->source_shape = b.Shape();
+  new_entry->trans_b = trans_b;
+  new_entry->content_hash = content_hash;
+  packed = std::move(new_entry);
+
+  std::lock_guard<std::mutex> lock(runtime_pack_mutex_);
+  cached_runtime_packed_b_ = packed;
+  return Status::OK();
+}
+
 Status MatMul<float>::Compute(OpKernelContext* ctx) const {
   concurrency::ThreadPool* thread_pool = ctx->GetOperatorThreadPool();
 
   const Tensor* a = ctx->Input<Tensor>(0);
   const Tensor* b = packed_b_ ? nullptr : ctx->Input<Tensor>(1);
-  const auto& b_shape = b ? b->Shape() : b_shape_;
+  TensorShape a_shape = a->Shape();
+  TensorShape b_shape = b ? b->Shape() : b_shape_;
 
   // match CUDA kernel implementation, ignore transpose for vectors
-  const bool trans_a = trans_a_attr_ && a->Shape().NumDimensions() != 1;
-  const bool trans_b = trans_b_attr_ && b_shape.NumDimensions() != 1;
+  bool trans_a = trans_a_attr_ && a_shape.NumDimensions() != 1;
+  bool trans_b = trans_b_attr_ && b_shape.NumDimensions() != 1;
+
+#ifdef ENABLE_STRIDED_TENSORS
+  // The kernel def declares MayStridedInput for both inputs, so either may arrive as a
+  // non-contiguous permuted view. A 2-D transposed view costs nothing: work on the underlying
+  // contiguous matrix and fold the permutation into the gemm's trans flag. Any other view is
+  // materialized, which still only pays the copy the eliminated Transpose node would have done.
+  Tensor a_materialized, b_materialized;
+  bool b_is_temporary = false;
+  if (a != nullptr && !a->IsContiguous()) {
+    if (Is2DTransposedView(*a)) {
+      a_shape = TensorShape({a_shape[1], a_shape[0]});
+      trans_a = !trans_a;
+    } else {
+      ORT_RETURN_IF_ERROR(MaterializeContiguous(ctx, thread_pool, *a, a_materialized));
+      a = &a_materialized;
+    }
+  }
+  if (b != nullptr && !b->IsContiguous()) {
+    if (Is2DTransposedView(*b)) {
+      b_shape = TensorShape({b_shape[1], b_shape[0]});
+      trans_b = !trans_b;
+    } else {
+      ORT_RETURN_IF_ERROR(MaterializeContiguous(ctx, thread_pool, *b, b_materialized));
+      b = &b_materialized;
+      b_is_temporary = true;
+    }
+  }
+#endif
 
-  MatMulComputeHelper helper;
-  ORT_RETURN_IF_ERROR(helper.Compute(a->Shape(), b_shape, trans_a, trans_b, trans_batch_a_, trans_batch_b_));
+  std::shared_ptr<const ShapePlan> plan;
+  ORT_RETURN_IF_ERROR(GetOrCreateShapePlan(a_shape, b_shape, trans_a, trans_b, plan));
+  const MatMulComputeHelper& helper = plan->helper;
   Tensor* y = ctx->Output(0, helper.OutputShape());
 
   // Bail out early if the output is going to be empty
@@ -258,8 +415,29 @@ Status MatMul<float>::Compute(OpKernelContext* ctx) const {
   const size_t K = static_cast<size_t>(helper.K());
   const size_t lda = helper.Lda(trans_a);
   const size_t ldb = helper.Ldb(trans_b);
-#if defined(__aarch64__) && defined(__linux__)
-  if (use_fastmath_mode_ && !trans_b && ((N * K) >= kFastMathModeKernelsizeThreshold)) {
+
+  // Opt-in cache of the packed copy of a runtime B. Restricted to a contiguous 2-D input B
+  // (all batches then read the same packed matrix, mirroring the constant-initializer prepack)
+  // and to the sgemm path, whose packed layout GemmPackBFp32 produces.
+  std::shared_ptr<const RuntimePackedB> runtime_packed_b;
+  if (cache_runtime_packed_b_ && !packed_b_ && b != nullptr && b->Shape().NumDimensions() == 2) {
+    bool cacheable = true;
+#ifdef ENABLE_STRIDED_TENSORS
+    cacheable = !b_is_temporary && b->IsContiguous();
+#endif
+#if (defined(__aarch64__) || defined(__x86_64__)) && defined(__linux__)
+    // the bf16 fastmath path below uses a different packed layout
+    cacheable = cacheable && !(use_fastmath_mode_ && !trans_a && !trans_b &&
+                               ((N * K) >= kFastMathModeKernelsizeThreshold));
+#endif
+    if (cacheable) {
+      ORT_RETURN_IF_ERROR(GetOrCreateRuntimePackedB(*b, trans_b, runtime_packed_b));
+    }
+  }
+
+#if (defined(__aarch64__) || defined(__x86_64__)) && defined(__linux__)
+  // MlasSBGemmBatch has no transpose support, so both operands must be in standard layout.
+  if (use_fastmath_mode_ && !trans_a && !trans_b && ((N * K) >= kFastMathModeKernelsizeThreshold)) {
     std::vector<MLAS_SBGEMM_DATA_PARAMS> data(max_len);
     for (size_t i = 0; i < max_len; i++) {
       data[i].BIsfp32 = !(bool(packed_b_));
@@ -277,12 +455,16 @@ Status MatMul<float>::Compute(OpKernelContext* ctx) const {
   } else
 #endif
   {
+    const float* packed_data = packed_b_ ? static_cast<const float*>(packed_b_.get())
+                               : runtime_packed_b
+                                   ? static_cast<const float*>(runtime_packed_b->packed.get())
+                                   : nullptr;
     std::vector<MLAS_SGEMM_DATA_PARAMS> data(max_len);
     for (size_t i = 0; i < max_len; i++) {
-      data[i].BIsPacked = bool(packed_b_);
+      data[i].BIsPacked = packed_data != nullptr;
       data[i].A = a_data + helper.LeftOffsets()[i];
       data[i].lda = lda;
-      data[i].B = data[i].BIsPacked ? (float*)packed_b_.get() : b_data + helper.RightOffsets()[i];
+      data[i].B = data[i].BIsPacked ? packed_data : b_data + helper.RightOffsets()[i];
       data[i].ldb = ldb;
       data[i].C = y_data + helper.OutputOffsets()[i];
       data[i].ldc = N;
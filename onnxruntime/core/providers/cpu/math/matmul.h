@@ -3,8 +3,12 @@
 
 #pragma once
 
+#include <memory>
+#include <mutex>
+
 #include "core/framework/op_kernel.h"
 #include "core/mlas/inc/mlas.h"
+#include "core/providers/cpu/math/matmul_helper.h"
 #include "core/session/onnxruntime_session_options_config_keys.h"
 
 namespace onnxruntime {
@@ -30,10 +34,17 @@ class MatMul<float> final : public OpKernel {
     trans_batch_a_ = trans_batch_a_attr != 0;
     trans_batch_b_ = trans_batch_b_attr != 0;
 
-#if defined(__aarch64__) && defined(__linux__)
+#if (defined(__aarch64__) || defined(__x86_64__)) && defined(__linux__)
+#if defined(__aarch64__)
     auto config_ops = info.GetConfigOptions().GetConfigEntry(kOrtSessionOptionsMlasGemmFastMathArm64Bfloat16);
+#else
+    auto config_ops = info.GetConfigOptions().GetConfigEntry(kOrtSessionOptionsMlasGemmFastMathAmxBfloat16);
+#endif
     use_fastmath_mode_ = (config_ops == "1") && MlasBf16AccelerationSupported();
 #endif
+
+    cache_runtime_packed_b_ =
+        info.GetConfigOptions().GetConfigEntry(kOrtSessionOptionsMatMulRuntimePackedBCache) == "1";
   }
 
   Status PrePack(const Tensor& tensor, int input_idx, AllocatorPtr alloc,
@@ -43,9 +54,55 @@ class MatMul<float> final : public OpKernel {
   Status UseSharedPrePackedBuffers(std::vector<BufferUniquePtr>& prepacked_buffers, int input_idx,
                                    /*out*/ bool& used_shared_buffers) override;
 
+  Status UseSavedPrePackedBuffers(const Tensor& tensor, int input_idx,
+                                  std::vector<BufferUniquePtr>& prepacked_buffers,
+                                  /*out*/ bool& used_saved_buffers) override;
+
   Status Compute(OpKernelContext* context) const override;
 
  private:
+  // Shape-dependent preparation for one pair of input shapes: output shape, leading dimensions
+  // and batch offsets computed by MatMulComputeHelper. For nodes whose shapes are constant
+  // across runs (the common case for the small hot matmuls) the plan of the previous run is
+  // reused, so Compute only pays the gemm itself instead of re-deriving the broadcast offsets
+  // every time. Guarded by a mutex because the kernel instance is shared between concurrent
+  // Run calls, same as the shape-keyed algo/state cache of the CUDA Conv kernel; the snapshot
+  // is immutable once published so it is used outside the lock.
+  struct ShapePlan {
+    TensorShape a_shape;
+    TensorShape b_shape;
+    bool trans_a;
+    bool trans_b;
+    MatMulComputeHelper helper;
+  };
+
+  Status GetOrCreateShapePlan(const TensorShape& a_shape, const TensorShape& b_shape,
+                              bool trans_a, bool trans_b,
+                              /*out*/ std::shared_ptr<const ShapePlan>& plan) const;
+
+  mutable std::mutex plan_mutex_;
+  mutable std::shared_ptr<const ShapePlan> cached_plan_;
+
+  // Packed copy of a runtime (non-initializer) 2-D B matrix, reused across runs while the
+  // source is unchanged so repeated gemms against a stable matrix skip MLAS's per-call pack.
+  // Opt-in via kOrtSessionOptionsMatMulRuntimePackedBCache since unchanged runs still pay a
+  // hashing pass over B to validate the entry. Published like the shape plan above: immutable
+  // snapshot behind a mutex, usable outside the lock by concurrent Run calls.
+  struct RuntimePackedB {
+    const void* source_data;
+    TensorShape source_shape;
+    bool trans_b;
+    uint64_t content_hash;
+    IAllocatorUniquePtr<void> packed;
+  };
+
+  Status GetOrCreateRuntimePackedB(const Tensor& b, bool trans_b,
+                                   /*out*/ std::shared_ptr<const RuntimePackedB>& packed) const;
+
+  mutable std::mutex runtime_pack_mutex_;
+  mutable std::shared_ptr<const RuntimePackedB> cached_runtime_packed_b_;
+  bool cache_runtime_packed_b_{false};
+
   TensorShape b_shape_;
   IAllocatorUniquePtr<void> packed_b_;
 
@@ -56,7 +113,7 @@ class MatMul<float> final : public OpKernel {
   bool trans_batch_a_;
   bool trans_batch_b_;
 
-#if defined(__aarch64__) && defined(__linux__)
+#if (defined(__aarch64__) || defined(__x86_64__)) && defined(__linux__)
   // fastmath mode state
   bool use_fastmath_mode_;
   // sbgemm kernel is implemented as 8x8 blocks with weights pre-packed to 4 blocks of 4x2
@@ -24,6 +24,7 @@
 #include <cmath>
 #include <gsl/gsl>
 
+#include "core/platform/threadpool.h"
 #include "core/util/math.h"
 #include "core/util/math_cpuonly.h"
 #include "core/mlas/inc/mlas.h"
@@ -103,4 +104,100 @@ common::Status SoftmaxCPU<float>(size_t N,
   return Status::OK();
 }
 
+template <>
+common::Status SoftmaxCPU<MLFloat16>(size_t N,
+                                     size_t D,
+                                     const MLFloat16* Xdata,
+                                     MLFloat16* Ydata,
+                                     bool logarithmic,
+                                     onnxruntime::concurrency::ThreadPool* thread_pool) {
+  if (N * D > INT32_MAX || N > INT32_MAX || D > INT32_MAX) {
+    std::ostringstream ss;
+    ss << "SoftmaxCPU inputs N, D and N * D must be < " << INT32_MAX << ". N=" << N << ", D=" << D;
+    std::string msg = ss.str();
+
+    return Status(common::ONNXRUNTIME, common::INVALID_ARGUMENT, msg);
+  }
+
+  // MLAS only implements the float softmax, so process a block of rows at a time: convert the
+  // block to fp32, run the float softmax on it in place and convert the result back. The fp32
+  // intermediate stays cache resident, unlike Cast nodes inserted around the op at the graph
+  // level, which stream full fp32 copies of the tensor through memory.
+  constexpr size_t rows_per_block = 16;
+  const ptrdiff_t block_count = static_cast<ptrdiff_t>((N + rows_per_block - 1) / rows_per_block);
+  const double bytes_per_block = static_cast<double>(rows_per_block * D * sizeof(float));
+
+  concurrency::ThreadPool::TryParallelFor(
+      thread_pool, block_count,
+      TensorOpCost{bytes_per_block, bytes_per_block, static_cast<double>(rows_per_block * D)},
+      [&](ptrdiff_t begin, ptrdiff_t end) {
+        std::vector<float> block(rows_per_block * D);
+        for (ptrdiff_t i = begin; i != end; ++i) {
+          const size_t row_start = static_cast<size_t>(i) * rows_per_block;
+          const size_t rows = std::min(rows_per_block, N - row_start);
+          MlasConvertHalfToFloatBuffer(Xdata + row_start * D, block.data(), rows * D);
+          MlasComputeSoftmax(block.data(), block.data(), rows, D, logarithmic, false, nullptr);
+          MlasConvertFloatToHalfBuffer(block.data(), Ydata + row_start * D, rows * D);
+        }
+      });
+
+  return Status::OK();
+}
+
+namespace {
+// MLAS has no bf16 conversion helpers, so convert with plain loops over the underlying bits.
+// Widening is a 16 bit shift and narrowing goes through the BFloat16 constructor's
+// round-to-nearest-even; both compile to straight line code the vectorizer handles.
+void ConvertBFloat16ToFloatBuffer(const BFloat16* src, float* dst, size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    dst[i] = src[i].ToFloat();
+  }
+}
+
+void ConvertFloatToBFloat16Buffer(const float* src, BFloat16* dst, size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    dst[i] = BFloat16(src[i]);
+  }
+}
+}  // namespace
+
+template <>
+common::Status SoftmaxCPU<BFloat16>(size_t N,
+                                    size_t D,
+                                    const BFloat16* Xdata,
+                                    BFloat16* Ydata,
+                                    bool logarithmic,
+                                    onnxruntime::concurrency::ThreadPool* thread_pool) {
+  if (N * D > INT32_MAX || N > INT32_MAX || D > INT32_MAX) {
+    std::ostringstream ss;
+    ss << "SoftmaxCPU inputs N, D and N * D must be < " << INT32_MAX << ". N=" << N << ", D=" << D;
+    std::string msg = ss.str();
+
+    return Status(common::ONNXRUNTIME, common::INVALID_ARGUMENT, msg);
+  }
+
+  // Same block scheme as the fp16 specialization above: convert a block of rows to fp32, run the
+  // MLAS float softmax in place and convert back, keeping the fp32 intermediate cache resident.
+  // All accumulation (max, sum, division) therefore happens in fp32.
+  constexpr size_t rows_per_block = 16;
+  const ptrdiff_t block_count = static_cast<ptrdiff_t>((N + rows_per_block - 1) / rows_per_block);
+  const double bytes_per_block = static_cast<double>(rows_per_block * D * sizeof(float));
+
+  concurrency::ThreadPool::TryParallelFor(
+      thread_pool, block_count,
+      TensorOpCost{bytes_per_block, bytes_per_block, static_cast<double>(rows_per_block * D)},
+      [&](ptrdiff_t begin, ptrdiff_t end) {
+        std::vector<float> block(rows_per_block * D);
+        for (ptrdiff_t i = begin; i != end; ++i) {
+          const size_t row_start = static_cast<size_t>(i) * rows_per_block;
+          const size_t rows = std::min(rows_per_block, N - row_start);
+          ConvertBFloat16ToFloatBuffer(Xdata + row_start * D, block.data(), rows * D);
+          MlasComputeSoftmax(block.data(), block.data(), rows, D, logarithmic, false, nullptr);
+          ConvertFloatToBFloat16Buffer(block.data(), Ydata + row_start * D, rows * D);
+        }
+      });
+
+  return Status::OK();
+}
+
 }  // namespace onnxruntime
@@ -117,6 +117,42 @@ static void HeapifyIthPosition(int64_t* heap, size_t i, size_t k, const HeapCmp&
   }
 }
 
+// Writes the top k elements held in the heap in 'indices' (see HeapifyIthPosition) to the output
+// maps for row 'i' and intra-block offset 'j'. Sorted extraction pops the heap so it consumes it.
+template <class Comparator>
+static void WriteTopKFromHeap(int64_t* indices, const Comparator& comparer,
+                              const typename Comparator::DataType* input_data,
+                              const unsigned k, bool sorted,
+                              int64_t row_offset, int64_t block_slice, int64_t j, std::ptrdiff_t i,
+                              EigenMatrixMapRowMajor<typename Comparator::DataType>& values_map,
+                              EigenMatrixMapRowMajor<int64_t>& indices_map) {
+  if (sorted) {
+    // Extract these k elements and place them in the results placeholder
+    for (int64_t l = 0; l < k; ++l) {
+      auto idx = indices[0];
+      auto col_index = (k - l - 1) * block_slice + j;
+      values_map(i, onnxruntime::narrow<size_t>(col_index)) = input_data[idx];
+      // convert overall index to result index. avoid '/' if possible for perf reasons
+      indices_map(i, onnxruntime::narrow<size_t>(col_index)) = block_slice == 1 ? (idx - row_offset - j)
+                                                                                : (idx - row_offset - j) / block_slice;
+
+      // put the last value at the top of the heap to replace the removed one, and push it into
+      // place in a heap one smaller.
+      indices[0] = indices[k - SafeInt<size_t>(l) - 1];
+      HeapifyIthPosition(indices, 0, k - SafeInt<size_t>(l) - 1, comparer);
+    }
+  } else {
+    for (int64_t l = 0; l < k; ++l) {
+      int64_t idx = indices[l];
+      auto col_index = l * block_slice + j;
+      values_map(i, onnxruntime::narrow<size_t>(col_index)) = input_data[idx];
+      // convert overall index to result index. avoid '/' if possible for perf reasons
+      indices_map(i, onnxruntime::narrow<size_t>(col_index)) = block_slice == 1 ? (idx - row_offset - j)
+                                                                                : (idx - row_offset - j) / block_slice;
+    }
+  }
+}
+
 // Static helpers that implement the core logic for each of the 'TopK' operator flavor
 
 // Selects the top k elements (largest or smallest based on template parameter)
@@ -179,6 +215,13 @@ static void FindTopKElements(const Tensor* input, const TensorShape& input_shape
   //            k = [ 1, 2, 4, 6, 8, 16, 24, 32, 48, 64, 128 ]
   bool use_priority_queue = k != 1 && (k < 4 || (std::log2(k) / std::log2(num_blocks)) < 0.725);
 
+  // For contiguous rows that dwarf k (e.g. vocabulary sized logits) most elements never enter the
+  // heap, so scan in fixed-size blocks: the best value of a block is computed with a branchless
+  // reduction the compiler vectorizes, and only blocks whose best would enter the current top k
+  // are rescanned element by element. Everything else is skipped without per-element branching.
+  constexpr int64_t kFilterBlockSize = 256;
+  bool use_filtered_scan = use_priority_queue && block_slice == 1 && num_blocks >= 4 * kFilterBlockSize;
+
   std::function<void(std::ptrdiff_t batch)> find_top_k;
 
   if (k == 1) {
@@ -214,6 +257,57 @@ static void FindTopKElements(const Tensor* input, const TensorShape& input_shape
             }
           }
         };
+  } else if (use_filtered_scan) {
+    find_top_k =
+        [num_threads, rows, num_blocks, k, sorted,
+         input_data, cols, &values_map, &indices_map](std::ptrdiff_t batch) {
+          auto work = concurrency::ThreadPool::PartitionWork(batch, onnxruntime::narrow<size_t>(num_threads), onnxruntime::narrow<size_t>(rows));
+          Comparator comparer(input_data);
+
+          std::vector<int64_t> indices_data(k);
+          int64_t* indices = indices_data.data();  // raw pointer is slightly faster for HeapifyIthPosition
+
+          for (auto i = work.start; i < work.end; ++i) {
+            const auto row_offset = i * cols;
+            const auto* row_data = input_data + row_offset;
+
+            // add first k items starting from the bottom up
+            for (int64_t l = 0; l < k; ++l) {
+              indices[k - l - 1] = row_offset + l;
+              HeapifyIthPosition(indices, k - SafeInt<size_t>(l) - 1, k, comparer);
+            }
+
+            // save top so we only have one load in the CompareValueOnly calls
+            auto top = input_data[indices[0]];
+            for (int64_t block_start = k; block_start < num_blocks; block_start += kFilterBlockSize) {
+              const int64_t block_end = std::min(block_start + kFilterBlockSize, num_blocks);
+
+              // branchless best-of-block reduction, vectorizable as a min/max over the block
+              auto block_best = row_data[block_start];
+              for (int64_t l = block_start + 1; l < block_end; ++l) {
+                auto cur_value = row_data[l];
+                block_best = comparer.CompareValueOnly(cur_value, block_best) ? cur_value : block_best;
+              }
+
+              // nothing in this block beats the current worst top k value, so the whole block is
+              // skipped. an element equal to 'top' can't replace it either as its index is higher.
+              if (!comparer.CompareValueOnly(block_best, top))
+                continue;
+
+              for (int64_t l = block_start; l < block_end; ++l) {
+                if (comparer.CompareValueOnly(row_data[l], top)) {
+                  indices[0] = row_offset + l;
+                  HeapifyIthPosition(indices, 0, k, comparer);
+                  top = input_data[indices[0]];
+                }
+              }
+            }
+
+            WriteTopKFromHeap(indices, comparer, input_data, k, sorted,
+                              row_offset, /*block_slice*/ 1, /*inter_block_offset*/ 0, i,
+                              values_map, indices_map);
+          }
+        };
   } else if (use_priority_queue) {
     find_top_k =
         [num_threads, rows, block_slice, num_blocks, k, sorted,
@@ -256,31 +350,8 @@ static void FindTopKElements(const Tensor* input, const TensorShape& input_shape
                 cur_idx += block_slice;
               }
 
-              if (sorted) {
-                // Extract these k elements and place them in the results placeholder
-                for (l = 0; l < k; ++l) {
-                  auto idx = indices[0];
-                  auto col_index = (k - l - 1) * block_slice + j;
-                  values_map(i, onnxruntime::narrow<size_t>(col_index)) = input_data[idx];
-                  // convert overall index to result index. avoid '/' if possible for perf reasons
-                  indices_map(i, onnxruntime::narrow<size_t>(col_index)) = block_slice == 1 ? (idx - row_offset - j)
-                                                                                            : (idx - row_offset - j) / block_slice;
-
-                  // put the last value at the top of the heap to replace the removed one, and push it into
-                  // place in a heap one smaller.
-                  indices[0] = indices[k - SafeInt<size_t>(l) - 1];
-                  HeapifyIthPosition(indices, 0, k - SafeInt<size_t>(l) - 1, comparer);
-                }
-              } else {
-                for (l = 0; l < k; ++l) {
-                  int64_t idx = indices[l];
-                  auto col_index = l * block_slice + j;
-                  values_map(i, onnxruntime::narrow<size_t>(col_index)) = input_data[idx];
-                  // convert overall index to result index. avoid '/' if possible for perf reasons
-                  indices_map(i, onnxruntime::narrow<size_t>(col_index)) = block_slice == 1 ? (idx - row_offset - j)
-                                                                                            : (idx - row_offset - j) / block_slice;
-                }
-              }
+              WriteTopKFromHeap(indices, comparer, input_data, k, sorted, row_offset, block_slice, j, i,
+                                values_map, indices_map);
             }
           }
         };
@@ -39,28 +39,45 @@ class SVMCommon {
     assert(a.size() == size_t(m * k) && b.size() == size_t(k * n) && out.size() == size_t(m * n));
 
     if (kernel_type_ == KERNEL::RBF) {
-      T* cur_out = out.data();
-      const T* cur_batch = a.data();
-
-      // each batch has 'k' features
-      for (int64_t batch = 0; batch < m; ++batch) {
-        const T* cur_support_vector = b.data();
-
-        // broadcast the support vectors against the k features in each batch. output is one value per support vector
-        for (int64_t support_vector = 0; support_vector < n; ++support_vector) {
-          T sum = 0.f;
-          const T* cur_input = cur_batch;
+      // ||x - s||^2 = ||x||^2 - 2 x.s + ||s||^2, so the m x n matrix of cross terms comes from
+      // one GEMM over the whole batch instead of m * n scalar dot products, and the exponential
+      // is applied with a vectorized pass over the result.
+      std::vector<T> row_norms(static_cast<size_t>(m + n));
+      T* a_norms = row_norms.data();
+      T* b_norms = a_norms + m;
+      for (int64_t row = 0; row < m; ++row) {
+        const T* cur = a.data() + row * k;
+        T sum = 0.f;
+        for (int64_t feature = 0; feature < k; ++feature) {
+          sum += cur[feature] * cur[feature];
+        }
+        a_norms[row] = sum;
+      }
+      for (int64_t row = 0; row < n; ++row) {
+        const T* cur = b.data() + row * k;
+        T sum = 0.f;
+        for (int64_t feature = 0; feature < k; ++feature) {
+          sum += cur[feature] * cur[feature];
+        }
+        b_norms[row] = sum;
+      }
 
-          for (int64_t feature = 0; feature < k; ++feature) {
-            T val = *cur_input++ - *cur_support_vector++;
-            sum += val * val;
-          }
+      onnxruntime::Gemm<T>::ComputeGemm(CBLAS_TRANSPOSE::CblasNoTrans, CBLAS_TRANSPOSE::CblasTrans,
+                                        m, n, k,
+                                        1.f, a.data(), b.data(), 0.f,
+                                        nullptr, nullptr,
+                                        out.data(),
+                                        threadpool);
 
-          *cur_out++ = std::exp(-gamma_ * sum);
+      T* cur_out = out.data();
+      for (int64_t batch = 0; batch < m; ++batch) {
+        const T a_norm = a_norms[batch];
+        for (int64_t support_vector = 0; support_vector < n; ++support_vector, ++cur_out) {
+          *cur_out = -gamma_ * (a_norm - 2.f * *cur_out + b_norms[support_vector]);
         }
-
-        cur_batch += k;  // move to start of next batch
       }
+
+      MlasComputeExp(out.data(), out.data(), out.size());
     } else {
       float alpha = 1.f;
       float beta = 1.f;
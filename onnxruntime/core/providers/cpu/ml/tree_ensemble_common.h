@@ -48,6 +48,16 @@ class TreeEnsembleCommon : public TreeEnsembleCommonAttributes {
   std::vector<SparseValue<ThresholdType>> weights_;
   std::vector<TreeNodeElement<ThresholdType>*> roots_;
 
+  // Branch-free evaluation path: every tree padded to a complete binary tree of depth
+  // flat_tree_depth_ and stored breadth-first in structure-of-arrays layout. Built by
+  // TryBuildFlatTrees when the whole ensemble is BRANCH_LEQ without missing-value tracks
+  // and shallow enough; empty otherwise.
+  bool use_flat_trees_{false};
+  int64_t flat_tree_depth_{0};                                      // number of decision levels
+  std::vector<int> flat_feature_ids_;                               // n_trees x (2^depth - 1)
+  std::vector<ThresholdType> flat_thresholds_;                      // n_trees x (2^depth - 1)
+  std::vector<const TreeNodeElement<ThresholdType>*> flat_leaves_;  // n_trees x 2^depth
+
  public:
   TreeEnsembleCommon() {}
 
@@ -83,10 +93,21 @@ class TreeEnsembleCommon : public TreeEnsembleCommonAttributes {
   TreeNodeElement<ThresholdType>* ProcessTreeNodeLeave(TreeNodeElement<ThresholdType>* root,
                                                        const InputType* x_data) const;
 
+  const TreeNodeElement<ThresholdType>& EvaluateTree(size_t tree_index, const InputType* x_data) const;
+
   template <typename AGG>
   void ComputeAgg(concurrency::ThreadPool* ttp, const Tensor* X, Tensor* Y, Tensor* label, const AGG& agg) const;
 
  private:
+  // Padding each tree to a complete binary tree costs 2^depth entries per tree, so the flat
+  // layout is restricted to shallow trees where the padded tables stay small and cacheable.
+  static constexpr int64_t kMaxFlatTreeDepth = 8;
+
+  void TryBuildFlatTrees();
+  int64_t FlatTreeDepth(const TreeNodeElement<ThresholdType>* node, int64_t depth_left) const;
+  void FillFlatTree(const TreeNodeElement<ThresholdType>* node, size_t tree_index, size_t complete_index,
+                    int64_t depth);
+
   size_t AddNodes(const size_t i, const InlinedVector<NODE_MODE>& cmodes, const InlinedVector<size_t>& truenode_ids,
                   const InlinedVector<size_t>& falsenode_ids, const std::vector<int64_t>& nodes_featureids,
                   const std::vector<ThresholdType>& nodes_values_as_tensor, const std::vector<float>& node_values,
@@ -338,9 +359,110 @@ Status TreeEnsembleCommon<InputType, ThresholdType, OutputType>::Init(
     }
   }
 
+  TryBuildFlatTrees();
+
   return Status::OK();
 }
 
+template <typename InputType, typename ThresholdType, typename OutputType>
+int64_t TreeEnsembleCommon<InputType, ThresholdType, OutputType>::FlatTreeDepth(
+    const TreeNodeElement<ThresholdType>* node, int64_t depth_left) const {
+  if (!node->is_not_leaf()) {
+    return 0;
+  }
+  if (depth_left == 0) {
+    // Deeper than the flat layout supports; the exact depth no longer matters.
+    return kMaxFlatTreeDepth + 1;
+  }
+  // The false branch is always the next element in nodes_ (see AddNodes).
+  int64_t false_depth = FlatTreeDepth(node + 1, depth_left - 1);
+  int64_t true_depth = FlatTreeDepth(node->truenode_or_weight.ptr, depth_left - 1);
+  return 1 + std::max(false_depth, true_depth);
+}
+
+template <typename InputType, typename ThresholdType, typename OutputType>
+void TreeEnsembleCommon<InputType, ThresholdType, OutputType>::FillFlatTree(
+    const TreeNodeElement<ThresholdType>* node, size_t tree_index, size_t complete_index, int64_t depth) {
+  const size_t n_internal = (size_t{1} << flat_tree_depth_) - 1;
+  if (depth == flat_tree_depth_) {
+    // Trees are at most flat_tree_depth_ deep, so every node reached at the last level is a leaf.
+    flat_leaves_[tree_index * (n_internal + 1) + complete_index - n_internal] = node;
+    return;
+  }
+  const size_t base = tree_index * n_internal;
+  if (node->is_not_leaf()) {
+    flat_feature_ids_[base + complete_index] = node->feature_id;
+    flat_thresholds_[base + complete_index] = node->value_or_unique_weight;
+    FillFlatTree(node->truenode_or_weight.ptr, tree_index, 2 * complete_index + 1, depth + 1);
+    FillFlatTree(node + 1, tree_index, 2 * complete_index + 2, depth + 1);
+  } else {
+    // Leaf above the last level: pad with a dummy decision whose both subtrees resolve to this
+    // leaf, so the outcome of the comparison does not matter.
+    flat_feature_ids_[base + complete_index] = 0;
+    flat_thresholds_[base + complete_index] = 0;
+    FillFlatTree(node, tree_index, 2 * complete_index + 1, depth + 1);
+    FillFlatTree(node, tree_index, 2 * complete_index + 2, depth + 1);
+  }
+}
+
+template <typename InputType, typename ThresholdType, typename OutputType>
+void TreeEnsembleCommon<InputType, ThresholdType, OutputType>::TryBuildFlatTrees() {
+  use_flat_trees_ = false;
+  flat_tree_depth_ = 0;
+  flat_feature_ids_.clear();
+  flat_thresholds_.clear();
+  flat_leaves_.clear();
+
+  // The flat layout encodes exactly one rule (x <= threshold, NaN goes to the false branch),
+  // which is the shape GBDT converters produce. Everything else keeps the pointer-chasing path.
+  if (n_trees_ == 0 || !same_mode_ || has_missing_tracks_) {
+    return;
+  }
+  for (const auto& node : nodes_) {
+    if (node.is_not_leaf() && node.mode() != NODE_MODE::BRANCH_LEQ) {
+      return;
+    }
+  }
+
+  int64_t depth = 0;
+  for (auto* root : roots_) {
+    int64_t tree_depth = FlatTreeDepth(root, kMaxFlatTreeDepth);
+    if (tree_depth > kMaxFlatTreeDepth) {
+      return;
+    }
+    depth = std::max(depth, tree_depth);
+  }
+
+  flat_tree_depth_ = depth;
+  const size_t n_internal = (size_t{1} << flat_tree_depth_) - 1;
+  flat_feature_ids_.resize(static_cast<size_t>(n_trees_) * n_internal);
+  flat_thresholds_.resize(static_cast<size_t>(n_trees_) * n_internal);
+  flat_leaves_.resize(static_cast<size_t>(n_trees_) * (n_internal + 1));
+  for (size_t tree_index = 0; tree_index < static_cast<size_t>(n_trees_); ++tree_index) {
+    FillFlatTree(roots_[tree_index], tree_index, 0, 0);
+  }
+  use_flat_trees_ = true;
+}
+
+template <typename InputType, typename ThresholdType, typename OutputType>
+const TreeNodeElement<ThresholdType>&
+TreeEnsembleCommon<InputType, ThresholdType, OutputType>::EvaluateTree(size_t tree_index,
+                                                                       const InputType* x_data) const {
+  if (!use_flat_trees_) {
+    return *ProcessTreeNodeLeave(roots_[tree_index], x_data);
+  }
+  const size_t n_internal = (size_t{1} << flat_tree_depth_) - 1;
+  const int* feature_ids = flat_feature_ids_.data() + tree_index * n_internal;
+  const ThresholdType* thresholds = flat_thresholds_.data() + tree_index * n_internal;
+  size_t idx = 0;
+  for (int64_t depth = 0; depth < flat_tree_depth_; ++depth) {
+    // Fixed trip count and heap indexing (children of i at 2i+1/2i+2): the comparison result
+    // feeds the index arithmetic directly instead of a hard-to-predict branch per node.
+    idx = 2 * idx + 1 + static_cast<size_t>(!(x_data[feature_ids[idx]] <= thresholds[idx]));
+  }
+  return *flat_leaves_[tree_index * (n_internal + 1) + idx - n_internal];
+}
+
 template <typename InputType, typename ThresholdType, typename OutputType>
 size_t TreeEnsembleCommon<InputType, ThresholdType, OutputType>::AddNodes(
     const size_t i, const InlinedVector<NODE_MODE>& cmodes, const InlinedVector<size_t>& truenode_ids,
@@ -460,7 +582,7 @@ void TreeEnsembleCommon<InputType, ThresholdType, OutputType>::ComputeAgg(concur
       ScoreValue<ThresholdType> score = {0, 0};
       if (n_trees_ <= parallel_tree_ || max_num_threads == 1) { /* section A: 1 output, 1 row and not enough trees to parallelize */
         for (int64_t j = 0; j < n_trees_; ++j) {
-          agg.ProcessTreeNodePrediction1(score, *ProcessTreeNodeLeave(roots_[onnxruntime::narrow<size_t>(j)], x_data));
+          agg.ProcessTreeNodePrediction1(score, EvaluateTree(onnxruntime::narrow<size_t>(j), x_data));
         }
       } else { /* section B: 1 output, 1 row and enough trees to parallelize */
         std::vector<ScoreValue<ThresholdType>> scores(onnxruntime::narrow<size_t>(n_trees_), {0, 0});
@@ -468,7 +590,7 @@ void TreeEnsembleCommon<InputType, ThresholdType, OutputType>::ComputeAgg(concur
             ttp,
             SafeInt<int32_t>(n_trees_),
             [this, &scores, &agg, x_data](ptrdiff_t j) {
-              agg.ProcessTreeNodePrediction1(scores[j], *ProcessTreeNodeLeave(roots_[j], x_data));
+              agg.ProcessTreeNodePrediction1(scores[j], EvaluateTree(static_cast<size_t>(j), x_data));
             },
             max_num_threads);
 
@@ -499,7 +621,7 @@ void TreeEnsembleCommon<InputType, ThresholdType, OutputType>::ComputeAgg(concur
         }
         for (j = 0; j < static_cast<size_t>(n_trees_); ++j) {
           for (i = batch; i < batch_end; ++i) {
-            agg.ProcessTreeNodePrediction1(scores[SafeInt<ptrdiff_t>(i - batch)], *ProcessTreeNodeLeave(roots_[j], x_data + i * stride));
+            agg.ProcessTreeNodePrediction1(scores[SafeInt<ptrdiff_t>(i - batch)], EvaluateTree(j, x_data + i * stride));
           }
         }
         for (i = batch; i < batch_end; ++i) {
@@ -524,7 +646,7 @@ void TreeEnsembleCommon<InputType, ThresholdType, OutputType>::ComputeAgg(concur
               for (auto j = work.start; j < work.end; ++j) {
                 for (int64_t i = begin_n; i < end_n; ++i) {
                   agg.ProcessTreeNodePrediction1(scores[batch_num * SafeInt<ptrdiff_t>(N) + i],
-                                                 *ProcessTreeNodeLeave(roots_[j], x_data + i * stride));
+                                                 EvaluateTree(static_cast<size_t>(j), x_data + i * stride));
                 }
               }
             });
@@ -550,7 +672,7 @@ void TreeEnsembleCommon<InputType, ThresholdType, OutputType>::ComputeAgg(concur
           [this, &agg, x_data, z_data, stride, label_data](ptrdiff_t i) {
             ScoreValue<ThresholdType> score = {0, 0};
             for (size_t j = 0; j < static_cast<size_t>(n_trees_); ++j) {
-              agg.ProcessTreeNodePrediction1(score, *ProcessTreeNodeLeave(roots_[j], x_data + i * stride));
+              agg.ProcessTreeNodePrediction1(score, EvaluateTree(j, x_data + i * stride));
             }
 
             agg.FinalizeScores1(z_data + i, score,
@@ -563,7 +685,7 @@ void TreeEnsembleCommon<InputType, ThresholdType, OutputType>::ComputeAgg(concur
       if (n_trees_ <= parallel_tree_ || max_num_threads == 1) { /* section A2 */
         InlinedVector<ScoreValue<ThresholdType>> scores(onnxruntime::narrow<size_t>(n_targets_or_classes_), {0, 0});
         for (int64_t j = 0; j < n_trees_; ++j) {
-          agg.ProcessTreeNodePrediction(scores, *ProcessTreeNodeLeave(roots_[onnxruntime::narrow<size_t>(j)], x_data), weights_);
+          agg.ProcessTreeNodePrediction(scores, EvaluateTree(onnxruntime::narrow<size_t>(j), x_data), weights_);
         }
         agg.FinalizeScores(scores, z_data, -1, label_data);
       } else { /* section B2: 2+ outputs, 1 row, enough trees to parallelize */
@@ -576,7 +698,7 @@ void TreeEnsembleCommon<InputType, ThresholdType, OutputType>::ComputeAgg(concur
               scores[batch_num].resize(onnxruntime::narrow<size_t>(n_targets_or_classes_), {0, 0});
               auto work = concurrency::ThreadPool::PartitionWork(batch_num, num_threads, onnxruntime::narrow<size_t>(n_trees_));
               for (auto j = work.start; j < work.end; ++j) {
-                agg.ProcessTreeNodePrediction(scores[batch_num], *ProcessTreeNodeLeave(roots_[j], x_data), weights_);
+                agg.ProcessTreeNodePrediction(scores[batch_num], EvaluateTree(static_cast<size_t>(j), x_data), weights_);
               }
             });
         for (size_t i = 1, limit = scores.size(); i < limit; ++i) {
@@ -599,7 +721,7 @@ void TreeEnsembleCommon<InputType, ThresholdType, OutputType>::ComputeAgg(concur
         }
         for (j = 0, limit = roots_.size(); j < limit; ++j) {
           for (i = batch; i < batch_end; ++i) {
-            agg.ProcessTreeNodePrediction(scores[SafeInt<ptrdiff_t>(i - batch)], *ProcessTreeNodeLeave(roots_[j], x_data + i * stride), weights_);
+            agg.ProcessTreeNodePrediction(scores[SafeInt<ptrdiff_t>(i - batch)], EvaluateTree(j, x_data + i * stride), weights_);
           }
         }
         for (i = batch; i < batch_end; ++i) {
@@ -625,7 +747,7 @@ void TreeEnsembleCommon<InputType, ThresholdType, OutputType>::ComputeAgg(concur
               for (auto j = work.start; j < work.end; ++j) {
                 for (int64_t i = begin_n; i < end_n; ++i) {
                   agg.ProcessTreeNodePrediction(scores[batch_num * SafeInt<ptrdiff_t>(N) + i],
-                                                *ProcessTreeNodeLeave(roots_[j], x_data + i * stride), weights_);
+                                                EvaluateTree(static_cast<size_t>(j), x_data + i * stride), weights_);
                 }
               }
             });
@@ -657,7 +779,7 @@ void TreeEnsembleCommon<InputType, ThresholdType, OutputType>::ComputeAgg(concur
             for (auto i = work.start; i < work.end; ++i) {
               std::fill(scores.begin(), scores.end(), ScoreValue<ThresholdType>({0, 0}));
               for (j = 0, limit = roots_.size(); j < limit; ++j) {
-                agg.ProcessTreeNodePrediction(scores, *ProcessTreeNodeLeave(roots_[j], x_data + i * stride), weights_);
+                agg.ProcessTreeNodePrediction(scores, EvaluateTree(j, x_data + i * stride), weights_);
               }
 
               agg.FinalizeScores(scores,
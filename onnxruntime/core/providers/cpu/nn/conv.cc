@@ -17,13 +17,91 @@
 
 #include "core/providers/cpu/nn/conv.h"
 
+#include <sstream>
+
 #include "core/common/narrow.h"
 #include "core/common/safeint.h"
+#include "core/providers/cpu/tunable/cpu_tunable.h"
 #include "core/util/math_cpuonly.h"
 
 namespace onnxruntime {
 using ConvPadVector = ConvAttributes::ConvPadVector;
 
+namespace {
+
+// Parameters for tuning the fp32 convolution algorithm selection. The MLAS parameters have
+// already been prepared with the heuristic algorithm choice; each candidate op replays the
+// convolution with one specific algorithm forced through MlasConvOverrideAlgorithm.
+struct MlasConvAlgoParams : cpu::tunable::OpParams {
+  std::string Signature() const override {
+    const MLAS_CONV_PARAMETERS& p = *prepared;
+    std::ostringstream oss;
+    oss << "N" << p.BatchCount << "_G" << p.GroupCount << "_C" << p.InputChannels << "_M" << p.FilterCount;
+    for (size_t dim = 0; dim < p.Dimensions; ++dim) {
+      oss << "_i" << p.InputShape[dim] << "k" << p.KernelShape[dim] << "d" << p.DilationShape[dim]
+          << "p" << p.Padding[dim] << "q" << p.Padding[dim + p.Dimensions] << "s" << p.StrideShape[dim];
+    }
+    return oss.str();
+  }
+
+  const MLAS_CONV_PARAMETERS* prepared;
+  size_t prepared_working_buffer_size;
+  const float* X;
+  const float* W;
+  const float* Bias;
+  float* Y;
+  AllocatorPtr alloc;
+  concurrency::ThreadPool* thread_pool;
+};
+
+class ConvAlgoTunableOp : public cpu::tunable::TunableOp<MlasConvAlgoParams> {
+ public:
+  ConvAlgoTunableOp() {
+    // Id 0 replays the MlasConvPrepare heuristic choice and doubles as the default when no
+    // tuning result is available. The remaining ids force one algorithm each; their order is
+    // part of the tuning results format and must stay stable.
+    RegisterOp([](const MlasConvAlgoParams* params) {
+      return RunConv(params, *params->prepared, params->prepared_working_buffer_size);
+    });
+
+    for (MLAS_CONV_ALGORITHM algorithm : {MlasConvAlgorithmGemmDirect,
+                                          MlasConvAlgorithmExpandThenGemm,
+                                          MlasConvAlgorithmExpandThenGemmSegmented,
+                                          MlasConvAlgorithmWinograd}) {
+      RegisterOp([algorithm](const MlasConvAlgoParams* params) -> Status {
+        MLAS_CONV_PARAMETERS parameters = *params->prepared;
+        size_t working_buffer_size;
+        TUNABLE_OP_RETURN_UNSUPPORTED_ARGUMENT_IF(
+            !MlasConvOverrideAlgorithm(&parameters, algorithm, &working_buffer_size, params->thread_pool),
+            "algorithm is not viable for this convolution shape");
+        return RunConv(params, parameters, working_buffer_size);
+      });
+    }
+  }
+
+ private:
+  static Status RunConv(const MlasConvAlgoParams* params, const MLAS_CONV_PARAMETERS& parameters,
+                        size_t working_buffer_size) {
+    AllocatorPtr alloc = params->alloc;
+    auto* working_data = working_buffer_size > 0
+                             ? alloc->Alloc(sizeof(float) * SafeInt<size_t>(working_buffer_size))
+                             : nullptr;
+    BufferUniquePtr working_buffer(working_data, BufferDeleter(std::move(alloc)));
+
+    MlasConv(&parameters,
+             params->X,
+             params->W,
+             params->Bias,
+             static_cast<float*>(working_buffer.get()),
+             params->Y,
+             params->thread_pool);
+
+    return Status::OK();
+  }
+};
+
+}  // namespace
+
 template <typename T>
 Status Conv<T>::Compute(OpKernelContext* context) const {
   const auto* X = context->Input<Tensor>(0);
@@ -233,6 +311,36 @@ Status Conv<float>::Compute(OpKernelContext* context) const {
                     Beta,
                     thread_pool);
 
+    // When the optimizer absorbed a chain of elementwise ops rather than a single activation,
+    // point the parameters at the whole chain so MLAS applies every stage per output tile.
+    if (!activation_chain_.empty()) {
+      Parameters.Activation = activation_chain_.data();
+      Parameters.ActivationCount = activation_chain_.size();
+    }
+
+    // When TunableOp is enabled for the CPU execution provider, profile the candidate
+    // algorithms against each other instead of trusting the MlasConvPrepare heuristics. The
+    // Conv/Sum fusion accumulates into the output (Beta != 0), which repeated tuning runs
+    // would corrupt, so it stays on the heuristic path.
+    auto* tuning_ctx = static_cast<cpu::tunable::CpuTuningContext*>(
+        Info().GetExecutionProvider()->GetTuningContext());
+    if (tuning_ctx != nullptr && tuning_ctx->IsTunableOpEnabled() && Beta == 0.0f) {
+      static ConvAlgoTunableOp conv_algo_tunable_op;
+
+      MlasConvAlgoParams params;
+      params.tuning_ctx = tuning_ctx;
+      params.prepared = &Parameters;
+      params.prepared_working_buffer_size = WorkingBufferSize;
+      params.X = Xdata.data();
+      params.W = W->Data<float>();
+      params.Bias = Bdata;
+      params.Y = Ydata.data();
+      params.alloc = alloc;
+      params.thread_pool = thread_pool;
+
+      return conv_algo_tunable_op(&params);
+    }
+
     auto* working_data = WorkingBufferSize > 0 ? alloc->Alloc(sizeof(float) * SafeInt<size_t>(WorkingBufferSize))
                                                : nullptr;
     BufferUniquePtr working_buffer(working_data, BufferDeleter(std::move(alloc)));
@@ -284,7 +392,12 @@ Status Conv<float>::Compute(OpKernelContext* context) const {
             thread_pool);
       }
 
-      MlasActivation(&activation_, Ydata.data(), Bdata, narrow<size_t>(M), narrow<size_t>(output_image_size), narrow<size_t>(output_image_size));
+      if (!activation_chain_.empty()) {
+        MlasActivationChain(activation_chain_.data(), activation_chain_.size(), Ydata.data(), Bdata,
+                            narrow<size_t>(M), narrow<size_t>(output_image_size), narrow<size_t>(output_image_size));
+      } else {
+        MlasActivation(&activation_, Ydata.data(), Bdata, narrow<size_t>(M), narrow<size_t>(output_image_size), narrow<size_t>(output_image_size));
+      }
 
       Xdata = Xdata.subspan(X_offset * conv_attrs_.group);
       Ydata = Ydata.subspan(Y_offset * conv_attrs_.group);
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "core/common/inlined_containers.h"
 #include "core/framework/op_kernel.h"
 #include "core/providers/cpu/nn/conv_attributes.h"
 #include "core/mlas/inc/mlas.h"
@@ -33,6 +34,11 @@ class Conv<float> : public OpKernel {
  protected:
   MLAS_ACTIVATION activation_;
 
+  // Chain of elementwise post operation stages applied to the output in order, set by FusedConv
+  // when the optimizer absorbed more than a single activation. When empty, activation_ is used
+  // on its own as before.
+  InlinedVector<MLAS_ACTIVATION> activation_chain_;
+
   ConvAttributes conv_attrs_;
 };
 
@@ -21,6 +21,11 @@ ORT_FORCEINLINE float ConvertMLFloat16ToDoubleOrFloatIfNeeded<MLFloat16, float>(
   return val.ToFloat();
 }
 
+template <>
+ORT_FORCEINLINE float ConvertMLFloat16ToDoubleOrFloatIfNeeded<BFloat16, float>(BFloat16 val) {
+  return val.ToFloat();
+}
+
 template <>
 ORT_FORCEINLINE double ConvertMLFloat16ToDoubleOrFloatIfNeeded<MLFloat16, double>(MLFloat16 val) {
   return double(ConvertMLFloat16ToDoubleOrFloatIfNeeded<MLFloat16, float>(val));
@@ -45,7 +50,7 @@ ORT_FORCEINLINE constexpr float ConvertToFloatIfNeeded(double val) {
   return gsl::narrow_cast<float>(val);
 }
 
-// Function template that only converts the input value to MLFloat16 if T is MLFloat16.
+// Function template that only converts the input value to MLFloat16/BFloat16 if T is one of them.
 template <typename T>
 ORT_FORCEINLINE constexpr typename std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>, float>
 ConvertToMLFloat16IfNeeded(float val) {
@@ -58,6 +63,12 @@ ConvertToMLFloat16IfNeeded(float val) {
   return MLFloat16(val);
 }
 
+template <typename T>
+ORT_FORCEINLINE constexpr typename std::enable_if_t<std::is_same_v<T, BFloat16>, BFloat16>
+ConvertToMLFloat16IfNeeded(float val) {
+  return BFloat16(val);
+}
+
 template <typename T>
 ORT_FORCEINLINE constexpr double ConvertToMLFloat16IfNeeded(double val) {
   return val;
@@ -203,7 +214,7 @@ struct SrcDispatcher {
 Status LayerNormImpl::Compute(OpKernelContext* p_ctx) const {
   const auto elem_type = p_ctx->Input<Tensor>(0)->GetElementType();
 
-  using SupportedTypeList = boost::mp11::mp_list<float, double, MLFloat16>;
+  using SupportedTypeList = boost::mp11::mp_list<float, double, MLFloat16, BFloat16>;
 
   utils::MLTypeCallDispatcherFromTypeList<SupportedTypeList> t_disp(elem_type);
   return t_disp.InvokeRet<Status, SrcDispatcher>(p_ctx, axis_, epsilon_, simplified_, contrib_op_);
@@ -0,0 +1,233 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#ifndef DISABLE_CONTRIB_OPS
+
+#include <limits>
+
+#include "core/framework/op_kernel.h"
+#include "core/util/math.h"
+#include "core/providers/cpu/nn/pool_attributes.h"
+#include "core/platform/threadpool.h"
+#include "core/common/safeint.h"
+
+namespace onnxruntime {
+
+/**
+ * @brief Pooling operator for float tensors in channels last (NHWC) layout.
+ *
+ * Registered in the internal NHWC domain so that graphs converted to channels
+ * last for NHWC-preferring execution providers can run pooling nodes that fall
+ * back to the CPU provider without layout conversions at the partition
+ * boundary. Only max pool and average pool are supported, mirroring the fp16
+ * NHWC kernels in core/providers/cpu/fp16/fp16_pool.cc.
+ *
+ * MLAS has no fp32 NHWC pooling microkernels, so the inner loops are portable
+ * per-channel code; with the channel dimension contiguous they vectorize well.
+ */
+class PoolNhwcFloat : public OpKernel {
+ public:
+  explicit PoolNhwcFloat(const OpKernelInfo& info)
+      : OpKernel(info),
+        pool_attrs_(info, info.GetKernelDef().OpName(), info.node().SinceVersion()),
+        is_max_pool_(info.GetKernelDef().OpName() == "MaxPool") {}
+
+  Status Compute(OpKernelContext* context) const override;
+
+ protected:
+  PoolAttributes pool_attrs_;
+  bool is_max_pool_;  // either max pool or average pool
+};
+
+Status PoolNhwcFloat::Compute(OpKernelContext* context) const {
+  const auto* X = context->Input<Tensor>(0);
+  const TensorShape& input_shape = X->Shape();
+
+  const size_t input_rank = input_shape.NumDimensions();
+  ORT_RETURN_IF_NOT(input_rank >= 3, "Input dimension cannot be less than 3.");
+
+  const int64_t N = input_shape[0];
+  const int64_t C = input_shape[input_rank - 1];
+
+  ORT_ENFORCE(input_shape.Size() > 0 || N == 0, "Invalid input shape. Only N can be zero. Got:", input_shape);
+
+  const size_t spatial_dims = input_rank - 2;
+  constexpr size_t spatial_dim_start = 1;
+
+  // Compute the output size and effective padding for this pooling operation.
+  TensorShapeVector output_dims({N});
+  TensorShapeVector pads = pool_attrs_.pads;
+  TensorShapeVector kernel_shape = pool_attrs_.kernel_shape;
+  TensorShapeVector strides = pool_attrs_.strides;
+  TensorShapeVector dilations = pool_attrs_.dilations;
+  if (pool_attrs_.global_pooling) {
+    const auto& input_dims = input_shape.GetDims();
+    kernel_shape.assign(input_dims.begin() + 1, input_dims.end() - 1);
+    pads.resize(kernel_shape.size() * 2, 0);
+    strides.resize(kernel_shape.size(), 1);
+    dilations.resize(kernel_shape.size(), 1);
+  }
+  ORT_RETURN_IF_NOT(kernel_shape.size() == spatial_dims,
+                    "Invalid kernel shape. Input shape (NHWC): ", input_shape,
+                    " Kernel shape: ", TensorShape(kernel_shape));
+
+  int64_t kernel_size = 1;
+  int64_t input_image_size = 1;
+  int64_t output_image_size = 1;
+  for (size_t dim = 0; dim < spatial_dims; ++dim) {
+    int64_t kernel = kernel_shape[dim];
+    int64_t input_dim = input_shape[dim + spatial_dim_start];
+
+    kernel_size *= kernel;
+    input_image_size *= input_dim;
+
+    int64_t output_dim = 0;
+    pool_attrs_.ComputeSizePadDilations(input_dim,
+                                        strides[dim],
+                                        kernel,
+                                        &pads.at(dim),
+                                        &pads.at(spatial_dims + dim),
+                                        dilations[dim],
+                                        &output_dim);
+    output_dims.push_back(output_dim);
+
+    output_image_size *= output_dim;
+  }
+  output_dims.push_back(C);
+
+  // For average pooling with count_include_pad the padded positions must
+  // contribute zeros, so point them at a zero vector. Otherwise the padded
+  // positions are left as nullptr and skipped by the pooling loops below.
+  const bool need_padding = !is_max_pool_ && pool_attrs_.count_include_pad;
+  std::vector<float> padding_data;
+  if (need_padding) {
+    padding_data.resize(static_cast<size_t>(C), 0.0f);
+  }
+
+  const auto* Xdata = X->Data<float>();
+  auto* Y = context->Output(0, output_dims);
+  auto* Ydata = Y->MutableData<float>();
+
+  // Allocate indirection buffer pointers for the im2col transform.
+  AllocatorPtr alloc;
+  ORT_RETURN_IF_ERROR(context->GetTempSpaceAllocator(&alloc));
+  auto* col_data = alloc->Alloc(SafeInt<size_t>(sizeof(const float*)) * kernel_size * output_image_size);
+  BufferUniquePtr col_buffer(col_data, BufferDeleter(std::move(alloc)));
+
+  const int64_t output_stride = std::max((int64_t)2, (int64_t)8192 / (kernel_size * C));
+  const int64_t task_count = (output_image_size + output_stride - 1) / output_stride;
+  concurrency::ThreadPool* thread_pool = context->GetOperatorThreadPool();
+
+  for (int64_t image_id = 0; image_id < N; ++image_id) {
+    const auto* input_data = Xdata;
+    auto* output_data = Ydata;
+
+    auto worker = [&](ptrdiff_t batch) {
+      int64_t output_start = (int64_t)batch * (int64_t)output_stride;
+      int64_t output_count = std::min((int64_t)output_stride, output_image_size - output_start);
+      auto* outputptr = output_data + output_stride * C * batch;
+      auto indirection_buffer = static_cast<float const**>(col_buffer.get()) + output_start * kernel_size;
+
+      math::Im2col<float, StorageOrder::NHWC>()(
+          input_data,
+          C,
+          input_shape.GetDims().data() + spatial_dim_start,
+          output_dims.data() + spatial_dim_start,
+          kernel_shape.data(),
+          strides.data(),
+          dilations.data(),
+          pads.data(),
+          static_cast<ptrdiff_t>(spatial_dims),
+          output_start,
+          output_count,
+          indirection_buffer,
+          need_padding ? padding_data.data() : nullptr);
+
+      if (is_max_pool_) {
+        for (int64_t i = 0; i < output_count; ++i) {
+          const float* const* kernel_inputs = indirection_buffer + i * kernel_size;
+          float* output = outputptr + i * C;
+          std::fill_n(output, static_cast<size_t>(C), std::numeric_limits<float>::lowest());
+          for (int64_t k = 0; k < kernel_size; ++k) {
+            const float* input = kernel_inputs[k];
+            if (input == nullptr) {
+              continue;  // padded position
+            }
+            for (int64_t c = 0; c < C; ++c) {
+              output[c] = std::max(output[c], input[c]);
+            }
+          }
+        }
+      } else {
+        for (int64_t i = 0; i < output_count; ++i) {
+          const float* const* kernel_inputs = indirection_buffer + i * kernel_size;
+          float* output = outputptr + i * C;
+          std::fill_n(output, static_cast<size_t>(C), 0.0f);
+          int64_t pool_size = 0;
+          for (int64_t k = 0; k < kernel_size; ++k) {
+            const float* input = kernel_inputs[k];
+            if (input == nullptr) {
+              continue;  // padded position, excluded from the divisor
+            }
+            ++pool_size;
+            for (int64_t c = 0; c < C; ++c) {
+              output[c] += input[c];
+            }
+          }
+          if (pool_size > 0) {
+            const float scale = 1.0f / static_cast<float>(pool_size);
+            for (int64_t c = 0; c < C; ++c) {
+              output[c] *= scale;
+            }
+          }
+        }
+      }
+    };
+    concurrency::ThreadPool::TrySimpleParallelFor(thread_pool, onnxruntime::narrow<ptrdiff_t>(task_count), worker);
+
+    Xdata += input_image_size * C;
+    Ydata += output_image_size * C;
+  }
+
+  return Status::OK();
+}
+
+//
+// Operator definitions
+//
+namespace contrib {
+
+ONNX_OPERATOR_TYPED_KERNEL_EX(
+    MaxPool,
+    kMSInternalNHWCDomain,
+    12,
+    float,
+    kCpuExecutionProvider,
+    KernelDefBuilder()
+        .TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+    PoolNhwcFloat);
+
+ONNX_OPERATOR_TYPED_KERNEL_EX(
+    AveragePool,
+    kMSInternalNHWCDomain,
+    11,
+    float,
+    kCpuExecutionProvider,
+    KernelDefBuilder()
+        .TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+    PoolNhwcFloat);
+
+ONNX_OPERATOR_TYPED_KERNEL_EX(
+    GlobalAveragePool,
+    kMSInternalNHWCDomain,
+    1,
+    float,
+    kCpuExecutionProvider,
+    KernelDefBuilder()
+        .TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+    PoolNhwcFloat);
+
+}  // namespace contrib
+}  // namespace onnxruntime
+
+#endif  // DISABLE_CONTRIB_OPS
@@ -13,8 +13,11 @@ limitations under the License.
 
 #include "non_max_suppression.h"
 
+#include <cmath>
+#include <limits>
 #include <queue>
 #include <utility>
+#include <vector>
 
 #include "core/common/narrow.h"
 #include "non_max_suppression_helper.h"
@@ -43,6 +46,221 @@ ONNX_OPERATOR_KERNEL_EX(
 
 using namespace nms_helpers;
 
+namespace {
+
+// Below this many boxes the plain pairwise loop beats the setup cost of the bucketed selection.
+constexpr int kMinBoxesForGrid = 512;
+constexpr int kMaxGridDim = 64;
+
+// Axis-aligned extents of a box, precomputed once per batch so per-pair IoU tests don't re-derive
+// the coordinate min/max for both formats on every comparison.
+struct BoxExtents {
+  float x_min;
+  float y_min;
+  float x_max;
+  float y_max;
+};
+
+BoxExtents MakeBoxExtents(const float* box, int64_t center_point_box) {
+  BoxExtents e;
+  if (0 == center_point_box) {
+    // boxes data format [y1, x1, y2, x2]
+    MaxMin(box[1], box[3], e.x_min, e.x_max);
+    MaxMin(box[0], box[2], e.y_min, e.y_max);
+  } else {
+    // 1 == center_point_box => boxes data format [x_center, y_center, width, height]
+    float width_half = box[2] / 2;
+    float height_half = box[3] / 2;
+    e.x_min = box[0] - width_half;
+    e.x_max = box[0] + width_half;
+    e.y_min = box[1] - height_half;
+    e.y_max = box[1] + height_half;
+  }
+  return e;
+}
+
+bool HasFiniteExtents(const BoxExtents& e) {
+  return std::isfinite(e.x_min) && std::isfinite(e.y_min) && std::isfinite(e.x_max) && std::isfinite(e.y_max);
+}
+
+// Same arithmetic and early-outs as SuppressByIOU, operating on the precomputed extents.
+// box1 must be the candidate to keep operand order (and thus NaN behavior) identical.
+bool SuppressByExtents(const BoxExtents& box1, const BoxExtents& box2, float iou_threshold) {
+  const float intersection_x_min = HelperMax(box1.x_min, box2.x_min);
+  const float intersection_x_max = HelperMin(box1.x_max, box2.x_max);
+  if (intersection_x_max <= intersection_x_min)
+    return false;
+
+  const float intersection_y_min = HelperMax(box1.y_min, box2.y_min);
+  const float intersection_y_max = HelperMin(box1.y_max, box2.y_max);
+  if (intersection_y_max <= intersection_y_min)
+    return false;
+
+  const float intersection_area = (intersection_x_max - intersection_x_min) *
+                                  (intersection_y_max - intersection_y_min);
+  if (intersection_area <= .0f)
+    return false;
+
+  const float area1 = (box1.x_max - box1.x_min) * (box1.y_max - box1.y_min);
+  const float area2 = (box2.x_max - box2.x_min) * (box2.y_max - box2.y_min);
+  const float union_area = area1 + area2 - intersection_area;
+  if (area1 <= .0f || area2 <= .0f || union_area <= .0f)
+    return false;
+
+  return intersection_area / union_area > iou_threshold;
+}
+
+// Uniform grid over the extents of a batch's boxes. Selected boxes are inserted into every cell
+// they overlap, so a candidate only runs IoU against selections sharing one of its cells; a box
+// can only suppress a candidate if their extents overlap, and overlapping boxes always share a
+// cell, so the result matches the pairwise loop exactly. Boxes with non-finite coordinates go to
+// an overflow list that is always checked.
+class SuppressionGrid {
+ public:
+  // Establishes the grid geometry for a batch. Returns false when there is no usable geometry
+  // (no box with finite coordinates), in which case the caller should keep the pairwise loop.
+  bool Reset(const std::vector<BoxExtents>& extents) {
+    float x_lo = std::numeric_limits<float>::max();
+    float y_lo = std::numeric_limits<float>::max();
+    float x_hi = std::numeric_limits<float>::lowest();
+    float y_hi = std::numeric_limits<float>::lowest();
+    double width_sum = 0.0;
+    double height_sum = 0.0;
+    size_t finite_count = 0;
+
+    for (const auto& e : extents) {
+      if (!HasFiniteExtents(e)) continue;
+      x_lo = std::min(x_lo, e.x_min);
+      y_lo = std::min(y_lo, e.y_min);
+      x_hi = std::max(x_hi, e.x_max);
+      y_hi = std::max(y_hi, e.y_max);
+      width_sum += e.x_max - e.x_min;
+      height_sum += e.y_max - e.y_min;
+      ++finite_count;
+    }
+
+    if (finite_count == 0) {
+      return false;
+    }
+
+    // Cell size tracks the average box so a box rarely spans more than a couple of cells, with a
+    // floor that caps the grid at kMaxGridDim cells per axis.
+    x_lo_ = x_lo;
+    y_lo_ = y_lo;
+    cell_w_ = std::max(static_cast<float>(width_sum / finite_count), (x_hi - x_lo) / kMaxGridDim);
+    cell_h_ = std::max(static_cast<float>(height_sum / finite_count), (y_hi - y_lo) / kMaxGridDim);
+    if (!(cell_w_ > 0.f)) cell_w_ = 1.f;  // every box degenerate in this axis
+    if (!(cell_h_ > 0.f)) cell_h_ = 1.f;
+    cols_ = std::min(kMaxGridDim, static_cast<int>((x_hi - x_lo) / cell_w_) + 1);
+    rows_ = std::min(kMaxGridDim, static_cast<int>((y_hi - y_lo) / cell_h_) + 1);
+
+    cells_.assign(static_cast<size_t>(rows_) * cols_, {});
+    touched_cells_.clear();
+    overflow_.clear();
+    last_seen_.clear();
+    stamp_ = 0;
+    return true;
+  }
+
+  // Removes all inserted boxes, keeping the geometry for the next class.
+  void Clear() {
+    for (size_t cell : touched_cells_) {
+      cells_[cell].clear();
+    }
+    touched_cells_.clear();
+    overflow_.clear();
+    last_seen_.clear();
+    stamp_ = 0;
+  }
+
+  // Adds a selected box. 'id' must be the next index into the caller's selected extents array.
+  void Insert(const BoxExtents& e, int32_t id) {
+    last_seen_.push_back(0);
+    if (!HasFiniteExtents(e)) {
+      overflow_.push_back(id);
+      return;
+    }
+
+    int cx0, cy0, cx1, cy1;
+    CellRange(e, cx0, cy0, cx1, cy1);
+    for (int cy = cy0; cy <= cy1; ++cy) {
+      for (int cx = cx0; cx <= cx1; ++cx) {
+        auto& cell = cells_[static_cast<size_t>(cy) * cols_ + cx];
+        if (cell.empty()) {
+          touched_cells_.push_back(static_cast<size_t>(cy) * cols_ + cx);
+        }
+        cell.push_back(id);
+      }
+    }
+  }
+
+  // Returns true if any selected box suppresses the candidate.
+  bool AnySuppresses(const BoxExtents& candidate, const std::vector<BoxExtents>& selected,
+                     float iou_threshold) {
+    for (int32_t id : overflow_) {
+      if (SuppressByExtents(candidate, selected[id], iou_threshold)) {
+        return true;
+      }
+    }
+
+    if (!HasFiniteExtents(candidate)) {
+      // Cannot localize the candidate; fall back to checking every selection.
+      for (const auto& e : selected) {
+        if (SuppressByExtents(candidate, e, iou_threshold)) {
+          return true;
+        }
+      }
+      return false;
+    }
+
+    // A box inserted into several cells is only tested once per candidate via the stamp.
+    ++stamp_;
+    int cx0, cy0, cx1, cy1;
+    CellRange(candidate, cx0, cy0, cx1, cy1);
+    for (int cy = cy0; cy <= cy1; ++cy) {
+      for (int cx = cx0; cx <= cx1; ++cx) {
+        for (int32_t id : cells_[static_cast<size_t>(cy) * cols_ + cx]) {
+          if (last_seen_[id] == stamp_) continue;
+          last_seen_[id] = stamp_;
+          if (SuppressByExtents(candidate, selected[id], iou_threshold)) {
+            return true;
+          }
+        }
+      }
+    }
+
+    return false;
+  }
+
+ private:
+  static int CellIndex(float v, float lo, float cell_size, int count) {
+    float f = (v - lo) / cell_size;
+    if (!(f > 0.f)) return 0;
+    return std::min(static_cast<int>(f), count - 1);
+  }
+
+  void CellRange(const BoxExtents& e, int& cx0, int& cy0, int& cx1, int& cy1) const {
+    cx0 = CellIndex(e.x_min, x_lo_, cell_w_, cols_);
+    cx1 = CellIndex(e.x_max, x_lo_, cell_w_, cols_);
+    cy0 = CellIndex(e.y_min, y_lo_, cell_h_, rows_);
+    cy1 = CellIndex(e.y_max, y_lo_, cell_h_, rows_);
+  }
+
+  float x_lo_{};
+  float y_lo_{};
+  float cell_w_{};
+  float cell_h_{};
+  int cols_{};
+  int rows_{};
+  std::vector<std::vector<int32_t>> cells_;
+  std::vector<size_t> touched_cells_;
+  std::vector<int32_t> overflow_;
+  std::vector<int32_t> last_seen_;
+  int32_t stamp_{};
+};
+
+}  // namespace
+
 // This works for both CPU and GPU.
 // CUDA kernel declare OrtMemTypeCPUInput for max_output_boxes_per_class(2), iou_threshold(3) and score_threshold(4)
 Status NonMaxSuppressionBase::PrepareCompute(OpKernelContext* ctx, PrepareContext& pc) {
@@ -153,10 +371,28 @@ Status NonMaxSuppression::Compute(OpKernelContext* ctx) const {
   std::vector<BoxInfoPtr> selected_boxes_inside_class;
   selected_boxes_inside_class.reserve(std::min<size_t>(static_cast<size_t>(max_output_boxes_per_class), pc.num_boxes_));
 
+  // With many boxes, bucket the selected ones into a grid so each candidate only runs IoU
+  // against selections whose extents can actually overlap it. Output is identical to the
+  // pairwise loop below, which remains for small inputs.
+  const bool use_grid = pc.num_boxes_ >= kMinBoxesForGrid;
+  std::vector<BoxExtents> batch_extents;
+  std::vector<BoxExtents> selected_extents;
+  SuppressionGrid grid;
+  bool grid_usable = false;
+
   for (int64_t batch_index = 0; batch_index < pc.num_batches_; ++batch_index) {
+    const float* batch_boxes = boxes_data + (batch_index * pc.num_boxes_ * 4);
+
+    if (use_grid) {
+      batch_extents.resize(static_cast<size_t>(pc.num_boxes_));
+      for (int64_t box_index = 0; box_index < pc.num_boxes_; ++box_index) {
+        batch_extents[static_cast<size_t>(box_index)] = MakeBoxExtents(batch_boxes + 4 * box_index, center_point_box);
+      }
+      grid_usable = grid.Reset(batch_extents);
+    }
+
     for (int64_t class_index = 0; class_index < pc.num_classes_; ++class_index) {
       int64_t box_score_offset = (batch_index * pc.num_classes_ + class_index) * pc.num_boxes_;
-      const float* batch_boxes = boxes_data + (batch_index * pc.num_boxes_ * 4);
       std::vector<BoxInfoPtr> candidate_boxes;
       candidate_boxes.reserve(pc.num_boxes_);
 
@@ -176,16 +412,30 @@ Status NonMaxSuppression::Compute(OpKernelContext* ctx) const {
       std::priority_queue<BoxInfoPtr, std::vector<BoxInfoPtr>> sorted_boxes(std::less<BoxInfoPtr>(), std::move(candidate_boxes));
 
       selected_boxes_inside_class.clear();
+      if (grid_usable) {
+        selected_extents.clear();
+        grid.Clear();
+      }
+
       // Get the next box with top score, filter by iou_threshold
       while (!sorted_boxes.empty() && static_cast<int64_t>(selected_boxes_inside_class.size()) < max_output_boxes_per_class) {
         const BoxInfoPtr& next_top_score = sorted_boxes.top();
 
         bool selected = true;
         // Check with existing selected boxes for this class, suppress if exceed the IOU (Intersection Over Union) threshold
-        for (const auto& selected_index : selected_boxes_inside_class) {
-          if (SuppressByIOU(batch_boxes, next_top_score.index_, selected_index.index_, center_point_box, iou_threshold)) {
-            selected = false;
-            break;
+        if (grid_usable) {
+          const BoxExtents& candidate = batch_extents[static_cast<size_t>(next_top_score.index_)];
+          selected = !grid.AnySuppresses(candidate, selected_extents, iou_threshold);
+          if (selected) {
+            grid.Insert(candidate, static_cast<int32_t>(selected_extents.size()));
+            selected_extents.push_back(candidate);
+          }
+        } else {
+          for (const auto& selected_index : selected_boxes_inside_class) {
+            if (SuppressByIOU(batch_boxes, next_top_score.index_, selected_index.index_, center_point_box, iou_threshold)) {
+              selected = false;
+              break;
+            }
           }
         }
 
@@ -299,7 +299,9 @@ struct DequantizeLinearApply<T, OutT, false> {
 
   /**
    * @brief Calculate blocked quantization of DequantizeLinear on the flattened tensors.
-   *        TODO(fajin): add mlas kernel to utilize multithreading, refer MlasDequantizeBlockwise.
+   *        The (m, quantize block) units are independent, so they are distributed over the
+   *        thread pool with one unit as the scheduling granularity.
+   * @param[in]    thread_pool            intra-op thread pool
    * @param[in]    M                      size of dimensions before the quantize axis
    * @param[in]    K                      dimension of the quantize axis
    * @param[in]    N                      size of dimensions after the quantize axis
@@ -310,41 +312,46 @@ struct DequantizeLinearApply<T, OutT, false> {
    * @param[out]   output                 same shape as input
    * @param[in]    zero_point             same shape as scale
    */
-  void op(size_t M, size_t K, size_t N, size_t quant_block_size,
+  void op(concurrency::ThreadPool* thread_pool, size_t M, size_t K, size_t N, size_t quant_block_size,
           const T* input, const OutT* scale, OutT* output, const T* zero_point) {
-    if (zero_point) {
-      for (size_t m = 0; m < M; m++) {
-        for (size_t bd = 0; bd < K; bd += quant_block_size) {
-          for (size_t qb = 0, qb_end = std::min(quant_block_size, K - bd); qb < qb_end; ++qb) {
+    const size_t num_quant_block_K = (K + quant_block_size - 1) / quant_block_size;
+    const auto num_units = static_cast<std::ptrdiff_t>(M * num_quant_block_K);
+    const double unit_elems = static_cast<double>(quant_block_size * N);
+    const TensorOpCost unit_cost{unit_elems * (sizeof(T) + sizeof(OutT)), unit_elems * sizeof(OutT),
+                                 unit_elems * 2.0};
+
+    concurrency::ThreadPool::TryParallelFor(
+        thread_pool, num_units, unit_cost,
+        [&](std::ptrdiff_t unit_begin, std::ptrdiff_t unit_end) {
+          for (auto unit = static_cast<size_t>(unit_begin); unit < static_cast<size_t>(unit_end); ++unit) {
+            const size_t m = unit / num_quant_block_K;
+            const size_t kb = unit % num_quant_block_K;
+            const size_t bd = kb * quant_block_size;
+            const size_t qb_end = std::min(quant_block_size, K - bd);
             // within the quantize block, the zero point and scale are the same.
-            for (size_t bs = 0; bs < N; bs++) {
-              auto zp = static_cast<int32_t>(zero_point[bs]);
-              auto sc = static_cast<float>(scale[bs]);
-              *output++ = static_cast<OutT>(static_cast<float>(static_cast<int32_t>(*input++) - zp) * sc);
+            const OutT* unit_scale = scale + (m * num_quant_block_K + kb) * N;
+            const T* unit_input = input + (m * K + bd) * N;
+            OutT* unit_output = output + (m * K + bd) * N;
+
+            if (zero_point) {
+              const T* unit_zero_point = zero_point + (m * num_quant_block_K + kb) * N;
+              for (size_t qb = 0; qb < qb_end; ++qb) {
+                for (size_t bs = 0; bs < N; bs++) {
+                  auto zp = static_cast<int32_t>(unit_zero_point[bs]);
+                  auto sc = static_cast<float>(unit_scale[bs]);
+                  *unit_output++ = static_cast<OutT>(static_cast<float>(static_cast<int32_t>(*unit_input++) - zp) * sc);
+                }
+              }
+            } else {
+              for (size_t qb = 0; qb < qb_end; ++qb) {
+                for (size_t bs = 0; bs < N; bs++) {
+                  auto sc = static_cast<float>(unit_scale[bs]);
+                  *unit_output++ = static_cast<OutT>(static_cast<float>(static_cast<int32_t>(*unit_input++)) * sc);
+                }
+              }
             }
           }
-
-          // move to the next quantize block
-          zero_point += N;
-          scale += N;
-        }
-      }
-    } else {
-      for (size_t m = 0; m < M; m++) {
-        for (size_t bd = 0; bd < K; bd += quant_block_size) {
-          for (size_t qb = 0, qb_end = std::min(quant_block_size, K - bd); qb < qb_end; ++qb) {
-            // within the quantize block, the zero point and scale are the same.
-            for (size_t bs = 0; bs < N; bs++) {
-              auto sc = static_cast<float>(scale[bs]);
-              *output++ = static_cast<OutT>(static_cast<float>(static_cast<int32_t>(*input++)) * sc);
-            }
-          }
-
-          // move to the next quantize block
-          scale += N;
-        }
-      }
-    }
+        });
   }
 };
 
@@ -375,50 +382,52 @@ struct DequantizeLinearApply<T, OutT, true> {
     assert(input_index == M * K * N);
   }
 
-  // Blocked quantization
-  // TODO(fajin) : add mlas kernel to utilize multithreading, refer MlasDequantizeBlockwise.
-  void op(size_t M, size_t K, size_t N, size_t quant_block_size,
+  // Blocked quantization. The (m, quantize block) units are independent and only read the packed
+  // int4 input, so they are distributed over the thread pool like the wider-integer case.
+  void op(concurrency::ThreadPool* thread_pool, size_t M, size_t K, size_t N, size_t quant_block_size,
           const T* input, const OutT* scale, OutT* output, const T* zero_point) {
-    size_t input_index = 0;
-
-    if (zero_point) {
-      size_t zp_index = 0;
-
-      for (size_t n = 0; n < M; n++) {
-        for (size_t bd = 0; bd < K; bd += quant_block_size) {
-          for (size_t qb = 0, qb_end = std::min(quant_block_size, K - bd); qb < qb_end; ++qb) {
-            auto q_zp_index = zp_index;
-            for (size_t bs = 0; bs < N; ++bs, ++input_index, ++q_zp_index) {
-              auto zp = static_cast<int32_t>(zero_point[q_zp_index >> 1].GetElem(q_zp_index & 0x1));
-              auto sc = static_cast<float>(scale[bs]);
-
-              int32_t val = static_cast<int32_t>(input[input_index >> 1].GetElem(input_index & 0x1));
-              *output++ = static_cast<OutT>(static_cast<float>(val - zp) * sc);
-            }
-          }
-
-          scale += N;
-          zp_index += N;
-        }
-      }
-    } else {
-      for (size_t n = 0; n < M; n++) {
-        for (size_t bd = 0; bd < K; bd += quant_block_size) {
-          for (size_t qb = 0, qb_end = std::min(quant_block_size, K - bd); qb < qb_end; ++qb) {
-            for (size_t bs = 0; bs < N; ++bs, ++input_index) {
-              auto sc = static_cast<float>(scale[bs]);
-
-              int32_t val = static_cast<int32_t>(input[input_index >> 1].GetElem(input_index & 0x1));
-              *output++ = static_cast<OutT>(static_cast<float>(val) * sc);
+    const size_t num_quant_block_K = (K + quant_block_size - 1) / quant_block_size;
+    const auto num_units = static_cast<std::ptrdiff_t>(M * num_quant_block_K);
+    const double unit_elems = static_cast<double>(quant_block_size * N);
+    const TensorOpCost unit_cost{unit_elems * (0.5 + sizeof(OutT)), unit_elems * sizeof(OutT),
+                                 unit_elems * 2.0};
+
+    concurrency::ThreadPool::TryParallelFor(
+        thread_pool, num_units, unit_cost,
+        [&](std::ptrdiff_t unit_begin, std::ptrdiff_t unit_end) {
+          for (auto unit = static_cast<size_t>(unit_begin); unit < static_cast<size_t>(unit_end); ++unit) {
+            const size_t m = unit / num_quant_block_K;
+            const size_t kb = unit % num_quant_block_K;
+            const size_t bd = kb * quant_block_size;
+            const size_t qb_end = std::min(quant_block_size, K - bd);
+            const OutT* unit_scale = scale + (m * num_quant_block_K + kb) * N;
+            size_t input_index = (m * K + bd) * N;
+            OutT* unit_output = output + input_index;
+
+            if (zero_point) {
+              const size_t zp_index = (m * num_quant_block_K + kb) * N;
+              for (size_t qb = 0; qb < qb_end; ++qb) {
+                auto q_zp_index = zp_index;
+                for (size_t bs = 0; bs < N; ++bs, ++input_index, ++q_zp_index) {
+                  auto zp = static_cast<int32_t>(zero_point[q_zp_index >> 1].GetElem(q_zp_index & 0x1));
+                  auto sc = static_cast<float>(unit_scale[bs]);
+
+                  int32_t val = static_cast<int32_t>(input[input_index >> 1].GetElem(input_index & 0x1));
+                  *unit_output++ = static_cast<OutT>(static_cast<float>(val - zp) * sc);
+                }
+              }
+            } else {
+              for (size_t qb = 0; qb < qb_end; ++qb) {
+                for (size_t bs = 0; bs < N; ++bs, ++input_index) {
+                  auto sc = static_cast<float>(unit_scale[bs]);
+
+                  int32_t val = static_cast<int32_t>(input[input_index >> 1].GetElem(input_index & 0x1));
+                  *unit_output++ = static_cast<OutT>(static_cast<float>(val) * sc);
+                }
+              }
             }
           }
-
-          scale += N;
-        }
-      }
-    }
-
-    assert(input_index == M * K * N);
+        });
   }
 };
 
@@ -439,20 +448,35 @@ struct DequantizeLinearApply<T, OutT, true> {
         }                                                                                       \
       }                                                                                         \
     }                                                                                           \
-    /* Blocked quantization */                                                                  \
-    void op(size_t M, size_t K, size_t N, size_t quant_block_size,                              \
-            const T* input, const OutT* scale, OutT* output, const T*) {                        \
-      for (size_t m = 0; m < M; m++) {                                                          \
-        for (size_t bd = 0; bd < K; bd += quant_block_size) {                                   \
-          for (size_t qb = 0, qb_end = std::min(quant_block_size, K - bd); qb < qb_end; ++qb) { \
-            for (size_t bs = 0; bs < N; bs++, input++) {                                        \
-              auto sc = static_cast<float>(scale[bs]);                                          \
-              *output++ = static_cast<OutT>(input->ToFloat() * sc);                             \
+    /* Blocked quantization, parallelized over the independent (m, quantize block) units */     \
+    void op(concurrency::ThreadPool* thread_pool, size_t M, size_t K, size_t N,                 \
+            size_t quant_block_size, const T* input, const OutT* scale, OutT* output,           \
+            const T*) {                                                                         \
+      const size_t num_quant_block_K = (K + quant_block_size - 1) / quant_block_size;           \
+      const auto num_units = static_cast<std::ptrdiff_t>(M * num_quant_block_K);                \
+      const double unit_elems = static_cast<double>(quant_block_size * N);                      \
+      const TensorOpCost unit_cost{unit_elems * (sizeof(T) + sizeof(OutT)),                     \
+                                   unit_elems * sizeof(OutT), unit_elems * 2.0};                \
+      concurrency::ThreadPool::TryParallelFor(                                                  \
+          thread_pool, num_units, unit_cost,                                                    \
+          [&](std::ptrdiff_t unit_begin, std::ptrdiff_t unit_end) {                             \
+            for (auto unit = static_cast<size_t>(unit_begin);                                   \
+                 unit < static_cast<size_t>(unit_end); ++unit) {                                \
+              const size_t m = unit / num_quant_block_K;                                        \
+              const size_t kb = unit % num_quant_block_K;                                       \
+              const size_t bd = kb * quant_block_size;                                          \
+              const size_t qb_end = std::min(quant_block_size, K - bd);                         \
+              const OutT* unit_scale = scale + (m * num_quant_block_K + kb) * N;                \
+              const T* unit_input = input + (m * K + bd) * N;                                   \
+              OutT* unit_output = output + (m * K + bd) * N;                                    \
+              for (size_t qb = 0; qb < qb_end; ++qb) {                                          \
+                for (size_t bs = 0; bs < N; bs++, unit_input++) {                               \
+                  auto sc = static_cast<float>(unit_scale[bs]);                                 \
+                  *unit_output++ = static_cast<OutT>(unit_input->ToFloat() * sc);               \
+                }                                                                               \
+              }                                                                                 \
             }                                                                                   \
-          }                                                                                     \
-          scale += N;                                                                           \
-        }                                                                                       \
-      }                                                                                         \
+          });                                                                                   \
     }                                                                                           \
   };
 
@@ -502,7 +526,8 @@ Status DequantizeLinear<T>::Compute(OpKernelContext* ctx) const {
     const float* scale = x_scale.Data<float>();
     float* output = y.MutableData<float>();
     if (block_size_) {
-      DequantizeLinearApply<T, float, is_4bit>().op(static_cast<size_t>(process_block_count),
+      DequantizeLinearApply<T, float, is_4bit>().op(ctx->GetOperatorThreadPool(),
+                                                    static_cast<size_t>(process_block_count),
                                                     static_cast<size_t>(broadcast_dim),
                                                     static_cast<size_t>(process_block_size),
                                                     static_cast<size_t>(block_size_),
@@ -517,7 +542,8 @@ Status DequantizeLinear<T>::Compute(OpKernelContext* ctx) const {
     const MLFloat16* scale = x_scale.Data<MLFloat16>();
     MLFloat16* output = y.MutableData<MLFloat16>();
     if (block_size_) {
-      DequantizeLinearApply<T, MLFloat16, is_4bit>().op(static_cast<size_t>(process_block_count),
+      DequantizeLinearApply<T, MLFloat16, is_4bit>().op(ctx->GetOperatorThreadPool(),
+                                                        static_cast<size_t>(process_block_count),
                                                         static_cast<size_t>(broadcast_dim),
                                                         static_cast<size_t>(process_block_size),
                                                         static_cast<size_t>(block_size_),
@@ -382,6 +382,10 @@ void ReduceAggregatorBase::FastReduceKRK(const Tensor&, const gsl::span<const in
 void ReduceAggregatorBase::FastReduceRKR(const Tensor&, const gsl::span<const int64_t>&, Tensor&, concurrency::ThreadPool*) {
   ValidateMustBeOverloaded();
 }
+void ReduceAggregatorBase::BlockedReduce(const Tensor&, const gsl::span<const int64_t>&,
+                                         const gsl::span<const int64_t>&, Tensor&, concurrency::ThreadPool*) {
+  ValidateMustBeOverloaded();
+}
 
 void NoTransposePrepareForReduce(const TensorShape& new_input_shape,
                                  gsl::span<const int64_t> reduced_axes,
@@ -805,6 +809,15 @@ bool CommonFastReduceSwitch(OpKernelContext* ctx,
   if (which_fast_reduce != FastReduceKind::kNone) {
     if (IsFastReduceKindAvailable(fast_kind, which_fast_reduce)) {
       Tensor* output = ctx->Output(0, output_shape);
+      // The heuristics below (see benchmarks in PR #7719) pick between the specialized
+      // implementation and the generic one depending on the thread pool size. Every
+      // implementation accumulates each output element within a single worker in a fixed
+      // order, but the orders differ between implementations, so a selection that depends
+      // on the pool size makes results vary with the thread-count configuration. When
+      // deterministic compute is requested the specialized implementation is chosen
+      // unconditionally: the summation order then only depends on the reduction pattern,
+      // and the reduction stays parallel instead of falling back to a single thread.
+      const bool deterministic_compute = ctx->GetUseDeterministicCompute();
       switch (fast_kind) {
         case FastReduceKind::kKR: {
           ValidateFastReduceKR(fast_shape, *output);
@@ -813,9 +826,10 @@ bool CommonFastReduceSwitch(OpKernelContext* ctx,
         }
         case FastReduceKind::kRK: {
           ValidateFastReduceRK(fast_shape, *output);
-          if ((fast_shape[0] > concurrency::ThreadPool::DegreeOfParallelism(ctx->GetOperatorThreadPool()) * 16) &&
-              (std::max(fast_shape[0], fast_shape[1]) >
-               concurrency::ThreadPool::DegreeOfParallelism(ctx->GetOperatorThreadPool()) * 256)) {
+          if (deterministic_compute ||
+              ((fast_shape[0] > concurrency::ThreadPool::DegreeOfParallelism(ctx->GetOperatorThreadPool()) * 16) &&
+               (std::max(fast_shape[0], fast_shape[1]) >
+                concurrency::ThreadPool::DegreeOfParallelism(ctx->GetOperatorThreadPool()) * 256))) {
             // See benchmarks in PR #7719.
             case_rk(*input, fast_shape, *output, ctx->GetOperatorThreadPool());
             return true;
@@ -825,7 +839,8 @@ bool CommonFastReduceSwitch(OpKernelContext* ctx,
         }
         case FastReduceKind::kKRK:
           ValidateFastReduceKRK(fast_shape, *output);
-          if (fast_shape[0] >= std::max(2, concurrency::ThreadPool::DegreeOfParallelism(ctx->GetOperatorThreadPool()))) {
+          if (deterministic_compute ||
+              fast_shape[0] >= std::max(2, concurrency::ThreadPool::DegreeOfParallelism(ctx->GetOperatorThreadPool()))) {
             // See benchmarks in PR #7719.
             case_krk(*input, fast_shape, *output, ctx->GetOperatorThreadPool());
             return true;
@@ -834,7 +849,8 @@ bool CommonFastReduceSwitch(OpKernelContext* ctx,
           }
         case FastReduceKind::kRKR:
           ValidateFastReduceRKR(fast_shape, *output);
-          if (fast_shape[1] >= std::max(2, concurrency::ThreadPool::DegreeOfParallelism(ctx->GetOperatorThreadPool()))) {
+          if (deterministic_compute ||
+              fast_shape[1] >= std::max(2, concurrency::ThreadPool::DegreeOfParallelism(ctx->GetOperatorThreadPool()))) {
             case_rkr(*input, fast_shape, *output, ctx->GetOperatorThreadPool());
             return true;
           } else {
@@ -954,6 +970,14 @@ void CommonReduce1Loop(OpKernelContext* ctx,
     return;
   }
 
+  if (fast_kind == FastReduceKind::kNone && AGG::HasBlockedReduce()) {
+    // More than three alternating kept/reduced spans (e.g. KRKR): the generic
+    // implementation below gathers strided elements one at a time. Additive
+    // aggregators have a blocked implementation which keeps the reads contiguous.
+    AGG::BlockedReduce(*input, fast_shape, fast_axes, *output, ctx->GetOperatorThreadPool());
+    return;
+  }
+
   ResultsNoTransposePrepareForReduce last_results;
   NoTransposeReduce1Loop<AGG>(output, fast_shape, *input, fast_axes, ctx->GetOperatorThreadPool(), last_results);
 }
@@ -1119,6 +1143,13 @@ std::unique_ptr<Tensor> ReduceSum<T>::Impl(const Tensor& input, gsl::span<const
     }
   }
 
+  if (fast_kind == FastReduceKind::kNone) {
+    // See CommonReduce1Loop: blocked engine for the alternating patterns the fast
+    // cases do not cover.
+    ReduceAggregatorSum<T>::BlockedReduce(input, fast_shape, fast_axes, *output, tp);
+    return output;
+  }
+
   ResultsNoTransposePrepareForReduce last_results;
   NoTransposeReduce1Loop<ReduceAggregatorSum<T>>(output.get(), fast_shape, input, fast_axes, tp, last_results);
   return output;
@@ -159,6 +159,13 @@ class ReduceAggregatorBase {
   static void FastReduceRK(const Tensor&, const gsl::span<const int64_t>&, Tensor&, concurrency::ThreadPool*);
   static void FastReduceKRK(const Tensor&, const gsl::span<const int64_t>&, Tensor&, concurrency::ThreadPool*);
   static void FastReduceRKR(const Tensor&, const gsl::span<const int64_t>&, Tensor&, concurrency::ThreadPool*);
+
+  // Blocked reduction for compressed shapes with more than three alternating
+  // kept/reduced spans (OptimizeShapeForFastReduce returned kNone).
+  // Only additive aggregators overload it: see ReduceAggregatorSum::BlockedReduce.
+  static inline bool HasBlockedReduce() { return false; }
+  static void BlockedReduce(const Tensor&, const gsl::span<const int64_t>&,
+                            const gsl::span<const int64_t>&, Tensor&, concurrency::ThreadPool*);
 };
 
 template <typename T, typename TVAL = T>
@@ -287,6 +294,106 @@ class ReduceAggregatorSum : public ReduceAggregator<T, T> {
           value += aggall(p, size);
         });
   }
+
+  // Blocked reduction for the patterns the fast cases above do not cover
+  // (more than three alternating kept/reduced spans, e.g. KRKR). The generic
+  // implementation gathers strided elements one at a time; this engine walks
+  // the input in storage order instead, so every read is a contiguous block,
+  // and accumulates into cache-sized tiles of the output. Parallelism is taken
+  // from the outermost kept axis so that workers write disjoint output slices.
+  static inline bool HasBlockedReduce() { return true; }
+
+  static void BlockedReduce(const Tensor& input, const gsl::span<const int64_t>& fast_shape,
+                            const gsl::span<const int64_t>& fast_axes, Tensor& output,
+                            concurrency::ThreadPool* tp) {
+    const size_t n_dims = fast_shape.size();
+    ORT_ENFORCE(n_dims >= 4, "BlockedReduce expects at least four compressed dimensions.");
+    std::vector<bool> reduced(n_dims, false);
+    for (auto a : fast_axes) {
+      reduced[onnxruntime::narrow<size_t>(a)] = true;
+    }
+
+    TensorShapeVector in_stride(n_dims);
+    TensorShapeVector out_stride(n_dims, 0);
+    in_stride[n_dims - 1] = 1;
+    int64_t output_size = 1;
+    for (size_t i = n_dims; i > 0; --i) {
+      if (!reduced[i - 1]) {
+        out_stride[i - 1] = output_size;
+        output_size *= fast_shape[i - 1];
+      }
+      if (i > 1) {
+        in_stride[i - 2] = in_stride[i - 1] * fast_shape[i - 1];
+      }
+    }
+    ORT_ENFORCE(output_size == output.Shape().Size(), "Output size mismatch.");
+
+    const T* data = input.Data<T>();
+    T* out = output.MutableData<T>();
+
+    // Outermost kept axis: the parallel dimension. When axis 0 is reduced, its
+    // iterations are replayed inside every worker so writes stay disjoint.
+    const size_t axis0 = reduced[0] ? 1 : 0;
+    const int64_t slice = out_stride[axis0];
+    const int64_t outer_reps = reduced[0] ? fast_shape[0] : 1;
+    const int64_t outer_stride = reduced[0] ? in_stride[0] : 0;
+    // The two innermost axes form a contiguous block and are handled below with
+    // vectorized loops; the axes in between are enumerated with div/mod.
+    const int64_t tail = fast_shape[n_dims - 1];
+    const int64_t inner = fast_shape[n_dims - 2];
+    const bool tail_reduced = reduced[n_dims - 1];
+    int64_t middle = 1;
+    for (size_t i = axis0 + 1; i + 2 < n_dims; ++i) {
+      middle *= fast_shape[i];
+    }
+    // Keeps the accumulated output tile within half of a 32 KiB L1 data cache.
+    constexpr int64_t kOutputTile = 16384 / sizeof(T);
+
+    const int64_t cost_per_index = input.Shape().Size() / fast_shape[axis0];
+    concurrency::ThreadPool::TryParallelFor(
+        tp, onnxruntime::narrow<std::ptrdiff_t>(fast_shape[axis0]),
+        ParallelReduceFastCost(1, cost_per_index, sizeof(T), 6),
+        [data, out, slice, outer_reps, outer_stride, middle, tail, inner, tail_reduced, axis0,
+         n_dims, &fast_shape, &in_stride, &out_stride, &reduced](std::ptrdiff_t first, std::ptrdiff_t last) {
+          EigenVectorMap<T>(out + first * slice, onnxruntime::narrow<size_t>((last - first) * slice)).setZero();
+          for (std::ptrdiff_t d = first; d < last; ++d) {
+            for (int64_t o = 0; o < outer_reps; ++o) {
+              for (int64_t m = 0; m < middle; ++m) {
+                int64_t in_off = d * in_stride[axis0] + o * outer_stride;
+                int64_t out_off = d * slice;
+                int64_t rem = m;
+                for (size_t a = n_dims - 3; a > axis0; --a) {
+                  int64_t idx = rem % fast_shape[a];
+                  rem /= fast_shape[a];
+                  in_off += idx * in_stride[a];
+                  if (!reduced[a]) {
+                    out_off += idx * out_stride[a];
+                  }
+                }
+                const T* block = data + in_off;
+                T* acc = out + out_off;
+                if (tail_reduced) {
+                  // ...KR tail: one horizontal sum per contiguous row, consecutive
+                  // rows and outputs are both contiguous.
+                  for (int64_t k = 0; k < inner; ++k) {
+                    acc[k] += aggall(block + k * tail, tail);
+                  }
+                } else {
+                  // ...RK tail: accumulate the contiguous rows into the output tile
+                  // by tile so the tile stays cached across the reduced iterations.
+                  for (int64_t kb = 0; kb < tail; kb += kOutputTile) {
+                    int64_t bs = std::min(kOutputTile, tail - kb);
+                    for (int64_t r = 0; r < inner; ++r) {
+                      EigenVectorArrayMap<T>(acc + kb, onnxruntime::narrow<size_t>(bs)) +=
+                          ConstEigenVectorArrayMap<T>(block + r * tail + kb, onnxruntime::narrow<size_t>(bs));
+                    }
+                  }
+                }
+              }
+            }
+          }
+        });
+  }
 };
 
 template <typename T, typename TVAL = T>
@@ -366,6 +473,25 @@ class ReduceAggregatorMean : public ReduceAggregatorSum<T> {
       *out /= div;
     }
   }
+
+  // Blocked reduction
+  // HasBlockedReduce() already defined in ReduceAggregatorSum
+
+  static void BlockedReduce(const Tensor& input, const gsl::span<const int64_t>& fast_shape,
+                            const gsl::span<const int64_t>& fast_axes, Tensor& output,
+                            concurrency::ThreadPool* tp) {
+    ReduceAggregatorSum<T>::BlockedReduce(input, fast_shape, fast_axes, output, tp);
+    int64_t reduced_size = 1;
+    for (auto a : fast_axes) {
+      reduced_size *= fast_shape[onnxruntime::narrow<size_t>(a)];
+    }
+    T div = static_cast<T>(reduced_size);
+    T* out = output.MutableData<T>();
+    T* end = out + output.Shape().Size();
+    for (; out != end; ++out) {
+      *out /= div;
+    }
+  }
 };
 
 template <typename T>
@@ -3,6 +3,8 @@
 
 #include "uni_directional_lstm.h"
 
+#include <limits>
+
 #include "core/platform/threadpool.h"
 // TODO: fix the warnings
 #if defined(_MSC_VER) && !defined(__clang__)
@@ -75,6 +77,16 @@ UniDirectionalLstm<T>::UniDirectionalLstm(
 
   clip_with_bias_ptr_ = use_bias_ ? deepcpu::clip_add_bias : deepcpu::clip_ignore_bias;
 
+  // With the default activations (f=sigmoid, g=h=tanh), no peepholes and no coupled
+  // input/forget gate, the per-gate passes in GateComputations collapse into a few wide
+  // vectorized ones. Requires clip at its default (no clipping) so the bias add is a
+  // plain sum.
+  fused_gate_computations_ = !use_peepholes_ && !input_forget_ &&
+                             clip_ == std::numeric_limits<float>::max() &&
+                             activation_func_f.name == "sigmoid" &&
+                             activation_func_g.name == "tanh" &&
+                             activation_func_h.name == "tanh";
+
   SetNumThreads();
   AllocateBuffers();
   InitializeBuffers(initial_hidden_state, initial_cell_state);
@@ -405,7 +417,13 @@ void UniDirectionalLstm<T>::ComputeImpl(const gsl::span<const T>& inputs_arg,
     double cost = max_sequence_length * (gemm_cost + num_seq_to_compute);
     ExecuteLambdaInParallel(sequences_calculator, batch_size_, num_seq_to_compute, cost, thread_pool_);
   } else {
-    sequences_calculator(0, thread_pool_);
+    // Decide the threading of the per-step recurrent GEMM once, outside the timestep loop.
+    // At the small batch sizes that reach here the GEMM has few rows, so the fan-out/join
+    // across the pool on every timestep costs more than the parallelism recovers unless
+    // the GEMM is fairly large. Below that point run the steps on the calling thread.
+    const double recurrent_gemm_cost = static_cast<double>(batch_size_) * hidden_size_x4 * hidden_size_;
+    constexpr double kMinParallelRecurrentGemmCost = 512.0 * 1024.0;
+    sequences_calculator(0, recurrent_gemm_cost >= kMinParallelRecurrentGemmCost ? thread_pool_ : nullptr);
   }
 
   for (int i = 0; i < batch_size_; i++) {
@@ -497,6 +515,50 @@ void UniDirectionalLstm<T>::GateComputations(
 
     // DumpMatrix("C_prev" + row_str, pCprev_hidden_size, 1, hidden_size_);
 
+    if (fused_gate_computations_) {
+      // Default-activation fast path. One pass for the bias add, one vectorized sigmoid
+      // over the adjacent i/o/f gates, one tanh for the block gate, then a single
+      // cell-update/output pass. Numerically identical to the general path below, which
+      // walks the four gates separately through function pointers.
+      if (use_bias_) {
+        const float* pBi = SafeRawConstPointer<T>(bias_WRi_, 0, hidden_size_);
+        const float* pBo = SafeRawConstPointer<T>(bias_WRo_, 0, hidden_size_);
+        const float* pBf = SafeRawConstPointer<T>(bias_WRf_, 0, hidden_size_);
+        const float* pBc = SafeRawConstPointer<T>(bias_WRc_, 0, hidden_size_);
+        for (int i = 0; i < hidden_size_; i++) {
+          pi[i] += pBi[i];
+          po[i] += pBo[i];
+          pf[i] += pBf[i];
+          pc[i] += pBc[i];
+        }
+      }
+
+      MlasComputeLogistic(pi, pi, static_cast<size_t>(3) * hidden_size_);
+      MlasComputeTanh(pc, pc, hidden_size_);
+
+      float* pC_cur = pCprev_hidden_size;
+      deepcpu::merge_lstm_gates_to_memory(pCprev_hidden_size, pi, pf, pc, pC_cur, hidden_size_);
+
+      if (training_mode_) {
+        float* pC = SafeRawPointer<T>(batched_cell_states + row * hidden_size_ + b * hidden_size_,
+                                      batched_cell_states_end, hidden_size_);
+        for (int idx = 0; idx < hidden_size_; ++idx) {
+          pC[idx] = pC_cur[idx];
+        }
+      }
+
+      float* pH =
+          SafeRawPointer<T>(batched_output + row * hidden_size_ + b * hidden_size_, batched_output_end, hidden_size_);
+      float* pC_prev_clipped = SafeRawPointer<T>(C_prev_clipped + b * hidden_size_, C_prev_clipped_end, hidden_size_);
+
+      MlasComputeTanh(pC_cur, pC_prev_clipped, hidden_size_);
+      for (int i = 0; i < hidden_size_; i++) {
+        pH[i] = po[i] * pC_prev_clipped[i];
+      }
+
+      continue;
+    }
+
     // Input Gate
     if (use_peepholes_) {
       deepcpu::elementwise_product(pCprev_hidden_size, SafeRawConstPointer<const T>(peephole_i_, 0, hidden_size_), pi,
@@ -87,6 +87,7 @@ class UniDirectionalLstm {
   float clip_;
 
   bool batch_parallel_;
+  bool fused_gate_computations_;
 
   bool use_bias_;
   bool use_peepholes_;
@@ -1,6 +1,8 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#include <cstring>
+
 #include "core/providers/cpu/sequence/concat_from_sequence.h"
 #include "core/framework/tensorprotoutils.h"
 #include "core/providers/cpu/tensor/utils.h"
@@ -39,6 +41,27 @@ Status ConcatFromSequence::Compute(OpKernelContext* ctx) const {
   if (p.output_num_elements == 0)
     return Status::OK();
 
+  // Fast path: when concatenating (or stacking) along axis 0, each input occupies one contiguous
+  // slab of the output in sequence order. If the elements are also laid out back-to-back in memory
+  // - which is how SplitToSequence produces them - the whole gather collapses into a single copy.
+  if (!p.is_string_type && p.axis == 0 && !p.inputs.empty()) {
+    const auto* base = static_cast<const char*>(p.inputs[0].tensor->DataRaw());
+    const auto* expected_next = base;
+    bool contiguous = true;
+    for (const auto& input : p.inputs) {
+      if (static_cast<const char*>(input.tensor->DataRaw()) != expected_next) {
+        contiguous = false;
+        break;
+      }
+      expected_next += input.tensor->SizeInBytes();
+    }
+
+    if (contiguous) {
+      memcpy(p.output_tensor->MutableDataRaw(), base, static_cast<size_t>(expected_next - base));
+      return Status::OK();
+    }
+  }
+
   // Compute values to be placed in the output tensor
   return ComputeImpl(p, ctx);
 }
@@ -425,6 +425,22 @@ static int64_t GetScalarSplitInput(const Tensor& tensor) {
   return retval;
 }
 
+// Creates a sequence element as a view over 'backing' at 'byte_offset'. The OrtValue's deleter
+// holds a reference on the backing buffer, so the element (and any copy of it made by other
+// sequence ops) stays valid for as long as it is reachable, independent of the backing OrtValue
+// the kernel created.
+static OrtValue CreateViewOverBacking(const OrtValue& backing, MLDataType elem_type,
+                                      const TensorShape& shape, size_t byte_offset) {
+  const Tensor& backing_tensor = backing.Get<Tensor>();
+  auto* data = const_cast<char*>(static_cast<const char*>(backing_tensor.DataRaw())) + byte_offset;
+  auto view = std::make_unique<Tensor>(elem_type, shape, data, backing_tensor.Location());
+
+  OrtValue value;
+  value.Init(view.release(), DataTypeImpl::GetType<Tensor>(),
+             [backing](void* p) { delete static_cast<Tensor*>(p); });
+  return value;
+}
+
 static void GetSplitSizesInput(const Tensor& tensor, InlinedVector<int64_t>& split_sizes) {
   auto num_elems = tensor.Shape().Size();
   split_sizes.reserve(onnxruntime::narrow<size_t>(num_elems));
@@ -491,6 +507,24 @@ Status SplitToSequence::ComputeImpl(OpKernelContext& context, const Tensor& inpu
   auto output_dimensions = input_shape.AsShapeVector();
   SafeInt<size_t> input_offset = 0;
   const void* input_data = input.DataRaw();
+
+  AllocatorPtr alloc;
+  ORT_RETURN_IF_ERROR(context.GetTempSpaceAllocator(&alloc));
+
+  // For non-string types all elements are written into one backing buffer, laid out back-to-back,
+  // and the sequence elements are views over it. Compared with one tensor per element this makes a
+  // single allocation, and leaves the elements contiguous so ConcatFromSequence can gather them
+  // back with a single copy. Views directly over the node's own input are deliberately not used:
+  // the allocation planner may hand the input's buffer to a downstream value while the sequence is
+  // still alive.
+  OrtValue backing;
+  char* backing_data = nullptr;
+  if (!is_string_type) {
+    Tensor::InitOrtValue(input.DataType(), TensorShape({input_shape.Size()}), alloc, backing);
+    backing_data = static_cast<char*>(backing.GetMutable<Tensor>()->MutableDataRaw());
+  }
+  size_t backing_offset_bytes = 0;
+
   for (int i = 0; i < num_outputs; ++i) {
     // update size of dimension for axis we're splitting on while considering uneven split
     int split_size;
@@ -501,22 +535,31 @@ Status SplitToSequence::ComputeImpl(OpKernelContext& context, const Tensor& inpu
     }
     output_dimensions[onnxruntime::narrow<size_t>(axis)] = split_size;
 
-    AllocatorPtr alloc;
-    ORT_RETURN_IF_ERROR(context.GetTempSpaceAllocator(&alloc));
-    Tensor output_tensor(input.DataType(), onnxruntime::TensorShape(output_dimensions), alloc);
-    void* output_data = output_tensor.MutableDataRaw();
+    // if keep_dims = 0, drop the dimension corresponding to 'axis' from the element shape
+    TensorShape element_shape{output_dimensions};
+    if (use_keep_dims && keepdims_ == 0) {
+      TensorShapeVector new_dims;
+      new_dims.reserve(output_dimensions.size() - 1);
+      for (int64_t idx = 0, end = static_cast<int64_t>(output_dimensions.size()); idx < end; ++idx) {
+        if (idx != axis) {
+          new_dims.push_back(output_dimensions[onnxruntime::narrow<size_t>(idx)]);
+        }
+      }
+      element_shape = TensorShape(new_dims);
+    }
 
     const auto M = before_dims;
     const auto* A = static_cast<const char*>(input_data) + static_cast<size_t>(input_offset * element_size);
     const auto lda = after_dims_including_split_axis;
-    auto* B = output_data;
 
     const auto N = split_size * after_dims_excluding_split;
     const auto ldb = N;
 
     if (is_string_type) {
+      Tensor output_tensor(input.DataType(), element_shape, alloc);
+
       const auto* src = reinterpret_cast<const std::string*>(A);
-      auto* dst = reinterpret_cast<std::string*>(B);
+      auto* dst = output_tensor.MutableData<std::string>();
       if (lda == N) {
         copy_data<std::string>(src, dst, static_cast<size_t>(M * N));
       } else {
@@ -527,7 +570,11 @@ Status SplitToSequence::ComputeImpl(OpKernelContext& context, const Tensor& inpu
           copy_data<std::string>(src + lda_offset, dst + ldb_offset, static_cast<size_t>(N));
         }
       }
+
+      tseq->Add(std::move(output_tensor));
     } else {
+      auto* B = backing_data + backing_offset_bytes;
+
       if (lda == N) {
         // if the data is contiguous, we can just copy the data
         const size_t bytes_to_copy = static_cast<size_t>(N) * static_cast<size_t>(M) * element_size;
@@ -541,28 +588,16 @@ Status SplitToSequence::ComputeImpl(OpKernelContext& context, const Tensor& inpu
         SafeInt<size_t> ldb_bytes_offset = 0;
         for (size_t idx = 0; idx < static_cast<size_t>(M); ++idx,
                     lda_bytes_offset += lda_bytes_inc, ldb_bytes_offset += ldb_bytes_inc) {
-          memcpy(reinterpret_cast<char*>(B) + static_cast<size_t>(ldb_bytes_offset),
+          memcpy(B + static_cast<size_t>(ldb_bytes_offset),
                  reinterpret_cast<const char*>(A) + static_cast<size_t>(lda_bytes_offset), row_bytes);
         }
       }
-    }
 
-    input_offset += SafeInt<size_t>(split_size) * after_dims_excluding_split;  // offset by the N data we used in this iteration
-
-    // if keep_dims = 0, reshape the tensor by dropping the dimension corresponding to 'axis'
-    if (use_keep_dims && keepdims_ == 0) {
-      TensorShapeVector new_dims;
-      new_dims.reserve(output_dimensions.size() - 1);
-      for (int64_t idx = 0, end = static_cast<int64_t>(output_dimensions.size()); idx < end; ++idx) {
-        if (idx != axis) {
-          new_dims.push_back(output_dimensions[onnxruntime::narrow<size_t>(idx)]);
-        }
-      }
-      output_tensor.Reshape(new_dims);
+      tseq->Add(CreateViewOverBacking(backing, input.DataType(), element_shape, backing_offset_bytes));
+      backing_offset_bytes += static_cast<size_t>(M) * static_cast<size_t>(N) * element_size;
     }
 
-    // finally move the resulting tensor to the output sequence
-    tseq->Add(std::move(output_tensor));
+    input_offset += SafeInt<size_t>(split_size) * after_dims_excluding_split;  // offset by the N data we used in this iteration
   }
 
   return Status::OK();
@@ -1,17 +1,42 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#include <complex>
+
 #include "core/common/common.h"
+#include "core/common/inlined_containers.h"
 #include "core/framework/op_kernel.h"
+#include "core/framework/tensor.h"
+#include "core/platform/ort_mutex.h"
 
 namespace onnxruntime {
 
+// Cached per-length DFT state (a "plan"): the bit-reversal permutation and twiddle factors used
+// by the radix-2 kernel, scratch space for onesided output, and the precomputed chirp / b_fft
+// signals used by the Bluestein fallback for non power-of-two lengths. All of it only depends on
+// the transform length (and direction, which is fixed per kernel instance), so kernels keep a
+// plan per element type and rebuild it only when the length changes instead of on every Run.
+template <typename T>
+struct DftPlan {
+  InlinedVector<size_t> bit_reversal;
+  InlinedVector<std::complex<T>> V;
+  InlinedVector<std::complex<T>> temp_output;
+  Tensor b_fft;
+  Tensor chirp;
+};
+
 class DFT final : public OpKernel {
   int opset_;
   bool is_onesided_ = true;
   int64_t axis_ = 0;
   bool is_inverse_ = false;
 
+  // Compute() is const and may run concurrently for the same kernel; the cached plans are reused
+  // under plan_mutex_, and a concurrent Run that loses the race falls back to a throwaway plan.
+  mutable OrtMutex plan_mutex_;
+  mutable DftPlan<float> plan_float_;
+  mutable DftPlan<double> plan_double_;
+
  public:
   explicit DFT(const OpKernelInfo& info) : OpKernel(info) {
     is_onesided_ = static_cast<bool>(info.GetAttrOrDefault<int64_t>("onesided", 0));
@@ -28,6 +53,12 @@ class DFT final : public OpKernel {
 class STFT final : public OpKernel {
   bool is_onesided_ = true;
 
+  // See the comment on the DFT members; STFT runs one DFT per frame, so plan reuse pays off both
+  // across frames within a Run and across Runs.
+  mutable OrtMutex plan_mutex_;
+  mutable DftPlan<float> plan_float_;
+  mutable DftPlan<double> plan_double_;
+
  public:
   explicit STFT(const OpKernelInfo& info) : OpKernel(info) {
     is_onesided_ = static_cast<bool>(info.GetAttrOrDefault<int64_t>("onesided", 1));
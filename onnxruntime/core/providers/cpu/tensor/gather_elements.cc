@@ -6,6 +6,7 @@
 #include "onnxruntime_config.h"
 
 #include "core/util/force_inline.h"
+#include "core/util/prefetch.h"
 
 namespace onnxruntime {
 
@@ -78,6 +79,20 @@ ORT_FORCEINLINE int64_t GetIndex(size_t i, const T* indices, int64_t axis_size)
   return index;
 };
 
+// How many iterations ahead of the gather loop elements are prefetched; the
+// reads are data dependent so the hardware prefetcher cannot resolve them.
+constexpr size_t kGatherElementsPrefetchAhead = 8;
+
+// Index resolution for prefetching: unlike GetIndex this must not throw, an
+// out of range index is reported by the copy loop when it reaches it.
+template <typename T>
+ORT_FORCEINLINE int64_t PeekIndex(size_t i, const T* indices, int64_t axis_size) {
+  int64_t index = indices[i];
+  if (index < 0)
+    index += axis_size;
+  return index;
+};
+
 #ifdef __GNUC__
 #pragma GCC diagnostic push
 #ifdef HAS_CLASS_MEMACCESS
@@ -116,11 +131,23 @@ static void core_impl(const Tensor* input_tensor, const Tensor* indices_tensor,
         auto indices = indices_data + inner_dim_size * inner_dim;
 
         if (innermost_axis) {
-          for (size_t i = 0; i < inner_dim_size; i++)
+          for (size_t i = 0; i < inner_dim_size; i++) {
+            if (i + kGatherElementsPrefetchAhead < inner_dim_size) {
+              int64_t next = PeekIndex(i + kGatherElementsPrefetchAhead, indices, axis_size);
+              if (next >= 0 && next < axis_size)
+                PrefetchForRead(input + next);
+            }
             output[i] = input[GetIndex(i, indices, axis_size)];
+          }
         } else {
-          for (size_t i = 0; i < inner_dim_size; i++)
+          for (size_t i = 0; i < inner_dim_size; i++) {
+            if (i + kGatherElementsPrefetchAhead < inner_dim_size) {
+              int64_t next = PeekIndex(i + kGatherElementsPrefetchAhead, indices, axis_size);
+              if (next >= 0 && next < axis_size)
+                PrefetchForRead(input + next * axis_pitch + i + kGatherElementsPrefetchAhead);
+            }
             output[i] = input[GetIndex(i, indices, axis_size) * axis_pitch + i];
+          }
         }
       }
       ORT_CATCH(const std::exception&) {
@@ -3,6 +3,9 @@
 
 #include "core/providers/cpu/tensor/scatter_nd.h"
 
+#include <algorithm>
+#include <numeric>
+
 #include "core/framework/element_type_lists.h"
 #include "core/framework/op_kernel_type_control_utils.h"
 #include "core/platform/threadpool.h"
@@ -396,8 +399,53 @@ struct ScatterNDDispatchTarget {
         } break;
       }
     };
+    const size_t num_updates = prepare.element_offsets.size();
+
+    if (reduction != ScatterND::Reduction::None && num_updates > 1) {
+      // Reduction modes read-modify-write the destination slice, so duplicate indices make the
+      // flat parallel loop below a data race. All offsets are multiples of element_to_copy, which
+      // means two destination slices are either identical or disjoint: grouping the updates by
+      // offset and handing whole groups to the thread pool keeps every output slice owned by a
+      // single thread, with no atomics needed. Sorting ties by update index also makes the
+      // application order of duplicates deterministic (ascending, matching the sequential loop).
+      std::vector<size_t> sorted_updates(num_updates);
+      std::iota(sorted_updates.begin(), sorted_updates.end(), static_cast<size_t>(0));
+      std::sort(sorted_updates.begin(), sorted_updates.end(),
+                [&prepare](size_t a, size_t b) {
+                  return prepare.element_offsets[a] != prepare.element_offsets[b]
+                             ? prepare.element_offsets[a] < prepare.element_offsets[b]
+                             : a < b;
+                });
+
+      std::vector<size_t> group_begins;
+      for (size_t k = 0; k < num_updates; ++k) {
+        if (k == 0 ||
+            prepare.element_offsets[sorted_updates[k]] != prepare.element_offsets[sorted_updates[k - 1]]) {
+          group_begins.push_back(k);
+        }
+      }
+      group_begins.push_back(num_updates);
+
+      const size_t num_groups = group_begins.size() - 1;
+      const double cost_per_group =
+          static_cast<double>(prepare.element_to_copy) * static_cast<double>(num_updates) /
+          static_cast<double>(num_groups);
+      concurrency::ThreadPool::TryParallelFor(
+          tp, num_groups, cost_per_group,
+          [&lambda, &sorted_updates, &group_begins](ptrdiff_t first, ptrdiff_t last) {
+            for (ptrdiff_t g = first; g < last; ++g) {
+              for (size_t k = group_begins[g], end = group_begins[g + 1]; k < end; ++k) {
+                lambda(static_cast<int64_t>(sorted_updates[k]));
+              }
+            }
+          });
+      return Status::OK();
+    }
+
+    // Reduction::None: duplicate indices have unspecified behavior per the ONNX spec, so the
+    // updates can be applied independently.
     concurrency::ThreadPool::TryParallelFor(
-        tp, prepare.element_offsets.size(), static_cast<double>(prepare.element_to_copy),
+        tp, num_updates, static_cast<double>(prepare.element_to_copy),
         [&lambda](ptrdiff_t first, ptrdiff_t last) {
           for (int i = static_cast<int>(first), end = static_cast<int>(last); i < end; ++i) {
             lambda(i);
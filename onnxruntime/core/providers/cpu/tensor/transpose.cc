@@ -450,21 +450,45 @@ Status Transpose::Compute(OpKernelContext* ctx) const {
     return Status::OK();
   }
 
+#ifdef ENABLE_STRIDED_TENSORS
+  // If the planner arranged for the output to share the input's buffer (see MayStridedOutput on
+  // the kernel defs below), publish a permuted view instead of materializing the transpose.
+  // Every consumer declared MayStridedInput for the corresponding argument, so they all handle
+  // the strided layout.
+  if (Y.MutableDataRaw() == X.DataRaw()) {
+    gsl::span<const int64_t> input_strides = X.Strides();
+    TensorShapeVector output_strides(rank);
+    for (size_t i = 0; i < rank; ++i) {
+      output_strides[i] = input_strides[(*p_perm)[i]];
+    }
+    Y.SetShapeAndStrides(output_shape, output_strides);
+    return Status::OK();
+  }
+#endif
+
   return DoTranspose(*p_perm, X, Y, nullptr, ctx->GetOperatorThreadPool());
 }
 
+#ifdef ENABLE_STRIDED_TENSORS
+// The output may be published as a strided view over the input's buffer when every consumer
+// declares MayStridedInput for the consuming argument.
+#define TRANSPOSE_CPU_KERNEL_DEF KernelDefBuilder().MayStridedOutput(0, 0)
+#else
+#define TRANSPOSE_CPU_KERNEL_DEF KernelDefBuilder()
+#endif
+
 ONNX_CPU_OPERATOR_VERSIONED_KERNEL(
     Transpose,
     1,
     12,
-    KernelDefBuilder().TypeConstraint("T", BuildKernelDefConstraintsFromTypeList<EnabledDataTypesAllOpsets>()),
+    TRANSPOSE_CPU_KERNEL_DEF.TypeConstraint("T", BuildKernelDefConstraintsFromTypeList<EnabledDataTypesAllOpsets>()),
     Transpose);
 
 ONNX_CPU_OPERATOR_VERSIONED_KERNEL(
     Transpose,
     13,
     20,
-    KernelDefBuilder().TypeConstraint("T", BuildKernelDefConstraintsFromTypeList<EnabledDataTypesAllOpsets>()),
+    TRANSPOSE_CPU_KERNEL_DEF.TypeConstraint("T", BuildKernelDefConstraintsFromTypeList<EnabledDataTypesAllOpsets>()),
     Transpose);
 
 // Opset 21 added support for float8e4m3fnuz, float8e5m2, float8e5m2fnuz, int4 and uint4.
@@ -472,7 +496,9 @@ ONNX_CPU_OPERATOR_VERSIONED_KERNEL(
 ONNX_CPU_OPERATOR_KERNEL(
     Transpose,
     21,
-    KernelDefBuilder().TypeConstraint("T", BuildKernelDefConstraintsFromTypeList<EnabledDataTypesOpset21>()),
+    TRANSPOSE_CPU_KERNEL_DEF.TypeConstraint("T", BuildKernelDefConstraintsFromTypeList<EnabledDataTypesOpset21>()),
     Transpose);
 
+#undef TRANSPOSE_CPU_KERNEL_DEF
+
 }  // namespace onnxruntime
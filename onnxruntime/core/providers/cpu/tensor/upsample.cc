@@ -985,7 +985,6 @@ void ResizeBiCubic(int64_t batch_size,
   x_original.reserve(narrow<size_t>(output_width));
 
   std::unordered_map<float, std::array<float, CubicModeGridLength>> cubic_coeffs;
-  std::unordered_map<float, std::unordered_map<int64_t, float>> coeff_to_1Dinterpolation_map;
   auto roi_y_start = roi.size() / 2 - 2;
   auto roi_y_end = roi.size() - 2;
   auto roi_x_start = roi.size() / 2 - 1;
@@ -1002,11 +1001,14 @@ void ResizeBiCubic(int64_t batch_size,
     auto s = y_original[narrow<size_t>(y)] - std::floor(y_original[narrow<size_t>(y)]);
     if (cubic_coeffs.find(s) == cubic_coeffs.end()) {
       cubic_coeffs[s] = GetCubicCoeffs(s, cubic_coeff_a);
-      coeff_to_1Dinterpolation_map[s] = {};
     }
   }
 
-  // generate coefficients in x direction
+  // generate coefficients in x direction. x positions sharing the same fractional offset share a
+  // coefficient table and a 1D interpolation cache, identified by cache id.
+  std::unordered_map<float, int32_t> coeff_to_cache_id;
+  std::vector<int32_t> x_cache_ids;
+  x_cache_ids.reserve(narrow<size_t>(output_width));
   for (int64_t x = 0; x < output_width; ++x) {
     float in_x = width_scale == 1 ? static_cast<float>(x)
                                   : get_original_coordinate(static_cast<float>(x),
@@ -1018,15 +1020,59 @@ void ResizeBiCubic(int64_t batch_size,
     auto s = x_original[narrow<size_t>(x)] - std::floor(x_original[narrow<size_t>(x)]);
     if (cubic_coeffs.find(s) == cubic_coeffs.end()) {
       cubic_coeffs[s] = GetCubicCoeffs(s, cubic_coeff_a);
-      coeff_to_1Dinterpolation_map[s] = {};
     }
+    auto inserted = coeff_to_cache_id.emplace(s, static_cast<int32_t>(coeff_to_cache_id.size()));
+    x_cache_ids.push_back(inserted.first->second);
   }
 
-  // setup up temp arrays to hold coefficients when exclude_outside is set to true
-  std::array<float, CubicModeGridLength> y_coeff_holder;
-  std::array<float, CubicModeGridLength> x_coeff_holder;
-  float y_coeff_sum = 1;
-  float x_coeff_sum = 1;
+  std::vector<std::unordered_map<int64_t, float>> interpolation_caches(coeff_to_cache_id.size());
+
+  // Resolve the per-row and per-column coefficients (including the exclude_outside
+  // renormalization, which only depends on the position along one axis) up front, so the
+  // per-pixel loop below is free of hash lookups and coefficient recomputation.
+  std::vector<int64_t> y_ints(narrow<size_t>(output_height));
+  std::vector<std::array<float, CubicModeGridLength>> y_coeffs(narrow<size_t>(output_height));
+  std::vector<float> y_coeff_sums(narrow<size_t>(output_height), 1.0f);
+  for (int64_t y = 0; y < output_height; ++y) {
+    auto in_y = y_original[narrow<size_t>(y)];
+    auto y_int = static_cast<int64_t>(std::floor(in_y));
+    y_ints[narrow<size_t>(y)] = y_int;
+    y_coeffs[narrow<size_t>(y)] = cubic_coeffs[in_y - y_int];
+
+    if (exclude_outside) {
+      // When true, the weight of sampling locations outside the grid will be set to 0
+      // and the weight will be renormalized so that their sum is 1.0
+      float y_coeff_sum = 0;
+      for (int64_t i = 0, y_val = y_int - 1; y_val <= y_int + 2; y_val++, i++) {
+        if (y_val < 0 || y_val >= static_cast<float>(input_height)) {
+          y_coeffs[narrow<size_t>(y)][narrow<size_t>(i)] = 0.0f;
+        }
+        y_coeff_sum += y_coeffs[narrow<size_t>(y)][narrow<size_t>(i)];
+      }
+      y_coeff_sums[narrow<size_t>(y)] = y_coeff_sum;
+    }
+  }
+
+  std::vector<int64_t> x_ints(narrow<size_t>(output_width));
+  std::vector<std::array<float, CubicModeGridLength>> x_coeffs(narrow<size_t>(output_width));
+  std::vector<float> x_coeff_sums(narrow<size_t>(output_width), 1.0f);
+  for (int64_t x = 0; x < output_width; ++x) {
+    auto in_x = x_original[narrow<size_t>(x)];
+    auto x_int = static_cast<int64_t>(std::floor(in_x));
+    x_ints[narrow<size_t>(x)] = x_int;
+    x_coeffs[narrow<size_t>(x)] = cubic_coeffs[static_cast<float>(in_x - x_int)];
+
+    if (exclude_outside) {
+      float x_coeff_sum = 0;
+      for (int64_t i = 0, x_val = x_int - 1; x_val <= x_int + 2; x_val++, i++) {
+        if (x_val < 0 || x_val >= static_cast<float>(input_width)) {
+          x_coeffs[narrow<size_t>(x)][narrow<size_t>(i)] = 0.0f;
+        }
+        x_coeff_sum += x_coeffs[narrow<size_t>(x)][narrow<size_t>(i)];
+      }
+      x_coeff_sums[narrow<size_t>(x)] = x_coeff_sum;
+    }
+  }
 
   for (int64_t n = 0; n < batch_size; n++) {
     for (int64_t c = 0; c < num_channels; c++) {
@@ -1042,20 +1088,9 @@ void ResizeBiCubic(int64_t batch_size,
           continue;
         }
 
-        auto y_int = static_cast<int64_t>(std::floor(in_y));
-        auto& coeff_y = exclude_outside ? y_coeff_holder : cubic_coeffs[in_y - y_int];
-        y_coeff_sum = 1;
-
-        if (exclude_outside) {
-          // When true, the weight of sampling locations outside the grid will be set to 0
-          // and the weight will be renormalized so that their sum is 1.0
-          y_coeff_sum = 0;
-          auto& orig_y_coeffs = cubic_coeffs[in_y - y_int];
-          for (int64_t i = 0, y_val = y_int - 1; y_val <= y_int + 2; y_val++, i++) {
-            y_coeff_holder[narrow<size_t>(i)] = (y_val < 0 || y_val >= static_cast<float>(input_height)) ? 0.0f : orig_y_coeffs[narrow<size_t>(i)];
-            y_coeff_sum += y_coeff_holder[narrow<size_t>(i)];
-          }
-        }
+        const auto y_int = y_ints[narrow<size_t>(y)];
+        auto& coeff_y = y_coeffs[narrow<size_t>(y)];
+        const float y_coeff_sum = y_coeff_sums[narrow<size_t>(y)];
 
         for (int64_t x = 0; x < output_width; ++x) {
           auto in_x = x_original[narrow<size_t>(x)];
@@ -1067,25 +1102,13 @@ void ResizeBiCubic(int64_t batch_size,
             continue;
           }
 
-          auto x_int = static_cast<int64_t>(std::floor(in_x));
-          auto s_x = static_cast<float>(in_x - x_int);
-          auto& coeff_x = exclude_outside ? x_coeff_holder : cubic_coeffs[s_x];
-          x_coeff_sum = 1;
-
-          if (exclude_outside) {
-            // When true, the weight of sampling locations outside the grid will be set to 0
-            // and the weight will be renormalized so that their sum is 1.0
-            x_coeff_sum = 0;
-            auto& orig_x_coeff = cubic_coeffs[s_x];
-            for (int64_t i = 0, x_val = x_int - 1; x_val <= x_int + 2; x_val++, i++) {
-              x_coeff_holder[narrow<size_t>(i)] = (x_val < 0 || x_val >= static_cast<float>(input_width)) ? 0.0f : orig_x_coeff[narrow<size_t>(i)];
-              x_coeff_sum += x_coeff_holder[narrow<size_t>(i)];
-            }
-          }
+          const auto x_int = x_ints[narrow<size_t>(x)];
+          auto& coeff_x = x_coeffs[narrow<size_t>(x)];
+          const float x_coeff_sum = x_coeff_sums[narrow<size_t>(x)];
 
           // Compute cubic interpolation in x dimension using the x coefficients.
           // From the result of cubic interpolation in x dim, compute cubic interpolation in y dimension
-          auto& interpolation_result_cache = coeff_to_1Dinterpolation_map[s_x];
+          auto& interpolation_result_cache = interpolation_caches[x_cache_ids[narrow<size_t>(x)]];
           float result = 0;
           for (int64_t y_val = y_int - 1, i = 0; y_val <= y_int + 2; y_val++, i++) {
             auto x_interpolation_result = CubicInterpolation1D(Xdata, x_int, y_val,
@@ -1101,8 +1124,10 @@ void ResizeBiCubic(int64_t batch_size,
       Xdata += input_height * input_width;
       Ydata += output_height * output_width;
 
-      // clear the cache when moving to the next channel
-      coeff_to_1Dinterpolation_map.clear();
+      // clear the 1D interpolation caches when moving to the next channel
+      for (auto& cache : interpolation_caches) {
+        cache.clear();
+      }
     }
   }
 }
@@ -1211,6 +1236,27 @@ Status Upsample<T>::BaseCompute(OpKernelContext* context,
           }
         }
 
+        // Coefficient tables only depend on the shapes/scales/roi, which are stable across Run
+        // calls in the typical video preprocessing pipeline, so they are cached on the kernel.
+        const auto setup_bilinear_params = [&](bool is_nchw_params) {
+          return this->template GetOrCreateBilinearParams<BilinearParams>(
+              bilinear_params_cache_, input_height, input_width, output_height, output_width,
+              height_scale, width_scale, roi, is_nchw_params, [&]() {
+                return SetupUpsampleBilinear(input_height, input_width, output_height, output_width,
+                                             height_scale, width_scale, roi,
+                                             alloc, get_original_coordinate_, is_nchw_params);
+              });
+        };
+        const auto setup_bilinear_params_integer = [&](bool is_nchw_params) {
+          return this->template GetOrCreateBilinearParams<BilinearParamsInteger>(
+              bilinear_params_integer_cache_, input_height, input_width, output_height, output_width,
+              height_scale, width_scale, roi, is_nchw_params, [&]() {
+                return SetupUpsampleBilinearInteger(input_height, input_width, output_height, output_width,
+                                                    height_scale, width_scale, roi,
+                                                    alloc, get_original_coordinate_, is_nchw_params);
+              });
+        };
+
         if (is_nchw) {
           if (antialias_) {
             UpsampleBilinearAntiAlias(batch_size, num_channels, input_height, input_width, output_height, output_width,
@@ -1219,9 +1265,9 @@ Status Upsample<T>::BaseCompute(OpKernelContext* context,
                                       output_height * output_width > 64 ? context->GetOperatorThreadPool() : nullptr);
           } else {
             UpsampleBilinear(batch_size, num_channels, input_height, input_width, output_height, output_width,
-                             height_scale, width_scale, roi,
+                             *setup_bilinear_params(true),
                              use_extrapolation_, extrapolation_value_, X->Data<T>(),
-                             Y->MutableData<T>(), alloc, get_original_coordinate_,
+                             Y->MutableData<T>(),
                              output_height * output_width > 64 ? context->GetOperatorThreadPool() : nullptr);
           }
         } else {
@@ -1237,14 +1283,12 @@ Status Upsample<T>::BaseCompute(OpKernelContext* context,
                    Y->GetElementType() == ONNX_NAMESPACE::TensorProto_DataType_INT8)) {
                 NhwcUpsampleBilinearInteger<T, true>(
                     batch_size, num_channels, input_height, input_width, output_height, output_width,
-                    height_scale, width_scale, roi, extrapolation_value_, X->Data<T>(), Y->MutableData<T>(),
-                    alloc, get_original_coordinate_,
+                    *setup_bilinear_params_integer(false), extrapolation_value_, X->Data<T>(), Y->MutableData<T>(),
                     output_height * output_width * num_channels > 64 ? context->GetOperatorThreadPool() : nullptr);
               } else {
                 NhwcUpsampleBilinear<T, true>(
                     batch_size, num_channels, input_height, input_width, output_height, output_width,
-                    height_scale, width_scale, roi, extrapolation_value_, X->Data<T>(), Y->MutableData<T>(),
-                    alloc, get_original_coordinate_,
+                    *setup_bilinear_params(false), extrapolation_value_, X->Data<T>(), Y->MutableData<T>(),
                     output_height * output_width * num_channels > 64 ? context->GetOperatorThreadPool() : nullptr);
               }
             }
@@ -1260,14 +1304,12 @@ Status Upsample<T>::BaseCompute(OpKernelContext* context,
                    Y->GetElementType() == ONNX_NAMESPACE::TensorProto_DataType_INT8)) {
                 NhwcUpsampleBilinearInteger<T, false>(
                     batch_size, num_channels, input_height, input_width, output_height, output_width,
-                    height_scale, width_scale, roi, extrapolation_value_, X->Data<T>(), Y->MutableData<T>(),
-                    alloc, get_original_coordinate_,
+                    *setup_bilinear_params_integer(false), extrapolation_value_, X->Data<T>(), Y->MutableData<T>(),
                     output_height * output_width * num_channels > 64 ? context->GetOperatorThreadPool() : nullptr);
               } else {
                 NhwcUpsampleBilinear<T, false>(
                     batch_size, num_channels, input_height, input_width, output_height, output_width,
-                    height_scale, width_scale, roi, extrapolation_value_, X->Data<T>(), Y->MutableData<T>(),
-                    alloc, get_original_coordinate_,
+                    *setup_bilinear_params(false), extrapolation_value_, X->Data<T>(), Y->MutableData<T>(),
                     output_height * output_width * num_channels > 64 ? context->GetOperatorThreadPool() : nullptr);
               }
             }
@@ -3,10 +3,14 @@
 
 #pragma once
 
+#include <memory>
+#include <mutex>
+#include <utility>
 #include <vector>
 #ifndef SHARED_PROVIDER
 #include "core/framework/op_kernel.h"
 #endif
+#include "core/common/inlined_containers.h"
 #include "core/providers/cpu/tensor/upsamplebase.h"
 #if defined(_MSC_VER) && !defined(__clang__)
 #pragma warning(push)
@@ -58,6 +62,24 @@ struct BilinearParamsInteger {
   int32_t* dy2_scale_10{nullptr};
 };
 
+// Single-slot, kernel-local cache for the bilinear coefficient tables. Pipelines that resize
+// every frame with the same shapes (the common video preprocessing case) recompute identical
+// tables on every Run call otherwise. The key holds everything the tables are derived from;
+// anything else (coordinate transformation mode etc.) is fixed per kernel instance.
+template <typename Params>
+struct CachedBilinearParams {
+  std::mutex mutex;
+  int32_t input_height{-1};
+  int32_t input_width{-1};
+  int32_t output_height{-1};
+  int32_t output_width{-1};
+  float height_scale{};
+  float width_scale{};
+  InlinedVector<float> roi;
+  bool is_nchw{};
+  std::shared_ptr<const Params> params;
+};
+
 template <typename T>
 class Upsample : public UpsampleBase, public OpKernel {
  public:
@@ -68,6 +90,48 @@ class Upsample : public UpsampleBase, public OpKernel {
 
   Status BaseCompute(OpKernelContext* context, gsl::span<const float> roi, gsl::span<const float> scales,
                      gsl::span<const int64_t> output_dims) const;
+
+ private:
+  // Returns the cached coefficient tables when the cache key matches, otherwise recomputes them
+  // via 'setup' and replaces the cache entry. The returned tables are shared and immutable so
+  // concurrent Run calls can use them while another Run replaces the entry.
+  template <typename Params, typename Setup>
+  std::shared_ptr<const Params> GetOrCreateBilinearParams(CachedBilinearParams<Params>& cache,
+                                                          int32_t input_height, int32_t input_width,
+                                                          int32_t output_height, int32_t output_width,
+                                                          float height_scale, float width_scale,
+                                                          gsl::span<const float> roi, bool is_nchw,
+                                                          const Setup& setup) const {
+    {
+      std::lock_guard<std::mutex> lock(cache.mutex);
+      if (cache.params != nullptr &&
+          cache.input_height == input_height && cache.input_width == input_width &&
+          cache.output_height == output_height && cache.output_width == output_width &&
+          cache.height_scale == height_scale && cache.width_scale == width_scale &&
+          cache.is_nchw == is_nchw &&
+          cache.roi.size() == roi.size() && std::equal(cache.roi.begin(), cache.roi.end(), roi.begin())) {
+        return cache.params;
+      }
+    }
+
+    // compute outside the lock; losing a race just means the table is built twice
+    auto params = std::make_shared<const Params>(setup());
+
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    cache.input_height = input_height;
+    cache.input_width = input_width;
+    cache.output_height = output_height;
+    cache.output_width = output_width;
+    cache.height_scale = height_scale;
+    cache.width_scale = width_scale;
+    cache.roi.assign(roi.begin(), roi.end());
+    cache.is_nchw = is_nchw;
+    cache.params = params;
+    return params;
+  }
+
+  mutable CachedBilinearParams<BilinearParams> bilinear_params_cache_;
+  mutable CachedBilinearParams<BilinearParamsInteger> bilinear_params_integer_cache_;
 };
 
 BilinearParams SetupUpsampleBilinear(const int32_t input_height,
@@ -88,19 +152,12 @@ void UpsampleBilinear(const int32_t batch_size,
                       const int32_t input_width,
                       const int32_t output_height,
                       const int32_t output_width,
-                      const float height_scale,
-                      const float width_scale,
-                      gsl::span<const float> roi,
+                      const BilinearParams& p,
                       const bool use_extrapolation,
                       const float extrapolation_value,
                       const T* const XdataBase,
                       T* const YdataBase,
-                      AllocatorPtr& alloc,
-                      const GetOriginalCoordinateFunc& get_original_coordinate,
                       concurrency::ThreadPool* tp) {
-  BilinearParams p = SetupUpsampleBilinear(input_height, input_width, output_height, output_width,
-                                           height_scale, width_scale, roi,
-                                           alloc, get_original_coordinate, true);
   for (int32_t n = 0; n < batch_size; ++n) {
     concurrency::ThreadPool::TrySimpleParallelFor(
         tp, num_channels,
@@ -109,26 +166,44 @@ void UpsampleBilinear(const int32_t batch_size,
               XdataBase + (n * num_channels + static_cast<int32_t>(c)) * (input_height * input_width);
           T* const Ydata = YdataBase + (n * num_channels + static_cast<int32_t>(c)) * (output_height * output_width);
           for (int32_t y = 0; y < output_height; ++y) {
-            for (int32_t x = 0; x < output_width; ++x) {
-              const int32_t output_offset = output_width * y + x;
-              // when use_extrapolation is set and original index of x or y is out of the dim range
-              // then use extrapolation_value as the output value.
-              if (use_extrapolation &&
-                  ((p.y_original[y] < 0 || p.y_original[y] > static_cast<float>(input_height - 1)) ||
-                   (p.x_original[x] < 0 || p.x_original[x] > static_cast<float>(input_width - 1)))) {
-                Ydata[output_offset] = static_cast<T>(extrapolation_value);
-                continue;
+            T* const Yrow = Ydata + output_width * y;
+
+            // when use_extrapolation is set and original index of x or y is out of the dim range
+            // then use extrapolation_value as the output value.
+            if (use_extrapolation &&
+                (p.y_original[y] < 0 || p.y_original[y] > static_cast<float>(input_height - 1))) {
+              for (int32_t x = 0; x < output_width; ++x) {
+                Yrow[x] = static_cast<T>(extrapolation_value);
               }
+              continue;
+            }
 
-              T X11 = Xdata[p.input_width_mul_y1[y] + p.in_x1[x]];
-              T X21 = Xdata[p.input_width_mul_y1[y] + p.in_x2[x]];
-              T X12 = Xdata[p.input_width_mul_y2[y] + p.in_x1[x]];
-              T X22 = Xdata[p.input_width_mul_y2[y] + p.in_x2[x]];
+            // hoist everything that only depends on the row
+            const T* const Xrow1 = Xdata + p.input_width_mul_y1[y];
+            const T* const Xrow2 = Xdata + p.input_width_mul_y2[y];
+            const float dy1 = p.dy1[y];
+            const float dy2 = p.dy2[y];
+
+            if (use_extrapolation) {
+              for (int32_t x = 0; x < output_width; ++x) {
+                if (p.x_original[x] < 0 || p.x_original[x] > static_cast<float>(input_width - 1)) {
+                  Yrow[x] = static_cast<T>(extrapolation_value);
+                  continue;
+                }
 
-              Ydata[output_offset] = static_cast<T>(p.dx2[x] * p.dy2[y] * X11 +
-                                                    p.dx1[x] * p.dy2[y] * X21 +
-                                                    p.dx2[x] * p.dy1[y] * X12 +
-                                                    p.dx1[x] * p.dy1[y] * X22);
+                Yrow[x] = static_cast<T>(p.dx2[x] * dy2 * Xrow1[p.in_x1[x]] +
+                                         p.dx1[x] * dy2 * Xrow1[p.in_x2[x]] +
+                                         p.dx2[x] * dy1 * Xrow2[p.in_x1[x]] +
+                                         p.dx1[x] * dy1 * Xrow2[p.in_x2[x]]);
+              }
+            } else {
+              // branch-free inner loop so the compiler can vectorize the weighting
+              for (int32_t x = 0; x < output_width; ++x) {
+                Yrow[x] = static_cast<T>(p.dx2[x] * dy2 * Xrow1[p.in_x1[x]] +
+                                         p.dx1[x] * dy2 * Xrow1[p.in_x2[x]] +
+                                         p.dx2[x] * dy1 * Xrow2[p.in_x1[x]] +
+                                         p.dx1[x] * dy1 * Xrow2[p.in_x2[x]]);
+              }
             }
           }
         });
@@ -142,18 +217,11 @@ void NhwcUpsampleBilinear(const int32_t batch_size,
                           const int32_t input_width,
                           const int32_t output_height,
                           const int32_t output_width,
-                          const float height_scale,
-                          const float width_scale,
-                          gsl::span<const float> roi,
+                          const BilinearParams& p,
                           const float extrapolation_value,
                           const T* const XdataBase,
                           T* const YdataBase,
-                          AllocatorPtr& alloc,
-                          const GetOriginalCoordinateFunc& get_original_coordinate,
                           concurrency::ThreadPool* tp) {
-  BilinearParams p = SetupUpsampleBilinear(input_height, input_width, output_height, output_width,
-                                           height_scale, width_scale, roi,
-                                           alloc, get_original_coordinate, false);
   for (int32_t n = 0; n < batch_size; ++n) {
     const T* const Xdata = XdataBase + n * (input_height * input_width) * num_channels;
     T* const Ydata = YdataBase + n * (output_height * output_width) * num_channels;
@@ -239,18 +307,11 @@ void NhwcUpsampleBilinearInteger(const int32_t batch_size,
                                  const int32_t input_width,
                                  const int32_t output_height,
                                  const int32_t output_width,
-                                 const float height_scale,
-                                 const float width_scale,
-                                 gsl::span<const float> roi,
+                                 const BilinearParamsInteger& p,
                                  const float extrapolation_value,
                                  const T* const XdataBase,
                                  T* const YdataBase,
-                                 AllocatorPtr& alloc,
-                                 const GetOriginalCoordinateFunc& get_original_coordinate,
                                  concurrency::ThreadPool* tp) {
-  BilinearParamsInteger p = SetupUpsampleBilinearInteger(input_height, input_width, output_height, output_width,
-                                                         height_scale, width_scale, roi,
-                                                         alloc, get_original_coordinate, false);
   for (int32_t n = 0; n < batch_size; ++n) {
     const T* const Xdata = XdataBase + n * (input_height * input_width) * num_channels;
     T* const Ydata = YdataBase + n * (output_height * output_width) * num_channels;
@@ -1,6 +1,8 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#include <limits>
+
 #include "cuda_allocator.h"
 #include "cuda_common.h"
 #include "gpu_data_transfer.h"
@@ -86,6 +88,171 @@ void* CUDAExternalAllocator::Reserve(size_t size) {
   return p;
 }
 
+namespace {
+
+// Driver API helpers for CUDAVmmAllocator. The throwing variant is for construction-time
+// failures; the logging variant is for Alloc(), which reports failure by returning nullptr
+// so BFCArena can back off and retry with a smaller request.
+void CuCallThrow(CUresult result, const char* name) {
+  if (result != CUDA_SUCCESS) {
+    const char* error_str = nullptr;
+    auto get_status_err_str = cuGetErrorString(result, &error_str);
+    ORT_UNUSED_PARAMETER(get_status_err_str);
+    ORT_THROW(name, " failed with ", error_str != nullptr ? error_str : "unknown error");
+  }
+}
+
+bool CuCallLog(CUresult result, const char* name) {
+  if (result != CUDA_SUCCESS) {
+    const char* error_str = nullptr;
+    auto get_status_err_str = cuGetErrorString(result, &error_str);
+    ORT_UNUSED_PARAMETER(get_status_err_str);
+    LOGS_DEFAULT(WARNING) << name << " failed with " << (error_str != nullptr ? error_str : "unknown error");
+    return false;
+  }
+  return true;
+}
+
+size_t RoundUp(size_t size, size_t granularity) {
+  return ((size + granularity - 1) / granularity) * granularity;
+}
+
+}  // namespace
+
+CUDAVmmAllocator::CUDAVmmAllocator(OrtDevice::DeviceId device_id, const char* name, size_t virtual_range_bytes)
+    : IAllocator(
+          OrtMemoryInfo(name, OrtAllocatorType::OrtDeviceAllocator,
+                        OrtDevice(OrtDevice::GPU, OrtDevice::MemType::DEFAULT, device_id),
+                        device_id, OrtMemTypeDefault)) {
+  // The driver API calls below operate on the current context, so make sure the primary context
+  // for the device exists and is current.
+  CUDA_CALL_THROW(cudaSetDevice(device_id));
+  CUDA_CALL_THROW(cudaFree(nullptr));
+
+  CUmemAllocationProp prop = {};
+  prop.type = CU_MEM_ALLOCATION_TYPE_PINNED;
+  prop.location.type = CU_MEM_LOCATION_TYPE_DEVICE;
+  prop.location.id = device_id;
+  CuCallThrow(cuMemGetAllocationGranularity(&granularity_, &prop, CU_MEM_ALLOC_GRANULARITY_MINIMUM),
+              "cuMemGetAllocationGranularity");
+
+  if (virtual_range_bytes == 0 || virtual_range_bytes == std::numeric_limits<size_t>::max()) {
+    // No explicit limit: reserve enough address space to map the whole device. Reserving virtual
+    // addresses does not commit any physical memory.
+    size_t free_bytes = 0;
+    size_t total_bytes = 0;
+    CUDA_CALL_THROW(cudaMemGetInfo(&free_bytes, &total_bytes));
+    virtual_range_bytes = total_bytes;
+  }
+
+  va_size_ = RoundUp(virtual_range_bytes, granularity_);
+  CuCallThrow(cuMemAddressReserve(&va_base_, va_size_, 0, 0, 0), "cuMemAddressReserve");
+}
+
+CUDAVmmAllocator::~CUDAVmmAllocator() {
+  // Release whatever is still mapped, then the address reservation. Do not throw; it's OK for
+  // these to fail during shutdown.
+  for (const auto& [p, extent] : extents_) {
+    cuMemUnmap(reinterpret_cast<CUdeviceptr>(p), extent.size);
+    cuMemRelease(extent.handle);
+  }
+  if (va_base_ != 0) {
+    cuMemAddressFree(va_base_, va_size_);
+  }
+}
+
+bool CUDAVmmAllocator::IsSupported(OrtDevice::DeviceId device_id) {
+  if (cudaSetDevice(device_id) != cudaSuccess || cudaFree(nullptr) != cudaSuccess) {
+    return false;
+  }
+
+  CUdevice device;
+  if (cuDeviceGet(&device, device_id) != CUDA_SUCCESS) {
+    return false;
+  }
+
+  int supported = 0;
+  if (cuDeviceGetAttribute(&supported, CU_DEVICE_ATTRIBUTE_VIRTUAL_ADDRESS_MANAGEMENT_SUPPORTED,
+                           device) != CUDA_SUCCESS) {
+    return false;
+  }
+
+  return supported != 0;
+}
+
+void* CUDAVmmAllocator::Alloc(size_t size) {
+  if (size == 0) {
+    return nullptr;
+  }
+
+  std::lock_guard<OrtMutex> lock(lock_);
+
+  const size_t mapped_size = RoundUp(size, granularity_);
+  if (mapped_size > va_size_ - mapped_bytes_) {
+    // Out of reserved address space. Return nullptr so BFCArena backs off on the request size.
+    return nullptr;
+  }
+
+  CUmemAllocationProp prop = {};
+  prop.type = CU_MEM_ALLOCATION_TYPE_PINNED;
+  prop.location.type = CU_MEM_LOCATION_TYPE_DEVICE;
+  prop.location.id = Info().id;
+
+  CUmemGenericAllocationHandle handle;
+  if (!CuCallLog(cuMemCreate(&handle, mapped_size, &prop, 0), "cuMemCreate")) {
+    return nullptr;
+  }
+
+  CUdeviceptr ptr = va_base_ + mapped_bytes_;
+  if (!CuCallLog(cuMemMap(ptr, mapped_size, 0, handle, 0), "cuMemMap")) {
+    cuMemRelease(handle);
+    return nullptr;
+  }
+
+  CUmemAccessDesc access = {};
+  access.location.type = CU_MEM_LOCATION_TYPE_DEVICE;
+  access.location.id = Info().id;
+  access.flags = CU_MEM_ACCESS_FLAGS_PROT_READWRITE;
+  if (!CuCallLog(cuMemSetAccess(ptr, mapped_size, &access, 1), "cuMemSetAccess")) {
+    cuMemUnmap(ptr, mapped_size);
+    cuMemRelease(handle);
+    return nullptr;
+  }
+
+  mapped_bytes_ += mapped_size;
+  void* p = reinterpret_cast<void*>(ptr);
+  extents_.emplace(p, Extent{handle, mapped_size});
+  return p;
+}
+
+void CUDAVmmAllocator::Free(void* p) {
+  if (p == nullptr) {
+    return;
+  }
+
+  std::lock_guard<OrtMutex> lock(lock_);
+
+  auto it = extents_.find(p);
+  if (it == extents_.end()) {
+    // BFCArena frees a region it grew in place with a single call on the region's base pointer;
+    // the extents that were mapped to grow that region are released by the destructor.
+    return;
+  }
+
+  cuMemUnmap(reinterpret_cast<CUdeviceptr>(p), it->second.size);
+  cuMemRelease(it->second.handle);
+  extents_.erase(it);
+
+  // Everything above the highest remaining extent is unmapped, so pull the mapping break back
+  // down to let that address space be remapped by later allocations.
+  if (extents_.empty()) {
+    mapped_bytes_ = 0;
+  } else {
+    const auto& last = *extents_.rbegin();
+    mapped_bytes_ = (reinterpret_cast<CUdeviceptr>(last.first) - va_base_) + last.second.size;
+  }
+}
+
 void* CUDAPinnedAllocator::Alloc(size_t size) {
   void* p = nullptr;
   if (size > 0) {
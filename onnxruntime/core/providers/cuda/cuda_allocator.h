@@ -3,6 +3,10 @@
 
 #pragma once
 
+#include <map>
+
+#include <cuda.h>
+
 #include "core/common/inlined_containers.h"
 #include "core/framework/allocator.h"
 #include "core/platform/ort_mutex.h"
@@ -49,6 +53,40 @@ class CUDAExternalAllocator : public CUDAAllocator {
   InlinedHashSet<void*> reserved_;
 };
 
+// Allocator backed by the CUDA virtual memory management API (cuMemAddressReserve/cuMemMap).
+// It reserves a large virtual address range up front and maps physical memory into it on demand,
+// so successive allocations are adjacent in the address space whenever possible. Combined with
+// BFCArena's region merging (see IAllocator::SupportsCoalescing) this lets the arena grow a single
+// contiguous region instead of a set of disjoint cudaMalloc blocks, which avoids stranding free
+// capacity at extension boundaries when request sizes vary (e.g. dynamic shapes).
+class CUDAVmmAllocator : public IAllocator {
+ public:
+  // 'virtual_range_bytes' bounds the address range reserved at construction; it does not commit
+  // any physical memory. Pass the arena's max_mem so the arena can always grow up to its limit.
+  CUDAVmmAllocator(OrtDevice::DeviceId device_id, const char* name, size_t virtual_range_bytes);
+  ~CUDAVmmAllocator();
+
+  void* Alloc(size_t size) override;
+  void Free(void* p) override;
+  bool SupportsCoalescing() const override { return true; }
+
+  // Returns true if 'device_id' supports the virtual memory management API.
+  static bool IsSupported(OrtDevice::DeviceId device_id);
+
+ private:
+  struct Extent {
+    CUmemGenericAllocationHandle handle;
+    size_t size;
+  };
+
+  mutable OrtMutex lock_;
+  CUdeviceptr va_base_ = 0;      // start of the reserved virtual address range
+  size_t va_size_ = 0;           // size of the reserved range
+  size_t mapped_bytes_ = 0;      // bytes mapped so far; next allocation starts at va_base_ + mapped_bytes_
+  size_t granularity_ = 0;       // minimum mapping granularity reported by the driver
+  std::map<void*, Extent> extents_;  // live mappings by start address
+};
+
 // TODO: add a default constructor
 class CUDAPinnedAllocator : public IAllocator {
  public:
@@ -138,7 +138,8 @@ AllocatorPtr CUDAExecutionProvider::CreateCudaAllocator(OrtDevice::DeviceId devi
                                                         size_t gpu_mem_limit,
                                                         ArenaExtendStrategy arena_extend_strategy,
                                                         CUDAExecutionProviderExternalAllocatorInfo external_allocator_info,
-                                                        const OrtArenaCfg* default_memory_arena_cfg) {
+                                                        const OrtArenaCfg* default_memory_arena_cfg,
+                                                        bool use_vmm_arena) {
   if (external_allocator_info.UseExternalAllocator()) {
     AllocatorCreationInfo default_memory_info(
         [external_allocator_info](OrtDevice::DeviceId id) {
@@ -152,14 +153,33 @@ AllocatorPtr CUDAExecutionProvider::CreateCudaAllocator(OrtDevice::DeviceId devi
 
     return CreateAllocator(default_memory_info);
   } else {
+    if (use_vmm_arena && !CUDAVmmAllocator::IsSupported(device_id)) {
+      LOGS_DEFAULT(WARNING) << "use_vmm_arena was requested but device " << device_id
+                            << " does not support the CUDA virtual memory management API. "
+                               "Falling back to cudaMalloc backed arena.";
+      use_vmm_arena = false;
+    }
+
+    OrtArenaCfg arena_cfg = default_memory_arena_cfg
+                                ? *default_memory_arena_cfg
+                                : OrtArenaCfg(gpu_mem_limit, static_cast<int>(arena_extend_strategy), -1, -1, -1, -1L);
+    if (use_vmm_arena && !default_memory_arena_cfg) {
+      // Start the arena at the typical VMM mapping granularity (2MB) so that kNextPowerOfTwo
+      // extensions stay granularity aligned and map back-to-back in the reserved address range,
+      // which lets the arena merge them into one contiguous region.
+      arena_cfg.initial_chunk_size_bytes = 2 * 1024 * 1024;
+    }
+
     AllocatorCreationInfo default_memory_info(
-        [](OrtDevice::DeviceId id) {
+        [use_vmm_arena, gpu_mem_limit](OrtDevice::DeviceId id) -> std::unique_ptr<IAllocator> {
+          if (use_vmm_arena) {
+            return std::make_unique<CUDAVmmAllocator>(id, CUDA, gpu_mem_limit);
+          }
           return std::make_unique<CUDAAllocator>(id, CUDA);
         },
         device_id,
         true,
-        {default_memory_arena_cfg ? *default_memory_arena_cfg
-                                  : OrtArenaCfg(gpu_mem_limit, static_cast<int>(arena_extend_strategy), -1, -1, -1, -1L)},
+        {arena_cfg},
         // make it stream aware
         true,
         // enable cross stream sharing?
@@ -2693,7 +2713,8 @@ std::vector<AllocatorPtr> CUDAExecutionProvider::CreatePreferredAllocators() {
       0);
   return std::vector<AllocatorPtr>{
       CreateCudaAllocator(info_.device_id, info_.gpu_mem_limit, info_.arena_extend_strategy,
-                          info_.external_allocator_info, info_.default_memory_arena_cfg),
+                          info_.external_allocator_info, info_.default_memory_arena_cfg,
+                          info_.use_vmm_arena),
       CreateAllocator(pinned_memory_info),
   };
 }
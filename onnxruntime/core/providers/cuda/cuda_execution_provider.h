@@ -98,7 +98,8 @@ class CUDAExecutionProvider : public IExecutionProvider {
   }
 
   static AllocatorPtr CreateCudaAllocator(OrtDevice::DeviceId device_id, size_t cuda_mem_limit, ArenaExtendStrategy arena_extend_strategy,
-                                          CUDAExecutionProviderExternalAllocatorInfo external_alloc_info, const OrtArenaCfg* arena_cfg);
+                                          CUDAExecutionProviderExternalAllocatorInfo external_alloc_info, const OrtArenaCfg* arena_cfg,
+                                          bool use_vmm_arena = false);
 
   ITuningContext* GetTuningContext() const override;
 
@@ -82,6 +82,12 @@ struct CUDAExecutionProviderInfo {
 
   int sdpa_kernel{0};
 
+  // Back the default memory arena with a CUDAVmmAllocator (CUDA virtual memory management API)
+  // instead of cudaMalloc, so the arena grows one contiguous region and free memory coalesces
+  // across extensions. Ignored when the device does not support the VMM API or when an external
+  // allocator is used.
+  bool use_vmm_arena{false};
+
   static CUDAExecutionProviderInfo FromProviderOptions(const ProviderOptions& options);
   static ProviderOptions ToProviderOptions(const CUDAExecutionProviderInfo& info);
   static ProviderOptions ToProviderOptions(const OrtCUDAProviderOptionsV2& info);
@@ -115,6 +121,7 @@ struct std::hash<::onnxruntime::CUDAExecutionProviderInfo> {
     onnxruntime::HashCombine(info.gpu_mem_limit, value);
     onnxruntime::HashCombine(info.tunable_op.max_tuning_duration_ms, value);
     onnxruntime::HashCombine(info.sdpa_kernel, value);
+    onnxruntime::HashCombine(info.use_vmm_arena, value);
 
     // Memory pointers
     onnxruntime::HashCombine(reinterpret_cast<size_t>(info.user_compute_stream), value);
@@ -1,6 +1,8 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#include <algorithm>
+
 #include "core/providers/shared_library/provider_api.h"
 
 #include "core/providers/cuda/gpu_data_transfer.h"
@@ -9,7 +11,90 @@
 namespace onnxruntime {
 GPUDataTransfer::GPUDataTransfer() {}
 
-GPUDataTransfer::~GPUDataTransfer() {}
+GPUDataTransfer::~GPUDataTransfer() {
+  for (size_t i = 0; i < 2; ++i) {
+    if (staging_events_[i] != nullptr) {
+      ORT_IGNORE_RETURN_VALUE(cudaEventDestroy(staging_events_[i]));
+    }
+    if (staging_buffers_[i] != nullptr) {
+      ORT_IGNORE_RETURN_VALUE(cudaFreeHost(staging_buffers_[i]));
+    }
+  }
+}
+
+bool GPUDataTransfer::EnsureStagingBuffers() const {
+  if (staging_disabled_) {
+    return false;
+  }
+  if (staging_buffers_[1] != nullptr) {
+    return true;
+  }
+  for (size_t i = 0; i < 2; ++i) {
+    if (staging_buffers_[i] == nullptr &&
+        cudaHostAlloc(&staging_buffers_[i], kStagingBufferBytes, cudaHostAllocDefault) != cudaSuccess) {
+      staging_buffers_[i] = nullptr;
+      staging_disabled_ = true;
+      return false;
+    }
+    if (staging_events_[i] == nullptr &&
+        cudaEventCreateWithFlags(&staging_events_[i], cudaEventDisableTiming) != cudaSuccess) {
+      staging_events_[i] = nullptr;
+      staging_disabled_ = true;
+      return false;
+    }
+  }
+  return true;
+}
+
+common::Status GPUDataTransfer::CopyThroughStagingBuffers(void* dst, const void* src, size_t bytes,
+                                                          cudaMemcpyKind kind) const {
+  if (kind == cudaMemcpyHostToDevice) {
+    // Fill one pinned buffer while the DMA of the other is in flight.
+    size_t offset = 0;
+    size_t chunk = 0;
+    while (offset < bytes) {
+      const size_t idx = chunk & 1;
+      const size_t n = std::min(kStagingBufferBytes, bytes - offset);
+      if (chunk >= 2) {
+        CUDA_RETURN_IF_ERROR(cudaEventSynchronize(staging_events_[idx]));
+      }
+      memcpy(staging_buffers_[idx], static_cast<const char*>(src) + offset, n);
+      CUDA_RETURN_IF_ERROR(cudaMemcpyAsync(static_cast<char*>(dst) + offset, staging_buffers_[idx], n,
+                                           cudaMemcpyHostToDevice, nullptr));
+      CUDA_RETURN_IF_ERROR(cudaEventRecord(staging_events_[idx], nullptr));
+      offset += n;
+      ++chunk;
+    }
+    CUDA_RETURN_IF_ERROR(cudaStreamSynchronize(nullptr));
+  } else {
+    // Keep up to two device-to-pinned copies enqueued and drain them in order, overlapping the
+    // DMA of chunk i+1 with the host memcpy of chunk i.
+    size_t issue_offset = 0;
+    size_t drain_offset = 0;
+    size_t issued_bytes[2] = {0, 0};
+    size_t chunks_issued = 0;
+    size_t chunks_drained = 0;
+    while (drain_offset < bytes) {
+      while (issue_offset < bytes && chunks_issued - chunks_drained < 2) {
+        const size_t idx = chunks_issued & 1;
+        const size_t n = std::min(kStagingBufferBytes, bytes - issue_offset);
+        CUDA_RETURN_IF_ERROR(cudaMemcpyAsync(staging_buffers_[idx],
+                                             static_cast<const char*>(src) + issue_offset, n,
+                                             cudaMemcpyDeviceToHost, nullptr));
+        CUDA_RETURN_IF_ERROR(cudaEventRecord(staging_events_[idx], nullptr));
+        issued_bytes[idx] = n;
+        issue_offset += n;
+        ++chunks_issued;
+      }
+      const size_t idx = chunks_drained & 1;
+      CUDA_RETURN_IF_ERROR(cudaEventSynchronize(staging_events_[idx]));
+      memcpy(static_cast<char*>(dst) + drain_offset, staging_buffers_[idx], issued_bytes[idx]);
+      drain_offset += issued_bytes[idx];
+      ++chunks_drained;
+    }
+  }
+  return Status::OK();
+}
 
 bool GPUDataTransfer::CanCopy(const OrtDevice& src_device, const OrtDevice& dst_device) const {
   return src_device.Type() == OrtDevice::GPU || src_device.MemType() == OrtDevice::MemType::CUDA_PINNED ||
@@ -33,12 +118,25 @@ common::Status GPUDataTransfer::CopyTensor(const Tensor& src, Tensor& dst) const
         CUDA_RETURN_IF_ERROR(cudaStreamSynchronize(nullptr));
       }
     } else {
-      // copy from other CPU memory to GPU, this is blocking
+      // copy from other CPU memory to GPU, this is blocking. pageable host memory of sufficient
+      // size is pipelined through pinned staging buffers; pinned sources go straight to cudaMemcpy.
+      if (src_device.MemType() != OrtDevice::MemType::CUDA_PINNED && bytes >= kMinStagedCopyBytes) {
+        std::lock_guard<OrtMutex> lock(staging_mutex_);
+        if (EnsureStagingBuffers()) {
+          return CopyThroughStagingBuffers(dst_data, src_data, bytes, cudaMemcpyHostToDevice);
+        }
+      }
       CUDA_RETURN_IF_ERROR(cudaMemcpy(dst_data, src_data, bytes, cudaMemcpyHostToDevice));
       CUDA_RETURN_IF_ERROR(cudaStreamSynchronize(nullptr));
     }
   } else if (src_device.Type() == OrtDevice::GPU) {
     // copying from GPU to CPU memory, this is blocking
+    if (dst_device.MemType() != OrtDevice::MemType::CUDA_PINNED && bytes >= kMinStagedCopyBytes) {
+      std::lock_guard<OrtMutex> lock(staging_mutex_);
+      if (EnsureStagingBuffers()) {
+        return CopyThroughStagingBuffers(dst_data, src_data, bytes, cudaMemcpyDeviceToHost);
+      }
+    }
     CUDA_RETURN_IF_ERROR(cudaMemcpy(dst_data, src_data, bytes, cudaMemcpyDeviceToHost));
     CUDA_RETURN_IF_ERROR(cudaStreamSynchronize(nullptr));
   } else {
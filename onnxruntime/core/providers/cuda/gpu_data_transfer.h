@@ -5,6 +5,7 @@
 
 #include "cuda_pch.h"
 #include "core/framework/data_transfer.h"
+#include "core/platform/ort_mutex.h"
 
 namespace onnxruntime {
 
@@ -19,6 +20,26 @@ class GPUDataTransfer : public IDataTransfer {
   using IDataTransfer::CopyTensor;
   common::Status CopyTensor(const Tensor& src, Tensor& dst) const override;
   common::Status CopyTensorAsync(const Tensor& src, Tensor& dst, Stream& stream) const override;
+
+ private:
+  // Synchronous copies between pageable host memory and the device go through a pair of pinned
+  // staging buffers so the DMA of one chunk overlaps the host memcpy of the next, instead of
+  // paying cudaMemcpy's internal pageable staging for the whole tensor.
+  static constexpr size_t kStagingBufferBytes = 4 * 1024 * 1024;
+  // Below this size the extra synchronization outweighs the pinned bandwidth win.
+  static constexpr size_t kMinStagedCopyBytes = 2 * kStagingBufferBytes;
+
+  bool EnsureStagingBuffers() const;
+  common::Status CopyThroughStagingBuffers(void* dst, const void* src, size_t bytes,
+                                           cudaMemcpyKind kind) const;
+
+  // Staging state is lazily initialized and serialized by the mutex; transfers over PCIe are
+  // serialized per direction anyway, so contention here is not the bottleneck.
+  mutable OrtMutex staging_mutex_;
+  mutable void* staging_buffers_[2] = {nullptr, nullptr};
+  mutable cudaEvent_t staging_events_[2] = {nullptr, nullptr};
+  // Set when pinned allocation failed so we fall back to plain cudaMemcpy permanently.
+  mutable bool staging_disabled_ = false;
 };
 
 }  // namespace onnxruntime
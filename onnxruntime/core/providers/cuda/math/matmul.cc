@@ -88,6 +88,28 @@ static bool CanUseStridedBatchedGemm(const TensorShape& left_shape, const Tensor
   return true;
 }
 
+#if defined(USE_CUSPARSELT)
+template <typename T>
+Status MatMul<T>::PrePack(const Tensor& tensor, int input_idx, AllocatorPtr alloc,
+                          bool& is_packed, PrePackedWeights* /*prepacked_weights*/) {
+  // The dense weight stays in place (is_packed remains false): it is still needed for the
+  // batched and cuSPARSELt-rejected shapes that fall back to cuBLAS.
+  is_packed = false;
+  if constexpr (std::is_same<T, MLFloat16>::value) {
+    // Only the untransposed weight input qualifies: the 2:4 groups must run along the
+    // reduction dimension.
+    if (input_idx == 1 && !trans_B_ && !trans_batch_b_) {
+      sparse_weight_ = Sparse24Weight::TryCompress(tensor, alloc, GetDeviceProp());
+    }
+  } else {
+    ORT_UNUSED_PARAMETER(tensor);
+    ORT_UNUSED_PARAMETER(input_idx);
+    ORT_UNUSED_PARAMETER(alloc);
+  }
+  return Status::OK();
+}
+#endif
+
 template <typename T>
 Status MatMul<T>::ComputeInternal(OpKernelContext* ctx) const {
   const Tensor* left_X = ctx->Input<Tensor>(0);
@@ -317,6 +339,21 @@ Status MatMul<T>::ComputeDefault(OpKernelContext* ctx, MatMulComputeHelper& help
   int64_t stride_A, stride_B, stride_C, batch_count;
   auto& device_prop = GetDeviceProp();
 
+#if defined(USE_CUSPARSELT)
+  if (sparse_weight_ != nullptr && helper.OutputOffsets().size() == 1 && !transa && !transb) {
+    if (const auto* plan = sparse_weight_->GetPlan(helper.M())) {
+      IAllocatorUniquePtr<void> workspace;
+      if (plan->workspace_size > 0) {
+        workspace = GetScratchBuffer<void>(plan->workspace_size, ctx->GetComputeStream());
+      }
+      if (sparse_weight_->Run(*plan, Stream(ctx), left_X->Data<T>(), Y->MutableData<T>(),
+                              workspace.get(), alpha_)) {
+        return Status::OK();
+      }
+    }
+  }
+#endif
+
   if (helper.OutputOffsets().size() == 1) {
     CUBLAS_RETURN_IF_ERROR(cublasGemmHelper(
         GetCublasHandle(ctx),
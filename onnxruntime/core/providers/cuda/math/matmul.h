@@ -4,6 +4,7 @@
 #pragma once
 
 #include "core/providers/cuda/cuda_kernel.h"
+#include "core/providers/cuda/math/matmul_sparse_24.h"
 #include "core/providers/cpu/math/matmul_helper.h"
 
 namespace onnxruntime {
@@ -24,12 +25,22 @@ class MatMul final : public CudaKernel {
   Status ComputeInternal(OpKernelContext* context) const override;
   Status ComputeDefault(OpKernelContext* context, MatMulComputeHelper& helper) const;
 
+#if defined(USE_CUSPARSELT)
+  Status PrePack(const Tensor& tensor, int input_idx, AllocatorPtr alloc,
+                 bool& is_packed, PrePackedWeights* prepacked_weights) override;
+#endif
+
  private:
   const float alpha_;
   const bool trans_A_;
   const bool trans_B_;
   const bool trans_batch_a_;
   const bool trans_batch_b_;
+#if defined(USE_CUSPARSELT)
+  // Set when the weight initializer carries a valid 2:4 sparsity pattern; the dense copy is
+  // kept as well so batched and unsupported shapes can still run through cuBLAS.
+  std::unique_ptr<Sparse24Weight> sparse_weight_;
+#endif
 };
 
 template <typename T>
@@ -0,0 +1,167 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#if defined(USE_CUSPARSELT)
+
+#include "core/providers/cuda/math/matmul_sparse_24.h"
+
+#include "core/providers/cuda/shared_inc/cuda_call.h"
+
+namespace onnxruntime {
+namespace cuda {
+
+namespace {
+// cuSPARSELt requires 16 byte aligned operands for 16-bit element types.
+constexpr unsigned int kAlignment = 16;
+}  // namespace
+
+Sparse24Weight::~Sparse24Weight() {
+  for (auto& entry : plans_) {
+    if (entry.second && entry.second->complete) {
+      cusparseLtMatmulPlanDestroy(&entry.second->plan);
+      cusparseLtMatDescriptorDestroy(&entry.second->mat_a);
+      cusparseLtMatDescriptorDestroy(&entry.second->mat_c);
+    }
+  }
+  if (weight_desc_initialized_) {
+    cusparseLtMatDescriptorDestroy(&mat_w_);
+  }
+  if (handle_initialized_) {
+    cusparseLtDestroy(&handle_);
+  }
+}
+
+std::unique_ptr<Sparse24Weight> Sparse24Weight::TryCompress(const Tensor& weight, AllocatorPtr alloc,
+                                                            const cudaDeviceProp& device_prop) {
+  // Sparse tensor cores are an Ampere feature.
+  if (device_prop.major < 8) {
+    return nullptr;
+  }
+  if (!weight.IsDataType<MLFloat16>()) {
+    return nullptr;
+  }
+  const auto& shape = weight.Shape();
+  if (shape.NumDimensions() != 2) {
+    return nullptr;
+  }
+  const int64_t k = shape[0];
+  const int64_t n = shape[1];
+  if (k <= 0 || n <= 0 || (k % 16) != 0 || (n % 16) != 0) {
+    return nullptr;
+  }
+
+  std::unique_ptr<Sparse24Weight> result(new Sparse24Weight());
+  if (!CUSPARSE_CALL(cusparseLtInit(&result->handle_)).IsOK()) {
+    return nullptr;
+  }
+  result->handle_initialized_ = true;
+
+  // The K x N row major weight aliases W^T as an N x K column major matrix, which lets the
+  // structured operand take the first position in Y^T = W^T x A^T with no transposes. The
+  // 2:4 groups then run along K, the reduction dimension, as the hardware requires.
+  if (!CUSPARSE_CALL(cusparseLtStructuredDescriptorInit(&result->handle_, &result->mat_w_,
+                                                        n, k, /*ld=*/n, kAlignment, CUDA_R_16F,
+                                                        CUSPARSE_ORDER_COL,
+                                                        CUSPARSELT_SPARSITY_50_PERCENT))
+           .IsOK()) {
+    return nullptr;
+  }
+  result->weight_desc_initialized_ = true;
+
+  // Verify the weight already carries a valid 2:4 pattern. Pruning changes numerics, so it
+  // stays the responsibility of whoever sparsified the model; we only accept or decline.
+  auto valid_flag = IAllocator::MakeUniquePtr<int>(alloc, 1);
+  if (!CUSPARSE_CALL(cusparseLtSpMMAPruneCheck2(&result->handle_, &result->mat_w_, /*isSparseA=*/1,
+                                                CUSPARSE_OPERATION_NON_TRANSPOSE, weight.DataRaw(),
+                                                valid_flag.get(), /*stream=*/nullptr))
+           .IsOK()) {
+    return nullptr;
+  }
+  int valid = 1;
+  if (!CUDA_CALL(cudaMemcpy(&valid, valid_flag.get(), sizeof(int), cudaMemcpyDeviceToHost)).IsOK() ||
+      valid != 0) {
+    return nullptr;
+  }
+
+  size_t compressed_size = 0;
+  size_t compress_buffer_size = 0;
+  if (!CUSPARSE_CALL(cusparseLtSpMMACompressedSize2(&result->handle_, &result->mat_w_,
+                                                    &compressed_size, &compress_buffer_size))
+           .IsOK()) {
+    return nullptr;
+  }
+  result->compressed_ = IAllocator::MakeUniquePtr<void>(alloc, compressed_size);
+  auto compress_buffer = IAllocator::MakeUniquePtr<void>(alloc, compress_buffer_size);
+  if (!CUSPARSE_CALL(cusparseLtSpMMACompress2(&result->handle_, &result->mat_w_, /*isSparseA=*/1,
+                                              CUSPARSE_OPERATION_NON_TRANSPOSE, weight.DataRaw(),
+                                              result->compressed_.get(), compress_buffer.get(),
+                                              /*stream=*/nullptr))
+           .IsOK()) {
+    return nullptr;
+  }
+  // The compression buffer is freed on return, so make sure the kernel is done with it.
+  if (!CUDA_CALL(cudaStreamSynchronize(nullptr)).IsOK()) {
+    return nullptr;
+  }
+
+  result->k_ = k;
+  result->n_ = n;
+  return result;
+}
+
+const Sparse24Weight::Plan* Sparse24Weight::GetPlan(int64_t m) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = plans_.find(m);
+  if (it != plans_.end()) {
+    return it->second.get();
+  }
+
+  auto plan = std::make_unique<Plan>();
+  // Row major A (M x K) and Y (M x N) alias A^T (K x M) and Y^T (N x M) column major, so the
+  // whole product is expressed as Y^T = W^T x A^T, mirroring the operand swap the dense path
+  // performs for cuBLAS.
+  bool ok =
+      CUSPARSE_CALL(cusparseLtDenseDescriptorInit(&handle_, &plan->mat_a, k_, m, /*ld=*/k_,
+                                                  kAlignment, CUDA_R_16F, CUSPARSE_ORDER_COL))
+          .IsOK() &&
+      CUSPARSE_CALL(cusparseLtDenseDescriptorInit(&handle_, &plan->mat_c, n_, m, /*ld=*/n_,
+                                                  kAlignment, CUDA_R_16F, CUSPARSE_ORDER_COL))
+          .IsOK() &&
+      CUSPARSE_CALL(cusparseLtMatmulDescriptorInit(&handle_, &plan->matmul,
+                                                   CUSPARSE_OPERATION_NON_TRANSPOSE,
+                                                   CUSPARSE_OPERATION_NON_TRANSPOSE,
+                                                   &mat_w_, &plan->mat_a, &plan->mat_c, &plan->mat_c,
+                                                   CUSPARSE_COMPUTE_32F))
+          .IsOK() &&
+      CUSPARSE_CALL(cusparseLtMatmulAlgSelectionInit(&handle_, &plan->alg, &plan->matmul,
+                                                     CUSPARSELT_MATMUL_ALG_DEFAULT))
+          .IsOK() &&
+      CUSPARSE_CALL(cusparseLtMatmulPlanInit(&handle_, &plan->plan, &plan->matmul, &plan->alg))
+          .IsOK() &&
+      CUSPARSE_CALL(cusparseLtMatmulGetWorkspace(&handle_, &plan->plan, &plan->workspace_size))
+          .IsOK();
+
+  if (!ok) {
+    // Cache the failure so unsupported shapes take the cuBLAS path without re-probing.
+    plans_.emplace(m, nullptr);
+    return nullptr;
+  }
+
+  plan->complete = true;
+  auto* raw = plan.get();
+  plans_.emplace(m, std::move(plan));
+  return raw;
+}
+
+bool Sparse24Weight::Run(const Plan& plan, cudaStream_t stream, const void* a_data, void* y_data,
+                         void* workspace, float alpha) {
+  const float beta = 0.0f;
+  return CUSPARSE_CALL(cusparseLtMatmul(&handle_, &plan.plan, &alpha, compressed_.get(), a_data,
+                                        &beta, y_data, y_data, workspace, &stream, 1))
+      .IsOK();
+}
+
+}  // namespace cuda
+}  // namespace onnxruntime
+
+#endif  // defined(USE_CUSPARSELT)
@@ -0,0 +1,76 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#if defined(USE_CUSPARSELT)
+
+#include <cusparseLt.h>
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "core/providers/cuda/cuda_kernel.h"
+
+namespace onnxruntime {
+namespace cuda {
+
+// Holds a 2:4 structured-sparse copy of a MatMul weight initializer together with the
+// cuSPARSELt plans that consume it on the sparse tensor cores (SM 8.0+).
+//
+// TryCompress inspects the fp16 weight at session initialization: when every group of four
+// consecutive values along the reduction dimension holds at most two nonzeros, the weight is
+// compressed with cusparseLtSpMMACompress and kept on device next to the dense copy. The
+// library needs a matmul plan per activation shape, so plans are created lazily at the first
+// Compute for a given M and cached, much like the dense path caches cuBLAS heuristics.
+class Sparse24Weight {
+ public:
+  struct Plan {
+    cusparseLtMatDescriptor_t mat_a;
+    cusparseLtMatDescriptor_t mat_c;
+    cusparseLtMatmulDescriptor_t matmul;
+    cusparseLtMatmulAlgSelection_t alg;
+    cusparseLtMatmulPlan_t plan;
+    size_t workspace_size = 0;
+    bool complete = false;
+  };
+
+  ~Sparse24Weight();
+
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(Sparse24Weight);
+
+  // Returns a compressed weight when `weight` is a 2-D fp16 K x N row major tensor with a
+  // valid 2:4 pattern along K and cuSPARSELt-compatible dimensions, nullptr otherwise.
+  static std::unique_ptr<Sparse24Weight> TryCompress(const Tensor& weight, AllocatorPtr alloc,
+                                                     const cudaDeviceProp& device_prop);
+
+  // Returns the cached plan for activation row count `m`, creating it on first use.
+  // Returns nullptr when cuSPARSELt rejects the shape; the failure is cached too so the
+  // caller falls back to cuBLAS without re-probing the library every Run.
+  const Plan* GetPlan(int64_t m);
+
+  // Runs Y = alpha * A x W for row major A (M x K) and Y (M x N) using the plan returned by
+  // GetPlan. `workspace` must hold at least plan.workspace_size bytes.
+  bool Run(const Plan& plan, cudaStream_t stream, const void* a_data, void* y_data,
+           void* workspace, float alpha);
+
+ private:
+  Sparse24Weight() = default;
+
+  cusparseLtHandle_t handle_{};
+  cusparseLtMatDescriptor_t mat_w_{};  // the K x N row major weight viewed as W^T, N x K column major
+  IAllocatorUniquePtr<void> compressed_;
+  int64_t k_ = 0;
+  int64_t n_ = 0;
+  bool handle_initialized_ = false;
+  bool weight_desc_initialized_ = false;
+
+  std::mutex mutex_;
+  std::unordered_map<int64_t, std::unique_ptr<Plan>> plans_;  // keyed by M, nullptr caches failures
+};
+
+}  // namespace cuda
+}  // namespace onnxruntime
+
+#endif  // defined(USE_CUSPARSELT)
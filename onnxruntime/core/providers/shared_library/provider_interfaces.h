@@ -123,6 +123,30 @@ struct Node__EdgeIterator {
   virtual int GetDstArgIndex() const = 0;
 };
 
+// Packed per-node metadata for a whole GraphViewer, filled by a single bridge call. Walking a
+// large graph through the per-call accessors during GetCapability costs one cross-DLL virtual
+// call per node, per def and per name; a snapshot fetches them all at once. The string and
+// pointer members refer to storage owned by the host graph and remain valid for the lifetime
+// of the GraphViewer.
+struct GraphNodeMetadata {
+  NodeIndex index;
+  const Node* node;
+  const std::string* name;
+  const std::string* op_type;
+  const std::string* domain;
+  int since_version;
+  // [begin, begin + count) ranges into GraphViewerMetadataSnapshot::args / arg_names
+  size_t input_args_begin, input_args_count;
+  size_t implicit_input_args_begin, implicit_input_args_count;
+  size_t output_args_begin, output_args_count;
+};
+
+struct GraphViewerMetadataSnapshot {
+  std::vector<GraphNodeMetadata> nodes;       // in the requested topological order
+  std::vector<const NodeArg*> args;           // flattened input/implicit input/output defs
+  std::vector<const std::string*> arg_names;  // parallel to 'args'
+};
+
 // There are two ways to route a function, one is a virtual method and the other is a function pointer (or pointer to
 // member function).
 // The function pointers are nicer in that they directly call the target function, but they cannot be used in cases
@@ -994,6 +1018,8 @@ struct ProviderHost {
                                     bool include_outer_scope_args,
                                     int execution_order) noexcept = 0;
   virtual const Node* GraphViewer__GetProducerNode(const GraphViewer* p, const std::string& node_arg_name) const = 0;
+  virtual void GraphViewer__GetMetadataSnapshot(const GraphViewer* p, int execution_order,
+                                                GraphViewerMetadataSnapshot& snapshot) const = 0;
 
   // OpKernel
   virtual const Node& OpKernel__Node(const OpKernel* p) = 0;
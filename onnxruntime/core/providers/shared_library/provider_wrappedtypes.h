@@ -1065,6 +1065,14 @@ class GraphViewer final {
   }
   const Node* GetProducerNode(const std::string& node_arg_name) const { return g_host->GraphViewer__GetProducerNode(this, node_arg_name); }
 
+  // fetches the per-node metadata for the whole graph in one bridge call; prefer this over
+  // per-node accessors when iterating every node of a large graph
+  GraphViewerMetadataSnapshot GetMetadataSnapshot(int execution_order = 0) const {
+    GraphViewerMetadataSnapshot snapshot;
+    g_host->GraphViewer__GetMetadataSnapshot(this, execution_order, snapshot);
+    return snapshot;
+  }
+
   GraphViewer() = delete;
   GraphViewer(const GraphViewer&) = delete;
   void operator=(const GraphViewer&) = delete;
@@ -2316,6 +2316,9 @@ SubGraphCollection_t TensorrtExecutionProvider::GetSupportedList(SubGraphCollect
 // Detect and remove cycles from supported node list
 bool TensorrtExecutionProvider::DetectTensorRTGraphCycles(SubGraphCollection_t& supported_nodes_vector, const GraphViewer& graph, const HashValue& model_hash, bool remove_cycles) const {
   const std::vector<NodeIndex>& node_index = graph.GetNodesInTopologicalOrder(1 /*priority-based topological sort*/);
+  // fetch all node/def names in one bridge call instead of crossing the provider bridge per node
+  // and per def on every cycle-detection iteration
+  const GraphViewerMetadataSnapshot graph_metadata = graph.GetMetadataSnapshot(1 /*priority-based topological sort*/);
   bool trt_cycle = true, cycle_detected = false;
   while (trt_cycle) {
     trt_cycle = false;
@@ -2356,24 +2359,26 @@ bool TensorrtExecutionProvider::DetectTensorRTGraphCycles(SubGraphCollection_t&
     }
 
     // Add non TensorRT nodes to the maps
-    for (const auto& index : non_trt_node_index) {
-      const auto& node = graph.GetNode(index);
-      const std::string node_name = node->Name();
+    for (const auto& node_meta : graph_metadata.nodes) {
+      if (non_trt_node_index.find(node_meta.index) == non_trt_node_index.end()) {
+        continue;
+      }
+      const std::string& node_name = *node_meta.name;
       if (node_to_index_map.find(node_name) == node_to_index_map.end()) {
         index_to_node_map[id] = node_name;
         node_to_index_map[node_name] = id++;
       }
 
-      for (const auto& input : node->InputDefs()) {
-        input_to_nodes_map[input->Name()].insert(node_name);
+      for (size_t i = 0; i < node_meta.input_args_count; ++i) {
+        input_to_nodes_map[*graph_metadata.arg_names[node_meta.input_args_begin + i]].insert(node_name);
       }
 
-      for (const auto& input : node->ImplicitInputDefs()) {
-        input_to_nodes_map[input->Name()].insert(node_name);
+      for (size_t i = 0; i < node_meta.implicit_input_args_count; ++i) {
+        input_to_nodes_map[*graph_metadata.arg_names[node_meta.implicit_input_args_begin + i]].insert(node_name);
       }
 
-      for (const auto& output : node->OutputDefs()) {
-        node_to_outputs_map[node_name].insert(output->Name());
+      for (size_t i = 0; i < node_meta.output_args_count; ++i) {
+        node_to_outputs_map[node_name].insert(*graph_metadata.arg_names[node_meta.output_args_begin + i]);
       }
     }
 
@@ -2463,9 +2468,10 @@ TensorrtExecutionProvider::GetCapability(const GraphViewer& graph,
   std::iota(std::begin(nodes_vector), std::end(nodes_vector), 0);
 
   std::vector<size_t> filtered_nodes_vector;
-  const std::vector<NodeIndex>& node_index = graph.GetNodesInTopologicalOrder(1 /*priority-based topological sort*/);
+  // one bridge call for all node metadata instead of per-node/per-name calls across the DLL boundary
+  const GraphViewerMetadataSnapshot graph_metadata = graph.GetMetadataSnapshot(1 /*priority-based topological sort*/);
   for (const auto& index : nodes_vector) {
-    const auto& node = graph.GetNode(node_index[index]);
+    const auto& node_meta = graph_metadata.nodes[index];
 
     /* If current node is control flow op, we take different approach based on following four cases:
      *
@@ -2476,8 +2482,8 @@ TensorrtExecutionProvider::GetCapability(const GraphViewer& graph,
      *
      * For cases 2, 3, 4, even though the control flow op is not assigned to TRT, any portion of its subgraphs that can run in TRT will be still fused and assigned to TRT EP.
      */
-    if (control_flow_op_set_.find(node->OpType()) != control_flow_op_set_.end()) {
-      auto sub_graphs = node->GetSubgraphs();
+    if (control_flow_op_set_.find(*node_meta.op_type) != control_flow_op_set_.end()) {
+      auto sub_graphs = node_meta.node->GetSubgraphs();
       if (sub_graphs.size() != 0) {
         bool all_subgraphs_are_supported = true;
         for (auto sub_graph : sub_graphs) {
@@ -15,6 +15,7 @@
 #include "core/providers/xnnpack/detail/utils.h"
 
 // each operator provides a helper to check if supported
+#include "core/providers/xnnpack/math/elementwise.h"
 #include "core/providers/xnnpack/math/gemm.h"
 #include "core/providers/xnnpack/math/matmul.h"
 #include "core/providers/xnnpack/math/softmax.h"
@@ -100,6 +101,8 @@ bool NodeSupportChecker::IsNodeSupported(const NodeUnit& nodeunit) {
       {"Resize", Resize::IsOnnxNodeSupported},
       {"Gemm", Gemm::IsOnnxNodeSupported},
       {"MatMul", MatMul::IsOnnxNodeSupported},
+      {"Add", ElementWise::IsOnnxNodeSupported},
+      {"Mul", ElementWise::IsOnnxNodeSupported},
   };
 
   bool supported = false;
@@ -99,6 +99,10 @@ QuantizedOpType GetQuantizedOpType(const NodeUnit& node_unit) {
       return QuantizedOpType::QDQResize;
     else if (op_type == "ConvTranspose")
       return QuantizedOpType::QDQConvTranspose;
+    else if (op_type == "Add")
+      return QuantizedOpType::QDQAdd;
+    else if (op_type == "Mul")
+      return QuantizedOpType::QDQMul;
 
   } else if (node_unit.OpType() == "QLinearConv") {
     return QuantizedOpType::QLinearConv;
@@ -127,6 +131,8 @@ static const std::unordered_map<QuantizedOpType, ONNXOpType> qdq_to_onnx_type_ma
     {QuantizedOpType::QDQMaxPool, "MaxPool"},
     {QuantizedOpType::QDQResize, "Resize"},
     {QuantizedOpType::QDQConvTranspose, "QLinearConvTranspose"},
+    {QuantizedOpType::QDQAdd, "QLinearAdd"},
+    {QuantizedOpType::QDQMul, "QLinearMul"},
 };
 
 std::unique_ptr<IndexedSubGraph::MetaDef> FuseQDQGroup(const NodeUnit& node_unit) {
@@ -165,8 +171,9 @@ std::unique_ptr<IndexedSubGraph::MetaDef> FuseQDQGroup(const NodeUnit& node_unit
     if (qtype == QuantizedOpType::QDQConvTranspose) {
       def.since_version = 1;
     }
-  } else if (qtype == QuantizedOpType::QDQAvgPool || qtype == QuantizedOpType::QDQSoftmax) {
-    // x x-scale x-zp
+  } else if (qtype == QuantizedOpType::QDQAvgPool || qtype == QuantizedOpType::QDQSoftmax ||
+             qtype == QuantizedOpType::QDQAdd || qtype == QuantizedOpType::QDQMul) {
+    // x x-scale x-zp, (x2 x2-scale x2-zp for the binary ops)
     std::for_each(inputs.cbegin(), inputs.cend(),
                   [&def](const NodeUnitIODef& arg) {
                     // keep the number of inputs the same by inserting an empty string for a missing optional input
@@ -183,6 +190,10 @@ std::unique_ptr<IndexedSubGraph::MetaDef> FuseQDQGroup(const NodeUnit& node_unit
       def.domain = kDynamicDomainByCreate;
       def.since_version = 1;
       def.attributes.emplace("opset", utils::MakeAttribute(std::string("opset"), int64_t(node_unit.SinceVersion())));
+    } else if (qtype == QuantizedOpType::QDQAdd || qtype == QuantizedOpType::QDQMul) {
+      // QLinearAdd/QLinearMul are not ONNX operators so we create the schema dynamically
+      def.domain = kDynamicDomainByCreate;
+      def.since_version = 1;
     }
   } else if (qtype == QuantizedOpType::QDQMaxPool || qtype == QuantizedOpType::QDQResize) {
     // Don't care about the quantization parameters for MaxPool, Resize
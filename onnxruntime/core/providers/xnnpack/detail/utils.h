@@ -58,6 +58,8 @@ enum class QuantizedOpType : uint8_t {
   QDQAvgPool,
   QDQSoftmax,
   QDQResize,
+  QDQAdd,
+  QDQMul,
   Unknown,
 };
 
@@ -0,0 +1,267 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/providers/xnnpack/math/elementwise.h"
+
+#include <limits>
+
+#include "core/common/inlined_containers.h"
+#include "core/framework/op_kernel.h"
+#include "core/providers/common.h"
+
+namespace onnxruntime {
+namespace xnnpack {
+namespace {
+bool IsQuantizedElementWise(QuantizedOpType quant_op_type) {
+  return quant_op_type == QuantizedOpType::QDQAdd ||
+         quant_op_type == QuantizedOpType::QDQMul;
+}
+
+bool IsQuantElementWiseSupported(const NodeUnit& node_unit, const GraphViewer& graph) {
+  bool supported = false;
+  do {
+    // both inputs and the output must share the same 8-bit type. xnnpack computes in the output's
+    // quantization parameters so differing input/output scales are fine.
+    TensorQuantType a_input_type = GetTensorQuantType(node_unit, 0, false, graph);
+    TensorQuantType b_input_type = GetTensorQuantType(node_unit, 1, false, graph);
+    TensorQuantType output_type = GetTensorQuantType(node_unit, 0, true, graph);
+    if (a_input_type != b_input_type || a_input_type != output_type) {
+      break;
+    }
+
+    if (a_input_type != TensorTypeUint8 && a_input_type != TensorTypeInt8) {
+      break;
+    }
+
+    supported = true;
+  } while (false);
+
+  return supported;
+}
+}  // namespace
+
+bool ElementWise::IsOnnxNodeSupported(const NodeUnit& node_unit, const GraphViewer& graph) {
+  if (IsQuantizedElementWise(GetQuantizedOpType(node_unit)) &&
+      IsQuantElementWiseSupported(node_unit, graph) == false) {
+    return false;
+  }
+
+  bool supported = false;
+
+  // use do {} while(false) so it's easier to set a breakpoint on the return
+  do {
+    const auto& inputs = node_unit.Inputs();
+    const auto& a_arg = inputs[0].node_arg;
+    const auto& b_arg = inputs[1].node_arg;
+
+    // float is handled by the statically registered ONNX-domain kernels.
+    // u8/s8 is only valid as part of a QDQ node unit which gets fused into QLinearAdd/QLinearMul.
+    const auto* a_type = a_arg.TypeAsProto();
+    if (a_type == nullptr) {
+      break;
+    }
+
+    const auto elem_type = a_type->tensor_type().elem_type();
+    const bool is_qdq = node_unit.UnitType() == NodeUnit::Type::QDQGroup;
+    if (elem_type != ONNX_NAMESPACE::TensorProto_DataType_FLOAT &&
+        !(is_qdq && (elem_type == ONNX_NAMESPACE::TensorProto_DataType_UINT8 ||
+                     elem_type == ONNX_NAMESPACE::TensorProto_DataType_INT8))) {
+      break;
+    }
+
+    const auto* b_type = b_arg.TypeAsProto();
+    if (b_type == nullptr || b_type->tensor_type().elem_type() != elem_type) {
+      break;
+    }
+
+    // xnnpack handles numpy-style broadcasting, but only up to XNN_MAX_TENSOR_DIMS dims per input
+    const auto* a_shape = a_arg.Shape();
+    const auto* b_shape = b_arg.Shape();
+    if (!a_shape || !b_shape ||
+        a_shape->dim_size() > XNN_MAX_TENSOR_DIMS ||
+        b_shape->dim_size() > XNN_MAX_TENSOR_DIMS) {
+      break;
+    }
+
+    supported = true;
+  } while (false);
+
+  return supported;
+}
+
+ElementWise::ElementWise(const OpKernelInfo& info) : XnnpackKernel{info} {
+  const auto& node = info.node();
+  const auto& op_name = node.OpType();
+  is_add_ = op_name == "Add" || op_name == "QLinearAdd";
+  ORT_ENFORCE(is_add_ || op_name == "Mul" || op_name == "QLinearMul",
+              "unsupported elementwise op: ", op_name);
+
+  auto input_defs = node.InputDefs();
+  int x_dtype = 0;
+  ORT_ENFORCE(GetType(*input_defs[0], x_dtype));
+  if (x_dtype == ONNX_NAMESPACE::TensorProto_DataType_FLOAT) {
+    op_type_ = OpComputeType::op_compute_type_fp32;
+  } else if (x_dtype == ONNX_NAMESPACE::TensorProto_DataType_UINT8) {
+    op_type_ = OpComputeType::op_compute_type_qu8;
+  } else if (x_dtype == ONNX_NAMESPACE::TensorProto_DataType_INT8) {
+    op_type_ = OpComputeType::op_compute_type_qs8;
+  } else {
+    auto stype = DataTypeImpl::ToString(DataTypeImpl::TypeFromProto(*input_defs[0]->TypeAsProto()));
+    ORT_THROW("unsupported input type in ", op_name, ", we have FLOAT|UINT8|INT8, but got ", stype);
+  }
+
+  xnn_status xstatus = xnn_status_invalid_state;
+  struct xnn_operator* p = nullptr;
+  if (op_type_ == OpComputeType::op_compute_type_fp32) {
+    const float output_min = -std::numeric_limits<float>::infinity();
+    const float output_max = std::numeric_limits<float>::infinity();
+    xstatus = is_add_ ? xnn_create_add_nd_f32(output_min, output_max, 0, &p)
+                      : xnn_create_multiply_nd_f32(output_min, output_max, 0, &p);
+  } else {
+    // the order of input tensors: a, a_scale, a_zp, b, b_scale, b_zp, y_scale, y_zp
+    OpQuantParam quant_param = ParseQuantParamForOp(info, x_dtype, 2);
+    if (op_type_ == OpComputeType::op_compute_type_qu8) {
+      const uint8_t a_zp = quant_param[0].second;
+      const uint8_t b_zp = quant_param[1].second;
+      const uint8_t y_zp = quant_param[2].second;
+      xstatus = is_add_ ? xnn_create_add_nd_qu8(a_zp, quant_param[0].first[0],
+                                                b_zp, quant_param[1].first[0],
+                                                y_zp, quant_param[2].first[0],
+                                                0, 255, 0, &p)
+                        : xnn_create_multiply_nd_qu8(a_zp, quant_param[0].first[0],
+                                                     b_zp, quant_param[1].first[0],
+                                                     y_zp, quant_param[2].first[0],
+                                                     0, 255, 0, &p);
+    } else {
+      // zero points were parsed into a uint8_t, re-cast to the real datatype
+      const int8_t a_zp = static_cast<int8_t>(quant_param[0].second);
+      const int8_t b_zp = static_cast<int8_t>(quant_param[1].second);
+      const int8_t y_zp = static_cast<int8_t>(quant_param[2].second);
+      xstatus = is_add_ ? xnn_create_add_nd_qs8(a_zp, quant_param[0].first[0],
+                                                b_zp, quant_param[1].first[0],
+                                                y_zp, quant_param[2].first[0],
+                                                -128, 127, 0, &p)
+                        : xnn_create_multiply_nd_qs8(a_zp, quant_param[0].first[0],
+                                                     b_zp, quant_param[1].first[0],
+                                                     y_zp, quant_param[2].first[0],
+                                                     -128, 127, 0, &p);
+    }
+  }
+
+  ORT_ENFORCE(xstatus == xnn_status_success, "xnn_create_", (is_add_ ? "add" : "multiply"), "_nd_",
+              OpTypeToString(op_type_), " failed. Status:", xstatus);
+  op0_.reset(p);
+}
+
+Status ElementWise::Compute(OpKernelContext* ctx) const {
+  const Tensor& A = *ctx->Input<Tensor>(0);
+  // for the fused QLinear* version input 1 and 2 are the scale and zero point of input 0
+  const Tensor& B = *ctx->Input<Tensor>(op_type_ == OpComputeType::op_compute_type_fp32 ? 1 : 3);
+
+  const auto& a_shape = A.Shape();
+  const auto& b_shape = B.Shape();
+  TensorShape output_shape;
+  ORT_RETURN_IF_ERROR(ComputeBroadcastOutputShape(Node().Name(), a_shape, b_shape, output_shape));
+  Tensor* Y = ctx->Output(0, output_shape);
+
+  // edge case. one or more dims with value of 0. nothing to do
+  if (output_shape.Size() == 0) {
+    return Status::OK();
+  }
+
+  auto a_dims = a_shape.GetDims();
+  auto b_dims = b_shape.GetDims();
+  InlinedVector<size_t> input1_shape(a_dims.cbegin(), a_dims.cend());
+  InlinedVector<size_t> input2_shape(b_dims.cbegin(), b_dims.cend());
+
+  pthreadpool_t threadpool = GetThreadPool();
+  xnn_status status = xnn_status_invalid_state;
+
+  if (op_type_ == OpComputeType::op_compute_type_fp32) {
+    auto reshape_fn = is_add_ ? xnn_reshape_add_nd_f32 : xnn_reshape_multiply_nd_f32;
+    status = reshape_fn(op0_.get(),
+                        input1_shape.size(), input1_shape.data(),
+                        input2_shape.size(), input2_shape.data(),
+                        threadpool);
+  } else if (op_type_ == OpComputeType::op_compute_type_qu8) {
+    auto reshape_fn = is_add_ ? xnn_reshape_add_nd_qu8 : xnn_reshape_multiply_nd_qu8;
+    status = reshape_fn(op0_.get(),
+                        input1_shape.size(), input1_shape.data(),
+                        input2_shape.size(), input2_shape.data(),
+                        threadpool);
+  } else {
+    auto reshape_fn = is_add_ ? xnn_reshape_add_nd_qs8 : xnn_reshape_multiply_nd_qs8;
+    status = reshape_fn(op0_.get(),
+                        input1_shape.size(), input1_shape.data(),
+                        input2_shape.size(), input2_shape.data(),
+                        threadpool);
+  }
+
+  if (status != xnn_status_success) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "xnn_reshape_", (is_add_ ? "add" : "multiply"), "_nd_",
+                           OpTypeToString(op_type_), " returned ", status);
+  }
+
+  if (op_type_ == OpComputeType::op_compute_type_fp32) {
+    status = is_add_ ? xnn_setup_add_nd_f32(op0_.get(), A.Data<float>(), B.Data<float>(), Y->MutableData<float>())
+                     : xnn_setup_multiply_nd_f32(op0_.get(), A.Data<float>(), B.Data<float>(),
+                                                 Y->MutableData<float>());
+  } else if (op_type_ == OpComputeType::op_compute_type_qu8) {
+    status = is_add_ ? xnn_setup_add_nd_qu8(op0_.get(), A.Data<uint8_t>(), B.Data<uint8_t>(),
+                                            Y->MutableData<uint8_t>())
+                     : xnn_setup_multiply_nd_qu8(op0_.get(), A.Data<uint8_t>(), B.Data<uint8_t>(),
+                                                 Y->MutableData<uint8_t>());
+  } else {
+    status = is_add_ ? xnn_setup_add_nd_qs8(op0_.get(), A.Data<int8_t>(), B.Data<int8_t>(),
+                                            Y->MutableData<int8_t>())
+                     : xnn_setup_multiply_nd_qs8(op0_.get(), A.Data<int8_t>(), B.Data<int8_t>(),
+                                                 Y->MutableData<int8_t>());
+  }
+
+  if (status != xnn_status_success) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "xnn_setup_", (is_add_ ? "add" : "multiply"), "_nd_",
+                           OpTypeToString(op_type_), " returned ", status);
+  }
+
+  status = xnn_run_operator(op0_.get(), threadpool);
+  if (status != xnn_status_success) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "xnn_run_operator returned ", status);
+  }
+
+  return Status::OK();
+}
+
+ONNX_OPERATOR_VERSIONED_KERNEL_EX(Add, kOnnxDomain, 7, 12, kXnnpackExecutionProvider,
+                                  KernelDefBuilder().TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+                                  ElementWise);
+
+ONNX_OPERATOR_VERSIONED_KERNEL_EX(Add, kOnnxDomain, 13, 13, kXnnpackExecutionProvider,
+                                  KernelDefBuilder().TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+                                  ElementWise);
+
+ONNX_OPERATOR_KERNEL_EX(Add, kOnnxDomain, 14, kXnnpackExecutionProvider,
+                        KernelDefBuilder().TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+                        ElementWise);
+
+ONNX_OPERATOR_VERSIONED_KERNEL_EX(Mul, kOnnxDomain, 7, 12, kXnnpackExecutionProvider,
+                                  KernelDefBuilder().TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+                                  ElementWise);
+
+ONNX_OPERATOR_VERSIONED_KERNEL_EX(Mul, kOnnxDomain, 13, 13, kXnnpackExecutionProvider,
+                                  KernelDefBuilder().TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+                                  ElementWise);
+
+ONNX_OPERATOR_KERNEL_EX(Mul, kOnnxDomain, 14, kXnnpackExecutionProvider,
+                        KernelDefBuilder().TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+                        ElementWise);
+
+ONNX_OPERATOR_KERNEL_EX(QLinearAdd, kDynamicDomainByCreate, 1, kXnnpackExecutionProvider,
+                        KernelDefBuilder(),  // dynamic schema
+                        ElementWise);
+
+ONNX_OPERATOR_KERNEL_EX(QLinearMul, kDynamicDomainByCreate, 1, kXnnpackExecutionProvider,
+                        KernelDefBuilder(),  // dynamic schema
+                        ElementWise);
+
+}  // namespace xnnpack
+}  // namespace onnxruntime
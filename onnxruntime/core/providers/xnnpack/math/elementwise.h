@@ -0,0 +1,30 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/providers/xnnpack/xnnpack_kernel.h"
+#include "core/framework/allocator.h"
+#include "core/providers/xnnpack/detail/utils.h"
+
+namespace onnxruntime {
+class GraphViewer;
+namespace xnnpack {
+
+// Binary element-wise Add/Mul with numpy-style broadcasting.
+// Handles the float ONNX operators directly and the u8/s8 QDQ node units
+// that get fused into QLinearAdd/QLinearMul by FuseQDQGroup.
+class ElementWise final : public XnnpackKernel {
+ public:
+  ElementWise(const OpKernelInfo& info);
+
+  Status Compute(OpKernelContext* ctx) const override;
+  static bool IsOnnxNodeSupported(const NodeUnit& node_unit, const GraphViewer& graph);
+
+ private:
+  bool is_add_;
+  OpComputeType op_type_ = OpComputeType::op_compute_type_invalid;
+  XnnpackOperator op0_;
+};
+}  // namespace xnnpack
+}  // namespace onnxruntime
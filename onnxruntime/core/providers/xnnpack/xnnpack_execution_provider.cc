@@ -96,6 +96,14 @@ CLASS_ONNX_OPERATOR_VERSIONED_KERNEL_CLASS_NAME_FP16(kXnnpackExecutionProvider,
 CLASS_ONNX_OPERATOR_KERNEL_CLASS_NAME_FP16(kXnnpackExecutionProvider, kMSInternalNHWCDomain, 12, MaxPool);
 
 // ONNX operators
+class ONNX_OPERATOR_VERSIONED_KERNEL_CLASS_NAME(kXnnpackExecutionProvider, kOnnxDomain, 7, 12, Add);
+class ONNX_OPERATOR_VERSIONED_KERNEL_CLASS_NAME(kXnnpackExecutionProvider, kOnnxDomain, 13, 13, Add);
+class ONNX_OPERATOR_KERNEL_CLASS_NAME(kXnnpackExecutionProvider, kOnnxDomain, 14, Add);
+
+class ONNX_OPERATOR_VERSIONED_KERNEL_CLASS_NAME(kXnnpackExecutionProvider, kOnnxDomain, 7, 12, Mul);
+class ONNX_OPERATOR_VERSIONED_KERNEL_CLASS_NAME(kXnnpackExecutionProvider, kOnnxDomain, 13, 13, Mul);
+class ONNX_OPERATOR_KERNEL_CLASS_NAME(kXnnpackExecutionProvider, kOnnxDomain, 14, Mul);
+
 class ONNX_OPERATOR_VERSIONED_KERNEL_CLASS_NAME(kXnnpackExecutionProvider, kOnnxDomain, 7, 8, Gemm);
 class ONNX_OPERATOR_VERSIONED_KERNEL_CLASS_NAME(kXnnpackExecutionProvider, kOnnxDomain, 9, 10, Gemm);
 class ONNX_OPERATOR_VERSIONED_KERNEL_CLASS_NAME(kXnnpackExecutionProvider, kOnnxDomain, 11, 12, Gemm);
@@ -111,6 +119,8 @@ class ONNX_OPERATOR_KERNEL_CLASS_NAME(kXnnpackExecutionProvider, kOnnxDomain, 13
 
 // Internal domain
 class ONNX_OPERATOR_KERNEL_CLASS_NAME(kXnnpackExecutionProvider, kDynamicDomainByCreate, 1, QLinearSoftmax);
+class ONNX_OPERATOR_KERNEL_CLASS_NAME(kXnnpackExecutionProvider, kDynamicDomainByCreate, 1, QLinearAdd);
+class ONNX_OPERATOR_KERNEL_CLASS_NAME(kXnnpackExecutionProvider, kDynamicDomainByCreate, 1, QLinearMul);
 
 std::unique_ptr<KernelRegistry> RegisterKernels() {
   auto kernel_registry = std::make_unique<onnxruntime::KernelRegistry>();
@@ -144,6 +154,14 @@ std::unique_ptr<KernelRegistry> RegisterKernels() {
       KERNEL_CREATE_INFO(19, Resize, kMSInternalNHWCDomain),
 
       // layout insensitive, use ONNX-domain directly
+      KERNEL_CREATE_INFO_VERSIONED(7, 12, Add, kOnnxDomain),
+      KERNEL_CREATE_INFO_VERSIONED(13, 13, Add, kOnnxDomain),
+      KERNEL_CREATE_INFO(14, Add, kOnnxDomain),
+
+      KERNEL_CREATE_INFO_VERSIONED(7, 12, Mul, kOnnxDomain),
+      KERNEL_CREATE_INFO_VERSIONED(13, 13, Mul, kOnnxDomain),
+      KERNEL_CREATE_INFO(14, Mul, kOnnxDomain),
+
       KERNEL_CREATE_INFO_VERSIONED(1, 10, Softmax, kOnnxDomain),
       KERNEL_CREATE_INFO_VERSIONED(11, 12, Softmax, kOnnxDomain),
       KERNEL_CREATE_INFO(13, Softmax, kOnnxDomain),
@@ -164,6 +182,8 @@ std::unique_ptr<KernelRegistry> RegisterKernels() {
       KERNEL_CREATE_INFO_TYPED(10, int8_t, QLinearConv, kMSInternalNHWCDomain),
 
       KERNEL_CREATE_INFO(1, QLinearSoftmax, kDynamicDomainByCreate),
+      KERNEL_CREATE_INFO(1, QLinearAdd, kDynamicDomainByCreate),
+      KERNEL_CREATE_INFO(1, QLinearMul, kDynamicDomainByCreate),
 
 #ifdef XNNPACK_FP16_SUPPORTED
       KERNEL_CREATE_INFO_VERSIONED_TYPED(1, 10, MLFloat16, Conv, kMSInternalNHWCDomain),
@@ -242,7 +262,7 @@ std::vector<AllocatorPtr> XnnpackExecutionProvider::CreatePreferredAllocators()
 // For ops are not lay-out sensitive and does not defined in
 // onnx-domain, it will be created dynamicly
 static bool RequestDynamicSchema(const NodeUnit& node_unit) {
-  static const InlinedHashSet<std::string_view> dynamic_schema_set = {"QLinearSoftmax"};
+  static const InlinedHashSet<std::string_view> dynamic_schema_set = {"QLinearSoftmax", "QLinearAdd", "QLinearMul"};
   std::string key = node_unit.UnitType() == NodeUnit::Type::QDQGroup
                         ? "QLinear" + node_unit.OpType()
                         : node_unit.OpType();
@@ -5,6 +5,7 @@
 #include "core/common/logging/logging.h"
 #include "core/framework/session_state.h"
 #include "core/framework/op_kernel.h"
+#include "core/framework/tensor.h"
 #include "core/framework/utils.h"
 
 namespace onnxruntime {
@@ -30,7 +31,15 @@ common::Status IOBinding::BindInput(const std::string& name, const OrtValue& ml_
     // When OrtValue is empty, the pointer is copied. When it is not
     // (if feeds_[index] is not for example),
     // CopyOneInputAcrossDevices has a different behavior.
+#ifdef ORT_ENABLE_STREAM
+    // Issue any device copy on this binding's own copy stream so it can overlap compute from
+    // an in-flight Run(); SynchronizeInputs() waits for the copies before the next Run().
+    ORT_RETURN_IF_ERROR(utils::CopyOneInputAcrossDevices(
+        session_state_, name, ml_value, new_mlvalue,
+        [this](const OrtDevice& target_device) { return GetOrCreateCopyStream(target_device); }));
+#else
     ORT_RETURN_IF_ERROR(utils::CopyOneInputAcrossDevices(session_state_, name, ml_value, new_mlvalue));
+#endif
     add_or_replace(new_mlvalue);
   } else {
     add_or_replace(ml_value);
@@ -41,10 +50,75 @@ common::Status IOBinding::BindInput(const std::string& name, const OrtValue& ml_
   return Status::OK();
 }
 
+common::Status IOBinding::BindInputRing(const std::string& name, MLDataType element_type,
+                                        const TensorShape& shape, const OrtMemoryInfo& memory_info,
+                                        void* buffer, size_t buffer_size_in_bytes, size_t stride_in_bytes) {
+  ORT_RETURN_IF(element_type == nullptr || element_type->AsPrimitiveDataType() == nullptr,
+                "Ring binding requires a primitive tensor element type.");
+  ORT_RETURN_IF(buffer == nullptr, "Ring buffer must not be null.");
+  ORT_RETURN_IF(shape.Size() <= 0, "Ring binding requires a concrete, non-empty shape.");
+
+  const size_t tensor_size_in_bytes = static_cast<size_t>(shape.Size()) * element_type->Size();
+  ORT_RETURN_IF(stride_in_bytes < tensor_size_in_bytes,
+                "Ring stride (", stride_in_bytes, " bytes) is smaller than one tensor (",
+                tensor_size_in_bytes, " bytes).");
+  ORT_RETURN_IF(buffer_size_in_bytes < tensor_size_in_bytes,
+                "Ring buffer (", buffer_size_in_bytes, " bytes) does not hold one tensor (",
+                tensor_size_in_bytes, " bytes).");
+
+  ring_bindings_[name] = RingBinding{element_type, shape, memory_info, static_cast<char*>(buffer),
+                                     buffer_size_in_bytes, stride_in_bytes, tensor_size_in_bytes};
+  return Status::OK();
+}
+
+common::Status IOBinding::BindInputRingSlot(const std::string& name, size_t offset_in_bytes,
+                                            std::function<void()> consumed_fence) {
+  auto it = ring_bindings_.find(name);
+  ORT_RETURN_IF(it == ring_bindings_.end(), "No ring buffer was registered for input '", name,
+                "'. Call BindInputRing first.");
+
+  const RingBinding& ring = it->second;
+  ORT_RETURN_IF(offset_in_bytes % ring.stride_in_bytes != 0,
+                "Ring slot offset ", offset_in_bytes, " is not a multiple of the stride ",
+                ring.stride_in_bytes, ".");
+  ORT_RETURN_IF(offset_in_bytes > ring.buffer_size_in_bytes ||
+                    ring.buffer_size_in_bytes - offset_in_bytes < ring.tensor_size_in_bytes,
+                "Ring slot at offset ", offset_in_bytes, " does not fit inside the registered region.");
+
+  OrtValue slot_view;
+  Tensor::InitOrtValue(ring.element_type, ring.shape, ring.buffer + offset_in_bytes, ring.memory_info,
+                       slot_view);
+
+  // BindInput feeds the view through unchanged when the region already lives on the input's
+  // device; otherwise it stages a copy (on this binding's copy stream when streams are enabled),
+  // which keeps the call correct at the cost of the zero-copy.
+  ORT_RETURN_IF_ERROR(BindInput(name, slot_view));
+
+  if (consumed_fence) {
+    pending_consumed_fences_.push_back(std::move(consumed_fence));
+  }
+
+  return Status::OK();
+}
+
+void IOBinding::SignalConsumedFences() {
+  // move the fences out first so one that re-binds a slot from its callback does not invalidate
+  // the container being iterated.
+  std::vector<std::function<void()>> fences = std::move(pending_consumed_fences_);
+  pending_consumed_fences_.clear();
+
+  for (auto& fence : fences) {
+    fence();
+  }
+}
+
 void IOBinding::ClearInputs() {
   mapped_feed_names_.clear();
   feed_names_.clear();
   feeds_.clear();
+  ring_bindings_.clear();
+  // fences for slots that were never consumed by a Run are dropped without being signalled
+  pending_consumed_fences_.clear();
 }
 
 static common::Status SyncProviders(const SessionState::NameNodeInfoMapType& node_info_map,
@@ -68,7 +142,38 @@ static common::Status SyncProviders(const SessionState::NameNodeInfoMapType& nod
   return Status::OK();
 }
 
+#ifdef ORT_ENABLE_STREAM
+Stream* IOBinding::GetOrCreateCopyStream(const OrtDevice& device) {
+  for (auto& stream : copy_streams_) {
+    if (stream->GetDevice() == device) {
+      return stream.get();
+    }
+  }
+  auto create_stream_fn = session_state_.GetStreamHandleRegistryInstance().GetCreateStreamFn(device.Type());
+  if (!create_stream_fn) {
+    return nullptr;
+  }
+  auto stream = create_stream_fn(device);
+  if (!stream) {
+    return nullptr;
+  }
+  copy_streams_.push_back(std::move(stream));
+  return copy_streams_.back().get();
+}
+#endif
+
 common::Status IOBinding::SynchronizeInputs() {
+#ifdef ORT_ENABLE_STREAM
+  if (!copy_streams_.empty()) {
+    // The bound inputs were uploaded on this binding's copy streams, so only wait for those
+    // uploads to land. A provider-wide Sync() would also wait for compute issued by any
+    // in-flight Run() and serialize exactly the pipeline this path exists to enable.
+    for (auto& stream : copy_streams_) {
+      stream->Flush();
+    }
+    return Status::OK();
+  }
+#endif
   ORT_RETURN_IF_ERROR(SyncProviders(session_state_.GetInputNodeInfoMap(), session_state_));
   return Status::OK();
 }
@@ -2,11 +2,14 @@
 // Licensed under the MIT License.
 
 #pragma once
+#include <functional>
 #include <string>
 #include <vector>
 #include <unordered_map>
 
 #include "core/framework/execution_provider.h"
+#include "core/framework/data_types.h"
+#include "core/framework/tensor_shape.h"
 #include "core/common/status.h"
 #include "core/graph/basic_types.h"
 #include "core/framework/ort_value.h"
@@ -49,6 +52,32 @@ class IOBinding {
    */
   common::Status BindInput(const std::string& name, const OrtValue& ml_value);
 
+  /**
+   * Register a caller-owned ring buffer as the backing store for an input, for zero-copy
+   * streaming ingestion (e.g. a feature-server writing tensors into a shared-memory ring).
+   * Call once; per Run call BindInputRingSlot with only the byte offset of the slot to consume.
+   * The element type and shape of the tensors in the ring are fixed at registration, and the
+   * region must stay valid until the ring is re-registered or ClearInputs() is called.
+   *
+   * @param memory_info Location of the region. When it matches the device the input is consumed
+   *                    on, the slot is fed to the run as a view with no copy.
+   * @param stride_in_bytes Distance between consecutive slots; must hold one tensor.
+   */
+  common::Status BindInputRing(const std::string& name, MLDataType element_type, const TensorShape& shape,
+                               const OrtMemoryInfo& memory_info, void* buffer, size_t buffer_size_in_bytes,
+                               size_t stride_in_bytes);
+
+  /**
+   * Bind the input registered with BindInputRing to the slot starting at offset_in_bytes, which
+   * must be a multiple of the registered stride. The OrtValue fed to the next Run is a view over
+   * the caller's memory. The optional consumed_fence is signalled exactly once, after the Run
+   * that consumed the slot returns; until then the caller must not overwrite the slot. Run
+   * completion is a conservative upper bound on the plan's last read of the feed, which is not
+   * tracked individually.
+   */
+  common::Status BindInputRingSlot(const std::string& name, size_t offset_in_bytes,
+                                   std::function<void()> consumed_fence = nullptr);
+
   /**
    * If the BindInput calls are async this function acts as a barrier to ensure all inputs are fully copied
    * before you call the Run() method. There is no point calling Run() if you're inputs are not ready at the
@@ -98,6 +127,20 @@ class IOBinding {
  private:
   friend InferenceSession;
 
+  struct RingBinding {
+    MLDataType element_type;
+    TensorShape shape;
+    OrtMemoryInfo memory_info;
+    char* buffer;
+    size_t buffer_size_in_bytes;
+    size_t stride_in_bytes;
+    size_t tensor_size_in_bytes;
+  };
+
+  // Invoked by InferenceSession after a Run over this binding returns; signals and clears the
+  // consumed fences of the ring slots that run fed on.
+  void SignalConsumedFences();
+
   const SessionState& session_state_;
   std::vector<std::string> feed_names_;
   std::unordered_map<std::string, size_t> mapped_feed_names_;
@@ -107,8 +150,21 @@ class IOBinding {
   std::vector<OrtValue> outputs_;
   std::vector<OrtDevice> outputs_device_info_;
 
+  std::unordered_map<std::string, RingBinding> ring_bindings_;
+  std::vector<std::function<void()>> pending_consumed_fences_;
+
   ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(IOBinding);
 
+#ifdef ORT_ENABLE_STREAM
+  // Dedicated copy streams, one per target device, created lazily by the first BindInput that
+  // needs a device copy. Uploads issued on them can overlap compute running on the session's
+  // own streams (e.g. uploading the next request's inputs while the current one executes);
+  // SynchronizeInputs() then only waits for these streams instead of the whole device.
+  Stream* GetOrCreateCopyStream(const OrtDevice& device);
+
+  InlinedVector<std::unique_ptr<Stream>> copy_streams_;
+#endif
+
   // device info for all outputs. only used by InferenceSession if the output is not pre-allocated.
   const std::vector<OrtDevice>& GetOutputsDeviceInfo() const;
 
@@ -8,7 +8,9 @@
 #include "core/framework/error_code_helper.h"
 #include <cstring>
 #include <cassert>
+#include <memory>
 #include <sstream>
+#include <type_traits>
 #include "core/session/inference_session.h"
 #include "abi_session_options_impl.h"
 #include "api_utils.h"
@@ -339,3 +341,273 @@ ORT_API_STATUS_IMPL(OrtApis::SetDeterministicCompute, _Inout_ OrtSessionOptions*
   return nullptr;
   API_IMPL_END
 }
+
+namespace {
+// Binary session-options snapshot. The format is an internal implementation detail: a blob is
+// only guaranteed to restore in the same onnxruntime build that produced it, which is the
+// intended usage (build the options once per process, stamp out sessions from the blob).
+constexpr uint32_t kSessionOptionsSnapshotMagic = 0x4F54524F;  // "ORTO"
+constexpr uint32_t kSessionOptionsSnapshotVersion = 1;
+
+struct SnapshotWriter {
+  std::string buffer;
+
+  void WriteBytes(const void* data, size_t size) {
+    buffer.append(static_cast<const char*>(data), size);
+  }
+
+  template <typename T>
+  void Write(T value) {
+    static_assert(std::is_trivially_copyable_v<T> && !std::is_pointer_v<T>);
+    WriteBytes(&value, sizeof(value));
+  }
+
+  void WriteString(const std::string& s) {
+    Write(static_cast<uint64_t>(s.size()));
+    WriteBytes(s.data(), s.size());
+  }
+};
+
+struct SnapshotReader {
+  const char* data;
+  size_t size;
+  size_t pos = 0;
+
+  bool ReadBytes(void* out, size_t n) {
+    if (n > size - pos) return false;
+    memcpy(out, data + pos, n);
+    pos += n;
+    return true;
+  }
+
+  template <typename T>
+  bool Read(T& value) {
+    static_assert(std::is_trivially_copyable_v<T> && !std::is_pointer_v<T>);
+    return ReadBytes(&value, sizeof(value));
+  }
+
+  bool ReadString(std::string& s) {
+    uint64_t n = 0;
+    if (!Read(n) || n > size - pos) return false;
+    s.assign(data + pos, static_cast<size_t>(n));
+    pos += static_cast<size_t>(n);
+    return true;
+  }
+};
+
+OrtStatus* CheckThreadPoolParamsSerializable(const OrtThreadPoolParams& params, const char* which) {
+  if (params.custom_create_thread_fn != nullptr || params.custom_join_thread_fn != nullptr) {
+    auto message = onnxruntime::MakeString("Session options with custom ", which,
+                                           " thread creation callbacks cannot be snapshotted");
+    return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, message.c_str());
+  }
+  return nullptr;
+}
+
+void WriteThreadPoolParams(SnapshotWriter& writer, const OrtThreadPoolParams& params) {
+  writer.Write(static_cast<int32_t>(params.thread_pool_size));
+  writer.Write(static_cast<uint8_t>(params.auto_set_affinity));
+  writer.Write(static_cast<uint8_t>(params.allow_spinning));
+  writer.Write(static_cast<int32_t>(params.dynamic_block_base_));
+  writer.Write(static_cast<uint32_t>(params.stack_size));
+  writer.Write(static_cast<int32_t>(params.steal_domain_size));
+  writer.Write(static_cast<int32_t>(params.small_loop_max_helpers));
+  writer.Write(static_cast<uint8_t>(params.adaptive_degree));
+  writer.WriteString(params.affinity_str);
+  writer.Write(static_cast<uint8_t>(params.set_denormal_as_zero));
+}
+
+bool ReadThreadPoolParams(SnapshotReader& reader, OrtThreadPoolParams& params) {
+  int32_t thread_pool_size, dynamic_block_base, steal_domain_size, small_loop_max_helpers;
+  uint32_t stack_size;
+  uint8_t auto_set_affinity, allow_spinning, adaptive_degree, set_denormal_as_zero;
+  if (!reader.Read(thread_pool_size) || !reader.Read(auto_set_affinity) || !reader.Read(allow_spinning) ||
+      !reader.Read(dynamic_block_base) || !reader.Read(stack_size) || !reader.Read(steal_domain_size) ||
+      !reader.Read(small_loop_max_helpers) || !reader.Read(adaptive_degree) ||
+      !reader.ReadString(params.affinity_str) || !reader.Read(set_denormal_as_zero)) {
+    return false;
+  }
+  params.thread_pool_size = thread_pool_size;
+  params.auto_set_affinity = auto_set_affinity != 0;
+  params.allow_spinning = allow_spinning != 0;
+  params.dynamic_block_base_ = dynamic_block_base;
+  params.stack_size = stack_size;
+  params.steal_domain_size = steal_domain_size;
+  params.small_loop_max_helpers = small_loop_max_helpers;
+  params.adaptive_degree = adaptive_degree != 0;
+  params.set_denormal_as_zero = set_denormal_as_zero != 0;
+  return true;
+}
+}  // namespace
+
+ORT_API_STATUS_IMPL(OrtApis::SessionOptionsToSnapshot, _In_ const OrtSessionOptions* options,
+                    _Inout_ OrtAllocator* allocator, _Outptr_ void** snapshot, _Out_ size_t* size) {
+  API_IMPL_BEGIN
+  // Reject state that cannot round-trip through bytes rather than silently dropping it.
+  // Everything below holds process-local pointers or handles.
+  if (!options->provider_factories.empty() || !options->custom_op_domains_.empty()) {
+    return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT,
+                                 "Session options with execution providers or custom op domains cannot be "
+                                 "snapshotted; append them after restoring");
+  }
+
+  const onnxruntime::SessionOptions& so = options->value;
+  if (so.user_logging_function != nullptr || so.custom_create_thread_fn != nullptr ||
+      so.custom_join_thread_fn != nullptr) {
+    return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT,
+                                 "Session options with user callbacks cannot be snapshotted");
+  }
+
+  if (!so.initializers_to_share_map.empty()
+#if !defined(ORT_MINIMAL_BUILD) && !defined(DISABLE_EXTERNAL_INITIALIZERS)
+      || !so.external_initializers.empty() || !so.external_initializer_files_mmap.empty()
+#endif
+  ) {
+    return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT,
+                                 "Session options referencing user-owned initializer buffers cannot be "
+                                 "snapshotted; add them after restoring");
+  }
+
+  if (auto* status = CheckThreadPoolParamsSerializable(so.intra_op_param, "intra-op"); status != nullptr) {
+    return status;
+  }
+  if (auto* status = CheckThreadPoolParamsSerializable(so.inter_op_param, "inter-op"); status != nullptr) {
+    return status;
+  }
+
+  SnapshotWriter writer;
+  writer.Write(kSessionOptionsSnapshotMagic);
+  writer.Write(kSessionOptionsSnapshotVersion);
+
+  writer.Write(static_cast<int32_t>(so.execution_mode));
+  writer.Write(static_cast<int32_t>(so.execution_order));
+  writer.Write(static_cast<uint8_t>(so.enable_profiling));
+  writer.WriteString(onnxruntime::PathToUTF8String(so.optimized_model_filepath.native()));
+  writer.Write(static_cast<uint8_t>(so.enable_mem_pattern));
+  writer.Write(static_cast<uint8_t>(so.enable_mem_reuse));
+  writer.Write(static_cast<uint8_t>(so.enable_cpu_mem_arena));
+  writer.WriteString(onnxruntime::PathToUTF8String(so.profile_file_prefix));
+  writer.WriteString(so.session_logid);
+  writer.Write(static_cast<int32_t>(so.session_log_severity_level));
+  writer.Write(static_cast<int32_t>(so.session_log_verbosity_level));
+  writer.Write(static_cast<uint32_t>(so.max_num_graph_transformation_steps));
+  writer.Write(static_cast<int32_t>(so.graph_optimization_level));
+  WriteThreadPoolParams(writer, so.intra_op_param);
+  WriteThreadPoolParams(writer, so.inter_op_param);
+
+  writer.Write(static_cast<uint64_t>(so.free_dimension_overrides.size()));
+  for (const auto& override_entry : so.free_dimension_overrides) {
+    writer.WriteString(override_entry.dim_identifier);
+    writer.Write(static_cast<int32_t>(override_entry.dim_identifier_type));
+    writer.Write(static_cast<int64_t>(override_entry.dim_value));
+  }
+
+  writer.Write(static_cast<uint8_t>(so.use_per_session_threads));
+  writer.Write(static_cast<uint8_t>(so.thread_pool_allow_spinning));
+  writer.Write(static_cast<uint8_t>(so.use_deterministic_compute));
+
+  writer.Write(static_cast<uint64_t>(so.config_options.configurations.size()));
+  for (const auto& [key, value] : so.config_options.configurations) {
+    writer.WriteString(key);
+    writer.WriteString(value);
+  }
+
+  void* out = allocator->Alloc(allocator, writer.buffer.size());
+  if (out == nullptr) {
+    return OrtApis::CreateStatus(ORT_FAIL, "Failed to allocate the session options snapshot buffer");
+  }
+  memcpy(out, writer.buffer.data(), writer.buffer.size());
+  *snapshot = out;
+  *size = writer.buffer.size();
+  return nullptr;
+  API_IMPL_END
+}
+
+ORT_API_STATUS_IMPL(OrtApis::CreateSessionOptionsFromSnapshot, _In_reads_(size) const void* snapshot,
+                    _In_ size_t size, _Outptr_ OrtSessionOptions** out) {
+  API_IMPL_BEGIN
+  auto corrupt = []() {
+    return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, "Session options snapshot is truncated or corrupt");
+  };
+
+  SnapshotReader reader{static_cast<const char*>(snapshot), size};
+  uint32_t magic = 0, version = 0;
+  if (!reader.Read(magic) || !reader.Read(version)) return corrupt();
+  if (magic != kSessionOptionsSnapshotMagic) return corrupt();
+  if (version != kSessionOptionsSnapshotVersion) {
+    return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT,
+                                 "Session options snapshot was produced by an incompatible onnxruntime version");
+  }
+
+  auto options = std::make_unique<OrtSessionOptions>();
+  onnxruntime::SessionOptions& so = options->value;
+
+  int32_t execution_mode, execution_order, log_severity, log_verbosity, optimization_level;
+  uint8_t enable_profiling, enable_mem_pattern, enable_mem_reuse, enable_cpu_mem_arena;
+  uint8_t use_per_session_threads, thread_pool_allow_spinning, use_deterministic_compute;
+  uint32_t max_transformation_steps;
+  std::string optimized_model_filepath, profile_file_prefix;
+  if (!reader.Read(execution_mode) || !reader.Read(execution_order) || !reader.Read(enable_profiling) ||
+      !reader.ReadString(optimized_model_filepath) || !reader.Read(enable_mem_pattern) ||
+      !reader.Read(enable_mem_reuse) || !reader.Read(enable_cpu_mem_arena) ||
+      !reader.ReadString(profile_file_prefix) || !reader.ReadString(so.session_logid) ||
+      !reader.Read(log_severity) || !reader.Read(log_verbosity) || !reader.Read(max_transformation_steps) ||
+      !reader.Read(optimization_level) || !ReadThreadPoolParams(reader, so.intra_op_param) ||
+      !ReadThreadPoolParams(reader, so.inter_op_param)) {
+    return corrupt();
+  }
+
+  so.execution_mode = static_cast<ExecutionMode>(execution_mode);
+  so.execution_order = static_cast<onnxruntime::ExecutionOrder>(execution_order);
+  so.enable_profiling = enable_profiling != 0;
+  so.optimized_model_filepath = onnxruntime::ToPathString(optimized_model_filepath);
+  so.enable_mem_pattern = enable_mem_pattern != 0;
+  so.enable_mem_reuse = enable_mem_reuse != 0;
+  so.enable_cpu_mem_arena = enable_cpu_mem_arena != 0;
+  so.profile_file_prefix = onnxruntime::ToPathString(profile_file_prefix);
+  so.session_log_severity_level = log_severity;
+  so.session_log_verbosity_level = log_verbosity;
+  so.max_num_graph_transformation_steps = max_transformation_steps;
+  so.graph_optimization_level = static_cast<onnxruntime::TransformerLevel>(optimization_level);
+
+  uint64_t num_overrides = 0;
+  if (!reader.Read(num_overrides)) return corrupt();
+  so.free_dimension_overrides.reserve(static_cast<size_t>(num_overrides));
+  for (uint64_t i = 0; i < num_overrides; ++i) {
+    onnxruntime::FreeDimensionOverride override_entry;
+    int32_t identifier_type;
+    int64_t dim_value;
+    if (!reader.ReadString(override_entry.dim_identifier) || !reader.Read(identifier_type) ||
+        !reader.Read(dim_value)) {
+      return corrupt();
+    }
+    override_entry.dim_identifier_type = static_cast<onnxruntime::FreeDimensionOverrideType>(identifier_type);
+    override_entry.dim_value = dim_value;
+    so.free_dimension_overrides.push_back(std::move(override_entry));
+  }
+
+  if (!reader.Read(use_per_session_threads) || !reader.Read(thread_pool_allow_spinning) ||
+      !reader.Read(use_deterministic_compute)) {
+    return corrupt();
+  }
+  so.use_per_session_threads = use_per_session_threads != 0;
+  so.thread_pool_allow_spinning = thread_pool_allow_spinning != 0;
+  so.use_deterministic_compute = use_deterministic_compute != 0;
+
+  // Entries were validated by AddSessionConfigEntry before the snapshot was taken, so they are
+  // inserted directly here - no per-key validation or overwrite handling on the hot path.
+  uint64_t num_config_entries = 0;
+  if (!reader.Read(num_config_entries)) return corrupt();
+  so.config_options.configurations.reserve(static_cast<size_t>(num_config_entries));
+  for (uint64_t i = 0; i < num_config_entries; ++i) {
+    std::string key, value;
+    if (!reader.ReadString(key) || !reader.ReadString(value)) return corrupt();
+    so.config_options.configurations.emplace(std::move(key), std::move(value));
+  }
+
+  if (reader.pos != reader.size) return corrupt();
+
+  *out = options.release();
+  return nullptr;
+  API_IMPL_END
+}
@@ -21,6 +21,10 @@ OrtAllocatorImplWrappingIAllocator::OrtAllocatorImplWrappingIAllocator(onnxrunti
     OrtAllocator::Reserve =
         [](OrtAllocator* this_, size_t size) { return static_cast<OrtAllocatorImplWrappingIAllocator*>(this_)->Reserve(size); };
   }
+  if (OrtAllocator::version >= 21) {
+    OrtAllocator::GetStats =
+        [](const OrtAllocator* this_, OrtAllocatorStats* stats) { static_cast<const OrtAllocatorImplWrappingIAllocator*>(this_)->GetStats(stats); };
+  }
 }
 
 void* OrtAllocatorImplWrappingIAllocator::Alloc(size_t size) {
@@ -39,6 +43,22 @@ const OrtMemoryInfo* OrtAllocatorImplWrappingIAllocator::Info() const {
   return &i_allocator_->Info();
 }
 
+void OrtAllocatorImplWrappingIAllocator::GetStats(OrtAllocatorStats* stats) const {
+  onnxruntime::AllocatorStats i_stats;
+  i_stats.Clear();
+  i_allocator_->GetStats(&i_stats);
+  stats->num_allocs = i_stats.num_allocs;
+  stats->num_reserves = i_stats.num_reserves;
+  stats->num_arena_extensions = i_stats.num_arena_extensions;
+  stats->num_arena_shrinkages = i_stats.num_arena_shrinkages;
+  stats->bytes_in_use = i_stats.bytes_in_use;
+  stats->total_allocated_bytes = i_stats.total_allocated_bytes;
+  stats->max_bytes_in_use = i_stats.max_bytes_in_use;
+  stats->max_alloc_size = i_stats.max_alloc_size;
+  stats->bytes_limit = i_stats.bytes_limit;
+  stats->largest_free_chunk_bytes = i_stats.largest_free_chunk_bytes;
+}
+
 onnxruntime::AllocatorPtr OrtAllocatorImplWrappingIAllocator::GetWrappedIAllocator() {
   return i_allocator_;
 }
@@ -62,6 +82,24 @@ void IAllocatorImplWrappingOrtAllocator::Free(void* p) {
   return ort_allocator_->Free(ort_allocator_, p);
 }
 
+void IAllocatorImplWrappingOrtAllocator::GetStats(AllocatorStats* stats) {
+  stats->Clear();
+  if (ort_allocator_->version >= 21 && ort_allocator_->GetStats) {
+    OrtAllocatorStats ort_stats{};
+    ort_allocator_->GetStats(ort_allocator_, &ort_stats);
+    stats->num_allocs = ort_stats.num_allocs;
+    stats->num_reserves = ort_stats.num_reserves;
+    stats->num_arena_extensions = ort_stats.num_arena_extensions;
+    stats->num_arena_shrinkages = ort_stats.num_arena_shrinkages;
+    stats->bytes_in_use = ort_stats.bytes_in_use;
+    stats->total_allocated_bytes = ort_stats.total_allocated_bytes;
+    stats->max_bytes_in_use = ort_stats.max_bytes_in_use;
+    stats->max_alloc_size = ort_stats.max_alloc_size;
+    stats->bytes_limit = ort_stats.bytes_limit;
+    stats->largest_free_chunk_bytes = ort_stats.largest_free_chunk_bytes;
+  }
+}
+
 }  // namespace onnxruntime
 #if defined(_MSC_VER) && !defined(__clang__)
 #pragma warning(disable : 26409)
@@ -28,6 +28,7 @@ struct OrtAllocatorImplWrappingIAllocator final : public OrtAllocatorImpl {
 
   const OrtMemoryInfo* Info() const;
   void* Reserve(size_t size);
+  void GetStats(OrtAllocatorStats* stats) const;
 
   ORT_DISALLOW_COPY_AND_ASSIGNMENT(OrtAllocatorImplWrappingIAllocator);
 
@@ -48,6 +49,8 @@ class IAllocatorImplWrappingOrtAllocator final : public IAllocator {
 
   void Free(void* p) override;
 
+  void GetStats(AllocatorStats* stats) override;
+
   ORT_DISALLOW_COPY_AND_ASSIGNMENT(IAllocatorImplWrappingOrtAllocator);
 
  private:
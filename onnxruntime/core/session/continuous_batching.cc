@@ -0,0 +1,190 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/session/continuous_batching.h"
+
+#include <algorithm>
+
+#include "core/common/narrow.h"
+
+namespace onnxruntime {
+
+ContinuousBatchingManager::ContinuousBatchingManager(int64_t num_pages, int64_t page_size,
+                                                     size_t max_batch_size)
+    : page_size_(page_size), max_batch_size_(max_batch_size) {
+  ORT_ENFORCE(num_pages > 0 && page_size > 0 && max_batch_size > 0,
+              "num_pages, page_size and max_batch_size must all be positive.");
+
+  // hand out low page indices first so short-lived tests and traces stay readable
+  free_pages_.reserve(narrow<size_t>(num_pages));
+  for (int64_t page = num_pages - 1; page >= 0; --page) {
+    free_pages_.push_back(narrow<int32_t>(page));
+  }
+}
+
+bool ContinuousBatchingManager::CanAdmit(int64_t prompt_length) const {
+  return prompt_length > 0 &&
+         requests_.size() < max_batch_size_ &&
+         static_cast<int64_t>(free_pages_.size()) >= PagesNeeded(prompt_length);
+}
+
+common::Status ContinuousBatchingManager::AddRequest(int64_t request_id, int64_t prompt_length) {
+  ORT_RETURN_IF(prompt_length <= 0, "prompt_length must be positive, got ", prompt_length);
+
+  for (const auto& [id, state] : requests_) {
+    ORT_RETURN_IF(id == request_id, "Request ", request_id, " is already active.");
+  }
+
+  ORT_RETURN_IF(requests_.size() >= max_batch_size_,
+                "All ", max_batch_size_, " batch rows are occupied; retire a request first.");
+
+  const int64_t pages_needed = PagesNeeded(prompt_length);
+  ORT_RETURN_IF(static_cast<int64_t>(free_pages_.size()) < pages_needed,
+                "Request ", request_id, " needs ", pages_needed, " pages for its prompt but only ",
+                free_pages_.size(), " are free; retire a request first.");
+
+  RequestState state;
+  state.prompt_length = prompt_length;
+  state.pages.reserve(narrow<size_t>(pages_needed));
+  for (int64_t i = 0; i < pages_needed; ++i) {
+    state.pages.push_back(free_pages_.back());
+    free_pages_.pop_back();
+  }
+
+  requests_.emplace_back(request_id, std::move(state));
+  return Status::OK();
+}
+
+common::Status ContinuousBatchingManager::RemoveRequest(int64_t request_id) {
+  // any staged step is built over the old request set; drop it before mutating the set
+  RollbackPendingStep();
+
+  auto it = std::find_if(requests_.begin(), requests_.end(),
+                         [&](const auto& entry) { return entry.first == request_id; });
+  ORT_RETURN_IF(it == requests_.end(), "Request ", request_id, " is not active.");
+
+  for (int32_t page : it->second.pages) {
+    free_pages_.push_back(page);
+  }
+  requests_.erase(it);
+  return Status::OK();
+}
+
+void ContinuousBatchingManager::RollbackPendingStep() {
+  if (!step_pending_) {
+    return;
+  }
+
+  for (auto& entry : requests_) {
+    RequestState& state = entry.second;
+    while (state.staged_page_count > 0) {
+      free_pages_.push_back(state.pages.back());
+      state.pages.pop_back();
+      --state.staged_page_count;
+    }
+  }
+  step_pending_ = false;
+}
+
+common::Status ContinuousBatchingManager::StagePages(RequestState& state, int64_t target_length) {
+  const int64_t pages_needed = PagesNeeded(target_length) - static_cast<int64_t>(state.pages.size());
+  for (int64_t i = 0; i < pages_needed; ++i) {
+    if (free_pages_.empty()) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL,
+                             "The KV page pool is exhausted; retire a request to make room.");
+    }
+    state.pages.push_back(free_pages_.back());
+    free_pages_.pop_back();
+    ++state.staged_page_count;
+  }
+  return Status::OK();
+}
+
+common::Status ContinuousBatchingManager::PrepareStep(Step& step) {
+  // a pending step that was never committed belongs to a failed run; rebuild from scratch
+  RollbackPendingStep();
+
+  pending_step_ = Step{};
+
+  const bool has_pending_prefill =
+      std::any_of(requests_.begin(), requests_.end(),
+                  [](const auto& entry) { return !entry.second.prefilled; });
+
+  // collect the rows for this step and stage the pages their new tokens need. staging is
+  // all-or-nothing: on failure the rollback above (run by the next PrepareStep) or the one
+  // below restores the free list.
+  for (auto& [id, state] : requests_) {
+    if (has_pending_prefill != !state.prefilled) {
+      continue;
+    }
+
+    const int64_t input_length = has_pending_prefill ? state.prompt_length : 1;
+    const int64_t total_after = state.committed_length + input_length;
+
+    auto status = StagePages(state, total_after);
+    if (!status.IsOK()) {
+      step_pending_ = true;  // let RollbackPendingStep undo the rows staged so far
+      RollbackPendingStep();
+      return status;
+    }
+
+    pending_step_.request_ids.push_back(id);
+    pending_step_.input_lengths.push_back(input_length);
+    pending_step_.seqlens_k.push_back(narrow<int32_t>(total_after - 1));
+    pending_step_.total_sequence_length =
+        std::max(pending_step_.total_sequence_length, narrow<int32_t>(total_after));
+    pending_step_.max_blocks_per_sequence =
+        std::max(pending_step_.max_blocks_per_sequence, static_cast<int64_t>(state.pages.size()));
+  }
+
+  if (pending_step_.request_ids.empty()) {
+    step = Step{};
+    return Status::OK();
+  }
+
+  pending_step_.kind = has_pending_prefill ? StepKind::kPrefill : StepKind::kDecode;
+
+  // densely packed block table rows in batch row order; this is all the "slot compaction" a
+  // paged cache needs, since no request's pages move when its row index changes
+  pending_step_.block_table.resize(
+      pending_step_.request_ids.size() * narrow<size_t>(pending_step_.max_blocks_per_sequence), 0);
+  size_t row = 0;
+  for (const auto& [id, state] : requests_) {
+    if (row < pending_step_.request_ids.size() && pending_step_.request_ids[row] == id) {
+      std::copy(state.pages.begin(), state.pages.end(),
+                pending_step_.block_table.begin() + row * narrow<size_t>(pending_step_.max_blocks_per_sequence));
+      ++row;
+    }
+  }
+
+  step_pending_ = true;
+  step = pending_step_;
+  return Status::OK();
+}
+
+common::Status ContinuousBatchingManager::CommitStep() {
+  ORT_RETURN_IF_NOT(step_pending_, "No step is pending; call PrepareStep first.");
+
+  size_t row = 0;
+  for (auto& [id, state] : requests_) {
+    if (row < pending_step_.request_ids.size() && pending_step_.request_ids[row] == id) {
+      state.committed_length += pending_step_.input_lengths[row];
+      state.prefilled = true;
+      state.staged_page_count = 0;
+      ++row;
+    }
+  }
+
+  step_pending_ = false;
+  return Status::OK();
+}
+
+common::Status ContinuousBatchingManager::GetSequenceLength(int64_t request_id, int64_t& length) const {
+  auto it = std::find_if(requests_.begin(), requests_.end(),
+                         [&](const auto& entry) { return entry.first == request_id; });
+  ORT_RETURN_IF(it == requests_.end(), "Request ", request_id, " is not active.");
+  length = it->second.committed_length;
+  return Status::OK();
+}
+
+}  // namespace onnxruntime
@@ -0,0 +1,147 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstdint>
+
+#include "core/common/common.h"
+#include "core/common/inlined_containers.h"
+#include "core/common/status.h"
+
+namespace onnxruntime {
+
+/**
+ * Iteration-level scheduling state for serving a decoder-only model whose attention runs through
+ * GroupQueryAttention with a paged KV cache (block_table input). The manager owns the
+ * request -> batch row mapping and the page accounting for a caller-allocated page pool; the
+ * caller owns the InferenceSession, the token tensors and sampling. Because the KV cache is
+ * addressed through the block table rather than by batch row, requests can join and leave the
+ * running batch at any iteration without re-running prefill for the others and without copying
+ * cache entries: "compacting" the batch is just emitting densely packed block table rows for
+ * whichever requests are live this step.
+ *
+ * Per iteration the caller asks for the next step, builds the model feeds from it, runs the
+ * session, samples, then commits:
+ *
+ * ContinuousBatchingManager::Step step;
+ * ORT_RETURN_IF_ERROR(manager.PrepareStep(step));
+ * ... feed one token per row (decode) or the padded prompts (prefill), plus step.seqlens_k,
+ *     step.total_sequence_length and step.block_table, and run the session ...
+ * ORT_RETURN_IF_ERROR(manager.CommitStep());
+ *
+ * A step is either a prefill over the requests admitted since the last prefill or a decode over
+ * every running request, never a mix: GroupQueryAttention takes one query sequence length for the
+ * whole batch, so folding fresh prompts into a decode step would pad every running request's
+ * query up to the longest prompt. Keeping the phases separate means a join costs one extra
+ * iteration for the joiners only.
+ *
+ * If the run fails the caller simply does not commit; the next PrepareStep rolls back any pages
+ * staged for the failed step and rebuilds it. Not thread-safe; serialize access externally.
+ */
+class ContinuousBatchingManager {
+ public:
+  // Describes the caller's KV page pool: past_key/past_value have shape
+  // (num_pages, kv_num_heads, page_size, head_size). max_batch_size bounds how many requests may
+  // be active at once and therefore the batch dimension of the feeds the caller must build.
+  ContinuousBatchingManager(int64_t num_pages, int64_t page_size, size_t max_batch_size);
+
+  enum class StepKind {
+    kNone,     // nothing to run: no active requests
+    kPrefill,  // run the newly admitted prompts
+    kDecode,   // run one generation step for every running request
+  };
+
+  struct Step {
+    StepKind kind{StepKind::kNone};
+
+    // Active requests in batch row order for this step. The caller gathers its per-request
+    // inputs (token ids, positions) into this order.
+    InlinedVector<int64_t> request_ids;
+
+    // Tokens the caller must feed per row: the prompt length for prefill rows, 1 for decode.
+    // Prefill queries are padded to the longest prompt in the step; seqlens_k tells the kernel
+    // where each row's real tokens end.
+    InlinedVector<int64_t> input_lengths;
+
+    // GroupQueryAttention's seqlens_k feed: per row, total sequence length after this step
+    // minus one.
+    InlinedVector<int32_t> seqlens_k;
+
+    // GroupQueryAttention's total_sequence_length feed: the longest total sequence length in
+    // the step.
+    int32_t total_sequence_length{0};
+
+    // Row-major (request_ids.size(), max_blocks_per_sequence) block table covering each row's
+    // sequence after this step, zero-padded past a row's last page.
+    int64_t max_blocks_per_sequence{0};
+    InlinedVector<int32_t> block_table;
+  };
+
+  // Returns true if a request with the given prompt length can be admitted right now, i.e. a
+  // batch row and enough free pages are available.
+  bool CanAdmit(int64_t prompt_length) const;
+
+  // Admits a request and reserves the pages for its prompt. The request joins the next prefill
+  // step. Fails when the id is already active, the prompt length is not positive, or capacity
+  // is exhausted (see CanAdmit); the caller's scheduler decides whether to queue or to evict a
+  // running request in that case.
+  common::Status AddRequest(int64_t request_id, int64_t prompt_length);
+
+  // Retires a request and returns its pages to the pool. Valid at any point between steps,
+  // including for a request that has not been prefilled yet.
+  common::Status RemoveRequest(int64_t request_id);
+
+  // Builds the next step, staging any page allocations it needs. All-or-nothing: when the pool
+  // cannot cover the step's new tokens the call fails without changing any state, and the
+  // caller must retire a request to make room.
+  common::Status PrepareStep(Step& step);
+
+  // Commits the pending step after a successful run: staged pages become permanent and every
+  // row's sequence length advances by its input length. Fails when no step is pending.
+  common::Status CommitStep();
+
+  size_t NumActiveRequests() const { return requests_.size(); }
+  int64_t NumFreePages() const { return static_cast<int64_t>(free_pages_.size()); }
+  int64_t PageSize() const { return page_size_; }
+
+  // Total tokens in the KV cache for the given request (committed steps only).
+  common::Status GetSequenceLength(int64_t request_id, int64_t& length) const;
+
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(ContinuousBatchingManager);
+
+ private:
+  struct RequestState {
+    int64_t prompt_length{0};
+    // Tokens written to the KV cache by committed steps. 0 until the prefill commits.
+    int64_t committed_length{0};
+    bool prefilled{false};
+    // Pages backing this request, in sequence order. The last staged_page_count entries were
+    // reserved by a pending (uncommitted) step.
+    InlinedVector<int32_t> pages;
+    int64_t staged_page_count{0};
+  };
+
+  int64_t PagesNeeded(int64_t length) const {
+    return (length + page_size_ - 1) / page_size_;
+  }
+
+  // Returns pages staged by an uncommitted step to the free list.
+  void RollbackPendingStep();
+
+  common::Status StagePages(RequestState& state, int64_t target_length);
+
+  int64_t page_size_;
+  size_t max_batch_size_;
+
+  InlinedVector<int32_t> free_pages_;
+
+  // Active requests keyed by caller-assigned id. Iteration order is insertion order so batch
+  // rows stay stable across decode steps while the set of requests is unchanged.
+  InlinedVector<std::pair<int64_t, RequestState>> requests_;
+
+  bool step_pending_{false};
+  Step pending_step_;
+};
+
+}  // namespace onnxruntime
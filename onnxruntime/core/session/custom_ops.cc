@@ -169,6 +169,37 @@ ORT_API_STATUS_IMPL(OrtApis::KernelContext_GetInput, _In_ const OrtKernelContext
   });
 };
 
+ORT_API_STATUS_IMPL(OrtApis::KernelContext_GetInputViews, _In_ const OrtKernelContext* context,
+                    _Out_writes_(num_views) OrtTensorView* views, _In_ size_t num_views) {
+  return ExecuteIfKernelContextApiEnabled([&]() -> OrtStatusPtr {
+    const auto* ctx = reinterpret_cast<const onnxruntime::OpKernelContextInternal*>(context);
+    if (num_views != static_cast<size_t>(ctx->InputCount())) {
+      return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, "num_views must equal the kernel's input count");
+    }
+
+    for (size_t i = 0; i < num_views; ++i) {
+      OrtTensorView& view = views[i];
+      const auto* input = ctx->GetInputMLValue(onnxruntime::narrow<int>(i));
+      if (input == nullptr || !input->IsTensor()) {
+        view = {};
+        view.element_type = ONNX_TENSOR_ELEMENT_DATA_TYPE_UNDEFINED;
+        continue;
+      }
+
+      // the views alias the tensor's data and shape storage, which outlive the compute call
+      const auto& tensor = input->Get<onnxruntime::Tensor>();
+      const auto dims = tensor.Shape().GetDims();
+      view.data = tensor.DataRaw();
+      view.shape = dims.empty() ? nullptr : dims.data();
+      view.num_dims = dims.size();
+      view.num_elements = onnxruntime::narrow<size_t>(tensor.Shape().Size());
+      view.element_type = MLDataTypeToOnnxRuntimeTensorElementDataType(tensor.DataType());
+    }
+
+    return nullptr;
+  });
+};
+
 ORT_API_STATUS_IMPL(OrtApis::KernelContext_GetOutput, _Inout_ OrtKernelContext* context, _In_ size_t index,
                     _In_ const int64_t* dim_values, size_t dim_count, _Out_ OrtValue** out) {
   return ExecuteIfKernelContextApiEnabled([&]() -> OrtStatusPtr {
@@ -0,0 +1,248 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#if !defined(ORT_MINIMAL_BUILD)
+
+#include "core/session/dynamic_batcher.h"
+
+#include <sstream>
+
+#include "core/framework/allocator.h"
+#include "core/framework/data_types.h"
+#include "core/framework/tensor.h"
+#include "core/session/inference_session.h"
+
+namespace onnxruntime {
+
+namespace {
+
+// A request can be batched if every feed is a non-string CPU tensor with at
+// least one dimension (the batch dimension) that holds one or more entries,
+// and every feed agrees with feeds[0] on the size of that dimension: the
+// leading dimension of feeds[0] is used as the gather extent and the scatter
+// split size for the whole request.
+bool IsBatchable(gsl::span<const OrtValue> feeds) {
+  int64_t batch_count = -1;
+  for (const auto& feed : feeds) {
+    if (!feed.IsAllocated() || !feed.IsTensor()) {
+      return false;
+    }
+
+    const Tensor& tensor = feed.Get<Tensor>();
+    if (tensor.IsDataTypeString() ||
+        tensor.Location().device.Type() != OrtDevice::CPU ||
+        tensor.Shape().NumDimensions() < 1 ||
+        tensor.Shape()[0] < 1) {
+      return false;
+    }
+
+    if (batch_count < 0) {
+      batch_count = tensor.Shape()[0];
+    } else if (tensor.Shape()[0] != batch_count) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// Two requests may share a batch iff they have the same feed/output names and
+// every feed has the same element type and the same non-batch dimensions.
+std::string MakeBatchSignature(gsl::span<const std::string> feed_names, gsl::span<const OrtValue> feeds,
+                               gsl::span<const std::string> output_names) {
+  std::ostringstream oss;
+  for (size_t i = 0, end = feeds.size(); i < end; ++i) {
+    const Tensor& tensor = feeds[i].Get<Tensor>();
+    oss << feed_names[i] << ':' << DataTypeImpl::ToString(tensor.DataType());
+    auto dims = tensor.Shape().GetDims();
+    for (size_t dim = 1; dim < dims.size(); ++dim) {
+      oss << 'x' << dims[dim];
+    }
+    oss << ';';
+  }
+
+  oss << '|';
+  for (const auto& output_name : output_names) {
+    oss << output_name << ';';
+  }
+
+  return oss.str();
+}
+
+}  // namespace
+
+DynamicBatcher::DynamicBatcher(InferenceSession& session, const DynamicBatcherOptions& options)
+    : session_(session), options_(options) {
+  ORT_ENFORCE(options_.max_batch_size > 0, "max_batch_size must be positive.");
+}
+
+DynamicBatcher::~DynamicBatcher() = default;
+
+common::Status DynamicBatcher::Run(const RunOptions& run_options,
+                                   gsl::span<const std::string> feed_names, gsl::span<const OrtValue> feeds,
+                                   gsl::span<const std::string> output_names, std::vector<OrtValue>* p_fetches) {
+  ORT_RETURN_IF(p_fetches == nullptr, "p_fetches must not be null.");
+
+  if (options_.max_batch_size <= 1 || !IsBatchable(feeds)) {
+    return session_.Run(run_options, feed_names, feeds, output_names, p_fetches);
+  }
+
+  const std::string signature = MakeBatchSignature(feed_names, feeds, output_names);
+  const size_t max_batch_size = static_cast<size_t>(options_.max_batch_size);
+
+  PendingRequest request;
+  request.feeds = feeds;
+  request.p_fetches = p_fetches;
+  request.batch_count = feeds[0].Get<Tensor>().Shape()[0];
+
+  std::unique_lock<OrtMutex> lock(mutex_);
+
+  auto it = open_batches_.find(signature);
+  if (it != open_batches_.end()) {
+    // Join an open batch as a follower and wait for the leader to execute it.
+    std::shared_ptr<Batch> batch = it->second;
+    batch->requests.push_back(&request);
+    if (batch->requests.size() >= max_batch_size) {
+      batch->open = false;
+      open_batches_.erase(it);
+      batch->cv.notify_all();  // Wake the leader; the batch is full.
+    }
+
+    while (!request.done) {
+      batch->cv.wait(lock);
+    }
+
+    return request.status;
+  }
+
+  // Lead a new batch: publish it, wait for followers up to the deadline, then
+  // execute on this thread.
+  auto batch = std::make_shared<Batch>();
+  batch->requests.push_back(&request);
+  open_batches_.emplace(signature, batch);
+
+  const auto deadline = std::chrono::steady_clock::now() + options_.batch_timeout;
+  while (batch->open) {
+    const auto remaining = deadline - std::chrono::steady_clock::now();
+    if (remaining <= std::chrono::steady_clock::duration::zero() ||
+        batch->cv.wait_for(lock, remaining) == std::cv_status::timeout) {
+      break;
+    }
+  }
+
+  if (batch->open) {
+    // Deadline reached before the batch filled; stop accepting followers.
+    batch->open = false;
+    open_batches_.erase(signature);
+  }
+
+  lock.unlock();
+  // The membership of the batch is now fixed and every follower is blocked, so
+  // their feeds/p_fetches stay valid while we run without the lock held.
+  RunBatch(*batch, run_options, feed_names, output_names);
+  lock.lock();
+
+  for (PendingRequest* pending : batch->requests) {
+    pending->done = true;
+  }
+  batch->cv.notify_all();
+
+  return request.status;
+}
+
+void DynamicBatcher::RunBatch(Batch& batch, const RunOptions& run_options,
+                              gsl::span<const std::string> feed_names,
+                              gsl::span<const std::string> output_names) {
+  auto fail_all = [&batch](const common::Status& status) {
+    for (PendingRequest* pending : batch.requests) {
+      pending->status = status;
+    }
+  };
+
+  if (batch.requests.size() == 1) {
+    // Nobody joined; run the single request directly without gather/scatter.
+    PendingRequest& request = *batch.requests.front();
+    request.status = session_.Run(run_options, feed_names, request.feeds, output_names, request.p_fetches);
+    return;
+  }
+
+  int64_t total_batch_count = 0;
+  for (const PendingRequest* pending : batch.requests) {
+    total_batch_count += pending->batch_count;
+  }
+
+  // Use the session's CPU allocator so gathered feeds and scattered outputs go
+  // through its arena instead of a fresh allocator per batch.
+  AllocatorPtr allocator = session_.GetAllocator(OrtMemoryInfo(CPU, OrtAllocatorType::OrtDeviceAllocator));
+  if (allocator == nullptr) {
+    allocator = std::make_shared<CPUAllocator>();
+  }
+
+  // Gather: concatenate each feed along the batch dimension.
+  std::vector<OrtValue> batched_feeds(feed_names.size());
+  for (size_t feed_idx = 0; feed_idx < feed_names.size(); ++feed_idx) {
+    const Tensor& first = batch.requests.front()->feeds[feed_idx].Get<Tensor>();
+    TensorShapeVector dims = ToShapeVector(first.Shape().GetDims());
+    dims[0] = total_batch_count;
+    Tensor::InitOrtValue(first.DataType(), TensorShape(dims), allocator, batched_feeds[feed_idx]);
+
+    char* dst = static_cast<char*>(batched_feeds[feed_idx].GetMutable<Tensor>()->MutableDataRaw());
+    for (const PendingRequest* pending : batch.requests) {
+      const Tensor& tensor = pending->feeds[feed_idx].Get<Tensor>();
+      memcpy(dst, tensor.DataRaw(), tensor.SizeInBytes());
+      dst += tensor.SizeInBytes();
+    }
+  }
+
+  std::vector<OrtValue> batched_fetches;
+  common::Status status = session_.Run(run_options, feed_names, batched_feeds, output_names, &batched_fetches);
+  if (!status.IsOK()) {
+    fail_all(status);
+    return;
+  }
+
+  // Scatter: slice each output along the batch dimension, in request order.
+  for (PendingRequest* pending : batch.requests) {
+    pending->p_fetches->clear();
+    pending->p_fetches->reserve(batched_fetches.size());
+  }
+
+  for (size_t output_idx = 0; output_idx < batched_fetches.size(); ++output_idx) {
+    const OrtValue& batched_output = batched_fetches[output_idx];
+    if (!batched_output.IsTensor()) {
+      fail_all(ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Output '", output_names[output_idx],
+                               "' is not a tensor and cannot be scattered to the batched requests."));
+      return;
+    }
+
+    const Tensor& output = batched_output.Get<Tensor>();
+    if (output.IsDataTypeString() ||
+        output.Location().device.Type() != OrtDevice::CPU ||
+        output.Shape().NumDimensions() < 1 ||
+        output.Shape()[0] != total_batch_count) {
+      fail_all(ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Output '", output_names[output_idx],
+                               "' does not have the batch dimension as its first dimension ",
+                               "and cannot be scattered to the batched requests."));
+      return;
+    }
+
+    const size_t bytes_per_entry = output.SizeInBytes() / static_cast<size_t>(total_batch_count);
+    const char* src = static_cast<const char*>(output.DataRaw());
+    for (PendingRequest* pending : batch.requests) {
+      TensorShapeVector dims = ToShapeVector(output.Shape().GetDims());
+      dims[0] = pending->batch_count;
+      OrtValue sliced;
+      Tensor::InitOrtValue(output.DataType(), TensorShape(dims), allocator, sliced);
+
+      const size_t slice_bytes = bytes_per_entry * static_cast<size_t>(pending->batch_count);
+      memcpy(sliced.GetMutable<Tensor>()->MutableDataRaw(), src, slice_bytes);
+      src += slice_bytes;
+
+      pending->p_fetches->push_back(std::move(sliced));
+    }
+  }
+}
+
+}  // namespace onnxruntime
+
+#endif  // !defined(ORT_MINIMAL_BUILD)
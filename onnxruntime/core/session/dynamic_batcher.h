@@ -0,0 +1,102 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#if !defined(ORT_MINIMAL_BUILD)
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <gsl/gsl>
+
+#include "core/common/common.h"
+#include "core/common/status.h"
+#include "core/framework/ort_value.h"
+#include "core/framework/run_options.h"
+#include "core/platform/ort_mutex.h"
+
+namespace onnxruntime {
+
+class InferenceSession;
+
+struct DynamicBatcherOptions {
+  // Maximum number of requests coalesced into one underlying Run call.
+  int max_batch_size = 8;
+
+  // How long the first request of a batch waits for further requests to
+  // arrive before the batch is closed and executed.
+  std::chrono::microseconds batch_timeout{1000};
+};
+
+/**
+ * Coalesces concurrent Run requests with compatible shapes into a single
+ * underlying InferenceSession::Run call.
+ *
+ * Requests whose feeds differ only in the batch (first) dimension are gathered
+ * along that dimension, executed once, and the outputs are scattered back to
+ * the callers.  The first request of a batch acts as the leader: it waits up
+ * to DynamicBatcherOptions::batch_timeout for further requests to join (or
+ * until max_batch_size is reached) and then executes the batch on its own
+ * thread, while the joined requests block until their slice of the outputs is
+ * ready.
+ *
+ * Requests that are not batchable (non-tensor or non-CPU feeds, string
+ * tensors, scalars) bypass batching and run directly.  Callers on different
+ * threads may use a single DynamicBatcher instance concurrently.
+ */
+class DynamicBatcher {
+ public:
+  DynamicBatcher(InferenceSession& session, const DynamicBatcherOptions& options);
+  ~DynamicBatcher();
+
+  /**
+   * Equivalent to InferenceSession::Run, except that the request may be
+   * coalesced with concurrent requests that have compatible shapes.
+   * Blocks until the outputs for this request are available.
+   */
+  [[nodiscard]] common::Status Run(const RunOptions& run_options,
+                                   gsl::span<const std::string> feed_names, gsl::span<const OrtValue> feeds,
+                                   gsl::span<const std::string> output_names, std::vector<OrtValue>* p_fetches);
+
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(DynamicBatcher);
+
+ private:
+  // A request that has joined a batch and is waiting for its outputs.
+  struct PendingRequest {
+    gsl::span<const OrtValue> feeds;
+    std::vector<OrtValue>* p_fetches{nullptr};
+    int64_t batch_count{0};  // Size of the batch dimension of this request's feeds.
+    common::Status status{common::Status::OK()};
+    bool done{false};
+  };
+
+  // A batch that is still accepting requests (while open_) or executing.
+  struct Batch {
+    std::vector<PendingRequest*> requests;
+    bool open{true};
+    OrtCondVar cv;  // Signalled when the batch closes and when results are ready.
+  };
+
+  // Gather the feeds of all requests in the batch, run the session once, and
+  // scatter the outputs back into each request's p_fetches/status.
+  void RunBatch(Batch& batch, const RunOptions& run_options,
+                gsl::span<const std::string> feed_names, gsl::span<const std::string> output_names);
+
+  InferenceSession& session_;
+  const DynamicBatcherOptions options_;
+
+  // Guards open_batches_ and all Batch/PendingRequest state.
+  OrtMutex mutex_;
+
+  // Batches currently accepting requests, keyed by a signature built from the
+  // feed/output names and the per-feed element types and non-batch dimensions.
+  std::unordered_map<std::string, std::shared_ptr<Batch>> open_batches_;
+};
+
+}  // namespace onnxruntime
+
+#endif  // !defined(ORT_MINIMAL_BUILD)
@@ -4,9 +4,12 @@
 #include "core/graph/onnx_protobuf.h"
 #include "core/session/inference_session.h"
 
+#include <filesystem>
+#include <iomanip>
 #include <memory>
 #include <sstream>
 #include <list>
+#include <numeric>
 #include <string>
 #include <thread>
 #include <queue>
@@ -28,7 +31,9 @@
 #include "core/framework/kernel_registry.h"
 #include "core/framework/kernel_type_str_resolver.h"
 #include "core/framework/kernel_type_str_resolver_utils.h"
+#include "core/framework/memory_budget.h"
 #include "core/framework/mldata_type_utils.h"
+#include "core/framework/murmurhash3.h"
 #include "core/framework/TensorSeq.h"
 #include "core/framework/tensorprotoutils.h"
 #include "core/framework/tensor_type_and_shape.h"
@@ -36,6 +41,7 @@
 #include "core/framework/ort_value_pattern_planner.h"
 #include "core/framework/transform_layout_functions.h"
 #include "core/framework/utils.h"
+#include "core/graph/graph_flatbuffers_utils.h"
 #include "core/graph/graph_viewer.h"
 #include "core/graph/model.h"
 #include "core/optimizer/graph_transformer_utils.h"
@@ -65,8 +71,10 @@
 #include "core/providers/dml/DmlExecutionProvider/src/ExecutionProvider.h"
 #include "core/optimizer/stft_decomposition.h"
 #endif
+#include "core/mlas/inc/mlas.h"
 #include "core/session/environment.h"
 #include "core/session/user_logging_sink.h"
+#include "core/session/dynamic_batcher.h"
 #include "core/session/IOBinding.h"
 #include "core/session/inference_session_utils.h"
 #include "core/session/onnxruntime_session_options_config_keys.h"
@@ -484,9 +492,33 @@ void InferenceSession::ConstructorCommon(const SessionOptions& session_options,
     });
   }
 
+  // The MLAS dispatch tables are process wide and initialize on first use, so only a session
+  // created before any MLAS routine has run can apply a tier override.
+  const std::string mlas_disabled_tiers =
+      session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsMlasDisabledDispatchTiers, "");
+  if (!mlas_disabled_tiers.empty()) {
+    if (MlasSetDisabledDispatchTiers(mlas_disabled_tiers.c_str())) {
+      LOGS(*session_logger_, INFO) << "Disabled MLAS dispatch tiers: " << mlas_disabled_tiers
+                                   << ". Active dispatch: " << MlasGetDispatchSummary();
+    } else {
+      LOGS(*session_logger_, WARNING) << "Ignoring " << kOrtSessionOptionsMlasDisabledDispatchTiers
+                                      << ": the MLAS dispatch tables are already initialized. "
+                                      << "Active dispatch: " << MlasGetDispatchSummary();
+    }
+  }
+
   use_per_session_threads_ = session_options.use_per_session_threads;
   force_spinning_stop_between_runs_ = session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigForceSpinningStop, "0") == "1";
 
+  const std::string gpu_graph_shape_buckets_str =
+      session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsGpuGraphShapeBuckets, "0");
+  if (!TryParseStringWithClassicLocale<int>(gpu_graph_shape_buckets_str, max_gpu_graph_shape_buckets_) ||
+      max_gpu_graph_shape_buckets_ < 0) {
+    LOGS(*session_logger_, WARNING) << "Invalid value for " << kOrtSessionOptionsGpuGraphShapeBuckets
+                                    << ": " << gpu_graph_shape_buckets_str << ". Disabling shape buckets.";
+    max_gpu_graph_shape_buckets_ = 0;
+  }
+
   if (use_per_session_threads_) {
     LOGS(*session_logger_, INFO) << "Creating and using per session threadpools since use_per_session_threads_ is true";
     {
@@ -515,6 +547,14 @@ void InferenceSession::ConstructorCommon(const SessionOptions& session_options,
         if (session_options_.config_options.TryGetConfigEntry(kOrtSessionOptionsConfigIntraOpThreadAffinities, to.affinity_str)) {
           ORT_ENFORCE(!to.affinity_str.empty(), "Affinity string must not be empty");
         }
+        to.steal_domain_size = std::stoi(session_options_.config_options.GetConfigOrDefault(
+            kOrtSessionOptionsConfigIntraOpStealDomainSize, "0"));
+        ORT_ENFORCE(to.steal_domain_size >= 0, "Steal domain size must not be negative");
+        to.small_loop_max_helpers = std::stoi(session_options_.config_options.GetConfigOrDefault(
+            kOrtSessionOptionsConfigIntraOpSmallLoopMaxHelpers, "0"));
+        ORT_ENFORCE(to.small_loop_max_helpers >= 0, "Small loop max helpers must not be negative");
+        to.adaptive_degree = session_options_.config_options.GetConfigOrDefault(
+                                 kOrtSessionOptionsConfigIntraOpAdaptiveDegree, "0") == "1";
         to.auto_set_affinity = to.thread_pool_size == 0 &&
                                session_options_.execution_mode == ExecutionMode::ORT_SEQUENTIAL &&
                                to.affinity_str.empty();
@@ -704,6 +744,12 @@ InferenceSession::InferenceSession(const SessionOptions& session_options, const
 #endif  // !defined(ORT_MINIMAL_BUILD)
 
 InferenceSession::~InferenceSession() {
+  // remove the memory pressure hook before the budget it forwards to goes away. the arena is
+  // session-owned so no allocation can race with the removal at this point.
+  if (memory_budget_arena_) {
+    static_cast<BFCArena*>(memory_budget_arena_.get())->SetMemoryBudget(0, nullptr);
+  }
+
   if (session_options_.enable_profiling) {
     ORT_TRY {
       EndProfiling();
@@ -914,10 +960,24 @@ common::Status InferenceSession::SaveToOrtFormat(const std::filesystem::path& fi
   ORT_RETURN_IF_ERROR(
       kernel_type_str_resolver.SaveToOrtFormat(builder, fbs_kernel_type_str_resolver));
 
+  // optionally store the pre-packed weights captured while finalizing the session state so that
+  // supporting kernels can skip the packing computation when the model is loaded
+  flatbuffers::Offset<fbs::PrePackedWeightsForIsa> fbs_prepacked_weights;
+  const std::string prepacked_weights_target_isa =
+      session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigPrepackedWeightsTargetIsa, "");
+  if (!prepacked_weights_target_isa.empty() && session_state_ != nullptr &&
+      !session_state_->GetPrePackedWeightsForSerialization().empty()) {
+    ORT_RETURN_IF_ERROR(
+        fbs::utils::SavePrePackedWeightsOrtFormat(builder, prepacked_weights_target_isa,
+                                                  session_state_->GetPrePackedWeightsForSerialization(),
+                                                  fbs_prepacked_weights));
+  }
+
   fbs::InferenceSessionBuilder sb(builder);
   sb.add_ort_version(ort_model_version);
   sb.add_model(fbs_model);
   sb.add_kernel_type_str_resolver(fbs_kernel_type_str_resolver);
+  sb.add_pre_packed_weights(fbs_prepacked_weights);
   auto session = sb.Finish();
   builder.Finish(session, fbs::InferenceSessionIdentifier());
 
@@ -1013,6 +1073,54 @@ common::Status InferenceSession::FilterEnabledOptimizers(InlinedHashSet<std::str
 }
 #endif  // !defined(ORT_MINIMAL_BUILD) || defined(ORT_EXTENDED_MINIMAL_BUILD)
 
+#if !defined(ORT_MINIMAL_BUILD)
+namespace {
+// Computes the cache file path for the opt-in optimized model cache (kOrtSessionOptionsOptimizedModelCacheDir).
+// The key covers the model file identity (path, size, mtime), the ONNX Runtime version, the graph optimization
+// level and the registered execution providers so a stale entry is never picked up after any of those change.
+// Returns an empty path if the cache is disabled or the model file cannot be inspected.
+PathString GetOptimizedModelCachePath(const SessionOptions& session_options,
+                                      const ExecutionProviders& execution_providers,
+                                      const PathString& model_uri) {
+  const std::string cache_dir =
+      session_options.config_options.GetConfigOrDefault(kOrtSessionOptionsOptimizedModelCacheDir, "");
+  if (cache_dir.empty()) {
+    return {};
+  }
+
+  std::error_code ec;
+  const std::filesystem::path model_path{model_uri};
+  const auto file_size = std::filesystem::file_size(model_path, ec);
+  if (ec) {
+    return {};
+  }
+
+  const auto mtime = std::filesystem::last_write_time(model_path, ec);
+  if (ec) {
+    return {};
+  }
+
+  std::ostringstream key;
+  key << ORT_TSTR_CONVERT_TO_PRINTABLE_STRING(model_uri) << '|' << file_size << '|'
+      << mtime.time_since_epoch().count() << '|' << ORT_VERSION << '|'
+      << static_cast<int>(session_options.graph_optimization_level);
+  for (const auto& provider_id : execution_providers.GetIds()) {
+    key << '|' << provider_id;
+  }
+
+  const std::string key_str = key.str();
+  uint32_t hash[4] = {0, 0, 0, 0};
+  MurmurHash3::x86_128(key_str.data(), static_cast<int>(key_str.size()), 0, hash);
+
+  std::ostringstream filename;
+  filename << std::hex << std::setfill('0')
+           << std::setw(8) << hash[0] << std::setw(8) << hash[1]
+           << std::setw(8) << hash[2] << std::setw(8) << hash[3] << ".ort";
+  return (std::filesystem::path{cache_dir} / filename.str()).native();
+}
+}  // namespace
+#endif  // !defined(ORT_MINIMAL_BUILD)
+
 common::Status InferenceSession::Load(const PathString& model_uri) {
   std::string model_type = session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigLoadModelFormat, "");
   bool has_explicit_type = !model_type.empty();
@@ -1023,6 +1131,22 @@ common::Status InferenceSession::Load(const PathString& model_uri) {
   }
 
 #if !defined(ORT_MINIMAL_BUILD)
+  // Optimized model cache: on a hit, load the cached post-optimization copy as an ORT format model, which
+  // skips the graph transformer stack and partitioning during Initialize(). On a miss, remember the cache
+  // path so Initialize() can populate it.
+  optimized_model_cache_path_ = GetOptimizedModelCachePath(session_options_, execution_providers_, model_uri);
+  if (!optimized_model_cache_path_.empty()) {
+    std::error_code ec;
+    if (std::filesystem::exists(std::filesystem::path{optimized_model_cache_path_}, ec) && !ec) {
+      LOGS(*session_logger_, INFO) << "Loading optimized model cache entry "
+                                   << ORT_TSTR_CONVERT_TO_PRINTABLE_STRING(optimized_model_cache_path_);
+      // already loading the optimized copy; nothing for Initialize() to save
+      PathString cache_path = std::move(optimized_model_cache_path_);
+      optimized_model_cache_path_.clear();
+      return LoadOrtModel(cache_path);
+    }
+  }
+
   if (is_model_proto_parsed_) {
     return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL,
                            "ModelProto corresponding to the model to be loaded has already been parsed. "
@@ -1320,7 +1444,16 @@ common::Status InferenceSession::TransformGraph(onnxruntime::Graph& graph, bool
       provider_types.push_back(provider_ptr->Type());
     }
 
-    MemcpyTransformer copy_transformer{provider_types, kernel_registry_manager_};
+    // graph inputs/outputs the caller declared device-resident keep their provider-side def in
+    // device memory; the transformer copies to the host only for the CPU consumers
+    InlinedHashSet<std::string> device_resident_io;
+    const std::string device_resident_io_str =
+        session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsDeviceResidentIo, "");
+    for (const auto& name : utils::SplitString(device_resident_io_str, ",", /*keep_empty*/ false)) {
+      device_resident_io.emplace(name);
+    }
+
+    MemcpyTransformer copy_transformer{provider_types, kernel_registry_manager_, std::move(device_resident_io)};
     ORT_RETURN_IF_ERROR_SESSIONID_(apply_transformer_once(copy_transformer, *session_logger_, graph));
   }
 
@@ -1514,6 +1647,21 @@ Status InferenceSession::LoadOrtModelWithLoader(std::function<Status()> load_ort
 #endif  // !defined(ORT_MINIMAL_BUILD) || defined(ORT_EXTENDED_MINIMAL_BUILD)
   kernel_registry_manager_.SetKernelTypeStrResolver(std::move(kernel_type_str_resolver));
 
+  if (const auto* fbs_prepacked_weights = fbs_session->pre_packed_weights(); fbs_prepacked_weights != nullptr) {
+    const std::string prepacked_weights_target_isa =
+        config_options.GetConfigOrDefault(kOrtSessionOptionsConfigPrepackedWeightsTargetIsa, "");
+    if (!prepacked_weights_target_isa.empty()) {
+      // the buffer contents are copied out of the flatbuffer so the loaded weights don't depend on
+      // ort_format_model_bytes_ staying alive. the CPU allocator is used as pre-packing is only
+      // supported by CPU kernels for now.
+      AllocatorPtr prepacked_weights_allocator = std::make_shared<CPUAllocator>();
+      ORT_RETURN_IF_ERROR(fbs::utils::LoadPrePackedWeightsOrtFormat(*fbs_prepacked_weights,
+                                                                    prepacked_weights_target_isa,
+                                                                    prepacked_weights_allocator,
+                                                                    prepacked_weights_from_model_));
+    }
+  }
+
   is_model_loaded_ = true;
 
   return Status::OK();
@@ -1524,6 +1672,24 @@ bool InferenceSession::IsInitialized() const {
   return is_inited_;
 }
 
+// collects the kernels the session (and all of its subgraph session states) instantiated, i.e.
+// the only registry entries a kernel lookup can still return something for after initialization
+static void CollectUsedKernelCreateInfos(const SessionState& session_state,
+                                         InlinedHashSet<const KernelCreateInfo*>& kernels) {
+  for (const auto& [node_index, kernel_create_info] : session_state.GetKernelCreateInfoMap()) {
+    ORT_UNUSED_PARAMETER(node_index);
+    kernels.insert(kernel_create_info);
+  }
+
+  for (const auto& [node_index, entries] : session_state.GetSubgraphSessionStateMap()) {
+    ORT_UNUSED_PARAMETER(node_index);
+    for (const auto& [attribute_name, subgraph_session_state] : entries) {
+      ORT_UNUSED_PARAMETER(attribute_name);
+      CollectUsedKernelCreateInfos(*subgraph_session_state, kernels);
+    }
+  }
+}
+
 static bool ModelHasFP16InputsHelper(const onnx::TypeProto& type_proto) {
   switch (type_proto.value_case()) {
     case ::onnx::TypeProto::ValueCase::kTensorType: {
@@ -1704,7 +1870,21 @@ common::Status InferenceSession::Initialize() {
     // RegisterExecutionProvider locks the session_mutex_ so we can't be holding it when we call that
     if (!have_cpu_ep) {
       LOGS(*session_logger_, INFO) << "Adding default CPU execution provider.";
-      CPUExecutionProviderInfo epi{session_options_.enable_cpu_mem_arena};
+      CPUExecutionProviderInfo epi{session_options_.enable_cpu_mem_arena,
+                                   session_options_.config_options.GetConfigOrDefault(
+                                       kOrtSessionOptionsEnableCpuArenaThreadCache, "0") == "1"};
+      epi.tunable_op_enable = session_options_.config_options.GetConfigOrDefault(
+                                  kOrtSessionOptionsCpuTunableOpEnable, "0") == "1";
+      epi.tunable_op_tuning_enable = session_options_.config_options.GetConfigOrDefault(
+                                         kOrtSessionOptionsCpuTunableOpTuningEnable, "0") == "1";
+      const std::string max_tuning_duration_str = session_options_.config_options.GetConfigOrDefault(
+          kOrtSessionOptionsCpuTunableOpMaxTuningDurationMs, "0");
+      if (!TryParseStringWithClassicLocale<int>(max_tuning_duration_str, epi.tunable_op_max_tuning_duration_ms) ||
+          epi.tunable_op_max_tuning_duration_ms < 0) {
+        LOGS(*session_logger_, WARNING) << "Invalid value for " << kOrtSessionOptionsCpuTunableOpMaxTuningDurationMs
+                                        << ": " << max_tuning_duration_str << ". Using no limit.";
+        epi.tunable_op_max_tuning_duration_ms = 0;
+      }
       auto p_cpu_exec_provider = std::make_unique<CPUExecutionProvider>(epi);
       ORT_RETURN_IF_ERROR_SESSIONID_(RegisterExecutionProvider(std::move(p_cpu_exec_provider)));
       execution_providers_.SetCpuProviderWasImplicitlyAdded(true);
@@ -1745,6 +1925,12 @@ common::Status InferenceSession::Initialize() {
         session_options_,
         prepacked_weights_container_);
 
+    // hand over any pre-packed weights loaded from an ORT format model so that supporting
+    // kernels can adopt them instead of packing during session state finalization
+    if (!prepacked_weights_from_model_.empty()) {
+      session_state_->SetPrePackedWeightsFromModel(std::move(prepacked_weights_from_model_));
+    }
+
     bool use_env_allocators =
         session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigUseEnvAllocators, "0") == "1";
     if (use_env_allocators) {
@@ -1775,6 +1961,24 @@ common::Status InferenceSession::Initialize() {
     ORT_RETURN_IF_ERROR_SESSIONID_(kernel_registry_manager_.RegisterKernels(execution_providers_));
 
     const bool loading_ort_format = !ort_format_model_bytes_.empty();
+
+#if !defined(ORT_MINIMAL_BUILD)
+    // Optimized model cache miss: arrange for the post-optimization graph to be written to the cache as an
+    // ORT format model ('.ort' suffix selects the format below). An explicit optimized_model_filepath wins.
+    if (!loading_ort_format && !optimized_model_cache_path_.empty() &&
+        session_options_.optimized_model_filepath.empty()) {
+      std::error_code ec;
+      std::filesystem::create_directories(std::filesystem::path{optimized_model_cache_path_}.parent_path(), ec);
+      if (!ec) {
+        session_options_.optimized_model_filepath = optimized_model_cache_path_;
+      } else {
+        LOGS(*session_logger_, WARNING) << "Failed to create optimized model cache directory for "
+                                        << ORT_TSTR_CONVERT_TO_PRINTABLE_STRING(optimized_model_cache_path_)
+                                        << "; the cache entry will not be written.";
+      }
+    }
+#endif  // !defined(ORT_MINIMAL_BUILD)
+
     const bool saving_model = !session_options_.optimized_model_filepath.empty();
     const bool saving_ort_format = [&]() {
       if (saving_model) {
@@ -1866,7 +2070,10 @@ common::Status InferenceSession::Initialize() {
       ORT_RETURN_IF_ERROR_SESSIONID_(TransformGraph(graph, saving_ort_format));
 
       // now that all the transforms are done, call Resolve on the main graph. this will recurse into the subgraphs.
-      ORT_RETURN_IF_ERROR_SESSIONID_(graph.Resolve());
+      // type/shape inference over independent nodes runs concurrently on the intra-op pool.
+      Graph::ResolveOptions resolve_options;
+      resolve_options.thread_pool = GetIntraOpThreadPoolToUse();
+      ORT_RETURN_IF_ERROR_SESSIONID_(graph.Resolve(resolve_options));
 
       // Currently graph capture is only considered by CUDA EP, TRT EP, ROCM EP and JS EP.
       //
@@ -2096,6 +2303,29 @@ common::Status InferenceSession::Initialize() {
     // once the model is saved, we may remove unnecessary attributes for inference
     session_state_->PruneRemovableAttributes();
 
+    // optionally drop the registrations of every kernel the loaded model can never reach,
+    // returning the registry metadata of the full opset x type matrix each provider registers
+    if (session_options_.config_options.GetConfigOrDefault(
+            kOrtSessionOptionsTrimKernelRegistriesAfterInitialization, "0") == "1") {
+      InlinedHashSet<const KernelCreateInfo*> used_kernels;
+      CollectUsedKernelCreateInfos(*session_state_, used_kernels);
+      kernel_registry_manager_.TrimKernelRegistries(used_kernels);
+    }
+
+#if !defined(ORT_MINIMAL_BUILD)
+    // optionally pre-size arenas from a captured memory watermarks profile so the first
+    // requests after deployment do not pay for incremental arena growth
+    const std::string memory_profile_path = session_options_.config_options.GetConfigOrDefault(
+        kOrtSessionOptionsMemoryWatermarksProfilePath, "");
+    if (!memory_profile_path.empty()) {
+      ORT_RETURN_IF_ERROR_SESSIONID_(PresizeArenasFromMemoryProfile(memory_profile_path));
+    }
+#endif  // !defined(ORT_MINIMAL_BUILD)
+
+    // optionally install a soft per-session memory cap that evicts rebuildable caches before
+    // the CPU arena grows past the budget
+    ORT_RETURN_IF_ERROR_SESSIONID_(ConfigureMemoryBudget());
+
     // and log telemetry
     bool model_has_fp16_inputs = ModelHasFP16Inputs(graph);
     env.GetTelemetryProvider().LogSessionCreation(
@@ -2145,6 +2375,41 @@ int InferenceSession::GetCurrentNumRuns() const {
   return current_num_runs_.load();
 }
 
+common::Status InferenceSession::Quiesce() {
+  if (current_num_runs_.load() > 0) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Cannot quiesce the session while Run() calls are in flight.");
+  }
+
+  if (thread_pool_) {
+    thread_pool_->Quiesce();
+  }
+
+  if (inter_op_thread_pool_) {
+    inter_op_thread_pool_->Quiesce();
+  }
+
+  if (!session_options_.use_per_session_threads ||
+      external_intra_op_thread_pool_ != nullptr || external_inter_op_thread_pool_ != nullptr) {
+    LOGS(*session_logger_, WARNING) << "Session uses thread pools it does not own (global or "
+                                       "application-supplied). Those pools were not quiesced and their "
+                                       "threads remain live in the process image.";
+  }
+
+  return Status::OK();
+}
+
+common::Status InferenceSession::Resume() {
+  if (thread_pool_) {
+    thread_pool_->Resume();
+  }
+
+  if (inter_op_thread_pool_) {
+    inter_op_thread_pool_->Resume();
+  }
+
+  return Status::OK();
+}
+
 const std::vector<std::string>& InferenceSession::GetRegisteredProviderTypes() const {
   return execution_providers_.GetIds();
 }
@@ -2493,7 +2758,177 @@ Status InferenceSession::SetEpDynamicOptions(gsl::span<const char* const> keys,
   return retval;
 }
 
-Status InferenceSession::Run(const RunOptions& run_options,
+Status InferenceSession::SetIntraOpThreadAffinities(const std::string& affinity_str) {
+#if !defined(ORT_MINIMAL_BUILD) && !defined(ORT_EXTENDED_MINIMAL_BUILD)
+  if (!session_options_.use_per_session_threads || external_intra_op_thread_pool_ != nullptr) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL,
+                           "Intra-op thread affinities can only be updated on a session that owns its "
+                           "intra-op thread pool; this session uses a shared or external thread pool.");
+  }
+
+  // A null thread_pool_ means the degree of parallelism is 1 and all work runs
+  // on the calling thread; there is nothing to re-pin.
+  if (!thread_pool_) {
+    return Status::OK();
+  }
+
+  Status status = Status::OK();
+  std::vector<LogicalProcessors> affinities;
+  ORT_TRY {
+    affinities = concurrency::ReadThreadAffinityConfig(affinity_str);
+  }
+  ORT_CATCH(const std::exception& ex) {
+    ORT_HANDLE_EXCEPTION([&]() {
+      status = ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Invalid affinity string: ", ex.what());
+    });
+  }
+  ORT_RETURN_IF_ERROR(status);
+
+  thread_pool_->SetThreadAffinities(std::move(affinities));
+  return Status::OK();
+#else
+  ORT_UNUSED_PARAMETER(affinity_str);
+  return ORT_MAKE_STATUS(ONNXRUNTIME, NOT_IMPLEMENTED, "Setting thread affinity is not implemented in this build.");
+#endif
+}
+
+Status InferenceSession::WarmUp(
+    gsl::span<const std::unordered_map<std::string, std::vector<int64_t>>> input_shapes) {
+  if (!is_inited_) {
+    LOGS(*session_logger_, ERROR) << "Session was not initialized";
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Session not initialized.");
+  }
+
+  // Touch one byte per page of every CPU initializer so memory-mapped weights are
+  // resident before the timed runs below fault them in on the compute path.
+  {
+    constexpr size_t kPageSize = 4096;
+    volatile char sink = 0;
+    for (const auto& entry : session_state_->GetInitializedTensors()) {
+      if (!entry.second.IsTensor()) {
+        continue;
+      }
+
+      const Tensor& tensor = entry.second.Get<Tensor>();
+      if (tensor.Location().device.Type() != OrtDevice::CPU || tensor.IsDataTypeString() ||
+          tensor.SizeInBytes() == 0) {
+        continue;
+      }
+
+      const char* data = static_cast<const char*>(tensor.DataRaw());
+      const size_t size = tensor.SizeInBytes();
+      for (size_t offset = 0; offset < size; offset += kPageSize) {
+        sink = sink + data[offset];
+      }
+    }
+  }
+
+  const auto& graph = model_->MainGraph();
+
+  std::vector<std::string> output_names;
+  output_names.reserve(graph.GetOutputs().size());
+  for (const NodeArg* output : graph.GetOutputs()) {
+    output_names.push_back(output->Name());
+  }
+
+  AllocatorPtr allocator = std::make_shared<CPUAllocator>();
+
+  const std::unordered_map<std::string, std::vector<int64_t>> default_signature;
+  const size_t num_signatures = input_shapes.empty() ? 1 : input_shapes.size();
+
+  for (size_t signature_idx = 0; signature_idx < num_signatures; ++signature_idx) {
+    const auto& signature = input_shapes.empty() ? default_signature : input_shapes[signature_idx];
+
+    std::vector<std::string> feed_names;
+    std::vector<OrtValue> feeds;
+    feed_names.reserve(graph.GetInputs().size());
+    feeds.reserve(graph.GetInputs().size());
+
+    for (const NodeArg* input : graph.GetInputs()) {
+      if (!input->Exists()) {
+        continue;
+      }
+
+      const auto* type_proto = input->TypeAsProto();
+      if (type_proto == nullptr || !utils::HasTensorType(*type_proto) ||
+          !utils::HasElemType(type_proto->tensor_type())) {
+        return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                               "WarmUp only supports models whose inputs are tensors. Input '",
+                               input->Name(), "' is not a tensor.");
+      }
+
+      std::vector<int64_t> dims;
+      auto shape_override = signature.find(input->Name());
+      if (shape_override != signature.end()) {
+        dims = shape_override->second;
+      } else if (const auto* shape_proto = input->Shape(); shape_proto != nullptr) {
+        dims.reserve(shape_proto->dim_size());
+        for (const auto& dim : shape_proto->dim()) {
+          // Free dimensions default to 1; callers with representative traffic should
+          // pass the real values through input_shapes instead.
+          dims.push_back(utils::HasDimValue(dim) ? dim.dim_value() : 1);
+        }
+      }
+
+      auto element_type =
+          DataTypeImpl::TensorTypeFromONNXEnum(type_proto->tensor_type().elem_type())->GetElementType();
+
+      OrtValue value;
+      Tensor::InitOrtValue(element_type, TensorShape(dims), allocator, value);
+      Tensor& tensor = *value.GetMutable<Tensor>();
+      if (!tensor.IsDataTypeString() && tensor.SizeInBytes() > 0) {
+        memset(tensor.MutableDataRaw(), 0, tensor.SizeInBytes());
+      }
+
+      feed_names.push_back(input->Name());
+      feeds.push_back(std::move(value));
+    }
+
+    RunOptions run_options;
+    run_options.run_tag = "warmup";
+    std::vector<OrtValue> fetches;
+    ORT_RETURN_IF_ERROR(Run(run_options, feed_names, feeds, output_names, &fetches, nullptr));
+  }
+
+  return Status::OK();
+}
+
+int InferenceSession::GetShapeBucketGraphAnnotationId(gsl::span<const std::string> feed_names,
+                                                      gsl::span<const OrtValue> feeds) {
+  // Build a stable signature from the fed tensor shapes. Callers may order the feeds
+  // differently between runs, so sort by input name before concatenating.
+  InlinedVector<size_t> order(feed_names.size());
+  std::iota(order.begin(), order.end(), size_t{0});
+  std::sort(order.begin(), order.end(),
+            [&feed_names](size_t a, size_t b) { return feed_names[a] < feed_names[b]; });
+
+  std::ostringstream signature;
+  for (size_t idx : order) {
+    signature << feed_names[idx] << ':';
+    if (idx < feeds.size() && feeds[idx].IsTensor()) {
+      signature << feeds[idx].Get<Tensor>().Shape().ToString();
+    }
+    signature << ';';
+  }
+
+  std::lock_guard<OrtMutex> lock(gpu_graph_shape_bucket_mutex_);
+  auto it = gpu_graph_shape_bucket_ids_.find(signature.str());
+  if (it != gpu_graph_shape_bucket_ids_.end()) {
+    return it->second;
+  }
+  if (static_cast<int>(gpu_graph_shape_bucket_ids_.size()) >= max_gpu_graph_shape_buckets_) {
+    LOGS(*session_logger_, WARNING) << "All " << max_gpu_graph_shape_buckets_
+                                    << " gpu graph shape buckets are in use; running this input "
+                                       "shape signature without graph capture.";
+    return CachedExecutionProviderForGraphReplay::kGraphAnnotationSkip;
+  }
+  // Annotation id 0 is the session-wide default, so bucket ids start at 1.
+  const int annotation_id = static_cast<int>(gpu_graph_shape_bucket_ids_.size()) + 1;
+  gpu_graph_shape_bucket_ids_.emplace(signature.str(), annotation_id);
+  return annotation_id;
+}
+
+Status InferenceSession::Run(const RunOptions& caller_run_options,
                              gsl::span<const std::string> feed_names, gsl::span<const OrtValue> feeds,
                              gsl::span<const std::string> output_names, std::vector<OrtValue>* p_fetches,
                              const std::vector<OrtDevice>* p_fetches_device_info) {
@@ -2512,7 +2947,7 @@ Status InferenceSession::Run(const RunOptions& run_options,
 
   int graph_annotation_id = 0;
   const std::string& graph_annotation_str =
-      run_options.config_options.GetConfigOrDefault(kOrtRunOptionsConfigCudaGraphAnnotation, "");
+      caller_run_options.config_options.GetConfigOrDefault(kOrtRunOptionsConfigCudaGraphAnnotation, "");
   if (!graph_annotation_str.empty()) {
     if (!TryParseStringWithClassicLocale<int>(graph_annotation_str, graph_annotation_id)) {
       return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Failed to parse the cuda graph annotation id: ",
@@ -2520,6 +2955,21 @@ Status InferenceSession::Run(const RunOptions& run_options,
     }
   }
 
+  // When no explicit gpu_graph_id was passed, optionally derive one from the fed input shapes
+  // so every shape bucket captures and replays its own graph. The derived id travels through
+  // the run options because the EP reads it from there in OnRunStart/OnRunEnd.
+  RunOptions bucketed_run_options;
+  bool use_bucketed_run_options = false;
+  if (graph_annotation_str.empty() && max_gpu_graph_shape_buckets_ > 0 &&
+      cached_execution_provider_for_graph_replay_.IsGraphCaptureEnabled()) {
+    graph_annotation_id = GetShapeBucketGraphAnnotationId(feed_names, feeds);
+    bucketed_run_options = caller_run_options;
+    ORT_RETURN_IF_ERROR(bucketed_run_options.config_options.AddConfigEntry(
+        kOrtRunOptionsConfigCudaGraphAnnotation, std::to_string(graph_annotation_id).c_str()));
+    use_bucketed_run_options = true;
+  }
+  const RunOptions& run_options = use_bucketed_run_options ? bucketed_run_options : caller_run_options;
+
   // Increment/decrement concurrent_num_runs_ and control
   // session threads spinning as configured. Do nothing for graph replay except the counter.
   const bool control_spinning = use_per_session_threads_ &&
@@ -2623,6 +3073,26 @@ Status InferenceSession::Run(const RunOptions& run_options,
 #endif
 
       if (retval.IsOK()) {
+        DeltaExecutionManager* delta = session_state_->GetDeltaExecutionManager();
+#ifdef ENABLE_TRAINING
+        if (run_options.only_execute_path_to_fetches) {
+          // partial execution would commit a baseline for nodes that never ran
+          delta = nullptr;
+        }
+#endif
+        if (delta != nullptr) {
+          delta->BeginRun(feed_names, feeds);
+        }
+        // pair every BeginRun with an EndRun even when ExecuteGraph throws; the in-flight run
+        // count gates skipping for concurrent Run calls, and a run that did not complete must
+        // not become the baseline for the next one
+        bool graph_run_completed = false;
+        auto end_delta_run = gsl::finally([delta, &retval, &graph_run_completed] {
+          if (delta != nullptr) {
+            delta->EndRun(graph_run_completed && retval.IsOK());
+          }
+        });
+
         retval = utils::ExecuteGraph(*session_state_, feeds_fetches_manager, feeds, *p_fetches,
                                      session_options_.execution_mode,
                                      run_options,
@@ -2630,6 +3100,7 @@ Status InferenceSession::Run(const RunOptions& run_options,
                                      device_stream_collection_holder,
 #endif
                                      run_logger);
+        graph_run_completed = true;
       }
 
       // info all execution providers InferenceSession:Run ended
@@ -2809,10 +3280,85 @@ common::Status InferenceSession::RunAsync(const RunOptions* run_options,
     }
     callback(user_data, fetches.data(), status.IsOK() ? num_fetches : 0, ToOrtStatus(status));
   };  // run_fn
+  // The scheduled thread is not a passive waiter: inside Run, ExecuteThePlan executes one logic
+  // stream inline on it (see sequential_executor.cc), so an in-flight request occupies the worker
+  // only while it has runnable work rather than for the full duration of the run.
   concurrency::ThreadPool::Schedule(tp, run_fn);
   return Status::OK();
 }
 
+common::Status InferenceSession::RunMany(const RunOptions& run_options,
+                                         gsl::span<const std::string> feed_names,
+                                         gsl::span<const std::vector<OrtValue>> feeds_batch,
+                                         gsl::span<const std::string> output_names,
+                                         std::vector<std::vector<OrtValue>>* p_fetches_batch) {
+  if (p_fetches_batch == nullptr) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "p_fetches_batch must not be null");
+  }
+
+  for (const auto& feeds : feeds_batch) {
+    if (feeds.size() != feed_names.size()) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                             "every entry of feeds_batch must have one value per feed name");
+    }
+  }
+
+  p_fetches_batch->clear();
+  p_fetches_batch->resize(feeds_batch.size());
+  if (feeds_batch.empty()) {
+    return Status::OK();
+  }
+
+  const auto run_one = [&](size_t index) {
+    return Run(run_options, feed_names, feeds_batch[index], output_names, &(*p_fetches_batch)[index]);
+  };
+
+  // Run is thread-safe, so independent entries can execute concurrently. Prefer the inter-op pool
+  // for the batch-level parallelism; a session configured for sequential execution has no inter-op
+  // pool, in which case the intra-op pool serves the same role as it does for RunAsync.
+  auto* tp = GetInterOpThreadPoolToUse();
+  if (tp == nullptr || concurrency::ThreadPool::DegreeOfParallelism(tp) < 2) {
+    tp = GetIntraOpThreadPoolToUse();
+  }
+
+  if (tp == nullptr || concurrency::ThreadPool::DegreeOfParallelism(tp) < 2 || feeds_batch.size() < 2) {
+    for (size_t i = 0; i < feeds_batch.size(); ++i) {
+      ORT_RETURN_IF_ERROR(run_one(i));
+    }
+    return Status::OK();
+  }
+
+  OrtMutex status_mutex;
+  Status batch_status = Status::OK();
+
+  // TrySimpleParallelFor returns once every entry has finished: one synchronization point for the
+  // whole batch. The first failure is reported after the remaining in-flight entries complete.
+  concurrency::ThreadPool::TrySimpleParallelFor(
+      tp, static_cast<std::ptrdiff_t>(feeds_batch.size()), [&](std::ptrdiff_t i) {
+        Status status = Status::OK();
+        ORT_TRY {
+          status = run_one(static_cast<size_t>(i));
+        }
+        ORT_CATCH(const std::exception& ex) {
+          ORT_HANDLE_EXCEPTION([&]() {
+            status = ORT_MAKE_STATUS(ONNXRUNTIME, RUNTIME_EXCEPTION, ex.what());
+          });
+        }
+        ORT_CATCH(...) {
+          status = ORT_MAKE_STATUS(ONNXRUNTIME, RUNTIME_EXCEPTION, "unknown exception");
+        }
+
+        if (!status.IsOK()) {
+          std::lock_guard<OrtMutex> lock(status_mutex);
+          if (batch_status.IsOK()) {
+            batch_status = status;
+          }
+        }
+      });
+
+  return batch_status;
+}
+
 common::Status InferenceSession::Run(const NameMLValMap& feeds, gsl::span<const std::string> output_names,
                                      std::vector<OrtValue>* p_fetches) {
   return Run(RunOptions(), feeds, output_names, p_fetches);
@@ -2898,11 +3444,37 @@ common::Status InferenceSession::NewIOBinding(std::unique_ptr<IOBinding>* io_bin
   return Status::OK();
 }
 
+#if !defined(ORT_MINIMAL_BUILD)
+common::Status InferenceSession::NewDynamicBatcher(const DynamicBatcherOptions& options,
+                                                   std::unique_ptr<DynamicBatcher>* batcher) {
+  {
+    std::lock_guard<onnxruntime::OrtMutex> l(session_mutex_);
+    if (!is_inited_) {
+      LOGS(*session_logger_, ERROR) << "Session was not initialized";
+      return common::Status(common::ONNXRUNTIME, common::FAIL, "Session not initialized.");
+    }
+  }
+
+  if (options.max_batch_size < 1) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "max_batch_size must be positive.");
+  }
+
+  *batcher = std::make_unique<DynamicBatcher>(*this, options);
+  return Status::OK();
+}
+#endif
+
 common::Status InferenceSession::Run(const RunOptions& run_options, IOBinding& io_binding) {
   // TODO should Run() call io_binding.SynchronizeInputs() or should it let the callers do it?
   // io_binding.SynchronizeInputs();
-  return Run(run_options, io_binding.GetInputNames(), io_binding.GetInputs(), io_binding.GetOutputNames(),
-             &io_binding.GetOutputs(), &io_binding.GetOutputsDeviceInfo());
+  auto status = Run(run_options, io_binding.GetInputNames(), io_binding.GetInputs(), io_binding.GetOutputNames(),
+                    &io_binding.GetOutputs(), &io_binding.GetOutputsDeviceInfo());
+
+  // once the run has returned nothing reads the ring-bound input slots any more, whether it
+  // succeeded or not; let the producer reuse them.
+  io_binding.SignalConsumedFences();
+
+  return status;
 }
 
 common::Status InferenceSession::Run(IOBinding& io_binding) {
@@ -2948,7 +3520,359 @@ const profiling::Profiler& InferenceSession::GetProfiling() const {
   return session_profiler_;
 }
 
+common::Status InferenceSession::GetKernelTimeHistograms(std::string& histograms_json) const {
+  if (!is_inited_) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Session was not initialized.");
+  }
+
+  const auto* histograms = session_state_->GetKernelTimeHistograms();
+  if (histograms == nullptr) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "Kernel time histograms are not enabled. Set the ",
+                           kOrtSessionOptionsKernelTimeHistogramSamplingInterval,
+                           " session config entry to a sampling interval > 0.");
+  }
+
+  std::ostringstream ss;
+  ss << "[";
+  bool first = true;
+  for (size_t node_index = 0; node_index < histograms->NumNodes(); ++node_index) {
+    const auto* kernel = session_state_->GetKernel(node_index);
+    if (kernel == nullptr) {
+      continue;
+    }
+    const auto& histogram = histograms->GetHistogram(node_index);
+    const uint64_t invocations = histogram.invocations.load(std::memory_order_relaxed);
+    if (invocations == 0) {
+      continue;
+    }
+
+    const auto& node = kernel->Node();
+    ss << (first ? "" : ",") << "\n";
+    first = false;
+    ss << R"({"name":")" << node.Name() << "\",";
+    ss << R"("op_type":")" << node.OpType() << "\",";
+    ss << R"("provider":")" << kernel->KernelDef().Provider() << "\",";
+    ss << "\"node_index\":" << node_index << ",";
+    ss << "\"invocations\":" << invocations << ",";
+    ss << "\"sampled\":" << histogram.sampled.load(std::memory_order_relaxed) << ",";
+    ss << "\"total_ns\":" << histogram.total_ns.load(std::memory_order_relaxed) << ",";
+
+    // bucket b counts sampled invocations in [2^b, 2^(b+1)) ns; trailing zero buckets are elided
+    size_t num_buckets = KernelTimeHistograms::kNumBuckets;
+    while (num_buckets > 0 && histogram.buckets[num_buckets - 1].load(std::memory_order_relaxed) == 0) {
+      --num_buckets;
+    }
+    ss << "\"buckets_ns_log2\":[";
+    for (size_t b = 0; b < num_buckets; ++b) {
+      ss << (b > 0 ? "," : "") << histogram.buckets[b].load(std::memory_order_relaxed);
+    }
+    ss << "]}";
+  }
+  ss << "\n]";
+
+  histograms_json = ss.str();
+  return Status::OK();
+}
+
+common::Status InferenceSession::GetCalibrationStats(std::string& stats_json) const {
+  if (!is_inited_) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Session was not initialized.");
+  }
+
+  const auto* collector = session_state_->GetCalibrationCollector();
+  if (collector == nullptr) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "Calibration collection is not enabled. Set the ",
+                           kOrtSessionOptionsEnableCalibrationCollection,
+                           " session config entry to 1.");
+  }
+
+  std::ostringstream ss;
+  ss.precision(std::numeric_limits<double>::max_digits10);
+  ss << "[";
+  bool first = true;
+  for (const auto& [name, stats] : collector->GetStats()) {
+    ss << (first ? "" : ",") << "\n";
+    first = false;
+    ss << R"({"name":")" << name << "\",";
+    ss << "\"min\":" << stats.min << ",";
+    ss << "\"max\":" << stats.max << ",";
+    ss << "\"absmax\":" << stats.absmax << ",";
+    ss << "\"num_elements\":" << stats.num_elements << ",";
+    ss << "\"num_updates\":" << stats.num_updates << "}";
+  }
+  ss << "\n]";
+
+  stats_json = ss.str();
+  return Status::OK();
+}
+
+common::Status InferenceSession::GetEpBoundaryReport(std::string& report_json) const {
+  if (!is_inited_) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Session was not initialized.");
+  }
+
+  const auto* boundary_stats = session_state_->GetEpBoundaryStats();
+  if (boundary_stats == nullptr) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "EP boundary stats collection is not enabled. Set the ",
+                           kOrtSessionOptionsEnableEpBoundaryStats,
+                           " session config entry to 1.");
+  }
+
+  std::ostringstream ss;
+  ss << "[";
+  bool first = true;
+  for (const auto& [transition, stats] : boundary_stats->GetStats()) {
+    ss << (first ? "" : ",") << "\n";
+    first = false;
+    ss << R"({"transition":")" << transition << "\",";
+    ss << "\"crossings\":" << stats.crossings << ",";
+    ss << "\"bytes\":" << stats.bytes << ",";
+    ss << "\"memcpy_count\":" << stats.memcpy_count << ",";
+    ss << "\"memcpy_time_ns\":" << stats.memcpy_time_ns << "}";
+  }
+  ss << "\n]";
+
+  report_json = ss.str();
+  return Status::OK();
+}
+
+common::Status InferenceSession::GetMemoryWatermarks(std::string& watermarks_json) const {
+  if (!is_inited_) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Session was not initialized.");
+  }
+
+  const auto* watermarks = session_state_->GetRunMemoryWatermarks();
+  if (watermarks == nullptr) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Memory watermark tracking is not available.");
+  }
+
+  const auto snapshot = watermarks->GetSnapshot();
+  std::ostringstream ss;
+  ss << "[";
+  bool first_signature = true;
+  for (const auto& [signature, locations] : snapshot) {
+    ss << (first_signature ? "" : ",") << "\n";
+    first_signature = false;
+    ss << R"({"input_shapes":")" << signature << R"(","locations":[)";
+    bool first_location = true;
+    for (const auto& [location, watermark] : locations) {
+      ss << (first_location ? "" : ",");
+      first_location = false;
+      ss << R"({"location":")" << location << "\",";
+      ss << "\"runs\":" << watermark.runs << ",";
+      ss << "\"peak_bytes\":" << watermark.peak_bytes << ",";
+      ss << "\"last_peak_bytes\":" << watermark.last_peak_bytes << "}";
+    }
+    ss << "]}";
+  }
+  ss << "\n]";
+
+  watermarks_json = ss.str();
+  return Status::OK();
+}
+
+common::Status InferenceSession::GetDispatchReport(std::string& report_json) const {
+  if (!is_inited_) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Session was not initialized.");
+  }
+
+  const auto& provider_ids = execution_providers_.GetIds();
+
+  std::ostringstream ss;
+  ss << R"({"mlas_dispatch":")" << MlasGetDispatchSummary() << "\",\n";
+  ss << R"("mlas_supported":")" << MlasGetSupportedDispatchTiers() << "\",\n";
+
+  ss << R"("registered_eps":[)";
+  bool first = true;
+  for (const auto& id : provider_ids) {
+    ss << (first ? "" : ",") << '"' << id << '"';
+    first = false;
+  }
+  ss << "],\n";
+
+  // nodes of the main graph that did not land on the highest-priority provider. nodes inside
+  // subgraphs follow their parent's placement and are not listed separately.
+  const std::string& preferred_ep = provider_ids.front();
+  ss << R"("preferred_ep":")" << preferred_ep << R"(","fallback_nodes":[)";
+  first = true;
+  for (const auto& node : session_state_->GetGraphViewer().Nodes()) {
+    if (node.GetExecutionProviderType() == preferred_ep) {
+      continue;
+    }
+
+    ss << (first ? "" : ",") << "\n";
+    first = false;
+    ss << R"({"name":")" << node.Name() << R"(","op_type":")" << node.OpType()
+       << R"(","assigned_ep":")" << node.GetExecutionProviderType() << "\"}";
+  }
+  ss << (first ? "]}" : "\n]}");
+
+  report_json = ss.str();
+  return Status::OK();
+}
+
+common::Status InferenceSession::GetMemoryBudgetReport(std::string& report_json) const {
+  if (!is_inited_) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Session was not initialized.");
+  }
+
+  if (memory_budget_ == nullptr) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "No memory budget is configured. Set the ",
+                           kOrtSessionOptionsMemoryBudgetBytes,
+                           " session config entry to a byte count.");
+  }
+
+  const auto stats = memory_budget_->GetStats();
+
+  std::ostringstream ss;
+  ss << R"({"budget_bytes":)" << stats.budget_bytes << ",\n";
+
+  if (memory_budget_arena_) {
+    AllocatorStats arena_stats;
+    static_cast<BFCArena*>(memory_budget_arena_.get())->GetStats(&arena_stats);
+    ss << "\"arena_bytes_in_use\":" << arena_stats.bytes_in_use << ",\n";
+    ss << "\"arena_max_bytes_in_use\":" << arena_stats.max_bytes_in_use << ",\n";
+  }
+
+  ss << "\"pressure_events\":" << stats.pressure_events << ",\n";
+  ss << "\"released_bytes\":" << stats.released_bytes << ",\n";
+  ss << "\"callbacks\":[";
+  bool first = true;
+  for (const auto& callback : stats.callbacks) {
+    ss << (first ? "" : ",") << "\n";
+    first = false;
+    ss << R"({"name":")" << callback.name << "\",";
+    ss << "\"invocations\":" << callback.invocations << ",";
+    ss << "\"released_bytes\":" << callback.released_bytes << "}";
+  }
+  ss << (first ? "]}" : "\n]}");
+
+  report_json = ss.str();
+  return Status::OK();
+}
+
+common::Status InferenceSession::ConfigureMemoryBudget() {
+  const std::string budget_str =
+      session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsMemoryBudgetBytes, "");
+  if (budget_str.empty()) {
+    return Status::OK();
+  }
+
+  size_t budget_bytes = 0;
+  ORT_RETURN_IF_NOT(TryParseStringWithClassicLocale<size_t>(budget_str, budget_bytes) && budget_bytes > 0,
+                    "Invalid ", kOrtSessionOptionsMemoryBudgetBytes, " value: ", budget_str);
+
+  // a budget on an allocator shared with other sessions would throttle their allocations with
+  // this session's callbacks, and the hook could outlive this session; only enforce on a
+  // session-owned arena.
+  const bool use_env_allocators =
+      session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigUseEnvAllocators, "0") == "1";
+  AllocatorPtr cpu_allocator = session_state_->GetAllocator(OrtDevice());
+
+  if (use_env_allocators || cpu_allocator == nullptr ||
+      cpu_allocator->Info().alloc_type != OrtAllocatorType::OrtArenaAllocator) {
+    LOGS(*session_logger_, WARNING) << kOrtSessionOptionsMemoryBudgetBytes
+                                    << " is set but the CPU allocator is not a session-owned arena; "
+                                       "the memory budget will not be enforced.";
+    return Status::OK();
+  }
+
+  memory_budget_ = std::make_unique<SessionMemoryBudget>(budget_bytes);
+
+  // evict rebuildable session caches first; they only cost latency to repopulate
+  memory_budget_->RegisterEvictionCallback(
+      "session_caches",
+      [this](size_t /*bytes_needed*/) { return session_state_->EvictMemoryCaches(); });
+
+  // then return wholly-free arena regions to the system
+  auto* arena = static_cast<BFCArena*>(cpu_allocator.get());
+  memory_budget_->RegisterEvictionCallback(
+      "arena_shrink",
+      [this, arena](size_t /*bytes_needed*/) {
+        AllocatorStats before;
+        arena->GetStats(&before);
+        auto status = arena->Shrink();
+        if (!status.IsOK()) {
+          LOGS(*session_logger_, WARNING) << "Unable to shrink arena under memory pressure: "
+                                          << status.ErrorMessage();
+          return size_t{0};
+        }
+        AllocatorStats after;
+        arena->GetStats(&after);
+        return before.total_allocated_bytes > after.total_allocated_bytes
+                   ? static_cast<size_t>(before.total_allocated_bytes - after.total_allocated_bytes)
+                   : size_t{0};
+      });
+
+  arena->SetMemoryBudget(budget_bytes, [this](size_t bytes_needed) {
+    return memory_budget_->Relieve(bytes_needed);
+  });
+  memory_budget_arena_ = std::move(cpu_allocator);
+
+  LOGS(*session_logger_, INFO) << "Memory budget of " << budget_bytes
+                               << " bytes installed on arena: " << memory_budget_arena_->Info().ToString();
+  return Status::OK();
+}
+
 #if !defined(ORT_MINIMAL_BUILD)
+common::Status InferenceSession::PresizeArenasFromMemoryProfile(const std::string& profile_path) {
+  std::ifstream profile_stream{profile_path};
+  if (!profile_stream) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "Failed to open memory watermarks profile: ", profile_path);
+  }
+
+  // fold the profile down to the largest per-run peak seen for each device.
+  // see GetMemoryWatermarks for the layout being parsed here.
+  InlinedHashMap<std::string, size_t> peak_bytes_per_device;
+  Status parse_status = Status::OK();
+  ORT_TRY {
+    const auto profile = nlohmann::json::parse(profile_stream);
+    for (const auto& signature_entry : profile) {
+      for (const auto& location_entry : signature_entry.at("locations")) {
+        const auto location = location_entry.at("location").get<std::string>();
+        const auto peak_bytes = location_entry.at("peak_bytes").get<size_t>();
+        auto& device_peak = peak_bytes_per_device[location];
+        device_peak = std::max(device_peak, peak_bytes);
+      }
+    }
+  }
+  ORT_CATCH(const std::exception& e) {
+    ORT_HANDLE_EXCEPTION([&]() {
+      parse_status = ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                                     "Failed to parse memory watermarks profile '", profile_path, "': ", e.what());
+    });
+  }
+  ORT_RETURN_IF_ERROR(parse_status);
+
+  for (const auto& [device, allocator] : session_state_->GetAllocators()) {
+    if (allocator->Info().alloc_type != OrtArenaAllocator) {
+      continue;
+    }
+
+    auto it = peak_bytes_per_device.find(device.ToString());
+    if (it == peak_bytes_per_device.end() || it->second == 0) {
+      continue;
+    }
+
+    // One allocation of the full peak makes the arena carve a single region of at least
+    // that size; freeing it leaves the region in the arena's free list for the first runs
+    // to draw from. The profile tracks frame-owned allocations, so this is on top of
+    // whatever initializers already occupy the arena at this point.
+    void* priming_allocation = allocator->Alloc(it->second);
+    allocator->Free(priming_allocation);
+
+    LOGS(*session_logger_, INFO) << "Pre-sized arena for " << device.ToString() << " with " << it->second
+                                 << " bytes from the memory watermarks profile.";
+  }
+
+  return Status::OK();
+}
+
 std::vector<TuningResults> InferenceSession::GetTuningResults() const {
   std::vector<TuningResults> ret;
   for (const auto& provider : execution_providers_) {
@@ -53,6 +53,12 @@ class GraphTransformer;
 class IExecutionProvider;
 class IOBinding;
 struct Notification;
+class SessionMemoryBudget;
+
+#if !defined(ORT_MINIMAL_BUILD)
+class DynamicBatcher;
+struct DynamicBatcherOptions;
+#endif
 
 #ifdef ENABLE_TRAINING
 struct PartialGraphExecutionState;
@@ -333,6 +339,33 @@ class InferenceSession {
   [[nodiscard]] common::Status SetEpDynamicOptions(gsl::span<const char* const> keys,
                                                    gsl::span<const char* const> values);
 
+  /**
+   * Re-pin the threads of this session's intra-op thread pool at runtime.
+   * @param affinity_str affinity configuration in the same format as the
+   *        kOrtSessionOptionsConfigIntraOpThreadAffinities session config entry.
+   * The update is applied asynchronously by the pool's worker threads.
+   * Returns an error if the session uses an external or shared intra-op thread
+   * pool, as those threads may be serving other sessions.
+   */
+  [[nodiscard]] common::Status SetIntraOpThreadAffinities(const std::string& affinity_str);
+
+  /**
+   * Warm up an initialized session so the first real request runs at steady-state latency.
+   * Touches one byte per page of every CPU initializer to fault in memory-mapped weights,
+   * then runs the execution plan once per shape signature with zero-filled dummy inputs.
+   * The warm-up runs grow allocator arenas to the working-set peak of the given shapes and
+   * let anything that tunes or caches on first use (TunableOp search, memory patterns,
+   * shape caches, pre-packing) pay its cost off the serving path, so a load balancer can
+   * gate traffic on WarmUp() having returned.
+   * @param input_shapes shape signatures to warm. Each entry maps input names to concrete
+   *        dimensions; inputs missing from an entry - and all inputs when the span is
+   *        empty - use the model-declared shape with free dimensions set to 1. Only
+   *        tensor inputs are supported.
+   * @return OK if every warm-up run succeeded.
+   */
+  [[nodiscard]] common::Status WarmUp(
+      gsl::span<const std::unordered_map<std::string, std::vector<int64_t>>> input_shapes = {});
+
   [[nodiscard]] common::Status Run(const RunOptions& run_options, gsl::span<const std::string> feed_names,
                                    gsl::span<const OrtValue> feeds, gsl::span<const std::string> output_names,
                                    std::vector<OrtValue>* p_fetches,
@@ -352,6 +385,29 @@ class InferenceSession {
                                         RunAsyncCallbackFn callback,
                                         void* user_data = nullptr);
 
+  /**
+   * Run many independent feed sets through the model in a single call.
+   * All entries share the same feed and output names; entry i of feeds_batch is executed as if
+   * passed to Run() and its fetches are written to entry i of p_fetches_batch. The entries are
+   * scheduled on the inter-op thread pool (falling back to the intra-op pool, or to running them
+   * inline when neither has spare threads) and the call returns only after every entry has
+   * finished, so a batch scoring job pays the call overhead and the final synchronization once
+   * instead of once per row.
+   * @param run_options applied to every entry.
+   * @param feed_names input names, shared by all entries.
+   * @param feeds_batch one feed set per entry; each must have one value per feed name.
+   * @param output_names output names, shared by all entries.
+   * @param p_fetches_batch resized to feeds_batch.size(); entry i receives the fetches of entry i
+   *        in the order given by output_names.
+   * @return OK if every entry succeeded, otherwise the first failure; later entries still run to
+   *         completion before the call returns.
+   */
+  [[nodiscard]] common::Status RunMany(const RunOptions& run_options,
+                                       gsl::span<const std::string> feed_names,
+                                       gsl::span<const std::vector<OrtValue>> feeds_batch,
+                                       gsl::span<const std::string> output_names,
+                                       std::vector<std::vector<OrtValue>>* p_fetches_batch);
+
   /**
    * Run a pre-loaded and pre-intialized model.
    * Multiple threads are allowed to run this function; hence its thread-safe.
@@ -381,9 +437,40 @@ class InferenceSession {
    */
   [[nodiscard]] common::Status NewIOBinding(std::unique_ptr<IOBinding>* io_binding);
 
+#if !defined(ORT_MINIMAL_BUILD)
+  /**
+   * Creates a dynamic batcher for this session. Concurrent Run calls issued
+   * through the batcher are coalesced along the batch dimension up to
+   * DynamicBatcherOptions::max_batch_size or batch_timeout, executed once,
+   * and the outputs scattered back to the callers. See DynamicBatcher.
+   * @param options batching limits.
+   * @param batcher output parameter; valid only while this session is alive.
+   */
+  [[nodiscard]] common::Status NewDynamicBatcher(const DynamicBatcherOptions& options,
+                                                 std::unique_ptr<DynamicBatcher>* batcher);
+#endif
+
   [[nodiscard]] virtual common::Status Run(const RunOptions& run_options, IOBinding& io_binding);
   [[nodiscard]] common::Status Run(IOBinding& io_binding);
 
+  /**
+   * Quiesce the session so the process image can be snapshotted (e.g. fork or CRIU): joins and
+   * destroys the worker threads of the session-owned intra-op and inter-op thread pools so no live
+   * threads remain in them. The session must be idle - no Run() calls may be in flight, and none may
+   * be started until Resume() is called. Thread pools owned by the environment
+   * (use_per_session_threads=false) or supplied by the application are not touched and must be
+   * quiesced by their owner.
+   * @return OK if the session was idle and is now quiesced.
+   */
+  [[nodiscard]] common::Status Quiesce();
+
+  /**
+   * Re-creates the session-owned thread pool workers after Quiesce(), e.g. once the snapshotted
+   * process image has been restored. No-op if the session is not quiesced.
+   * @return OK if success.
+   */
+  [[nodiscard]] common::Status Resume();
+
 #ifdef ENABLE_TRAINING
   /**
    * Partially run a pre-loaded and pre-intialized model.
@@ -495,6 +582,63 @@ class InferenceSession {
     */
   const profiling::Profiler& GetProfiling() const;
 
+  /**
+   * Snapshot the per-node latency histograms collected when
+   * kOrtSessionOptionsKernelTimeHistogramSamplingInterval is set, serialized as a JSON array with
+   * one entry per executed node. Can be called concurrently with Run().
+   * @param histograms_json filled with the serialized snapshot.
+   * @return an error if the session is not initialized or histogram collection is not enabled.
+   */
+  common::Status GetKernelTimeHistograms(std::string& histograms_json) const;
+
+  /**
+   * Snapshot the streaming calibration statistics collected when
+   * kOrtSessionOptionsEnableCalibrationCollection is set, serialized as a JSON array with one
+   * entry per observed tensor holding its running min/max. Can be called concurrently with Run().
+   * @param stats_json filled with the serialized snapshot.
+   * @return an error if the session is not initialized or calibration collection is not enabled.
+   */
+  common::Status GetCalibrationStats(std::string& stats_json) const;
+
+  /**
+   * Snapshot the execution provider boundary cost totals collected when
+   * kOrtSessionOptionsEnableEpBoundaryStats is set, serialized as a JSON array with one entry
+   * per EP transition holding the crossings, bytes moved and time spent in Memcpy nodes. Can be
+   * called concurrently with Run().
+   * @param report_json filled with the serialized snapshot.
+   * @return an error if the session is not initialized or boundary stats are not enabled.
+   */
+  common::Status GetEpBoundaryReport(std::string& report_json) const;
+
+  /**
+   * Snapshot the per-run memory watermarks, serialized as a JSON array with one entry per
+   * observed input-shape signature listing the per-device peak bytes. Collection is always on
+   * and this can be called concurrently with Run().
+   * @param watermarks_json filled with the serialized snapshot.
+   * @return an error if the session is not initialized.
+   */
+  common::Status GetMemoryWatermarks(std::string& watermarks_json) const;
+
+  /**
+   * Report the instruction-set tiers MLAS selected for this process and the nodes that were not
+   * placed on the session's highest-priority execution provider, serialized as JSON. Intended to
+   * be queried right after initialization so deployment tooling can reject placements on hardware
+   * that silently dispatches to slower tiers.
+   * @param report_json filled with the serialized report.
+   * @return an error if the session is not initialized.
+   */
+  common::Status GetDispatchReport(std::string& report_json) const;
+
+  /**
+   * Report the session's memory budget activity, serialized as JSON: the configured budget, the
+   * arena's current and peak bytes in use, how often an allocation triggered eviction and how
+   * many bytes each eviction callback released. Intended for multi-tenant hosts that size
+   * per-session budgets from observed pressure; see kOrtSessionOptionsMemoryBudgetBytes.
+   * @param report_json filled with the serialized report.
+   * @return an error if the session is not initialized or no memory budget is configured.
+   */
+  common::Status GetMemoryBudgetReport(std::string& report_json) const;
+
 #if !defined(ORT_MINIMAL_BUILD)
   /**
    * Get the TuningResults of TunableOp for every execution providers.
@@ -611,6 +755,10 @@ class InferenceSession {
   // The file path of where the model was loaded. e.g. /tmp/test_squeezenet/model.onnx
   PathString model_location_;
 
+  // Cache entry path for the opt-in optimized model cache (kOrtSessionOptionsOptimizedModelCacheDir).
+  // Non-empty only on a cache miss, in which case Initialize() saves the post-optimization graph there.
+  PathString optimized_model_cache_path_;
+
   // The list of execution providers.
   ExecutionProviders execution_providers_;
 
@@ -632,8 +780,24 @@ class InferenceSession {
   }
 
   common::Status SaveToOrtFormat(const std::filesystem::path& filepath) const;
+
+  /**
+   * Prime every arena-backed allocator with one allocation of the largest per-run peak a
+   * previously captured memory watermarks profile recorded for its device, so the arena
+   * reaches steady-state size in a single reservation instead of growing on demand.
+   * @param profile_path Path to the JSON returned by GetMemoryWatermarks on an earlier session.
+   */
+  [[nodiscard]] common::Status PresizeArenasFromMemoryProfile(const std::string& profile_path);
 #endif
 
+  /**
+   * Read kOrtSessionOptionsMemoryBudgetBytes and, when set, create the session's memory budget,
+   * register the eviction callbacks and install the pressure hook on the session-owned CPU
+   * arena. A no-op when the config entry is absent; logs a warning and skips enforcement when
+   * the CPU allocator is not a session-owned arena.
+   */
+  [[nodiscard]] common::Status ConfigureMemoryBudget();
+
   /**
    * Load an ORT format model.
    * @param model_uri absolute path of the model file.
@@ -744,6 +908,13 @@ class InferenceSession {
   // It has a dependency on execution_providers_.
   std::unique_ptr<SessionState> session_state_;
 
+  // Per-session soft memory cap; nullptr unless kOrtSessionOptionsMemoryBudgetBytes is set.
+  // Created in ConfigureMemoryBudget during Initialize.
+  std::unique_ptr<SessionMemoryBudget> memory_budget_;
+  // The arena the budget's pressure hook was installed on; kept so the destructor can remove
+  // the hook (which references this session) before the budget is destroyed.
+  AllocatorPtr memory_budget_arena_;
+
   // Threadpools per session. These are initialized and used for the entire duration of the session
   // when use_per_session_threads is true.
   std::basic_string<ORTCHAR_T> thread_pool_name_;
@@ -862,6 +1033,11 @@ class InferenceSession {
 
   bool using_ort_model_bytes_for_initializers_{false};
 
+  // Pre-packed weights loaded from an ORT format model whose declared target ISA matched the
+  // one in the session options. Handed over to the session state during Initialize() so that
+  // supporting kernels can skip the packing computation.
+  std::unordered_map<std::string, PrePackedWeights> prepacked_weights_from_model_;
+
   // Container to store pre-packed weights to share between sessions.
   // The life-cycle of the cache itself is maintained by the user and the user will ensure
   // the cache is valid until any session reliant on it is still in scope.
@@ -909,6 +1085,20 @@ class InferenceSession {
   };
 
   CachedExecutionProviderForGraphReplay cached_execution_provider_for_graph_replay_;
+
+  // Returns the graph annotation id for the shape-bucket the fed input shapes belong to,
+  // assigning a new id on first occurrence of a signature. Returns
+  // CachedExecutionProviderForGraphReplay::kGraphAnnotationSkip once the configured number of
+  // buckets is exhausted so unexpected shapes run without capture instead of evicting a
+  // captured graph. See kOrtSessionOptionsGpuGraphShapeBuckets.
+  int GetShapeBucketGraphAnnotationId(gsl::span<const std::string> feed_names,
+                                      gsl::span<const OrtValue> feeds);
+
+  // Maximum number of shape buckets to maintain captured graphs for; 0 disables deriving
+  // annotation ids from input shapes.
+  int max_gpu_graph_shape_buckets_ = 0;
+  mutable onnxruntime::OrtMutex gpu_graph_shape_bucket_mutex_;
+  InlinedHashMap<std::string, int> gpu_graph_shape_bucket_ids_;  // GUARDED_BY(gpu_graph_shape_bucket_mutex_)
 };
 
 struct SessionIOBinding {
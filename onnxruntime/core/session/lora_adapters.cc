@@ -120,6 +120,39 @@ void LoraAdapter::InitializeParamsValues() {
   params_values_.swap(params_values);
 }
 
+LoraAdapterCache::LoraAdapterCache(size_t capacity) : capacity_(capacity) {
+  ORT_ENFORCE(capacity_ > 0, "Lora adapter cache capacity must be positive");
+}
+
+std::shared_ptr<LoraAdapter> LoraAdapterCache::Acquire(const std::string& key, const LoaderFn& load_adapter) {
+  std::lock_guard<OrtMutex> lock(mutex_);
+
+  auto hit = key_to_entry_.find(key);
+  if (hit != key_to_entry_.end()) {
+    entries_.splice(entries_.begin(), entries_, hit->second);
+    return hit->second->second;
+  }
+
+  std::shared_ptr<LoraAdapter> adapter = load_adapter();
+  ORT_ENFORCE(adapter != nullptr, "Lora adapter loader produced a nullptr");
+
+  entries_.emplace_front(key, adapter);
+  key_to_entry_.insert_or_assign(key, entries_.begin());
+
+  while (entries_.size() > capacity_) {
+    // callers holding the shared_ptr keep an evicted adapter alive until their runs finish
+    key_to_entry_.erase(entries_.back().first);
+    entries_.pop_back();
+  }
+
+  return adapter;
+}
+
+size_t LoraAdapterCache::GetEntryNum() const {
+  std::lock_guard<OrtMutex> lock(mutex_);
+  return entries_.size();
+}
+
 }  // namespace lora
 }  // namespace onnxruntime
 
@@ -9,9 +9,14 @@
 #include "core/framework/ort_value.h"
 #include "core/platform/env.h"
 
+#include "core/platform/ort_mutex.h"
+
 #include "lora/adapter_format_utils.h"
 
 #include <filesystem>
+#include <functional>
+#include <list>
+#include <memory>
 #include <string>
 #include <variant>
 #include <vector>
@@ -172,5 +177,46 @@ class LoraAdapter {
   std::unordered_map<std::string, Param> params_values_;
 };
 
+/// <summary>
+/// A bounded LRU cache of loaded adapters keyed by an application chosen string,
+/// typically the adapter file path. Lets a service swap between a large library of
+/// adapters while only the most recently used ones stay resident together with their
+/// device copies. Evicted adapters remain alive for as long as callers hold the
+/// returned shared_ptr, so in-flight runs are unaffected by eviction.
+/// Thread safe; a cache miss loads under the cache lock, serializing concurrent loads.
+/// </summary>
+class LoraAdapterCache {
+ public:
+  using LoaderFn = std::function<std::unique_ptr<LoraAdapter>()>;
+
+  explicit LoraAdapterCache(size_t capacity);
+
+  LoraAdapterCache(const LoraAdapterCache&) = delete;
+  LoraAdapterCache& operator=(const LoraAdapterCache&) = delete;
+
+  /// <summary>
+  /// Returns the cached adapter for the key, marking it most recently used.
+  /// On a miss the supplied loader is invoked and the result is cached, evicting
+  /// the least recently used entries beyond capacity.
+  /// </summary>
+  /// <param name="key">cache key, typically the adapter file path</param>
+  /// <param name="load_adapter">invoked to load the adapter on a cache miss</param>
+  std::shared_ptr<LoraAdapter> Acquire(const std::string& key, const LoaderFn& load_adapter);
+
+  /// <summary>
+  /// Number of adapters currently cached.
+  /// </summary>
+  size_t GetEntryNum() const;
+
+ private:
+  using EntryList = std::list<std::pair<std::string, std::shared_ptr<LoraAdapter>>>;
+
+  size_t capacity_;
+  mutable OrtMutex mutex_;
+  // most recently used at the front
+  EntryList entries_;
+  std::unordered_map<std::string, EntryList::iterator> key_to_entry_;
+};
+
 }  // namespace lora
 }  // namespace onnxruntime
@@ -8,6 +8,7 @@
 #include "core/framework/allocator.h"
 #include "core/framework/error_code_helper.h"
 #include "core/framework/execution_provider.h"
+#include "core/framework/tensor_pool.h"
 #include "core/framework/tensor_type_and_shape.h"
 #include "core/framework/utils.h"
 #include <cassert>
@@ -255,6 +256,45 @@ ORT_API_STATUS_IMPL(OrtApis::CreateTensorAsOrtValue, _Inout_ OrtAllocator* alloc
   API_IMPL_END
 }
 
+// The pool handle only carries a reference to the pooling allocator. Pooled tensors hold their
+// own reference, so releasing the handle while values are live is safe.
+struct OrtTensorPool {
+  std::shared_ptr<onnxruntime::TensorPoolAllocator> allocator;
+};
+
+ORT_API_STATUS_IMPL(OrtApis::CreateTensorPool, _Inout_ OrtAllocator* allocator, _Outptr_ OrtTensorPool** out) {
+  API_IMPL_BEGIN
+  auto upstream = std::make_shared<onnxruntime::IAllocatorImplWrappingOrtAllocator>(allocator);
+  auto pool = std::make_unique<OrtTensorPool>();
+  pool->allocator = std::make_shared<onnxruntime::TensorPoolAllocator>(std::move(upstream));
+  *out = pool.release();
+  return nullptr;
+  API_IMPL_END
+}
+
+ORT_API_STATUS_IMPL(OrtApis::CreateTensorFromPool, _Inout_ OrtTensorPool* pool, _In_ const int64_t* shape,
+                    size_t shape_len, ONNXTensorElementDataType type, _Outptr_ OrtValue** out) {
+  API_IMPL_BEGIN
+  auto ml_type = DataTypeImpl::TensorTypeFromONNXEnum(type)->GetElementType();
+  auto value = std::make_unique<OrtValue>();
+  TensorShape tensor_shape(shape, shape_len);
+  Tensor::InitOrtValue(ml_type, tensor_shape, pool->allocator, *value);
+  *out = value.release();
+  return nullptr;
+  API_IMPL_END
+}
+
+ORT_API_STATUS_IMPL(OrtApis::ClearTensorPool, _Inout_ OrtTensorPool* pool) {
+  API_IMPL_BEGIN
+  pool->allocator->Clear();
+  return nullptr;
+  API_IMPL_END
+}
+
+ORT_API(void, OrtApis::ReleaseTensorPool, _Frees_ptr_opt_ OrtTensorPool* pool) {
+  delete pool;
+}
+
 ORT_API_STATUS_IMPL(OrtApis::CreateSparseTensorAsOrtValue, _Inout_ OrtAllocator* allocator, _In_ const int64_t* dense_shape,
                     size_t dense_shape_len, ONNXTensorElementDataType type, _Outptr_ OrtValue** out) {
   API_IMPL_BEGIN
@@ -865,6 +905,19 @@ ORT_API_STATUS_IMPL(OrtApis::SetEpDynamicOptions, _Inout_ OrtSession* sess,
   API_IMPL_END
 }
 
+ORT_API_STATUS_IMPL(OrtApis::SessionSetIntraOpThreadAffinities, _Inout_ OrtSession* sess,
+                    _In_ const char* affinity_str) {
+  API_IMPL_BEGIN
+  auto session = reinterpret_cast<::onnxruntime::InferenceSession*>(sess);
+
+  if (affinity_str == nullptr || *affinity_str == '\0') {
+    return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, "affinity string must not be empty");
+  }
+
+  return ToOrtStatus(session->SetIntraOpThreadAffinities(affinity_str));
+  API_IMPL_END
+}
+
 ORT_API_STATUS_IMPL(OrtApis::Run, _Inout_ OrtSession* sess, _In_opt_ const OrtRunOptions* run_options,
                     _In_reads_(input_len) const char* const* input_names,
                     _In_reads_(input_len) const OrtValue* const* input, size_t input_len,
@@ -1190,6 +1243,29 @@ ORT_API_STATUS_IMPL(OrtApis::FillStringTensorElement, _Inout_ OrtValue* value, _
   API_IMPL_END
 }
 
+ORT_API_STATUS_IMPL(OrtApis::FillStringTensorFromOffsets, _Inout_ OrtValue* value,
+                    _In_reads_(buffer_length) const char* buffer, size_t buffer_length,
+                    _In_reads_(offsets_len) const size_t* offsets, size_t offsets_len) {
+  TENSOR_READWRITE_API_BEGIN
+  auto* dst = tensor->MutableData<std::string>();
+  const auto len = static_cast<size_t>(tensor->Shape().Size());
+  if (offsets_len != len + 1) {
+    return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, "offsets count doesn't equal tensor size plus one");
+  }
+  if (offsets[len] > buffer_length) {
+    return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, "offsets exceed the buffer length");
+  }
+  for (size_t i = 0; i != len; ++i) {
+    if (offsets[i] > offsets[i + 1]) {
+      return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, "offsets must be monotonically non-decreasing");
+    }
+    // copy with an explicit length: no strlen, and short strings stay in the small-string buffer
+    dst[i].assign(buffer + offsets[i], offsets[i + 1] - offsets[i]);
+  }
+  return nullptr;
+  API_IMPL_END
+}
+
 ORT_API_STATUS_IMPL(OrtApis::GetResizedStringTensorElementBuffer, _Inout_ OrtValue* value,
                     _In_ size_t index, _In_ size_t length_in_bytes, _Inout_ char** buffer) {
   TENSOR_READWRITE_API_BEGIN
@@ -1436,6 +1512,72 @@ ORT_API_STATUS_IMPL(OrtApis::SessionEndProfiling, _In_ OrtSession* sess, _Inout_
   API_IMPL_END
 }
 
+ORT_API_STATUS_IMPL(OrtApis::SessionGetKernelTimeHistograms, _In_ const OrtSession* sess,
+                    _Inout_ OrtAllocator* allocator, _Outptr_ char** out) {
+  API_IMPL_BEGIN
+  auto session = reinterpret_cast<const ::onnxruntime::InferenceSession*>(sess);
+  std::string histograms_json;
+  ORT_API_RETURN_IF_STATUS_NOT_OK(session->GetKernelTimeHistograms(histograms_json));
+  *out = StrDup(histograms_json, allocator);
+  return nullptr;
+  API_IMPL_END
+}
+
+ORT_API_STATUS_IMPL(OrtApis::SessionGetCalibrationStats, _In_ const OrtSession* sess,
+                    _Inout_ OrtAllocator* allocator, _Outptr_ char** out) {
+  API_IMPL_BEGIN
+  auto session = reinterpret_cast<const ::onnxruntime::InferenceSession*>(sess);
+  std::string stats_json;
+  ORT_API_RETURN_IF_STATUS_NOT_OK(session->GetCalibrationStats(stats_json));
+  *out = StrDup(stats_json, allocator);
+  return nullptr;
+  API_IMPL_END
+}
+
+ORT_API_STATUS_IMPL(OrtApis::SessionGetEpBoundaryReport, _In_ const OrtSession* sess,
+                    _Inout_ OrtAllocator* allocator, _Outptr_ char** out) {
+  API_IMPL_BEGIN
+  auto session = reinterpret_cast<const ::onnxruntime::InferenceSession*>(sess);
+  std::string report_json;
+  ORT_API_RETURN_IF_STATUS_NOT_OK(session->GetEpBoundaryReport(report_json));
+  *out = StrDup(report_json, allocator);
+  return nullptr;
+  API_IMPL_END
+}
+
+ORT_API_STATUS_IMPL(OrtApis::SessionGetMemoryWatermarks, _In_ const OrtSession* sess,
+                    _Inout_ OrtAllocator* allocator, _Outptr_ char** out) {
+  API_IMPL_BEGIN
+  auto session = reinterpret_cast<const ::onnxruntime::InferenceSession*>(sess);
+  std::string watermarks_json;
+  ORT_API_RETURN_IF_STATUS_NOT_OK(session->GetMemoryWatermarks(watermarks_json));
+  *out = StrDup(watermarks_json, allocator);
+  return nullptr;
+  API_IMPL_END
+}
+
+ORT_API_STATUS_IMPL(OrtApis::SessionGetMemoryBudgetReport, _In_ const OrtSession* sess,
+                    _Inout_ OrtAllocator* allocator, _Outptr_ char** out) {
+  API_IMPL_BEGIN
+  auto session = reinterpret_cast<const ::onnxruntime::InferenceSession*>(sess);
+  std::string report_json;
+  ORT_API_RETURN_IF_STATUS_NOT_OK(session->GetMemoryBudgetReport(report_json));
+  *out = StrDup(report_json, allocator);
+  return nullptr;
+  API_IMPL_END
+}
+
+ORT_API_STATUS_IMPL(OrtApis::SessionGetDispatchReport, _In_ const OrtSession* sess,
+                    _Inout_ OrtAllocator* allocator, _Outptr_ char** out) {
+  API_IMPL_BEGIN
+  auto session = reinterpret_cast<const ::onnxruntime::InferenceSession*>(sess);
+  std::string report_json;
+  ORT_API_RETURN_IF_STATUS_NOT_OK(session->GetDispatchReport(report_json));
+  *out = StrDup(report_json, allocator);
+  return nullptr;
+  API_IMPL_END
+}
+
 ORT_API_STATUS_IMPL(OrtApis::SessionGetModelMetadata, _In_ const OrtSession* sess,
                     _Outptr_ OrtModelMetadata** out) {
   API_IMPL_BEGIN
@@ -1615,6 +1757,16 @@ ORT_API_STATUS_IMPL(OrtApis::AllocatorGetInfo, _In_ const OrtAllocator* ptr, _Ou
   API_IMPL_END
 }
 
+ORT_API_STATUS_IMPL(OrtApis::AllocatorGetStats, _In_ const OrtAllocator* ort_allocator, _Out_ OrtAllocatorStats* stats) {
+  API_IMPL_BEGIN
+  if (ort_allocator->version < 21 || ort_allocator->GetStats == nullptr) {
+    return OrtApis::CreateStatus(ORT_NOT_IMPLEMENTED, "This allocator does not implement GetStats.");
+  }
+  ort_allocator->GetStats(ort_allocator, stats);
+  return nullptr;
+  API_IMPL_END
+}
+
 template <typename T>
 ORT_STATUS_PTR OrtGetNumSequenceElements(const OrtValue* p_ml_value, size_t* out) {
   auto& data = p_ml_value->Get<T>();
@@ -2809,6 +2961,24 @@ static constexpr OrtApi ort_api_1_to_20 = {
     &OrtApis::RunOptionsAddActiveLoraAdapter,
 
     &OrtApis::SetEpDynamicOptions,
+    // End of Version 20 - DO NOT MODIFY ABOVE (see above text for more information)
+
+    &OrtApis::SessionSetIntraOpThreadAffinities,
+    &OrtApis::AllocatorGetStats,
+    &OrtApis::SessionGetKernelTimeHistograms,
+    &OrtApis::SessionGetMemoryWatermarks,
+    &OrtApis::FillStringTensorFromOffsets,
+    &OrtApis::KernelContext_GetInputViews,
+    &OrtApis::SessionGetDispatchReport,
+    &OrtApis::SessionOptionsToSnapshot,
+    &OrtApis::CreateSessionOptionsFromSnapshot,
+    &OrtApis::SessionGetCalibrationStats,
+    &OrtApis::SessionGetMemoryBudgetReport,
+    &OrtApis::CreateTensorPool,
+    &OrtApis::CreateTensorFromPool,
+    &OrtApis::ClearTensorPool,
+    &OrtApis::ReleaseTensorPool,
+    &OrtApis::SessionGetEpBoundaryReport,
 };
 
 // OrtApiBase can never change as there is no way to know what version of OrtApiBase is returned by OrtGetApiBase.
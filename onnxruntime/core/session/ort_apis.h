@@ -533,4 +533,48 @@ ORT_API_STATUS_IMPL(RunOptionsAddActiveLoraAdapter, _Inout_ OrtRunOptions* optio
 
 ORT_API_STATUS_IMPL(SetEpDynamicOptions, _Inout_ OrtSession* sess, _In_reads_(kv_len) const char* const* keys,
                     _In_reads_(kv_len) const char* const* values, _In_ size_t kv_len);
+
+ORT_API_STATUS_IMPL(SessionSetIntraOpThreadAffinities, _Inout_ OrtSession* sess, _In_ const char* affinity_str);
+
+ORT_API_STATUS_IMPL(AllocatorGetStats, _In_ const OrtAllocator* ort_allocator, _Out_ OrtAllocatorStats* stats);
+
+ORT_API_STATUS_IMPL(SessionGetKernelTimeHistograms, _In_ const OrtSession* sess, _Inout_ OrtAllocator* allocator,
+                    _Outptr_ char** out);
+
+ORT_API_STATUS_IMPL(SessionGetMemoryWatermarks, _In_ const OrtSession* sess, _Inout_ OrtAllocator* allocator,
+                    _Outptr_ char** out);
+
+ORT_API_STATUS_IMPL(FillStringTensorFromOffsets, _Inout_ OrtValue* value,
+                    _In_reads_(buffer_length) const char* buffer, size_t buffer_length,
+                    _In_reads_(offsets_len) const size_t* offsets, size_t offsets_len);
+
+ORT_API_STATUS_IMPL(KernelContext_GetInputViews, _In_ const OrtKernelContext* context,
+                    _Out_writes_(num_views) OrtTensorView* views, _In_ size_t num_views);
+
+ORT_API_STATUS_IMPL(SessionGetDispatchReport, _In_ const OrtSession* sess, _Inout_ OrtAllocator* allocator,
+                    _Outptr_ char** out);
+
+ORT_API_STATUS_IMPL(SessionOptionsToSnapshot, _In_ const OrtSessionOptions* options,
+                    _Inout_ OrtAllocator* allocator, _Outptr_ void** snapshot, _Out_ size_t* size);
+
+ORT_API_STATUS_IMPL(CreateSessionOptionsFromSnapshot, _In_reads_(size) const void* snapshot,
+                    _In_ size_t size, _Outptr_ OrtSessionOptions** out);
+
+ORT_API_STATUS_IMPL(SessionGetCalibrationStats, _In_ const OrtSession* sess, _Inout_ OrtAllocator* allocator,
+                    _Outptr_ char** out);
+
+ORT_API_STATUS_IMPL(SessionGetMemoryBudgetReport, _In_ const OrtSession* sess, _Inout_ OrtAllocator* allocator,
+                    _Outptr_ char** out);
+
+ORT_API_STATUS_IMPL(CreateTensorPool, _Inout_ OrtAllocator* allocator, _Outptr_ OrtTensorPool** out);
+
+ORT_API_STATUS_IMPL(CreateTensorFromPool, _Inout_ OrtTensorPool* pool, _In_ const int64_t* shape, size_t shape_len,
+                    ONNXTensorElementDataType type, _Outptr_ OrtValue** out);
+
+ORT_API_STATUS_IMPL(ClearTensorPool, _Inout_ OrtTensorPool* pool);
+
+ORT_API(void, ReleaseTensorPool, _Frees_ptr_opt_ OrtTensorPool*);
+
+ORT_API_STATUS_IMPL(SessionGetEpBoundaryReport, _In_ const OrtSession* sess, _Inout_ OrtAllocator* allocator,
+                    _Outptr_ char** out);
 }  // namespace OrtApis
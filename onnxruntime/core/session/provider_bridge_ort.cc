@@ -1205,6 +1205,39 @@ struct ProviderHostImpl : ProviderHost {
     GraphViewerToProto(*p, graph_proto, include_initializers, include_outer_scope_args, static_cast<ExecutionOrder>(execution_order));
   }
   const Node* GraphViewer__GetProducerNode(const GraphViewer* p, const std::string& node_arg_name) const override { return p->GetProducerNode(node_arg_name); }
+  void GraphViewer__GetMetadataSnapshot(const GraphViewer* p, int execution_order,
+                                        GraphViewerMetadataSnapshot& snapshot) const override {
+    const auto& order = p->GetNodesInTopologicalOrder(static_cast<ExecutionOrder>(execution_order));
+    snapshot.nodes.clear();
+    snapshot.args.clear();
+    snapshot.arg_names.clear();
+    snapshot.nodes.reserve(order.size());
+
+    auto append_args = [&snapshot](ConstPointerContainer<std::vector<NodeArg*>> defs,
+                                   size_t& begin, size_t& count) {
+      begin = snapshot.args.size();
+      count = defs.size();
+      for (const NodeArg* def : defs) {
+        snapshot.args.push_back(def);
+        snapshot.arg_names.push_back(&def->Name());
+      }
+    };
+
+    for (NodeIndex node_index : order) {
+      const Node* node = p->GetNode(node_index);
+      GraphNodeMetadata meta{};
+      meta.index = node_index;
+      meta.node = node;
+      meta.name = &node->Name();
+      meta.op_type = &node->OpType();
+      meta.domain = &node->Domain();
+      meta.since_version = node->SinceVersion();
+      append_args(node->InputDefs(), meta.input_args_begin, meta.input_args_count);
+      append_args(node->ImplicitInputDefs(), meta.implicit_input_args_begin, meta.implicit_input_args_count);
+      append_args(node->OutputDefs(), meta.output_args_begin, meta.output_args_count);
+      snapshot.nodes.push_back(meta);
+    }
+  }
 
   // OpKernel (direct)
   const Node& OpKernel__Node(const OpKernel* p) override { return p->OpKernel::Node(); }
@@ -0,0 +1,178 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/session/session_pipeline.h"
+
+#include <utility>
+
+namespace onnxruntime {
+
+common::Status SessionPipeline::Create(std::vector<Stage> stages, std::unique_ptr<SessionPipeline>& pipeline) {
+  if (stages.empty()) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "A pipeline requires at least one stage.");
+  }
+
+  // make_unique can't reach the private constructor
+  auto result = std::unique_ptr<SessionPipeline>(new SessionPipeline());
+  result->workers_.reserve(stages.size());
+
+  for (size_t i = 0; i < stages.size(); ++i) {
+    if (stages[i].session == nullptr) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Pipeline stage ", i, " has no session.");
+    }
+
+    auto worker = std::make_unique<StageWorker>();
+    worker->stage = std::move(stages[i]);
+
+    // resolving the model signature also verifies the session has a model loaded
+    auto inputs = worker->stage.session->GetModelInputs();
+    ORT_RETURN_IF_ERROR(inputs.first);
+    worker->input_names.reserve(inputs.second->size());
+    for (const auto* def : *inputs.second) {
+      worker->input_names.push_back(def->Name());
+    }
+
+    auto outputs = worker->stage.session->GetModelOutputs();
+    ORT_RETURN_IF_ERROR(outputs.first);
+    worker->output_names.reserve(outputs.second->size());
+    for (const auto* def : *outputs.second) {
+      worker->output_names.push_back(def->Name());
+    }
+
+    // fails if the session is not initialized yet
+    ORT_RETURN_IF_ERROR(worker->stage.session->NewIOBinding(&worker->io_binding));
+
+    result->workers_.push_back(std::move(worker));
+  }
+
+  // start the workers only once every stage validated, so the destructor never joins a half
+  // built pipeline
+  for (size_t i = 0; i < result->workers_.size(); ++i) {
+    result->workers_[i]->thread = std::thread{[raw_pipeline = result.get(), i]() { raw_pipeline->WorkerLoop(i); }};
+  }
+
+  pipeline = std::move(result);
+  return common::Status::OK();
+}
+
+SessionPipeline::~SessionPipeline() {
+  // Shut the stages down front to back: once worker i is joined it can no longer enqueue to
+  // worker i+1, so each worker drains everything it will ever receive before it exits.
+  for (auto& worker : workers_) {
+    {
+      std::lock_guard<std::mutex> lock(worker->mutex);
+      worker->shutting_down = true;
+    }
+    worker->cv.notify_all();
+    if (worker->thread.joinable()) {
+      worker->thread.join();
+    }
+  }
+}
+
+std::future<common::Status> SessionPipeline::RunAsync(const RunOptions& run_options,
+                                                      gsl::span<const std::string> feed_names,
+                                                      gsl::span<const OrtValue> feeds,
+                                                      std::vector<OrtValue>& fetches) {
+  auto request = std::make_unique<Request>();
+  request->run_options = run_options;
+  request->fetches = &fetches;
+  auto pending = request->promise.get_future();
+
+  if (feed_names.size() != feeds.size()) {
+    request->promise.set_value(ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Got ", feeds.size(),
+                                               " feeds but ", feed_names.size(), " feed names."));
+    return pending;
+  }
+
+  request->values.reserve(feed_names.size());
+  for (size_t i = 0; i < feed_names.size(); ++i) {
+    request->values.insert_or_assign(feed_names[i], feeds[i]);
+  }
+
+  Enqueue(0, std::move(request));
+  return pending;
+}
+
+common::Status SessionPipeline::Run(const RunOptions& run_options, gsl::span<const std::string> feed_names,
+                                    gsl::span<const OrtValue> feeds, std::vector<OrtValue>& fetches) {
+  return RunAsync(run_options, feed_names, feeds, fetches).get();
+}
+
+void SessionPipeline::Enqueue(size_t stage_index, std::unique_ptr<Request> request) {
+  StageWorker& worker = *workers_[stage_index];
+  {
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    worker.queue.push_back(std::move(request));
+  }
+  worker.cv.notify_one();
+}
+
+void SessionPipeline::WorkerLoop(size_t stage_index) {
+  StageWorker& worker = *workers_[stage_index];
+  const bool is_last = stage_index == workers_.size() - 1;
+
+  while (true) {
+    std::unique_ptr<Request> request;
+    {
+      std::unique_lock<std::mutex> lock(worker.mutex);
+      worker.cv.wait(lock, [&worker]() { return worker.shutting_down || !worker.queue.empty(); });
+      if (worker.queue.empty()) {
+        break;  // shutting down and fully drained
+      }
+      request = std::move(worker.queue.front());
+      worker.queue.pop_front();
+    }
+
+    if (request->status.IsOK()) {
+      request->status = RunStage(stage_index, *request);
+    }
+
+    if (!is_last && request->status.IsOK()) {
+      Enqueue(stage_index + 1, std::move(request));
+    } else {
+      // the request is done, successfully or not; later stages never see a failed request
+      request->promise.set_value(request->status);
+    }
+  }
+}
+
+common::Status SessionPipeline::RunStage(size_t stage_index, Request& request) {
+  StageWorker& worker = *workers_[stage_index];
+  IOBinding& io_binding = *worker.io_binding;
+  io_binding.ClearInputs();
+  io_binding.ClearOutputs();
+
+  for (const auto& input_name : worker.input_names) {
+    auto mapped = worker.stage.input_map.find(input_name);
+    const std::string& producer_name = mapped != worker.stage.input_map.end() ? mapped->second : input_name;
+    auto value = request.values.find(producer_name);
+    if (value == request.values.end()) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Input '", input_name, "' of pipeline stage ",
+                             stage_index, " resolves to '", producer_name,
+                             "' which was not produced by an earlier stage and was not fed.");
+    }
+    // shares the OrtValue; BindInput only copies if the stage wants the data on another device
+    ORT_RETURN_IF_ERROR(io_binding.BindInput(input_name, value->second));
+  }
+
+  for (const auto& output_name : worker.output_names) {
+    ORT_RETURN_IF_ERROR(io_binding.BindOutput(output_name));
+  }
+
+  ORT_RETURN_IF_ERROR(io_binding.SynchronizeInputs());
+  ORT_RETURN_IF_ERROR(worker.stage.session->Run(request.run_options, io_binding));
+
+  const auto& outputs = io_binding.GetOutputs();
+  if (stage_index == workers_.size() - 1) {
+    *request.fetches = outputs;
+  } else {
+    for (size_t i = 0; i < worker.output_names.size() && i < outputs.size(); ++i) {
+      request.values.insert_or_assign(worker.output_names[i], outputs[i]);
+    }
+  }
+
+  return common::Status::OK();
+}
+
+}  // namespace onnxruntime
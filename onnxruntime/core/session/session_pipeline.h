@@ -0,0 +1,112 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "core/common/common.h"
+#include "core/common/status.h"
+#include "core/framework/ort_value.h"
+#include "core/session/IOBinding.h"
+#include "core/session/inference_session.h"
+
+namespace onnxruntime {
+
+/**
+ * Chains initialized InferenceSessions so one stage's fetches become the next stage's feeds
+ * without leaving the OrtValue world: each fetched value is handed to the next stage's
+ * IOBinding, so no copy happens unless the consuming stage needs the data on a different
+ * device.
+ *
+ * Each stage runs on its own worker thread with a queue in front of it, so with several
+ * requests in flight stage i of request N overlaps stage i+1 of request N-1 and pipeline
+ * throughput approaches that of the slowest stage instead of the sum of all stages.
+ *
+ * Usage:
+ *
+ * std::vector<SessionPipeline::Stage> stages{{&feature_extractor}, {&encoder}, {&decoder}};
+ * std::unique_ptr<SessionPipeline> pipeline;
+ * ORT_RETURN_IF_ERROR(SessionPipeline::Create(std::move(stages), pipeline));
+ *
+ * std::vector<OrtValue> fetches;
+ * auto pending = pipeline->RunAsync(run_options, feed_names, feeds, fetches);
+ * ... enqueue further requests to keep all stages busy ...
+ * ORT_RETURN_IF_ERROR(pending.get());
+ */
+class SessionPipeline {
+ public:
+  struct Stage {
+    // The session to run for this stage. Not owned and must outlive the pipeline.
+    InferenceSession* session{nullptr};
+
+    // Optional renames applied when resolving this stage's inputs: maps an input name of this
+    // stage's model to the name of the earlier stage output (or pipeline feed) that supplies
+    // it. Inputs not present here are matched by name.
+    std::unordered_map<std::string, std::string> input_map;
+  };
+
+  // Creates a pipeline over the given stages and starts one worker thread per stage.
+  // Every stage session must already be initialized.
+  static common::Status Create(std::vector<Stage> stages, std::unique_ptr<SessionPipeline>& pipeline);
+
+  // Drains in-flight requests and joins the worker threads.
+  ~SessionPipeline();
+
+  // Enqueues a request and returns immediately. 'fetches' receives the final stage's outputs
+  // in model output order and must stay alive until the returned future is ready.
+  std::future<common::Status> RunAsync(const RunOptions& run_options, gsl::span<const std::string> feed_names,
+                                       gsl::span<const OrtValue> feeds, std::vector<OrtValue>& fetches);
+
+  // Runs all stages for one request and blocks until the final stage completes.
+  common::Status Run(const RunOptions& run_options, gsl::span<const std::string> feed_names,
+                     gsl::span<const OrtValue> feeds, std::vector<OrtValue>& fetches);
+
+ private:
+  SessionPipeline() = default;
+
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(SessionPipeline);
+
+  struct Request {
+    RunOptions run_options;
+
+    // Everything visible to the request so far: the caller's feeds plus every completed
+    // stage's outputs. A later stage's output shadows an earlier value with the same name.
+    std::unordered_map<std::string, OrtValue> values;
+
+    std::vector<OrtValue>* fetches{nullptr};
+    common::Status status{common::Status::OK()};
+    std::promise<common::Status> promise;
+  };
+
+  struct StageWorker {
+    Stage stage;
+    std::vector<std::string> input_names;   // the stage model's input names, resolved in Create
+    std::vector<std::string> output_names;  // the stage model's output names, resolved in Create
+
+    // Reused across requests; safe because a stage processes one request at a time.
+    std::unique_ptr<IOBinding> io_binding;
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<std::unique_ptr<Request>> queue;
+    bool shutting_down{false};
+    std::thread thread;
+  };
+
+  void WorkerLoop(size_t stage_index);
+  void Enqueue(size_t stage_index, std::unique_ptr<Request> request);
+  common::Status RunStage(size_t stage_index, Request& request);
+
+  std::vector<std::unique_ptr<StageWorker>> workers_;
+};
+
+}  // namespace onnxruntime
@@ -0,0 +1,25 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#if defined(_MSC_VER) && (defined(_M_AMD64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
+namespace onnxruntime {
+
+// Hint to the hardware that 'address' is about to be read. Compiles to a
+// prefetch instruction where one is available and to nothing elsewhere, so it
+// is safe to call unconditionally in portable code.
+inline void PrefetchForRead(const void* address) {
+#if defined(_MSC_VER) && (defined(_M_AMD64) || defined(_M_IX86))
+  _mm_prefetch(reinterpret_cast<const char*>(address), _MM_HINT_T0);
+#elif defined(__GNUC__) || defined(__clang__)
+  __builtin_prefetch(address);
+#else
+  (void)address;
+#endif
+}
+
+}  // namespace onnxruntime
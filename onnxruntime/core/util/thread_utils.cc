@@ -38,7 +38,7 @@ namespace concurrency {
 // Extract affinity from affinity string.
 // Processor id from affinity string starts from 1,
 // but internally, processor id starts from 0, so here we minus the id by 1
-static std::vector<LogicalProcessors> ReadThreadAffinityConfig(const std::string& affinity_str) {
+std::vector<LogicalProcessors> ReadThreadAffinityConfig(const std::string& affinity_str) {
   ORT_TRY {
     std::vector<LogicalProcessors> logical_processors_vector;
     auto affinities = utils::SplitString(affinity_str, ";");
@@ -151,6 +151,9 @@ CreateThreadPoolHelper(Env* env, OrtThreadPoolParams options) {
   to.custom_thread_creation_options = options.custom_thread_creation_options;
   to.custom_join_thread_fn = options.custom_join_thread_fn;
   to.dynamic_block_base_ = options.dynamic_block_base_;
+  to.steal_domain_size = options.steal_domain_size;
+  to.small_loop_max_helpers = options.small_loop_max_helpers;
+  to.adaptive_degree = options.adaptive_degree;
   if (to.custom_create_thread_fn) {
     ORT_ENFORCE(to.custom_join_thread_fn, "custom join thread function not set");
   }
@@ -27,6 +27,18 @@ struct OrtThreadPoolParams {
 
   unsigned int stack_size = 0;
 
+  // Number of consecutive worker threads that form one work-steal domain; see
+  // ThreadOptions::steal_domain_size. 0 keeps a single pool-wide domain.
+  int steal_domain_size = 0;
+
+  // Maximum number of workers (in addition to the caller thread) used by the small parallel
+  // loop fast path; see ThreadOptions::small_loop_max_helpers. 0 disables the fast path.
+  int small_loop_max_helpers = 0;
+
+  // Learn per-cost-bucket degree-of-parallelism clamps online; see
+  // ThreadOptions::adaptive_degree. false disables the controller.
+  bool adaptive_degree = false;
+
   // A utf-8 string of affinity settings, format be like:
   // <1st_thread_affinity_config>;<2nd_thread_affinity_config>;<3rd_thread_affinity_config>...
   // ith_thread_affinity_config could be:
@@ -67,5 +79,11 @@ enum class ThreadPoolType : uint8_t {
 };
 std::unique_ptr<ThreadPool> CreateThreadPool(Env* env, OrtThreadPoolParams options,
                                              ThreadPoolType tpool_type);
+
+#if !defined(ORT_MINIMAL_BUILD) && !defined(ORT_EXTENDED_MINIMAL_BUILD)
+// Parse a thread affinity string in the OrtThreadPoolParams::affinity_str format
+// into one LogicalProcessors entry per thread. Throws on malformed input.
+std::vector<LogicalProcessors> ReadThreadAffinityConfig(const std::string& affinity_str);
+#endif
 }  // namespace concurrency
 }  // namespace onnxruntime
@@ -896,6 +896,44 @@ class OrtValue:
         """
         self._ortvalue.update_inplace(np_arr)
 
+    def to_dlpack(self):
+        """
+        Returns a DLPack capsule representing the tensor without copying the data.
+        The capsule shares ownership of the underlying buffer, so the data stays
+        alive until the consumer releases it even if this OrtValue goes away first.
+        Only available when onnxruntime is built with DLPack support.
+        """
+        return self._ortvalue.to_dlpack()
+
+    @staticmethod
+    def from_dlpack(dlpack_tensor, is_bool_tensor=False):
+        """
+        Constructs an OrtValue that takes ownership of the tensor behind the given
+        DLPack capsule without copying the data.
+        Only available when onnxruntime is built with DLPack support.
+
+        :param dlpack_tensor: A DLPack capsule, e.g. produced by torch.to_dlpack
+        :param is_bool_tensor: True when the capsule wraps a boolean tensor. DLPack
+            represents booleans as uint8, so the flag is needed to restore the type.
+        """
+        return OrtValue(C.OrtValue.from_dlpack(dlpack_tensor, is_bool_tensor))
+
+    def __dlpack__(self, stream=None):
+        """
+        Returns a DLPack capsule for this tensor (part of the __dlpack__ protocol),
+        so consumers such as torch.from_dlpack can wrap the data without a copy.
+        Only available when onnxruntime is built with DLPack support.
+        """
+        return self._ortvalue.__dlpack__(stream)
+
+    def __dlpack_device__(self):
+        """
+        Returns the DLPack device of this tensor as a (device_type, device_id) tuple
+        (part of the __dlpack__ protocol).
+        Only available when onnxruntime is built with DLPack support.
+        """
+        return self._ortvalue.__dlpack_device__()
+
 
 class OrtDevice:
     """
@@ -0,0 +1,169 @@
+# -------------------------------------------------------------------------
+# Copyright (c) Microsoft Corporation.  All rights reserved.
+# Licensed under the MIT License.
+# --------------------------------------------------------------------------
+"""Benchmark an operator corpus (see extract_corpus.py) with the installed onnxruntime build.
+
+Each corpus entry is rebuilt as a single-node model and run through an InferenceSession with graph
+optimizations disabled so the measurement isolates the kernel. Timing samples are kept in the
+output so compare_results.py can test deltas for statistical significance.
+"""
+
+import argparse
+import json
+import time
+
+import numpy as np
+import onnx
+
+import onnxruntime
+
+
+_ELEM_TYPE_TO_NUMPY = {
+    onnx.TensorProto.FLOAT: np.float32,
+    onnx.TensorProto.FLOAT16: np.float16,
+    onnx.TensorProto.DOUBLE: np.float64,
+    onnx.TensorProto.UINT8: np.uint8,
+    onnx.TensorProto.INT8: np.int8,
+    onnx.TensorProto.UINT16: np.uint16,
+    onnx.TensorProto.INT16: np.int16,
+    onnx.TensorProto.INT32: np.int32,
+    onnx.TensorProto.INT64: np.int64,
+    onnx.TensorProto.BOOL: np.bool_,
+}
+
+
+def _attribute_from_jsonable(name, value):
+    if isinstance(value, dict):
+        if "__tensor__" in value:
+            tensor = onnx.TensorProto()
+            tensor.ParseFromString(bytes.fromhex(value["__tensor__"]))
+            return onnx.helper.make_attribute(name, tensor)
+        if "__bytes__" in value:
+            return onnx.helper.make_attribute(name, value["__bytes__"].encode("utf-8", errors="surrogateescape"))
+        if "__bytes_list__" in value:
+            return onnx.helper.make_attribute(
+                name, [v.encode("utf-8", errors="surrogateescape") for v in value["__bytes_list__"]]
+            )
+    return onnx.helper.make_attribute(name, value)
+
+
+def _random_tensor(rng, dtype, shape):
+    np_dtype = _ELEM_TYPE_TO_NUMPY[dtype]
+    if np_dtype == np.bool_:
+        return rng.integers(0, 2, size=shape).astype(np_dtype)
+    if np.issubdtype(np_dtype, np.integer):
+        info = np.iinfo(np_dtype)
+        low = max(info.min, -8)
+        high = min(info.max, 8)
+        return rng.integers(low, high + 1, size=shape).astype(np_dtype)
+    return rng.uniform(-1.0, 1.0, size=shape).astype(np_dtype)
+
+
+def build_model(record):
+    input_names = []
+    graph_inputs = []
+    initializers = []
+    rng = np.random.default_rng(int(record["signature"], 16) % (2**32))
+
+    node_inputs = []
+    for i, spec in enumerate(record["inputs"]):
+        if spec is None:
+            node_inputs.append("")
+            continue
+        name = f"input_{i}"
+        node_inputs.append(name)
+        if spec["dtype"] not in _ELEM_TYPE_TO_NUMPY:
+            raise ValueError(f"unsupported dtype {spec['dtype']}")
+        if spec["is_initializer"]:
+            data = _random_tensor(rng, spec["dtype"], spec["shape"])
+            initializers.append(onnx.numpy_helper.from_array(data, name=name))
+        else:
+            graph_inputs.append(onnx.helper.make_tensor_value_info(name, spec["dtype"], spec["shape"]))
+            input_names.append((name, spec["dtype"], spec["shape"]))
+
+    node_outputs = [f"output_{i}" for i in range(record["num_outputs"])]
+    node = onnx.helper.make_node(record["op_type"], node_inputs, node_outputs, domain=record["domain"])
+    node.attribute.extend(
+        _attribute_from_jsonable(name, value) for name, value in sorted(record["attributes"].items())
+    )
+
+    # output types are left to be inferred by the session (no type/shape given)
+    graph_outputs = [
+        onnx.helper.make_empty_tensor_value_info(output_name) for output_name in node_outputs
+    ]
+    graph = onnx.helper.make_graph([node], f"op_benchmark_{record['signature']}", graph_inputs, graph_outputs,
+                                   initializer=initializers)
+    opset_imports = [onnx.helper.make_opsetid(record["domain"], record["opset_version"])]
+    if record["domain"] != "":
+        # kernels from custom domains usually still need the default domain declared
+        opset_imports.append(onnx.helper.make_opsetid("", onnx.defs.onnx_opset_version()))
+    model = onnx.helper.make_model(graph, opset_imports=opset_imports)
+
+    feeds = {name: _random_tensor(rng, dtype, shape) for name, dtype, shape in input_names}
+    return model, feeds
+
+
+def benchmark_record(record, args):
+    model, feeds = build_model(record)
+
+    session_options = onnxruntime.SessionOptions()
+    session_options.graph_optimization_level = onnxruntime.GraphOptimizationLevel.ORT_DISABLE_ALL
+    providers = [args.provider] if args.provider else ["CPUExecutionProvider"]
+    session = onnxruntime.InferenceSession(model.SerializeToString(), session_options, providers=providers)
+
+    for _ in range(args.warmup):
+        session.run(None, feeds)
+
+    samples = []
+    for _ in range(args.repeats):
+        start = time.perf_counter()
+        for _ in range(args.runs_per_sample):
+            session.run(None, feeds)
+        samples.append((time.perf_counter() - start) / args.runs_per_sample)
+
+    return samples
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--corpus", required=True, help="Corpus path produced by extract_corpus.py.")
+    parser.add_argument("--output", required=True, help="Output results path (JSON).")
+    parser.add_argument("--provider", default=None, help="Execution provider to benchmark (default CPU).")
+    parser.add_argument("--warmup", type=int, default=5, help="Warmup runs per entry.")
+    parser.add_argument("--repeats", type=int, default=20, help="Timing samples per entry.")
+    parser.add_argument("--runs-per-sample", type=int, default=10, help="Session runs averaged into one sample.")
+    args = parser.parse_args()
+
+    results = {
+        "onnxruntime_version": onnxruntime.__version__,
+        "provider": args.provider or "CPUExecutionProvider",
+        "entries": {},
+    }
+
+    with open(args.corpus) as f:
+        records = [json.loads(line) for line in f if line.strip()]
+
+    failures = 0
+    for record in records:
+        try:
+            samples = benchmark_record(record, args)
+        except Exception as e:  # noqa: BLE001
+            print(f"warning: {record['op_type']} ({record['signature']}) failed: {e}")
+            failures += 1
+            continue
+        results["entries"][record["signature"]] = {
+            "op_type": record["op_type"],
+            "domain": record["domain"],
+            "count": record["count"],
+            "samples_s": samples,
+        }
+
+    with open(args.output, "w") as f:
+        json.dump(results, f, indent=2)
+
+    print(f"benchmarked {len(results['entries'])} entries ({failures} failed) -> {args.output}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,156 @@
+# -------------------------------------------------------------------------
+# Copyright (c) Microsoft Corporation.  All rights reserved.
+# Licensed under the MIT License.
+# --------------------------------------------------------------------------
+"""Compare two benchmark result files (see benchmark_corpus.py) and report per-op deltas.
+
+Deltas are tested with Welch's t-test on the recorded timing samples. The process exits with a
+non-zero status when a statistically significant regression above the threshold is found, so this
+can gate a deployment pipeline.
+"""
+
+import argparse
+import json
+import math
+import statistics
+import sys
+
+
+def _betacf(a, b, x):
+    """Continued fraction for the regularized incomplete beta function (Numerical Recipes style)."""
+    max_iterations = 200
+    epsilon = 3.0e-12
+    qab = a + b
+    qap = a + 1.0
+    qam = a - 1.0
+    c = 1.0
+    d = 1.0 - qab * x / qap
+    if abs(d) < 1.0e-30:
+        d = 1.0e-30
+    d = 1.0 / d
+    h = d
+    for m in range(1, max_iterations + 1):
+        m2 = 2 * m
+        aa = m * (b - m) * x / ((qam + m2) * (a + m2))
+        d = 1.0 + aa * d
+        if abs(d) < 1.0e-30:
+            d = 1.0e-30
+        c = 1.0 + aa / c
+        if abs(c) < 1.0e-30:
+            c = 1.0e-30
+        d = 1.0 / d
+        h *= d * c
+        aa = -(a + m) * (qab + m) * x / ((a + m2) * (qap + m2))
+        d = 1.0 + aa * d
+        if abs(d) < 1.0e-30:
+            d = 1.0e-30
+        c = 1.0 + aa / c
+        if abs(c) < 1.0e-30:
+            c = 1.0e-30
+        d = 1.0 / d
+        delta = d * c
+        h *= delta
+        if abs(delta - 1.0) < epsilon:
+            break
+    return h
+
+
+def _incomplete_beta(a, b, x):
+    if x <= 0.0:
+        return 0.0
+    if x >= 1.0:
+        return 1.0
+    ln_front = (
+        math.lgamma(a + b) - math.lgamma(a) - math.lgamma(b) + a * math.log(x) + b * math.log(1.0 - x)
+    )
+    front = math.exp(ln_front)
+    if x < (a + 1.0) / (a + b + 2.0):
+        return front * _betacf(a, b, x) / a
+    return 1.0 - front * _betacf(b, a, 1.0 - x) / b
+
+
+def welch_t_test(samples_a, samples_b):
+    """Return (t statistic, two-sided p-value) for the difference in means."""
+    n_a = len(samples_a)
+    n_b = len(samples_b)
+    mean_a = statistics.fmean(samples_a)
+    mean_b = statistics.fmean(samples_b)
+    var_a = statistics.variance(samples_a)
+    var_b = statistics.variance(samples_b)
+    se_sq = var_a / n_a + var_b / n_b
+    if se_sq == 0.0:
+        return 0.0, 1.0
+    t = (mean_b - mean_a) / math.sqrt(se_sq)
+    dof = se_sq**2 / ((var_a / n_a) ** 2 / (n_a - 1) + (var_b / n_b) ** 2 / (n_b - 1))
+    # two-sided p-value from the Student's t CDF
+    x = dof / (dof + t * t)
+    p = _incomplete_beta(dof / 2.0, 0.5, x)
+    return t, p
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("baseline", help="Baseline results file.")
+    parser.add_argument("candidate", help="Candidate results file.")
+    parser.add_argument("--alpha", type=float, default=0.01, help="Significance level for Welch's t-test.")
+    parser.add_argument(
+        "--regression-threshold-pct",
+        type=float,
+        default=5.0,
+        help="Minimum mean slowdown (percent) for a significant delta to count as a regression.",
+    )
+    parser.add_argument("--verbose", action="store_true", help="Also print unchanged entries.")
+    args = parser.parse_args()
+
+    with open(args.baseline) as f:
+        baseline = json.load(f)
+    with open(args.candidate) as f:
+        candidate = json.load(f)
+
+    print(f"baseline:  onnxruntime {baseline['onnxruntime_version']} ({baseline['provider']})")
+    print(f"candidate: onnxruntime {candidate['onnxruntime_version']} ({candidate['provider']})")
+
+    regressions = []
+    improvements = []
+    common = sorted(set(baseline["entries"]) & set(candidate["entries"]))
+    for signature in common:
+        entry_a = baseline["entries"][signature]
+        entry_b = candidate["entries"][signature]
+        mean_a = statistics.fmean(entry_a["samples_s"])
+        mean_b = statistics.fmean(entry_b["samples_s"])
+        delta_pct = (mean_b - mean_a) / mean_a * 100.0
+        t, p = welch_t_test(entry_a["samples_s"], entry_b["samples_s"])
+        significant = p < args.alpha
+
+        line = (
+            f"{entry_a['op_type']:<24} {signature}  count={entry_a['count']:<6}"
+            f" {mean_a * 1e6:10.2f}us -> {mean_b * 1e6:10.2f}us  {delta_pct:+7.2f}%  p={p:.4f}"
+        )
+        if significant and delta_pct >= args.regression_threshold_pct:
+            regressions.append(line)
+        elif significant and delta_pct <= -args.regression_threshold_pct:
+            improvements.append(line)
+        elif args.verbose:
+            print("  " + line)
+
+    missing = sorted(set(baseline["entries"]) - set(candidate["entries"]))
+    for signature in missing:
+        entry = baseline["entries"][signature]
+        regressions.append(f"{entry['op_type']:<24} {signature}  missing from candidate results")
+
+    if improvements:
+        print(f"\n{len(improvements)} improvement(s):")
+        for line in improvements:
+            print("  " + line)
+
+    if regressions:
+        print(f"\n{len(regressions)} regression(s):")
+        for line in regressions:
+            print("  " + line)
+        sys.exit(1)
+
+    print(f"\nno regressions across {len(common)} entries")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,169 @@
+# -------------------------------------------------------------------------
+# Copyright (c) Microsoft Corporation.  All rights reserved.
+# Licensed under the MIT License.
+# --------------------------------------------------------------------------
+"""Extract a replayable operator corpus from a set of ONNX models.
+
+Each distinct (op_type, domain, input shapes, input dtypes, attributes) instance found in the
+models becomes one JSONL record. Records carry a stable signature hash, an occurrence count and
+everything needed to rebuild an equivalent single-node model for benchmarking.
+"""
+
+import argparse
+import hashlib
+import json
+import sys
+
+import onnx
+from onnx import shape_inference
+
+
+def _attribute_to_jsonable(attr):
+    """Convert an AttributeProto value to something JSON serializable."""
+    value = onnx.helper.get_attribute_value(attr)
+    if isinstance(value, onnx.TensorProto):
+        # keep the tensor as raw bytes so constants (e.g. Reshape shape via attribute) replay exactly
+        return {"__tensor__": value.SerializeToString().hex()}
+    if isinstance(value, bytes):
+        return {"__bytes__": value.decode("utf-8", errors="surrogateescape")}
+    if isinstance(value, list) and value and isinstance(value[0], bytes):
+        return {"__bytes_list__": [v.decode("utf-8", errors="surrogateescape") for v in value]}
+    if isinstance(value, (onnx.GraphProto, list)) and (
+        isinstance(value, onnx.GraphProto) or (value and isinstance(value[0], onnx.GraphProto))
+    ):
+        # control flow bodies are not replayable as a flat single node
+        raise ValueError("graph attribute")
+    return value
+
+
+def _tensor_type_info(value_info):
+    tensor_type = value_info.type.tensor_type
+    if tensor_type.elem_type == onnx.TensorProto.UNDEFINED:
+        return None
+    shape = []
+    if not tensor_type.HasField("shape"):
+        return None
+    for dim in tensor_type.shape.dim:
+        if dim.HasField("dim_value"):
+            shape.append(dim.dim_value)
+        elif dim.HasField("dim_param"):
+            shape.append(dim.dim_param)
+        else:
+            return None
+    return {"dtype": tensor_type.elem_type, "shape": shape}
+
+
+def _bind_free_dims(shape, free_dims):
+    bound = []
+    for dim in shape:
+        if isinstance(dim, str):
+            if dim not in free_dims:
+                return None
+            bound.append(free_dims[dim])
+        else:
+            bound.append(dim)
+    return bound
+
+
+def extract_model(model_path, free_dims, records):
+    model = onnx.load(model_path)
+    try:
+        model = shape_inference.infer_shapes(model)
+    except Exception as e:  # noqa: BLE001
+        print(f"warning: shape inference failed for {model_path}: {e}", file=sys.stderr)
+
+    graph = model.graph
+    opset_imports = {opset.domain: opset.version for opset in model.opset_import}
+
+    value_infos = {}
+    for value_info in list(graph.value_info) + list(graph.input) + list(graph.output):
+        info = _tensor_type_info(value_info)
+        if info is not None:
+            value_infos[value_info.name] = info
+    for initializer in graph.initializer:
+        value_infos[initializer.name] = {"dtype": initializer.data_type, "shape": list(initializer.dims)}
+
+    initializer_names = {initializer.name for initializer in graph.initializer}
+
+    skipped = 0
+    for node in graph.node:
+        if node.domain not in opset_imports:
+            skipped += 1
+            continue
+
+        inputs = []
+        replayable = True
+        for name in node.input:
+            if not name:
+                inputs.append(None)  # missing optional input
+                continue
+            info = value_infos.get(name)
+            if info is None:
+                replayable = False
+                break
+            shape = _bind_free_dims(info["shape"], free_dims)
+            if shape is None:
+                replayable = False
+                break
+            inputs.append({"dtype": info["dtype"], "shape": shape, "is_initializer": name in initializer_names})
+        if not replayable or len(node.output) == 0:
+            skipped += 1
+            continue
+
+        try:
+            attributes = {attr.name: _attribute_to_jsonable(attr) for attr in node.attribute}
+        except ValueError:
+            skipped += 1  # control flow ops (If/Loop/Scan) are not replayable as a flat node
+            continue
+
+        record = {
+            "op_type": node.op_type,
+            "domain": node.domain,
+            "opset_version": opset_imports[node.domain],
+            "num_outputs": len(node.output),
+            "inputs": inputs,
+            "attributes": attributes,
+        }
+        signature = hashlib.sha256(json.dumps(record, sort_keys=True).encode()).hexdigest()[:16]
+        if signature in records:
+            records[signature]["count"] += 1
+        else:
+            record["signature"] = signature
+            record["count"] = 1
+            records[signature] = record
+
+    return skipped
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--models", nargs="+", required=True, help="ONNX model paths to extract from.")
+    parser.add_argument("--output", required=True, help="Output corpus path (JSONL).")
+    parser.add_argument(
+        "--free-dim",
+        action="append",
+        default=[],
+        metavar="NAME=VALUE",
+        help="Bind a symbolic dimension to a concrete value. May be given multiple times.",
+    )
+    args = parser.parse_args()
+
+    free_dims = {}
+    for spec in args.free_dim:
+        name, _, value = spec.partition("=")
+        free_dims[name] = int(value)
+
+    records = {}
+    total_skipped = 0
+    for model_path in args.models:
+        total_skipped += extract_model(model_path, free_dims, records)
+
+    with open(args.output, "w") as f:
+        for record in records.values():
+            f.write(json.dumps(record, sort_keys=True) + "\n")
+
+    print(f"extracted {len(records)} distinct op instances to {args.output} ({total_skipped} nodes skipped)")
+
+
+if __name__ == "__main__":
+    main()
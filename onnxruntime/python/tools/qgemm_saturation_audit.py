@@ -0,0 +1,189 @@
+# -------------------------------------------------------------------------
+# Copyright (c) Microsoft Corporation.  All rights reserved.
+# Licensed under the MIT License.
+# --------------------------------------------------------------------------
+"""Offline saturation audit for the fast x64 int8 GEMM path.
+
+On x64 without AVX-VNNI, the default U8S8 quantized GEMM kernels accumulate adjacent
+K-dimension product pairs through vpmaddubsw, which saturates at int16. ONNX Runtime offers the
+session option `session.x64quantprecision` (kOrtSessionOptionsAvx2PrecisionMode) to switch to the
+slower but exact U8U8 path. This tool inspects the quantized weights of a model and reports
+whether any (weight pair, worst-case u8 activation) combination can actually saturate, so the
+slow path is only enabled when it is needed.
+
+A weight pair (w0, w1) feeding u8 activations in [lo, hi] saturates when
+
+    max(a0*w0 + a1*w1) > 32767  or  min(a0*w0 + a1*w1) < -32768,  a0, a1 in [lo, hi]
+
+Audited operators: QLinearMatMul, QLinearConv, QGemm (com.microsoft), and MatMul/Conv/Gemm whose
+weight input is produced by DequantizeLinear from an int8 initializer (QDQ form). Only the
+u8-activation/s8-weight combination is affected; other type combinations are reported as safe.
+"""
+
+import argparse
+import sys
+
+import numpy as np
+import onnx
+from onnx import numpy_helper
+
+INT16_MAX = 32767
+INT16_MIN = -32768
+
+
+def _pair_extremes(weights_2d, act_lo, act_hi):
+    """Worst-case pmaddubsw pair sums for an int8 matrix of shape (K, N).
+
+    Returns (max_sum, min_sum) over all adjacent K pairs and all columns.
+    """
+    k = weights_2d.shape[0]
+    w = weights_2d.astype(np.int64)
+    # maximize/minimize a*w for a in [act_lo, act_hi]
+    per_elem_max = np.where(w > 0, act_hi * w, act_lo * w)
+    per_elem_min = np.where(w > 0, act_lo * w, act_hi * w)
+    even = slice(0, k - (k % 2), 2)
+    odd = slice(1, k, 2)
+    pair_max = per_elem_max[even] + per_elem_max[odd]
+    pair_min = per_elem_min[even] + per_elem_min[odd]
+    if k % 2:  # trailing unpaired element cannot saturate by itself but still counts
+        pair_max = np.concatenate([pair_max, per_elem_max[-1:]])
+        pair_min = np.concatenate([pair_min, per_elem_min[-1:]])
+    saturable = np.count_nonzero((pair_max > INT16_MAX) | (pair_min < INT16_MIN))
+    return int(pair_max.max(initial=0)), int(pair_min.min(initial=0)), saturable, pair_max.size
+
+
+def _weight_as_k_by_n(weights, op_type, trans_b):
+    """Reshape a weight tensor so axis 0 is the GEMM reduction (K) dimension."""
+    if op_type in ("QLinearConv", "Conv"):
+        # (M, C/group, kH, kW) -> K = C/group * kH * kW per output channel
+        return weights.reshape(weights.shape[0], -1).T
+    if weights.ndim == 1:
+        return weights.reshape(-1, 1)
+    if weights.ndim == 2:
+        return weights.T if trans_b else weights
+    # stacked MatMul weight (..., K, N): move K to axis 0 and fold the rest into columns
+    return np.moveaxis(weights, -2, 0).reshape(weights.shape[-2], -1)
+
+
+def _tensor_dtype(initializers, value_types, name):
+    if name in initializers:
+        return initializers[name].data_type
+    return value_types.get(name)
+
+
+def audit_model(model_path, act_lo, act_hi, verbose):
+    model = onnx.load(model_path)
+    graph = model.graph
+    initializers = {init.name: init for init in graph.initializer}
+    producers = {}
+    for node in graph.node:
+        for output in node.output:
+            producers[output] = node
+
+    value_types = {}
+    for value_info in list(graph.input) + list(graph.value_info) + list(graph.output):
+        if value_info.type.HasField("tensor_type"):
+            value_types[value_info.name] = value_info.type.tensor_type.elem_type
+
+    findings = []
+    for node in graph.node:
+        weight_name = None
+        activation_name = None
+        trans_b = False
+
+        if node.op_type in ("QLinearMatMul", "QLinearConv"):
+            activation_name, weight_name = node.input[0], node.input[3]
+        elif node.op_type == "QGemm" and node.domain == "com.microsoft":
+            activation_name, weight_name = node.input[0], node.input[3]
+            trans_b = any(attr.name == "transB" and attr.i != 0 for attr in node.attribute)
+        elif node.op_type in ("MatMul", "Conv", "Gemm") and len(node.input) >= 2:
+            # QDQ form: weight comes from DequantizeLinear of an int8 initializer
+            producer = producers.get(node.input[1])
+            if producer is None or producer.op_type != "DequantizeLinear":
+                continue
+            if producer.input[0] not in initializers:
+                continue
+            activation_name, weight_name = node.input[0], producer.input[0]
+            if node.op_type == "Gemm":
+                trans_b = any(attr.name == "transB" and attr.i != 0 for attr in node.attribute)
+        else:
+            continue
+
+        weight_init = initializers.get(weight_name)
+        if weight_init is None:
+            continue
+        if weight_init.data_type != onnx.TensorProto.INT8:
+            continue  # u8u8 / u8u8-like combinations do not use the saturating kernel
+
+        activation_type = _tensor_dtype(initializers, value_types, activation_name)
+        if activation_type == onnx.TensorProto.INT8:
+            continue  # s8 activations take a different path
+
+        weights = numpy_helper.to_array(weight_init)
+        k_by_n = _weight_as_k_by_n(weights, node.op_type, trans_b)
+        pair_max, pair_min, saturable, total = _pair_extremes(k_by_n, act_lo, act_hi)
+        findings.append(
+            {
+                "node": node.name or f"{node.op_type}({weight_name})",
+                "op_type": node.op_type,
+                "weight": weight_name,
+                "saturable_pairs": saturable,
+                "total_pairs": total,
+                "worst_max": pair_max,
+                "worst_min": pair_min,
+            }
+        )
+
+    unsafe = [f for f in findings if f["saturable_pairs"] > 0]
+    for finding in findings:
+        if finding["saturable_pairs"] > 0 or verbose:
+            status = "UNSAFE" if finding["saturable_pairs"] > 0 else "safe"
+            print(
+                f"  [{status:>6}] {finding['op_type']:<16} {finding['node']:<40}"
+                f" saturable pairs: {finding['saturable_pairs']}/{finding['total_pairs']}"
+                f" (range [{finding['worst_min']}, {finding['worst_max']}])"
+            )
+
+    print(f"\naudited {len(findings)} quantized GEMM/Conv weight(s) in {model_path}")
+    if unsafe:
+        print(
+            f"{len(unsafe)} weight(s) can saturate int16 pair accumulation with activations in"
+            f" [{act_lo}, {act_hi}].\n"
+            'Set session config "session.x64quantprecision" to "1" on AVX2/AVX512 (no VNNI) machines,'
+            " or re-quantize the offending weights with a smaller range."
+        )
+        return 1
+
+    print(
+        "no saturation possible: the default fast U8S8 path is exact for this model;"
+        ' leave "session.x64quantprecision" at "0".'
+    )
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("model", help="Quantized ONNX model to audit.")
+    parser.add_argument(
+        "--activation-min",
+        type=int,
+        default=0,
+        help="Lower bound of the u8 activation range (use calibration data to tighten, default 0).",
+    )
+    parser.add_argument(
+        "--activation-max",
+        type=int,
+        default=255,
+        help="Upper bound of the u8 activation range (default 255).",
+    )
+    parser.add_argument("--verbose", action="store_true", help="Also print weights that are safe.")
+    args = parser.parse_args()
+
+    if not 0 <= args.activation_min <= args.activation_max <= 255:
+        parser.error("activation range must satisfy 0 <= min <= max <= 255")
+
+    sys.exit(audit_model(args.model, args.activation_min, args.activation_max, args.verbose))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,182 @@
+# -------------------------------------------------------------------------
+# Copyright (c) Microsoft Corporation.  All rights reserved.
+# Licensed under the MIT License.
+# --------------------------------------------------------------------------
+"""Offline pre-generation of QNN EP context models for a set of shape buckets.
+
+The QNN execution provider compiles its context binary when a session first initializes, which
+costs seconds on device. The EP can dump the compiled result as an EPContext model
+(`ep.context_enable`) and later sessions that load the dumped model skip compilation entirely.
+This tool runs that dump step offline, once per declared shape bucket, so an application can
+ship the pre-compiled context models in its bundle and pick the one matching its input shapes
+at runtime.
+
+For each bucket the symbolic dimensions of the model inputs are fixed to the bucket's values,
+a session is created with the QNN EP and EP context dumping enabled, and the resulting
+`<model>_<bucket>_ctx.onnx` is written to the output directory. A `qnn_context_manifest.json`
+maps each bucket's concrete input shapes to its context model so runtime selection is a
+dictionary lookup.
+
+Context binaries are specific to the QNN backend, SoC generation, and QNN SDK version used
+here; generate them with the same backend configuration the application ships with.
+
+Example:
+
+    python qnn_context_pregen.py model.onnx --output_dir bundle/qnn \\
+        --provider_option backend_path=libQnnHtp.so \\
+        --bucket batch=1,seq=128 --bucket batch=1,seq=512 --bucket batch=4,seq=128
+"""
+
+import argparse
+import json
+import os
+import sys
+import tempfile
+
+import onnx
+
+import onnxruntime
+
+
+def parse_bucket(text):
+    """Parses "name=value,name=value" into an ordered {dim_param: int} dict."""
+    bucket = {}
+    for item in text.split(","):
+        name, sep, value = item.partition("=")
+        if not sep or not name or not value.isdigit():
+            raise argparse.ArgumentTypeError(f"bad bucket entry '{item}', expected name=value with an integer value")
+        bucket[name] = int(value)
+    return bucket
+
+
+def fix_input_shapes(model, bucket):
+    """Replaces symbolic input dimensions listed in the bucket with fixed values.
+
+    Returns the concrete input shapes and the set of bucket entries that matched a dimension.
+    Initializers listed as graph inputs are skipped. Raises if a symbolic dimension remains
+    unfixed, since the QNN EP cannot compile a context for a dynamic shape.
+    """
+    initializer_names = {initializer.name for initializer in model.graph.initializer}
+    input_shapes = {}
+    used = set()
+
+    for graph_input in model.graph.input:
+        if graph_input.name in initializer_names:
+            continue
+
+        shape = []
+        for dim in graph_input.type.tensor_type.shape.dim:
+            if dim.HasField("dim_param") and dim.dim_param in bucket:
+                used.add(dim.dim_param)
+                dim.ClearField("dim_param")
+                dim.dim_value = bucket[dim.dim_param]
+            if not dim.HasField("dim_value"):
+                raise ValueError(
+                    f"input '{graph_input.name}' has unfixed dimension "
+                    f"'{dim.dim_param or '?'}'; add it to the bucket"
+                )
+            shape.append(dim.dim_value)
+        input_shapes[graph_input.name] = shape
+
+    return input_shapes, used
+
+
+def bucket_tag(bucket):
+    """Builds a filesystem-safe tag like "batch1_seq128" from a bucket."""
+    return "_".join(f"{name}{value}" for name, value in bucket.items())
+
+
+def generate_context_model(model_path, bucket, output_dir, provider_options, embed_mode):
+    """Generates the EP context model for one bucket and returns its manifest entry."""
+    model = onnx.load(model_path)
+    input_shapes, used = fix_input_shapes(model, bucket)
+
+    unused = set(bucket) - used
+    if unused:
+        raise ValueError(f"bucket entries {sorted(unused)} match no symbolic input dimension")
+
+    tag = bucket_tag(bucket) if bucket else "static"
+    base = os.path.splitext(os.path.basename(model_path))[0]
+    context_file = os.path.join(output_dir, f"{base}_{tag}_ctx.onnx")
+
+    session_options = onnxruntime.SessionOptions()
+    session_options.add_session_config_entry("ep.context_enable", "1")
+    session_options.add_session_config_entry("ep.context_file_path", context_file)
+    session_options.add_session_config_entry("ep.context_embed_mode", "1" if embed_mode else "0")
+
+    # session creation compiles the QNN graphs and dumps the context model as a side effect
+    with tempfile.TemporaryDirectory() as temp_dir:
+        fixed_model_path = os.path.join(temp_dir, f"{base}_{tag}.onnx")
+        onnx.save(model, fixed_model_path)
+        onnxruntime.InferenceSession(
+            fixed_model_path,
+            sess_options=session_options,
+            providers=[("QNNExecutionProvider", provider_options)],
+        )
+
+    if not os.path.exists(context_file):
+        raise RuntimeError(
+            f"session creation did not produce '{context_file}'; "
+            "check that the QNN EP compiled the model (see session log for fallback nodes)"
+        )
+
+    return {"bucket": bucket, "input_shapes": input_shapes, "context_model": os.path.basename(context_file)}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("model", help="path to the ONNX model")
+    parser.add_argument("--output_dir", required=True, help="directory receiving the context models and manifest")
+    parser.add_argument(
+        "--bucket",
+        action="append",
+        type=parse_bucket,
+        default=[],
+        help="shape bucket as name=value pairs, e.g. batch=1,seq=128; repeat per bucket. "
+        "Omit for a model that is already static.",
+    )
+    parser.add_argument(
+        "--provider_option",
+        action="append",
+        default=[],
+        help="QNN EP provider option as key=value, e.g. backend_path=libQnnHtp.so; repeatable",
+    )
+    parser.add_argument(
+        "--no_embed",
+        action="store_true",
+        help="write each context binary to a separate file next to its context model "
+        "instead of embedding it",
+    )
+    args = parser.parse_args()
+
+    if "QNNExecutionProvider" not in onnxruntime.get_available_providers():
+        print("error: this onnxruntime build does not include the QNN execution provider", file=sys.stderr)
+        return 1
+
+    provider_options = dict(option.partition("=")[::2] for option in args.provider_option)
+    buckets = args.bucket if args.bucket else [{}]
+
+    os.makedirs(args.output_dir, exist_ok=True)
+
+    entries = []
+    for bucket in buckets:
+        entry = generate_context_model(args.model, bucket, args.output_dir, provider_options, not args.no_embed)
+        entries.append(entry)
+        print(f"generated {entry['context_model']} for bucket {bucket or '<static>'}")
+
+    manifest = {
+        "model": os.path.basename(args.model),
+        "onnxruntime_version": onnxruntime.__version__,
+        "provider_options": provider_options,
+        "contexts": entries,
+    }
+    manifest_path = os.path.join(args.output_dir, "qnn_context_manifest.json")
+    with open(manifest_path, "w") as manifest_file:
+        json.dump(manifest, manifest_file, indent=2)
+        manifest_file.write("\n")
+    print(f"wrote {manifest_path} ({len(entries)} context model(s))")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -35,5 +35,23 @@ TEST(DenormalTest, DenormalAsZeroTest) {
   test_denormal(false);
 }
 
+TEST(DenormalTest, ScopedDenormalAsZeroTest) {
+  constexpr float denormal_float = 1e-38f;
+  volatile float input_float = denormal_float;
+
+  // start with denormals untouched. if the platform has no denormal control there is nothing to validate.
+  if (!SetDenormalAsZero(false)) {
+    return;
+  }
+
+  {
+    ScopedDenormalAsZero scope(true);
+    EXPECT_EQ(input_float * 2, 0.0f);
+  }
+
+  // previous mode is restored when the scope ends
+  EXPECT_EQ(input_float * 2, denormal_float * 2);
+}
+
 }  // namespace test
 }  // namespace onnxruntime
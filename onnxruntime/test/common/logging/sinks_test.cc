@@ -7,6 +7,9 @@
 #include "core/common/logging/sinks/clog_sink.h"
 #include "core/common/logging/sinks/composite_sink.h"
 #include "core/common/logging/sinks/file_sink.h"
+#include "core/common/logging/sinks/ring_buffer_sink.h"
+
+#include <thread>
 
 #include "test/common/logging/helpers.h"
 
@@ -222,3 +225,124 @@ TEST(LoggingTests, TestGetRemoveSingleSink) {
   EXPECT_EQ(removed_sink.get(), single_mock_sink);  // Check it's the same sink
   EXPECT_FALSE(sink.HasOnlyOneSink());              // Should be empty now
 }
+
+namespace {
+struct RecordedMessage {
+  std::string logger_id;
+  Severity severity;
+  std::string category;
+  std::string message;
+};
+
+// appends every forwarded record to an externally owned vector. a RingBufferSink forwards
+// from its single drain thread, so no synchronization is needed.
+class RecordingSink : public ISink {
+ public:
+  explicit RecordingSink(std::vector<RecordedMessage>& out) : out_(out) {}
+
+ private:
+  void SendImpl(const Timestamp& /*timestamp*/, const std::string& logger_id,
+                const Capture& message) override {
+    out_.push_back({logger_id, message.Severity(), message.Category(), message.Message()});
+  }
+
+  std::vector<RecordedMessage>& out_;
+};
+}  // namespace
+
+/// <summary>
+/// Tests that the ring buffer sink forwards all buffered records to the wrapped sink,
+/// in order, before its destructor completes.
+/// </summary>
+TEST(LoggingTests, TestRingBufferSinkForwardsInOrder) {
+  std::vector<RecordedMessage> records;
+
+  {
+    RingBufferSink sink{std::make_unique<RecordingSink>(records), 16};
+
+    for (int i = 0; i < 10; ++i) {
+      Capture capture{Severity::kINFO, Category::onnxruntime, DataType::SYSTEM, ORT_WHERE};
+      capture.Stream() << "ring message " << i;
+      sink.Send(std::chrono::system_clock::now(), "RingBufferSink", capture);
+    }
+  }
+
+  ASSERT_EQ(records.size(), 10u);
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_EQ(records[i].logger_id, "RingBufferSink");
+    EXPECT_EQ(records[i].severity, Severity::kINFO);
+    EXPECT_EQ(records[i].message, "ring message " + std::to_string(i));
+  }
+}
+
+/// <summary>
+/// Tests that an overfull ring drops records instead of blocking, and that the drop is
+/// reported through the wrapped sink.
+/// </summary>
+TEST(LoggingTests, TestRingBufferSinkDropsWhenFull) {
+  std::vector<RecordedMessage> records;
+
+  {
+    // a poll interval much longer than the test keeps the drain thread asleep while we
+    // overfill the ring; give it time to enter its wait first
+    RingBufferSink sink{std::make_unique<RecordingSink>(records), 4, std::chrono::milliseconds{60000}};
+    std::this_thread::sleep_for(std::chrono::milliseconds{100});
+
+    for (int i = 0; i < 10; ++i) {
+      Capture capture{Severity::kINFO, Category::onnxruntime, DataType::SYSTEM, ORT_WHERE};
+      capture.Stream() << "overflow message " << i;
+      sink.Send(std::chrono::system_clock::now(), "RingBufferSink", capture);
+    }
+  }
+
+  // 4 forwarded plus the drop report
+  ASSERT_EQ(records.size(), 5u);
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_EQ(records[i].message, "overflow message " + std::to_string(i));
+  }
+
+  EXPECT_EQ(records.back().severity, Severity::kWARNING);
+  EXPECT_NE(records.back().message.find("dropped 6"), std::string::npos);
+}
+
+/// <summary>
+/// Tests that records from concurrent logging threads all arrive, with each thread's own
+/// records kept in order.
+/// </summary>
+TEST(LoggingTests, TestRingBufferSinkMultipleThreads) {
+  constexpr int kThreads = 4;
+  constexpr int kMessagesPerThread = 100;
+
+  std::vector<RecordedMessage> records;
+
+  {
+    RingBufferSink sink{std::make_unique<RecordingSink>(records), 1024};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+      threads.emplace_back([&sink, t]() {
+        for (int i = 0; i < kMessagesPerThread; ++i) {
+          Capture capture{Severity::kINFO, Category::onnxruntime, DataType::SYSTEM, ORT_WHERE};
+          capture.Stream() << t << ":" << i;
+          sink.Send(std::chrono::system_clock::now(), "RingBufferSink", capture);
+        }
+      });
+    }
+
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+
+  ASSERT_EQ(records.size(), static_cast<size_t>(kThreads * kMessagesPerThread));
+
+  // per-thread order must be preserved even though threads interleave
+  std::vector<int> next_expected(kThreads, 0);
+  for (const auto& record : records) {
+    const auto sep = record.message.find(':');
+    ASSERT_NE(sep, std::string::npos);
+    const int thread_id = std::stoi(record.message.substr(0, sep));
+    const int sequence = std::stoi(record.message.substr(sep + 1));
+    EXPECT_EQ(sequence, next_expected[thread_id]++);
+  }
+}
@@ -41,5 +41,36 @@ TEST(Utf8UtilTest, Validate) {
   }
 }
 
+// Exercise the word-at-a-time ASCII fast path with runs longer than a word and
+// with multi-byte characters at all alignments within a word.
+TEST(Utf8UtilTest, AsciiFastPath) {
+  using namespace utf8_util;
+
+  const std::string long_ascii(100, 'a');
+  size_t utf8_chars = 0;
+  ASSERT_TRUE(utf8_validate(reinterpret_cast<const unsigned char*>(long_ascii.data()), long_ascii.size(), utf8_chars));
+  ASSERT_EQ(long_ascii.size(), utf8_chars);
+
+  for (size_t prefix = 0; prefix < 9; ++prefix) {
+    // <prefix ASCII bytes><2-byte char><long ASCII run><3-byte char>
+    std::string s(prefix, 'a');
+    s += "\xc3\xb1";
+    s.append(20, 'b');
+    s += "\xe2\x82\xa1";
+
+    size_t len = 0;
+    ASSERT_TRUE(utf8_validate(reinterpret_cast<const unsigned char*>(s.data()), s.size(), len));
+    ASSERT_EQ(prefix + 22, len);
+
+    len = 0;
+    ASSERT_TRUE(utf8_len(reinterpret_cast<const unsigned char*>(s.data()), s.size(), len));
+    ASSERT_EQ(prefix + 22, len);
+
+    // truncating the trailing character must still be rejected
+    size_t ignored = 0;
+    ASSERT_FALSE(utf8_validate(reinterpret_cast<const unsigned char*>(s.data()), s.size() - 1, ignored));
+  }
+}
+
 }  // namespace test
 }  // namespace onnxruntime
@@ -850,7 +850,7 @@ void RawAttentionEmptyPastState(bool past_present_share_buffer) {
     RunAttentionTest(input_data, weight_data, bias_data, mask_index_data, output_data,
                      batch_size, sequence_length, hidden_size, number_of_heads, false, is_unidirectional,
                      use_past_state, past_sequence_length, &past_data, &present_data,
-                     AttentionMaskType::MASK_1D_KEY_SEQ_LEN, 0, sequence_length, true, false, true, disable_dml, {}, {}, 0,
+                     AttentionMaskType::MASK_1D_KEY_SEQ_LEN, 0, sequence_length, false, false, true, disable_dml, {}, {}, 0,
                      true);
   }
 }
@@ -1033,7 +1033,7 @@ void RawAttentionPastStateBatch1(bool past_present_share_buffer) {
                      batch_size, sequence_length, hidden_size, number_of_heads, false, is_unidirectional,
                      use_past_state, past_sequence_length, &past_data, &present_data,
                      AttentionMaskType::MASK_1D_KEY_SEQ_LEN, 0, past_sequence_length + sequence_length + 4,
-                     true, false, true, disable_dml, {}, {}, 0, true);
+                     false, false, true, disable_dml, {}, {}, 0, true);
   }
 }
 
@@ -1166,7 +1166,7 @@ void RawAttentionPastStateBatch2(bool past_present_share_buffer) {
                      batch_size, sequence_length, hidden_size, number_of_heads, false, is_unidirectional,
                      use_past_state, past_sequence_length, &past_data, &present_data,
                      AttentionMaskType::MASK_1D_KEY_SEQ_LEN, 0, past_sequence_length + sequence_length,
-                     true, false, true, disable_dml, {}, {}, 0, true);
+                     false, false, true, disable_dml, {}, {}, 0, true);
   }
 }
 
@@ -1291,7 +1291,7 @@ void RawAttentionPastStateBatch2WithPadding(bool past_present_share_buffer) {
                      use_past_state, past_sequence_length, &past_data, &present_data,
                      AttentionMaskType::MASK_1D_END_START,
                      0, past_sequence_length + sequence_length + 4,
-                     true, false, true, disable_dml, {}, {}, 0, true);
+                     false, false, true, disable_dml, {}, {}, 0, true);
   }
 }
 
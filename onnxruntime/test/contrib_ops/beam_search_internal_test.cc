@@ -0,0 +1,128 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <algorithm>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include <gsl/gsl>
+
+#include "contrib_ops/cpu/transformers/beam_search_scorer.h"
+#include "contrib_ops/cpu/transformers/sequences.h"
+
+namespace onnxruntime {
+namespace test {
+
+using contrib::transformers::BeamHypotheses;
+using contrib::transformers::HypothesisScore;
+using contrib::transformers::Sequences;
+
+namespace {
+
+// Reference implementation of the reorder+append step: physically copy the selected source row
+// and append the token, the way Sequences worked before back pointer bookkeeping.
+void ReferenceAppend(std::vector<std::vector<int32_t>>& rows,
+                     gsl::span<const int32_t> beam_indices,
+                     gsl::span<const int32_t> beam_next_tokens) {
+  std::vector<std::vector<int32_t>> next(rows.size());
+  for (size_t i = 0; i < rows.size(); ++i) {
+    next[i] = rows[beam_indices[i]];
+    next[i].push_back(beam_next_tokens[i]);
+  }
+  rows = std::move(next);
+}
+
+}  // namespace
+
+TEST(BeamSearchInternalTest, SequencesBackPointerReorderMatchesCopying) {
+  constexpr int batch_beam_size = 4;
+  constexpr int sequence_length = 2;
+  constexpr int max_length = 8;
+
+  std::vector<int32_t> sequences_space(2 * batch_beam_size * max_length, 0);
+  Sequences sequences;
+  sequences.Init(sequences_space, batch_beam_size, sequence_length, max_length);
+
+  std::vector<int32_t> back_pointers(2 * batch_beam_size * (max_length - sequence_length), 0);
+  sequences.InitBackPointers(back_pointers);
+
+  // All beams of the batch share the same prompt, as after input expansion.
+  std::vector<std::vector<int32_t>> reference(batch_beam_size, {1, 2});
+  for (int i = 0; i < batch_beam_size; ++i) {
+    for (int j = 0; j < sequence_length; ++j) {
+      sequences_space[i * max_length + j] = reference[i][j];
+    }
+  }
+
+  const std::vector<std::vector<int32_t>> step_indices{{0, 0, 1, 3}, {2, 0, 3, 1}, {1, 1, 0, 2}};
+  const std::vector<std::vector<int32_t>> step_tokens{{5, 6, 7, 8}, {9, 10, 11, 12}, {13, 14, 15, 16}};
+
+  for (size_t step = 0; step < step_indices.size(); ++step) {
+    std::vector<int32_t> indices = step_indices[step];
+    std::vector<int32_t> tokens = step_tokens[step];
+    gsl::span<int32_t> indices_span = indices;
+    gsl::span<int32_t> tokens_span = tokens;
+    sequences.AppendNextTokenToSequences(indices_span, tokens_span);
+    ReferenceAppend(reference, indices, tokens);
+
+    // Read an arbitrary subset each step so some rows are materialized from a stale cache later.
+    gsl::span<const int32_t> probe = sequences.GetSequence(static_cast<int>(step) % batch_beam_size);
+    ASSERT_EQ(probe.size(), reference[step % batch_beam_size].size());
+  }
+
+  ASSERT_EQ(sequences.GetSequenceLength(), sequence_length + static_cast<int>(step_indices.size()));
+  for (int i = 0; i < batch_beam_size; ++i) {
+    gsl::span<const int32_t> actual = sequences.GetSequence(i);
+    ASSERT_EQ(actual.size(), reference[i].size()) << "row " << i;
+    for (size_t j = 0; j < reference[i].size(); ++j) {
+      EXPECT_EQ(actual[j], reference[i][j]) << "row " << i << " position " << j;
+    }
+  }
+}
+
+TEST(BeamSearchInternalTest, BeamHypothesesPoolSlotReuse) {
+  constexpr int num_beams = 2;
+  constexpr int max_length = 4;
+
+  std::vector<HypothesisScore> beams(num_beams);
+  std::vector<int32_t> pool(num_beams * max_length, -1);
+
+  BeamHypotheses hypotheses;
+  hypotheses.Init(1.0f /*length_penalty*/, beams, pool);
+
+  std::vector<int32_t> first{1, 2};
+  std::vector<int32_t> second{3, 4, 5};
+  gsl::span<const int32_t> first_span = first;
+  gsl::span<const int32_t> second_span = second;
+  hypotheses.Add(first_span, 2.0f);   // score 1.0
+  hypotheses.Add(second_span, 1.5f);  // score 0.5
+  ASSERT_EQ(hypotheses.beams_used_, num_beams);
+
+  // A better hypothesis evicts the worst and takes over its pool slot.
+  std::vector<int32_t> better{6, 7};
+  gsl::span<const int32_t> better_span = better;
+  hypotheses.Add(better_span, 4.0f);  // score 2.0
+  ASSERT_EQ(hypotheses.beams_used_, num_beams);
+  EXPECT_EQ(hypotheses.beams_[0].score, 2.0f);
+  EXPECT_EQ(hypotheses.beams_[1].score, 1.0f);
+
+  // All kept hypotheses live inside the pool, not in the caller's buffers.
+  for (int i = 0; i < num_beams; ++i) {
+    const auto& kept = hypotheses.beams_[i].hypothesis;
+    EXPECT_GE(kept.data(), pool.data());
+    EXPECT_LE(kept.data() + kept.size(), pool.data() + pool.size());
+  }
+  EXPECT_EQ(hypotheses.beams_[0].hypothesis[0], 6);
+  EXPECT_EQ(hypotheses.beams_[0].hypothesis[1], 7);
+  EXPECT_EQ(hypotheses.beams_[1].hypothesis[0], 1);
+
+  // A worse candidate is rejected and does not disturb the pool.
+  std::vector<int32_t> worse{9};
+  gsl::span<const int32_t> worse_span = worse;
+  hypotheses.Add(worse_span, 0.1f);
+  ASSERT_EQ(hypotheses.beams_used_, num_beams);
+  EXPECT_EQ(hypotheses.beams_[0].hypothesis[0], 6);
+}
+
+}  // namespace test
+}  // namespace onnxruntime
@@ -0,0 +1,88 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "test/providers/provider_test_utils.h"
+
+namespace onnxruntime {
+namespace test {
+
+// 2-D bags: output[b, :] sums the table rows named by indices[b, :]. Negative indices
+// count back from the end of the table as in Gather.
+TEST(EmbeddingBagOpTest, SumInt64Indices) {
+  OpTester test("EmbeddingBag", 1, onnxruntime::kMSDomain);
+  test.AddAttribute("mode", "sum");
+
+  test.AddInput<float>("weight", {4, 3},
+                       {0.f, 1.f, 2.f,
+                        10.f, 11.f, 12.f,
+                        20.f, 21.f, 22.f,
+                        30.f, 31.f, 32.f});
+  test.AddInput<int64_t>("indices", {2, 2},
+                         {0, 2,
+                          3, -3});
+  test.AddOutput<float>("output", {2, 3},
+                        {20.f, 22.f, 24.f,
+                         40.f, 42.f, 44.f});
+  test.Run();
+}
+
+TEST(EmbeddingBagOpTest, MeanInt32Indices) {
+  OpTester test("EmbeddingBag", 1, onnxruntime::kMSDomain);
+  test.AddAttribute("mode", "mean");
+
+  test.AddInput<float>("weight", {3, 2},
+                       {1.f, 2.f,
+                        3.f, 4.f,
+                        5.f, 6.f});
+  test.AddInput<int32_t>("indices", {2, 2},
+                         {0, 2,
+                          1, 1});
+  test.AddOutput<float>("output", {2, 2},
+                        {3.f, 4.f,
+                         3.f, 4.f});
+  test.Run();
+}
+
+// 1-D indices pool the whole lookup into a single row; bags longer than the kernel's
+// prefetch distance exercise the look-ahead path.
+TEST(EmbeddingBagOpTest, SingleBagLongerThanPrefetch) {
+  OpTester test("EmbeddingBag", 1, onnxruntime::kMSDomain);
+  test.AddAttribute("mode", "sum");
+
+  constexpr int64_t num_rows = 16;
+  constexpr int64_t dim = 4;
+  constexpr int64_t bag_size = 12;
+  std::vector<float> weight(num_rows * dim);
+  for (size_t i = 0; i < weight.size(); ++i) {
+    weight[i] = static_cast<float>(i);
+  }
+  std::vector<int64_t> indices(bag_size);
+  std::vector<float> expected(dim, 0.f);
+  for (int64_t i = 0; i < bag_size; ++i) {
+    indices[i] = (i * 5) % num_rows;
+    for (int64_t j = 0; j < dim; ++j) {
+      expected[j] += weight[indices[i] * dim + j];
+    }
+  }
+
+  test.AddInput<float>("weight", {num_rows, dim}, weight);
+  test.AddInput<int64_t>("indices", {bag_size}, indices);
+  test.AddOutput<float>("output", {dim}, expected);
+  test.Run();
+}
+
+TEST(EmbeddingBagOpTest, IndexOutOfBounds) {
+  OpTester test("EmbeddingBag", 1, onnxruntime::kMSDomain);
+  test.AddAttribute("mode", "sum");
+
+  test.AddInput<float>("weight", {2, 2}, {1.f, 2.f, 3.f, 4.f});
+  test.AddInput<int64_t>("indices", {2}, {0, 2});
+  test.AddOutput<float>("output", {2}, {0.f, 0.f});
+  test.Run(OpTester::ExpectResult::kExpectFailure, "indices element out of data bounds");
+}
+
+}  // namespace test
+}  // namespace onnxruntime
@@ -0,0 +1,73 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <cmath>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "test/providers/provider_test_utils.h"
+
+namespace onnxruntime {
+namespace test {
+
+// Chain with binary steps on both sides of the operand: ((1.5 + x) * 2 -> Sigmoid -> 3 - x).
+// The input is longer than the kernel's internal block size so the test crosses block
+// boundaries.
+TEST(FusedElementwiseOpTest, ScalarBinaryAndSigmoidChain) {
+  OpTester test("FusedElementwise", 1, onnxruntime::kMSDomain);
+  test.AddAttribute("steps", std::vector<std::string>{"Add", "Mul", "Sigmoid", "Sub"});
+  test.AddAttribute("scalars", std::vector<float>{1.5f, 2.0f, 0.0f, 3.0f});
+  test.AddAttribute("scalar_first", std::vector<int64_t>{0, 0, 0, 1});
+
+  constexpr int64_t num_elements = 8200;
+  std::vector<float> input(num_elements);
+  std::vector<float> expected(num_elements);
+  for (int64_t i = 0; i < num_elements; ++i) {
+    const float x = static_cast<float>(i % 37) * 0.25f - 4.f;
+    input[i] = x;
+    const float sigmoid_in = (x + 1.5f) * 2.0f;
+    expected[i] = 3.0f - 1.0f / (1.0f + std::exp(-sigmoid_in));
+  }
+
+  test.AddInput<float>("X", {num_elements}, input);
+  test.AddOutput<float>("Y", {num_elements}, expected);
+  test.Run();
+}
+
+TEST(FusedElementwiseOpTest, UnaryChain) {
+  OpTester test("FusedElementwise", 1, onnxruntime::kMSDomain);
+  test.AddAttribute("steps", std::vector<std::string>{"Neg", "Relu", "Sqrt", "Tanh"});
+  test.AddAttribute("scalars", std::vector<float>{0.0f, 0.0f, 0.0f, 0.0f});
+  test.AddAttribute("scalar_first", std::vector<int64_t>{0, 0, 0, 0});
+
+  std::vector<float> input{-4.0f, -1.0f, -0.25f, 0.0f, 0.5f, 2.0f};
+  std::vector<float> expected(input.size());
+  for (size_t i = 0; i < input.size(); ++i) {
+    const float relu_out = std::max(0.f, -input[i]);
+    expected[i] = std::tanh(std::sqrt(relu_out));
+  }
+
+  test.AddInput<float>("X", {2, 3}, input);
+  test.AddOutput<float>("Y", {2, 3}, expected);
+  test.Run();
+}
+
+TEST(FusedElementwiseOpTest, DivAndAbsAndExp) {
+  OpTester test("FusedElementwise", 1, onnxruntime::kMSDomain);
+  test.AddAttribute("steps", std::vector<std::string>{"Abs", "Div", "Exp"});
+  test.AddAttribute("scalars", std::vector<float>{0.0f, 4.0f, 0.0f});
+  test.AddAttribute("scalar_first", std::vector<int64_t>{0, 0, 0});
+
+  std::vector<float> input{-2.0f, -1.0f, 0.0f, 1.0f, 3.0f, -8.0f};
+  std::vector<float> expected(input.size());
+  for (size_t i = 0; i < input.size(); ++i) {
+    expected[i] = std::exp(std::fabs(input[i]) / 4.0f);
+  }
+
+  test.AddInput<float>("X", {6}, input);
+  test.AddOutput<float>("Y", {6}, expected);
+  test.Run();
+}
+
+}  // namespace test
+}  // namespace onnxruntime
@@ -0,0 +1,41 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <limits>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "test/providers/provider_test_utils.h"
+
+namespace onnxruntime {
+namespace test {
+
+TEST(FusedImputerScalerOpTest, PerFeatureAttributes) {
+  OpTester test("FusedImputerScaler", 1, onnxruntime::kMSDomain);
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+  test.AddAttribute("imputed_value_floats", std::vector<float>{10.f, 20.f, 30.f});
+  test.AddAttribute("replaced_value_float", nan);
+  test.AddAttribute("scale", std::vector<float>{2.f, 0.5f, 1.f});
+  test.AddAttribute("offset", std::vector<float>{1.f, 2.f, 3.f});
+
+  // NaNs are imputed per feature before the scaler formula y = (x - offset) * scale is applied.
+  test.AddInput<float>("X", {2, 3}, {nan, 4.f, 5.f, 0.f, nan, nan});
+  test.AddOutput<float>("Y", {2, 3}, {(10.f - 1.f) * 2.f, (4.f - 2.f) * 0.5f, (5.f - 3.f) * 1.f,
+                                      (0.f - 1.f) * 2.f, (20.f - 2.f) * 0.5f, (30.f - 3.f) * 1.f});
+  test.Run();
+}
+
+TEST(FusedImputerScalerOpTest, SharedAttributes) {
+  OpTester test("FusedImputerScaler", 1, onnxruntime::kMSDomain);
+  test.AddAttribute("imputed_value_floats", std::vector<float>{5.f});
+  test.AddAttribute("replaced_value_float", -1.f);
+  test.AddAttribute("scale", std::vector<float>{3.f});
+  test.AddAttribute("offset", std::vector<float>{1.f});
+
+  test.AddInput<float>("X", {4}, {-1.f, 0.f, 2.f, -1.f});
+  test.AddOutput<float>("Y", {4}, {12.f, -3.f, 3.f, 12.f});
+  test.Run();
+}
+
+}  // namespace test
+}  // namespace onnxruntime
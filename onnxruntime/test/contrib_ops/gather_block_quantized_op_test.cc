@@ -122,8 +122,6 @@ void Test_Fail_WithZeroPoints(int64_t gather_axis,
 }
 
 TEST(GatherBlockQuantizedOpTest, UnsupportedTypes) {
-  Test_Fail_WithZeroPoints<int8_t, float, int32_t>(0, 2, 16);
-  Test_Fail_WithZeroPoints<uint8_t, float, int32_t>(0, 2, 16);
   Test_Fail_WithZeroPoints<int16_t, float, int32_t>(0, 2, 16);
   Test_Fail_WithZeroPoints<uint16_t, float, int32_t>(0, 2, 16);
   Test_Fail_WithZeroPoints<int32_t, float, int32_t>(0, 2, 16);
@@ -287,6 +285,8 @@ TEST(GatherBlockQuantizedOpTest, GatherAxis0WithZeroPoints) {
   Test_GatherAxis0_WithZeroPoints<Int4x2, float, int64_t>();
   Test_GatherAxis0_WithZeroPoints<UInt4x2, MLFloat16, int64_t>();
   Test_GatherAxis0_WithZeroPoints<Int4x2, MLFloat16, int64_t>();
+  Test_GatherAxis0_WithZeroPoints<int8_t, float, int32_t>();
+  Test_GatherAxis0_WithZeroPoints<int8_t, MLFloat16, int64_t>();
 }
 
 template <typename T1, typename T2, typename Tind>
@@ -340,6 +340,57 @@ TEST(GatherBlockQuantizedOpTest, GatherAxis0NoZeroPoints) {
   Test_GatherAxis0_NoZeroPoints<Int4x2, MLFloat16, int32_t>();
   Test_GatherAxis0_NoZeroPoints<Int4x2, float, int64_t>();
   Test_GatherAxis0_NoZeroPoints<Int4x2, MLFloat16, int64_t>();
+  Test_GatherAxis0_NoZeroPoints<int8_t, float, int32_t>();
+  Test_GatherAxis0_NoZeroPoints<int8_t, MLFloat16, int64_t>();
+}
+
+// 8-bit data stores one element per byte. The shapes exercise the contiguous-row fast path
+// (quantize axis innermost), a partial trailing quantization block, a negative index and a
+// repeated index served from the per-thread dequantized-block cache.
+template <typename T1, typename T2, typename Tind>
+void Test_GatherAxis0_8Bit() {
+  std::vector<int> data;
+  for (int i = 0; i < 20; ++i) data.push_back(i);   // row 0
+  for (int i = 0; i < 20; ++i) data.push_back(5);   // row 1
+  for (int i = 1; i <= 20; ++i) data.push_back(i);  // row 2
+  std::vector<int64_t> data_shape = {3, 20};
+  std::vector<int> indices = {2, -3, 2};
+  std::vector<int64_t> indices_shape = {3};
+  std::vector<float> scales = {1.0f, 2.0f,
+                               1.0f, 1.0f,
+                               0.5f, 3.0f};
+  std::vector<int64_t> scales_shape = {3, 2};
+  std::vector<int> zero_points = {0, 1,
+                                  0, 0,
+                                  1, 2};
+  std::vector<float> output = {0.f, 0.5f, 1.f, 1.5f, 2.f, 2.5f, 3.f, 3.5f,
+                               4.f, 4.5f, 5.f, 5.5f, 6.f, 6.5f, 7.f, 7.5f, 45.f, 48.f, 51.f, 54.f,
+                               0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f,
+                               8.f, 9.f, 10.f, 11.f, 12.f, 13.f, 14.f, 15.f, 30.f, 32.f, 34.f, 36.f,
+                               0.f, 0.5f, 1.f, 1.5f, 2.f, 2.5f, 3.f, 3.5f,
+                               4.f, 4.5f, 5.f, 5.5f, 6.f, 6.5f, 7.f, 7.5f, 45.f, 48.f, 51.f, 54.f};
+  std::vector<int64_t> output_shape = {3, 20};
+
+  RunGatherBlockQuantized(ToType<T1>(data),
+                          data_shape,
+                          ToType<Tind>(indices),
+                          indices_shape,
+                          ToType<T2>(scales),
+                          scales_shape,
+                          ToType<T1>(zero_points),
+                          0,
+                          1,
+                          16,
+                          ToType<T2>(output),
+                          output_shape,
+                          OpTester::ExpectResult::kExpectSuccess);
+}
+
+TEST(GatherBlockQuantizedOpTest, GatherAxis0Quantize8Bit) {
+  Test_GatherAxis0_8Bit<int8_t, float, int32_t>();
+  Test_GatherAxis0_8Bit<uint8_t, float, int32_t>();
+  Test_GatherAxis0_8Bit<int8_t, MLFloat16, int64_t>();
+  Test_GatherAxis0_8Bit<uint8_t, MLFloat16, int64_t>();
 }
 
 template <typename T1, typename T2, typename Tind>
@@ -401,6 +452,8 @@ TEST(GatherBlockQuantizedOpTest, GatherAxis1) {
   Test_GatherAxis1_WithZeroPoints<Int4x2, float, int64_t>();
   Test_GatherAxis1_WithZeroPoints<UInt4x2, MLFloat16, int64_t>();
   Test_GatherAxis1_WithZeroPoints<Int4x2, MLFloat16, int64_t>();
+  Test_GatherAxis1_WithZeroPoints<int8_t, float, int32_t>();
+  Test_GatherAxis1_WithZeroPoints<int8_t, MLFloat16, int64_t>();
 }
 
 template <typename T1, typename T2, typename Tind>
@@ -462,6 +515,8 @@ TEST(GatherBlockQuantizedOpTest, GatherAxis2) {
   Test_GatherAxis2_WithZeroPoints<Int4x2, float, int64_t>();
   Test_GatherAxis2_WithZeroPoints<UInt4x2, MLFloat16, int64_t>();
   Test_GatherAxis2_WithZeroPoints<Int4x2, MLFloat16, int64_t>();
+  Test_GatherAxis2_WithZeroPoints<int8_t, float, int32_t>();
+  Test_GatherAxis2_WithZeroPoints<int8_t, MLFloat16, int64_t>();
 }
 
 }  // namespace test
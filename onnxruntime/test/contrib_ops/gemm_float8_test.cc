@@ -122,5 +122,72 @@ TEST(GemmFloat8OpTest, Float8E4M3FNToFloat8E4M3FN) {
 
 #endif
 
+// The CPU kernel widens a float 8 B to float and runs the regular SGEMM, with scaleB
+// folded into alpha. It is registered in every build, with float 8 inputs available
+// only when the types are enabled.
+
+TEST(GemmFloat8OpTest, FloatCpu) {
+  OpTester test("GemmFloat8", 1, onnxruntime::kMSDomain);
+  test.AddAttribute("transA", (int64_t)0);
+  test.AddAttribute("transB", (int64_t)0);
+  test.AddAttribute("alpha", 1.0f);
+  test.AddAttribute("beta", 1.0f);
+  test.AddAttribute("activation", "NONE");
+  test.AddAttribute("dtype", static_cast<int64_t>(ONNX_NAMESPACE::TensorProto_DataType_FLOAT));
+  test.AddInput<float>("A", {2, 4}, std::vector<float>({1.0f, 2.0f, 3.0f, 4.0f, -1.0f, -2.0f, -3.0f, -4.0f}));
+  test.AddInput<float>("B", {4, 3}, std::vector<float>({1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f}));
+  test.AddInput<float>("C", {2, 3}, std::vector<float>({1.f, 1.f, 1.f, 1.f, 1.f, 1.f}));
+  test.AddOutput<float>("Y", {2, 3}, std::vector<float>({11.0f, 11.0f, 11.0f, -9.0f, -9.0f, -9.0f}));
+  std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
+  execution_providers.push_back(DefaultCpuExecutionProvider());
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {}, nullptr, &execution_providers);
+}
+
+#if !defined(DISABLE_FLOAT8_TYPES)
+
+static std::vector<Float8E4M3FN> _CvtFp8(const std::vector<float>& tensor) {
+  std::vector<Float8E4M3FN> out(tensor.size());
+  for (size_t i = 0; i < tensor.size(); ++i) {
+    out[i] = Float8E4M3FN(tensor[i]);
+  }
+  return out;
+}
+
+// All weight values are exactly representable in E4M3, so the expected output is exact.
+static void TestGemmFloat8WeightsCpu(bool constant_weights) {
+  OpTester test("GemmFloat8", 1, onnxruntime::kMSDomain);
+  test.AddAttribute("transA", (int64_t)0);
+  test.AddAttribute("transB", (int64_t)1);
+  test.AddAttribute("alpha", 1.0f);
+  test.AddAttribute("beta", 1.0f);
+  test.AddAttribute("activation", "NONE");
+  test.AddAttribute("dtype", static_cast<int64_t>(ONNX_NAMESPACE::TensorProto_DataType_FLOAT));
+  test.AddInput<float>("A", {2, 4}, std::vector<float>({1.0f, 2.0f, 3.0f, 4.0f, -1.0f, -2.0f, -3.0f, -4.0f}));
+  test.AddInput<Float8E4M3FN>("B", {3, 4},
+                              _CvtFp8(std::vector<float>({1.f, 1.f, 1.f, 1.f,
+                                                          0.5f, 0.5f, 0.5f, 0.5f,
+                                                          1.f, -1.f, 1.f, -1.f})),
+                              constant_weights);
+  test.AddInput<float>("C", {2, 3}, std::vector<float>({1.f, 1.f, 1.f, 1.f, 1.f, 1.f}));
+  test.AddOptionalInputEdge<float>();  // scaleA
+  test.AddInput<float>("scaleB", {}, std::vector<float>({2.0f}), true);
+  test.AddOutput<float>("Y", {2, 3}, std::vector<float>({21.0f, 11.0f, -3.0f, -19.0f, -9.0f, 5.0f}));
+  std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
+  execution_providers.push_back(DefaultCpuExecutionProvider());
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {}, nullptr, &execution_providers);
+}
+
+// constant B exercises the pre-packed (widen once) path
+TEST(GemmFloat8OpTest, Float8E4M3FNWeightsCpuPrePacked) {
+  TestGemmFloat8WeightsCpu(true);
+}
+
+// non-constant B exercises the per-run widening path
+TEST(GemmFloat8OpTest, Float8E4M3FNWeightsCpu) {
+  TestGemmFloat8WeightsCpu(false);
+}
+
+#endif
+
 }  // namespace test
 }  // namespace onnxruntime
@@ -0,0 +1,79 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "test/providers/provider_test_utils.h"
+
+namespace onnxruntime {
+namespace test {
+
+// Top-k of each MatMul output row, without materializing the product.
+TEST(GemmTopKOpTest, Largest) {
+  OpTester test("GemmTopK", 1, onnxruntime::kMSDomain);
+  test.AddAttribute<int64_t>("k", 2);
+
+  // A is a permuted identity so each output row is a row of B.
+  test.AddInput<float>("A", {2, 2},
+                       {1.f, 0.f,
+                        0.f, 1.f});
+  test.AddInput<float>("B", {2, 4},
+                       {0.1f, 0.4f, 0.2f, 0.3f,
+                        1.0f, -1.0f, 0.5f, 2.0f});
+  test.AddOutput<float>("Values", {2, 2},
+                        {0.4f, 0.3f,
+                         2.0f, 1.0f});
+  test.AddOutput<int64_t>("Indices", {2, 2},
+                          {1, 3,
+                           3, 0});
+  test.Run();
+}
+
+TEST(GemmTopKOpTest, Smallest) {
+  OpTester test("GemmTopK", 1, onnxruntime::kMSDomain);
+  test.AddAttribute<int64_t>("k", 2);
+  test.AddAttribute<int64_t>("largest", 0);
+
+  test.AddInput<float>("A", {2, 2},
+                       {1.f, 0.f,
+                        0.f, 1.f});
+  test.AddInput<float>("B", {2, 4},
+                       {0.1f, 0.4f, 0.2f, 0.3f,
+                        1.0f, -1.0f, 0.5f, 2.0f});
+  test.AddOutput<float>("Values", {2, 2},
+                        {0.1f, 0.2f,
+                         -1.0f, 0.5f});
+  test.AddOutput<int64_t>("Indices", {2, 2},
+                          {0, 2,
+                           1, 2});
+  test.Run();
+}
+
+// N spans several 512-column tiles and the best value of the second row repeats across
+// tiles, exercising the cross-tile merge and the lower-index tie break.
+TEST(GemmTopKOpTest, CrossesTilesWithTies) {
+  constexpr int64_t kN = 1200;
+  std::vector<float> b(kN);
+  for (int64_t j = 0; j < kN; ++j) {
+    b[j] = static_cast<float>(j % 997);
+  }
+
+  OpTester test("GemmTopK", 1, onnxruntime::kMSDomain);
+  test.AddAttribute<int64_t>("k", 2);
+
+  test.AddInput<float>("A", {2, 1}, {1.f, -1.f});
+  test.AddInput<float>("B", {1, kN}, b);
+  // Row 0 sees b as is; row 1 sees it negated, whose maximum 0 occurs at both
+  // column 0 and column 997.
+  test.AddOutput<float>("Values", {2, 2},
+                        {996.f, 995.f,
+                         0.f, 0.f});
+  test.AddOutput<int64_t>("Indices", {2, 2},
+                          {996, 995,
+                           0, 997});
+  test.Run();
+}
+
+}  // namespace test
+}  // namespace onnxruntime
@@ -832,5 +832,69 @@ TEST(GroupNormTest, GroupNorm_128) {
   }
 }
 
+// Small hand-computed cases covering the CPU kernel in both layouts and with the SiLU epilogue.
+TEST(GroupNormTest, GroupNorm_CPU) {
+  // one channel per group: channel 0 = [1, 3], channel 1 = [2, 6]
+  const std::vector<float> input_data_nchw{1.f, 3.f, 2.f, 6.f};
+  const std::vector<float> input_data_nhwc{1.f, 2.f, 3.f, 6.f};
+  const std::vector<float> gamma_data{2.f, 0.5f};
+  const std::vector<float> beta_data{1.f, -1.f};
+
+  const std::vector<float> expected_nchw{-1.f, 3.f, -1.5f, -0.5f};
+  const std::vector<float> expected_nhwc{-1.f, -1.5f, 3.f, -0.5f};
+  const std::vector<float> expected_silu_nchw{-0.268941f, 2.857722f, -0.273640f, -0.188770f};
+
+  constexpr float rel_error = 0.0f;
+  constexpr float abs_error = 1e-4f;
+
+  {
+    OpTester test("GroupNorm", 1, kMSDomain);
+    test.AddAttribute<float>("epsilon", 1e-7f);
+    test.AddAttribute<int64_t>("groups", 2);
+    test.AddAttribute<int64_t>("activation", 0);
+    test.AddAttribute<int64_t>("channels_last", 0);
+    test.AddInput<float>("X", {1, 2, 1, 2}, input_data_nchw);
+    test.AddInput<float>("gamma", {2}, gamma_data);
+    test.AddInput<float>("beta", {2}, beta_data);
+    test.AddOutput<float>("Y", {1, 2, 1, 2}, expected_nchw, false, rel_error, abs_error);
+
+    std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
+    execution_providers.push_back(DefaultCpuExecutionProvider());
+    test.Run(OpTester::ExpectResult::kExpectSuccess, "", {}, nullptr, &execution_providers);
+  }
+
+  {
+    OpTester test("GroupNorm", 1, kMSDomain);
+    test.AddAttribute<float>("epsilon", 1e-7f);
+    test.AddAttribute<int64_t>("groups", 2);
+    test.AddAttribute<int64_t>("activation", 0);
+    test.AddAttribute<int64_t>("channels_last", 1);
+    test.AddInput<float>("X", {1, 1, 2, 2}, input_data_nhwc);
+    test.AddInput<float>("gamma", {2}, gamma_data);
+    test.AddInput<float>("beta", {2}, beta_data);
+    test.AddOutput<float>("Y", {1, 1, 2, 2}, expected_nhwc, false, rel_error, abs_error);
+
+    std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
+    execution_providers.push_back(DefaultCpuExecutionProvider());
+    test.Run(OpTester::ExpectResult::kExpectSuccess, "", {}, nullptr, &execution_providers);
+  }
+
+  {
+    OpTester test("GroupNorm", 1, kMSDomain);
+    test.AddAttribute<float>("epsilon", 1e-7f);
+    test.AddAttribute<int64_t>("groups", 2);
+    test.AddAttribute<int64_t>("activation", 1);
+    test.AddAttribute<int64_t>("channels_last", 0);
+    test.AddInput<float>("X", {1, 2, 1, 2}, input_data_nchw);
+    test.AddInput<float>("gamma", {2}, gamma_data);
+    test.AddInput<float>("beta", {2}, beta_data);
+    test.AddOutput<float>("Y", {1, 2, 1, 2}, expected_silu_nchw, false, rel_error, abs_error);
+
+    std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
+    execution_providers.push_back(DefaultCpuExecutionProvider());
+    test.Run(OpTester::ExpectResult::kExpectSuccess, "", {}, nullptr, &execution_providers);
+  }
+}
+
 }  // namespace test
 }  // namespace onnxruntime
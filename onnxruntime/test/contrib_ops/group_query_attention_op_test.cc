@@ -0,0 +1,1439 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "gtest/gtest.h"
+#include "core/graph/model.h"
+#include "core/session/inference_session.h"
+#include "test/common/tensor_op_test_utils.h"
+#include "test/common/cuda_op_test_utils.h"
+#include "test/framework/test_utils.h"
+#include "test/providers/provider_test_utils.h"
+#include "test/test_environment.h"
+#include "test/util/include/asserts.h"
+#include "test/util/include/default_providers.h"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+namespace onnxruntime {
+namespace test {
+
+namespace {
+
+constexpr float kGqaTolerance = 0.002f;
+
+// Describes one GroupQueryAttention call. seqlens_k holds total_sequence_length - 1 per sequence,
+// matching the operator's input contract.
+struct GqaConfig {
+  int batch_size;
+  int sequence_length;
+  int num_heads;
+  int kv_num_heads;
+  int head_size;
+  int total_sequence_length;
+  std::vector<int32_t> seqlens_k;
+  int past_sequence_length = 0;  // cache buffer length; 0 means no past_key/past_value inputs
+  bool do_rotary = false;
+  bool rotary_interleaved = false;
+  int local_window_size = -1;
+  int num_sink_tokens = 0;
+  bool is_ring_kv_cache = false;  // whether the kernel is expected to run the cache as a ring buffer
+};
+
+// Deterministic input data so failures reproduce; values stay in [-1, 1).
+std::vector<float> MakeGqaData(size_t size, size_t salt) {
+  std::vector<float> data(size);
+  for (size_t i = 0; i < size; i++) {
+    data[i] = static_cast<float>((i * 13 + salt * 7 + 5) % 31) / 15.5f - 1.0f;
+  }
+  return data;
+}
+
+// Mirrors the kernel's rotation of one head row at the given position. The tests always use
+// rotary_embedding_dim == head_size (cos/sin caches of width head_size / 2).
+void RotateRowRef(const GqaConfig& c, const float* x, const std::vector<float>& cos_cache,
+                  const std::vector<float>& sin_cache, int pos, float* out) {
+  const int half = c.head_size / 2;
+  const float* cos_row = cos_cache.data() + static_cast<size_t>(pos) * half;
+  const float* sin_row = sin_cache.data() + static_cast<size_t>(pos) * half;
+  for (int i = 0; i < c.head_size; i++) {
+    int cache_idx;
+    bool sign;
+    int j;
+    if (c.rotary_interleaved) {
+      cache_idx = (i / 2) % half;
+      sign = (i & 1) != 0;
+      j = sign ? i - 1 : i + 1;
+    } else {
+      cache_idx = i % half;
+      sign = i >= half;
+      j = (i + half) % c.head_size;
+    }
+    float v = x[i] * cos_row[cache_idx];
+    v += (sign ? 1.0f : -1.0f) * x[j] * sin_row[cache_idx];
+    out[i] = v;
+  }
+}
+
+struct GqaRefResult {
+  std::vector<float> output;         // (batch_size, sequence_length, num_heads * head_size)
+  std::vector<float> present_key;    // (batch_size, kv_num_heads, present_sequence_length, head_size)
+  std::vector<float> present_value;  // same shape as present_key
+  int present_sequence_length;
+};
+
+// Plain-loop reference for the CPU GroupQueryAttention kernel with an unquantized cache. Covers
+// causal masking per sequence, GQA head sharing, rotary embedding, local-window attention with
+// sinks, and the sliding-window ring cache. Inputs are BSNH; past caches are BNSH.
+GqaRefResult ComputeGqaReference(const GqaConfig& c,
+                                 const std::vector<float>& query,
+                                 const std::vector<float>& key,
+                                 const std::vector<float>& value,
+                                 const std::vector<float>& past_key,
+                                 const std::vector<float>& past_value,
+                                 const std::vector<float>& cos_cache = {},
+                                 const std::vector<float>& sin_cache = {}) {
+  const int B = c.batch_size;
+  const int S = c.sequence_length;
+  const int N = c.num_heads;
+  const int Nkv = c.kv_num_heads;
+  const int H = c.head_size;
+  const int P = c.past_sequence_length;
+  const int group_size = N / Nkv;
+  const float scale = 1.0f / std::sqrt(static_cast<float>(H));
+
+  const bool is_subsequent_prompt = S > 1 && S != c.total_sequence_length;
+  const bool is_first_prompt = !is_subsequent_prompt && S == c.total_sequence_length;
+
+  GqaRefResult r;
+  r.present_sequence_length = c.is_ring_kv_cache ? P : std::max(c.total_sequence_length, P);
+  const int present_len = r.present_sequence_length;
+  r.output.assign(static_cast<size_t>(B) * S * N * H, 0.0f);
+  r.present_key.assign(static_cast<size_t>(B) * Nkv * present_len * H, 0.0f);
+  r.present_value.assign(r.present_key.size(), 0.0f);
+
+  for (int b = 0; b < B; b++) {
+    const int total = c.seqlens_k[b] + 1;
+    const int past_len = is_first_prompt ? 0 : total - S;
+    const bool wrapped = c.is_ring_kv_cache && total > present_len;
+
+    // Build this sequence's present cache: carry the past over, then place the new (rotated)
+    // tokens either at their position or, once a ring cache wrapped, in their ring slot.
+    for (int h = 0; h < Nkv; h++) {
+      float* k_cache = r.present_key.data() + (static_cast<size_t>(b) * Nkv + h) * present_len * H;
+      float* v_cache = r.present_value.data() + (static_cast<size_t>(b) * Nkv + h) * present_len * H;
+      if (!past_key.empty()) {
+        const float* past_k = past_key.data() + (static_cast<size_t>(b) * Nkv + h) * P * H;
+        const float* past_v = past_value.data() + (static_cast<size_t>(b) * Nkv + h) * P * H;
+        const int copy_rows = wrapped ? P : past_len;
+        memcpy(k_cache, past_k, static_cast<size_t>(copy_rows) * H * sizeof(float));
+        memcpy(v_cache, past_v, static_cast<size_t>(copy_rows) * H * sizeof(float));
+      }
+      for (int s = 0; s < S; s++) {
+        const int pos = past_len + s;
+        const int slot = wrapped ? c.num_sink_tokens + (pos - c.num_sink_tokens) % c.local_window_size
+                                 : pos;
+        const float* k_src = key.data() + ((static_cast<size_t>(b) * S + s) * Nkv + h) * H;
+        const float* v_src = value.data() + ((static_cast<size_t>(b) * S + s) * Nkv + h) * H;
+        if (c.do_rotary) {
+          RotateRowRef(c, k_src, cos_cache, sin_cache, pos, k_cache + static_cast<size_t>(slot) * H);
+        } else {
+          memcpy(k_cache + static_cast<size_t>(slot) * H, k_src, static_cast<size_t>(H) * sizeof(float));
+        }
+        memcpy(v_cache + static_cast<size_t>(slot) * H, v_src, static_cast<size_t>(H) * sizeof(float));
+      }
+    }
+
+    const int kv_len = wrapped ? present_len : total;
+    for (int n = 0; n < N; n++) {
+      const float* k_cache =
+          r.present_key.data() + (static_cast<size_t>(b) * Nkv + n / group_size) * present_len * H;
+      const float* v_cache =
+          r.present_value.data() + (static_cast<size_t>(b) * Nkv + n / group_size) * present_len * H;
+      for (int s = 0; s < S; s++) {
+        const float* q_src = query.data() + ((static_cast<size_t>(b) * S + s) * N + n) * H;
+        std::vector<float> q_rot(H);
+        if (c.do_rotary) {
+          RotateRowRef(c, q_src, cos_cache, sin_cache, past_len + s, q_rot.data());
+        } else {
+          memcpy(q_rot.data(), q_src, static_cast<size_t>(H) * sizeof(float));
+        }
+
+        // Every slot of a wrapped ring cache is live. Otherwise attention is causal, optionally
+        // narrowed to the local window with the first sink tokens kept attendable.
+        std::vector<bool> live(kv_len, false);
+        if (wrapped) {
+          live.assign(kv_len, true);
+        } else {
+          const int seq_causal = past_len + s + 1;
+          if (c.local_window_size > 0 && seq_causal > c.local_window_size + 1) {
+            const int window_start = seq_causal - c.local_window_size - 1;
+            const int sink_tokens = std::min(c.num_sink_tokens, window_start);
+            for (int t = 0; t < sink_tokens; t++) live[t] = true;
+            for (int t = window_start; t < seq_causal; t++) live[t] = true;
+          } else {
+            for (int t = 0; t < seq_causal; t++) live[t] = true;
+          }
+        }
+
+        std::vector<double> prob(kv_len, 0.0);
+        double max_score = std::numeric_limits<double>::lowest();
+        for (int t = 0; t < kv_len; t++) {
+          if (!live[t]) continue;
+          double score = 0.0;
+          for (int h = 0; h < H; h++) {
+            score += static_cast<double>(q_rot[h]) * k_cache[static_cast<size_t>(t) * H + h];
+          }
+          prob[t] = score * scale;
+          max_score = std::max(max_score, prob[t]);
+        }
+        double sum = 0.0;
+        for (int t = 0; t < kv_len; t++) {
+          if (!live[t]) continue;
+          prob[t] = std::exp(prob[t] - max_score);
+          sum += prob[t];
+        }
+        float* out = r.output.data() + ((static_cast<size_t>(b) * S + s) * N + n) * H;
+        for (int t = 0; t < kv_len; t++) {
+          if (!live[t]) continue;
+          const double w = prob[t] / sum;
+          for (int h = 0; h < H; h++) {
+            out[h] += static_cast<float>(w * v_cache[static_cast<size_t>(t) * H + h]);
+          }
+        }
+      }
+    }
+  }
+  return r;
+}
+
+// Runs the CPU kernel with a contiguous (or absent) KV cache and checks output and present cache
+// against the reference.
+void RunGqaOpTest(const GqaConfig& c,
+                  const std::vector<float>& query,
+                  const std::vector<float>& key,
+                  const std::vector<float>& value,
+                  const std::vector<float>& past_key,
+                  const std::vector<float>& past_value,
+                  const std::vector<float>& cos_cache = {},
+                  const std::vector<float>& sin_cache = {}) {
+  const GqaRefResult expected =
+      ComputeGqaReference(c, query, key, value, past_key, past_value, cos_cache, sin_cache);
+
+  OpTester test("GroupQueryAttention", 1, kMSDomain);
+  test.AddAttribute<int64_t>("num_heads", c.num_heads);
+  test.AddAttribute<int64_t>("kv_num_heads", c.kv_num_heads);
+  if (c.do_rotary) {
+    test.AddAttribute<int64_t>("do_rotary", 1);
+    test.AddAttribute<int64_t>("rotary_interleaved", c.rotary_interleaved ? 1 : 0);
+  }
+  if (c.local_window_size > 0) {
+    test.AddAttribute<int64_t>("local_window_size", c.local_window_size);
+  }
+  if (c.num_sink_tokens > 0) {
+    test.AddAttribute<int64_t>("num_sink_tokens", c.num_sink_tokens);
+  }
+
+  test.AddInput<float>("query", {c.batch_size, c.sequence_length, c.num_heads * c.head_size}, query);
+  test.AddInput<float>("key", {c.batch_size, c.sequence_length, c.kv_num_heads * c.head_size}, key);
+  test.AddInput<float>("value", {c.batch_size, c.sequence_length, c.kv_num_heads * c.head_size}, value);
+  if (c.past_sequence_length > 0) {
+    const std::vector<int64_t> past_dims{c.batch_size, c.kv_num_heads, c.past_sequence_length, c.head_size};
+    test.AddInput<float>("past_key", past_dims, past_key);
+    test.AddInput<float>("past_value", past_dims, past_value);
+  } else {
+    test.AddOptionalInputEdge<float>();
+    test.AddOptionalInputEdge<float>();
+  }
+  test.AddInput<int32_t>("seqlens_k", {c.batch_size}, c.seqlens_k);
+  test.AddInput<int32_t>("total_sequence_length", {1}, {c.total_sequence_length});
+  if (c.do_rotary) {
+    const int64_t cache_rows = static_cast<int64_t>(cos_cache.size()) / (c.head_size / 2);
+    test.AddInput<float>("cos_cache", {cache_rows, c.head_size / 2}, cos_cache);
+    test.AddInput<float>("sin_cache", {cache_rows, c.head_size / 2}, sin_cache);
+  } else {
+    test.AddOptionalInputEdge<float>();
+    test.AddOptionalInputEdge<float>();
+  }
+
+  test.AddOutput<float>("output", {c.batch_size, c.sequence_length, c.num_heads * c.head_size},
+                        expected.output);
+  const std::vector<int64_t> present_dims{c.batch_size, c.kv_num_heads, expected.present_sequence_length,
+                                          c.head_size};
+  test.AddOutput<float>("present_key", present_dims, expected.present_key);
+  test.AddOutput<float>("present_value", present_dims, expected.present_value);
+  test.SetOutputTolerance(kGqaTolerance, kGqaTolerance);
+
+  std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
+  execution_providers.push_back(DefaultCpuExecutionProvider());
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {}, nullptr, &execution_providers);
+}
+
+// Writes the new (optionally rotated) tokens into the page pool the way the kernel scatters them,
+// so paged tests can check the present pool outputs exactly.
+void ScatterTokensIntoPool(const GqaConfig& c,
+                           const std::vector<float>& key,
+                           const std::vector<float>& value,
+                           const std::vector<int32_t>& block_table,
+                           int max_blocks_per_seq,
+                           int page_size,
+                           std::vector<float>& key_pool,
+                           std::vector<float>& value_pool) {
+  const int S = c.sequence_length;
+  const int Nkv = c.kv_num_heads;
+  const int H = c.head_size;
+  const bool is_first_prompt = !(S > 1 && S != c.total_sequence_length) && S == c.total_sequence_length;
+  for (int b = 0; b < c.batch_size; b++) {
+    const int total = c.seqlens_k[b] + 1;
+    const int past_len = is_first_prompt ? 0 : total - S;
+    for (int s = 0; s < S; s++) {
+      const int pos = past_len + s;
+      const int page = block_table[static_cast<size_t>(b) * max_blocks_per_seq + pos / page_size];
+      for (int h = 0; h < Nkv; h++) {
+        const size_t pool_offset =
+            ((static_cast<size_t>(page) * Nkv + h) * page_size + pos % page_size) * H;
+        const float* k_src = key.data() + ((static_cast<size_t>(b) * S + s) * Nkv + h) * H;
+        const float* v_src = value.data() + ((static_cast<size_t>(b) * S + s) * Nkv + h) * H;
+        memcpy(key_pool.data() + pool_offset, k_src, static_cast<size_t>(H) * sizeof(float));
+        memcpy(value_pool.data() + pool_offset, v_src, static_cast<size_t>(H) * sizeof(float));
+      }
+    }
+  }
+}
+
+// Gathers one sequence's past rows out of the page pool into a contiguous (B, N_kv, P, H) cache so
+// the paged run can be checked against the contiguous reference.
+std::vector<float> GatherPastFromPool(const GqaConfig& c,
+                                      const std::vector<float>& pool,
+                                      const std::vector<int32_t>& block_table,
+                                      int max_blocks_per_seq,
+                                      int page_size,
+                                      int contiguous_past_len) {
+  const int Nkv = c.kv_num_heads;
+  const int H = c.head_size;
+  std::vector<float> past(static_cast<size_t>(c.batch_size) * Nkv * contiguous_past_len * H, 0.0f);
+  for (int b = 0; b < c.batch_size; b++) {
+    const int total = c.seqlens_k[b] + 1;
+    const int past_len = total - c.sequence_length;
+    for (int h = 0; h < Nkv; h++) {
+      for (int pos = 0; pos < past_len; pos++) {
+        const int page = block_table[static_cast<size_t>(b) * max_blocks_per_seq + pos / page_size];
+        const size_t pool_offset =
+            ((static_cast<size_t>(page) * Nkv + h) * page_size + pos % page_size) * H;
+        float* dst = past.data() +
+                     ((static_cast<size_t>(b) * Nkv + h) * contiguous_past_len + pos) * H;
+        memcpy(dst, pool.data() + pool_offset, static_cast<size_t>(H) * sizeof(float));
+      }
+    }
+  }
+  return past;
+}
+
+// Runs the CPU kernel in paged KV-cache mode and checks the output against the contiguous-cache
+// reference and the present outputs against the expected updated page pool.
+void RunPagedGqaOpTest(const GqaConfig& c,
+                       const std::vector<float>& query,
+                       const std::vector<float>& key,
+                       const std::vector<float>& value,
+                       const std::vector<float>& key_pool,
+                       const std::vector<float>& value_pool,
+                       const std::vector<int32_t>& block_table,
+                       int num_pages,
+                       int max_blocks_per_seq,
+                       int page_size) {
+  // Expected output: gather the pages into a contiguous past and run the reference on it.
+  int max_past_len = 0;
+  const bool is_first_prompt =
+      !(c.sequence_length > 1 && c.sequence_length != c.total_sequence_length) &&
+      c.sequence_length == c.total_sequence_length;
+  if (!is_first_prompt) {
+    for (int b = 0; b < c.batch_size; b++) {
+      max_past_len = std::max(max_past_len, c.seqlens_k[b] + 1 - c.sequence_length);
+    }
+  }
+  GqaConfig ref_config = c;
+  ref_config.past_sequence_length = max_past_len;
+  std::vector<float> ref_past_key;
+  std::vector<float> ref_past_value;
+  if (max_past_len > 0) {
+    ref_past_key = GatherPastFromPool(c, key_pool, block_table, max_blocks_per_seq, page_size, max_past_len);
+    ref_past_value = GatherPastFromPool(c, value_pool, block_table, max_blocks_per_seq, page_size, max_past_len);
+  }
+  const GqaRefResult expected =
+      ComputeGqaReference(ref_config, query, key, value, ref_past_key, ref_past_value);
+
+  // Expected present pools: the inputs with the new tokens scattered in place.
+  std::vector<float> expected_key_pool = key_pool;
+  std::vector<float> expected_value_pool = value_pool;
+  ScatterTokensIntoPool(c, key, value, block_table, max_blocks_per_seq, page_size,
+                        expected_key_pool, expected_value_pool);
+
+  OpTester test("GroupQueryAttention", 1, kMSDomain);
+  test.AddAttribute<int64_t>("num_heads", c.num_heads);
+  test.AddAttribute<int64_t>("kv_num_heads", c.kv_num_heads);
+
+  const std::vector<int64_t> pool_dims{num_pages, c.kv_num_heads, page_size, c.head_size};
+  test.AddInput<float>("query", {c.batch_size, c.sequence_length, c.num_heads * c.head_size}, query);
+  test.AddInput<float>("key", {c.batch_size, c.sequence_length, c.kv_num_heads * c.head_size}, key);
+  test.AddInput<float>("value", {c.batch_size, c.sequence_length, c.kv_num_heads * c.head_size}, value);
+  test.AddInput<float>("past_key", pool_dims, key_pool);
+  test.AddInput<float>("past_value", pool_dims, value_pool);
+  test.AddInput<int32_t>("seqlens_k", {c.batch_size}, c.seqlens_k);
+  test.AddInput<int32_t>("total_sequence_length", {1}, {c.total_sequence_length});
+  test.AddOptionalInputEdge<float>();
+  test.AddOptionalInputEdge<float>();
+  test.AddInput<int32_t>("block_table", {c.batch_size, max_blocks_per_seq}, block_table);
+
+  test.AddOutput<float>("output", {c.batch_size, c.sequence_length, c.num_heads * c.head_size},
+                        expected.output);
+  test.AddOutput<float>("present_key", pool_dims, expected_key_pool);
+  test.AddOutput<float>("present_value", pool_dims, expected_value_pool);
+  test.SetOutputTolerance(kGqaTolerance, kGqaTolerance);
+
+  std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
+  execution_providers.push_back(DefaultCpuExecutionProvider());
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {}, nullptr, &execution_providers);
+}
+
+}  // namespace
+
+TEST(GroupQueryAttentionTest, PromptNoPast) {
+  GqaConfig c;
+  c.batch_size = 2;
+  c.sequence_length = 4;
+  c.num_heads = 4;
+  c.kv_num_heads = 2;
+  c.head_size = 8;
+  c.total_sequence_length = 4;
+  c.seqlens_k = {3, 3};
+
+  const auto query = MakeGqaData(static_cast<size_t>(2) * 4 * 4 * 8, 1);
+  const auto key = MakeGqaData(static_cast<size_t>(2) * 4 * 2 * 8, 2);
+  const auto value = MakeGqaData(static_cast<size_t>(2) * 4 * 2 * 8, 3);
+  RunGqaOpTest(c, query, key, value, {}, {});
+}
+
+TEST(GroupQueryAttentionTest, DecodeContiguousRaggedPast) {
+  GqaConfig c;
+  c.batch_size = 2;
+  c.sequence_length = 1;
+  c.num_heads = 2;
+  c.kv_num_heads = 1;
+  c.head_size = 8;
+  c.total_sequence_length = 6;
+  c.seqlens_k = {5, 3};  // per-sequence totals 6 and 4
+  c.past_sequence_length = 8;
+
+  const auto query = MakeGqaData(static_cast<size_t>(2) * 1 * 2 * 8, 4);
+  const auto key = MakeGqaData(static_cast<size_t>(2) * 1 * 1 * 8, 5);
+  const auto value = MakeGqaData(static_cast<size_t>(2) * 1 * 1 * 8, 6);
+  const auto past_key = MakeGqaData(static_cast<size_t>(2) * 1 * 8 * 8, 7);
+  const auto past_value = MakeGqaData(static_cast<size_t>(2) * 1 * 8 * 8, 8);
+  RunGqaOpTest(c, query, key, value, past_key, past_value);
+}
+
+TEST(GroupQueryAttentionTest, PagedPromptMatchesContiguous) {
+  GqaConfig c;
+  c.batch_size = 2;
+  c.sequence_length = 5;
+  c.num_heads = 2;
+  c.kv_num_heads = 1;
+  c.head_size = 8;
+  c.total_sequence_length = 5;
+  c.seqlens_k = {4, 4};
+
+  constexpr int page_size = 2;
+  constexpr int num_pages = 7;
+  constexpr int max_blocks_per_seq = 3;
+  // Pages deliberately out of order and interleaved between the sequences; page 3 stays unused.
+  const std::vector<int32_t> block_table = {6, 2, 4,
+                                            1, 5, 0};
+
+  const auto query = MakeGqaData(static_cast<size_t>(2) * 5 * 2 * 8, 11);
+  const auto key = MakeGqaData(static_cast<size_t>(2) * 5 * 1 * 8, 12);
+  const auto value = MakeGqaData(static_cast<size_t>(2) * 5 * 1 * 8, 13);
+  // Pool contents before the call are arbitrary; untouched pages must come back unchanged.
+  const auto key_pool = MakeGqaData(static_cast<size_t>(num_pages) * 1 * page_size * 8, 14);
+  const auto value_pool = MakeGqaData(static_cast<size_t>(num_pages) * 1 * page_size * 8, 15);
+  RunPagedGqaOpTest(c, query, key, value, key_pool, value_pool, block_table,
+                    num_pages, max_blocks_per_seq, page_size);
+}
+
+TEST(GroupQueryAttentionTest, PagedDecodeRaggedPageCounts) {
+  GqaConfig c;
+  c.batch_size = 2;
+  c.sequence_length = 1;
+  c.num_heads = 2;
+  c.kv_num_heads = 1;
+  c.head_size = 8;
+  c.total_sequence_length = 6;
+  c.seqlens_k = {5, 2};  // totals 6 and 3: three pages for the first sequence, two for the second
+
+  constexpr int page_size = 2;
+  constexpr int num_pages = 8;
+  constexpr int max_blocks_per_seq = 3;
+  // The second sequence only uses two pages; its trailing block_table entry must never be read.
+  const std::vector<int32_t> block_table = {7, 3, 5,
+                                            2, 6, 0};
+
+  const auto query = MakeGqaData(static_cast<size_t>(2) * 1 * 2 * 8, 21);
+  const auto key = MakeGqaData(static_cast<size_t>(2) * 1 * 1 * 8, 22);
+  const auto value = MakeGqaData(static_cast<size_t>(2) * 1 * 1 * 8, 23);
+  const auto key_pool = MakeGqaData(static_cast<size_t>(num_pages) * 1 * page_size * 8, 24);
+  const auto value_pool = MakeGqaData(static_cast<size_t>(num_pages) * 1 * page_size * 8, 25);
+  RunPagedGqaOpTest(c, query, key, value, key_pool, value_pool, block_table,
+                    num_pages, max_blocks_per_seq, page_size);
+}
+
+// block_table without the page pools must be rejected.
+TEST(GroupQueryAttentionTest, PagedRejectsMissingPools) {
+  OpTester test("GroupQueryAttention", 1, kMSDomain);
+  test.AddAttribute<int64_t>("num_heads", 2);
+  test.AddAttribute<int64_t>("kv_num_heads", 1);
+
+  test.AddInput<float>("query", {1, 1, 16}, std::vector<float>(16, 0.0f));
+  test.AddInput<float>("key", {1, 1, 8}, std::vector<float>(8, 0.0f));
+  test.AddInput<float>("value", {1, 1, 8}, std::vector<float>(8, 0.0f));
+  test.AddOptionalInputEdge<float>();
+  test.AddOptionalInputEdge<float>();
+  test.AddInput<int32_t>("seqlens_k", {1}, {0});
+  test.AddInput<int32_t>("total_sequence_length", {1}, {1});
+  test.AddOptionalInputEdge<float>();
+  test.AddOptionalInputEdge<float>();
+  test.AddInput<int32_t>("block_table", {1, 1}, {0});
+
+  test.AddOutput<float>("output", {1, 1, 16}, std::vector<float>(16, 0.0f));
+  test.AddOutput<float>("present_key", {1, 1, 1, 8}, std::vector<float>(8, 0.0f));
+  test.AddOutput<float>("present_value", {1, 1, 1, 8}, std::vector<float>(8, 0.0f));
+
+  std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
+  execution_providers.push_back(DefaultCpuExecutionProvider());
+  test.Run(OpTester::ExpectResult::kExpectFailure,
+           "are required when 'block_table' is provided", {}, nullptr, &execution_providers);
+}
+
+// A page pool whose head dimension does not match the model must be rejected.
+TEST(GroupQueryAttentionTest, PagedRejectsMismatchedPool) {
+  OpTester test("GroupQueryAttention", 1, kMSDomain);
+  test.AddAttribute<int64_t>("num_heads", 2);
+  test.AddAttribute<int64_t>("kv_num_heads", 1);
+
+  test.AddInput<float>("query", {1, 1, 16}, std::vector<float>(16, 0.0f));
+  test.AddInput<float>("key", {1, 1, 8}, std::vector<float>(8, 0.0f));
+  test.AddInput<float>("value", {1, 1, 8}, std::vector<float>(8, 0.0f));
+  test.AddInput<float>("past_key", {2, 1, 2, 16}, std::vector<float>(64, 0.0f));
+  test.AddInput<float>("past_value", {2, 1, 2, 16}, std::vector<float>(64, 0.0f));
+  test.AddInput<int32_t>("seqlens_k", {1}, {0});
+  test.AddInput<int32_t>("total_sequence_length", {1}, {1});
+  test.AddOptionalInputEdge<float>();
+  test.AddOptionalInputEdge<float>();
+  test.AddInput<int32_t>("block_table", {1, 2}, {0, 1});
+
+  test.AddOutput<float>("output", {1, 1, 16}, std::vector<float>(16, 0.0f));
+  test.AddOutput<float>("present_key", {2, 1, 2, 16}, std::vector<float>(64, 0.0f));
+  test.AddOutput<float>("present_value", {2, 1, 2, 16}, std::vector<float>(64, 0.0f));
+
+  std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
+  execution_providers.push_back(DefaultCpuExecutionProvider());
+  test.Run(OpTester::ExpectResult::kExpectFailure,
+           "KV page pool dimension 3 should be head_size", {}, nullptr, &execution_providers);
+}
+
+// A block_table that does not reference enough pages to hold the total sequence must be rejected.
+TEST(GroupQueryAttentionTest, PagedRejectsShortBlockTable) {
+  OpTester test("GroupQueryAttention", 1, kMSDomain);
+  test.AddAttribute<int64_t>("num_heads", 2);
+  test.AddAttribute<int64_t>("kv_num_heads", 1);
+
+  test.AddInput<float>("query", {1, 1, 16}, std::vector<float>(16, 0.0f));
+  test.AddInput<float>("key", {1, 1, 8}, std::vector<float>(8, 0.0f));
+  test.AddInput<float>("value", {1, 1, 8}, std::vector<float>(8, 0.0f));
+  test.AddInput<float>("past_key", {2, 1, 2, 8}, std::vector<float>(32, 0.0f));
+  test.AddInput<float>("past_value", {2, 1, 2, 8}, std::vector<float>(32, 0.0f));
+  test.AddInput<int32_t>("seqlens_k", {1}, {4});
+  test.AddInput<int32_t>("total_sequence_length", {1}, {5});
+  test.AddOptionalInputEdge<float>();
+  test.AddOptionalInputEdge<float>();
+  test.AddInput<int32_t>("block_table", {1, 2}, {0, 1});  // 2 pages x 2 entries < 5
+
+  test.AddOutput<float>("output", {1, 1, 16}, std::vector<float>(16, 0.0f));
+  test.AddOutput<float>("present_key", {2, 1, 2, 8}, std::vector<float>(32, 0.0f));
+  test.AddOutput<float>("present_value", {2, 1, 2, 8}, std::vector<float>(32, 0.0f));
+
+  std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
+  execution_providers.push_back(DefaultCpuExecutionProvider());
+  test.Run(OpTester::ExpectResult::kExpectFailure,
+           "does not reference enough pages", {}, nullptr, &execution_providers);
+}
+
+namespace {
+
+ONNX_NAMESPACE::TypeProto MakeTensorTypeProto(int32_t elem_type, const std::vector<int64_t>& dims) {
+  ONNX_NAMESPACE::TypeProto type_proto;
+  type_proto.mutable_tensor_type()->set_elem_type(elem_type);
+  auto* shape = type_proto.mutable_tensor_type()->mutable_shape();
+  for (int64_t dim : dims) {
+    shape->add_dim()->set_dim_value(dim);
+  }
+  return type_proto;
+}
+
+// Runs GroupQueryAttention through an InferenceSession so that past_key/past_value can be bound to
+// the same buffers as present_key/present_value by passing the feed OrtValues as preallocated
+// fetches. The kernel detects the aliased cache pointers and fuses the rotary embedding with the
+// cache append; OpTester always allocates fresh outputs, so this is the only way to reach that
+// path in a test. With share_cache_buffers == false the same model runs the regular unfused path.
+void RunGqaSharedCacheSession(const GqaConfig& c,
+                              const std::vector<float>& query,
+                              const std::vector<float>& key,
+                              const std::vector<float>& value,
+                              const std::vector<float>& past_key,
+                              const std::vector<float>& past_value,
+                              const std::vector<float>& cos_cache,
+                              const std::vector<float>& sin_cache,
+                              bool share_cache_buffers,
+                              std::vector<float>& output,
+                              std::vector<float>& present_key_out,
+                              std::vector<float>& present_value_out) {
+  const int present_len = c.is_ring_kv_cache ? c.past_sequence_length
+                                             : std::max(c.total_sequence_length, c.past_sequence_length);
+  ASSERT_EQ(present_len, c.past_sequence_length) << "cache buffer reuse needs matching past/present shapes";
+
+  const std::vector<int64_t> q_dims{c.batch_size, c.sequence_length, c.num_heads * c.head_size};
+  const std::vector<int64_t> kv_dims{c.batch_size, c.sequence_length, c.kv_num_heads * c.head_size};
+  const std::vector<int64_t> cache_dims{c.batch_size, c.kv_num_heads, c.past_sequence_length, c.head_size};
+  const int64_t rope_rows = static_cast<int64_t>(cos_cache.size()) / (c.head_size / 2);
+  const std::vector<int64_t> rope_dims{rope_rows, c.head_size / 2};
+
+  onnxruntime::Model model("gqa_shared_cache", false, ModelMetaData(), PathString(),
+                           IOnnxRuntimeOpSchemaRegistryList(),
+                           {{kOnnxDomain, 17}, {kMSDomain, 1}}, {},
+                           DefaultLoggingManager().DefaultLogger());
+  Graph& graph = model.MainGraph();
+
+  auto float_proto = [&](const std::vector<int64_t>& dims) {
+    return MakeTensorTypeProto(ONNX_NAMESPACE::TensorProto_DataType_FLOAT, dims);
+  };
+  auto int32_proto = [&](const std::vector<int64_t>& dims) {
+    return MakeTensorTypeProto(ONNX_NAMESPACE::TensorProto_DataType_INT32, dims);
+  };
+
+  auto q_type = float_proto(q_dims);
+  auto kv_type = float_proto(kv_dims);
+  auto cache_type = float_proto(cache_dims);
+  auto seqlens_type = int32_proto({c.batch_size});
+  auto total_type = int32_proto({1});
+  auto rope_type = float_proto(rope_dims);
+
+  std::vector<NodeArg*> input_defs{
+      &graph.GetOrCreateNodeArg("query", &q_type),
+      &graph.GetOrCreateNodeArg("key", &kv_type),
+      &graph.GetOrCreateNodeArg("value", &kv_type),
+      &graph.GetOrCreateNodeArg("past_key", &cache_type),
+      &graph.GetOrCreateNodeArg("past_value", &cache_type),
+      &graph.GetOrCreateNodeArg("seqlens_k", &seqlens_type),
+      &graph.GetOrCreateNodeArg("total_sequence_length", &total_type),
+      &graph.GetOrCreateNodeArg("cos_cache", &rope_type),
+      &graph.GetOrCreateNodeArg("sin_cache", &rope_type)};
+  auto out_type = float_proto(q_dims);
+  std::vector<NodeArg*> output_defs{
+      &graph.GetOrCreateNodeArg("output", &out_type),
+      &graph.GetOrCreateNodeArg("present_key", &cache_type),
+      &graph.GetOrCreateNodeArg("present_value", &cache_type)};
+
+  Node& node = graph.AddNode("gqa", "GroupQueryAttention", "", input_defs, output_defs, nullptr, kMSDomain);
+  node.AddAttribute("num_heads", static_cast<int64_t>(c.num_heads));
+  node.AddAttribute("kv_num_heads", static_cast<int64_t>(c.kv_num_heads));
+  node.AddAttribute("do_rotary", static_cast<int64_t>(1));
+  node.AddAttribute("rotary_interleaved", static_cast<int64_t>(c.rotary_interleaved ? 1 : 0));
+  if (c.local_window_size > 0) {
+    node.AddAttribute("local_window_size", static_cast<int64_t>(c.local_window_size));
+  }
+  if (c.num_sink_tokens > 0) {
+    node.AddAttribute("num_sink_tokens", static_cast<int64_t>(c.num_sink_tokens));
+  }
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  std::string model_data;
+  ASSERT_TRUE(model.ToProto().SerializeToString(&model_data));
+
+  SessionOptions session_options;
+  InferenceSession session{session_options, GetEnvironment()};
+  ASSERT_STATUS_OK(session.Load(model_data.data(), static_cast<int>(model_data.size())));
+  ASSERT_STATUS_OK(session.Initialize());
+
+  AllocatorPtr allocator = std::make_shared<CPUAllocator>();
+  NameMLValMap feeds;
+  auto add_feed = [&](const char* name, const std::vector<int64_t>& dims, const std::vector<float>& data) {
+    OrtValue value;
+    CreateMLValue<float>(allocator, dims, data, &value);
+    feeds.emplace(name, value);
+    return value;
+  };
+  add_feed("query", q_dims, query);
+  add_feed("key", kv_dims, key);
+  add_feed("value", kv_dims, value);
+  OrtValue past_key_value = add_feed("past_key", cache_dims, past_key);
+  OrtValue past_value_value = add_feed("past_value", cache_dims, past_value);
+  {
+    OrtValue seqlens_value;
+    CreateMLValue<int32_t>(allocator, {c.batch_size}, c.seqlens_k, &seqlens_value);
+    feeds.emplace("seqlens_k", seqlens_value);
+    OrtValue total_value;
+    CreateMLValue<int32_t>(allocator, {1}, {c.total_sequence_length}, &total_value);
+    feeds.emplace("total_sequence_length", total_value);
+  }
+  add_feed("cos_cache", rope_dims, cos_cache);
+  add_feed("sin_cache", rope_dims, sin_cache);
+
+  std::vector<OrtValue> fetches(3);
+  AllocateMLValue<float>(allocator, q_dims, &fetches[0]);
+  if (share_cache_buffers) {
+    fetches[1] = past_key_value;
+    fetches[2] = past_value_value;
+  } else {
+    AllocateMLValue<float>(allocator, cache_dims, &fetches[1]);
+    AllocateMLValue<float>(allocator, cache_dims, &fetches[2]);
+  }
+
+  RunOptions run_options;
+  const std::vector<std::string> output_names{"output", "present_key", "present_value"};
+  ASSERT_STATUS_OK(session.Run(run_options, feeds, output_names, &fetches));
+
+  auto copy_out = [](const OrtValue& value, std::vector<float>& dst) {
+    const Tensor& tensor = value.Get<Tensor>();
+    const float* data = tensor.Data<float>();
+    dst.assign(data, data + tensor.Shape().Size());
+  };
+  copy_out(fetches[0], output);
+  copy_out(fetches[1], present_key_out);
+  copy_out(fetches[2], present_value_out);
+}
+
+// Checks that the fused rotary + cache-append path (shared past/present buffers) matches both the
+// unfused path (separate buffers) and the reference.
+void TestFusedRotaryCacheAppend(bool interleaved, bool is_prompt) {
+  GqaConfig c;
+  c.batch_size = 2;
+  c.num_heads = 2;
+  c.kv_num_heads = 1;
+  c.head_size = 16;
+  c.past_sequence_length = 8;
+  c.do_rotary = true;
+  c.rotary_interleaved = interleaved;
+  if (is_prompt) {
+    c.sequence_length = 4;
+    c.total_sequence_length = 4;
+    c.seqlens_k = {3, 3};
+  } else {
+    c.sequence_length = 1;
+    c.total_sequence_length = 5;
+    c.seqlens_k = {4, 2};
+  }
+
+  const int B = c.batch_size;
+  const int Nkv = c.kv_num_heads;
+  const int H = c.head_size;
+  const int P = c.past_sequence_length;
+  const size_t q_size = static_cast<size_t>(B) * c.sequence_length * c.num_heads * H;
+  const size_t kv_size = static_cast<size_t>(B) * c.sequence_length * Nkv * H;
+  const auto query = MakeGqaData(q_size, 41);
+  const auto key = MakeGqaData(kv_size, 42);
+  const auto value = MakeGqaData(kv_size, 43);
+  const auto cos_cache = MakeGqaData(static_cast<size_t>(8) * (H / 2), 44);
+  const auto sin_cache = MakeGqaData(static_cast<size_t>(8) * (H / 2), 45);
+
+  // Rows past each sequence's past length are zero so the preloaded shared buffer matches what the
+  // unfused path produces in its zero-initialized present buffer.
+  auto past_key = MakeGqaData(static_cast<size_t>(B) * Nkv * P * H, 46);
+  auto past_value = MakeGqaData(static_cast<size_t>(B) * Nkv * P * H, 47);
+  for (int b = 0; b < B; b++) {
+    const int past_len = is_prompt ? 0 : c.seqlens_k[b] + 1 - c.sequence_length;
+    for (int h = 0; h < Nkv; h++) {
+      float* k_rows = past_key.data() + (static_cast<size_t>(b) * Nkv + h) * P * H;
+      float* v_rows = past_value.data() + (static_cast<size_t>(b) * Nkv + h) * P * H;
+      std::fill(k_rows + static_cast<size_t>(past_len) * H, k_rows + static_cast<size_t>(P) * H, 0.0f);
+      std::fill(v_rows + static_cast<size_t>(past_len) * H, v_rows + static_cast<size_t>(P) * H, 0.0f);
+    }
+  }
+
+  const GqaRefResult expected =
+      ComputeGqaReference(c, query, key, value, past_key, past_value, cos_cache, sin_cache);
+
+  std::vector<float> fused_output, fused_present_key, fused_present_value;
+  RunGqaSharedCacheSession(c, query, key, value, past_key, past_value, cos_cache, sin_cache,
+                           /*share_cache_buffers*/ true, fused_output, fused_present_key,
+                           fused_present_value);
+  std::vector<float> unfused_output, unfused_present_key, unfused_present_value;
+  RunGqaSharedCacheSession(c, query, key, value, past_key, past_value, cos_cache, sin_cache,
+                           /*share_cache_buffers*/ false, unfused_output, unfused_present_key,
+                           unfused_present_value);
+
+  // The fused path rotates K with the same arithmetic as the unfused one, only straight into the
+  // cache slot, so the two runs should agree to rounding.
+  ASSERT_EQ(fused_output.size(), unfused_output.size());
+  for (size_t i = 0; i < fused_output.size(); i++) {
+    EXPECT_NEAR(fused_output[i], unfused_output[i], 1e-5f) << "output mismatch at " << i;
+  }
+  for (size_t i = 0; i < fused_present_key.size(); i++) {
+    EXPECT_NEAR(fused_present_key[i], unfused_present_key[i], 1e-5f) << "present_key mismatch at " << i;
+    EXPECT_NEAR(fused_present_value[i], unfused_present_value[i], 1e-5f) << "present_value mismatch at " << i;
+  }
+  for (size_t i = 0; i < expected.output.size(); i++) {
+    EXPECT_NEAR(fused_output[i], expected.output[i], kGqaTolerance) << "reference mismatch at " << i;
+  }
+  for (size_t i = 0; i < expected.present_key.size(); i++) {
+    EXPECT_NEAR(fused_present_key[i], expected.present_key[i], kGqaTolerance) << "present_key reference mismatch at " << i;
+    EXPECT_NEAR(fused_present_value[i], expected.present_value[i], kGqaTolerance) << "present_value reference mismatch at " << i;
+  }
+}
+
+}  // namespace
+
+TEST(GroupQueryAttentionTest, RotaryPromptVsReference) {
+  for (bool interleaved : {false, true}) {
+    GqaConfig c;
+    c.batch_size = 2;
+    c.sequence_length = 4;
+    c.num_heads = 2;
+    c.kv_num_heads = 1;
+    c.head_size = 16;
+    c.total_sequence_length = 4;
+    c.seqlens_k = {3, 3};
+    c.do_rotary = true;
+    c.rotary_interleaved = interleaved;
+
+    const auto query = MakeGqaData(static_cast<size_t>(2) * 4 * 2 * 16, 51);
+    const auto key = MakeGqaData(static_cast<size_t>(2) * 4 * 1 * 16, 52);
+    const auto value = MakeGqaData(static_cast<size_t>(2) * 4 * 1 * 16, 53);
+    const auto cos_cache = MakeGqaData(static_cast<size_t>(8) * 8, 54);
+    const auto sin_cache = MakeGqaData(static_cast<size_t>(8) * 8, 55);
+    RunGqaOpTest(c, query, key, value, {}, {}, cos_cache, sin_cache);
+  }
+}
+
+TEST(GroupQueryAttentionTest, RotaryDecodeVsReference) {
+  for (bool interleaved : {false, true}) {
+    GqaConfig c;
+    c.batch_size = 2;
+    c.sequence_length = 1;
+    c.num_heads = 2;
+    c.kv_num_heads = 1;
+    c.head_size = 16;
+    c.total_sequence_length = 5;
+    c.seqlens_k = {4, 2};  // ragged positions: the rotation must use each sequence's own offset
+    c.past_sequence_length = 6;
+    c.do_rotary = true;
+    c.rotary_interleaved = interleaved;
+
+    const auto query = MakeGqaData(static_cast<size_t>(2) * 1 * 2 * 16, 61);
+    const auto key = MakeGqaData(static_cast<size_t>(2) * 1 * 1 * 16, 62);
+    const auto value = MakeGqaData(static_cast<size_t>(2) * 1 * 1 * 16, 63);
+    const auto past_key = MakeGqaData(static_cast<size_t>(2) * 1 * 6 * 16, 64);
+    const auto past_value = MakeGqaData(static_cast<size_t>(2) * 1 * 6 * 16, 65);
+    const auto cos_cache = MakeGqaData(static_cast<size_t>(8) * 8, 66);
+    const auto sin_cache = MakeGqaData(static_cast<size_t>(8) * 8, 67);
+    RunGqaOpTest(c, query, key, value, past_key, past_value, cos_cache, sin_cache);
+  }
+}
+
+TEST(GroupQueryAttentionTest, FusedRotaryCacheAppendPrompt) {
+  TestFusedRotaryCacheAppend(/*interleaved*/ false, /*is_prompt*/ true);
+  TestFusedRotaryCacheAppend(/*interleaved*/ true, /*is_prompt*/ true);
+}
+
+TEST(GroupQueryAttentionTest, FusedRotaryCacheAppendDecode) {
+  TestFusedRotaryCacheAppend(/*interleaved*/ false, /*is_prompt*/ false);
+  TestFusedRotaryCacheAppend(/*interleaved*/ true, /*is_prompt*/ false);
+}
+
+// Local-window masking on a prompt, without sinks: everything before the window is masked out.
+TEST(GroupQueryAttentionTest, LocalWindowPromptMasking) {
+  GqaConfig c;
+  c.batch_size = 1;
+  c.sequence_length = 8;
+  c.num_heads = 2;
+  c.kv_num_heads = 1;
+  c.head_size = 8;
+  c.total_sequence_length = 8;
+  c.seqlens_k = {7};
+  c.local_window_size = 3;
+
+  const auto query = MakeGqaData(static_cast<size_t>(1) * 8 * 2 * 8, 71);
+  const auto key = MakeGqaData(static_cast<size_t>(1) * 8 * 1 * 8, 72);
+  const auto value = MakeGqaData(static_cast<size_t>(1) * 8 * 1 * 8, 73);
+  RunGqaOpTest(c, query, key, value, {}, {});
+}
+
+// With num_sink_tokens set, the initial tokens stay attendable alongside the local window and only
+// the gap between them is masked.
+TEST(GroupQueryAttentionTest, LocalWindowWithSinksPromptMasking) {
+  GqaConfig c;
+  c.batch_size = 1;
+  c.sequence_length = 10;
+  c.num_heads = 2;
+  c.kv_num_heads = 1;
+  c.head_size = 8;
+  c.total_sequence_length = 10;
+  c.seqlens_k = {9};
+  c.local_window_size = 4;
+  c.num_sink_tokens = 2;
+
+  const auto query = MakeGqaData(static_cast<size_t>(1) * 10 * 2 * 8, 74);
+  const auto key = MakeGqaData(static_cast<size_t>(1) * 10 * 1 * 8, 75);
+  const auto value = MakeGqaData(static_cast<size_t>(1) * 10 * 1 * 8, 76);
+  RunGqaOpTest(c, query, key, value, {}, {});
+}
+
+// Decodes ten tokens through a ring cache of num_sink_tokens + local_window_size = 6 slots. The
+// first six steps run the regular path; from the seventh on the cache is smaller than the total
+// sequence, the kernel switches to ring mode, and each new token overwrites the oldest non-sink
+// slot. The cache state is carried from step to step like a generation loop would.
+TEST(GroupQueryAttentionTest, RingCacheDecodeWrapAround) {
+  GqaConfig c;
+  c.batch_size = 1;
+  c.sequence_length = 1;
+  c.num_heads = 2;
+  c.kv_num_heads = 1;
+  c.head_size = 8;
+  c.local_window_size = 4;
+  c.num_sink_tokens = 2;
+  c.past_sequence_length = 6;
+
+  std::vector<float> state_key(static_cast<size_t>(1) * 1 * 6 * 8, 0.0f);
+  std::vector<float> state_value(state_key.size(), 0.0f);
+  for (int step = 1; step <= 10; step++) {
+    c.total_sequence_length = step;
+    c.seqlens_k = {step - 1};
+    c.is_ring_kv_cache = step > 6;
+
+    const auto query = MakeGqaData(static_cast<size_t>(1) * 1 * 2 * 8, 80 + step);
+    const auto key = MakeGqaData(static_cast<size_t>(1) * 1 * 1 * 8, 90 + step);
+    const auto value = MakeGqaData(static_cast<size_t>(1) * 1 * 1 * 8, 100 + step);
+    RunGqaOpTest(c, query, key, value, state_key, state_value);
+
+    const GqaRefResult r = ComputeGqaReference(c, query, key, value, state_key, state_value);
+    state_key = r.present_key;
+    state_value = r.present_value;
+  }
+}
+
+// Ring mode disables the fused rotary cache append: even with past/present bound to the same
+// buffer, the kernel must append via the ring slot arithmetic. Run a wrapped rotary decode step
+// with shared and with separate cache buffers and check both against the reference.
+TEST(GroupQueryAttentionTest, RingCacheSharedBufferRotaryDecode) {
+  GqaConfig c;
+  c.batch_size = 1;
+  c.sequence_length = 1;
+  c.num_heads = 2;
+  c.kv_num_heads = 1;
+  c.head_size = 16;
+  c.total_sequence_length = 10;
+  c.seqlens_k = {9};
+  c.past_sequence_length = 6;
+  c.do_rotary = true;
+  c.local_window_size = 4;
+  c.num_sink_tokens = 2;
+  c.is_ring_kv_cache = true;
+
+  const auto query = MakeGqaData(static_cast<size_t>(1) * 1 * 2 * 16, 111);
+  const auto key = MakeGqaData(static_cast<size_t>(1) * 1 * 1 * 16, 112);
+  const auto value = MakeGqaData(static_cast<size_t>(1) * 1 * 1 * 16, 113);
+  const auto past_key = MakeGqaData(static_cast<size_t>(1) * 1 * 6 * 16, 114);
+  const auto past_value = MakeGqaData(static_cast<size_t>(1) * 1 * 6 * 16, 115);
+  const auto cos_cache = MakeGqaData(static_cast<size_t>(12) * 8, 116);
+  const auto sin_cache = MakeGqaData(static_cast<size_t>(12) * 8, 117);
+
+  const GqaRefResult expected =
+      ComputeGqaReference(c, query, key, value, past_key, past_value, cos_cache, sin_cache);
+
+  for (bool share_cache_buffers : {true, false}) {
+    std::vector<float> output, present_key, present_value;
+    RunGqaSharedCacheSession(c, query, key, value, past_key, past_value, cos_cache, sin_cache,
+                             share_cache_buffers, output, present_key, present_value);
+    for (size_t i = 0; i < expected.output.size(); i++) {
+      EXPECT_NEAR(output[i], expected.output[i], kGqaTolerance)
+          << "output mismatch at " << i << " share=" << share_cache_buffers;
+    }
+    for (size_t i = 0; i < expected.present_key.size(); i++) {
+      EXPECT_NEAR(present_key[i], expected.present_key[i], kGqaTolerance)
+          << "present_key mismatch at " << i << " share=" << share_cache_buffers;
+      EXPECT_NEAR(present_value[i], expected.present_value[i], kGqaTolerance)
+          << "present_value mismatch at " << i << " share=" << share_cache_buffers;
+    }
+  }
+}
+
+// A cache smaller than the total sequence may only be used as a ring buffer when it was allocated
+// with exactly num_sink_tokens + local_window_size slots.
+TEST(GroupQueryAttentionTest, RingCacheRejectsCapacityMismatch) {
+  OpTester test("GroupQueryAttention", 1, kMSDomain);
+  test.AddAttribute<int64_t>("num_heads", 2);
+  test.AddAttribute<int64_t>("kv_num_heads", 1);
+  test.AddAttribute<int64_t>("local_window_size", 4);
+  test.AddAttribute<int64_t>("num_sink_tokens", 2);
+
+  test.AddInput<float>("query", {1, 1, 16}, std::vector<float>(16, 0.0f));
+  test.AddInput<float>("key", {1, 1, 8}, std::vector<float>(8, 0.0f));
+  test.AddInput<float>("value", {1, 1, 8}, std::vector<float>(8, 0.0f));
+  test.AddInput<float>("past_key", {1, 1, 5, 8}, std::vector<float>(40, 0.0f));
+  test.AddInput<float>("past_value", {1, 1, 5, 8}, std::vector<float>(40, 0.0f));
+  test.AddInput<int32_t>("seqlens_k", {1}, {6});
+  test.AddInput<int32_t>("total_sequence_length", {1}, {7});
+
+  test.AddOutput<float>("output", {1, 1, 16}, std::vector<float>(16, 0.0f));
+  test.AddOutput<float>("present_key", {1, 1, 5, 8}, std::vector<float>(40, 0.0f));
+  test.AddOutput<float>("present_value", {1, 1, 5, 8}, std::vector<float>(40, 0.0f));
+
+  std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
+  execution_providers.push_back(DefaultCpuExecutionProvider());
+  test.Run(OpTester::ExpectResult::kExpectFailure,
+           "must be allocated with exactly num_sink_tokens + local_window_size", {}, nullptr,
+           &execution_providers);
+}
+
+// Multi-token passes cannot run past the window: only token generation may wrap the ring cache.
+TEST(GroupQueryAttentionTest, RingCacheRejectsMultiTokenPass) {
+  OpTester test("GroupQueryAttention", 1, kMSDomain);
+  test.AddAttribute<int64_t>("num_heads", 2);
+  test.AddAttribute<int64_t>("kv_num_heads", 1);
+  test.AddAttribute<int64_t>("local_window_size", 4);
+  test.AddAttribute<int64_t>("num_sink_tokens", 2);
+
+  test.AddInput<float>("query", {1, 3, 16}, std::vector<float>(48, 0.0f));
+  test.AddInput<float>("key", {1, 3, 8}, std::vector<float>(24, 0.0f));
+  test.AddInput<float>("value", {1, 3, 8}, std::vector<float>(24, 0.0f));
+  test.AddInput<float>("past_key", {1, 1, 6, 8}, std::vector<float>(48, 0.0f));
+  test.AddInput<float>("past_value", {1, 1, 6, 8}, std::vector<float>(48, 0.0f));
+  test.AddInput<int32_t>("seqlens_k", {1}, {8});
+  test.AddInput<int32_t>("total_sequence_length", {1}, {9});
+
+  test.AddOutput<float>("output", {1, 3, 16}, std::vector<float>(48, 0.0f));
+  test.AddOutput<float>("present_key", {1, 1, 6, 8}, std::vector<float>(48, 0.0f));
+  test.AddOutput<float>("present_value", {1, 1, 6, 8}, std::vector<float>(48, 0.0f));
+
+  std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
+  execution_providers.push_back(DefaultCpuExecutionProvider());
+  test.Run(OpTester::ExpectResult::kExpectFailure,
+           "Prompt processing must fit within the sliding-window KV cache", {}, nullptr,
+           &execution_providers);
+}
+
+// Scores a batch of draft tokens per sequence in one multi-token pass (speculative decoding
+// verification). Each sequence has its own past length, so the causal mask offset differs per
+// batch entry; the per-sequence reference checks them all.
+TEST(GroupQueryAttentionTest, MultiTokenVerificationBatched) {
+  GqaConfig c;
+  c.batch_size = 3;
+  c.sequence_length = 3;
+  c.num_heads = 2;
+  c.kv_num_heads = 2;
+  c.head_size = 8;
+  c.total_sequence_length = 7;
+  c.seqlens_k = {6, 4, 2};  // totals 7, 5 and 3 with three new tokens each
+  c.past_sequence_length = 4;
+
+  const auto query = MakeGqaData(static_cast<size_t>(3) * 3 * 2 * 8, 121);
+  const auto key = MakeGqaData(static_cast<size_t>(3) * 3 * 2 * 8, 122);
+  const auto value = MakeGqaData(static_cast<size_t>(3) * 3 * 2 * 8, 123);
+  const auto past_key = MakeGqaData(static_cast<size_t>(3) * 2 * 4 * 8, 124);
+  const auto past_value = MakeGqaData(static_cast<size_t>(3) * 2 * 4 * 8, 125);
+  RunGqaOpTest(c, query, key, value, past_key, past_value);
+}
+
+// Verify-then-rollback: after a batched verification pass, the next call passes each sequence's
+// accepted token count through seqlens_k. The cache needs no explicit rollback - the new token is
+// written at the accepted position and overwrites the first rejected draft entry in place.
+TEST(GroupQueryAttentionTest, MultiTokenVerificationRollbackDecode) {
+  GqaConfig verify;
+  verify.batch_size = 3;
+  verify.sequence_length = 3;
+  verify.num_heads = 2;
+  verify.kv_num_heads = 1;
+  verify.head_size = 8;
+  verify.total_sequence_length = 7;
+  verify.seqlens_k = {6, 4, 2};
+  verify.past_sequence_length = 4;
+
+  const auto query = MakeGqaData(static_cast<size_t>(3) * 3 * 2 * 8, 131);
+  const auto key = MakeGqaData(static_cast<size_t>(3) * 3 * 1 * 8, 132);
+  const auto value = MakeGqaData(static_cast<size_t>(3) * 3 * 1 * 8, 133);
+  const auto past_key = MakeGqaData(static_cast<size_t>(3) * 1 * 4 * 8, 134);
+  const auto past_value = MakeGqaData(static_cast<size_t>(3) * 1 * 4 * 8, 135);
+  RunGqaOpTest(verify, query, key, value, past_key, past_value);
+
+  const GqaRefResult verified = ComputeGqaReference(verify, query, key, value, past_key, past_value);
+
+  // Sequences accept 1, 2 and 0 of their 3 draft tokens, giving totals 6, 5 and 1 for the next
+  // single-token step against the cache produced above.
+  GqaConfig decode = verify;
+  decode.sequence_length = 1;
+  decode.total_sequence_length = 6;
+  decode.seqlens_k = {5, 4, 0};
+  decode.past_sequence_length = verified.present_sequence_length;
+
+  const auto query2 = MakeGqaData(static_cast<size_t>(3) * 1 * 2 * 8, 141);
+  const auto key2 = MakeGqaData(static_cast<size_t>(3) * 1 * 1 * 8, 142);
+  const auto value2 = MakeGqaData(static_cast<size_t>(3) * 1 * 1 * 8, 143);
+  RunGqaOpTest(decode, query2, key2, value2, verified.present_key, verified.present_value);
+}
+
+// Batched multi-token verification combined with the paged KV cache.
+TEST(GroupQueryAttentionTest, PagedMultiTokenVerificationBatched) {
+  GqaConfig c;
+  c.batch_size = 2;
+  c.sequence_length = 2;
+  c.num_heads = 2;
+  c.kv_num_heads = 1;
+  c.head_size = 8;
+  c.total_sequence_length = 6;
+  c.seqlens_k = {5, 4};  // totals 6 and 5 with two new tokens each
+
+  constexpr int page_size = 2;
+  constexpr int num_pages = 8;
+  constexpr int max_blocks_per_seq = 3;
+  const std::vector<int32_t> block_table = {1, 4, 6,
+                                            3, 0, 7};
+
+  const auto query = MakeGqaData(static_cast<size_t>(2) * 2 * 2 * 8, 151);
+  const auto key = MakeGqaData(static_cast<size_t>(2) * 2 * 1 * 8, 152);
+  const auto value = MakeGqaData(static_cast<size_t>(2) * 2 * 1 * 8, 153);
+  const auto key_pool = MakeGqaData(static_cast<size_t>(num_pages) * 1 * page_size * 8, 154);
+  const auto value_pool = MakeGqaData(static_cast<size_t>(num_pages) * 1 * page_size * 8, 155);
+  RunPagedGqaOpTest(c, query, key, value, key_pool, value_pool, block_table,
+                    num_pages, max_blocks_per_seq, page_size);
+}
+
+namespace {
+
+// Mirror of the kernel's symmetric per-row cache quantization: head_size int8 values followed by
+// the row's float32 scale.
+void QuantizeKvRowRef(const float* src, int head_size, int8_t* dst) {
+  float absmax = 0.0f;
+  for (int h = 0; h < head_size; h++) {
+    absmax = std::max(absmax, std::abs(src[h]));
+  }
+  const float scale = absmax / 127.0f;
+  const float inv_scale = absmax == 0.0f ? 0.0f : 127.0f / absmax;
+  for (int h = 0; h < head_size; h++) {
+    dst[h] = static_cast<int8_t>(std::lroundf(src[h] * inv_scale));
+  }
+  memcpy(dst + head_size, &scale, sizeof(float));
+}
+
+// K/V rows on the 1/64 grid with each row's absmax pinned to 127/64, so the kernel's int8
+// quantization is exact: the dequantized cache reproduces these values bit for bit and the
+// quantized output path can be compared against the float-cache reference directly.
+std::vector<float> MakeQuantGridData(size_t rows, int head_size, size_t salt) {
+  std::vector<float> data(rows * head_size);
+  for (size_t r = 0; r < rows; r++) {
+    for (int h = 0; h < head_size; h++) {
+      const int v = static_cast<int>((r * 31 + h * 17 + salt * 13) % 255) - 127;
+      data[r * head_size + h] = static_cast<float>(v) / 64.0f;
+    }
+    data[r * head_size] = (r % 2 == 0) ? 127.0f / 64.0f : -127.0f / 64.0f;
+  }
+  return data;
+}
+
+// Builds an int8 past cache directly on the grid together with its exact float equivalent for the
+// reference.
+void MakeQuantPastCache(size_t rows, int head_size, size_t salt,
+                        std::vector<int8_t>& quant, std::vector<float>& dequant) {
+  const size_t row_bytes = static_cast<size_t>(head_size) + sizeof(float);
+  const float scale = 1.0f / 64.0f;
+  quant.assign(rows * row_bytes, 0);
+  dequant.assign(rows * static_cast<size_t>(head_size), 0.0f);
+  for (size_t r = 0; r < rows; r++) {
+    for (int h = 0; h < head_size; h++) {
+      const int v = static_cast<int>((r * 29 + h * 11 + salt * 19) % 255) - 127;
+      quant[r * row_bytes + h] = static_cast<int8_t>(v);
+      dequant[r * static_cast<size_t>(head_size) + h] = scale * static_cast<float>(v);
+    }
+    memcpy(quant.data() + r * row_bytes + head_size, &scale, sizeof(float));
+  }
+}
+
+// Runs the kernel with kv_cache_quant_type == 1 and checks the output against the float-cache
+// reference and the int8 present cache byte for byte.
+void RunQuantKvGqaOpTest(const GqaConfig& c,
+                         const std::vector<float>& query,
+                         const std::vector<float>& key,
+                         const std::vector<float>& value,
+                         const std::vector<int8_t>& past_key_quant,
+                         const std::vector<int8_t>& past_value_quant,
+                         const std::vector<float>& past_key_dequant,
+                         const std::vector<float>& past_value_dequant) {
+  const GqaRefResult expected =
+      ComputeGqaReference(c, query, key, value, past_key_dequant, past_value_dequant);
+
+  const int B = c.batch_size;
+  const int S = c.sequence_length;
+  const int Nkv = c.kv_num_heads;
+  const int H = c.head_size;
+  const int P = c.past_sequence_length;
+  const int present_len = expected.present_sequence_length;
+  const size_t row_bytes = static_cast<size_t>(H) + sizeof(float);
+  const bool is_first_prompt = !(S > 1 && S != c.total_sequence_length) && S == c.total_sequence_length;
+
+  // Expected int8 present cache: zero rows (which dequantize to zero), the past rows copied over,
+  // and the new tokens quantized at their positions.
+  std::vector<int8_t> expected_present_key(static_cast<size_t>(B) * Nkv * present_len * row_bytes, 0);
+  std::vector<int8_t> expected_present_value(expected_present_key.size(), 0);
+  for (int b = 0; b < B; b++) {
+    const int total = c.seqlens_k[b] + 1;
+    const int past_len = is_first_prompt ? 0 : total - S;
+    for (int h = 0; h < Nkv; h++) {
+      int8_t* k_dst = expected_present_key.data() + (static_cast<size_t>(b) * Nkv + h) * present_len * row_bytes;
+      int8_t* v_dst = expected_present_value.data() + (static_cast<size_t>(b) * Nkv + h) * present_len * row_bytes;
+      if (past_len > 0) {
+        const size_t past_offset = (static_cast<size_t>(b) * Nkv + h) * P * row_bytes;
+        memcpy(k_dst, past_key_quant.data() + past_offset, static_cast<size_t>(past_len) * row_bytes);
+        memcpy(v_dst, past_value_quant.data() + past_offset, static_cast<size_t>(past_len) * row_bytes);
+      }
+      for (int s = 0; s < S; s++) {
+        const float* k_src = key.data() + ((static_cast<size_t>(b) * S + s) * Nkv + h) * H;
+        const float* v_src = value.data() + ((static_cast<size_t>(b) * S + s) * Nkv + h) * H;
+        QuantizeKvRowRef(k_src, H, k_dst + (static_cast<size_t>(past_len) + s) * row_bytes);
+        QuantizeKvRowRef(v_src, H, v_dst + (static_cast<size_t>(past_len) + s) * row_bytes);
+      }
+    }
+  }
+
+  OpTester test("GroupQueryAttention", 1, kMSDomain);
+  test.AddAttribute<int64_t>("num_heads", c.num_heads);
+  test.AddAttribute<int64_t>("kv_num_heads", c.kv_num_heads);
+  test.AddAttribute<int64_t>("kv_cache_quant_type", 1);
+
+  test.AddInput<float>("query", {B, S, c.num_heads * H}, query);
+  test.AddInput<float>("key", {B, S, Nkv * H}, key);
+  test.AddInput<float>("value", {B, S, Nkv * H}, value);
+  if (P > 0) {
+    const std::vector<int64_t> past_dims{B, Nkv, P, static_cast<int64_t>(row_bytes)};
+    test.AddInput<int8_t>("past_key", past_dims, past_key_quant);
+    test.AddInput<int8_t>("past_value", past_dims, past_value_quant);
+  } else {
+    test.AddOptionalInputEdge<int8_t>();
+    test.AddOptionalInputEdge<int8_t>();
+  }
+  test.AddInput<int32_t>("seqlens_k", {B}, c.seqlens_k);
+  test.AddInput<int32_t>("total_sequence_length", {1}, {c.total_sequence_length});
+
+  test.AddOutput<float>("output", {B, S, c.num_heads * H}, expected.output);
+  const std::vector<int64_t> present_dims{B, Nkv, present_len, static_cast<int64_t>(row_bytes)};
+  test.AddOutput<int8_t>("present_key", present_dims, expected_present_key);
+  test.AddOutput<int8_t>("present_value", present_dims, expected_present_value);
+  test.SetOutputTolerance(kGqaTolerance, kGqaTolerance);
+
+  std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
+  execution_providers.push_back(DefaultCpuExecutionProvider());
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {}, nullptr, &execution_providers);
+}
+
+}  // namespace
+
+TEST(GroupQueryAttentionTest, QuantizedKvCachePromptMatchesFloat) {
+  GqaConfig c;
+  c.batch_size = 2;
+  c.sequence_length = 3;
+  c.num_heads = 2;
+  c.kv_num_heads = 1;
+  c.head_size = 8;
+  c.total_sequence_length = 3;
+  c.seqlens_k = {2, 2};
+
+  const auto query = MakeGqaData(static_cast<size_t>(2) * 3 * 2 * 8, 161);
+  const auto key = MakeQuantGridData(static_cast<size_t>(2) * 3 * 1, 8, 162);
+  const auto value = MakeQuantGridData(static_cast<size_t>(2) * 3 * 1, 8, 163);
+  RunQuantKvGqaOpTest(c, query, key, value, {}, {}, {}, {});
+}
+
+TEST(GroupQueryAttentionTest, QuantizedKvCacheDecodeMatchesFloat) {
+  GqaConfig c;
+  c.batch_size = 2;
+  c.sequence_length = 1;
+  c.num_heads = 2;
+  c.kv_num_heads = 1;
+  c.head_size = 8;
+  c.total_sequence_length = 6;
+  c.seqlens_k = {5, 3};  // ragged totals 6 and 4
+  c.past_sequence_length = 6;
+
+  const auto query = MakeGqaData(static_cast<size_t>(2) * 1 * 2 * 8, 171);
+  const auto key = MakeQuantGridData(static_cast<size_t>(2) * 1 * 1, 8, 172);
+  const auto value = MakeQuantGridData(static_cast<size_t>(2) * 1 * 1, 8, 173);
+  std::vector<int8_t> past_key_quant, past_value_quant;
+  std::vector<float> past_key_dequant, past_value_dequant;
+  MakeQuantPastCache(static_cast<size_t>(2) * 1 * 6, 8, 174, past_key_quant, past_key_dequant);
+  MakeQuantPastCache(static_cast<size_t>(2) * 1 * 6, 8, 175, past_value_quant, past_value_dequant);
+  RunQuantKvGqaOpTest(c, query, key, value, past_key_quant, past_value_quant,
+                      past_key_dequant, past_value_dequant);
+}
+
+// A float past cache must be rejected when the int8 cache is requested.
+TEST(GroupQueryAttentionTest, QuantizedKvCacheRejectsFloatPast) {
+  OpTester test("GroupQueryAttention", 1, kMSDomain);
+  test.AddAttribute<int64_t>("num_heads", 2);
+  test.AddAttribute<int64_t>("kv_num_heads", 1);
+  test.AddAttribute<int64_t>("kv_cache_quant_type", 1);
+
+  test.AddInput<float>("query", {1, 1, 16}, std::vector<float>(16, 0.0f));
+  test.AddInput<float>("key", {1, 1, 8}, std::vector<float>(8, 0.0f));
+  test.AddInput<float>("value", {1, 1, 8}, std::vector<float>(8, 0.0f));
+  test.AddInput<float>("past_key", {1, 1, 2, 12}, std::vector<float>(24, 0.0f));
+  test.AddInput<float>("past_value", {1, 1, 2, 12}, std::vector<float>(24, 0.0f));
+  test.AddInput<int32_t>("seqlens_k", {1}, {2});
+  test.AddInput<int32_t>("total_sequence_length", {1}, {3});
+
+  test.AddOutput<float>("output", {1, 1, 16}, std::vector<float>(16, 0.0f));
+  test.AddOutput<int8_t>("present_key", {1, 1, 3, 12}, std::vector<int8_t>(36, 0));
+  test.AddOutput<int8_t>("present_value", {1, 1, 3, 12}, std::vector<int8_t>(36, 0));
+
+  std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
+  execution_providers.push_back(DefaultCpuExecutionProvider());
+  test.Run(OpTester::ExpectResult::kExpectFailure,
+           "must be int8 tensors when kv_cache_quant_type is 1", {}, nullptr, &execution_providers);
+}
+
+// Only 0 (none) and 1 (int8) are implemented.
+TEST(GroupQueryAttentionTest, QuantizedKvCacheRejectsUnknownType) {
+  OpTester test("GroupQueryAttention", 1, kMSDomain);
+  test.AddAttribute<int64_t>("num_heads", 2);
+  test.AddAttribute<int64_t>("kv_num_heads", 1);
+  test.AddAttribute<int64_t>("kv_cache_quant_type", 2);
+
+  test.AddInput<float>("query", {1, 1, 16}, std::vector<float>(16, 0.0f));
+  test.AddInput<float>("key", {1, 1, 8}, std::vector<float>(8, 0.0f));
+  test.AddInput<float>("value", {1, 1, 8}, std::vector<float>(8, 0.0f));
+  test.AddOptionalInputEdge<float>();
+  test.AddOptionalInputEdge<float>();
+  test.AddInput<int32_t>("seqlens_k", {1}, {0});
+  test.AddInput<int32_t>("total_sequence_length", {1}, {1});
+
+  test.AddOutput<float>("output", {1, 1, 16}, std::vector<float>(16, 0.0f));
+  test.AddOutput<float>("present_key", {1, 1, 1, 8}, std::vector<float>(8, 0.0f));
+  test.AddOutput<float>("present_value", {1, 1, 1, 8}, std::vector<float>(8, 0.0f));
+
+  std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
+  execution_providers.push_back(DefaultCpuExecutionProvider());
+  test.Run(OpTester::ExpectResult::kExpectFailure,
+           "only 0 (none) and 1 (int8) are implemented", {}, nullptr, &execution_providers);
+}
+
+// The paged KV cache keeps its unquantized path; combining it with the int8 cache is rejected.
+TEST(GroupQueryAttentionTest, QuantizedKvCacheRejectsPagedCombination) {
+  OpTester test("GroupQueryAttention", 1, kMSDomain);
+  test.AddAttribute<int64_t>("num_heads", 2);
+  test.AddAttribute<int64_t>("kv_num_heads", 1);
+  test.AddAttribute<int64_t>("kv_cache_quant_type", 1);
+
+  test.AddInput<float>("query", {1, 1, 16}, std::vector<float>(16, 0.0f));
+  test.AddInput<float>("key", {1, 1, 8}, std::vector<float>(8, 0.0f));
+  test.AddInput<float>("value", {1, 1, 8}, std::vector<float>(8, 0.0f));
+  test.AddInput<int8_t>("past_key", {2, 1, 2, 12}, std::vector<int8_t>(48, 0));
+  test.AddInput<int8_t>("past_value", {2, 1, 2, 12}, std::vector<int8_t>(48, 0));
+  test.AddInput<int32_t>("seqlens_k", {1}, {0});
+  test.AddInput<int32_t>("total_sequence_length", {1}, {1});
+  test.AddOptionalInputEdge<float>();
+  test.AddOptionalInputEdge<float>();
+  test.AddInput<int32_t>("block_table", {1, 2}, {0, 1});
+
+  test.AddOutput<float>("output", {1, 1, 16}, std::vector<float>(16, 0.0f));
+  test.AddOutput<int8_t>("present_key", {2, 1, 2, 12}, std::vector<int8_t>(48, 0));
+  test.AddOutput<int8_t>("present_value", {2, 1, 2, 12}, std::vector<int8_t>(48, 0));
+
+  std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
+  execution_providers.push_back(DefaultCpuExecutionProvider());
+  test.Run(OpTester::ExpectResult::kExpectFailure,
+           "not supported together with a paged KV cache", {}, nullptr, &execution_providers);
+}
+
+// The ring cache keeps its unquantized path as well.
+TEST(GroupQueryAttentionTest, QuantizedKvCacheRejectsRingCombination) {
+  OpTester test("GroupQueryAttention", 1, kMSDomain);
+  test.AddAttribute<int64_t>("num_heads", 2);
+  test.AddAttribute<int64_t>("kv_num_heads", 1);
+  test.AddAttribute<int64_t>("kv_cache_quant_type", 1);
+  test.AddAttribute<int64_t>("local_window_size", 4);
+  test.AddAttribute<int64_t>("num_sink_tokens", 2);
+
+  test.AddInput<float>("query", {1, 1, 16}, std::vector<float>(16, 0.0f));
+  test.AddInput<float>("key", {1, 1, 8}, std::vector<float>(8, 0.0f));
+  test.AddInput<float>("value", {1, 1, 8}, std::vector<float>(8, 0.0f));
+  test.AddInput<int8_t>("past_key", {1, 1, 6, 12}, std::vector<int8_t>(72, 0));
+  test.AddInput<int8_t>("past_value", {1, 1, 6, 12}, std::vector<int8_t>(72, 0));
+  test.AddInput<int32_t>("seqlens_k", {1}, {9});
+  test.AddInput<int32_t>("total_sequence_length", {1}, {10});
+
+  test.AddOutput<float>("output", {1, 1, 16}, std::vector<float>(16, 0.0f));
+  test.AddOutput<int8_t>("present_key", {1, 1, 10, 12}, std::vector<int8_t>(120, 0));
+  test.AddOutput<int8_t>("present_value", {1, 1, 10, 12}, std::vector<int8_t>(120, 0));
+
+  std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
+  execution_providers.push_back(DefaultCpuExecutionProvider());
+  test.Run(OpTester::ExpectResult::kExpectFailure,
+           "not supported together with a sliding-window ring KV cache", {}, nullptr,
+           &execution_providers);
+}
+
+#ifdef USE_CUDA
+// The batch restriction for multi-token passes moved out of the shared input checker and into the
+// GPU kernels, whose flash paths still assume a single sequence. CUDA must keep rejecting what the
+// CPU kernel now accepts.
+TEST(GroupQueryAttentionTest, CudaRejectsBatchedMultiTokenPass) {
+  OpTester test("GroupQueryAttention", 1, kMSDomain);
+  test.AddAttribute<int64_t>("num_heads", 2);
+  test.AddAttribute<int64_t>("kv_num_heads", 1);
+
+  test.AddInput<MLFloat16>("query", {2, 2, 16}, ToFloat16(std::vector<float>(64, 0.0f)));
+  test.AddInput<MLFloat16>("key", {2, 2, 8}, ToFloat16(std::vector<float>(32, 0.0f)));
+  test.AddInput<MLFloat16>("value", {2, 2, 8}, ToFloat16(std::vector<float>(32, 0.0f)));
+  test.AddInput<MLFloat16>("past_key", {2, 1, 4, 8}, ToFloat16(std::vector<float>(64, 0.0f)));
+  test.AddInput<MLFloat16>("past_value", {2, 1, 4, 8}, ToFloat16(std::vector<float>(64, 0.0f)));
+  test.AddInput<int32_t>("seqlens_k", {2}, {3, 2});
+  test.AddInput<int32_t>("total_sequence_length", {1}, {4});
+
+  test.AddOutput<MLFloat16>("output", {2, 2, 16}, ToFloat16(std::vector<float>(64, 0.0f)));
+  test.AddOutput<MLFloat16>("present_key", {2, 1, 4, 8}, ToFloat16(std::vector<float>(64, 0.0f)));
+  test.AddOutput<MLFloat16>("present_value", {2, 1, 4, 8}, ToFloat16(std::vector<float>(64, 0.0f)));
+
+  std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
+  execution_providers.push_back(DefaultCudaExecutionProvider());
+  test.Run(OpTester::ExpectResult::kExpectFailure,
+           "batch_size must be 1 when sequence_length > 1 and past context is given", {}, nullptr,
+           &execution_providers);
+}
+
+// The paged KV cache is CPU-only; CUDA rejects block_table instead of silently ignoring it.
+TEST(GroupQueryAttentionTest, CudaRejectsBlockTable) {
+  OpTester test("GroupQueryAttention", 1, kMSDomain);
+  test.AddAttribute<int64_t>("num_heads", 2);
+  test.AddAttribute<int64_t>("kv_num_heads", 1);
+
+  test.AddInput<MLFloat16>("query", {1, 1, 16}, ToFloat16(std::vector<float>(16, 0.0f)));
+  test.AddInput<MLFloat16>("key", {1, 1, 8}, ToFloat16(std::vector<float>(8, 0.0f)));
+  test.AddInput<MLFloat16>("value", {1, 1, 8}, ToFloat16(std::vector<float>(8, 0.0f)));
+  test.AddInput<MLFloat16>("past_key", {2, 1, 2, 8}, ToFloat16(std::vector<float>(32, 0.0f)));
+  test.AddInput<MLFloat16>("past_value", {2, 1, 2, 8}, ToFloat16(std::vector<float>(32, 0.0f)));
+  test.AddInput<int32_t>("seqlens_k", {1}, {0});
+  test.AddInput<int32_t>("total_sequence_length", {1}, {1});
+  test.AddOptionalInputEdge<MLFloat16>();
+  test.AddOptionalInputEdge<MLFloat16>();
+  test.AddInput<int32_t>("block_table", {1, 2}, {0, 1});
+
+  test.AddOutput<MLFloat16>("output", {1, 1, 16}, ToFloat16(std::vector<float>(16, 0.0f)));
+  test.AddOutput<MLFloat16>("present_key", {2, 1, 2, 8}, ToFloat16(std::vector<float>(32, 0.0f)));
+  test.AddOutput<MLFloat16>("present_value", {2, 1, 2, 8}, ToFloat16(std::vector<float>(32, 0.0f)));
+
+  std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
+  execution_providers.push_back(DefaultCudaExecutionProvider());
+  test.Run(OpTester::ExpectResult::kExpectFailure,
+           "Paged KV cache (block_table) is not implemented for CUDA", {}, nullptr,
+           &execution_providers);
+}
+#endif  // USE_CUDA
+
+}  // namespace test
+}  // namespace onnxruntime
@@ -1272,5 +1272,94 @@ TEST(MoETest, QMoETest_Mixtral_Int4) {
 }
 #endif
 
+// The CPU kernel runs everywhere, so the CPU tests use small hand-computed cases instead of the
+// generated fixtures above.
+static void RunCpuMoETest(const std::vector<float>& input, const std::vector<float>& router_probs,
+                          const std::vector<float>& fc1_experts_weights,
+                          const std::vector<float>& fc2_experts_weights,
+                          const std::vector<float>& fc3_experts_weights, const std::vector<float>& fc1_experts_bias,
+                          const std::vector<float>& fc2_experts_bias, const std::vector<float>& output_data,
+                          int num_rows, int num_experts, int hidden_size, int inter_size, std::string activation_type,
+                          int normalize_routing_weights, int top_k) {
+  OpTester tester("MoE", 1, onnxruntime::kMSDomain);
+  tester.AddAttribute<int64_t>("k", static_cast<int64_t>(top_k));
+  tester.AddAttribute<std::string>("activation_type", activation_type);
+  tester.AddAttribute<int64_t>("normalize_routing_weights", static_cast<int64_t>(normalize_routing_weights));
+
+  std::vector<int64_t> input_dims = {num_rows, hidden_size};
+  std::vector<int64_t> router_probs_dims = {num_rows, num_experts};
+  std::vector<int64_t> fc1_experts_weights_dims = {num_experts, hidden_size, inter_size};
+  std::vector<int64_t> fc2_experts_weights_dims = {num_experts, inter_size, hidden_size};
+  std::vector<int64_t> fc3_experts_weights_dims = fc1_experts_weights_dims;
+  std::vector<int64_t> fc1_experts_bias_dims = {num_experts, inter_size};
+  std::vector<int64_t> fc2_experts_bias_dims = {num_experts, hidden_size};
+  std::vector<int64_t> output_dims = {num_rows, hidden_size};
+
+  tester.AddInput<float>("input", input_dims, input);
+  tester.AddInput<float>("router_probs", router_probs_dims, router_probs);
+  tester.AddInput<float>("fc1_experts_weights", fc1_experts_weights_dims, fc1_experts_weights);
+  if (!fc1_experts_bias.empty()) {
+    tester.AddInput<float>("fc1_experts_bias", fc1_experts_bias_dims, fc1_experts_bias);
+  } else {
+    tester.AddOptionalInputEdge<float>();
+  }
+  tester.AddInput<float>("fc2_experts_weights", fc2_experts_weights_dims, fc2_experts_weights);
+  if (!fc2_experts_bias.empty()) {
+    tester.AddInput<float>("fc2_experts_bias", fc2_experts_bias_dims, fc2_experts_bias);
+  } else {
+    tester.AddOptionalInputEdge<float>();
+  }
+  if (!fc3_experts_weights.empty()) {
+    tester.AddInput<float>("fc3_experts_weights", fc3_experts_weights_dims, fc3_experts_weights);
+  }
+  tester.AddOutput<float>("output", output_dims, output_data);
+  tester.SetOutputTolerance(0.0001f);
+
+  std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
+  execution_providers.push_back(DefaultCpuExecutionProvider());
+  tester.Run(OpTester::ExpectResult::kExpectSuccess, "", {}, nullptr, &execution_providers);
+}
+
+TEST(MoETest, MoECpuTop1WithBias) {
+  int num_rows = 2;
+  int num_experts = 2;
+  int hidden_size = 2;
+  int inter_size = 2;
+
+  const std::vector<float> input = {1.0f, 2.0f, -1.0f, 0.5f};
+  const std::vector<float> router_probs = {0.5f, 1.5f, 2.0f, 1.0f};
+  const std::vector<float> fc1_experts_weights = {1.0f, 0.0f, 0.0f, 1.0f, 0.5f, -0.5f, 1.0f, 1.0f};
+  const std::vector<float> fc1_experts_bias = {0.1f, -0.1f, 0.0f, 0.2f};
+  const std::vector<float> fc2_experts_weights = {1.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f};
+  const std::vector<float> fc2_experts_bias = {0.0f, 0.5f, 0.2f, -0.2f};
+
+  // row 0 routes to expert 1, row 1 to expert 0; both are scaled by the softmax weight 0.7310586
+  const std::vector<float> output = {1.9738581f, 1.0965879f, 0.0f, 0.6579527f};
+
+  RunCpuMoETest(input, router_probs, fc1_experts_weights, fc2_experts_weights, {}, fc1_experts_bias, fc2_experts_bias,
+                output, num_rows, num_experts, hidden_size, inter_size, "relu",
+                0 /*normalize_routing_weights*/, 1 /*top_k*/);
+}
+
+TEST(MoETest, MoECpuTop2SiluGated) {
+  int num_rows = 2;
+  int num_experts = 2;
+  int hidden_size = 2;
+  int inter_size = 2;
+
+  const std::vector<float> input = {1.0f, 2.0f, -1.0f, 0.5f};
+  const std::vector<float> router_probs = {0.5f, 1.5f, 2.0f, 1.0f};
+  const std::vector<float> fc1_experts_weights = {1.0f, 0.0f, 0.0f, 1.0f, 0.5f, -0.5f, 1.0f, 1.0f};
+  const std::vector<float> fc2_experts_weights = {1.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f};
+  const std::vector<float> fc3_experts_weights = {1.0f, 1.0f, 0.5f, -0.5f, -0.5f, 1.0f, 1.0f, 0.5f};
+
+  // Mixtral-style gated FFN: silu(fc1(x)) * fc3(x) -> fc2, both experts blended per row
+  const std::vector<float> output = {2.9267306f, 2.1863084f, 0.1474589f, -0.2844089f};
+
+  RunCpuMoETest(input, router_probs, fc1_experts_weights, fc2_experts_weights, fc3_experts_weights, {}, {},
+                output, num_rows, num_experts, hidden_size, inter_size, "silu",
+                1 /*normalize_routing_weights*/, 2 /*top_k*/);
+}
+
 }  // namespace test
 }  // namespace onnxruntime
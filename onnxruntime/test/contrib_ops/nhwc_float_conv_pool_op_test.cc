@@ -0,0 +1,543 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+//
+// Test module for the float NHWC internal operators handled by the CPU
+// execution provider.
+//
+
+#include <algorithm>
+#include <numeric>
+
+#include "core/util/math.h"
+#include "gtest/gtest.h"
+#include "test/providers/provider_test_utils.h"
+
+namespace onnxruntime {
+namespace test {
+namespace {
+
+size_t ShapeSize(const std::vector<int64_t>& shape) {
+  return static_cast<size_t>(std::accumulate(shape.cbegin(), shape.cend(), 1LL, std::multiplies<int64_t>()));
+}
+
+bool NextPosition(int64_t N, const int64_t* shape, int64_t* dims) {
+  // Loop over spatial axes in reverse order to choose an index, like counting.
+  bool incremented = false;
+  for (int64_t d_i = N - 1; d_i >= 0; --d_i) {
+    int64_t d_max = shape[d_i];
+    ORT_ENFORCE(dims[d_i] < d_max);
+    if (dims[d_i] == d_max - 1) {
+      dims[d_i] = 0;
+    } else {  // dims[d_i] < d_max - 1
+      ++dims[d_i];
+      incremented = true;
+      break;
+    }
+  }
+  return incremented;
+}
+
+void FillRandomData(std::vector<float>& data, size_t size) {
+  constexpr float MinimumFillValue = -23.0f;
+  static size_t offset = 7;
+  data.resize(size);
+  for (size_t n = 0; n < size; n++) {
+    offset = (offset + 31) % 47;
+    data[n] = (MinimumFillValue + offset) / 16.0f;
+  }
+}
+
+}  // namespace
+
+class NhwcFloatConvOpTester {
+ private:
+  std::vector<float> X_data_;
+  std::vector<int64_t> X_shape_;
+  std::vector<float> W_data_;
+  std::vector<int64_t> W_shape_;
+  std::vector<float> B_data_;
+  std::vector<int64_t> pads_;
+  std::vector<int64_t> strides_;
+  std::vector<int64_t> dilations_;
+  int64_t group_{1};
+
+  void ComputeExpectedOutput(std::vector<float>& Y_data, std::vector<int64_t>& Y_shape) const {
+    ORT_ENFORCE(W_shape_.size() >= 2 && X_shape_.size() == W_shape_.size());
+
+    const size_t kernel_rank = W_shape_.size() - 2;
+
+    const int64_t batch_count = X_shape_[0];
+    const int64_t channels = X_shape_[X_shape_.size() - 1];
+    const int64_t output_channels = W_shape_[0];
+    const int64_t group_input_channels = W_shape_[1];
+    const int64_t group_output_channels = output_channels / group_;
+
+    std::vector<int64_t> pads(pads_);
+    if (pads.empty()) {
+      pads.resize(kernel_rank * 2, 0);
+    }
+    std::vector<int64_t> dilations(dilations_);
+    if (dilations.empty()) {
+      dilations.resize(kernel_rank, 1);
+    }
+    std::vector<int64_t> strides(strides_);
+    if (strides.empty()) {
+      strides.resize(kernel_rank, 1);
+    }
+
+    const int64_t* input_shape = X_shape_.data() + 1;
+    const int64_t* kernel_shape = W_shape_.data() + 2;
+
+    // Compute the expected shape of the output.
+    Y_shape.reserve(kernel_rank + 2);
+    Y_shape.push_back(batch_count);
+    for (size_t n = 0; n < kernel_rank; n++) {
+      Y_shape.push_back(((input_shape[n] + pads[n] + pads[kernel_rank + n]) -
+                         (dilations[n] * (kernel_shape[n] - 1) + 1)) /
+                            strides[n] +
+                        1);
+    }
+    Y_shape.push_back(output_channels);
+    Y_data.resize(ShapeSize(Y_shape));
+
+    const int64_t* output_shape = Y_shape.data() + 1;
+
+    const int64_t input_image_size = std::accumulate(
+        input_shape, input_shape + kernel_rank, 1LL, std::multiplies<int64_t>());
+    const int64_t kernel_size = std::accumulate(
+        kernel_shape, kernel_shape + kernel_rank, 1LL, std::multiplies<int64_t>());
+
+    const float* Xdata = X_data_.data();
+    float* Ydata = Y_data.data();
+
+    for (int64_t batch = 0; batch < batch_count; batch++) {
+      std::vector<int64_t> d_output(kernel_rank, 0);
+      std::vector<int64_t> d_kernel(kernel_rank, 0);
+      do {
+        for (int64_t m = 0; m < output_channels; m++) {
+          const int64_t group_id = m / group_output_channels;
+          float acc = B_data_.empty() ? 0.0f : B_data_[static_cast<size_t>(m)];
+          const float* weight = W_data_.data() + m * group_input_channels * kernel_size;
+          int64_t kernel_index = 0;
+          std::fill(d_kernel.begin(), d_kernel.end(), 0);
+          do {
+            int64_t input_offset = 0;
+            bool is_padding = false;
+            for (size_t axis = 0; axis < kernel_rank; ++axis) {
+              int64_t input_dim = d_kernel[axis] * dilations[axis] + d_output[axis] * strides[axis] - pads[axis];
+              is_padding |= !math::is_a_ge_zero_and_a_lt_b(input_dim, input_shape[axis]);
+              input_offset *= input_shape[axis];
+              input_offset += input_dim;
+            }
+            if (!is_padding) {
+              const float* data_ptr = Xdata + input_offset * channels + group_id * group_input_channels;
+              for (int64_t c = 0; c < group_input_channels; c++) {
+                acc += data_ptr[c] * weight[c * kernel_size + kernel_index];
+              }
+            }
+            kernel_index++;
+          } while (NextPosition(kernel_rank, kernel_shape, d_kernel.data()));
+          Ydata[m] = acc;
+        }
+        Ydata += output_channels;
+      } while (NextPosition(kernel_rank, output_shape, d_output.data()));
+      Xdata += channels * input_image_size;
+    }
+  }
+
+ public:
+  void GenerateRandomInput(const std::vector<int64_t>& shape) {
+    FillRandomData(X_data_, ShapeSize(shape));
+    X_shape_ = shape;
+  }
+
+  void GenerateRandomWeights(const std::vector<int64_t>& shape) {
+    FillRandomData(W_data_, ShapeSize(shape));
+    W_shape_ = shape;
+  }
+
+  void GenerateRandomBias() {
+    FillRandomData(B_data_, static_cast<size_t>(W_shape_[0]));
+  }
+
+  void SetPads(const std::vector<int64_t>& pads) {
+    pads_ = pads;
+  }
+
+  void SetStrides(const std::vector<int64_t>& strides) {
+    strides_ = strides;
+  }
+
+  void SetDilations(const std::vector<int64_t>& dilations) {
+    dilations_ = dilations;
+  }
+
+  void SetGroup(int64_t group) {
+    group_ = group;
+  }
+
+  void Run() {
+    std::vector<float> Y_data;
+    std::vector<int64_t> Y_shape;
+    ComputeExpectedOutput(Y_data, Y_shape);
+
+    OpTester test("Conv", 11, onnxruntime::kMSInternalNHWCDomain);
+    test.AddInput<float>("X", X_shape_, X_data_);
+    test.AddInput<float>("W", W_shape_, W_data_, true);
+    if (!B_data_.empty()) {
+      test.AddInput<float>("B", {W_shape_[0]}, B_data_, true);
+    }
+    test.AddOutput<float>("Y", Y_shape, Y_data);
+    test.AddAttribute("group", group_);
+    test.AddAttribute("kernel_shape", std::vector<int64_t>(W_shape_.begin() + 2, W_shape_.end()));
+    if (!pads_.empty()) {
+      test.AddAttribute("pads", pads_);
+    }
+    if (!strides_.empty()) {
+      test.AddAttribute("strides", strides_);
+    }
+    if (!dilations_.empty()) {
+      test.AddAttribute("dilations", dilations_);
+    }
+    test.Run(OpTester::ExpectResult::kExpectSuccess, "");
+  }
+};
+
+TEST(NhwcFloatConvOpTest, Conv1D) {
+  NhwcFloatConvOpTester test;
+  test.GenerateRandomInput({1, 25, 8});
+  test.GenerateRandomWeights({12, 8, 5});
+  test.GenerateRandomBias();
+  test.SetPads({2, 2});
+  test.Run();
+}
+
+TEST(NhwcFloatConvOpTest, Conv2D) {
+  NhwcFloatConvOpTester test;
+  test.GenerateRandomInput({2, 15, 19, 7});
+  test.GenerateRandomWeights({15, 7, 3, 5});
+  test.GenerateRandomBias();
+  test.SetPads({1, 2, 1, 2});
+  test.Run();
+}
+
+TEST(NhwcFloatConvOpTest, Conv2DNoBias) {
+  NhwcFloatConvOpTester test;
+  test.GenerateRandomInput({1, 13, 13, 4});
+  test.GenerateRandomWeights({9, 4, 3, 3});
+  test.SetPads({1, 1, 1, 1});
+  test.Run();
+}
+
+TEST(NhwcFloatConvOpTest, Conv2DStridesAndDilations) {
+  NhwcFloatConvOpTester test;
+  test.GenerateRandomInput({1, 23, 19, 5});
+  test.GenerateRandomWeights({8, 5, 3, 3});
+  test.GenerateRandomBias();
+  test.SetPads({2, 2, 2, 2});
+  test.SetStrides({2, 2});
+  test.SetDilations({2, 2});
+  test.Run();
+}
+
+TEST(NhwcFloatConvOpTest, Conv2DPointwise) {
+  NhwcFloatConvOpTester test;
+  test.GenerateRandomInput({1, 11, 13, 16});
+  test.GenerateRandomWeights({24, 16, 1, 1});
+  test.GenerateRandomBias();
+  test.Run();
+}
+
+TEST(NhwcFloatConvOpTest, Conv2DGrouped) {
+  NhwcFloatConvOpTester test;
+  test.GenerateRandomInput({1, 13, 15, 12});
+  test.GenerateRandomWeights({16, 3, 3, 3});
+  test.GenerateRandomBias();
+  test.SetGroup(4);
+  test.SetPads({1, 1, 1, 1});
+  test.Run();
+}
+
+TEST(NhwcFloatConvOpTest, Conv2DDepthwise) {
+  for (int64_t channels = 1; channels < 52; channels += 5) {
+    NhwcFloatConvOpTester test;
+    test.GenerateRandomInput({1, 17, 13, channels});
+    test.GenerateRandomWeights({channels, 1, 3, 3});
+    test.GenerateRandomBias();
+    test.SetGroup(channels);
+    test.SetPads({1, 1, 1, 1});
+    test.Run();
+  }
+}
+
+TEST(NhwcFloatConvOpTest, Conv3D) {
+  NhwcFloatConvOpTester test;
+  test.GenerateRandomInput({1, 9, 11, 13, 4});
+  test.GenerateRandomWeights({6, 4, 2, 3, 3});
+  test.GenerateRandomBias();
+  test.SetPads({0, 1, 1, 1, 1, 0});
+  test.Run();
+}
+
+class NhwcFloatPoolOpTester {
+ private:
+  bool is_max_pool_;  // max or average pool
+  std::vector<float> X_data_;
+  std::vector<int64_t> X_shape_;
+  std::vector<int64_t> kernel_shape_;
+  std::vector<int64_t> pads_;
+  std::vector<int64_t> strides_;
+  std::vector<int64_t> dilations_;
+
+  void ComputeExpectedOutput(std::vector<float>& Y_data, std::vector<int64_t>& Y_shape) const {
+    ORT_ENFORCE(X_shape_.size() >= 2 && X_shape_.size() == kernel_shape_.size() + 2);
+
+    const size_t kernel_rank = kernel_shape_.size();
+
+    const int64_t batch_count = X_shape_[0];
+    const int64_t channels = X_shape_[X_shape_.size() - 1];
+
+    std::vector<int64_t> pads(pads_);
+    if (pads.empty()) {
+      pads.resize(kernel_rank * 2, 0);
+    }
+    std::vector<int64_t> dilations(dilations_);
+    if (dilations.empty()) {
+      dilations.resize(kernel_rank, 1);
+    }
+    std::vector<int64_t> strides(strides_);
+    if (strides.empty()) {
+      strides.resize(kernel_rank, 1);
+    }
+
+    const int64_t* input_shape = X_shape_.data() + 1;
+
+    // Compute the expected shape of the output.
+    Y_shape.reserve(kernel_rank + 2);
+    Y_shape.push_back(batch_count);
+    for (size_t n = 0; n < kernel_rank; n++) {
+      Y_shape.push_back(((input_shape[n] + pads[n] + pads[kernel_rank + n]) -
+                         (dilations[n] * (kernel_shape_[n] - 1) + 1)) /
+                            strides[n] +
+                        1);
+    }
+    Y_shape.push_back(channels);
+    Y_data.resize(ShapeSize(Y_shape));
+
+    const int64_t* output_shape = Y_shape.data() + 1;
+
+    const int64_t input_image_size = std::accumulate(
+        input_shape, input_shape + kernel_rank, 1LL, std::multiplies<int64_t>());
+
+    const float* Xdata = X_data_.data();
+    float* Ydata = Y_data.data();
+
+    for (int64_t batch = 0; batch < batch_count; batch++) {
+      std::vector<int64_t> d_output(kernel_rank, 0);
+      std::vector<int64_t> d_kernel(kernel_rank, 0);
+      do {
+        std::vector<float> accs(static_cast<size_t>(channels),
+                                is_max_pool_ ? std::numeric_limits<float>::lowest() : 0.f);
+        size_t cnt = 0;
+        do {
+          int64_t input_offset = 0;
+          bool is_padding = false;
+          for (size_t axis = 0; axis < kernel_rank; ++axis) {
+            int64_t input_dim = d_kernel[axis] * dilations[axis] + d_output[axis] * strides[axis] - pads[axis];
+            is_padding |= !math::is_a_ge_zero_and_a_lt_b(input_dim, input_shape[axis]);
+            input_offset *= input_shape[axis];
+            input_offset += input_dim;
+          }
+          if (!is_padding) {
+            const float* data_ptr = Xdata + input_offset * channels;
+            cnt++;
+            for (int64_t c = 0; c < channels; c++) {
+              if (is_max_pool_) {
+                accs[static_cast<size_t>(c)] = std::max(accs[static_cast<size_t>(c)], data_ptr[c]);
+              } else {
+                accs[static_cast<size_t>(c)] += data_ptr[c];
+              }
+            }
+          }
+        } while (NextPosition(kernel_rank, kernel_shape_.data(), d_kernel.data()));
+        for (int64_t c = 0; c < channels; c++) {
+          if (!is_max_pool_) {
+            accs[static_cast<size_t>(c)] /= cnt;
+          }
+          Ydata[c] = accs[static_cast<size_t>(c)];
+        }
+        Ydata += channels;
+      } while (NextPosition(kernel_rank, output_shape, d_output.data()));
+      Xdata += channels * input_image_size;
+    }
+  }
+
+ public:
+  NhwcFloatPoolOpTester(bool is_max_pool) : is_max_pool_(is_max_pool) {
+  }
+
+  void GenerateRandomInput(const std::vector<int64_t>& shape) {
+    FillRandomData(X_data_, ShapeSize(shape));
+    X_shape_ = shape;
+  }
+
+  void SetKernelShape(const std::vector<int64_t>& kernel_shape) {
+    kernel_shape_ = kernel_shape;
+  }
+
+  void SetPads(const std::vector<int64_t>& pads) {
+    pads_ = pads;
+  }
+
+  void SetStrides(const std::vector<int64_t>& strides) {
+    strides_ = strides;
+  }
+
+  void SetDilations(const std::vector<int64_t>& dilations) {
+    dilations_ = dilations;
+  }
+
+  void Run() {
+    std::vector<float> Y_data;
+    std::vector<int64_t> Y_shape;
+    ComputeExpectedOutput(Y_data, Y_shape);
+
+    OpTester test(is_max_pool_ ? "MaxPool" : "AveragePool", is_max_pool_ ? 12 : 11, onnxruntime::kMSInternalNHWCDomain);
+    test.AddInput<float>("x", X_shape_, X_data_);
+    test.AddOutput<float>("y", Y_shape, Y_data);
+    test.AddAttribute("kernel_shape", kernel_shape_);
+    if (!pads_.empty()) {
+      test.AddAttribute("pads", pads_);
+    }
+    if (!strides_.empty()) {
+      test.AddAttribute("strides", strides_);
+    }
+    if (!dilations_.empty()) {
+      test.AddAttribute("dilations", dilations_);
+    }
+    test.Run(OpTester::ExpectResult::kExpectSuccess, "");
+  }
+};
+
+TEST(NhwcFloatPoolOpTest, MaxPool1D) {
+  NhwcFloatPoolOpTester test(true);
+  test.GenerateRandomInput({1, 23, 17});
+  test.SetKernelShape({5});
+  test.SetPads({2, 2});
+  test.Run();
+}
+
+TEST(NhwcFloatPoolOpTest, MaxPool2D) {
+  for (int64_t channels = 1; channels < 94; channels += 9) {
+    NhwcFloatPoolOpTester test(true);
+    test.GenerateRandomInput({1, 15, 19, channels});
+    test.SetKernelShape({3, 5});
+    test.SetPads({1, 1, 1, 1});
+    test.Run();
+  }
+}
+
+TEST(NhwcFloatPoolOpTest, MaxPool3D) {
+  NhwcFloatPoolOpTester test(true);
+  test.GenerateRandomInput({1, 9, 13, 15, 11});
+  test.SetKernelShape({2, 4, 6});
+  test.SetPads({0, 0, 0, 1, 1, 1});
+  test.Run();
+}
+
+TEST(NhwcFloatPoolOpTest, MaxPoolStrides) {
+  NhwcFloatPoolOpTester test(true);
+  test.GenerateRandomInput({4, 23, 19, 32});
+  test.SetKernelShape({3, 3});
+  test.SetStrides({2, 2});
+  test.Run();
+}
+
+TEST(NhwcFloatPoolOpTest, MaxPoolDilations) {
+  NhwcFloatPoolOpTester test(true);
+  test.GenerateRandomInput({4, 23, 19, 32});
+  test.SetKernelShape({3, 3});
+  test.SetDilations({2, 2});
+  test.Run();
+}
+
+TEST(NhwcFloatPoolOpTest, AvgPool1D) {
+  NhwcFloatPoolOpTester test(false);
+  test.GenerateRandomInput({1, 23, 17});
+  test.SetKernelShape({5});
+  test.SetPads({2, 2});
+  test.Run();
+}
+
+TEST(NhwcFloatPoolOpTest, AvgPool2D) {
+  for (int64_t channels = 1; channels < 94; channels += 9) {
+    NhwcFloatPoolOpTester test(false);
+    test.GenerateRandomInput({1, 15, 19, channels});
+    test.SetKernelShape({3, 5});
+    test.SetPads({1, 1, 1, 1});
+    test.Run();
+  }
+}
+
+TEST(NhwcFloatPoolOpTest, AvgPool3D) {
+  NhwcFloatPoolOpTester test(false);
+  test.GenerateRandomInput({1, 9, 13, 15, 11});
+  test.SetKernelShape({2, 4, 6});
+  test.SetPads({0, 0, 0, 1, 1, 1});
+  test.Run();
+}
+
+TEST(NhwcFloatPoolOpTest, AvgPoolStrides) {
+  NhwcFloatPoolOpTester test(false);
+  test.GenerateRandomInput({4, 23, 19, 32});
+  test.SetKernelShape({3, 3});
+  test.SetStrides({2, 2});
+  test.Run();
+}
+
+TEST(NhwcFloatPoolOpTest, AvgPoolIncludePadPixel) {
+  OpTester test("AveragePool", 11, onnxruntime::kMSInternalNHWCDomain);
+
+  test.AddAttribute("auto_pad", "");
+  test.AddAttribute("strides", std::vector<int64_t>{1, 1});
+  test.AddAttribute("pads", std::vector<int64_t>{1, 1, 1, 1});
+  test.AddAttribute("kernel_shape", std::vector<int64_t>{2, 2});
+  test.AddAttribute("count_include_pad", (int64_t)1);
+  std::vector<float> x_vals = {
+      0.3337f, 0.8794f, 0.3375f,
+      0.6666f, 0.4426f, 0.6474f,
+      0.7675f, 0.8823f, 0.8852f};
+
+  std::vector<int64_t> x_dims = {1, 3, 3, 1};
+  std::vector<int64_t> expected_dims = {1, 4, 4, 1};
+  std::vector<float> expected_vals = {
+      0.083425f, 0.303275f, 0.304225f, 0.084375f,
+      0.250075f, 0.580575f, 0.576675f, 0.246225f,
+      0.358525f, 0.689750f, 0.714375f, 0.383150f,
+      0.191875f, 0.412450f, 0.441875f, 0.221300f};
+
+  test.AddInput<float>("X", x_dims, x_vals);
+  test.AddOutput<float>("Y", expected_dims, expected_vals);
+  test.Run();
+}
+
+TEST(NhwcFloatPoolOpTest, GlobalAveragePool) {
+  OpTester test("GlobalAveragePool", 1, onnxruntime::kMSInternalNHWCDomain);
+
+  std::vector<float> x_vals = {
+      1.0f, -2.0f, 3.0f,
+      5.0f, 6.0f, -7.0f,
+      -9.0f, 10.0f, 11.0f,
+      13.0f, -14.0f, 15.0f};
+  std::vector<int64_t> x_dims = {1, 2, 2, 3};
+  std::vector<int64_t> expected_dims = {1, 1, 1, 3};
+  std::vector<float> expected_vals = {2.5f, 0.0f, 5.5f};
+
+  test.AddInput<float>("X", x_dims, x_vals);
+  test.AddOutput<float>("Y", expected_dims, expected_vals);
+  test.Run();
+}
+
+}  // namespace test
+}  // namespace onnxruntime
@@ -56,10 +56,11 @@ static void RunPackedMultiHeadAttentionTest(
     bool broadcast_attention_bias) {
   int min_cuda_architecture = use_float16 ? 530 : 0;
   bool enable_cuda = HasCudaEnvironment(min_cuda_architecture);
+  bool enable_cpu = !use_float16 && (nullptr != DefaultCpuExecutionProvider().get());
 
   int64_t head_size = static_cast<int64_t>(hidden_size / number_of_heads);
 
-  if (enable_cuda) {
+  if (enable_cuda || enable_cpu) {
     OpTester tester("PackedMultiHeadAttention", 1, onnxruntime::kMSDomain);
     tester.AddAttribute<int64_t>("num_heads", static_cast<int64_t>(number_of_heads));
     if (use_scale) {
@@ -135,9 +136,17 @@ static void RunPackedMultiHeadAttentionTest(
       tester.SetOutputTolerance(0.001f, 0.001f);
     }
 
-    std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
-    execution_providers.push_back(DefaultCudaExecutionProvider());
-    tester.Run(OpTester::ExpectResult::kExpectSuccess, "", {}, nullptr, &execution_providers);
+    if (enable_cuda) {
+      std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
+      execution_providers.push_back(DefaultCudaExecutionProvider());
+      tester.Run(OpTester::ExpectResult::kExpectSuccess, "", {}, nullptr, &execution_providers);
+    }
+
+    if (enable_cpu) {
+      std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
+      execution_providers.push_back(DefaultCpuExecutionProvider());
+      tester.Run(OpTester::ExpectResult::kExpectSuccess, "", {}, nullptr, &execution_providers);
+    }
   }
 }
 
@@ -0,0 +1,65 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "gtest/gtest.h"
+#include "test/providers/provider_test_utils.h"
+
+namespace onnxruntime {
+namespace test {
+
+template <typename T>
+void RunQLinearLayerNorm(
+    const std::vector<int64_t>& shape,
+    const std::vector<T>& x,
+    float x_scale,
+    T x_zero_point,
+    const std::vector<int64_t>& scale_shape,
+    const std::vector<float>& scale,
+    const std::vector<float>& bias,
+    float y_scale,
+    T y_zero_point,
+    const std::vector<T>& y) {
+  OpTester test("QLinearLayerNormalization", 1, onnxruntime::kMSDomain);
+  test.AddAttribute<int64_t>("axis", -1);
+  test.AddAttribute<float>("epsilon", 1e-5f);
+  test.AddInput<T>("X", shape, x);
+  test.AddInput<float>("X_scale", {}, {x_scale}, true);
+  test.AddInput<T>("X_zero_point", {}, {x_zero_point}, true);
+  test.AddInput<float>("Scale", scale_shape, scale, true);
+  test.AddInput<float>("B", scale_shape, bias, true);
+  test.AddInput<float>("Y_scale", {}, {y_scale}, true);
+  test.AddInput<T>("Y_zero_point", {}, {y_zero_point}, true);
+  test.AddOutput<T>("Y", shape, y);
+  test.Run(OpTester::ExpectResult::kExpectSuccess);
+}
+
+TEST(QLinearLayerNormTest, Uint8) {
+  RunQLinearLayerNorm<uint8_t>(
+      {2, 4},
+      {113, 118, 180, 128,
+       93, 178, 83, 152},
+      0.05f, 128,
+      {4},
+      {1.0f, 0.5f, 2.0f, 1.0f},
+      {0.1f, -0.1f, 0.0f, 0.2f},
+      0.05f, 128,
+      {114, 120, 196, 127,
+       113, 139, 84, 145});
+}
+
+TEST(QLinearLayerNormTest, Int8) {
+  RunQLinearLayerNorm<int8_t>(
+      {2, 4},
+      {75, 88, -67, -21,
+       28, -44, 67, -32},
+      0.025f, 0,
+      {4},
+      {1.0f, 0.5f, 2.0f, 1.0f},
+      {0.1f, -0.1f, 0.0f, 0.2f},
+      0.05f, 0,
+      {19, 9, -53, -8,
+       12, -13, 55, -12});
+}
+
+}  // namespace test
+}  // namespace onnxruntime
@@ -11,6 +11,7 @@
 #include "test/common/tensor_op_test_utils.h"
 #include "test/common/cuda_op_test_utils.h"
 #include "test/providers/provider_test_utils.h"
+#include "core/session/onnxruntime_session_options_config_keys.h"
 #include "core/util/qmath.h"
 #include "core/quantization/quantization.h"
 
@@ -612,6 +613,68 @@ TEST(QAttentionTest, QAttentionNoMaskIndex) {
                    batch_size, sequence_length, hidden_size, number_of_heads);
 }
 
+// Same case as QAttentionNoMaskIndex, but with the quantized attention core enabled so
+// QK^T and the context GEMM run in int8. The core requantizes dynamically, so the result
+// only approximates the fp32 reference; the tolerance is correspondingly wider.
+TEST(QAttentionTest, QAttentionNoMaskIndexQuantizedCore) {
+  int batch_size = 1;
+  int sequence_length = 2;
+  int hidden_size = 4;
+  int number_of_heads = 2;
+
+  std::vector<float> input_data = {
+      0.8f, -0.5f, 0.0f, 1.f,
+      0.5f, 0.2f, 0.3f, -0.6f};
+
+  std::vector<float> weight_data = {
+      0.1f, -0.2f, 0.3f, 1.0f, 1.1f, 0.3f, 0.5f, 0.2f, 0.3f, -0.6f, 1.5f, 2.0f,
+      0.5f, 0.1f, 0.4f, 1.6f, 1.0f, 2.0f, 0.4f, 0.8f, 0.9f, 0.1f, -1.3f, 0.7f,
+      0.3f, 0.2f, 4.0f, 2.2f, 1.6f, 1.1f, 0.7f, 0.2f, 0.4f, 1.0f, 1.2f, 0.5f,
+      0.2f, 0.1f, 0.4f, 1.6f, 2.4f, 3.3f, 2.1f, 4.2f, 8.4f, 0.0f, 2.1f, 3.2f};
+
+  std::vector<float> bias_data = {
+      -0.5f, 0.6f, 1.2f, 2.1f, 0.5f, 0.7f, 0.2f, 1.2f, 0.5f, 0.4f, 0.3f, 1.2f};
+
+  std::vector<float> output_data = {
+      3.1495983600616455f, 0.10843668878078461f, 4.25f, 5.6499996185302734f,
+      3.9696791172027588f, 0.073143675923347473f, 4.2499995231628418f, 5.6499991416931152f};
+
+  quantization::Params<uint8_t> input_quant_params(/*scale=*/0.1f, /*zero_point=*/128);
+  quantization::Params<int8_t> weight_quant_params(/*scale=*/0.1f, /*zero_point=*/1);
+
+  OpTester tester("QAttention", 1, onnxruntime::kMSDomain);
+  tester.AddAttribute<int64_t>("num_heads", static_cast<int64_t>(number_of_heads));
+
+  std::vector<int64_t> input_dims = {batch_size, sequence_length, hidden_size};
+  std::vector<int64_t> weights_dims = {hidden_size, static_cast<int64_t>(3 * hidden_size)};
+  std::vector<int64_t> bias_dims = {static_cast<int64_t>(3 * hidden_size)};
+  std::vector<int64_t> output_dims = {batch_size, sequence_length, hidden_size};
+
+  tester.AddInput<uint8_t>("input", input_dims,
+                           QuantizeTestVector<uint8_t>(input_data, input_quant_params));
+  tester.AddInput<int8_t>("weight", weights_dims,
+                          QuantizeTestVector<int8_t>(weight_data, weight_quant_params));
+  tester.AddInput<float>("bias", bias_dims, bias_data);
+  tester.AddInput<float>("input_scale", {1}, {input_quant_params.scale});
+  tester.AddInput<float>("weight_scale", {1}, {weight_quant_params.scale});
+  tester.AddOutput<float>("output", output_dims, output_data);
+  tester.SetOutputTolerance(0.05f);
+
+  // mask index is optional.
+  tester.AddOptionalInputEdge<int32_t>();
+
+  tester.AddInput<uint8_t>("input_zero_point", {1}, {input_quant_params.zero_point});
+  tester.AddInput<int8_t>("weight_zero_point", {1}, {weight_quant_params.zero_point});
+
+  SessionOptions so;
+  ASSERT_EQ(so.config_options.AddConfigEntry(kOrtSessionOptionsEnableQuantizedAttentionCore, "1"),
+            Status::OK());
+
+  std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
+  execution_providers.push_back(DefaultCpuExecutionProvider());
+  tester.Run(so, OpTester::ExpectResult::kExpectSuccess, "", {}, nullptr, &execution_providers);
+}
+
 TEST(QAttentionTest, QAttentionUnidirectional_U8U8) {
   int batch_size = 1;
   int sequence_length = 2;
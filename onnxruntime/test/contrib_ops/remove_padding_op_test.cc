@@ -94,7 +94,7 @@ static void RunRemovePaddingTests(
     int hidden_size,
     int total_tokens) {
   bool use_float16 = false;
-  constexpr bool disable_cpu = true;
+  constexpr bool disable_cpu = false;
   constexpr bool disable_cuda = false;
   constexpr bool disable_rocm = true;
   RunRemovePadding(input_data, sequence_token_count_data, output_data, token_offset_data, cumulated_seq_len_data,
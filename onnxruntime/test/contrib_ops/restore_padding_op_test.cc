@@ -77,7 +77,7 @@ static void RunRestorePaddingTests(
     int hidden_size,
     int total_tokens) {
   bool use_float16 = false;
-  constexpr bool disable_cpu = true;
+  constexpr bool disable_cpu = false;
   constexpr bool disable_cuda = false;
   constexpr bool disable_rocm = true;
   RunRestorePadding(input_data, output_data, token_offset_data, batch_size, sequence_length, hidden_size, total_tokens,
@@ -302,6 +302,44 @@ TEST(FlatbufferUtilsTest, ExternalWriteReadWithLoadInitializers) {
   }
 }
 
+// initializer data that is large enough can be used directly from the (potentially memory mapped) flatbuffer,
+// so the serializer must align the raw data of those initializers for the kernels that will consume it.
+TEST(FlatbufferUtilsTest, LargeInitializersAreAlignedForInPlaceUsage) {
+  auto initializers = CreateInitializers();
+
+  flatbuffers::FlatBufferBuilder builder(1024);
+
+  // no external data writer so everything is stored in the flatbuffer
+  std::vector<flatbuffers::Offset<fbs::Tensor>> fbs_tensors;
+  for (const auto& initializer : initializers) {
+    flatbuffers::Offset<fbs::Tensor> fbs_tensor;
+    ASSERT_STATUS_OK(SaveInitializerOrtFormat(builder, initializer, std::filesystem::path(), fbs_tensor));
+    fbs_tensors.push_back(fbs_tensor);
+  }
+
+  auto fbs_tensors_offset = builder.CreateVector(fbs_tensors);
+  fbs::test::TestDataBuilder tdb(builder);
+  tdb.add_initializers(fbs_tensors_offset);
+  builder.Finish(tdb.Finish());
+  auto fb_data = builder.GetBufferSpan();
+
+  const auto* test_data = fbs::test::GetTestData(fb_data.data());
+
+  bool checked_large_initializer = false;
+  for (const auto* fbs_tensor : *test_data->initializers()) {
+    const auto* fbs_raw_data = fbs_tensor->raw_data();
+    if (fbs_raw_data && fbs_raw_data->size() >= kMinimumSizeForInPlaceUsage) {
+      // alignment relative to the buffer start matches alignment in the written file
+      auto offset_in_buffer = narrow<size_t>(fbs_raw_data->Data() - fb_data.data());
+      ASSERT_EQ(offset_in_buffer % kInitializerRawDataAlignment, 0)
+          << "raw data of " << fbs_tensor->name()->str() << " is not aligned for in-place usage";
+      checked_large_initializer = true;
+    }
+  }
+
+  ASSERT_TRUE(checked_large_initializer) << "Expected test data to include initializers that can be used in place.";
+}
+
 #ifdef ENABLE_TRAINING_APIS
 // tests method that loads to OrtTensor (used when loading a checkpoint into a checkpoint state)
 TEST(FlatbufferUtilsTest, ExternalWriteReadWithLoadOrtTensor) {
@@ -16,6 +16,7 @@ using json = nlohmann::json;
 #include "core/framework/kernel_registry.h"
 #include "core/framework/op_kernel.h"
 #include "test/framework/model_builder_utils.h"
+#include "test/framework/test_utils.h"
 #include "core/framework/allocation_planner.h"
 #include "core/session/inference_session.h"
 #include "core/graph/model.h"
@@ -120,8 +121,12 @@ class SequentialPlannerTestContext : public ISequentialPlannerContext {
     return (shape_map_->end() != iter) ? iter->second : nullptr;
   }
 
+  void SetHotNodeNames(std::vector<std::string> hot_node_names) { hot_node_names_ = std::move(hot_node_names); }
+  gsl::span<const std::string> GetHotNodeNames() const override { return hot_node_names_; }
+
  private:
   ShapeMap* shape_map_;
+  std::vector<std::string> hot_node_names_;
 };
 
 class ParallelPlannerTestContext : public SequentialPlannerTestContext {
@@ -165,6 +170,7 @@ class PlannerTest : public ::testing::Test {
   std::unique_ptr<SessionOptions> sess_options_;
   std::unique_ptr<SessionState> state_;
   ShapeMap shape_map_;
+  std::vector<std::string> hot_node_names_;
   std::optional<SequentialExecutionPlan> plan_;
 
  public:
@@ -307,6 +313,7 @@ class PlannerTest : public ::testing::Test {
 
     EXPECT_TRUE(status.IsOK()) << status.ErrorMessage();
     SequentialPlannerTestContext test_context(&shape_map_);
+    test_context.SetHotNodeNames(hot_node_names_);
     plan_.emplace();
 
     class MockStreamHandleRegsitry : public IStreamCommandHandleRegistry {
@@ -386,6 +393,10 @@ class PlannerTest : public ::testing::Test {
   void SetNodePartitionConfigFilePath(const char* config_file_path) {
     ORT_THROW_IF_ERROR(sess_options_->config_options.AddConfigEntry(kNodePartitionConfigFile, config_file_path));
   }
+  void AddSessionConfigEntry(const char* config_key, const char* value) {
+    ORT_THROW_IF_ERROR(sess_options_->config_options.AddConfigEntry(config_key, value));
+  }
+  void SetHotNodeNames(std::vector<std::string> hot_node_names) { hot_node_names_ = std::move(hot_node_names); }
   std::unique_ptr<::onnxruntime::KernelDef>& GetStdKernel() { return std_kernel_; }
 #ifdef USE_CUDA
   void MemcpyToHostInCuda_TransposeInCudaAndCpu(const char* partitionConfigFile = nullptr) {
@@ -448,6 +459,43 @@ TEST_F(PlannerTest, ChainTest) {
   CheckFreed(3, {X});
 }
 
+/* HotNodeInitializerAllocationOrderTest: initializer inputs of nodes named hot by profiling
+feedback are given allocation-order priority, so they are traced first when the weight buffer
+is planned. Initializers of nodes not in the hot list keep the default (unordered) placement.
+*/
+TEST_F(PlannerTest, HotNodeInitializerAllocationOrderTest) {
+  // tensor variables:
+  std::string W1("W1"), W2("W2"), X1("X1"), X2("X2");
+  std::string node1("node1"), node2("node2");
+
+  // graph structure: two independent nodes, each consuming its own initializer
+  for (const auto* name : {"W1", "W2"}) {
+    ONNX_NAMESPACE::TensorProto tensor;
+    tensor.add_dims(1);
+    tensor.add_float_data(1.0f);
+    tensor.set_data_type(TensorProto_DataType_FLOAT);
+    tensor.set_name(name);
+    GetGraph().AddInitializedTensor(tensor);
+  }
+
+  std::vector<onnxruntime::NodeArg*> input1{Arg(W1)}, output1{Arg(X1)}, input2{Arg(W2)}, output2{Arg(X2)};
+  AddNode(*GetStdKernel(), node1, input1, output1);
+  AddNode(*GetStdKernel(), node2, input2, output2);
+
+  SetHotNodeNames({"node2"});
+
+  CreatePlan();
+
+  CheckAllocKind(W1, AllocKind::kAllocateStatically);
+  CheckAllocKind(W2, AllocKind::kAllocateStatically);
+
+  // only the hot node's initializer gets an allocation-order entry; W1 is traced afterwards
+  int w2_idx = -1;
+  ASSERT_STATUS_OK(GetState().GetOrtValueNameIdxMap().GetIdx("W2", w2_idx));
+  ASSERT_EQ(GetPlan().initializer_allocation_order.size(), 1u);
+  EXPECT_EQ(GetPlan().initializer_allocation_order[0], w2_idx);
+}
+
 /* InputOutputTest: Test that:
 (a) All inputs are classified as kPreExisting,
 (b) All outer scope node args are classified as kPreExisting,
@@ -714,6 +762,86 @@ TEST_F(PlannerTest, InPlaceSizeMismatchTest) {
   CheckFreed(3, {X2});
 }
 
+// InPlaceSameValueBothInputsTest: a kernel that declares every input as an in-place candidate
+// may reuse the buffer even when it consumes the same value at more than one input
+// (e.g. Add(X, X)); the node's own pending uses do not block the reuse.
+TEST_F(PlannerTest, InPlaceSameValueBothInputsTest) {
+  std::unique_ptr<::onnxruntime::KernelDef> binary_inplace_kernel = KernelDefBuilder()
+                                                                        .SetName("Add")
+                                                                        .Provider(kCpuExecutionProvider)
+                                                                        .SinceVersion(7, 10)
+                                                                        .MayInplace(0, 0)
+                                                                        .MayInplace(1, 0)
+                                                                        .Build();
+
+  // tensor variables:
+  std::string X1("X1"), X2("X2"), X3("X3"), X4("X4"), add("add");
+
+  // graph structure:
+  AddNormalNode(X1, X2);  // no in-place operator; X1: input; X2: temporary
+  std::vector<onnxruntime::NodeArg*> add_inputs{Arg(X2), Arg(X2)}, add_outputs{Arg(X3)};
+  AddNode(*binary_inplace_kernel, add, add_inputs, add_outputs);  // Add(X2, X2); X3: temporary
+  AddNormalNode(X3, X4);                                          // no in-place operator; X4: output
+
+  // simulate shape-inference results:
+  Shape shape1{"M", "N"};
+  auto shape = &shape1.value;
+  SetShape({{X1, shape}, {X2, shape}, {X3, shape}, {X4, shape}});
+
+  CreatePlan();
+
+  // check allocation kind:
+  CheckAllocKind(X1, AllocKind::kPreExisting);
+  CheckAllocKind(X2, AllocKind::kAllocate);
+  CheckAllocKind(X3, AllocKind::kReuse);
+  CheckAllocKind(X4, AllocKind::kAllocateOutput);
+
+  // check each ml-value is freed at appropriate step
+  CheckFreed(0, {});
+  CheckFreed(1, {});
+  CheckFreed(2, {X2});
+}
+
+// InPlaceLaterConsumerBlocksReuseTest: the same Add(X2, X2) node must not write in place
+// when another node scheduled after it still reads X2.
+TEST_F(PlannerTest, InPlaceLaterConsumerBlocksReuseTest) {
+  std::unique_ptr<::onnxruntime::KernelDef> binary_inplace_kernel = KernelDefBuilder()
+                                                                        .SetName("Add")
+                                                                        .Provider(kCpuExecutionProvider)
+                                                                        .SinceVersion(7, 10)
+                                                                        .MayInplace(0, 0)
+                                                                        .MayInplace(1, 0)
+                                                                        .Build();
+
+  // tensor variables:
+  std::string X1("X1"), X2("X2"), X3("X3"), X4("X4"), add1("add1"), add2("add2");
+
+  // graph structure:
+  AddNormalNode(X1, X2);  // no in-place operator; X1: input; X2: temporary
+  std::vector<onnxruntime::NodeArg*> add1_inputs{Arg(X2), Arg(X2)}, add1_outputs{Arg(X3)};
+  AddNode(*binary_inplace_kernel, add1, add1_inputs, add1_outputs);  // Add(X2, X2); X3: temporary
+  std::vector<onnxruntime::NodeArg*> add2_inputs{Arg(X2), Arg(X3)}, add2_outputs{Arg(X4)};
+  AddNode(*binary_inplace_kernel, add2, add2_inputs, add2_outputs);  // Add(X2, X3); X4: output
+
+  // simulate shape-inference results:
+  Shape shape1{"M", "N"};
+  auto shape = &shape1.value;
+  SetShape({{X1, shape}, {X2, shape}, {X3, shape}, {X4, shape}});
+
+  CreatePlan();
+
+  // check allocation kind:
+  CheckAllocKind(X1, AllocKind::kPreExisting);
+  CheckAllocKind(X2, AllocKind::kAllocate);
+  CheckAllocKind(X3, AllocKind::kAllocate);  // the second Add still reads X2, so no reuse
+  CheckAllocKind(X4, AllocKind::kAllocateOutput);
+
+  // check each ml-value is freed at appropriate step
+  CheckFreed(0, {});
+  CheckFreed(1, {});
+  CheckFreed(2, {X2, X3});
+}
+
 // Test operator<< to output details of an allocation & execution plan.
 TEST_F(PlannerTest, PlanOutputTest) {
   // tensor variables:
@@ -1999,6 +2127,267 @@ TEST_F(PlannerTest, TestMultiStreamMismatchDevice) {
   status = sess.Initialize();
   ASSERT_TRUE(!status.IsOK());
 }
+
+TEST_F(PlannerTest, TestDependencyBasedPartitionerConfig) {
+  const char* config_file_path = "./dependency_based_partitioner.json";
+  {
+    std::ofstream of_stream(config_file_path);
+    ASSERT_TRUE(of_stream.is_open());
+    of_stream << R"({"type":"DependencyBasedPartitioner","max_streams_per_device":4,"min_nodes_per_stream":3})";
+  }
+
+  auto graph_partitioner = IGraphPartitioner::CreateGraphPartitioner(
+      DefaultLoggingManager().DefaultLogger(),
+      ORT_TSTR("./dependency_based_partitioner.json"));
+
+  const char* type = "DependencyBasedPartitioner";
+  ASSERT_TRUE(graph_partitioner &&
+              strncmp(graph_partitioner->Type(), type, strlen(type)) == 0);
+}
+
+// Test execution plan for the graph:
+// Graph_input (initializer)
+//    /      \
+//  node_a1  node_b1
+//    |        |
+//  node_a2  node_b2
+//    |        |
+//  node_a3  node_b3
+//    \      /
+//    node_add
+// All nodes are CPU EP. With the dependency based partitioner the two branches land in
+// separate logic streams even though they share a device.
+TEST_F(PlannerTest, TestDependencyBasedPartitionerBranches) {
+  const char* config_file_path = "./dependency_based_partitioner_branches.json";
+  {
+    std::ofstream of_stream(config_file_path);
+    ASSERT_TRUE(of_stream.is_open());
+    of_stream << R"({"type":"DependencyBasedPartitioner","max_streams_per_device":4,"min_nodes_per_stream":3})";
+  }
+
+  ONNX_NAMESPACE::TensorProto tensor;
+  tensor.add_dims(1);
+  tensor.add_float_data(1.0f);
+  tensor.set_data_type(TensorProto_DataType_FLOAT);
+  tensor.set_name("Graph_input");
+  GetGraph().AddInitializedTensor(tensor);
+
+  std::unique_ptr<::onnxruntime::KernelDef> cpuKernelAdd = KernelDefBuilder().SetName("Add").Provider(kCpuExecutionProvider).SinceVersion(1, 10).Build();
+  std::string Graph_input("Graph_input"), A1("A1"), A2("A2"), A3("A3"), B1("B1"), B2("B2"), B3("B3"), Out("Out"), node_add("node_add");
+  AddNormalNode(Graph_input, A1);
+  AddNormalNode(A1, A2);
+  AddNormalNode(A2, A3);
+  AddNormalNode(Graph_input, B1);
+  AddNormalNode(B1, B2);
+  AddNormalNode(B2, B3);
+  std::vector<onnxruntime::NodeArg*> add_inputs{Arg(A3), Arg(B3)}, add_outputs{Arg(Out)};
+  AddNode(*cpuKernelAdd, node_add, add_inputs, add_outputs);
+
+  SetNodePartitionConfigFilePath(config_file_path);
+  CreatePlan({}, false);
+
+  EXPECT_EQ(GetState().GetExecutionPlan()->execution_plan.size(), 2) << "the two independent branches get their own logic streams";
+}
+
+// Test execution plan for the graph:
+//   X -> Relu -> A -> node2 -> B -> node3 -> C -> node4 -> D
+//                A ------------------------------> node5 -> E
+// A's two consumers are 3 nodes apart. With session.activation_recompute_min_gap = 3 the planner
+// releases A right after node2 and re-executes the Relu ahead of node5.
+TEST_F(PlannerTest, ActivationRecomputeEmitsRecomputeStep) {
+  std::string X("X"), A("A"), B("B"), C("C"), D("D"), E("E");
+  auto* producer = AddInplaceNode(X, A);  // Relu is on the recomputable allowlist
+  auto* first_consumer = AddNormalNode(A, B);
+  AddNormalNode(B, C);
+  AddNormalNode(C, D);
+  auto* second_consumer = AddNormalNode(A, E);
+
+  AddSessionConfigEntry(kOrtSessionOptionsActivationRecomputeMinGap, "3");
+  CreatePlan({}, false);
+
+  const auto* plan = GetState().GetExecutionPlan();
+  ASSERT_EQ(plan->execution_plan.size(), 1);
+  auto& steps = plan->execution_plan[0]->steps_;
+  ASSERT_EQ(steps.size(), 6) << "5 kernel launches plus the recompute of the Relu";
+  for (size_t i = 0; i < 4; ++i) {
+    EXPECT_NE(strstr(typeid(*steps[i]).name(), "LaunchKernelStep"), nullptr) << "step " << i;
+  }
+  EXPECT_NE(strstr(typeid(*steps[4]).name(), "RecomputeKernelStep"), nullptr)
+      << "the producer is re-executed right before its second consumer";
+  EXPECT_EQ(steps[4]->GetNodeIndex(), producer->Index());
+  EXPECT_NE(strstr(typeid(*steps[5]).name(), "LaunchKernelStep"), nullptr);
+  EXPECT_EQ(steps[5]->GetNodeIndex(), second_consumer->Index());
+
+  // A is released twice: early after its first consumer, and again after the second consumer
+  // once the recomputed copy is consumed.
+  int a_index = -1;
+  ASSERT_STATUS_OK(GetState().GetOrtValueNameIdxMap().GetIdx("A", a_index));
+  auto releases_value = [&](NodeIndex node_index) {
+    for (auto action_idx : plan->node_release_list[node_index]) {
+      if (static_cast<int>(plan->release_actions[action_idx].value_index) == a_index) return true;
+    }
+    return false;
+  };
+  EXPECT_TRUE(releases_value(first_consumer->Index())) << "A should be released after its first consumer";
+  EXPECT_TRUE(releases_value(second_consumer->Index())) << "A should be released after its second consumer";
+}
+
+// Same graph with the threshold above the 3-node gap: no recompute step and the single release
+// sits at the last consumer.
+TEST_F(PlannerTest, ActivationRecomputeMinGapNotMet) {
+  std::string X("X"), A("A"), B("B"), C("C"), D("D"), E("E");
+  AddInplaceNode(X, A);
+  auto* first_consumer = AddNormalNode(A, B);
+  AddNormalNode(B, C);
+  AddNormalNode(C, D);
+  auto* second_consumer = AddNormalNode(A, E);
+
+  AddSessionConfigEntry(kOrtSessionOptionsActivationRecomputeMinGap, "4");
+  CreatePlan({}, false);
+
+  const auto* plan = GetState().GetExecutionPlan();
+  ASSERT_EQ(plan->execution_plan.size(), 1);
+  auto& steps = plan->execution_plan[0]->steps_;
+  ASSERT_EQ(steps.size(), 5);
+  for (size_t i = 0; i < steps.size(); ++i) {
+    EXPECT_NE(strstr(typeid(*steps[i]).name(), "LaunchKernelStep"), nullptr) << "step " << i;
+  }
+
+  int a_index = -1;
+  ASSERT_STATUS_OK(GetState().GetOrtValueNameIdxMap().GetIdx("A", a_index));
+  auto releases_value = [&](NodeIndex node_index) {
+    for (auto action_idx : plan->node_release_list[node_index]) {
+      if (static_cast<int>(plan->release_actions[action_idx].value_index) == a_index) return true;
+    }
+    return false;
+  };
+  EXPECT_FALSE(releases_value(first_consumer->Index()));
+  EXPECT_TRUE(releases_value(second_consumer->Index()));
+}
+
+// A producer whose input buffer is reused by another value is not a recompute candidate: by the
+// time the producer would be re-executed the reuser has overwritten the input.
+//   X -> Transpose -> P -> Exp -> A -> node3 -> B -> node4 -> C -> node5 -> D
+//                                 A -----------------------------> node6 -> E
+// With X shaped [2, 3] every intermediate holds 6 floats, so B (allocated right after P's only
+// consumer) reuses P's buffer and the otherwise qualifying gap on A must be skipped.
+TEST_F(PlannerTest, ActivationRecomputeSkipsReusedProducerInput) {
+  TypeProto shaped_float;
+  shaped_float.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  auto* shape = shaped_float.mutable_tensor_type()->mutable_shape();
+  shape->add_dim()->set_dim_value(2);
+  shape->add_dim()->set_dim_value(3);
+  GetGraph().GetOrCreateNodeArg("X", &shaped_float);
+
+  auto exp_kernel = KernelDefBuilder().SetName("Exp").Provider(kCpuExecutionProvider).SinceVersion(1, 10).Build();
+  std::string X("X"), P("P"), A("A"), B("B"), C("C"), D("D"), E("E");
+  AddNormalNode(X, P);
+  AddNode(*exp_kernel, P, A);  // recomputable producer with an intermediate input
+  AddNormalNode(A, B);
+  AddNormalNode(B, C);
+  AddNormalNode(C, D);
+  AddNormalNode(A, E);  // 3 nodes after the first consumer
+
+  AddSessionConfigEntry(kOrtSessionOptionsActivationRecomputeMinGap, "3");
+  CreatePlan({}, false);
+
+  const auto* plan = GetState().GetExecutionPlan();
+  int p_index = -1, b_index = -1;
+  ASSERT_STATUS_OK(GetState().GetOrtValueNameIdxMap().GetIdx("P", p_index));
+  ASSERT_STATUS_OK(GetState().GetOrtValueNameIdxMap().GetIdx("B", b_index));
+  ASSERT_EQ(plan->allocation_plan[b_index].alloc_kind, AllocKind::kReuse) << "test setup: B must reuse P's buffer";
+  ASSERT_EQ(plan->allocation_plan[b_index].reused_buffer, p_index);
+
+  for (auto& stream : plan->execution_plan) {
+    for (auto& step : stream->steps_) {
+      EXPECT_EQ(strstr(typeid(*step).name(), "RecomputeKernelStep"), nullptr)
+          << "a producer with a reused input buffer must not be recomputed";
+    }
+  }
+}
+
+// End to end on CPU: a session with activation recomputation enabled must produce the same
+// outputs as a default session. The graph gives A (the Relu output) two consumers 3 nodes apart
+// and gives the Relu an intermediate input P whose lifetime has to be extended to the
+// re-execution.
+TEST(AllocationPlannerTest, ActivationRecomputeEndToEnd) {
+  Model model("recompute_e2e", false, ModelMetaData(), PathString(), IOnnxRuntimeOpSchemaRegistryList(),
+              {{kOnnxDomain, 13}}, {}, DefaultLoggingManager().DefaultLogger());
+  auto& graph = model.MainGraph();
+
+  TypeProto float_2_3;
+  float_2_3.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  auto* shape = float_2_3.mutable_tensor_type()->mutable_shape();
+  shape->add_dim()->set_dim_value(2);
+  shape->add_dim()->set_dim_value(3);
+  TypeProto float_unknown;
+  float_unknown.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+
+  auto& x = graph.GetOrCreateNodeArg("X", &float_2_3);
+  auto& p = graph.GetOrCreateNodeArg("P", &float_unknown);
+  auto& a = graph.GetOrCreateNodeArg("A", &float_unknown);
+  auto& t1 = graph.GetOrCreateNodeArg("T1", &float_unknown);
+  auto& t2 = graph.GetOrCreateNodeArg("T2", &float_unknown);
+  auto& t3 = graph.GetOrCreateNodeArg("T3", &float_unknown);
+  auto& y = graph.GetOrCreateNodeArg("Y", &float_unknown);
+  graph.AddNode("exp", "Exp", "produce the recomputed node's input", {&x}, {&p});
+  graph.AddNode("relu", "Relu", "recomputable producer", {&p}, {&a});
+  graph.AddNode("neg", "Neg", "first consumer of A", {&a}, {&t1});
+  graph.AddNode("sigmoid", "Sigmoid", "gap filler", {&t1}, {&t2});
+  graph.AddNode("abs", "Abs", "gap filler", {&t2}, {&t3});
+  graph.AddNode("add", "Add", "second consumer of A", {&a, &t3}, {&y});
+  ASSERT_STATUS_OK(graph.Resolve());
+  std::string model_data;
+  model.ToProto().SerializeToString(&model_data);
+
+  const std::vector<std::string> feed_names{"X"};
+  const std::vector<std::string> output_names{"Y"};
+  OrtValue x_value;
+  CreateMLValue<float>(TestCPUExecutionProvider()->CreatePreferredAllocators()[0], {2, 3},
+                       {-1.5f, -0.5f, 0.0f, 0.5f, 1.5f, 2.0f}, &x_value);
+  const std::vector<OrtValue> feeds{x_value};
+
+  auto run_session = [&](const SessionOptions& sess_opt, bool expect_recompute_step,
+                         std::vector<OrtValue>& fetches) {
+    InferenceSession sess(sess_opt, GetEnvironment());
+    ASSERT_STATUS_OK(sess.Load(model_data.data(), static_cast<int>(model_data.size())));
+    ASSERT_STATUS_OK(sess.Initialize());
+
+    bool found_recompute_step = false;
+    const SequentialExecutionPlan* plan = sess.GetSessionState().GetExecutionPlan();
+    for (auto& stream : plan->execution_plan) {
+      for (auto& step : stream->steps_) {
+        if (strstr(typeid(*step).name(), "RecomputeKernelStep") != nullptr) found_recompute_step = true;
+      }
+    }
+    ASSERT_EQ(found_recompute_step, expect_recompute_step);
+    ASSERT_STATUS_OK(sess.Run(RunOptions{}, feed_names, feeds, output_names, &fetches));
+  };
+
+  SessionOptions default_opt;
+  default_opt.graph_optimization_level = TransformerLevel::Default;
+  std::vector<OrtValue> default_fetches;
+  run_session(default_opt, /*expect_recompute_step*/ false, default_fetches);
+
+  SessionOptions recompute_opt;
+  recompute_opt.graph_optimization_level = TransformerLevel::Default;
+  // keep the candidate's buffers out of the reuse and pattern planners so the selection is
+  // deterministic
+  recompute_opt.enable_mem_pattern = false;
+  recompute_opt.enable_mem_reuse = false;
+  ASSERT_STATUS_OK(recompute_opt.config_options.AddConfigEntry(kOrtSessionOptionsActivationRecomputeMinGap, "2"));
+  std::vector<OrtValue> recompute_fetches;
+  run_session(recompute_opt, /*expect_recompute_step*/ true, recompute_fetches);
+
+  ASSERT_EQ(default_fetches.size(), 1u);
+  ASSERT_EQ(recompute_fetches.size(), 1u);
+  const Tensor& expected = default_fetches[0].Get<Tensor>();
+  const Tensor& actual = recompute_fetches[0].Get<Tensor>();
+  ASSERT_EQ(expected.Shape(), actual.Shape());
+  for (int64_t i = 0; i < expected.Shape().Size(); ++i) {
+    EXPECT_EQ(expected.Data<float>()[i], actual.Data<float>()[i]) << "mismatch at element " << i;
+  }
+}
 #endif
 
 #if defined(USE_CUDA) && defined(ORT_ENABLE_STREAM)
@@ -2091,6 +2480,168 @@ TEST(AllocationPlannerTest, ReusedInputCrossDifferentStreams) {
   }
   ASSERT_EQ(gather_count, 4) << "4 gather ops are all placed in CPU stream";
 }
+
+namespace {
+// Counts offload/prefetch steps across all logic streams and records their positions within the
+// stream that holds them.
+struct OffloadStepPositions {
+  size_t num_offload_steps = 0;
+  size_t num_prefetch_steps = 0;
+  size_t offload_position = 0;
+  size_t prefetch_position = 0;
+  const SequentialExecutionPlan::LogicStream* stream = nullptr;
+};
+
+OffloadStepPositions FindOffloadSteps(const SequentialExecutionPlan& plan) {
+  OffloadStepPositions found;
+  for (auto& stream : plan.execution_plan) {
+    for (size_t i = 0; i < stream->steps_.size(); ++i) {
+      if (strstr(typeid(*stream->steps_[i]).name(), "OffloadToHostStep") != nullptr) {
+        found.num_offload_steps++;
+        found.offload_position = i;
+        found.stream = stream.get();
+      } else if (strstr(typeid(*stream->steps_[i]).name(), "PrefetchFromHostStep") != nullptr) {
+        found.num_prefetch_steps++;
+        found.prefetch_position = i;
+      }
+    }
+  }
+  return found;
+}
+}  // namespace
+
+// Test execution plan for the graph (all nodes on CUDA, one logic stream):
+//   X -> node1 -> A ----------------------------> node5 -> E
+//   X -> node2 -> B -> node3 -> C -> node4 -> D
+// A's first consumer is 4 nodes after its producer. With
+// session.activation_offload_min_gap = 3 the planner spills A to host staging memory right after
+// node1 and copies it back right before node5.
+TEST_F(PlannerTest, ActivationOffloadEmitsCopySteps) {
+  auto cuda_kernel = KernelDefBuilder().SetName("Transpose").Provider(kCudaExecutionProvider).SinceVersion(1, 10).Build();
+  std::string X("X"), A("A"), B("B"), C("C"), D("D"), E("E");
+  auto* producer = AddNode(*cuda_kernel, X, A);
+  AddNode(*cuda_kernel, X, B);
+  AddNode(*cuda_kernel, B, C);
+  AddNode(*cuda_kernel, C, D);
+  auto* consumer = AddNode(*cuda_kernel, A, E);
+
+  CUDAExecutionProviderInfo epi;
+  auto ep_factory = onnxruntime::GetProviderInfo_CUDA().CreateExecutionProviderFactory(epi);
+  ORT_THROW_IF_ERROR(GetExecutionProviders().Add("CUDAExecutionProvider", ep_factory->CreateProvider()));
+
+  AddSessionConfigEntry(kOrtSessionOptionsActivationOffloadMinGap, "3");
+  CreatePlan({}, false);
+
+  const auto* plan = GetState().GetExecutionPlan();
+  EXPECT_EQ(plan->num_offload_slots, 1u) << "only A has a qualifying producer-to-first-consumer gap";
+  auto found = FindOffloadSteps(*plan);
+  ASSERT_EQ(found.num_offload_steps, 1u);
+  ASSERT_EQ(found.num_prefetch_steps, 1u);
+  ASSERT_NE(found.stream, nullptr);
+  auto& steps = found.stream->steps_;
+  EXPECT_NE(strstr(typeid(*steps[found.offload_position - 1]).name(), "LaunchKernelStep"), nullptr)
+      << "the spill is enqueued right after the producing kernel";
+  EXPECT_EQ(steps[found.offload_position - 1]->GetNodeIndex(), producer->Index());
+  EXPECT_NE(strstr(typeid(*steps[found.prefetch_position + 1]).name(), "LaunchKernelStep"), nullptr)
+      << "the copy back is enqueued right before the first consumer";
+  EXPECT_EQ(steps[found.prefetch_position + 1]->GetNodeIndex(), consumer->Index());
+  EXPECT_LT(found.offload_position, found.prefetch_position);
+}
+
+// Same graph with the threshold above the 4-node gap: no value is offloaded.
+TEST_F(PlannerTest, ActivationOffloadMinGapNotMet) {
+  auto cuda_kernel = KernelDefBuilder().SetName("Transpose").Provider(kCudaExecutionProvider).SinceVersion(1, 10).Build();
+  std::string X("X"), A("A"), B("B"), C("C"), D("D"), E("E");
+  AddNode(*cuda_kernel, X, A);
+  AddNode(*cuda_kernel, X, B);
+  AddNode(*cuda_kernel, B, C);
+  AddNode(*cuda_kernel, C, D);
+  AddNode(*cuda_kernel, A, E);
+
+  CUDAExecutionProviderInfo epi;
+  auto ep_factory = onnxruntime::GetProviderInfo_CUDA().CreateExecutionProviderFactory(epi);
+  ORT_THROW_IF_ERROR(GetExecutionProviders().Add("CUDAExecutionProvider", ep_factory->CreateProvider()));
+
+  AddSessionConfigEntry(kOrtSessionOptionsActivationOffloadMinGap, "5");
+  CreatePlan({}, false);
+
+  const auto* plan = GetState().GetExecutionPlan();
+  EXPECT_EQ(plan->num_offload_slots, 0u);
+  auto found = FindOffloadSteps(*plan);
+  EXPECT_EQ(found.num_offload_steps, 0u);
+  EXPECT_EQ(found.num_prefetch_steps, 0u);
+}
+
+// A value consumed on a different logic stream than its producer is not offloaded: the stream
+// FIFO alone cannot order the copy back against the consumer.
+TEST_F(PlannerTest, ActivationOffloadSkipsCrossStreamConsumers) {
+  auto cuda_kernel = KernelDefBuilder().SetName("Transpose").Provider(kCudaExecutionProvider).SinceVersion(1, 10).Build();
+  std::string X("X"), A("A"), B("B"), C("C"), D("D"), E("E");
+  AddNode(*cuda_kernel, X, A);
+  AddNode(*cuda_kernel, X, B);
+  AddNode(*cuda_kernel, B, C);
+  AddNode(*cuda_kernel, C, D);
+  AddNormalNode(A, E);  // the only consumer of A runs on the CPU stream
+
+  CUDAExecutionProviderInfo epi;
+  auto ep_factory = onnxruntime::GetProviderInfo_CUDA().CreateExecutionProviderFactory(epi);
+  ORT_THROW_IF_ERROR(GetExecutionProviders().Add("CUDAExecutionProvider", ep_factory->CreateProvider()));
+
+  AddSessionConfigEntry(kOrtSessionOptionsActivationOffloadMinGap, "3");
+  CreatePlan({}, false);
+
+  const auto* plan = GetState().GetExecutionPlan();
+  EXPECT_EQ(plan->num_offload_slots, 0u);
+  auto found = FindOffloadSteps(*plan);
+  EXPECT_EQ(found.num_offload_steps, 0u);
+  EXPECT_EQ(found.num_prefetch_steps, 0u);
+}
+
+// A value whose buffer another value is planned to reuse is not offloaded: releasing the device
+// buffer early would break the reuse chain. With X shaped [2, 3] every intermediate holds
+// 6 floats, so F (allocated right after A's last consumer) reuses A's buffer.
+//   X -> node1 -> A -> node5 -> E -> node6 -> F -> node7 -> G
+//   X -> node2 -> B    (B, C, D are graph outputs and never freed)
+//   X -> node3 -> C
+//   X -> node4 -> D
+TEST_F(PlannerTest, ActivationOffloadSkipsReusedBuffers) {
+  TypeProto shaped_float;
+  shaped_float.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  auto* shape = shaped_float.mutable_tensor_type()->mutable_shape();
+  shape->add_dim()->set_dim_value(2);
+  shape->add_dim()->set_dim_value(3);
+  GetGraph().GetOrCreateNodeArg("X", &shaped_float);
+
+  auto cuda_kernel = KernelDefBuilder().SetName("Transpose").Provider(kCudaExecutionProvider).SinceVersion(1, 10).Build();
+  std::string X("X"), A("A"), B("B"), C("C"), D("D"), E("E"), F("F"), G("G");
+  AddNode(*cuda_kernel, X, A);
+  AddNode(*cuda_kernel, X, B);
+  AddNode(*cuda_kernel, X, C);
+  AddNode(*cuda_kernel, X, D);
+  AddNode(*cuda_kernel, A, E);  // 4 nodes after A's producer
+  AddNode(*cuda_kernel, E, F);
+  AddNode(*cuda_kernel, F, G);
+
+  CUDAExecutionProviderInfo epi;
+  auto ep_factory = onnxruntime::GetProviderInfo_CUDA().CreateExecutionProviderFactory(epi);
+  ORT_THROW_IF_ERROR(GetExecutionProviders().Add("CUDAExecutionProvider", ep_factory->CreateProvider()));
+
+  AddSessionConfigEntry(kOrtSessionOptionsActivationOffloadMinGap, "3");
+  CreatePlan({}, false);
+
+  const auto* plan = GetState().GetExecutionPlan();
+  int a_index = -1, f_index = -1;
+  ASSERT_STATUS_OK(GetState().GetOrtValueNameIdxMap().GetIdx("A", a_index));
+  ASSERT_STATUS_OK(GetState().GetOrtValueNameIdxMap().GetIdx("F", f_index));
+  ASSERT_EQ(plan->allocation_plan[f_index].alloc_kind, AllocKind::kReuse) << "test setup: F must reuse A's buffer";
+  ASSERT_EQ(plan->allocation_plan[f_index].reused_buffer, a_index);
+
+  EXPECT_EQ(plan->num_offload_slots, 0u);
+  auto found = FindOffloadSteps(*plan);
+  EXPECT_EQ(found.num_offload_steps, 0u);
+  EXPECT_EQ(found.num_prefetch_steps, 0u);
+}
+
 #endif
 
 #ifdef ENABLE_TRAINING_OPS
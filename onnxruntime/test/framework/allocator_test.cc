@@ -3,6 +3,7 @@
 #include <absl/base/config.h>
 
 #include "core/framework/allocator.h"
+#include "core/framework/run_scratch_arena.h"
 
 #include "test_utils.h"
 #include "gtest/gtest.h"
@@ -110,5 +111,41 @@ TEST(AllocatorTest, TestOverflowChecks) {
   EXPECT_TRUE(IAllocator::CalcMemSizeForArrayWithAlignment<kAllocAlignment>(num_elements, element_size - (kAllocAlignment / num_elements), &size));
   EXPECT_FALSE(IAllocator::CalcMemSizeForArrayWithAlignment<kAllocAlignment>(num_elements, element_size, &size));
 }
+
+TEST(AllocatorTest, RunScratchArenaTest) {
+  auto upstream = std::make_shared<CPUAllocator>();
+
+  // no recorded peak yet: requests fall through to the upstream allocator but are still counted
+  {
+    RunScratchArena arena(upstream, 0);
+    void* p = arena.Alloc(100);
+    ASSERT_NE(p, nullptr);
+    memset(p, -1, 100);
+    arena.Free(p);
+    EXPECT_EQ(arena.TotalBytes(), kAllocAlignment);  // 100 rounded up to the allocation alignment
+  }
+
+  // slab requests are served by bumping a pointer; Free on slab memory is a no-op and overflow
+  // falls through to the upstream allocator
+  {
+    RunScratchArena arena(upstream, 4 * kAllocAlignment);
+    auto* a = static_cast<char*>(arena.Alloc(1));
+    auto* b = static_cast<char*>(arena.Alloc(kAllocAlignment));
+    ASSERT_NE(a, nullptr);
+    ASSERT_NE(b, nullptr);
+    EXPECT_EQ(b - a, static_cast<ptrdiff_t>(kAllocAlignment));
+    arena.Free(a);  // no-op; the space is not reused within the run
+    auto* c = static_cast<char*>(arena.Alloc(2 * kAllocAlignment));
+    ASSERT_NE(c, nullptr);
+    EXPECT_EQ(c - a, static_cast<ptrdiff_t>(2 * kAllocAlignment));
+    void* d = arena.Alloc(kAllocAlignment);  // slab exhausted
+    ASSERT_NE(d, nullptr);
+    memset(d, -1, kAllocAlignment);
+    arena.Free(b);
+    arena.Free(c);
+    arena.Free(d);
+    EXPECT_EQ(arena.TotalBytes(), 5 * kAllocAlignment);
+  }
+}
 }  // namespace test
 }  // namespace onnxruntime
@@ -307,6 +307,122 @@ TEST(BFCArenaTest, TestShrink) {
   EXPECT_EQ(stats.total_allocated_bytes, 10 * 1024 * 1024) << "Expect 10M bytes but actually " << stats.total_allocated_bytes << " bytes";
 }
 
+TEST(BFCArenaTest, TestMemoryBudgetPressureCallback) {
+  BFCArena a(std::unique_ptr<IAllocator>(new CPUAllocator()), 1 << 30, ArenaExtendStrategy::kSameAsRequested);
+
+  size_t pressure_events = 0;
+  size_t last_bytes_needed = 0;
+  a.SetMemoryBudget(1024 * 1024, [&](size_t bytes_needed) {
+    ++pressure_events;
+    last_bytes_needed = bytes_needed;
+    return size_t{0};
+  });
+
+  // fits under the budget, no pressure
+  void* p1 = a.Alloc(512 * 1024);
+  EXPECT_EQ(pressure_events, 0u);
+
+  // would push bytes_in_use to 1.5MB; the allocation still succeeds and the callback sees
+  // the 512KB overage
+  void* p2 = a.Alloc(1024 * 1024);
+  ASSERT_NE(p2, nullptr);
+  EXPECT_EQ(pressure_events, 1u);
+  EXPECT_EQ(last_bytes_needed, 512 * 1024u);
+
+  a.Free(p2);
+
+  // the callback may free memory from this arena without deadlocking
+  a.SetMemoryBudget(1024, [&](size_t /*bytes_needed*/) {
+    if (p1 != nullptr) {
+      a.Free(p1);
+      p1 = nullptr;
+    }
+    return size_t{512 * 1024};
+  });
+  void* p3 = a.Alloc(2048);
+  ASSERT_NE(p3, nullptr);
+  EXPECT_EQ(p1, nullptr) << "Pressure callback should have run and freed p1";
+  a.Free(p3);
+
+  // removing the budget disables the callback
+  a.SetMemoryBudget(0, nullptr);
+  void* p4 = a.Alloc(4 * 1024 * 1024);
+  ASSERT_NE(p4, nullptr);
+  a.Free(p4);
+}
+
+TEST(BFCArenaTest, TestLargestFreeChunkStats) {
+  BFCArena a(std::unique_ptr<IAllocator>(new CPUAllocator()), 1 << 30);
+  AllocatorStats stats;
+  a.GetStats(&stats);
+  EXPECT_EQ(stats.largest_free_chunk_bytes, 0) << "Nothing allocated yet so there are no free chunks";
+
+  // the first allocation creates a 1MB region; the allocation is split off the front of it
+  void* p = a.Alloc(256 * 1024);
+  a.GetStats(&stats);
+  EXPECT_EQ(stats.largest_free_chunk_bytes, (1 << 20) - 256 * 1024);
+
+  a.Free(p);
+  a.GetStats(&stats);
+  EXPECT_EQ(stats.largest_free_chunk_bytes, 1 << 20) << "Free chunk should be coalesced back to the full region";
+}
+
+// Bump allocator over a single host slab: successive allocations are always adjacent, like a
+// virtual memory backed device allocator that maps physical pages into one reserved range.
+class ContiguousSlabAllocator : public IAllocator {
+ public:
+  explicit ContiguousSlabAllocator(size_t slab_size)
+      : IAllocator(OrtMemoryInfo(CPU, OrtAllocatorType::OrtDeviceAllocator)),
+        slab_(std::make_unique<char[]>(slab_size)),
+        slab_size_(slab_size) {}
+
+  void* Alloc(size_t size) override {
+    if (size > slab_size_ - next_) return nullptr;
+    void* p = slab_.get() + next_;
+    next_ += size;
+    return p;
+  }
+
+  void Free(void* /*p*/) override {}
+
+  bool SupportsCoalescing() const override { return true; }
+
+ private:
+  std::unique_ptr<char[]> slab_;
+  size_t slab_size_;
+  size_t next_ = 0;
+};
+
+TEST(BFCArenaTest, TestRegionMergeWithContiguousAllocator) {
+  BFCArena a(std::unique_ptr<IAllocator>(new ContiguousSlabAllocator(64 * 1024 * 1024)), 1 << 30);
+  AllocatorStats stats;
+
+  // The first allocation fully consumes the initial 1MB region, so the second one forces an
+  // extension. The device allocator returns the adjacent range, so the extension is merged
+  // into the existing region rather than added as a separate one.
+  void* p1 = a.Alloc(1 << 20);
+  void* p2 = a.Alloc(1 << 20);
+  a.GetStats(&stats);
+  EXPECT_EQ(stats.num_arena_extensions, 2);
+
+  a.Free(p1);
+  a.Free(p2);
+
+  // The free chunks coalesce across the old extension boundary into a single chunk covering
+  // everything the arena got from the device allocator.
+  a.GetStats(&stats);
+  EXPECT_EQ(stats.largest_free_chunk_bytes, stats.total_allocated_bytes);
+
+  // A request larger than any single extension is served from the merged free space without
+  // growing the arena.
+  const int64_t total_before = stats.total_allocated_bytes;
+  void* p3 = a.Alloc(static_cast<size_t>(total_before));
+  EXPECT_NE(p3, nullptr);
+  a.GetStats(&stats);
+  EXPECT_EQ(stats.total_allocated_bytes, total_before);
+  a.Free(p3);
+}
+
 class BadAllocator : public IAllocator {
  public:
   BadAllocator() : IAllocator(OrtMemoryInfo(CPU, OrtAllocatorType::OrtDeviceAllocator)) {}
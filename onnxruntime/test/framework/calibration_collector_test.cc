@@ -0,0 +1,70 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/calibration_collector.h"
+
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+#include "core/framework/allocator.h"
+#include "core/framework/tensor.h"
+
+namespace onnxruntime {
+namespace test {
+
+namespace {
+
+Tensor MakeFloatTensor(const std::vector<float>& values, AllocatorPtr allocator) {
+  Tensor tensor(DataTypeImpl::GetType<float>(), TensorShape({static_cast<int64_t>(values.size())}), allocator);
+  std::copy(values.begin(), values.end(), tensor.MutableData<float>());
+  return tensor;
+}
+
+}  // namespace
+
+TEST(CalibrationCollectorTest, MergesBatchesAndSkipsNaN) {
+  auto allocator = std::make_shared<CPUAllocator>();
+  CalibrationCollector collector{{}};
+
+  collector.Collect("act", MakeFloatTensor({1.f, -2.f, 3.f}, allocator));
+  collector.Collect("act", MakeFloatTensor({std::nanf(""), 0.5f, 7.f}, allocator));
+
+  auto stats = collector.GetStats();
+  ASSERT_EQ(stats.size(), 1u);
+  const auto& act = stats.at("act");
+  EXPECT_EQ(act.min, -2.0);
+  EXPECT_EQ(act.max, 7.0);
+  EXPECT_EQ(act.absmax, 7.0);
+  EXPECT_EQ(act.num_elements, 6u);
+  EXPECT_EQ(act.num_updates, 2u);
+
+  // An all-NaN batch contributes nothing.
+  collector.Collect("act", MakeFloatTensor({std::nanf("")}, allocator));
+  EXPECT_EQ(collector.GetStats().at("act").num_updates, 2u);
+}
+
+TEST(CalibrationCollectorTest, FiltersByNameAndType) {
+  auto allocator = std::make_shared<CPUAllocator>();
+  CalibrationCollector collector{{"wanted"}};
+
+  EXPECT_TRUE(collector.ShouldCollect("wanted"));
+  EXPECT_FALSE(collector.ShouldCollect("other"));
+
+  collector.Collect("wanted", MakeFloatTensor({-1.f, 4.f}, allocator));
+
+  // Non floating point tensors are ignored even for observed names.
+  Tensor int_tensor(DataTypeImpl::GetType<int64_t>(), TensorShape({2}), allocator);
+  int_tensor.MutableData<int64_t>()[0] = 100;
+  int_tensor.MutableData<int64_t>()[1] = -100;
+  collector.Collect("wanted", int_tensor);
+
+  auto stats = collector.GetStats();
+  ASSERT_EQ(stats.size(), 1u);
+  EXPECT_EQ(stats.at("wanted").min, -1.0);
+  EXPECT_EQ(stats.at("wanted").max, 4.0);
+  EXPECT_EQ(stats.at("wanted").num_updates, 1u);
+}
+
+}  // namespace test
+}  // namespace onnxruntime
@@ -0,0 +1,127 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/compiled_subgraph_blob_cache.h"
+
+#include <memory>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "core/graph/model.h"
+#include "test/test_environment.h"
+#include "test/util/include/asserts.h"
+#include "test/util/include/temp_dir.h"
+
+using namespace ONNX_NAMESPACE;
+
+namespace onnxruntime {
+namespace test {
+
+namespace {
+
+// builds X + W -> Y where W is an initializer. all names are derived from 'prefix' so two
+// calls with different prefixes produce structurally identical graphs with different names.
+std::unique_ptr<Model> BuildAddModel(const std::string& prefix, float weight_value) {
+  auto model = std::make_unique<Model>("test", false, DefaultLoggingManager().DefaultLogger());
+  auto& graph = model->MainGraph();
+
+  TypeProto float_tensor;
+  float_tensor.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  float_tensor.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(2);
+
+  auto& x = graph.GetOrCreateNodeArg(prefix + "_x", &float_tensor);
+  auto& w = graph.GetOrCreateNodeArg(prefix + "_w", &float_tensor);
+  auto& y = graph.GetOrCreateNodeArg(prefix + "_y", &float_tensor);
+
+  TensorProto weight;
+  weight.set_name(prefix + "_w");
+  weight.set_data_type(TensorProto_DataType_FLOAT);
+  weight.add_dims(2);
+  weight.add_float_data(weight_value);
+  weight.add_float_data(2.f);
+  graph.AddInitializedTensor(weight);
+
+  graph.AddNode(prefix + "_add", "Add", "", {&x, &w}, {&y});
+  EXPECT_STATUS_OK(graph.Resolve());
+  return model;
+}
+
+// builds Cast(X, to=<cast_to>) -> Y
+std::unique_ptr<Model> BuildCastModel(int64_t cast_to) {
+  auto model = std::make_unique<Model>("test", false, DefaultLoggingManager().DefaultLogger());
+  auto& graph = model->MainGraph();
+
+  TypeProto float_tensor;
+  float_tensor.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  float_tensor.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(2);
+
+  auto& x = graph.GetOrCreateNodeArg("x", &float_tensor);
+  auto& y = graph.GetOrCreateNodeArg("y", nullptr);
+
+  auto& cast = graph.AddNode("cast", "Cast", "", {&x}, {&y});
+  cast.AddAttribute("to", cast_to);
+  EXPECT_STATUS_OK(graph.Resolve());
+  return model;
+}
+
+}  // namespace
+
+TEST(CompiledSubgraphBlobCacheTest, HashIgnoresNamesButNotContent) {
+  auto model_a = BuildAddModel("a", 1.f);
+  auto model_b = BuildAddModel("some_other_naming", 1.f);
+  auto model_c = BuildAddModel("a", 3.f);  // same names as model_a, different weight payload
+
+  const GraphViewer viewer_a{model_a->MainGraph()};
+  const GraphViewer viewer_b{model_b->MainGraph()};
+  const GraphViewer viewer_c{model_c->MainGraph()};
+
+  EXPECT_EQ(ComputeFusedSubgraphHash(viewer_a), ComputeFusedSubgraphHash(viewer_b));
+  EXPECT_NE(ComputeFusedSubgraphHash(viewer_a), ComputeFusedSubgraphHash(viewer_c));
+}
+
+TEST(CompiledSubgraphBlobCacheTest, HashSensitiveToAttributes) {
+  auto model_to_int32 = BuildCastModel(TensorProto_DataType_INT32);
+  auto model_to_int64 = BuildCastModel(TensorProto_DataType_INT64);
+
+  const GraphViewer viewer_to_int32{model_to_int32->MainGraph()};
+  const GraphViewer viewer_to_int64{model_to_int64->MainGraph()};
+
+  EXPECT_NE(ComputeFusedSubgraphHash(viewer_to_int32), ComputeFusedSubgraphHash(viewer_to_int64));
+}
+
+TEST(CompiledSubgraphBlobCacheTest, GetPutRoundTrip) {
+  CompiledSubgraphBlobCache cache;
+  std::string blob;
+
+  EXPECT_FALSE(cache.Get(42, blob));
+
+  cache.Put(42, "engine bytes");
+  ASSERT_TRUE(cache.Get(42, blob));
+  EXPECT_EQ(blob, "engine bytes");
+
+  // content addressed: a second Put under the same key keeps the first blob
+  cache.Put(42, "different bytes");
+  ASSERT_TRUE(cache.Get(42, blob));
+  EXPECT_EQ(blob, "engine bytes");
+}
+
+TEST(CompiledSubgraphBlobCacheTest, BackingDirectorySharesBlobsAcrossInstances) {
+  TemporaryDirectory tmp_dir{ORT_TSTR("compiled_subgraph_blob_cache_test_tmp_dir")};
+
+  CompiledSubgraphBlobCache writer;
+  writer.SetBackingDirectory(tmp_dir.Path());
+  writer.Put(7, "persisted engine");
+
+  // a fresh instance with the same backing directory stands in for another process
+  CompiledSubgraphBlobCache reader;
+  reader.SetBackingDirectory(tmp_dir.Path());
+
+  std::string blob;
+  ASSERT_TRUE(reader.Get(7, blob));
+  EXPECT_EQ(blob, "persisted engine");
+  EXPECT_FALSE(reader.Get(8, blob));
+}
+
+}  // namespace test
+}  // namespace onnxruntime
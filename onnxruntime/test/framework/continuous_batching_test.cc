@@ -0,0 +1,153 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/session/continuous_batching.h"
+
+#include "gtest/gtest.h"
+#include "test/util/include/asserts.h"
+
+namespace onnxruntime {
+namespace test {
+
+using StepKind = ContinuousBatchingManager::StepKind;
+
+TEST(ContinuousBatchingTest, PrefillThenDecode) {
+  // page_size 4: a 6 token prompt needs 2 pages
+  ContinuousBatchingManager manager(/*num_pages*/ 8, /*page_size*/ 4, /*max_batch_size*/ 4);
+
+  ASSERT_STATUS_OK(manager.AddRequest(100, /*prompt_length*/ 6));
+  ASSERT_STATUS_OK(manager.AddRequest(101, /*prompt_length*/ 3));
+  ASSERT_EQ(manager.NumFreePages(), 8 - 2 - 1);
+
+  ContinuousBatchingManager::Step step;
+  ASSERT_STATUS_OK(manager.PrepareStep(step));
+  ASSERT_EQ(step.kind, StepKind::kPrefill);
+  ASSERT_EQ(step.request_ids, (InlinedVector<int64_t>{100, 101}));
+  ASSERT_EQ(step.input_lengths, (InlinedVector<int64_t>{6, 3}));
+  ASSERT_EQ(step.seqlens_k, (InlinedVector<int32_t>{5, 2}));
+  ASSERT_EQ(step.total_sequence_length, 6);
+  ASSERT_EQ(step.max_blocks_per_sequence, 2);
+  ASSERT_STATUS_OK(manager.CommitStep());
+
+  // decode covers both requests, one token each
+  ASSERT_STATUS_OK(manager.PrepareStep(step));
+  ASSERT_EQ(step.kind, StepKind::kDecode);
+  ASSERT_EQ(step.input_lengths, (InlinedVector<int64_t>{1, 1}));
+  ASSERT_EQ(step.seqlens_k, (InlinedVector<int32_t>{6, 3}));
+  ASSERT_EQ(step.total_sequence_length, 7);
+  ASSERT_STATUS_OK(manager.CommitStep());
+
+  int64_t length = 0;
+  ASSERT_STATUS_OK(manager.GetSequenceLength(100, length));
+  ASSERT_EQ(length, 7);
+  ASSERT_STATUS_OK(manager.GetSequenceLength(101, length));
+  ASSERT_EQ(length, 4);
+}
+
+TEST(ContinuousBatchingTest, DecodeGrowsPagesAcrossBoundary) {
+  ContinuousBatchingManager manager(/*num_pages*/ 4, /*page_size*/ 2, /*max_batch_size*/ 2);
+
+  ASSERT_STATUS_OK(manager.AddRequest(7, /*prompt_length*/ 2));  // exactly one full page
+  ASSERT_EQ(manager.NumFreePages(), 3);
+
+  ContinuousBatchingManager::Step step;
+  ASSERT_STATUS_OK(manager.PrepareStep(step));
+  ASSERT_STATUS_OK(manager.CommitStep());
+
+  // token 3 starts a new page; it is staged by PrepareStep and kept by CommitStep
+  ASSERT_STATUS_OK(manager.PrepareStep(step));
+  ASSERT_EQ(step.max_blocks_per_sequence, 2);
+  ASSERT_EQ(manager.NumFreePages(), 2);
+  ASSERT_STATUS_OK(manager.CommitStep());
+  ASSERT_EQ(manager.NumFreePages(), 2);
+}
+
+TEST(ContinuousBatchingTest, UncommittedStepRollsBack) {
+  ContinuousBatchingManager manager(/*num_pages*/ 4, /*page_size*/ 2, /*max_batch_size*/ 2);
+
+  ASSERT_STATUS_OK(manager.AddRequest(7, /*prompt_length*/ 2));
+  ContinuousBatchingManager::Step step;
+  ASSERT_STATUS_OK(manager.PrepareStep(step));
+  ASSERT_STATUS_OK(manager.CommitStep());
+
+  // the decode step stages a page, but the run "fails" and is never committed; re-preparing
+  // returns the staged page before staging it again, so the free count is stable
+  ASSERT_STATUS_OK(manager.PrepareStep(step));
+  ASSERT_EQ(manager.NumFreePages(), 2);
+  ASSERT_STATUS_OK(manager.PrepareStep(step));
+  ASSERT_EQ(manager.NumFreePages(), 2);
+
+  int64_t length = 0;
+  ASSERT_STATUS_OK(manager.GetSequenceLength(7, length));
+  ASSERT_EQ(length, 2);  // the failed decode never advanced the sequence
+}
+
+TEST(ContinuousBatchingTest, JoinAndRetireMidStream) {
+  ContinuousBatchingManager manager(/*num_pages*/ 8, /*page_size*/ 2, /*max_batch_size*/ 4);
+
+  ASSERT_STATUS_OK(manager.AddRequest(1, /*prompt_length*/ 4));
+  ContinuousBatchingManager::Step step;
+  ASSERT_STATUS_OK(manager.PrepareStep(step));
+  ASSERT_STATUS_OK(manager.CommitStep());
+
+  // a new request joins while request 1 is decoding: the next step prefills only the joiner
+  ASSERT_STATUS_OK(manager.AddRequest(2, /*prompt_length*/ 2));
+  ASSERT_STATUS_OK(manager.PrepareStep(step));
+  ASSERT_EQ(step.kind, StepKind::kPrefill);
+  ASSERT_EQ(step.request_ids, (InlinedVector<int64_t>{2}));
+  ASSERT_STATUS_OK(manager.CommitStep());
+
+  // then both decode together
+  ASSERT_STATUS_OK(manager.PrepareStep(step));
+  ASSERT_EQ(step.kind, StepKind::kDecode);
+  ASSERT_EQ(step.request_ids, (InlinedVector<int64_t>{1, 2}));
+  ASSERT_STATUS_OK(manager.CommitStep());
+
+  // retiring request 1 frees its pages and the remaining request keeps decoding alone
+  ASSERT_STATUS_OK(manager.RemoveRequest(1));
+  ASSERT_STATUS_OK(manager.PrepareStep(step));
+  ASSERT_EQ(step.request_ids, (InlinedVector<int64_t>{2}));
+  ASSERT_EQ(step.seqlens_k, (InlinedVector<int32_t>{3}));
+  ASSERT_STATUS_OK(manager.CommitStep());
+}
+
+TEST(ContinuousBatchingTest, AdmissionControl) {
+  ContinuousBatchingManager manager(/*num_pages*/ 2, /*page_size*/ 2, /*max_batch_size*/ 1);
+
+  ASSERT_FALSE(manager.CanAdmit(0));
+  ASSERT_TRUE(manager.CanAdmit(4));
+  ASSERT_FALSE(manager.CanAdmit(5));  // needs 3 pages, pool has 2
+
+  ASSERT_STATUS_OK(manager.AddRequest(1, 2));
+  ASSERT_FALSE(manager.CanAdmit(1));  // batch row limit
+  ASSERT_FALSE(manager.AddRequest(2, 1).IsOK());
+  ASSERT_FALSE(manager.AddRequest(1, 1).IsOK());  // duplicate id
+
+  // a decode that cannot get a page fails without leaking any
+  ContinuousBatchingManager::Step step;
+  ASSERT_STATUS_OK(manager.PrepareStep(step));
+  ASSERT_STATUS_OK(manager.CommitStep());
+  ASSERT_STATUS_OK(manager.PrepareStep(step));  // stages the pool's last page
+  ASSERT_STATUS_OK(manager.CommitStep());
+  ASSERT_STATUS_OK(manager.PrepareStep(step));  // token 4 still fits in page 2
+  ASSERT_STATUS_OK(manager.CommitStep());
+  ASSERT_FALSE(manager.PrepareStep(step).IsOK());  // token 5 needs a third page
+  ASSERT_EQ(manager.NumFreePages(), 0);
+
+  // retiring the request releases everything
+  ASSERT_STATUS_OK(manager.RemoveRequest(1));
+  ASSERT_EQ(manager.NumFreePages(), 2);
+  ASSERT_EQ(manager.NumActiveRequests(), static_cast<size_t>(0));
+}
+
+TEST(ContinuousBatchingTest, EmptyManagerHasNoStep) {
+  ContinuousBatchingManager manager(/*num_pages*/ 2, /*page_size*/ 2, /*max_batch_size*/ 1);
+
+  ContinuousBatchingManager::Step step;
+  ASSERT_STATUS_OK(manager.PrepareStep(step));
+  ASSERT_EQ(step.kind, StepKind::kNone);
+  ASSERT_FALSE(manager.CommitStep().IsOK());
+}
+
+}  // namespace test
+}  // namespace onnxruntime
@@ -0,0 +1,161 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/delta_execution_manager.h"
+
+#include "gtest/gtest.h"
+
+#include "core/framework/tensor.h"
+
+namespace onnxruntime {
+namespace test {
+
+namespace {
+
+OrtValue MakeFloatValue(AllocatorPtr allocator, std::initializer_list<float> data) {
+  OrtValue value;
+  Tensor::InitOrtValue(DataTypeImpl::GetType<float>(),
+                       TensorShape({static_cast<int64_t>(data.size())}), allocator, value);
+  std::copy(data.begin(), data.end(), value.GetMutable<Tensor>()->MutableData<float>());
+  return value;
+}
+
+// A small diamond plus a non-deterministic tail:
+//   node 0 reads feed "x", node 1 reads feed "y", node 2 consumes both,
+//   node 3 is non-deterministic and consumes node 0.
+std::unique_ptr<DeltaExecutionManager> MakeManager(AllocatorPtr allocator,
+                                                   size_t cache_budget_bytes = size_t{1} << 20) {
+  std::vector<DeltaExecutionManager::NodeEntry> nodes;
+  nodes.push_back({/*node_index*/ 0, /*producers*/ {}, /*feeds*/ {0}, /*output_start*/ 1, /*output_args*/ {0},
+                   /*deterministic*/ true});
+  nodes.push_back({1, {}, {1}, 1, {0}, true});
+  nodes.push_back({2, {0, 1}, {}, 2, {0}, true});
+  nodes.push_back({3, {0}, {}, 1, {0}, false});
+
+  InlinedHashMap<std::string, size_t> feed_positions;
+  feed_positions.emplace("x", 0);
+  feed_positions.emplace("y", 1);
+
+  return std::make_unique<DeltaExecutionManager>(std::move(nodes), std::move(feed_positions),
+                                                 std::move(allocator), cache_budget_bytes);
+}
+
+void RunOnce(DeltaExecutionManager& manager,
+             std::initializer_list<std::string> feed_names,
+             std::initializer_list<OrtValue> feeds,
+             bool succeeded = true) {
+  std::vector<std::string> names(feed_names);
+  std::vector<OrtValue> values(feeds);
+  manager.BeginRun(names, values);
+  manager.EndRun(succeeded);
+}
+
+}  // namespace
+
+TEST(DeltaExecutionManagerTest, DirtyPropagation) {
+  AllocatorPtr allocator = std::make_shared<CPUAllocator>();
+  auto manager = MakeManager(allocator);
+
+  // first run has no baseline: everything is dirty
+  std::vector<std::string> names{"x", "y"};
+  std::vector<OrtValue> feeds{MakeFloatValue(allocator, {1.f}), MakeFloatValue(allocator, {2.f})};
+  manager->BeginRun(names, feeds);
+  for (NodeIndex node = 0; node < 4; ++node) {
+    EXPECT_TRUE(manager->IsNodeDirty(node));
+  }
+  manager->EndRun(true);
+
+  // identical feeds: only the non-deterministic node stays dirty
+  std::vector<OrtValue> same_feeds{MakeFloatValue(allocator, {1.f}), MakeFloatValue(allocator, {2.f})};
+  manager->BeginRun(names, same_feeds);
+  EXPECT_FALSE(manager->IsNodeDirty(0));
+  EXPECT_FALSE(manager->IsNodeDirty(1));
+  EXPECT_FALSE(manager->IsNodeDirty(2));
+  EXPECT_TRUE(manager->IsNodeDirty(3));
+  manager->EndRun(true);
+
+  // changing "y" dirties its consumer and everything downstream, but not the "x" branch
+  std::vector<OrtValue> y_changed{MakeFloatValue(allocator, {1.f}), MakeFloatValue(allocator, {5.f})};
+  manager->BeginRun(names, y_changed);
+  EXPECT_FALSE(manager->IsNodeDirty(0));
+  EXPECT_TRUE(manager->IsNodeDirty(1));
+  EXPECT_TRUE(manager->IsNodeDirty(2));
+  manager->EndRun(true);
+}
+
+TEST(DeltaExecutionManagerTest, FedVersusNotFedCountsAsChanged) {
+  AllocatorPtr allocator = std::make_shared<CPUAllocator>();
+  auto manager = MakeManager(allocator);
+
+  RunOnce(*manager, {"x", "y"},
+          {MakeFloatValue(allocator, {1.f}), MakeFloatValue(allocator, {2.f})});
+
+  // "y" falls back to its initializer default this run: its consumers must recompute even
+  // though "x" is unchanged
+  std::vector<std::string> names{"x"};
+  std::vector<OrtValue> feeds{MakeFloatValue(allocator, {1.f})};
+  manager->BeginRun(names, feeds);
+  EXPECT_FALSE(manager->IsNodeDirty(0));
+  EXPECT_TRUE(manager->IsNodeDirty(1));
+  EXPECT_TRUE(manager->IsNodeDirty(2));
+  manager->EndRun(true);
+}
+
+TEST(DeltaExecutionManagerTest, CacheLifecycle) {
+  AllocatorPtr allocator = std::make_shared<CPUAllocator>();
+  auto manager = MakeManager(allocator);
+
+  std::vector<std::string> names{"x", "y"};
+  std::vector<OrtValue> feeds{MakeFloatValue(allocator, {1.f}), MakeFloatValue(allocator, {2.f})};
+
+  manager->BeginRun(names, feeds);
+  OrtValue output = MakeFloatValue(allocator, {10.f});
+  const OrtValue* outputs[] = {&output};
+  manager->OnNodeExecuted(0, outputs);
+  EXPECT_TRUE(manager->HasCachedOutputs(0));
+  EXPECT_FALSE(manager->HasCachedOutputs(1));
+  manager->EndRun(true);
+
+  // the cache survives a successful run but not a failed one
+  EXPECT_TRUE(manager->HasCachedOutputs(0));
+  RunOnce(*manager, {"x", "y"},
+          {MakeFloatValue(allocator, {1.f}), MakeFloatValue(allocator, {2.f})},
+          /*succeeded*/ false);
+  EXPECT_FALSE(manager->HasCachedOutputs(0));
+
+  // and the run after a failure is all dirty again since the baseline was dropped
+  std::vector<OrtValue> same_feeds{MakeFloatValue(allocator, {1.f}), MakeFloatValue(allocator, {2.f})};
+  manager->BeginRun(names, same_feeds);
+  EXPECT_TRUE(manager->IsNodeDirty(0));
+  manager->EndRun(true);
+}
+
+TEST(DeltaExecutionManagerTest, CacheBudgetBoundsCopies) {
+  AllocatorPtr allocator = std::make_shared<CPUAllocator>();
+  auto manager = MakeManager(allocator, /*cache_budget_bytes*/ sizeof(float) * 2);
+
+  std::vector<std::string> names{"x", "y"};
+  std::vector<OrtValue> feeds{MakeFloatValue(allocator, {1.f}), MakeFloatValue(allocator, {2.f})};
+  manager->BeginRun(names, feeds);
+
+  // a four-float output exceeds the two-float budget and is not cached
+  OrtValue large = MakeFloatValue(allocator, {1.f, 2.f, 3.f, 4.f});
+  const OrtValue* large_outputs[] = {&large};
+  manager->OnNodeExecuted(0, large_outputs);
+  EXPECT_FALSE(manager->HasCachedOutputs(0));
+
+  // a one-float output fits; a second one still fits, a third does not
+  OrtValue small = MakeFloatValue(allocator, {1.f});
+  const OrtValue* small_outputs[] = {&small};
+  manager->OnNodeExecuted(0, small_outputs);
+  manager->OnNodeExecuted(1, small_outputs);
+  manager->OnNodeExecuted(2, small_outputs);
+  EXPECT_TRUE(manager->HasCachedOutputs(0));
+  EXPECT_TRUE(manager->HasCachedOutputs(1));
+  EXPECT_FALSE(manager->HasCachedOutputs(2));
+
+  manager->EndRun(true);
+}
+
+}  // namespace test
+}  // namespace onnxruntime
@@ -0,0 +1,210 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#if !defined(ORT_MINIMAL_BUILD)
+
+#include "core/session/dynamic_batcher.h"
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "core/graph/model.h"
+#include "core/session/inference_session.h"
+#include "test/framework/test_utils.h"
+#include "test/test_environment.h"
+#include "test/util/include/asserts.h"
+
+namespace onnxruntime {
+namespace test {
+
+namespace {
+
+// Y = Add(X1, X2) with inputs of shape [N, 2], so requests that differ only in
+// the batch dimension can be coalesced.
+std::string CreateAddModel() {
+  std::unordered_map<std::string, int> domain_to_version;
+  domain_to_version[kOnnxDomain] = 14;
+  Model model("dynamic_batcher_test", false, ModelMetaData(), PathString(),
+              IOnnxRuntimeOpSchemaRegistryList(), domain_to_version, {},
+              DefaultLoggingManager().DefaultLogger());
+  Graph& graph = model.MainGraph();
+
+  ONNX_NAMESPACE::TypeProto float_nx2;
+  float_nx2.mutable_tensor_type()->set_elem_type(ONNX_NAMESPACE::TensorProto_DataType_FLOAT);
+  auto* shape = float_nx2.mutable_tensor_type()->mutable_shape();
+  shape->add_dim()->set_dim_param("N");
+  shape->add_dim()->set_dim_value(2);
+
+  auto& x1 = graph.GetOrCreateNodeArg("X1", &float_nx2);
+  auto& x2 = graph.GetOrCreateNodeArg("X2", &float_nx2);
+  auto& y = graph.GetOrCreateNodeArg("Y", &float_nx2);
+  graph.AddNode("add", "Add", "add the two feeds", {&x1, &x2}, {&y});
+  EXPECT_STATUS_OK(graph.Resolve());
+
+  std::string model_data;
+  model.ToProto().SerializeToString(&model_data);
+  return model_data;
+}
+
+std::unique_ptr<InferenceSession> CreateAddSession() {
+  const std::string model_data = CreateAddModel();
+  SessionOptions so;
+  so.session_logid = "DynamicBatcherTest";
+  auto session = std::make_unique<InferenceSession>(so, GetEnvironment());
+  EXPECT_STATUS_OK(session->Load(model_data.data(), static_cast<int>(model_data.size())));
+  EXPECT_STATUS_OK(session->Initialize());
+  return session;
+}
+
+// A [rows, 2] float feed holding start, start + 1, ...
+OrtValue MakeFeed(int64_t rows, float start) {
+  std::vector<float> values(static_cast<size_t>(rows) * 2);
+  for (size_t i = 0; i < values.size(); ++i) {
+    values[i] = start + static_cast<float>(i);
+  }
+  OrtValue value;
+  CreateMLValue<float>(TestCPUExecutionProvider()->CreatePreferredAllocators()[0], {rows, 2}, values, &value);
+  return value;
+}
+
+// Expected Y for feeds built with MakeFeed(rows, start1) and MakeFeed(rows, start2).
+std::vector<float> ExpectedSum(int64_t rows, float start1, float start2) {
+  std::vector<float> expected(static_cast<size_t>(rows) * 2);
+  for (size_t i = 0; i < expected.size(); ++i) {
+    expected[i] = start1 + start2 + 2.0f * static_cast<float>(i);
+  }
+  return expected;
+}
+
+void VerifyFetches(const std::vector<OrtValue>& fetches, const std::vector<int64_t>& expected_dims,
+                   const std::vector<float>& expected_values) {
+  ASSERT_EQ(fetches.size(), 1u);
+  const Tensor& tensor = fetches[0].Get<Tensor>();
+  ASSERT_EQ(tensor.Shape(), TensorShape(expected_dims));
+  const std::vector<float> found(tensor.Data<float>(), tensor.Data<float>() + expected_values.size());
+  ASSERT_EQ(found, expected_values);
+}
+
+const std::vector<std::string> kFeedNames{"X1", "X2"};
+const std::vector<std::string> kOutputNames{"Y"};
+
+}  // namespace
+
+// A lone request whose batch never fills runs after the timeout expires.
+TEST(DynamicBatcherTest, TimeoutExpiryRunsLoneRequest) {
+  auto session = CreateAddSession();
+  DynamicBatcherOptions options;
+  options.max_batch_size = 4;
+  options.batch_timeout = std::chrono::milliseconds(5);
+  DynamicBatcher batcher(*session, options);
+
+  const std::vector<OrtValue> feeds{MakeFeed(2, 1.0f), MakeFeed(2, 10.0f)};
+  std::vector<OrtValue> fetches;
+  ASSERT_STATUS_OK(batcher.Run(RunOptions{}, kFeedNames, feeds, kOutputNames, &fetches));
+  VerifyFetches(fetches, {2, 2}, ExpectedSum(2, 1.0f, 10.0f));
+}
+
+// When the batch fills, the leader wakes well before the timeout and each
+// request gets its own slice of the batched output.
+TEST(DynamicBatcherTest, BatchFullWakesLeaderAndScattersOutputs) {
+  auto session = CreateAddSession();
+  DynamicBatcherOptions options;
+  options.max_batch_size = 2;
+  options.batch_timeout = std::chrono::seconds(30);
+  DynamicBatcher batcher(*session, options);
+
+  const auto start_time = std::chrono::steady_clock::now();
+
+  const std::vector<OrtValue> feeds_a{MakeFeed(2, 1.0f), MakeFeed(2, 10.0f)};
+  common::Status status_a = common::Status::OK();
+  std::vector<OrtValue> fetches_a;
+  std::thread requester([&]() {
+    status_a = batcher.Run(RunOptions{}, kFeedNames, feeds_a, kOutputNames, &fetches_a);
+  });
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+  const std::vector<OrtValue> feeds_b{MakeFeed(3, 100.0f), MakeFeed(3, 200.0f)};
+  std::vector<OrtValue> fetches_b;
+  const common::Status status_b = batcher.Run(RunOptions{}, kFeedNames, feeds_b, kOutputNames, &fetches_b);
+  requester.join();
+
+  const auto elapsed = std::chrono::steady_clock::now() - start_time;
+  EXPECT_LT(elapsed, std::chrono::seconds(10)) << "the full batch should not wait for the timeout";
+
+  ASSERT_STATUS_OK(status_a);
+  ASSERT_STATUS_OK(status_b);
+  VerifyFetches(fetches_a, {2, 2}, ExpectedSum(2, 1.0f, 10.0f));
+  VerifyFetches(fetches_b, {3, 2}, ExpectedSum(3, 100.0f, 200.0f));
+}
+
+// A failure of the batched run is propagated to every request in the batch.
+TEST(DynamicBatcherTest, BatchFailurePropagatesToFollowers) {
+  auto session = CreateAddSession();
+  DynamicBatcherOptions options;
+  options.max_batch_size = 2;
+  options.batch_timeout = std::chrono::seconds(30);
+  DynamicBatcher batcher(*session, options);
+
+  // Both requests ask for an output the model does not have, so the single
+  // underlying Run fails after the batch has been formed.
+  const std::vector<std::string> bad_output_names{"Nope"};
+
+  const std::vector<OrtValue> feeds_a{MakeFeed(2, 1.0f), MakeFeed(2, 10.0f)};
+  common::Status status_a = common::Status::OK();
+  std::vector<OrtValue> fetches_a;
+  std::thread requester([&]() {
+    status_a = batcher.Run(RunOptions{}, kFeedNames, feeds_a, bad_output_names, &fetches_a);
+  });
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+  const std::vector<OrtValue> feeds_b{MakeFeed(2, 5.0f), MakeFeed(2, 50.0f)};
+  std::vector<OrtValue> fetches_b;
+  const common::Status status_b = batcher.Run(RunOptions{}, kFeedNames, feeds_b, bad_output_names, &fetches_b);
+  requester.join();
+
+  EXPECT_FALSE(status_a.IsOK());
+  EXPECT_FALSE(status_b.IsOK());
+  EXPECT_EQ(status_a.ErrorMessage(), status_b.ErrorMessage());
+}
+
+// A request whose feeds disagree on the leading dimension must not join a
+// batch: the leading dimension of feeds[0] is used as the scatter split size.
+// Such a request bypasses batching and surfaces the model's own error, while a
+// concurrent well-formed request is unaffected.
+TEST(DynamicBatcherTest, MismatchedFeedLeadingDimsBypassBatching) {
+  auto session = CreateAddSession();
+  DynamicBatcherOptions options;
+  options.max_batch_size = 2;
+  options.batch_timeout = std::chrono::milliseconds(300);
+  DynamicBatcher batcher(*session, options);
+
+  const std::vector<OrtValue> feeds_a{MakeFeed(2, 1.0f), MakeFeed(2, 10.0f)};
+  common::Status status_a = common::Status::OK();
+  std::vector<OrtValue> fetches_a;
+  std::thread requester([&]() {
+    status_a = batcher.Run(RunOptions{}, kFeedNames, feeds_a, kOutputNames, &fetches_a);
+  });
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+  const std::vector<OrtValue> feeds_b{MakeFeed(2, 5.0f), MakeFeed(3, 50.0f)};
+  std::vector<OrtValue> fetches_b;
+  const common::Status status_b = batcher.Run(RunOptions{}, kFeedNames, feeds_b, kOutputNames, &fetches_b);
+  requester.join();
+
+  EXPECT_FALSE(status_b.IsOK()) << "a request with mismatched leading dimensions should run directly and fail";
+  ASSERT_STATUS_OK(status_a);
+  VerifyFetches(fetches_a, {2, 2}, ExpectedSum(2, 1.0f, 10.0f));
+}
+
+}  // namespace test
+}  // namespace onnxruntime
+
+#endif  // !defined(ORT_MINIMAL_BUILD)
@@ -0,0 +1,56 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/ep_boundary_stats.h"
+
+#include "gtest/gtest.h"
+
+namespace onnxruntime {
+namespace test {
+
+TEST(EpBoundaryStatsTest, LooksUpClassifiedNodesOnly) {
+  InlinedHashMap<NodeIndex, EpBoundaryStats::NodeBoundary> boundaries;
+  EpBoundaryStats::NodeBoundary memcpy_boundary;
+  memcpy_boundary.is_memcpy = true;
+  memcpy_boundary.crossing_inputs.emplace_back(0, "CPUExecutionProvider -> CUDAExecutionProvider");
+  boundaries.emplace(NodeIndex{3}, std::move(memcpy_boundary));
+
+  EpBoundaryStats stats{std::move(boundaries)};
+
+  const auto* boundary = stats.GetNodeBoundary(3);
+  ASSERT_NE(boundary, nullptr);
+  EXPECT_TRUE(boundary->is_memcpy);
+  ASSERT_EQ(boundary->crossing_inputs.size(), 1u);
+  EXPECT_EQ(boundary->crossing_inputs[0].first, 0);
+
+  EXPECT_EQ(stats.GetNodeBoundary(4), nullptr);
+}
+
+TEST(EpBoundaryStatsTest, AccumulatesPerTransition) {
+  EpBoundaryStats stats{{}};
+  const std::string to_gpu = "CPUExecutionProvider -> CUDAExecutionProvider";
+  const std::string to_cpu = "CUDAExecutionProvider -> CPUExecutionProvider";
+
+  stats.Record(to_gpu, 1024, /*from_memcpy*/ true, 5000);
+  stats.Record(to_gpu, 2048, /*from_memcpy*/ true, 7000);
+  // A compute node consuming a value produced on another EP counts bytes but no copy time.
+  stats.Record(to_cpu, 512, /*from_memcpy*/ false, 0);
+
+  const auto snapshot = stats.GetStats();
+  ASSERT_EQ(snapshot.size(), 2u);
+
+  const auto& gpu_stats = snapshot.at(to_gpu);
+  EXPECT_EQ(gpu_stats.crossings, 2u);
+  EXPECT_EQ(gpu_stats.bytes, 3072u);
+  EXPECT_EQ(gpu_stats.memcpy_count, 2u);
+  EXPECT_EQ(gpu_stats.memcpy_time_ns, 12000u);
+
+  const auto& cpu_stats = snapshot.at(to_cpu);
+  EXPECT_EQ(cpu_stats.crossings, 1u);
+  EXPECT_EQ(cpu_stats.bytes, 512u);
+  EXPECT_EQ(cpu_stats.memcpy_count, 0u);
+  EXPECT_EQ(cpu_stats.memcpy_time_ns, 0u);
+}
+
+}  // namespace test
+}  // namespace onnxruntime
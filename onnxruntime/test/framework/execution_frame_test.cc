@@ -370,6 +370,143 @@ TEST_F(ExecutionFrameTest, MemPatternTest) {
   ASSERT_EQ(p->GetBlock(4)->offset_, kAllocAlignment);
 }
 
+#ifndef ENABLE_TRAINING
+// Training builds resolve shapes up front in GeneratePatternGroupCache; this covers the
+// inference-side path where shapes observed during the pattern-tracing run are cached and
+// served to later runs with the same input-shape signature.
+TEST_F(ExecutionFrameTest, InferredShapeCacheTest) {
+  auto cpu_xp = CreateCPUExecutionProvider();
+  auto xp_type = cpu_xp->Type();
+  std::unordered_map<std::string, int> domain_to_version;
+  domain_to_version[onnxruntime::kOnnxDomain] = 7;
+  onnxruntime::Model model("test", true, ModelMetaData(), PathString(), IOnnxRuntimeOpSchemaRegistryList(),
+                           domain_to_version, {}, DefaultLoggingManager().DefaultLogger());
+  onnxruntime::Graph& graph = model.MainGraph();
+
+  TypeProto tensor_float_batch_by_2;
+  tensor_float_batch_by_2.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  tensor_float_batch_by_2.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_param("batch");
+  tensor_float_batch_by_2.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(2);
+
+  TypeProto tensor_float_2_by_2;
+  tensor_float_2_by_2.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  tensor_float_2_by_2.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(2);
+  tensor_float_2_by_2.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(2);
+
+  TypeProto tensor_float;
+  tensor_float.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+
+  onnxruntime::NodeArg input_def1("X1", &tensor_float_batch_by_2),
+      input_def2("X2", &tensor_float_2_by_2),
+      gemm_out_def("T1", &tensor_float);
+
+  // shape inferencing during Resolve gives T1 the symbolic shape ["batch", 2]
+  onnxruntime::Node& node =
+      graph.AddNode("node1", "MatMul", "gemm1", ArgMap{&input_def1, &input_def2}, ArgMap{&gemm_out_def});
+  node.SetExecutionProviderType(xp_type);
+
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  KernelRegistryManager kernel_registry_manager;
+
+  ExecutionProviders execution_providers;
+  ASSERT_STATUS_OK(execution_providers.Add(xp_type, std::move(cpu_xp)));
+  ASSERT_STATUS_OK(kernel_registry_manager.RegisterKernels(execution_providers));
+
+  DataTransferManager dtm;
+  ExternalDataLoaderManager edlm;
+  profiling::Profiler profiler;
+
+  SessionOptions sess_options;
+  sess_options.enable_mem_pattern = true;
+  sess_options.execution_mode = ExecutionMode::ORT_SEQUENTIAL;
+  sess_options.use_deterministic_compute = false;
+  sess_options.enable_mem_reuse = true;
+
+  SessionState state(graph, execution_providers, &tp_, nullptr, dtm, edlm,
+                     DefaultLoggingManager().DefaultLogger(), profiler, sess_options);
+
+  ASSERT_STATUS_OK(state.FinalizeSessionState(ORT_TSTR(""), kernel_registry_manager));
+
+  const OrtValueNameIdxMap& mlvalue_name_idx_map(state.GetOrtValueNameIdxMap());
+
+  int x1_idx = -1, x2_idx = -1, t1_idx = -1;
+  ASSERT_TRUE(mlvalue_name_idx_map.GetIdx("X1", x1_idx).IsOK());
+  ASSERT_TRUE(mlvalue_name_idx_map.GetIdx("X2", x2_idx).IsOK());
+  ASSERT_TRUE(mlvalue_name_idx_map.GetIdx("T1", t1_idx).IsOK());
+
+  auto cpu_allocator = execution_providers.Get(xp_type)->CreatePreferredAllocators()[0];
+
+  OrtValue v1, v2;
+  CreateMLValue<float>(cpu_allocator,
+                       std::vector<int64_t>{3, 2},
+                       std::vector<float>(6, 1.0f), &v1);
+  CreateMLValue<float>(cpu_allocator,
+                       std::vector<int64_t>{2, 2},
+                       std::vector<float>(4, 1.0f), &v2);
+
+  const TensorShape t1_shape(std::vector<int64_t>{3, 2});
+
+  // first run with this signature: no cached pattern, so the frame traces a new one and
+  // records the shapes it sees
+  {
+    std::vector<OrtValue> outputs;
+    ExecutionFrame frame(
+        AsSpan({x1_idx, x2_idx}),
+        AsSpan({v1, v2}),
+        AsSpan({t1_idx}),
+        outputs,
+        {},
+#ifdef ORT_ENABLE_STREAM
+        {},
+#endif
+        state);
+
+    ASSERT_TRUE(frame.HasMemoryPatternPlanner());
+
+    // no shapes available yet on a cache miss
+    TensorShape inferred_shape;
+    ASSERT_FALSE(frame.TryGetInferredShape(2, inferred_shape));
+
+    OrtValue* p_t1 = nullptr;
+    ASSERT_STATUS_OK(frame.GetOrCreateNodeOutputMLValue(0, 2, &t1_shape, p_t1, node));
+    ASSERT_TRUE(p_t1 != nullptr && p_t1->IsAllocated());
+
+    MemoryPatternGroup pattern;
+    ASSERT_STATUS_OK(frame.GeneratePatterns(pattern));
+
+    auto observed_shapes = frame.TakeObservedShapes();
+    auto it = observed_shapes.find(t1_idx);
+    ASSERT_NE(it, observed_shapes.end()) << "T1's shape is determined by the batch dim so it should be recorded";
+    EXPECT_EQ(it->second, t1_shape);
+
+    ASSERT_STATUS_OK(state.UpdateMemoryPatternGroupCache(AsSpan({v1, v2}), std::move(pattern),
+                                                         std::move(observed_shapes)));
+  }
+
+  // second run with the same signature: the cached shapes serve TryGetInferredShape
+  {
+    std::vector<OrtValue> outputs;
+    ExecutionFrame frame(
+        AsSpan({x1_idx, x2_idx}),
+        AsSpan({v1, v2}),
+        AsSpan({t1_idx}),
+        outputs,
+        {},
+#ifdef ORT_ENABLE_STREAM
+        {},
+#endif
+        state);
+
+    ASSERT_FALSE(frame.HasMemoryPatternPlanner()) << "pattern should be served from the cache";
+
+    TensorShape inferred_shape;
+    ASSERT_TRUE(frame.TryGetInferredShape(2, inferred_shape));
+    EXPECT_EQ(inferred_shape, t1_shape);
+  }
+}
+#endif  // !ENABLE_TRAINING
+
 #ifdef ENABLE_TRAINING
 TEST_F(ExecutionFrameTest, MemPatternWithExternalOutputsTest) {
   auto cpu_xp = CreateCPUExecutionProvider();
@@ -403,6 +403,363 @@ TEST(InferenceSessionTests, NoTimeout) {
   RunModel(session_object, run_options);
 }
 
+TEST(InferenceSessionTests, WarmUp) {
+  SessionOptions so;
+
+  so.session_logid = "InferenceSessionTests.WarmUp";
+
+  InferenceSession session_object{so, GetEnvironment()};
+
+  // warming up before Initialize is an error
+  ASSERT_STATUS_NOT_OK(session_object.WarmUp());
+
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  // no signatures: model-declared shapes with free dimensions set to 1
+  ASSERT_STATUS_OK(session_object.WarmUp());
+
+  // explicit shape signatures, one warm-up run each
+  std::vector<std::unordered_map<std::string, std::vector<int64_t>>> signatures{
+      {{"X", {3, 2}}},
+      {{"X", {3, 2}}}};
+  ASSERT_STATUS_OK(session_object.WarmUp(signatures));
+
+  // the session still serves real requests after warming up
+  RunOptions run_options;
+  run_options.run_tag = "one session/one tag";
+  RunModel(session_object, run_options);
+}
+
+TEST(InferenceSessionTests, RunMany) {
+  SessionOptions so;
+
+  so.session_logid = "InferenceSessionTests.RunMany";
+
+  InferenceSession session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  // mul_1 computes Y = X * W with W = {1, 2, 3, 4, 5, 6}; entry i feeds a constant i + 1
+  constexpr size_t num_entries = 4;
+  std::vector<int64_t> dims_mul_x = {3, 2};
+  std::vector<std::string> feed_names = {"X"};
+  std::vector<std::vector<OrtValue>> feeds_batch(num_entries);
+  for (size_t i = 0; i < num_entries; ++i) {
+    std::vector<float> values_mul_x(6, static_cast<float>(i + 1));
+    OrtValue ml_value;
+    CreateMLValue<float>(TestCPUExecutionProvider()->CreatePreferredAllocators()[0], dims_mul_x, values_mul_x,
+                         &ml_value);
+    feeds_batch[i].push_back(ml_value);
+  }
+
+  std::vector<std::string> output_names = {"Y"};
+  std::vector<std::vector<OrtValue>> fetches_batch;
+  RunOptions run_options;
+  run_options.run_tag = "one session/one tag";
+  ASSERT_STATUS_OK(session_object.RunMany(run_options, feed_names, feeds_batch, output_names, &fetches_batch));
+
+  ASSERT_EQ(fetches_batch.size(), num_entries);
+  for (size_t i = 0; i < num_entries; ++i) {
+    std::vector<float> expected_values_mul_y(6);
+    for (size_t j = 0; j < expected_values_mul_y.size(); ++j) {
+      expected_values_mul_y[j] = static_cast<float>(i + 1) * static_cast<float>(j + 1);
+    }
+    VerifyOutputs(fetches_batch[i], dims_mul_x, expected_values_mul_y);
+  }
+
+  // an entry whose feed count does not match the shared feed names is rejected up front
+  feeds_batch[1].clear();
+  ASSERT_STATUS_NOT_OK(session_object.RunMany(run_options, feed_names, feeds_batch, output_names, &fetches_batch));
+}
+
+TEST(InferenceSessionTests, TrimKernelRegistriesAfterInitialization) {
+  SessionOptions so;
+  so.session_logid = "InferenceSessionTests.TrimKernelRegistriesAfterInitialization";
+  ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsTrimKernelRegistriesAfterInitialization, "1"));
+
+  InferenceSession session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  // the trimmed session still serves requests; the kernels it uses were kept
+  RunOptions run_options;
+  run_options.run_tag = "one session/one tag";
+  RunModel(session_object, run_options);
+
+  // a second session is unaffected: the CPU EP rebuilds a full registry rather than
+  // handing out the trimmed one
+  SessionOptions so2;
+  so2.session_logid = "InferenceSessionTests.TrimKernelRegistriesAfterInitialization2";
+  InferenceSession session_object2{so2, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object2.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object2.Initialize());
+  RunModel(session_object2, run_options);
+}
+
+TEST(InferenceSessionTests, RunDeadline) {
+  SessionOptions so;
+  so.session_logid = "InferenceSessionTests.RunDeadline";
+
+  InferenceSession session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  // a generous deadline does not interfere with a normal run
+  RunOptions run_options;
+  run_options.run_tag = "one session/one tag";
+  ASSERT_STATUS_OK(run_options.config_options.AddConfigEntry(kOrtRunOptionsConfigDeadlineMs, "60000"));
+  RunModel(session_object, run_options);
+
+  // a non-numeric budget fails the run up front rather than being silently ignored
+  RunOptions bad_run_options;
+  ASSERT_STATUS_OK(bad_run_options.config_options.AddConfigEntry(kOrtRunOptionsConfigDeadlineMs, "soon"));
+
+  std::vector<int64_t> dims_mul_x = {3, 2};
+  std::vector<float> values_mul_x = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f};
+  OrtValue ml_value;
+  CreateMLValue<float>(TestCPUExecutionProvider()->CreatePreferredAllocators()[0], dims_mul_x, values_mul_x,
+                       &ml_value);
+  NameMLValMap feeds;
+  feeds.insert(std::make_pair("X", ml_value));
+  std::vector<std::string> output_names{"Y"};
+  std::vector<OrtValue> fetches;
+
+  common::Status st = session_object.Run(bad_run_options, feeds, output_names, &fetches);
+  ASSERT_FALSE(st.IsOK());
+  ASSERT_NE(st.ErrorMessage().find(kOrtRunOptionsConfigDeadlineMs), std::string::npos) << st.ErrorMessage();
+}
+
+TEST(InferenceSessionTests, RunIntraOpMaxDegreeOfParallelism) {
+  SessionOptions so;
+  so.session_logid = "InferenceSessionTests.RunIntraOpMaxDegreeOfParallelism";
+  so.intra_op_param.thread_pool_size = 4;
+
+  InferenceSession session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  // a capped run produces the same results as an uncapped one on the same session
+  RunOptions run_options;
+  run_options.run_tag = "one session/one tag";
+  ASSERT_STATUS_OK(run_options.config_options.AddConfigEntry(kOrtRunOptionsConfigIntraOpMaxDegreeOfParallelism, "1"));
+  RunModel(session_object, run_options);
+
+  RunOptions uncapped_run_options;
+  uncapped_run_options.run_tag = "one session/one tag";
+  RunModel(session_object, uncapped_run_options);
+
+  // a non-numeric cap fails the run up front rather than being silently ignored
+  RunOptions bad_run_options;
+  ASSERT_STATUS_OK(bad_run_options.config_options.AddConfigEntry(kOrtRunOptionsConfigIntraOpMaxDegreeOfParallelism,
+                                                                 "all"));
+
+  std::vector<int64_t> dims_mul_x = {3, 2};
+  std::vector<float> values_mul_x = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f};
+  OrtValue ml_value;
+  CreateMLValue<float>(TestCPUExecutionProvider()->CreatePreferredAllocators()[0], dims_mul_x, values_mul_x,
+                       &ml_value);
+  NameMLValMap feeds;
+  feeds.insert(std::make_pair("X", ml_value));
+  std::vector<std::string> output_names{"Y"};
+  std::vector<OrtValue> fetches;
+
+  common::Status st = session_object.Run(bad_run_options, feeds, output_names, &fetches);
+  ASSERT_FALSE(st.IsOK());
+  ASSERT_NE(st.ErrorMessage().find(kOrtRunOptionsConfigIntraOpMaxDegreeOfParallelism), std::string::npos)
+      << st.ErrorMessage();
+}
+
+TEST(InferenceSessionTests, KernelTimeHistograms) {
+  SessionOptions so;
+  so.session_logid = "InferenceSessionTests.KernelTimeHistograms";
+  ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsKernelTimeHistogramSamplingInterval, "1"));
+
+  InferenceSession session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  // collection is enabled but nothing has executed yet, so the snapshot has no entries
+  std::string histograms_json;
+  ASSERT_STATUS_OK(session_object.GetKernelTimeHistograms(histograms_json));
+  ASSERT_EQ(histograms_json.find("\"invocations\""), std::string::npos);
+
+  RunOptions run_options;
+  run_options.run_tag = "one session/one tag";
+  RunModel(session_object, run_options);
+
+  ASSERT_STATUS_OK(session_object.GetKernelTimeHistograms(histograms_json));
+  ASSERT_NE(histograms_json.find("\"op_type\":\"Mul\""), std::string::npos);
+  ASSERT_NE(histograms_json.find("\"invocations\":1"), std::string::npos);
+  ASSERT_NE(histograms_json.find("\"buckets_ns_log2\":["), std::string::npos);
+}
+
+TEST(InferenceSessionTests, KernelTimeHistogramsDisabledByDefault) {
+  SessionOptions so;
+  so.session_logid = "InferenceSessionTests.KernelTimeHistogramsDisabledByDefault";
+
+  InferenceSession session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  std::string histograms_json;
+  ASSERT_FALSE(session_object.GetKernelTimeHistograms(histograms_json).IsOK());
+}
+
+TEST(InferenceSessionTests, MemoryWatermarks) {
+  SessionOptions so;
+  so.session_logid = "InferenceSessionTests.MemoryWatermarks";
+
+  InferenceSession session_object{so, GetEnvironment()};
+
+  std::string watermarks_json;
+  ASSERT_FALSE(session_object.GetMemoryWatermarks(watermarks_json).IsOK());
+
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  // nothing has executed yet, so the snapshot has no entries
+  ASSERT_STATUS_OK(session_object.GetMemoryWatermarks(watermarks_json));
+  ASSERT_EQ(watermarks_json.find("\"peak_bytes\""), std::string::npos);
+
+  RunOptions run_options;
+  run_options.run_tag = "one session/one tag";
+  RunModel(session_object, run_options);
+
+  // the run's peak is attributed to the shape signature of its feeds
+  ASSERT_STATUS_OK(session_object.GetMemoryWatermarks(watermarks_json));
+  ASSERT_NE(watermarks_json.find("\"input_shapes\":\"X:{3,2};\""), std::string::npos);
+  ASSERT_NE(watermarks_json.find("\"runs\":1"), std::string::npos);
+  ASSERT_NE(watermarks_json.find("\"peak_bytes\":"), std::string::npos);
+}
+
+TEST(InferenceSessionTests, RunScratchArena) {
+  SessionOptions so;
+  so.session_logid = "InferenceSessionTests.RunScratchArena";
+  ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsEnableRunScratchArena, "1"));
+
+  InferenceSession session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  // first run has no recorded scratch peak and serves scratch from the regular allocator;
+  // the second run pre-sizes its slab from whatever the first one recorded. both must
+  // produce the expected results.
+  RunOptions run_options;
+  run_options.run_tag = "one session/one tag";
+  RunModel(session_object, run_options);
+  RunModel(session_object, run_options);
+}
+
+TEST(InferenceSessionTests, DispatchReport) {
+  SessionOptions so;
+  so.session_logid = "InferenceSessionTests.DispatchReport";
+
+  InferenceSession session_object{so, GetEnvironment()};
+
+  std::string report_json;
+  ASSERT_FALSE(session_object.GetDispatchReport(report_json).IsOK());
+
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  // available right after initialization, without running anything
+  ASSERT_STATUS_OK(session_object.GetDispatchReport(report_json));
+  ASSERT_NE(report_json.find("\"mlas_dispatch\":"), std::string::npos);
+  ASSERT_NE(report_json.find("\"mlas_supported\":"), std::string::npos);
+  ASSERT_NE(report_json.find("\"registered_eps\":[\"CPUExecutionProvider\""), std::string::npos);
+  // everything is on the CPU provider, so nothing fell back
+  ASSERT_NE(report_json.find("\"fallback_nodes\":[]"), std::string::npos);
+}
+
+TEST(InferenceSessionTests, PresizeArenasFromMemoryWatermarksProfile) {
+  // capture a profile from one session
+  std::string watermarks_json;
+  {
+    SessionOptions so;
+    so.session_logid = "InferenceSessionTests.PresizeArenasFromMemoryWatermarksProfile.Capture";
+
+    InferenceSession session_object{so, GetEnvironment()};
+    ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+    ASSERT_STATUS_OK(session_object.Initialize());
+
+    RunOptions run_options;
+    run_options.run_tag = "capture";
+    RunModel(session_object, run_options);
+
+    ASSERT_STATUS_OK(session_object.GetMemoryWatermarks(watermarks_json));
+  }
+
+  const char* const profile_path = "memory_watermarks_profile.json";
+  {
+    std::ofstream profile_file{profile_path};
+    profile_file << watermarks_json;
+  }
+
+  // a new session loading the profile initializes and runs as usual
+  SessionOptions so;
+  so.session_logid = "InferenceSessionTests.PresizeArenasFromMemoryWatermarksProfile";
+  ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsMemoryWatermarksProfilePath, profile_path));
+
+  InferenceSession session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  RunOptions run_options;
+  run_options.run_tag = "presized";
+  RunModel(session_object, run_options);
+
+  // an unreadable profile fails session creation rather than silently skipping the pre-sizing
+  SessionOptions bad_so;
+  bad_so.session_logid = "InferenceSessionTests.PresizeArenasFromMemoryWatermarksProfile.BadPath";
+  ASSERT_STATUS_OK(bad_so.config_options.AddConfigEntry(kOrtSessionOptionsMemoryWatermarksProfilePath,
+                                                        "nonexistent_memory_watermarks_profile.json"));
+
+  InferenceSession bad_session{bad_so, GetEnvironment()};
+  ASSERT_STATUS_OK(bad_session.Load(MODEL_URI));
+  ASSERT_FALSE(bad_session.Initialize().IsOK());
+}
+
+TEST(InferenceSessionTests, PartitionPinnedNodes) {
+  // pinning the node to a registered provider initializes and runs as usual
+  SessionOptions so;
+  so.session_logid = "InferenceSessionTests.PartitionPinnedNodes";
+  ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsPartitionPinnedNodes,
+                                                    "mul_1:CPUExecutionProvider"));
+
+  InferenceSession session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  RunOptions run_options;
+  run_options.run_tag = "pinned";
+  RunModel(session_object, run_options);
+
+  // pinning to a provider that is not registered fails initialization
+  {
+    SessionOptions bad_so;
+    bad_so.session_logid = "InferenceSessionTests.PartitionPinnedNodes.BadProvider";
+    ASSERT_STATUS_OK(bad_so.config_options.AddConfigEntry(kOrtSessionOptionsPartitionPinnedNodes,
+                                                          "mul_1:NotARegisteredExecutionProvider"));
+
+    InferenceSession bad_session{bad_so, GetEnvironment()};
+    ASSERT_STATUS_OK(bad_session.Load(MODEL_URI));
+    ASSERT_FALSE(bad_session.Initialize().IsOK());
+  }
+
+  // a pin naming a node that does not exist fails initialization rather than being ignored
+  {
+    SessionOptions bad_so;
+    bad_so.session_logid = "InferenceSessionTests.PartitionPinnedNodes.BadNode";
+    ASSERT_STATUS_OK(bad_so.config_options.AddConfigEntry(kOrtSessionOptionsPartitionPinnedNodes,
+                                                          "not_a_real_node:CPUExecutionProvider"));
+
+    InferenceSession bad_session{bad_so, GetEnvironment()};
+    ASSERT_STATUS_OK(bad_session.Load(MODEL_URI));
+    ASSERT_FALSE(bad_session.Initialize().IsOK());
+  }
+}
+
 TEST(InferenceSessionTests, OnlyExecutePathToFetches) {
   SessionOptions so;
 
@@ -419,6 +776,34 @@ TEST(InferenceSessionTests, OnlyExecutePathToFetches) {
   RunModel(session_object, run_options);
 }
 
+TEST(InferenceSessionTests, OutputReadyCallback) {
+  SessionOptions so;
+
+  so.session_logid = "InferenceSessionTests.OutputReadyCallback";
+
+  InferenceSession session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  // the streaming callback must deliver each requested output during Run, with the same content
+  // the fetches hold once Run returns
+  std::vector<std::string> streamed_names;
+  std::vector<float> streamed_values;
+  RunOptions run_options;
+  run_options.run_tag = "one session/one tag";
+  run_options.output_ready_callback = [&](const std::string& output_name, const OrtValue& value) {
+    streamed_names.push_back(output_name);
+    const auto& tensor = value.Get<Tensor>();
+    streamed_values.assign(tensor.Data<float>(), tensor.Data<float>() + tensor.Shape().Size());
+  };
+  RunModel(session_object, run_options);
+
+  const std::vector<std::string> expected_names{"Y"};
+  const std::vector<float> expected_values{1.0f, 4.0f, 9.0f, 16.0f, 25.0f, 36.0f};
+  ASSERT_EQ(streamed_names, expected_names);
+  ASSERT_EQ(streamed_values, expected_values);
+}
+
 TEST(InferenceSessionTests, DisableCPUArena) {
   SessionOptions so;
 
@@ -779,6 +1164,67 @@ TEST(InferenceSessionTests, CheckRunProfilerWithStartProfile) {
     count++;
   }
 }
+
+TEST(InferenceSessionTests, CheckRunProfilerHierarchical) {
+  // model with a Scan node so the subgraph nodes run once per sequence element
+  SessionOptions so;
+
+  so.session_logid = "CheckRunProfilerHierarchical";
+  so.enable_profiling = true;
+  so.profile_file_prefix = ORT_TSTR("onnxprofile_profile_hierarchical_test");
+
+  InferenceSession session_object(so, GetEnvironment());
+  ASSERT_STATUS_OK(session_object.Load("testdata/scan_1.onnx"));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  std::vector<int64_t> X_dims = {5, 1, 3};
+  std::vector<float> X(15, 0.1f);
+  OrtValue ml_value;
+  CreateMLValue<float>(TestCPUExecutionProvider()->CreatePreferredAllocators()[0], X_dims, X, &ml_value);
+  NameMLValMap feeds = {{"Input13165", ml_value}};
+
+  auto model_outputs = session_object.GetModelOutputs();
+  ASSERT_STATUS_OK(model_outputs.first);
+  std::vector<std::string> output_names;
+  for (const auto* def : *model_outputs.second) {
+    output_names.push_back(def->Name());
+  }
+
+  RunOptions run_options;
+  run_options.run_tag = "RunTag";
+  std::vector<OrtValue> fetches;
+  ASSERT_STATUS_OK(session_object.Run(run_options, feeds, output_names, &fetches));
+
+  std::string profile_file = session_object.EndProfiling();
+
+  // the kernel events of the Scan body carry the parent frame stack ("<scan node>#<iteration>")
+  std::ifstream profile(profile_file);
+  ASSERT_TRUE(profile);
+  bool has_scoped_kernel_event = false;
+  std::string line;
+  while (std::getline(profile, line)) {
+    if (line.find("_kernel_time") != string::npos &&
+        line.find("\"stack\"") != string::npos &&
+        line.find("#0\"") != string::npos) {
+      has_scoped_kernel_event = true;
+    }
+  }
+  ASSERT_TRUE(has_scoped_kernel_event);
+
+  // the folded stack export aggregates kernel time per stack in flamegraph.pl format:
+  // "frame;frame;node <microseconds>"
+  std::ifstream folded(profile_file + ".folded");
+  ASSERT_TRUE(folded);
+  bool has_scoped_stack = false;
+  while (std::getline(folded, line)) {
+    auto space_pos = line.rfind(' ');
+    ASSERT_NE(space_pos, string::npos);
+    ASSERT_GT(std::stoll(line.substr(space_pos + 1)), -1);
+    // one entry per iteration of the Scan node
+    has_scoped_stack = has_scoped_stack || line.find("#4;") != string::npos;
+  }
+  ASSERT_TRUE(has_scoped_stack);
+}
 #endif  // __wasm__
 
 TEST(InferenceSessionTests, CheckRunProfilerStartTime) {
@@ -1073,6 +1519,64 @@ TEST(InferenceSessionTests, TestIOBindingReuse) {
   }
 }
 
+TEST(InferenceSessionTests, TestIOBindingRingBufferInput) {
+  SessionOptions so;
+  InferenceSession session_object(so, GetEnvironment());
+  std::unique_ptr<Model> p_model;
+  CreateMatMulModel(p_model, kCpuExecutionProvider);
+
+  std::string s1;
+  p_model->ToProto().SerializeToString(&s1);
+  std::stringstream sstr(s1);
+  ASSERT_TRUE(session_object.Load(sstr).IsOK());
+  ASSERT_STATUS_OK(session_object.Initialize());
+  unique_ptr<IOBinding> io_binding;
+  ASSERT_STATUS_OK(session_object.NewIOBinding(&io_binding));
+
+  // two-slot ring of 2x2 float tensors for input 'A' in caller-owned memory
+  constexpr size_t kStride = 4 * sizeof(float);
+  float ring[8] = {1.f, 2.f, 3.f, 4.f,   // slot 0
+                   5.f, 6.f, 7.f, 8.f};  // slot 1
+  OrtMemoryInfo cpu_info(CPU, OrtDeviceAllocator);
+  ASSERT_STATUS_OK(io_binding->BindInputRing("A", DataTypeImpl::GetType<float>(), TensorShape({2, 2}),
+                                             cpu_info, ring, sizeof(ring), kStride));
+  ASSERT_STATUS_OK(io_binding->BindInputRingSlot("A", 0));
+
+  // multiply by the identity so Y == A
+  OrtValue input_b;
+  vector<float> values_b{1.f, 0.f, 0.f, 1.f};
+  CreateMLValue<float>(TestCPUExecutionProvider()->CreatePreferredAllocators()[0], {2, 2}, values_b, &input_b);
+  ASSERT_STATUS_OK(io_binding->BindInput("B", input_b));
+  ASSERT_STATUS_OK(io_binding->BindOutput("Y", OrtDevice{}));
+
+  // offsets must respect the stride and the region bounds, and the input must have a ring
+  ASSERT_FALSE(io_binding->BindInputRingSlot("A", kStride / 2).IsOK());
+  ASSERT_FALSE(io_binding->BindInputRingSlot("A", 2 * kStride).IsOK());
+  ASSERT_FALSE(io_binding->BindInputRingSlot("B", 0).IsOK());
+
+  RunOptions run_options;
+  int fence_signals = 0;
+
+  for (size_t slot = 0; slot < 2; ++slot) {
+    ASSERT_STATUS_OK(io_binding->BindInputRingSlot("A", slot * kStride,
+                                                   [&fence_signals] { ++fence_signals; }));
+
+    // the bound feed is a view over the caller's ring slot, not a copy
+    ASSERT_EQ(io_binding->GetInputs()[0].Get<Tensor>().DataRaw(), ring + slot * 4);
+
+    // the fence fires once the run consuming the slot has returned, not before
+    ASSERT_EQ(fence_signals, static_cast<int>(slot));
+    ASSERT_STATUS_OK(session_object.Run(run_options, *io_binding));
+    ASSERT_EQ(fence_signals, static_cast<int>(slot) + 1);
+
+    auto span = io_binding->GetOutputs()[0].Get<Tensor>().DataAsSpan<float>();
+    ASSERT_TRUE(static_cast<size_t>(span.size()) == 4);
+    for (size_t i = 0; i < 4; ++i) {
+      ASSERT_EQ(span[i], ring[slot * 4 + i]);
+    }
+  }
+}
+
 TEST(InferenceSessionTests, InvalidInputTypeOfTensorElement) {
   SessionOptions so;
 
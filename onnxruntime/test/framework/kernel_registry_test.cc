@@ -101,4 +101,64 @@ TEST(KernelRegistryTests, two_versions4) {
   ASSERT_STATUS_NOT_OK(RegKernels(r, function_table, CreateFakeKernel));
 }
 
+// Trim drops unused kernels but preserves the kept entries (and their addresses, which
+// session states hold onto).
+TEST(KernelRegistryTests, trim) {
+  KernelRegistry r;
+  std::vector<std::unique_ptr<KernelDef>> function_table;
+  function_table.emplace_back(KernelDefBuilder().MayInplace(0, 0).TypeConstraint("T", DataTypeImpl::GetTensorType<float>()).SetName("Elu").SetDomain("").SinceVersion(6).Provider(kCpuExecutionProvider).Build());
+  function_table.emplace_back(KernelDefBuilder().MayInplace(0, 0).TypeConstraint("T", DataTypeImpl::GetTensorType<float>()).SetName("Relu").SetDomain("").SinceVersion(6).Provider(kCpuExecutionProvider).Build());
+  ASSERT_STATUS_OK(RegKernels(r, function_table, CreateFakeKernel));
+  ASSERT_FALSE(r.IsTrimmed());
+
+  const KernelCreateInfo* elu_kci = nullptr;
+  for (const auto& [key, kci] : r.GetKernelCreateMap()) {
+    ORT_UNUSED_PARAMETER(key);
+    if (kci.kernel_def->OpName() == "Elu") {
+      elu_kci = &kci;
+    }
+  }
+  ASSERT_NE(elu_kci, nullptr);
+
+  InlinedHashSet<const KernelCreateInfo*> kernels_to_keep{elu_kci};
+  r.Trim(kernels_to_keep);
+
+  ASSERT_TRUE(r.IsTrimmed());
+  ASSERT_EQ(r.GetKernelCreateMap().size(), size_t{1});
+  ASSERT_EQ(&r.GetKernelCreateMap().begin()->second, elu_kci);
+
+  // trimming again with the same keep set is a no-op
+  r.Trim(kernels_to_keep);
+  ASSERT_EQ(r.GetKernelCreateMap().size(), size_t{1});
+}
+
+// Lookups resolve through the hash index maintained by Register and rebuilt by Trim.
+TEST(KernelRegistryTests, indexed_lookup) {
+  KernelRegistry r;
+  std::vector<std::unique_ptr<KernelDef>> function_table;
+  function_table.emplace_back(KernelDefBuilder().MayInplace(0, 0).TypeConstraint("T", DataTypeImpl::GetTensorType<float>()).SetName("Elu").SetDomain("").SinceVersion(6).Provider(kCpuExecutionProvider).Build());
+  function_table.emplace_back(KernelDefBuilder().MayInplace(0, 0).TypeConstraint("T", DataTypeImpl::GetTensorType<float>()).SetName("Relu").SetDomain("").SinceVersion(6).Provider(kCpuExecutionProvider).Build());
+  ASSERT_STATUS_OK(RegKernels(r, function_table, CreateFakeKernel));
+
+  KernelRegistry::TypeConstraintMap type_constraints{{"T", DataTypeImpl::GetTensorType<float>()}};
+  const KernelCreateInfo* found = nullptr;
+  ASSERT_STATUS_OK(r.TryFindKernel(kCpuExecutionProvider, "Elu", "", 6, type_constraints, &found));
+  ASSERT_NE(found, nullptr);
+  ASSERT_EQ(found->kernel_def->OpName(), "Elu");
+  ASSERT_STATUS_NOT_OK(r.TryFindKernel(kCpuExecutionProvider, "Softsign", "", 6, type_constraints, &found));
+
+  // after trimming away Relu, Elu still resolves to the same entry and Relu does not resolve
+  const KernelCreateInfo* elu_kci = found = nullptr;
+  for (const auto& [key, kci] : r.GetKernelCreateMap()) {
+    ORT_UNUSED_PARAMETER(key);
+    if (kci.kernel_def->OpName() == "Elu") {
+      elu_kci = &kci;
+    }
+  }
+  r.Trim(InlinedHashSet<const KernelCreateInfo*>{elu_kci});
+  ASSERT_STATUS_OK(r.TryFindKernel(kCpuExecutionProvider, "Elu", "", 6, type_constraints, &found));
+  ASSERT_EQ(found, elu_kci);
+  ASSERT_STATUS_NOT_OK(r.TryFindKernel(kCpuExecutionProvider, "Relu", "", 6, type_constraints, &found));
+}
+
 }  // namespace onnxruntime::test
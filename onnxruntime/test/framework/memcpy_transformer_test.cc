@@ -340,6 +340,69 @@ TEST(TransformerTest, MemcpyTransformerTestGraphInputConsumedOnMultipleDevices)
   ASSERT_TRUE(op_count_map["MemcpyFromHost"] == 1);
 }
 
+TEST(TransformerTest, MemcpyTransformerTestDeviceResidentIo) {
+  // In this test, a graph input and a graph output are declared device-resident. Both are
+  // consumed on the CPU as well, so copies are still needed, but we expect the provider side
+  // to keep the original defs (no MemcpyFromHost staging) and the CPU consumers to read
+  // MemcpyToHost copies.
+  std::unordered_map<std::string, int> domain_to_version;
+  domain_to_version[kOnnxDomain] = 7;
+  auto model = std::make_shared<onnxruntime::Model>("test", false, ModelMetaData(), PathString(),
+                                                    IOnnxRuntimeOpSchemaRegistryList(),
+                                                    domain_to_version, std::vector<ONNX_NAMESPACE::FunctionProto>(),
+                                                    DefaultLoggingManager().DefaultLogger());
+  onnxruntime::Graph& graph = model->MainGraph();
+
+  TypeProto tensor_float_type;
+  tensor_float_type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  onnxruntime::NodeArg i1_def("I1", &tensor_float_type),
+      o1_def("O1", &tensor_float_type),
+      o2_def("O2", &tensor_float_type),
+      o3_def("O3", &tensor_float_type);
+
+  // I1 is a graph input consumed on both devices; O2 is a graph output produced on the GPU and
+  // also consumed by a CPU node
+  auto& node1 = graph.AddNode("node1", "MatMul", "cpu operator1", ArgMap{&i1_def, &i1_def}, ArgMap{&o1_def});
+  node1.SetExecutionProviderType(onnxruntime::kCpuExecutionProvider);
+  auto& node2 = graph.AddNode("node2", "MatMul", "gpu operator1", ArgMap{&i1_def, &i1_def}, ArgMap{&o2_def});
+  node2.SetExecutionProviderType(onnxruntime::kCudaExecutionProvider);
+  auto& node3 = graph.AddNode("node3", "Clip", "cpu operator2", ArgMap{&o2_def}, ArgMap{&o3_def});
+  node3.SetExecutionProviderType(onnxruntime::kCpuExecutionProvider);
+
+  graph.SetOutputs({&o1_def, &o2_def, &o3_def});
+  auto status = graph.Resolve();
+  ASSERT_TRUE(status.IsOK()) << status.ErrorMessage();
+
+  KernelRegistryManager kernel_registry_manager;
+  ExecutionProviders execution_providers;
+  ASSERT_STATUS_OK(execution_providers.Add(onnxruntime::kCudaExecutionProvider, DefaultCudaExecutionProvider()));
+  ASSERT_STATUS_OK(execution_providers.Add(onnxruntime::kCpuExecutionProvider,
+                                           std::make_unique<CPUExecutionProvider>(CPUExecutionProviderInfo())));
+  KernelRegistryManager test_registry_manager;
+  ASSERT_STATUS_OK(test_registry_manager.RegisterKernels(execution_providers));
+
+  MemcpyTransformer transformer({onnxruntime::kCudaExecutionProvider}, test_registry_manager,
+                                InlinedHashSet<std::string>{"I1", "O2"});
+
+  bool modified = false;
+  status = transformer.Apply(graph, modified, DefaultLoggingManager().DefaultLogger());
+  EXPECT_TRUE(status.IsOK()) << status.ErrorMessage();
+  EXPECT_TRUE(modified);
+
+  // the provider consumers/producer keep the device-resident defs in place
+  EXPECT_EQ(node2.InputDefs()[0], &i1_def);
+  EXPECT_EQ(node2.InputDefs()[1], &i1_def);
+  EXPECT_EQ(node2.OutputDefs()[0], &o2_def);
+
+  // the CPU consumers read host copies
+  ExpectCopy(i1_def, "MemcpyToHost", node1, 0);
+  ExpectCopy(node2, "MemcpyToHost", node3, 0);
+
+  auto op_count_map = CountOpsInGraph(graph);
+  ASSERT_TRUE(op_count_map["MemcpyFromHost"] == 0);
+  ASSERT_TRUE(op_count_map["MemcpyToHost"] == 2);
+}
+
 TEST(TransformerTest, MemcpyTransformerTestImplicitInputConsumedOnMultipleDevices) {
   // In this test, an implicit input (consumed by If subgraphs)
   // is consumed by 2 nodes partitioned to different devices.
@@ -0,0 +1,69 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/memory_budget.h"
+
+#include "gtest/gtest.h"
+
+namespace onnxruntime {
+namespace test {
+
+TEST(SessionMemoryBudgetTest, RelievesInRegistrationOrderAndStopsEarly) {
+  SessionMemoryBudget budget(1024);
+
+  std::vector<std::string> invoked;
+  budget.RegisterEvictionCallback("first", [&](size_t /*bytes_needed*/) {
+    invoked.push_back("first");
+    return size_t{100};
+  });
+  budget.RegisterEvictionCallback("second", [&](size_t bytes_needed) {
+    invoked.push_back("second");
+    return bytes_needed;  // releases exactly what is still missing
+  });
+  budget.RegisterEvictionCallback("third", [&](size_t /*bytes_needed*/) {
+    invoked.push_back("third");
+    return size_t{0};
+  });
+
+  // the second callback covers the remainder, so the third never runs
+  EXPECT_EQ(budget.Relieve(300), 300u);
+  ASSERT_EQ(invoked.size(), 2u);
+  EXPECT_EQ(invoked[0], "first");
+  EXPECT_EQ(invoked[1], "second");
+}
+
+TEST(SessionMemoryBudgetTest, CallbackSeesRemainingBytesNeeded) {
+  SessionMemoryBudget budget(1024);
+
+  size_t second_bytes_needed = 0;
+  budget.RegisterEvictionCallback("first", [](size_t /*bytes_needed*/) { return size_t{100}; });
+  budget.RegisterEvictionCallback("second", [&](size_t bytes_needed) {
+    second_bytes_needed = bytes_needed;
+    return size_t{0};
+  });
+
+  // 500 requested, the first released 100, so the second is asked for the remaining 400;
+  // with nothing more to release the total falls short of the request
+  EXPECT_EQ(budget.Relieve(500), 100u);
+  EXPECT_EQ(second_bytes_needed, 400u);
+}
+
+TEST(SessionMemoryBudgetTest, StatsAccumulateAcrossRelieves) {
+  SessionMemoryBudget budget(2048);
+  budget.RegisterEvictionCallback("cache", [](size_t /*bytes_needed*/) { return size_t{64}; });
+
+  EXPECT_EQ(budget.Relieve(32), 64u);
+  EXPECT_EQ(budget.Relieve(128), 64u);
+
+  const auto stats = budget.GetStats();
+  EXPECT_EQ(stats.budget_bytes, 2048u);
+  EXPECT_EQ(stats.pressure_events, 2u);
+  EXPECT_EQ(stats.released_bytes, 128u);
+  ASSERT_EQ(stats.callbacks.size(), 1u);
+  EXPECT_EQ(stats.callbacks[0].name, "cache");
+  EXPECT_EQ(stats.callbacks[0].invocations, 2u);
+  EXPECT_EQ(stats.callbacks[0].released_bytes, 128u);
+}
+
+}  // namespace test
+}  // namespace onnxruntime
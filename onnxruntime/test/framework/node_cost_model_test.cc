@@ -0,0 +1,59 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/node_cost_model.h"
+
+#include <fstream>
+
+#include "gtest/gtest.h"
+
+#include "test/util/include/asserts.h"
+#include "test/util/include/temp_dir.h"
+
+namespace onnxruntime {
+namespace test {
+
+namespace {
+std::filesystem::path WriteCostFile(const TemporaryDirectory& tmp_dir, const std::string& contents) {
+  const auto path = std::filesystem::path{tmp_dir.Path()} / "node_costs.txt";
+  std::ofstream file(path);
+  file << contents;
+  return path;
+}
+}  // namespace
+
+TEST(NodeCostModelTest, LoadAndLookUp) {
+  TemporaryDirectory tmp_dir{ORT_TSTR("node_cost_model_test_tmp_dir")};
+  const auto path = WriteCostFile(tmp_dir,
+                                  "# calibrated 2026-08-30\n"
+                                  "transfer_latency_us 5\n"
+                                  "transfer_bandwidth_bytes_per_us 1000\n"
+                                  "Add 0.5 2.0  # tiny elementwise\n"
+                                  "MatMul 900 12\n");
+
+  NodeCostModel model;
+  ASSERT_STATUS_OK(model.Load(path));
+
+  const auto* add_cost = model.LookUp("Add");
+  ASSERT_NE(add_cost, nullptr);
+  EXPECT_DOUBLE_EQ(add_cost->cpu_us, 0.5);
+  EXPECT_DOUBLE_EQ(add_cost->device_us, 2.0);
+
+  EXPECT_EQ(model.LookUp("Conv"), nullptr);
+
+  // fixed latency plus bytes over bandwidth
+  EXPECT_DOUBLE_EQ(model.TransferCost(0), 5.0);
+  EXPECT_DOUBLE_EQ(model.TransferCost(2000), 7.0);
+}
+
+TEST(NodeCostModelTest, RejectsMalformedEntries) {
+  TemporaryDirectory tmp_dir{ORT_TSTR("node_cost_model_test_tmp_dir")};
+
+  NodeCostModel model;
+  EXPECT_FALSE(model.Load(WriteCostFile(tmp_dir, "Add 0.5\n")).IsOK());          // missing device cost
+  EXPECT_FALSE(model.Load(WriteCostFile(tmp_dir, "Add -1 2\n")).IsOK());         // negative cost
+  EXPECT_FALSE(model.Load(tmp_dir.Path() + ORT_TSTR("/does_not_exist")).IsOK());  // missing file
+}
+
+}  // namespace test
+}  // namespace onnxruntime
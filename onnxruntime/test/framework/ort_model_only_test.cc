@@ -350,6 +350,118 @@ TEST(OrtModelOnlyTests, MetadataSerialization) {
   SaveAndCompareModels(ORT_TSTR("testdata/model_with_metadata.onnx"), ort_file);
 }
 
+// serialize pre-packed weights into the ORT format file and verify a session that declares the
+// matching target ISA adopts them instead of packing at load, producing the same results.
+TEST(OrtModelOnlyTests, SerializeToOrtFormatWithPrePackedWeights) {
+  const auto onnx_file = ORT_TSTR("testdata/ort_prepacked_weights.test_output.onnx");
+  const auto ort_file = ORT_TSTR("testdata/ort_prepacked_weights.test_output.ort");
+  // opaque declaration - the saving and loading sessions must use the same value
+  constexpr const char* target_isa = "test-isa";
+
+  // create a model with a float MatMul consuming a constant initializer for B.
+  // MatMul<float> supports adopting pre-packed weights stored in the model.
+  {
+    std::unordered_map<std::string, int> domain_to_version{{kOnnxDomain, 13}};
+    Model model("PrePackedWeightsSerialization", false, ModelMetaData(), PathString(),
+                IOnnxRuntimeOpSchemaRegistryList(), domain_to_version,
+                std::vector<ONNX_NAMESPACE::FunctionProto>(), DefaultLoggingManager().DefaultLogger());
+    auto& graph = model.MainGraph();
+
+    TypeProto a_type;
+    a_type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+    a_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(2);
+    a_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(4);
+
+    TypeProto b_type;
+    b_type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+    b_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(4);
+    b_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(8);
+
+    auto& arg_a = graph.GetOrCreateNodeArg("A", &a_type);
+    auto& arg_b = graph.GetOrCreateNodeArg("B", &b_type);
+    auto& arg_y = graph.GetOrCreateNodeArg("Y", nullptr);
+
+    graph.AddNode("matmul", "MatMul", "", {&arg_a, &arg_b}, {&arg_y});
+
+    ONNX_NAMESPACE::TensorProto b_init;
+    b_init.set_name("B");
+    b_init.add_dims(4);
+    b_init.add_dims(8);
+    b_init.set_data_type(TensorProto_DataType_FLOAT);
+    // quarters so the expected values computed below are exact regardless of summation order
+    for (int i = 0; i < 4 * 8; ++i) {
+      b_init.add_float_data(static_cast<float>(i) * 0.25f);
+    }
+    graph.AddInitializedTensor(b_init);
+
+    ASSERT_STATUS_OK(graph.Resolve());
+    ASSERT_STATUS_OK(Model::Save(model, onnx_file));
+  }
+
+  // save to ORT format, storing the pre-packed weight for B
+  {
+    SessionOptions so;
+    so.session_logid = "SerializeToOrtFormatWithPrePackedWeights";
+    so.optimized_model_filepath = ort_file;
+    ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsConfigSaveModelFormat, "ORT"));
+    ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsConfigPrepackedWeightsTargetIsa,
+                                                      target_isa));
+
+    InferenceSessionWrapper session_object{so, GetEnvironment()};
+    ASSERT_STATUS_OK(session_object.Load(onnx_file));
+    ASSERT_STATUS_OK(session_object.Initialize());
+    ASSERT_EQ(session_object.GetSessionState().GetNumberOfPrepacksCounter(), static_cast<size_t>(1));
+  }
+
+  std::vector<float> input_data(2 * 4);
+  for (size_t i = 0; i < input_data.size(); ++i) {
+    input_data[i] = static_cast<float>(i + 1);
+  }
+
+  std::vector<float> expected(2 * 8, 0.f);
+  for (int m = 0; m < 2; ++m) {
+    for (int n = 0; n < 8; ++n) {
+      for (int k = 0; k < 4; ++k) {
+        expected[m * 8 + n] += input_data[m * 4 + k] * (static_cast<float>(k * 8 + n) * 0.25f);
+      }
+    }
+  }
+
+  auto run_and_verify = [&](bool declare_target_isa, size_t expected_model_prepacked_weights_used) {
+    SessionOptions so;
+    so.session_logid = "LoadOrtFormatWithPrePackedWeights";
+    ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsConfigLoadModelFormat, "ORT"));
+    if (declare_target_isa) {
+      ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsConfigPrepackedWeightsTargetIsa,
+                                                        target_isa));
+    }
+
+    InferenceSessionWrapper session_object{so, GetEnvironment()};
+    ASSERT_STATUS_OK(session_object.Load(ort_file));
+    ASSERT_STATUS_OK(session_object.Initialize());
+    ASSERT_EQ(session_object.GetSessionState().GetUsedModelPrePackedWeightCounter(),
+              expected_model_prepacked_weights_used);
+
+    OrtValue ml_value;
+    CreateMLValue<float>(TestCPUExecutionProvider()->CreatePreferredAllocators()[0], {2, 4}, input_data,
+                         &ml_value);
+
+    std::vector<OrtValue> fetches;
+    ASSERT_STATUS_OK(session_object.Run(NameMLValMap{{"A", ml_value}}, {"Y"}, &fetches));
+
+    const auto& output = fetches[0].Get<Tensor>();
+    ASSERT_EQ(output.Shape(), TensorShape({2, 8}));
+    EXPECT_THAT(std::vector<float>(output.Data<float>(), output.Data<float>() + output.Shape().Size()),
+                ::testing::ContainerEq(expected));
+  };
+
+  // declaring the matching target ISA adopts the stored pre-packed weight, skipping packing
+  run_and_verify(true, 1);
+
+  // without a declared target ISA the stored weights are ignored and packing runs as usual
+  run_and_verify(false, 0);
+}
+
 // test we can load an old ORT format model and run it in a full build.
 // we changed from using kernel hashes to kernel type constraints in v5, so an old model should be able to be loaded
 // in a full build if we add the kernel type constraints during loading. this also means we can save the updated
@@ -0,0 +1,46 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/ort_value_buffer_pool.h"
+
+#include "gtest/gtest.h"
+
+namespace onnxruntime {
+namespace test {
+
+TEST(OrtValueBufferPoolTest, AcquireFromEmptyPool) {
+  OrtValueBufferPool pool;
+  auto buffer = pool.Acquire();
+  EXPECT_TRUE(buffer.empty());
+}
+
+TEST(OrtValueBufferPoolTest, ReleasedCapacityIsReused) {
+  OrtValueBufferPool pool;
+
+  auto buffer = pool.Acquire();
+  buffer.resize(128);
+  const auto capacity = buffer.capacity();
+  pool.Release(std::move(buffer));
+
+  auto reused = pool.Acquire();
+  EXPECT_TRUE(reused.empty());
+  EXPECT_GE(reused.capacity(), capacity);
+
+  // The pool handed out its only buffer; the next acquire starts fresh.
+  auto fresh = pool.Acquire();
+  EXPECT_EQ(fresh.capacity(), InlinedVector<OrtValue>{}.capacity());
+}
+
+TEST(OrtValueBufferPoolTest, ReleaseDestroysValues) {
+  OrtValueBufferPool pool;
+
+  auto buffer = pool.Acquire();
+  buffer.resize(4);
+  pool.Release(std::move(buffer));
+
+  auto reused = pool.Acquire();
+  EXPECT_TRUE(reused.empty());
+}
+
+}  // namespace test
+}  // namespace onnxruntime
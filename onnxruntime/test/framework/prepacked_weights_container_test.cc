@@ -0,0 +1,108 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/prepacked_weights_container.h"
+
+#include <cstring>
+#include <numeric>
+
+#include "gtest/gtest.h"
+
+#include "core/platform/env.h"
+
+namespace onnxruntime {
+namespace test {
+
+#if !defined(_WIN32) && !defined(__ANDROID__) && !defined(__EMSCRIPTEN__)
+
+namespace {
+
+// Use a process specific prefix so that concurrent test runs on the same
+// machine don't observe each other's segments.
+std::string GetTestSharedMemoryPrefix() {
+  return "ort_prepacked_weights_test." + std::to_string(Env::Default().GetSelfPid());
+}
+
+PrePackedWeights CreateTestPrePackedWeights(PrepackedWeightsContainer& container, size_t num_bytes) {
+  auto cpu_allocator = container.GetOrCreateAllocator(CPU);
+
+  PrePackedWeights prepacked_weights;
+  auto buffer = IAllocator::MakeUniquePtr<void>(cpu_allocator, num_bytes, true);
+
+  auto* data = static_cast<uint8_t*>(buffer.get());
+  std::iota(data, data + num_bytes, static_cast<uint8_t>(0));
+
+  prepacked_weights.buffers_.push_back(std::move(buffer));
+  prepacked_weights.buffer_sizes_.push_back(num_bytes);
+
+  // Mimic kernels that write a null place-holder for an input they didn't pack.
+  prepacked_weights.buffers_.push_back(nullptr);
+  prepacked_weights.buffer_sizes_.push_back(0);
+
+  return prepacked_weights;
+}
+
+}  // namespace
+
+TEST(PrepackedWeightsContainerTest, SharedMemoryBackedWeightVisibleToSecondContainer) {
+  const std::string prefix = GetTestSharedMemoryPrefix();
+  const std::string key = "TestOp+12345";
+  constexpr size_t num_bytes = 257;  // deliberately not a multiple of the segment alignment
+
+  PrepackedWeightsContainer writer_container(prefix);
+  ASSERT_TRUE(writer_container.WriteWeight(key, CreateTestPrePackedWeights(writer_container, num_bytes)));
+  ASSERT_TRUE(writer_container.HasWeight(key));
+  ASSERT_EQ(writer_container.GetNumberOfElements(), static_cast<size_t>(1));
+
+  // A second container with the same prefix stands in for another process:
+  // it must see the published weight without a WriteWeight() of its own.
+  PrepackedWeightsContainer reader_container(prefix);
+  ASSERT_EQ(reader_container.GetNumberOfElements(), static_cast<size_t>(0));
+  ASSERT_TRUE(reader_container.HasWeight(key));
+
+  const auto& writer_weight = writer_container.GetWeight(key);
+  const auto& reader_weight = reader_container.GetWeight(key);
+
+  ASSERT_EQ(reader_weight.buffer_sizes_, writer_weight.buffer_sizes_);
+  ASSERT_EQ(reader_weight.buffers_.size(), writer_weight.buffers_.size());
+
+  ASSERT_NE(reader_weight.buffers_[0].get(), nullptr);
+  EXPECT_EQ(std::memcmp(reader_weight.buffers_[0].get(), writer_weight.buffers_[0].get(), num_bytes), 0);
+
+  // The null place-holder must round-trip as a null place-holder.
+  EXPECT_EQ(reader_weight.buffers_[1].get(), nullptr);
+
+  reader_container.UnlinkSharedSegments();
+  writer_container.UnlinkSharedSegments();
+}
+
+TEST(PrepackedWeightsContainerTest, HasWeightIsFalseForUnpublishedKey) {
+  PrepackedWeightsContainer container(GetTestSharedMemoryPrefix());
+  ASSERT_FALSE(container.HasWeight("TestOp+does_not_exist"));
+  container.UnlinkSharedSegments();
+}
+
+TEST(PrepackedWeightsContainerTest, UnlinkedSegmentIsNotVisibleToNewContainers) {
+  const std::string prefix = GetTestSharedMemoryPrefix();
+  const std::string key = "TestOp+67890";
+
+  {
+    PrepackedWeightsContainer writer_container(prefix);
+    ASSERT_TRUE(writer_container.WriteWeight(key, CreateTestPrePackedWeights(writer_container, 64)));
+    writer_container.UnlinkSharedSegments();
+  }
+
+  PrepackedWeightsContainer reader_container(prefix);
+  ASSERT_FALSE(reader_container.HasWeight(key));
+}
+
+#else  // !defined(_WIN32) && !defined(__ANDROID__) && !defined(__EMSCRIPTEN__)
+
+TEST(PrepackedWeightsContainerTest, SharedMemoryBackingUnsupportedPlatformThrows) {
+  ASSERT_THROW(PrepackedWeightsContainer container("ort_prepacked_weights_test"), OnnxRuntimeException);
+}
+
+#endif
+
+}  // namespace test
+}  // namespace onnxruntime
@@ -0,0 +1,142 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/session/session_pipeline.h"
+
+#include "gtest/gtest.h"
+
+#include "core/framework/tensor.h"
+#include "core/session/inference_session.h"
+#include "test/framework/test_utils.h"
+#include "test/util/include/asserts.h"
+#include "test/util/include/test_environment.h"
+
+namespace onnxruntime {
+namespace test {
+
+static constexpr const ORTCHAR_T* kPipelineModelUri = ORT_TSTR("testdata/mul_1.onnx");
+
+namespace {
+void LoadStage(InferenceSession& session) {
+  ASSERT_STATUS_OK(session.Load(kPipelineModelUri));
+  ASSERT_STATUS_OK(session.Initialize());
+}
+
+OrtValue CreateInput() {
+  OrtValue ml_value;
+  CreateMLValue<float>(TestCPUExecutionProvider()->CreatePreferredAllocators()[0], {3, 2},
+                       {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f}, &ml_value);
+  return ml_value;
+}
+
+void ExpectSameTensor(const OrtValue& actual, const OrtValue& expected) {
+  const auto actual_data = actual.Get<Tensor>().DataAsSpan<float>();
+  const auto expected_data = expected.Get<Tensor>().DataAsSpan<float>();
+  ASSERT_EQ(actual_data.size(), expected_data.size());
+  for (size_t i = 0; i < expected_data.size(); ++i) {
+    EXPECT_EQ(actual_data[i], expected_data[i]) << "at index " << i;
+  }
+}
+}  // namespace
+
+TEST(SessionPipelineTest, ChainedStagesMatchManualRuns) {
+  SessionOptions so;
+  so.session_logid = "SessionPipelineTest.ChainedStagesMatchManualRuns";
+  InferenceSession stage0{so, GetEnvironment()};
+  InferenceSession stage1{so, GetEnvironment()};
+  LoadStage(stage0);
+  LoadStage(stage1);
+
+  OrtValue x = CreateInput();
+  RunOptions run_options;
+
+  // reference result: run the sessions by hand, feeding the intermediate back in
+  std::vector<OrtValue> y1;
+  ASSERT_STATUS_OK(stage0.Run(run_options, {{"X", x}}, {"Y"}, &y1));
+  std::vector<OrtValue> y2;
+  ASSERT_STATUS_OK(stage1.Run(run_options, {{"X", y1[0]}}, {"Y"}, &y2));
+
+  // the second stage's input X is supplied by the first stage's output Y
+  std::vector<SessionPipeline::Stage> stages{{&stage0, {}}, {&stage1, {{"X", "Y"}}}};
+  std::unique_ptr<SessionPipeline> pipeline;
+  ASSERT_STATUS_OK(SessionPipeline::Create(std::move(stages), pipeline));
+
+  std::vector<std::string> feed_names{"X"};
+  std::vector<OrtValue> feeds{x};
+  std::vector<OrtValue> fetches;
+  ASSERT_STATUS_OK(pipeline->Run(run_options, feed_names, feeds, fetches));
+
+  ASSERT_EQ(fetches.size(), size_t{1});
+  ExpectSameTensor(fetches[0], y2[0]);
+}
+
+TEST(SessionPipelineTest, OverlappedRequestsAllComplete) {
+  SessionOptions so;
+  so.session_logid = "SessionPipelineTest.OverlappedRequestsAllComplete";
+  InferenceSession stage0{so, GetEnvironment()};
+  InferenceSession stage1{so, GetEnvironment()};
+  LoadStage(stage0);
+  LoadStage(stage1);
+
+  std::vector<SessionPipeline::Stage> stages{{&stage0, {}}, {&stage1, {{"X", "Y"}}}};
+  std::unique_ptr<SessionPipeline> pipeline;
+  ASSERT_STATUS_OK(SessionPipeline::Create(std::move(stages), pipeline));
+
+  OrtValue x = CreateInput();
+  RunOptions run_options;
+  std::vector<std::string> feed_names{"X"};
+  std::vector<OrtValue> feeds{x};
+
+  // enqueue several requests before collecting any result so stages overlap
+  constexpr size_t kNumRequests = 4;
+  std::vector<std::vector<OrtValue>> fetches(kNumRequests);
+  std::vector<std::future<common::Status>> pending;
+  pending.reserve(kNumRequests);
+  for (size_t i = 0; i < kNumRequests; ++i) {
+    pending.push_back(pipeline->RunAsync(run_options, feed_names, feeds, fetches[i]));
+  }
+
+  for (size_t i = 0; i < kNumRequests; ++i) {
+    ASSERT_STATUS_OK(pending[i].get());
+    ASSERT_EQ(fetches[i].size(), size_t{1});
+    ExpectSameTensor(fetches[i][0], fetches[0][0]);
+  }
+}
+
+TEST(SessionPipelineTest, UnresolvableInputFails) {
+  SessionOptions so;
+  so.session_logid = "SessionPipelineTest.UnresolvableInputFails";
+  InferenceSession stage0{so, GetEnvironment()};
+  InferenceSession stage1{so, GetEnvironment()};
+  LoadStage(stage0);
+  LoadStage(stage1);
+
+  // the mapping points at a name no stage produces, so the second stage cannot resolve X
+  std::vector<SessionPipeline::Stage> stages{{&stage0, {}}, {&stage1, {{"X", "Z"}}}};
+  std::unique_ptr<SessionPipeline> pipeline;
+  ASSERT_STATUS_OK(SessionPipeline::Create(std::move(stages), pipeline));
+
+  OrtValue x = CreateInput();
+  RunOptions run_options;
+  std::vector<std::string> feed_names{"X"};
+  std::vector<OrtValue> feeds{x};
+  std::vector<OrtValue> fetches;
+  auto status = pipeline->Run(run_options, feed_names, feeds, fetches);
+  ASSERT_FALSE(status.IsOK());
+  EXPECT_NE(status.ErrorMessage().find("'Z'"), std::string::npos);
+}
+
+TEST(SessionPipelineTest, CreateRejectsUninitializedSession) {
+  SessionOptions so;
+  so.session_logid = "SessionPipelineTest.CreateRejectsUninitializedSession";
+  InferenceSession session{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session.Load(kPipelineModelUri));
+  // no Initialize()
+
+  std::vector<SessionPipeline::Stage> stages{{&session, {}}};
+  std::unique_ptr<SessionPipeline> pipeline;
+  ASSERT_FALSE(SessionPipeline::Create(std::move(stages), pipeline).IsOK());
+}
+
+}  // namespace test
+}  // namespace onnxruntime
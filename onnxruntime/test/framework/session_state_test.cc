@@ -605,6 +605,89 @@ TEST_P(SessionStatePrepackingTest, PrePackingTest) {
   ASSERT_EQ(const_initialized_tensors.size(), size_t(test_param.test_prepacking ? 0 : 1));
 }
 
+// Two initializers with identical bytes collapse to one buffer when
+// kOrtSessionOptionsShareDuplicateInitializers is enabled; one with different bytes keeps its own.
+TEST(SessionStateTest, ShareDuplicateInitializers) {
+  OrtThreadPoolParams to;
+  auto tp = concurrency::CreateThreadPool(&onnxruntime::Env::Default(), to, concurrency::ThreadPoolType::INTRA_OP);
+
+  ExecutionProviders execution_providers;
+  auto cpu_execution_provider = std::make_unique<CPUExecutionProvider>(CPUExecutionProviderInfo(false));
+  ASSERT_STATUS_OK(execution_providers.Add(kCpuExecutionProvider, std::move(cpu_execution_provider)));
+
+  DataTransferManager dtm;
+  ExternalDataLoaderManager edlm;
+  profiling::Profiler profiler;
+
+  std::unordered_map<std::string, int> domain_to_version;
+  domain_to_version[kOnnxDomain] = 11;
+  Model model("dedup_main", false, ModelMetaData(), PathString(), IOnnxRuntimeOpSchemaRegistryList(),
+              domain_to_version, std::vector<ONNX_NAMESPACE::FunctionProto>(),
+              DefaultLoggingManager().DefaultLogger());
+  Graph& graph = model.MainGraph();
+
+  TypeProto type_float;
+  type_float.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  type_float.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(256);
+
+  // 1KB of identical weight bytes in w0 and w1 (large enough for deduplication); w2 differs
+  // in a single element
+  std::vector<float> weight_data(256, 0.125f);
+  auto add_weight = [&graph](const std::string& name, const std::vector<float>& data) {
+    ONNX_NAMESPACE::TensorProto weight;
+    weight.set_name(name);
+    weight.set_data_type(TensorProto_DataType_FLOAT);
+    weight.add_dims(static_cast<int64_t>(data.size()));
+    weight.set_raw_data(data.data(), data.size() * sizeof(float));
+    graph.AddInitializedTensor(weight);
+  };
+  add_weight("w0", weight_data);
+  add_weight("w1", weight_data);
+  weight_data.back() = 0.25f;
+  add_weight("w2", weight_data);
+
+  auto& input_arg = graph.GetOrCreateNodeArg("x", &type_float);
+  auto& w0_arg = graph.GetOrCreateNodeArg("w0", &type_float);
+  auto& w1_arg = graph.GetOrCreateNodeArg("w1", &type_float);
+  auto& w2_arg = graph.GetOrCreateNodeArg("w2", &type_float);
+  auto& add0_out = graph.GetOrCreateNodeArg("add0_out", &type_float);
+  auto& add1_out = graph.GetOrCreateNodeArg("add1_out", &type_float);
+  auto& output_arg = graph.GetOrCreateNodeArg("y", &type_float);
+
+  graph.AddNode("add0", "Add", "", {&input_arg, &w0_arg}, {&add0_out});
+  graph.AddNode("add1", "Add", "", {&add0_out, &w1_arg}, {&add1_out});
+  graph.AddNode("add2", "Add", "", {&add1_out, &w2_arg}, {&output_arg});
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  SessionOptions sess_options;
+  sess_options.enable_mem_pattern = true;
+  sess_options.execution_mode = ExecutionMode::ORT_SEQUENTIAL;
+  sess_options.use_deterministic_compute = false;
+  sess_options.enable_mem_reuse = true;
+  sess_options.config_options.configurations[kOrtSessionOptionsShareDuplicateInitializers] = "1";
+
+  SessionState session_state(graph, execution_providers, tp.get(), nullptr, dtm, edlm,
+                             DefaultLoggingManager().DefaultLogger(), profiler, sess_options);
+
+  KernelRegistryManager kernel_registry_manager;
+  ASSERT_STATUS_OK(kernel_registry_manager.RegisterKernels(execution_providers));
+
+  PlaceAllNodesToCPUEP(graph);
+  ASSERT_STATUS_OK(session_state.FinalizeSessionState(std::basic_string<PATH_CHAR_TYPE>(),
+                                                      kernel_registry_manager));
+
+  const auto& name_to_idx = session_state.GetOrtValueNameIdxMap();
+  const auto& initialized_tensors = session_state.GetInitializedTensors();
+  auto data_ptr = [&](const char* name) {
+    int idx = -1;
+    EXPECT_STATUS_OK(name_to_idx.GetIdx(name, idx));
+    return initialized_tensors.at(idx).Get<Tensor>().DataRaw();
+  };
+
+  ASSERT_EQ(data_ptr("w0"), data_ptr("w1")) << "identical initializers should share one buffer";
+  ASSERT_NE(data_ptr("w0"), data_ptr("w2")) << "different bytes must never be aliased";
+}
+
 class SessionStateTestSharedInitalizersWithPrePacking : public ::testing::Test {
  protected:
   ExecutionProviders execution_providers;
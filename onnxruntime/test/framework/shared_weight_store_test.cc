@@ -0,0 +1,93 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/shared_weight_store.h"
+
+#if !defined(ORT_MINIMAL_BUILD)
+
+#include "gtest/gtest.h"
+
+#include "core/framework/session_options.h"
+#include "core/framework/tensor.h"
+#include "core/graph/onnx_protobuf.h"
+#include "test/util/include/asserts.h"
+
+namespace onnxruntime {
+namespace test {
+
+namespace {
+
+ONNX_NAMESPACE::ModelProto MakeModelWithInitializers() {
+  ONNX_NAMESPACE::ModelProto model_proto;
+  auto* graph_proto = model_proto.mutable_graph();
+
+  auto* weight = graph_proto->add_initializer();
+  weight->set_name("weight");
+  weight->add_dims(2);
+  weight->add_dims(2);
+  weight->set_data_type(ONNX_NAMESPACE::TensorProto_DataType_FLOAT);
+  for (float v : {1.f, 2.f, 3.f, 4.f}) {
+    weight->add_float_data(v);
+  }
+
+  auto* bias = graph_proto->add_initializer();
+  bias->set_name("bias");
+  bias->add_dims(2);
+  bias->set_data_type(ONNX_NAMESPACE::TensorProto_DataType_INT64);
+  bias->add_int64_data(10);
+  bias->add_int64_data(20);
+
+  return model_proto;
+}
+
+}  // namespace
+
+TEST(SharedWeightStoreTest, LoadAndLookup) {
+  SharedWeightStore store;
+  ASSERT_STATUS_OK(store.Load(MakeModelWithInitializers(), std::filesystem::path()));
+  ASSERT_EQ(store.GetNumberOfWeights(), 2u);
+
+  const OrtValue* weight = store.GetWeight("weight");
+  ASSERT_NE(weight, nullptr);
+  const Tensor& tensor = weight->Get<Tensor>();
+  ASSERT_EQ(tensor.Shape(), TensorShape({2, 2}));
+  // the store hands out non-owning views so SessionOptions::AddInitializer accepts them
+  ASSERT_FALSE(tensor.OwnsBuffer());
+  const float* data = tensor.Data<float>();
+  EXPECT_EQ(data[0], 1.f);
+  EXPECT_EQ(data[3], 4.f);
+
+  const OrtValue* bias = store.GetWeight("bias");
+  ASSERT_NE(bias, nullptr);
+  EXPECT_EQ(bias->Get<Tensor>().Data<int64_t>()[1], 20);
+
+  EXPECT_EQ(store.GetWeight("missing"), nullptr);
+}
+
+TEST(SharedWeightStoreTest, SessionsShareOneCopy) {
+  SharedWeightStore store;
+  ASSERT_STATUS_OK(store.Load(MakeModelWithInitializers(), std::filesystem::path()));
+
+  SessionOptions so1;
+  SessionOptions so2;
+  ASSERT_STATUS_OK(store.AddToSessionOptions(so1));
+  ASSERT_STATUS_OK(store.AddToSessionOptions(so2));
+
+  ASSERT_EQ(so1.initializers_to_share_map.size(), 2u);
+  ASSERT_EQ(so2.initializers_to_share_map.size(), 2u);
+  // both sessions reference the store's single buffer rather than per-session copies
+  EXPECT_EQ(so1.initializers_to_share_map.at("weight"), store.GetWeight("weight"));
+  EXPECT_EQ(so1.initializers_to_share_map.at("weight")->Get<Tensor>().DataRaw(),
+            so2.initializers_to_share_map.at("weight")->Get<Tensor>().DataRaw());
+}
+
+TEST(SharedWeightStoreTest, LoadTwiceFails) {
+  SharedWeightStore store;
+  ASSERT_STATUS_OK(store.Load(MakeModelWithInitializers(), std::filesystem::path()));
+  ASSERT_STATUS_NOT_OK(store.Load(MakeModelWithInitializers(), std::filesystem::path()));
+}
+
+}  // namespace test
+}  // namespace onnxruntime
+
+#endif  // !defined(ORT_MINIMAL_BUILD)
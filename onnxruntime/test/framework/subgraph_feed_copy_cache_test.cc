@@ -0,0 +1,75 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/utils.h"
+
+#include "gtest/gtest.h"
+
+#include "core/framework/tensor.h"
+
+namespace onnxruntime {
+namespace test {
+
+namespace {
+
+OrtValue MakeFloatValue(AllocatorPtr allocator, std::initializer_list<float> data) {
+  OrtValue value;
+  Tensor::InitOrtValue(DataTypeImpl::GetType<float>(),
+                       TensorShape({static_cast<int64_t>(data.size())}), allocator, value);
+  std::copy(data.begin(), data.end(), value.GetMutable<Tensor>()->MutableData<float>());
+  return value;
+}
+
+}  // namespace
+
+TEST(SubgraphFeedCopyCacheTest, ReuseRequiresImmutableMarkAndIdentity) {
+  AllocatorPtr allocator = std::make_shared<CPUAllocator>();
+  OrtValue source = MakeFloatValue(allocator, {1.f, 2.f});
+  OrtValue copied = MakeFloatValue(allocator, {1.f, 2.f});
+
+  utils::SubgraphFeedCopyCache cache{2};
+  cache.MarkImmutable(1);
+
+  OrtValue reused;
+
+  // nothing stored yet
+  EXPECT_FALSE(cache.TryReuse(1, source, reused));
+
+  // stores for feeds not marked immutable are dropped
+  cache.Store(0, source, copied);
+  EXPECT_FALSE(cache.TryReuse(0, source, reused));
+
+  cache.Store(1, source, copied);
+
+  // an OrtValue copy shares the Tensor instance, so it hits the cache
+  OrtValue source_alias = source;
+  ASSERT_TRUE(cache.TryReuse(1, source_alias, reused));
+  EXPECT_EQ(reused.Get<Tensor>().DataRaw(), copied.Get<Tensor>().DataRaw());
+
+  // a different value with identical contents is a different tensor and misses
+  OrtValue other = MakeFloatValue(allocator, {1.f, 2.f});
+  EXPECT_FALSE(cache.TryReuse(1, other, reused));
+
+  // a replacement store updates the entry
+  OrtValue other_copy = MakeFloatValue(allocator, {1.f, 2.f});
+  cache.Store(1, other, other_copy);
+  ASSERT_TRUE(cache.TryReuse(1, other, reused));
+  EXPECT_EQ(reused.Get<Tensor>().DataRaw(), other_copy.Get<Tensor>().DataRaw());
+  EXPECT_FALSE(cache.TryReuse(1, source, reused));
+}
+
+TEST(SubgraphFeedCopyCacheTest, OutOfRangeIndexIsIgnored) {
+  AllocatorPtr allocator = std::make_shared<CPUAllocator>();
+  OrtValue source = MakeFloatValue(allocator, {1.f});
+  OrtValue copied = MakeFloatValue(allocator, {1.f});
+
+  utils::SubgraphFeedCopyCache cache{1};
+  cache.MarkImmutable(0);
+
+  OrtValue reused;
+  cache.Store(3, source, copied);
+  EXPECT_FALSE(cache.TryReuse(3, source, reused));
+}
+
+}  // namespace test
+}  // namespace onnxruntime
@@ -0,0 +1,85 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/subgraph_result_cache.h"
+
+#include "gtest/gtest.h"
+
+#include "core/framework/tensor.h"
+
+namespace onnxruntime {
+namespace test {
+
+namespace {
+
+OrtValue MakeFloatValue(AllocatorPtr allocator, std::initializer_list<float> data) {
+  OrtValue value;
+  Tensor::InitOrtValue(DataTypeImpl::GetType<float>(),
+                       TensorShape({static_cast<int64_t>(data.size())}), allocator, value);
+  std::copy(data.begin(), data.end(), value.GetMutable<Tensor>()->MutableData<float>());
+  return value;
+}
+
+SubgraphResultCache::Fingerprint FingerprintOf(std::initializer_list<OrtValue> feeds) {
+  SubgraphResultCache::Fingerprint fingerprint{};
+  InlinedVector<OrtValue> feed_values(feeds.begin(), feeds.end());
+  EXPECT_TRUE(SubgraphResultCache::FingerprintFeeds(feed_values, fingerprint));
+  return fingerprint;
+}
+
+}  // namespace
+
+TEST(SubgraphResultCacheTest, FingerprintReflectsContents) {
+  AllocatorPtr allocator = std::make_shared<CPUAllocator>();
+
+  const auto fingerprint_a = FingerprintOf({MakeFloatValue(allocator, {1.f, 2.f})});
+  const auto fingerprint_same = FingerprintOf({MakeFloatValue(allocator, {1.f, 2.f})});
+  const auto fingerprint_other = FingerprintOf({MakeFloatValue(allocator, {1.f, 3.f})});
+
+  // identical contents in a different buffer fingerprint the same; different contents differ
+  EXPECT_EQ(fingerprint_a, fingerprint_same);
+  EXPECT_NE(fingerprint_a, fingerprint_other);
+
+  // a non-tensor feed cannot be fingerprinted
+  SubgraphResultCache::Fingerprint fingerprint{};
+  InlinedVector<OrtValue> unallocated{OrtValue{}};
+  EXPECT_FALSE(SubgraphResultCache::FingerprintFeeds(unallocated, fingerprint));
+}
+
+TEST(SubgraphResultCacheTest, StoreLookupAndEviction) {
+  AllocatorPtr allocator = std::make_shared<CPUAllocator>();
+  SubgraphResultCache cache{allocator, 2};
+
+  const auto fingerprint_a = FingerprintOf({MakeFloatValue(allocator, {1.f})});
+  const auto fingerprint_b = FingerprintOf({MakeFloatValue(allocator, {2.f})});
+  const auto fingerprint_c = FingerprintOf({MakeFloatValue(allocator, {3.f})});
+
+  EXPECT_FALSE(cache.Lookup(fingerprint_a).has_value());
+
+  OrtValue output = MakeFloatValue(allocator, {10.f, 20.f});
+  InlinedVector<OrtValue> outputs{output};
+  cache.Store(fingerprint_a, outputs);
+
+  auto cached = cache.Lookup(fingerprint_a);
+  ASSERT_TRUE(cached.has_value());
+  ASSERT_EQ(cached->size(), size_t{1});
+
+  // the cached value is a deep copy of the stored output, not an alias of it
+  const auto& cached_tensor = (*cached)[0].Get<Tensor>();
+  EXPECT_NE(cached_tensor.DataRaw(), output.Get<Tensor>().DataRaw());
+  EXPECT_EQ(cached_tensor.Shape(), output.Get<Tensor>().Shape());
+  EXPECT_EQ(cached_tensor.Data<float>()[0], 10.f);
+  EXPECT_EQ(cached_tensor.Data<float>()[1], 20.f);
+
+  // fill the cache and touch entry 'a' so 'b' is the least recently used
+  cache.Store(fingerprint_b, outputs);
+  ASSERT_TRUE(cache.Lookup(fingerprint_a).has_value());
+
+  cache.Store(fingerprint_c, outputs);
+  EXPECT_TRUE(cache.Lookup(fingerprint_a).has_value());
+  EXPECT_FALSE(cache.Lookup(fingerprint_b).has_value());
+  EXPECT_TRUE(cache.Lookup(fingerprint_c).has_value());
+}
+
+}  // namespace test
+}  // namespace onnxruntime
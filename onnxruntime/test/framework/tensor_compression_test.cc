@@ -0,0 +1,86 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/tensor_compression.h"
+
+#include <random>
+
+#include "gtest/gtest.h"
+#include "test/util/include/asserts.h"
+
+namespace onnxruntime {
+namespace test {
+
+namespace {
+std::vector<uint8_t> RoundTrip(const std::vector<uint8_t>& input, size_t& compressed_size) {
+  auto allocator = std::make_shared<CPUAllocator>();
+
+  CompressedTensorData compressed;
+  EXPECT_STATUS_OK(CompressedTensorData::Compress(input.data(), input.size(), allocator, compressed));
+  EXPECT_EQ(compressed.UncompressedSizeBytes(), input.size());
+  compressed_size = compressed.CompressedSizeBytes();
+
+  std::vector<uint8_t> output(input.size(), 0xCD);
+  EXPECT_STATUS_OK(compressed.Decompress(output.data(), output.size()));
+  return output;
+}
+}  // namespace
+
+TEST(TensorCompressionTest, AllZeroCompressesToBitmap) {
+  std::vector<uint8_t> input(4096, 0);
+  size_t compressed_size = 0;
+  auto output = RoundTrip(input, compressed_size);
+  EXPECT_EQ(output, input);
+  // 4096 bytes = 128 blocks = a 16 byte bitmap and nothing else
+  EXPECT_EQ(compressed_size, 16u);
+}
+
+TEST(TensorCompressionTest, DenseDataRoundTripsWithBitmapOverhead) {
+  std::vector<uint8_t> input(4096);
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<int> dist(1, 255);  // no zero bytes so no block can be suppressed
+  for (auto& b : input) {
+    b = static_cast<uint8_t>(dist(gen));
+  }
+
+  size_t compressed_size = 0;
+  auto output = RoundTrip(input, compressed_size);
+  EXPECT_EQ(output, input);
+  EXPECT_EQ(compressed_size, input.size() + 16);
+}
+
+TEST(TensorCompressionTest, MixedBlocksAndUnalignedTail) {
+  // 3 full blocks (zero, non-zero, zero) plus a 7 byte tail which is stored verbatim even
+  // though it is zero
+  std::vector<uint8_t> input(3 * 32 + 7, 0);
+  for (size_t i = 32; i < 64; ++i) {
+    input[i] = static_cast<uint8_t>(i);
+  }
+
+  size_t compressed_size = 0;
+  auto output = RoundTrip(input, compressed_size);
+  EXPECT_EQ(output, input);
+  EXPECT_EQ(compressed_size, 1u /*bitmap*/ + 32u /*one stored block*/ + 7u /*tail*/);
+}
+
+TEST(TensorCompressionTest, EmptyInput) {
+  std::vector<uint8_t> input;
+  size_t compressed_size = 0;
+  auto output = RoundTrip(input, compressed_size);
+  EXPECT_TRUE(output.empty());
+  EXPECT_EQ(compressed_size, 0u);
+}
+
+TEST(TensorCompressionTest, DecompressRejectsSizeMismatch) {
+  auto allocator = std::make_shared<CPUAllocator>();
+  std::vector<uint8_t> input(128, 0);
+
+  CompressedTensorData compressed;
+  ASSERT_STATUS_OK(CompressedTensorData::Compress(input.data(), input.size(), allocator, compressed));
+
+  std::vector<uint8_t> output(64);
+  EXPECT_FALSE(compressed.Decompress(output.data(), output.size()).IsOK());
+}
+
+}  // namespace test
+}  // namespace onnxruntime
@@ -0,0 +1,80 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/tensor_pool.h"
+
+#include <atomic>
+
+#include "gtest/gtest.h"
+
+namespace onnxruntime {
+namespace test {
+namespace {
+
+// CPU allocator that counts how often the pool actually reaches it.
+class CountingAllocator : public CPUAllocator {
+ public:
+  void* Alloc(size_t size) override {
+    ++num_allocs;
+    return CPUAllocator::Alloc(size);
+  }
+
+  void Free(void* p) override {
+    if (p != nullptr) {
+      ++num_frees;
+    }
+    CPUAllocator::Free(p);
+  }
+
+  std::atomic<int> num_allocs{0};
+  std::atomic<int> num_frees{0};
+};
+
+}  // namespace
+
+TEST(TensorPoolTest, FreedBuffersAreReusedByByteSizeBucket) {
+  auto upstream = std::make_shared<CountingAllocator>();
+  auto pool = std::make_shared<TensorPoolAllocator>(upstream);
+
+  void* p = pool->Alloc(1000);
+  ASSERT_NE(p, nullptr);
+  EXPECT_EQ(upstream->num_allocs, 1);
+
+  pool->Free(p);
+  EXPECT_EQ(upstream->num_frees, 0) << "Released buffer should go to the pool, not upstream";
+
+  // Any request mapping to the same power-of-two bucket reuses the buffer.
+  void* p2 = pool->Alloc(768);
+  EXPECT_EQ(p2, p);
+  EXPECT_EQ(upstream->num_allocs, 1);
+
+  // A request in a different bucket does not.
+  void* p3 = pool->Alloc(5000);
+  EXPECT_NE(p3, p);
+  EXPECT_EQ(upstream->num_allocs, 2);
+
+  pool->Free(p2);
+  pool->Free(p3);
+}
+
+TEST(TensorPoolTest, ClearReturnsCachedBuffersUpstream) {
+  auto upstream = std::make_shared<CountingAllocator>();
+  auto pool = std::make_shared<TensorPoolAllocator>(upstream);
+
+  void* live = pool->Alloc(512);
+  void* cached = pool->Alloc(512);
+  pool->Free(cached);
+
+  pool->Clear();
+  EXPECT_EQ(upstream->num_frees, 1) << "Only the cached buffer should be freed";
+
+  // The live buffer is unaffected and rejoins the (now empty) pool on release.
+  pool->Free(live);
+  EXPECT_EQ(upstream->num_frees, 1);
+
+  pool.reset();
+  EXPECT_EQ(upstream->num_frees, 2) << "Destruction returns remaining cached buffers upstream";
+}
+
+}  // namespace test
+}  // namespace onnxruntime
@@ -211,6 +211,36 @@ TEST(TensorProtoUtilsTest, UnpackTensorWithExternalData) {
   TestUnpackExternalTensor<bool>(TensorProto_DataType_BOOL, model_path);
 }
 
+TEST(TensorProtoUtilsTest, VerifyExternalDataChecksum) {
+  const char data[] = "123456789";  // CRC32C: 0xE3069283
+  constexpr size_t data_len = 9;
+
+  TensorProto tp;
+  tp.set_name("checksummed");
+  tp.set_data_type(TensorProto_DataType_UINT8);
+  tp.add_dims(data_len);
+  tp.set_data_location(TensorProto_DataLocation_EXTERNAL);
+  auto* location = tp.mutable_external_data()->Add();
+  location->set_key("location");
+  location->set_value("weights.bin");
+
+  // no checksum recorded: nothing to verify
+  ASSERT_STATUS_OK(utils::VerifyExternalDataChecksum(tp, data, data_len));
+
+  auto* checksum = tp.mutable_external_data()->Add();
+  checksum->set_key("checksum");
+  checksum->set_value("e3069283");
+  ASSERT_STATUS_OK(utils::VerifyExternalDataChecksum(tp, data, data_len));
+
+  // corrupted payload must be rejected
+  const char corrupt[] = "123456780";
+  ASSERT_FALSE(utils::VerifyExternalDataChecksum(tp, corrupt, data_len).IsOK());
+
+  // a checksum that is not a CRC32C hex value must be rejected
+  checksum->set_value("not-a-crc");
+  ASSERT_FALSE(utils::VerifyExternalDataChecksum(tp, data, data_len).IsOK());
+}
+
 template <typename T>
 static NodeProto CreateConstantNode(const std::string& attrib_name, AttributeProto_AttributeType type,
                                     std::function<void(AttributeProto&)> add_data) {
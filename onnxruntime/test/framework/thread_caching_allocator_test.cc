@@ -0,0 +1,128 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/thread_caching_allocator.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace onnxruntime {
+namespace test {
+namespace {
+
+// CPU allocator that counts how often the wrapper actually reaches it.
+class CountingAllocator : public CPUAllocator {
+ public:
+  void* Alloc(size_t size) override {
+    ++num_allocs;
+    return CPUAllocator::Alloc(size);
+  }
+
+  void Free(void* p) override {
+    if (p != nullptr) {
+      ++num_frees;
+    }
+    CPUAllocator::Free(p);
+  }
+
+  std::atomic<int> num_allocs{0};
+  std::atomic<int> num_frees{0};
+};
+
+}  // namespace
+
+TEST(ThreadCachingAllocatorTest, SmallAllocationsAreReusedWithoutUpstreamCalls) {
+  auto upstream = std::make_shared<CountingAllocator>();
+  ThreadCachingAllocator cache{upstream};
+
+  void* p = cache.Alloc(64);
+  ASSERT_NE(p, nullptr);
+  EXPECT_EQ(upstream->num_allocs, 1);
+
+  cache.Free(p);
+  EXPECT_EQ(upstream->num_frees, 0) << "Small block should be cached, not returned upstream";
+
+  // A request in the same size class is served from the cache.
+  void* p2 = cache.Alloc(100);
+  EXPECT_EQ(p2, p);
+  EXPECT_EQ(upstream->num_allocs, 1);
+  cache.Free(p2);
+}
+
+TEST(ThreadCachingAllocatorTest, LargeAllocationsPassThrough) {
+  auto upstream = std::make_shared<CountingAllocator>();
+  ThreadCachingAllocator cache{upstream};
+
+  void* p = cache.Alloc(ThreadCachingAllocator::kMaxCachedSize + 1);
+  ASSERT_NE(p, nullptr);
+  EXPECT_EQ(upstream->num_allocs, 1);
+
+  cache.Free(p);
+  EXPECT_EQ(upstream->num_frees, 1) << "Large block should bypass the cache entirely";
+}
+
+TEST(ThreadCachingAllocatorTest, PerClassCacheIsBounded) {
+  auto upstream = std::make_shared<CountingAllocator>();
+  ThreadCachingAllocator cache{upstream};
+
+  constexpr size_t kCount = ThreadCachingAllocator::kMaxBlocksPerClass + 4;
+  std::vector<void*> ptrs;
+  for (size_t i = 0; i < kCount; ++i) {
+    ptrs.push_back(cache.Alloc(64));
+  }
+
+  for (void* p : ptrs) {
+    cache.Free(p);
+  }
+
+  // Only the overflow beyond the per-class cap goes back upstream.
+  EXPECT_EQ(upstream->num_frees, 4);
+
+  // The capped cache serves subsequent requests without new upstream allocations.
+  for (size_t i = 0; i < ThreadCachingAllocator::kMaxBlocksPerClass; ++i) {
+    ptrs[i] = cache.Alloc(64);
+  }
+  EXPECT_EQ(upstream->num_allocs, static_cast<int>(kCount));
+
+  for (size_t i = 0; i < ThreadCachingAllocator::kMaxBlocksPerClass; ++i) {
+    cache.Free(ptrs[i]);
+  }
+}
+
+TEST(ThreadCachingAllocatorTest, BlocksFreedOnAnotherThreadLandInItsCache) {
+  auto upstream = std::make_shared<CountingAllocator>();
+  ThreadCachingAllocator cache{upstream};
+
+  void* p = nullptr;
+  std::thread worker{[&]() { p = cache.Alloc(128); }};
+  worker.join();
+  ASSERT_NE(p, nullptr);
+
+  // Freeing on this thread populates this thread's cache, so this thread's next request in the
+  // same class reuses the block.
+  cache.Free(p);
+  void* p2 = cache.Alloc(128);
+  EXPECT_EQ(p2, p);
+  EXPECT_EQ(upstream->num_allocs, 1);
+  cache.Free(p2);
+}
+
+TEST(ThreadCachingAllocatorTest, ThreadExitReturnsCachedBlocksUpstream) {
+  auto upstream = std::make_shared<CountingAllocator>();
+  ThreadCachingAllocator cache{upstream};
+
+  std::thread worker{[&]() {
+    void* p = cache.Alloc(64);
+    cache.Free(p);
+  }};
+  worker.join();
+
+  EXPECT_EQ(upstream->num_allocs, 1);
+  EXPECT_EQ(upstream->num_frees, 1) << "Cached blocks should be flushed when the thread exits";
+}
+
+}  // namespace test
+}  // namespace onnxruntime
@@ -7,9 +7,8 @@
 
 #include "core/common/common.h"
 #include "core/framework/tunable.h"
-#define TUNING_CONTEXT_IMPL
-#include "core/framework/tuning_context_impl.h"
-#undef TUNING_CONTEXT_IMPL
+// The tuning context implementation is provided by the CPU execution provider
+// (see core/providers/cpu/tunable/cpu_tuning_context.cc), which is linked into the test binary.
 
 using namespace std::chrono_literals;
 
@@ -0,0 +1,79 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/weight_residency_manager.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace onnxruntime {
+namespace test {
+
+namespace {
+
+constexpr size_t kWeightBytes = 8192;
+
+// three schedule positions driven by node indices 10/11/12:
+//   weight 0: used at position 0 only
+//   weight 1: used at positions 0 through 2
+//   weight 2: first used at position 2
+std::unique_ptr<WeightResidencyManager> MakeManager(const std::vector<std::vector<char>>& buffers,
+                                                    size_t budget_bytes) {
+  std::vector<WeightResidencyManager::Weight> weights{
+      {buffers[0].data(), kWeightBytes, 0, 0},
+      {buffers[1].data(), kWeightBytes, 0, 2},
+      {buffers[2].data(), kWeightBytes, 2, 2},
+  };
+  InlinedHashMap<NodeIndex, size_t> node_to_position{{10, 0}, {11, 1}, {12, 2}};
+  return std::make_unique<WeightResidencyManager>(std::move(weights), std::move(node_to_position),
+                                                  3, budget_bytes);
+}
+
+}  // namespace
+
+TEST(WeightResidencyManagerTest, PrefetchesAheadAndEvictsBehind) {
+  std::vector<std::vector<char>> buffers(3, std::vector<char>(kWeightBytes, 1));
+  auto manager = MakeManager(buffers, /*budget_bytes*/ 1 << 20);
+
+  // position 0: weight 2 (first used at position 2) is read ahead
+  manager->OnNodeExecute(10);
+  auto stats = manager->GetStats();
+  EXPECT_EQ(stats.num_prefetches, static_cast<size_t>(1));
+  EXPECT_EQ(stats.num_evictions, static_cast<size_t>(0));
+  EXPECT_EQ(stats.prefetched_bytes_in_window, kWeightBytes);
+
+  // position 1: weight 0 was fully consumed at position 0 and is evicted
+  manager->OnNodeExecute(11);
+  stats = manager->GetStats();
+  EXPECT_EQ(stats.num_evictions, static_cast<size_t>(1));
+
+  // position 2: weight 1 is still live (last use is this position), nothing to evict
+  manager->OnNodeExecute(12);
+  stats = manager->GetStats();
+  EXPECT_EQ(stats.num_evictions, static_cast<size_t>(1));
+
+  // a position behind the cursor restarts the window for the next Run
+  manager->OnNodeExecute(10);
+  stats = manager->GetStats();
+  EXPECT_EQ(stats.num_prefetches, static_cast<size_t>(2));
+  EXPECT_EQ(stats.prefetched_bytes_in_window, kWeightBytes);
+
+  // unknown node indices are ignored
+  manager->OnNodeExecute(99);
+  EXPECT_EQ(manager->GetStats().num_prefetches, static_cast<size_t>(2));
+}
+
+TEST(WeightResidencyManagerTest, BudgetBoundsReadAhead) {
+  std::vector<std::vector<char>> buffers(3, std::vector<char>(kWeightBytes, 1));
+  auto manager = MakeManager(buffers, /*budget_bytes*/ kWeightBytes / 2);
+
+  // the budget is exhausted before weight 2 fits, so nothing is read ahead
+  manager->OnNodeExecute(10);
+  auto stats = manager->GetStats();
+  EXPECT_EQ(stats.num_prefetches, static_cast<size_t>(0));
+  EXPECT_EQ(stats.prefetched_bytes_in_window, static_cast<size_t>(0));
+}
+
+}  // namespace test
+}  // namespace onnxruntime
@@ -199,6 +199,39 @@ TEST(LoraAdapterTest, Load) {
   }
 }
 
+TEST(LoraAdapterTest, CacheEvictsLeastRecentlyUsed) {
+  size_t loads = 0;
+  auto loader = [&loads]() {
+    auto adapter = std::make_unique<lora::LoraAdapter>();
+    adapter->Load(GenerateTestParameters<float>()());
+    ++loads;
+    return adapter;
+  };
+
+  lora::LoraAdapterCache cache(2);
+
+  auto adapter_a = cache.Acquire("a", loader);
+  auto adapter_b = cache.Acquire("b", loader);
+  ASSERT_EQ(2U, loads);
+
+  // a hit does not reload and refreshes recency
+  ASSERT_EQ(adapter_a.get(), cache.Acquire("a", loader).get());
+  ASSERT_EQ(2U, loads);
+
+  // "b" is now least recently used and is evicted to make room for "c"
+  auto adapter_c = cache.Acquire("c", loader);
+  ASSERT_EQ(3U, loads);
+  ASSERT_EQ(2U, cache.GetEntryNum());
+
+  // the evicted adapter stays usable while the caller holds it
+  verify_load(*adapter_b);
+
+  // re-acquiring "b" loads it again
+  auto adapter_b_reloaded = cache.Acquire("b", loader);
+  ASSERT_EQ(4U, loads);
+  ASSERT_NE(adapter_b.get(), adapter_b_reloaded.get());
+}
+
 #ifdef USE_CUDA
 TEST(LoraAdapterTest, VerifyDeviceCopy) {
   auto cpu_ep = DefaultCpuExecutionProvider();
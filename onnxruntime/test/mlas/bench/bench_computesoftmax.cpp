@@ -64,6 +64,9 @@ void COMPUTESOFTMAXINPLACE(benchmark::State& state) {
     MlasComputeSoftmax(input, output, N, D, false, false, tp.get());
   }
 
+  // memory bound: in-place read + write of the N x D buffer (max/sum reduction passes hit cache)
+  SetRooflineCounters(state, 0.0, 2.0 * N * D * sizeof(float));
+
   free(ptr.underlying_buffer);
 }
 
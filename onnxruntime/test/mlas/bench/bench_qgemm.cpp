@@ -76,6 +76,10 @@ void QGEMM(benchmark::State& state, bool pack_b, bool a_is_signed) {
   for (auto _ : state) {
     MlasGemmBatch(gemm_shape, gemm_data_vec.data(), batch, tp.get());
   }
+
+  // int8 inputs, int32 accumulator output
+  SetRooflineCounters(state, 2.0 * M * N * K * batch,
+                      static_cast<double>(batch) * (M * K + K * N + M * N * sizeof(int32_t)));
 }
 
 static void QGemmSize(benchmark::internal::Benchmark* b) {
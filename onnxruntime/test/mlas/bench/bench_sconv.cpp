@@ -136,6 +136,16 @@ void SCONV_NCHW(benchmark::State& state, const char* /*dummy*/) {
              Y.data(),
              nullptr);
   }
+
+  const int64_t kernel_size = std::accumulate(kernel_shape.begin(), kernel_shape.end(), 1LL,
+                                              std::multiplies<int64_t>());
+  const int64_t output_size = std::accumulate(output_shape.begin(), output_shape.end(), 1LL,
+                                              std::multiplies<int64_t>());
+  const int64_t x_size = std::accumulate(x_shape.begin(), x_shape.end(), 1LL, std::multiplies<int64_t>());
+  const int64_t f_size = std::accumulate(f_shape.begin(), f_shape.end(), 1LL, std::multiplies<int64_t>());
+  SetRooflineCounters(state,
+                      2.0 * batch_size * GF * output_size * input_channels_per_group * kernel_size,
+                      static_cast<double>(x_size + f_size + y_size) * sizeof(float));
 }
 
 static void ResNet50(benchmark::internal::Benchmark* b) {
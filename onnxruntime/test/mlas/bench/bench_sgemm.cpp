@@ -99,6 +99,10 @@ void SGEMM(benchmark::State& state, bool pack_b, bool trans_a, bool trans_b, flo
           tp.get());
     }
   }
+
+  // minimal data movement: read A and B, read-modify-write C
+  SetRooflineCounters(state, 2.0 * M * N * K,
+                      static_cast<double>(M * K + K * N + 2 * M * N) * sizeof(float));
 }
 
 static void GemmSizeWithOne(benchmark::internal::Benchmark* b) {
@@ -113,10 +117,22 @@ static void GemmSizeProducts(benchmark::internal::Benchmark* b) {
   b->ArgsProduct({{63, 255, 1023}, {63, 255, 1023}, {63, 255, 1023}});
 }
 
+static void GemmSizeTransformer(benchmark::internal::Benchmark* b) {
+  b->ArgNames(sgemm_bench_arg_names);
+  // QKV/output projections and FFN layers of BERT-base (768/3072) and BERT-large (1024/4096)
+  // at common sequence lengths, the shapes that dominate encoder inference.
+  b->ArgsProduct({{128, 384, 512}, {768}, {768, 3072}});
+  b->ArgsProduct({{128, 384, 512}, {3072}, {768}});
+  b->ArgsProduct({{128, 384, 512}, {1024}, {1024, 4096}});
+  b->ArgsProduct({{128, 384, 512}, {4096}, {1024}});
+}
+
 BENCHMARK_CAPTURE(SGEMM, NORMAL_NoTrans, false, false, false)->Apply(GemmSizeProducts)->UseRealTime();
 BENCHMARK_CAPTURE(SGEMM, NORMAL_TransA, false, true, false)->Apply(GemmSizeProducts)->UseRealTime();
 BENCHMARK_CAPTURE(SGEMM, NORMAL_TransB, false, false, true)->Apply(GemmSizeProducts)->UseRealTime();
 BENCHMARK_CAPTURE(SGEMM, NORMAL_ABTrans, false, true, true)->Apply(GemmSizeProducts)->UseRealTime();
+BENCHMARK_CAPTURE(SGEMM, TRANSFORMER_NoTrans, false, false, false)->Apply(GemmSizeTransformer)->UseRealTime();
+BENCHMARK_CAPTURE(SGEMM, TRANSFORMER_PackB, true, false, false)->Apply(GemmSizeTransformer)->UseRealTime();
 
 BENCHMARK_CAPTURE(SGEMM, GEMV_NoTrans, false, false, false)->Apply(GemmSizeWithOne)->UseRealTime();
 BENCHMARK_CAPTURE(SGEMM, GEMV_TransA, false, true, false)->Apply(GemmSizeWithOne)->UseRealTime();
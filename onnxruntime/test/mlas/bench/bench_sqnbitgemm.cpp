@@ -97,6 +97,12 @@ void RunSQNBitGemmBenchmark(size_t BlkLen,
   for (auto _ : state) {
     MlasSQNBitGemmBatch(M, N, K, 1, BlkBitWidth, BlkLen, ComputeType, &params, Workspace.get(), tp.get());
   }
+
+  // fp32 A and C; B is BlkBitWidth bits per element plus one fp32 scale per block
+  const double b_bytes = static_cast<double>(N) * K * BlkBitWidth / 8.0 +
+                         static_cast<double>(N) * (K / BlkLen) * sizeof(float);
+  SetRooflineCounters(state, 2.0 * M * N * K,
+                      static_cast<double>(M * K + M * N) * sizeof(float) + b_bytes);
 }
 
 template <size_t BlkBitWidth>
@@ -22,3 +22,17 @@ std::vector<float> RandomVectorUniform(std::vector<int64_t> shape, float min_val
   }
   return RandomVectorUniform(static_cast<size_t>(sz), min_value, max_value);
 }
+
+void SetRooflineCounters(benchmark::State& state, double flops_per_iteration, double bytes_per_iteration) {
+  const double iterations = static_cast<double>(state.iterations());
+  if (flops_per_iteration > 0) {
+    state.counters["FLOPS"] = benchmark::Counter(flops_per_iteration * iterations, benchmark::Counter::kIsRate);
+  }
+  if (bytes_per_iteration > 0) {
+    state.counters["Bytes/s"] = benchmark::Counter(bytes_per_iteration * iterations,
+                                                   benchmark::Counter::kIsRate, benchmark::Counter::kIs1024);
+  }
+  if (flops_per_iteration > 0 && bytes_per_iteration > 0) {
+    state.counters["FLOP/Byte"] = benchmark::Counter(flops_per_iteration / bytes_per_iteration);
+  }
+}
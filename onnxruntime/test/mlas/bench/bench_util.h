@@ -29,3 +29,9 @@ std::vector<ElementType> RandomVectorUniform(
 std::vector<float> RandomVectorUniform(std::vector<int64_t> shape, float min_value, float max_value);
 
 std::vector<int64_t> BenchArgsVector(benchmark::State& state, size_t& start, size_t count);
+
+// Attach roofline-style throughput counters to a benchmark: "FLOPS" and "Bytes/s" are the achieved
+// rates for the given per-iteration work, to be compared against the machine's peak compute and
+// memory bandwidth, and "FLOP/Byte" is the arithmetic intensity that says which of the two limits
+// applies. Call after the measurement loop; pass 0 for ops/bytes that do not apply.
+void SetRooflineCounters(benchmark::State& state, double flops_per_iteration, double bytes_per_iteration);
@@ -215,6 +215,9 @@ class MlasActivationTest : public MlasTestBase {
       } else if (Activation.ActivationKind == MlasHardSigmoidActivation) {
         Activation.Parameters.HardSigmoid.alpha = 0.2f;
         Activation.Parameters.HardSigmoid.beta = 0.12f;
+      } else if (Activation.ActivationKind == MlasAffineActivation) {
+        Activation.Parameters.Affine.alpha = 0.5f;
+        Activation.Parameters.Affine.beta = 1.0f;
       }
 
       //
@@ -245,12 +248,64 @@ class MlasActivationTest : public MlasTestBase {
       }
 
       for (unsigned i = 0; i < _countof(TestData); i++) {
+        // MlasAffineActivation is not part of the precomputed table; derive its
+        // expected value from the identity column.
+        AliasedValue Expected;
+        if (Activation.ActivationKind == MlasAffineActivation) {
+          Expected.f = 0.5f * TestData[i][0].f + 1.0f;
+        } else {
+          Expected = TestData[i][kind];
+        }
+
         // Sensitive to comparing positive/negative zero and NaNs.
-        float error = std::min(std::fabs((Buffer[i].f - TestData[i][kind].f) / TestData[i][kind].f), std::fabs(Buffer[i].f - TestData[i][kind].f));
-        EXPECT_TRUE(Buffer[i].u == TestData[i][kind].u || Buffer[i].f == TestData[i][kind].f || error < 0.000001f)
+        float error = std::min(std::fabs((Buffer[i].f - Expected.f) / Expected.f), std::fabs(Buffer[i].f - Expected.f));
+        EXPECT_TRUE(Buffer[i].u == Expected.u || Buffer[i].f == Expected.f || error < 0.000001f)
             << ", Scalar Activation Kind:" << (int)kind << ", i=" << i << ", value:"
             << std::setw(8) << std::setfill('0') << std::hex << Buffer[i].u << ", expecting:"
-            << std::setw(8) << std::setfill('0') << std::hex << TestData[i][kind].u;
+            << std::setw(8) << std::setfill('0') << std::hex << Expected.u;
+      }
+    }
+
+    TestActivationChain();
+  }
+
+  void TestActivationChain(void) {
+    //
+    // Test a post operation chain applied on top of a bias addition: the output
+    // of each stage feeds the next one.
+    //
+
+    constexpr size_t M = 3;
+    constexpr size_t N = 17;
+
+    float Buffer[M * N];
+    float Reference[M * N];
+    float Bias[M];
+
+    for (size_t i = 0; i < M * N; i++) {
+      Buffer[i] = -8.0f + 0.25f * float(i);
+      Reference[i] = Buffer[i];
+    }
+    for (size_t m = 0; m < M; m++) {
+      Bias[m] = 0.5f * float(m);
+    }
+
+    MLAS_ACTIVATION Chain[2];
+    Chain[0].ActivationKind = MlasAffineActivation;
+    Chain[0].Parameters.Affine.alpha = 0.25f;
+    Chain[0].Parameters.Affine.beta = 3.0f;
+    Chain[1].ActivationKind = MlasClipActivation;
+    Chain[1].Parameters.Clip.minimum = 0.0f;
+    Chain[1].Parameters.Clip.maximum = 6.0f;
+
+    MlasActivationChain(Chain, _countof(Chain), Buffer, Bias, M, N, N);
+
+    for (size_t m = 0; m < M; m++) {
+      for (size_t n = 0; n < N; n++) {
+        float expected = Reference[m * N + n] + Bias[m];
+        expected = expected * 0.25f + 3.0f;
+        expected = std::min(std::max(expected, 0.0f), 6.0f);
+        EXPECT_NEAR(Buffer[m * N + n], expected, 1e-6f) << " chain output at m=" << m << ", n=" << n;
       }
     }
   }
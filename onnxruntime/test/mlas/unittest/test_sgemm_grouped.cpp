@@ -0,0 +1,126 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "test_util.h"
+
+//
+// Tests MlasGemmGrouped against per-group reference GEMMs, with ragged
+// M/N/K across the groups, both single threaded and on the thread pool.
+//
+
+template <bool Threaded>
+class MlasGemmGroupedTest : public MlasTestBase {
+ private:
+  MLAS_THREADPOOL* threadpool_;
+
+  MatrixGuardBuffer<float> BufferA;
+  MatrixGuardBuffer<float> BufferB;
+  MatrixGuardBuffer<float> BufferC;
+  MatrixGuardBuffer<float> BufferCReference;
+
+  void ReferenceGemm(size_t M, size_t N, size_t K, float alpha, const float* A, const float* B,
+                     float beta, float* C) {
+    for (size_t m = 0; m < M; m++) {
+      for (size_t n = 0; n < N; n++) {
+        float sum = 0.0f;
+        for (size_t k = 0; k < K; k++) {
+          sum += A[m * K + k] * B[k * N + n];
+        }
+        C[m * N + n] = (C[m * N + n] * beta) + (sum * alpha);
+      }
+    }
+  }
+
+  void Test(const std::vector<size_t>& Ms, const std::vector<size_t>& Ns, const std::vector<size_t>& Ks,
+            float alpha, float beta) {
+    const size_t GroupCount = Ms.size();
+
+    size_t ASize = 0;
+    size_t BSize = 0;
+    size_t CSize = 0;
+    for (size_t g = 0; g < GroupCount; g++) {
+      ASize += Ms[g] * Ks[g];
+      BSize += Ks[g] * Ns[g];
+      CSize += Ms[g] * Ns[g];
+    }
+
+    const float* A = BufferA.GetBuffer(ASize);
+    const float* B = BufferB.GetBuffer(BSize);
+    float* C = BufferC.GetBuffer(CSize);
+    float* CReference = BufferCReference.GetBuffer(CSize);
+
+    std::fill_n(C, CSize, -0.5f);
+    std::fill_n(CReference, CSize, -0.5f);
+
+    std::vector<MLAS_SGEMM_GROUP_PARAMS> groups(GroupCount);
+    size_t AOffset = 0;
+    size_t BOffset = 0;
+    size_t COffset = 0;
+    for (size_t g = 0; g < GroupCount; g++) {
+      groups[g].M = Ms[g];
+      groups[g].N = Ns[g];
+      groups[g].K = Ks[g];
+      groups[g].Data.A = A + AOffset;
+      groups[g].Data.lda = Ks[g];
+      groups[g].Data.B = B + BOffset;
+      groups[g].Data.ldb = Ns[g];
+      groups[g].Data.C = C + COffset;
+      groups[g].Data.ldc = Ns[g];
+      groups[g].Data.alpha = alpha;
+      groups[g].Data.beta = beta;
+      AOffset += Ms[g] * Ks[g];
+      BOffset += Ks[g] * Ns[g];
+      COffset += Ms[g] * Ns[g];
+    }
+
+    MlasGemmGrouped(CblasNoTrans, CblasNoTrans, groups.data(), GroupCount, threadpool_);
+
+    AOffset = BOffset = COffset = 0;
+    for (size_t g = 0; g < GroupCount; g++) {
+      ReferenceGemm(Ms[g], Ns[g], Ks[g], alpha, A + AOffset, B + BOffset, beta, CReference + COffset);
+      AOffset += Ms[g] * Ks[g];
+      BOffset += Ks[g] * Ns[g];
+      COffset += Ms[g] * Ns[g];
+    }
+
+    for (size_t f = 0; f < CSize; f++) {
+      ASSERT_EQ(C[f], CReference[f]) << " Diff @" << f << " GroupCount=" << GroupCount
+                                     << " Alpha=" << alpha << " Beta=" << beta;
+    }
+  }
+
+ public:
+  MlasGemmGroupedTest() : threadpool_(Threaded ? GetMlasThreadPool() : nullptr) {}
+
+  static const char* GetTestSuiteName() {
+    static const std::string suite_name = Threaded ? std::string("SGemmGrouped_Threaded")
+                                                   : std::string("SGemmGrouped_SingleThread");
+    return suite_name.c_str();
+  }
+
+  void ExecuteShort(void) override {
+    // single group degenerates to a plain gemm
+    Test({5}, {7}, {9}, 1.0f, 0.0f);
+
+    // ragged shapes, including empty groups mixed in
+    Test({1, 17, 0, 64, 3}, {32, 5, 16, 64, 1}, {8, 21, 4, 64, 13}, 1.0f, 0.0f);
+    Test({4, 100, 1}, {60, 40, 128}, {25, 96, 2}, 0.5f, 0.5f);
+
+    // large skinny groups exercise the per-group M/N thread partitioning
+    Test({256, 1, 384}, {16, 512, 48}, {64, 96, 160}, 1.0f, 0.0f);
+  }
+};
+
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#endif
+
+static UNUSED_VARIABLE bool added_to_main = AddTestRegister([](bool is_short_execute) {
+  size_t count = 0;
+  if (is_short_execute) {
+    count += MlasDirectShortExecuteTests<MlasGemmGroupedTest<false>>::RegisterShortExecute();
+    count += MlasDirectShortExecuteTests<MlasGemmGroupedTest<true>>::RegisterShortExecute();
+  }
+  return count;
+});
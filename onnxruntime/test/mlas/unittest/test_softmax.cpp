@@ -104,6 +104,11 @@ class MlasSoftmaxTest : public MlasTestBase {
     Test(3, 128, 20.f, 30.f);
     Test(63, 95, -150.f, 190.f);
     Test(16, 211, 20.f, 30.f);
+
+    // Large rows take the fused single-pass (online softmax) path.
+    Test(1, 4096, -10.f, 10.f);
+    Test(2, 4099, -150.f, 190.f);
+    Test(3, 8192, 20.f, 30.f);
   }
 };
 
@@ -0,0 +1,220 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/optimizer/copy_coalescing.h"
+
+#include "core/graph/model.h"
+#include "core/optimizer/initializer.h"
+#include "core/optimizer/rule_based_graph_transformer.h"
+#include "gtest/gtest.h"
+#include "test/framework/test_utils.h"
+#include "test/optimizer/graph_transform_test_builder.h"
+#include "test/test_environment.h"
+#include "test/util/include/asserts.h"
+
+namespace onnxruntime {
+namespace test {
+
+namespace {
+
+std::unique_ptr<Model> MakeModel() {
+  return std::make_unique<Model>("CopyCoalescingTest", false, ModelMetaData(), PathString(),
+                                 IOnnxRuntimeOpSchemaRegistryList(), {{kOnnxDomain, 13}}, std::vector<ONNX_NAMESPACE::FunctionProto>{},
+                                 DefaultLoggingManager().DefaultLogger());
+}
+
+Status ApplyRule(Graph& graph, std::unique_ptr<RewriteRule> rule, bool& modified) {
+  RuleBasedGraphTransformer transformer("CopyCoalescingTestTransformer");
+  ORT_RETURN_IF_ERROR(transformer.Register(std::move(rule)));
+  return transformer.Apply(graph, modified, DefaultLoggingManager().DefaultLogger());
+}
+
+const Node* FindSingleNode(const Graph& graph, const std::string& op_type) {
+  const Node* found = nullptr;
+  for (const auto& node : graph.Nodes()) {
+    if (node.OpType() == op_type) {
+      EXPECT_EQ(found, nullptr) << "more than one " << op_type << " node";
+      found = &node;
+    }
+  }
+  return found;
+}
+
+InlinedVector<int64_t> GetInt64Initializer(const Graph& graph, const NodeArg& arg) {
+  const auto* proto = graph_utils::GetConstantInitializer(graph, arg.Name());
+  EXPECT_NE(proto, nullptr);
+  Initializer init(*proto, graph.ModelPath());
+  return InlinedVector<int64_t>(init.data<int64_t>(), init.data<int64_t>() + init.size());
+}
+
+}  // namespace
+
+TEST(CopyCoalescingTest, SliceOfSliceBecomesOneSlice) {
+  auto model = MakeModel();
+  Graph& graph = model->MainGraph();
+  ModelTestBuilder builder(graph);
+
+  auto* x = builder.MakeInput<float>({10}, -1.0f, 1.0f);
+  auto* inner = builder.MakeIntermediate();
+  builder.AddNode("Slice", {x,
+                            builder.MakeInitializer<int64_t>({1}, {1}),
+                            builder.MakeInitializer<int64_t>({1}, {9}),
+                            builder.MakeInitializer<int64_t>({1}, {0})},
+                  {inner});
+  builder.AddNode("Slice", {inner,
+                            builder.MakeInitializer<int64_t>({1}, {2}),
+                            builder.MakeInitializer<int64_t>({1}, {6}),
+                            builder.MakeInitializer<int64_t>({1}, {0})},
+                  {builder.MakeOutput()});
+  builder.SetGraphOutputs();
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  bool modified = false;
+  ASSERT_STATUS_OK(ApplyRule(graph, std::make_unique<SliceSliceCoalescing>(), modified));
+  EXPECT_TRUE(modified);
+  EXPECT_EQ(CountOpsInGraph(graph)["Slice"], 1);
+
+  // [1, 9) then [2, 6) relative to it composes to [3, 7)
+  const Node* slice = FindSingleNode(graph, "Slice");
+  ASSERT_NE(slice, nullptr);
+  EXPECT_EQ(GetInt64Initializer(graph, *slice->InputDefs()[1]), InlinedVector<int64_t>{3});
+  EXPECT_EQ(GetInt64Initializer(graph, *slice->InputDefs()[2]), InlinedVector<int64_t>{7});
+}
+
+TEST(CopyCoalescingTest, PadOfPadSumsPads) {
+  auto model = MakeModel();
+  Graph& graph = model->MainGraph();
+  ModelTestBuilder builder(graph);
+
+  auto* x = builder.MakeInput<float>({2, 3}, -1.0f, 1.0f);
+  auto* inner = builder.MakeIntermediate();
+  builder.AddNode("Pad", {x, builder.MakeInitializer<int64_t>({4}, {1, 0, 0, 2})}, {inner});
+  builder.AddNode("Pad", {inner, builder.MakeInitializer<int64_t>({4}, {0, 1, 1, 0})},
+                  {builder.MakeOutput()});
+  builder.SetGraphOutputs();
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  bool modified = false;
+  ASSERT_STATUS_OK(ApplyRule(graph, std::make_unique<PadPadCoalescing>(), modified));
+  EXPECT_TRUE(modified);
+  EXPECT_EQ(CountOpsInGraph(graph)["Pad"], 1);
+
+  const Node* pad = FindSingleNode(graph, "Pad");
+  ASSERT_NE(pad, nullptr);
+  EXPECT_EQ(GetInt64Initializer(graph, *pad->InputDefs()[1]), (InlinedVector<int64_t>{1, 1, 1, 2}));
+}
+
+TEST(CopyCoalescingTest, ReflectPadsAreNotCoalesced) {
+  auto model = MakeModel();
+  Graph& graph = model->MainGraph();
+  ModelTestBuilder builder(graph);
+
+  auto* x = builder.MakeInput<float>({2, 3}, -1.0f, 1.0f);
+  auto* inner = builder.MakeIntermediate();
+  auto& pad1 = builder.AddNode("Pad", {x, builder.MakeInitializer<int64_t>({4}, {1, 0, 0, 2})}, {inner});
+  pad1.AddAttribute("mode", "reflect");
+  auto& pad2 = builder.AddNode("Pad", {inner, builder.MakeInitializer<int64_t>({4}, {0, 1, 1, 0})},
+                               {builder.MakeOutput()});
+  pad2.AddAttribute("mode", "reflect");
+  builder.SetGraphOutputs();
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  bool modified = false;
+  ASSERT_STATUS_OK(ApplyRule(graph, std::make_unique<PadPadCoalescing>(), modified));
+  EXPECT_FALSE(modified);
+  EXPECT_EQ(CountOpsInGraph(graph)["Pad"], 2);
+}
+
+TEST(CopyCoalescingTest, SliceInsideUnpaddedRegionDropsPad) {
+  auto model = MakeModel();
+  Graph& graph = model->MainGraph();
+  ModelTestBuilder builder(graph);
+
+  auto* x = builder.MakeInput<float>({4}, -1.0f, 1.0f);
+  auto* padded = builder.MakeIntermediate();
+  builder.AddNode("Pad", {x, builder.MakeInitializer<int64_t>({2}, {2, 0})}, {padded});
+  builder.AddNode("Slice", {padded,
+                            builder.MakeInitializer<int64_t>({1}, {2}),
+                            builder.MakeInitializer<int64_t>({1}, {5}),
+                            builder.MakeInitializer<int64_t>({1}, {0})},
+                  {builder.MakeOutput()});
+  builder.SetGraphOutputs();
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  bool modified = false;
+  ASSERT_STATUS_OK(ApplyRule(graph, std::make_unique<PadSliceCoalescing>(), modified));
+  EXPECT_TRUE(modified);
+
+  auto op_counts = CountOpsInGraph(graph);
+  EXPECT_EQ(op_counts["Pad"], 0);
+  EXPECT_EQ(op_counts["Slice"], 1);
+
+  // [2, 5) of the padded tensor is [0, 3) of the original data
+  const Node* slice = FindSingleNode(graph, "Slice");
+  ASSERT_NE(slice, nullptr);
+  EXPECT_EQ(GetInt64Initializer(graph, *slice->InputDefs()[1]), InlinedVector<int64_t>{0});
+  EXPECT_EQ(GetInt64Initializer(graph, *slice->InputDefs()[2]), InlinedVector<int64_t>{3});
+}
+
+TEST(CopyCoalescingTest, SliceTouchingPaddingIsNotCoalesced) {
+  auto model = MakeModel();
+  Graph& graph = model->MainGraph();
+  ModelTestBuilder builder(graph);
+
+  auto* x = builder.MakeInput<float>({4}, -1.0f, 1.0f);
+  auto* padded = builder.MakeIntermediate();
+  builder.AddNode("Pad", {x, builder.MakeInitializer<int64_t>({2}, {2, 0})}, {padded});
+  // starts at 1, i.e. inside the leading padding
+  builder.AddNode("Slice", {padded,
+                            builder.MakeInitializer<int64_t>({1}, {1}),
+                            builder.MakeInitializer<int64_t>({1}, {5}),
+                            builder.MakeInitializer<int64_t>({1}, {0})},
+                  {builder.MakeOutput()});
+  builder.SetGraphOutputs();
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  bool modified = false;
+  ASSERT_STATUS_OK(ApplyRule(graph, std::make_unique<PadSliceCoalescing>(), modified));
+  EXPECT_FALSE(modified);
+  EXPECT_EQ(CountOpsInGraph(graph)["Pad"], 1);
+}
+
+TEST(CopyCoalescingTest, ConcatOfAdjacentSlicesBecomesOneSlice) {
+  auto model = MakeModel();
+  Graph& graph = model->MainGraph();
+  ModelTestBuilder builder(graph);
+
+  auto* x = builder.MakeInput<float>({10}, -1.0f, 1.0f);
+  auto* left = builder.MakeIntermediate();
+  auto* right = builder.MakeIntermediate();
+  builder.AddNode("Slice", {x,
+                            builder.MakeInitializer<int64_t>({1}, {1}),
+                            builder.MakeInitializer<int64_t>({1}, {4}),
+                            builder.MakeInitializer<int64_t>({1}, {0})},
+                  {left});
+  builder.AddNode("Slice", {x,
+                            builder.MakeInitializer<int64_t>({1}, {4}),
+                            builder.MakeInitializer<int64_t>({1}, {8}),
+                            builder.MakeInitializer<int64_t>({1}, {0})},
+                  {right});
+  auto& concat = builder.AddNode("Concat", {left, right}, {builder.MakeOutput()});
+  concat.AddAttribute("axis", static_cast<int64_t>(0));
+  builder.SetGraphOutputs();
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  bool modified = false;
+  ASSERT_STATUS_OK(ApplyRule(graph, std::make_unique<ConcatSliceCoalescing>(), modified));
+  EXPECT_TRUE(modified);
+
+  auto op_counts = CountOpsInGraph(graph);
+  EXPECT_EQ(op_counts["Concat"], 0);
+  EXPECT_EQ(op_counts["Slice"], 1);
+
+  const Node* slice = FindSingleNode(graph, "Slice");
+  ASSERT_NE(slice, nullptr);
+  EXPECT_EQ(GetInt64Initializer(graph, *slice->InputDefs()[1]), InlinedVector<int64_t>{1});
+  EXPECT_EQ(GetInt64Initializer(graph, *slice->InputDefs()[2]), InlinedVector<int64_t>{8});
+}
+
+}  // namespace test
+}  // namespace onnxruntime
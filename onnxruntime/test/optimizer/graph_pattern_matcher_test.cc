@@ -0,0 +1,137 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/optimizer/graph_pattern_matcher.h"
+
+#include "core/graph/model.h"
+#include "gtest/gtest.h"
+#include "test/optimizer/graph_transform_test_builder.h"
+#include "test/test_environment.h"
+#include "test/util/include/asserts.h"
+
+namespace onnxruntime {
+namespace test {
+
+namespace {
+
+Node* FindNodeByOpType(Graph& graph, const std::string& op_type) {
+  for (auto& node : graph.Nodes()) {
+    if (node.OpType() == op_type) {
+      return &node;
+    }
+  }
+  return nullptr;
+}
+
+// 1/x -> Div -> Mul, the DivMulFusion shape. `extra_div_consumer` adds a second consumer of the
+// Div output so single-consumer pattern edges must reject the match.
+void BuildDivMulGraph(ModelTestBuilder& builder, bool extra_div_consumer) {
+  auto* x = builder.MakeInput<float>({2, 3}, -1.0f, 1.0f);
+  auto* y = builder.MakeInput<float>({2, 3}, -1.0f, 1.0f);
+  auto* one = builder.MakeInitializer<float>({1}, {1.0f});
+  auto* div_out = builder.MakeIntermediate();
+  builder.AddNode("Div", {one, x}, {div_out});
+  builder.AddNode("Mul", {div_out, y}, {builder.MakeOutput()});
+  if (extra_div_consumer) {
+    builder.AddNode("Neg", {div_out}, {builder.MakeOutput()});
+  }
+  builder.SetGraphOutputs();
+}
+
+PatternGraph MakeDivMulPattern(bool single_consumer = true) {
+  PatternGraph pattern;
+  int mul = pattern.AddNode("Mul", {7, 13, 14});
+  int div = pattern.AddNode("Div", {7, 13, 14});
+  pattern.AddUpstreamEdge(mul, 0, div, single_consumer);
+  return pattern;
+}
+
+}  // namespace
+
+TEST(GraphPatternMatcherTest, MatchesUpstreamChain) {
+  Model model("PatternMatcherTest", false, ModelMetaData(), PathString(),
+              IOnnxRuntimeOpSchemaRegistryList(), {{kOnnxDomain, 14}}, {},
+              DefaultLoggingManager().DefaultLogger());
+  Graph& graph = model.MainGraph();
+  ModelTestBuilder builder(graph);
+  BuildDivMulGraph(builder, /*extra_div_consumer*/ false);
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  Node* mul_node = FindNodeByOpType(graph, "Mul");
+  ASSERT_NE(mul_node, nullptr);
+
+  PatternGraph pattern = MakeDivMulPattern();
+  auto match = pattern.Match(graph, *mul_node);
+  ASSERT_TRUE(match.has_value());
+  ASSERT_EQ(match->size(), static_cast<size_t>(2));
+  EXPECT_EQ((*match)[PatternGraph::kRootNodeIndex], mul_node);
+  EXPECT_EQ((*match)[1]->OpType(), "Div");
+
+  // input 1 of the Mul is a graph input, so there is no producer to bind
+  PatternGraph no_producer_pattern;
+  int mul = no_producer_pattern.AddNode("Mul", {7, 13, 14});
+  int div = no_producer_pattern.AddNode("Div", {7, 13, 14});
+  no_producer_pattern.AddUpstreamEdge(mul, 1, div);
+  EXPECT_FALSE(no_producer_pattern.Match(graph, *mul_node).has_value());
+}
+
+TEST(GraphPatternMatcherTest, SingleConsumerEdgeRejectsSharedProducer) {
+  Model model("PatternMatcherTest", false, ModelMetaData(), PathString(),
+              IOnnxRuntimeOpSchemaRegistryList(), {{kOnnxDomain, 14}}, {},
+              DefaultLoggingManager().DefaultLogger());
+  Graph& graph = model.MainGraph();
+  ModelTestBuilder builder(graph);
+  BuildDivMulGraph(builder, /*extra_div_consumer*/ true);
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  Node* mul_node = FindNodeByOpType(graph, "Mul");
+  ASSERT_NE(mul_node, nullptr);
+
+  EXPECT_FALSE(MakeDivMulPattern(/*single_consumer*/ true).Match(graph, *mul_node).has_value());
+  EXPECT_TRUE(MakeDivMulPattern(/*single_consumer*/ false).Match(graph, *mul_node).has_value());
+}
+
+TEST(GraphPatternMatcherTest, TransformerDispatchesByRootOpType) {
+  Model model("PatternMatcherTest", false, ModelMetaData(), PathString(),
+              IOnnxRuntimeOpSchemaRegistryList(), {{kOnnxDomain, 14}}, {},
+              DefaultLoggingManager().DefaultLogger());
+  Graph& graph = model.MainGraph();
+  ModelTestBuilder builder(graph);
+  BuildDivMulGraph(builder, /*extra_div_consumer*/ false);
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  int div_mul_matches = 0;
+  int relu_matches = 0;
+
+  PatternGraphTransformer transformer("TestPatternTransformer");
+  transformer.RegisterPattern(
+      MakeDivMulPattern(),
+      [&div_mul_matches](Graph&, InlinedVector<Node*>& matched_nodes, bool& rewritten) {
+        EXPECT_EQ(matched_nodes.size(), static_cast<size_t>(2));
+        EXPECT_EQ(matched_nodes[PatternGraph::kRootNodeIndex]->OpType(), "Mul");
+        EXPECT_EQ(matched_nodes[1]->OpType(), "Div");
+        ++div_mul_matches;
+        rewritten = true;
+        return Status::OK();
+      });
+
+  // no Relu in the graph, so this pattern is never even tested against a node
+  PatternGraph relu_pattern;
+  relu_pattern.AddNode("Relu", {6, 13, 14});
+  transformer.RegisterPattern(
+      relu_pattern,
+      [&relu_matches](Graph&, InlinedVector<Node*>&, bool&) {
+        ++relu_matches;
+        return Status::OK();
+      });
+
+  bool modified = false;
+  ASSERT_STATUS_OK(transformer.Apply(graph, modified, DefaultLoggingManager().DefaultLogger()));
+
+  EXPECT_TRUE(modified);
+  EXPECT_EQ(div_mul_matches, 1);
+  EXPECT_EQ(relu_matches, 0);
+}
+
+}  // namespace test
+}  // namespace onnxruntime
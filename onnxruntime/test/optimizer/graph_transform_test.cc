@@ -38,11 +38,15 @@
 #include "core/optimizer/double_qdq_pairs_remover.h"
 #include "core/optimizer/dropout_elimination.h"
 #include "core/optimizer/dynamic_quantize_matmul_fusion.h"
+#include "core/optimizer/elementwise_fusion.h"
+#include "core/optimizer/embedding_bag_fusion.h"
+#include "core/optimizer/matmul_topk_fusion.h"
 #include "core/optimizer/expand_elimination.h"
 #include "core/optimizer/fast_gelu_fusion.h"
 #include "core/optimizer/gather_fusion.h"
 #include "core/optimizer/gelu_approximation.h"
 #include "core/optimizer/gelu_fusion.h"
+#include "core/optimizer/cast_gemm_fusion.h"
 #include "core/optimizer/gemm_activation_fusion.h"
 #include "core/optimizer/gemm_sum_fusion.h"
 #include "core/optimizer/gemm_transpose_fusion.h"
@@ -51,6 +55,7 @@
 #include "core/optimizer/graph_transformer_utils.h"
 #include "core/optimizer/graph_transformer.h"
 #include "core/optimizer/identity_elimination.h"
+#include "core/optimizer/imputer_scaler_fusion.h"
 #include "core/optimizer/initializer.h"
 #include "core/optimizer/isinf_reducesum_fusion.h"
 #include "core/optimizer/label_encoder_fusion.h"
@@ -74,6 +79,7 @@
 #include "core/optimizer/unsqueeze_elimination.h"
 #include "core/optimizer/utils.h"
 #include "core/platform/env.h"
+#include "core/platform/threadpool.h"
 #include "core/session/inference_session.h"
 #include "core/session/onnxruntime_session_options_config_keys.h"
 #include "core/util/math.h"
@@ -597,6 +603,57 @@ TEST_F(GraphTransformationTests, ConstantFolding) {
   ASSERT_TRUE(op_to_count["Unsqueeze"] == 0);
 }
 
+TEST_F(GraphTransformationTests, ConstantFoldingWithThreadPool) {
+  constexpr const ORTCHAR_T* model_uri = MODEL_FOLDER "fusion/fuse-conv-bn-mul-add-unsqueeze.onnx";
+  std::shared_ptr<Model> model;
+  ASSERT_STATUS_OK(Model::Load(model_uri, model, nullptr, *logger_));
+  Graph& graph = model->MainGraph();
+  std::map<std::string, int> op_to_count = CountOpsInGraph(graph);
+  ASSERT_EQ(op_to_count["Unsqueeze"], 2);
+
+  // the nodes that are foldable up-front are evaluated in parallel with the same end result
+  concurrency::ThreadPool thread_pool(&onnxruntime::Env::Default(), ThreadOptions{}, ORT_TSTR("ConstantFoldingTest"),
+                                      4, true);
+
+  std::unique_ptr<CPUExecutionProvider> e = std::make_unique<CPUExecutionProvider>(CPUExecutionProviderInfo());
+  onnxruntime::GraphTransformerManager graph_transformation_mgr{5};
+  const ConfigOptions empty_config_options;
+  ASSERT_STATUS_OK(graph_transformation_mgr.Register(
+      std::make_unique<ConstantFolding>(*e.get(), false /*skip_dequantize_linear*/, empty_config_options,
+                                        InlinedHashSet<std::string_view>{}, InlinedHashSet<std::string>{},
+                                        &thread_pool),
+      TransformerLevel::Level1));
+
+  ASSERT_STATUS_OK(graph_transformation_mgr.ApplyTransformers(graph, TransformerLevel::Level1, *logger_));
+
+  op_to_count = CountOpsInGraph(graph);
+  ASSERT_TRUE(op_to_count["Unsqueeze"] == 0);
+}
+
+TEST_F(GraphTransformationTests, ConstantFoldingSizeCap) {
+  constexpr const ORTCHAR_T* model_uri = MODEL_FOLDER "fusion/fuse-conv-bn-mul-add-unsqueeze.onnx";
+  std::shared_ptr<Model> model;
+  ASSERT_STATUS_OK(Model::Load(model_uri, model, nullptr, *logger_));
+  Graph& graph = model->MainGraph();
+  std::map<std::string, int> op_to_count = CountOpsInGraph(graph);
+  ASSERT_EQ(op_to_count["Unsqueeze"], 2);
+
+  // a 1 byte cap means no computed output can be added as an initializer, so nothing is folded
+  ConfigOptions config_options;
+  config_options.configurations[kOrtSessionOptionsConstantFoldingSizeCapBytes] = "1";
+
+  std::unique_ptr<CPUExecutionProvider> e = std::make_unique<CPUExecutionProvider>(CPUExecutionProviderInfo());
+  onnxruntime::GraphTransformerManager graph_transformation_mgr{5};
+  ASSERT_STATUS_OK(graph_transformation_mgr.Register(
+      std::make_unique<ConstantFolding>(*e.get(), false /*skip_dequantize_linear*/, config_options),
+      TransformerLevel::Level1));
+
+  ASSERT_STATUS_OK(graph_transformation_mgr.ApplyTransformers(graph, TransformerLevel::Level1, *logger_));
+
+  op_to_count = CountOpsInGraph(graph);
+  ASSERT_EQ(op_to_count["Unsqueeze"], 2);
+}
+
 TEST_F(GraphTransformationTests, ConstantFoldingNodesOnDifferentEP) {
   constexpr const ORTCHAR_T* model_uri = MODEL_FOLDER "fusion/fuse-conv-bn-mul-add-unsqueeze.onnx";
   std::shared_ptr<Model> model;
@@ -2276,6 +2333,90 @@ TEST_F(GraphTransformationTests, FuseConvActivationPreservingAttributes) {
   check_ints_attr("pads", AsSpan<int64_t>({1, 1, 1, 1}));
   check_ints_attr("kernel_shape", AsSpan<int64_t>({3, 3}));
 }
+
+TEST_F(GraphTransformationTests, FuseConvPostOpChain) {
+  // Conv -> Mul(scalar) -> Add(scalar) -> Clip is absorbed into a single FusedConv
+  // carrying the ordered 'post_ops'/'post_op_params' attributes.
+  auto build_test_case = [](ModelTestBuilder& builder) {
+    auto* input_arg = builder.MakeInput<float>({1, 8, 5, 5}, -4.f, 4.f);
+    auto* weight_arg = builder.MakeInitializer<float>({8, 8, 3, 3}, -1.f, 1.f);
+    auto* conv_out = builder.MakeIntermediate();
+    auto* mul_out = builder.MakeIntermediate();
+    auto* add_out = builder.MakeIntermediate();
+    auto* output_arg = builder.MakeOutput();
+
+    builder.AddNode("Conv", {input_arg, weight_arg}, {conv_out});
+    builder.AddNode("Mul", {conv_out, builder.MakeScalarInitializer<float>(0.25f)}, {mul_out});
+    builder.AddNode("Add", {mul_out, builder.MakeScalarInitializer<float>(3.f)}, {add_out});
+    builder.AddNode("Clip", {add_out, builder.MakeScalarInitializer<float>(0.f), builder.MakeScalarInitializer<float>(6.f)},
+                    {output_arg});
+  };
+
+  auto check_graph = [](InferenceSessionWrapper& session) {
+    const auto& graph = session.GetGraph();
+    auto op_to_count = CountOpsInGraph(graph);
+    EXPECT_EQ(op_to_count["com.microsoft.FusedConv"], 1);
+    EXPECT_EQ(op_to_count["Mul"], 0);
+    EXPECT_EQ(op_to_count["Add"], 0);
+    EXPECT_EQ(op_to_count["Clip"], 0);
+
+    for (const auto& node : graph.Nodes()) {
+      if (node.OpType() != "FusedConv") {
+        continue;
+      }
+      const auto& attrs = node.GetAttributes();
+      ASSERT_NE(attrs.find("post_ops"), attrs.end());
+      const auto& post_ops = attrs.at("post_ops").strings();
+      ASSERT_EQ(post_ops.size(), 3);
+      EXPECT_EQ(post_ops.Get(0), "Mul");
+      EXPECT_EQ(post_ops.Get(1), "Add");
+      EXPECT_EQ(post_ops.Get(2), "Clip");
+      const auto& post_op_params = attrs.at("post_op_params").floats();
+      ASSERT_EQ(post_op_params.size(), 4);
+      EXPECT_EQ(post_op_params.Get(0), 0.25f);  // Mul scale
+      EXPECT_EQ(post_op_params.Get(1), 3.f);    // Add bias
+      EXPECT_EQ(post_op_params.Get(2), 0.f);    // Clip min
+      EXPECT_EQ(post_op_params.Get(3), 6.f);    // Clip max
+    }
+  };
+
+  TransformerTester(build_test_case,
+                    check_graph,
+                    TransformerLevel::Default,
+                    TransformerLevel::Level2,
+                    12 /*opset_version*/,
+                    1e-4 /*per_sample_tolerance*/,
+                    1e-6 /*relative_per_sample_tolerance*/);
+}
+
+TEST_F(GraphTransformationTests, FuseConvPostOpChainRequiresScalarConstant) {
+  // Mul with a per-channel constant cannot be absorbed, and a lone Mul is not an
+  // activation, so no fusion happens.
+  auto build_test_case = [](ModelTestBuilder& builder) {
+    auto* input_arg = builder.MakeInput<float>({1, 8, 5, 5}, -4.f, 4.f);
+    auto* weight_arg = builder.MakeInitializer<float>({8, 8, 3, 3}, -1.f, 1.f);
+    auto* scale_arg = builder.MakeInitializer<float>({1, 8, 1, 1}, 0.f, 1.f);
+    auto* conv_out = builder.MakeIntermediate();
+    auto* output_arg = builder.MakeOutput();
+
+    builder.AddNode("Conv", {input_arg, weight_arg}, {conv_out});
+    builder.AddNode("Mul", {conv_out, scale_arg}, {output_arg});
+  };
+
+  auto check_graph = [](InferenceSessionWrapper& session) {
+    auto op_to_count = CountOpsInGraph(session.GetGraph());
+    EXPECT_EQ(op_to_count["com.microsoft.FusedConv"], 0);
+    EXPECT_EQ(op_to_count["Mul"], 1);
+  };
+
+  TransformerTester(build_test_case,
+                    check_graph,
+                    TransformerLevel::Default,
+                    TransformerLevel::Level2,
+                    12 /*opset_version*/,
+                    1e-4 /*per_sample_tolerance*/,
+                    1e-6 /*relative_per_sample_tolerance*/);
+}
 #endif  // !defined(DISABLE_CONTRIB_OPS)
 
 TEST_F(GraphTransformationTests, FuseConvMulNoBias) {
@@ -2487,6 +2628,53 @@ TEST_F(GraphTransformationTests, Gemm_Relu_three_input) {
   ASSERT_TRUE(op_to_count["Relu"] == 0);
 }
 
+TEST_F(GraphTransformationTests, ImputerScalerFusion) {
+  Model model("ImputerScalerFusion", false, ModelMetaData(), PathString(), IOnnxRuntimeOpSchemaRegistryList(),
+              {{kOnnxDomain, 12}, {kMLDomain, 1}}, {}, *logger_);
+  auto& graph = model.MainGraph();
+
+  TypeProto float_tensor_type;
+  float_tensor_type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  float_tensor_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(3);
+  float_tensor_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(2);
+
+  auto& input_arg = graph.GetOrCreateNodeArg("X", &float_tensor_type);
+  auto& imputer_output = graph.GetOrCreateNodeArg("imputer_output", &float_tensor_type);
+  auto& output_arg = graph.GetOrCreateNodeArg("Y", &float_tensor_type);
+
+  auto& imputer_node = graph.AddNode("imputer", "Imputer", "impute missing values", {&input_arg}, {&imputer_output},
+                                     nullptr, kMLDomain);
+  imputer_node.AddAttribute("imputed_value_floats", std::vector<float>{1.f, 2.f});
+  imputer_node.AddAttribute("replaced_value_float", 0.f);
+
+  auto& scaler_node = graph.AddNode("scaler", "Scaler", "standardize features", {&imputer_output}, {&output_arg},
+                                    nullptr, kMLDomain);
+  scaler_node.AddAttribute("scale", std::vector<float>{2.f, 3.f});
+  scaler_node.AddAttribute("offset", std::vector<float>{0.5f, 1.5f});
+
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  onnxruntime::GraphTransformerManager graph_transformation_mgr{5};
+  ASSERT_STATUS_OK(graph_transformation_mgr.Register(std::make_unique<ImputerScalerFusion>(), TransformerLevel::Level2));
+  ASSERT_STATUS_OK(graph_transformation_mgr.ApplyTransformers(graph, TransformerLevel::Level2, *logger_));
+
+  std::map<std::string, int> op_to_count = CountOpsInGraph(graph);
+  ASSERT_EQ(op_to_count["ai.onnx.ml.Imputer"], 0);
+  ASSERT_EQ(op_to_count["ai.onnx.ml.Scaler"], 0);
+  ASSERT_EQ(op_to_count["com.microsoft.FusedImputerScaler"], 1);
+
+  // the fused node carries both the imputer and the scaler parameters
+  for (auto& node : graph.Nodes()) {
+    if (node.OpType() == "FusedImputerScaler") {
+      const auto& attrs = node.GetAttributes();
+      ASSERT_TRUE(attrs.find("imputed_value_floats") != attrs.end());
+      ASSERT_TRUE(attrs.find("replaced_value_float") != attrs.end());
+      ASSERT_TRUE(attrs.find("scale") != attrs.end());
+      ASSERT_TRUE(attrs.find("offset") != attrs.end());
+    }
+  }
+}
+
 TEST_F(GraphTransformationTests, TransposeMatmulFusion) {
   constexpr const ORTCHAR_T* model_uri = MODEL_FOLDER "fusion/transpose_matmul_4d_fusion.onnx";
   std::shared_ptr<Model> p_model;
@@ -3266,6 +3454,89 @@ TEST_F(GraphTransformationTests, GemmSumFusionNoFusionOriginalGemmOutputUsed) {
   }
 }
 
+// Cast(fp16->fp32) on A, B and C feeding a float Gemm whose only consumer casts back to fp16
+// should collapse to a single fp16 Gemm.
+TEST_F(GraphTransformationTests, CastGemmFusion) {
+  auto build_test_case = [&](ModelTestBuilder& builder) {
+    auto* a_fp16 = builder.MakeInput<MLFloat16>({{8, 16}});
+    auto* b_fp16 = builder.MakeInput<MLFloat16>({{16, 4}});
+    auto* c_fp16 = builder.MakeInput<MLFloat16>({{8, 4}});
+    auto* a_fp32 = builder.MakeIntermediate();
+    auto* b_fp32 = builder.MakeIntermediate();
+    auto* c_fp32 = builder.MakeIntermediate();
+    auto* gemm_out = builder.MakeIntermediate();
+    auto* output_fp16 = builder.MakeOutput();
+
+    builder.AddNode("Cast", {a_fp16}, {a_fp32})
+        .AddAttribute("to", static_cast<int64_t>(ONNX_NAMESPACE::TensorProto_DataType_FLOAT));
+    builder.AddNode("Cast", {b_fp16}, {b_fp32})
+        .AddAttribute("to", static_cast<int64_t>(ONNX_NAMESPACE::TensorProto_DataType_FLOAT));
+    builder.AddNode("Cast", {c_fp16}, {c_fp32})
+        .AddAttribute("to", static_cast<int64_t>(ONNX_NAMESPACE::TensorProto_DataType_FLOAT));
+    builder.AddNode("Gemm", {a_fp32, b_fp32, c_fp32}, {gemm_out});
+    builder.AddNode("Cast", {gemm_out}, {output_fp16})
+        .AddAttribute("to", static_cast<int64_t>(ONNX_NAMESPACE::TensorProto_DataType_FLOAT16));
+  };
+
+  auto pre_graph_checker = [&](Graph& graph) {
+    auto op_to_count = CountOpsInGraph(graph);
+    TEST_RETURN_IF_NOT(op_to_count["Cast"] == 4);
+    TEST_RETURN_IF_NOT(op_to_count["Gemm"] == 1);
+    return Status::OK();
+  };
+
+  auto post_graph_checker = [&](Graph& graph) {
+    auto op_to_count = CountOpsInGraph(graph);
+    TEST_RETURN_IF_NOT(op_to_count["Cast"] == 0);
+    TEST_RETURN_IF_NOT(op_to_count["Gemm"] == 1);
+    for (Node& node : graph.Nodes()) {
+      if (node.OpType() == "Gemm") {
+        TEST_RETURN_IF_NOT(node.InputDefs()[0]->TypeAsProto()->tensor_type().elem_type() ==
+                           ONNX_NAMESPACE::TensorProto_DataType_FLOAT16);
+        TEST_RETURN_IF_NOT(node.OutputDefs()[0]->TypeAsProto()->tensor_type().elem_type() ==
+                           ONNX_NAMESPACE::TensorProto_DataType_FLOAT16);
+      }
+    }
+    return Status::OK();
+  };
+
+  ASSERT_STATUS_OK(TestGraphTransformer(build_test_case, 13, *logger_, std::make_unique<CastGemmFusion>(),
+                                        TransformerLevel::Level2, 1, pre_graph_checker, post_graph_checker));
+}
+
+// No fusion when the widened A is also consumed by another node: the Cast has to stay,
+// so absorbing it into the Gemm would not remove a conversion.
+TEST_F(GraphTransformationTests, CastGemmFusionNoFusionCastReused) {
+  auto build_test_case = [&](ModelTestBuilder& builder) {
+    auto* a_fp16 = builder.MakeInput<MLFloat16>({{8, 16}});
+    auto* b_fp16 = builder.MakeInput<MLFloat16>({{16, 4}});
+    auto* a_fp32 = builder.MakeIntermediate();
+    auto* b_fp32 = builder.MakeIntermediate();
+    auto* gemm_out = builder.MakeIntermediate();
+    auto* output_fp16 = builder.MakeOutput();
+    auto* identity_out = builder.MakeOutput();
+
+    builder.AddNode("Cast", {a_fp16}, {a_fp32})
+        .AddAttribute("to", static_cast<int64_t>(ONNX_NAMESPACE::TensorProto_DataType_FLOAT));
+    builder.AddNode("Cast", {b_fp16}, {b_fp32})
+        .AddAttribute("to", static_cast<int64_t>(ONNX_NAMESPACE::TensorProto_DataType_FLOAT));
+    builder.AddNode("Gemm", {a_fp32, b_fp32}, {gemm_out});
+    builder.AddNode("Cast", {gemm_out}, {output_fp16})
+        .AddAttribute("to", static_cast<int64_t>(ONNX_NAMESPACE::TensorProto_DataType_FLOAT16));
+    builder.AddNode("Identity", {a_fp32}, {identity_out});
+  };
+
+  auto graph_checker = [&](Graph& graph) {
+    auto op_to_count = CountOpsInGraph(graph);
+    TEST_RETURN_IF_NOT(op_to_count["Cast"] == 3);
+    TEST_RETURN_IF_NOT(op_to_count["Gemm"] == 1);
+    return Status::OK();
+  };
+
+  ASSERT_STATUS_OK(TestGraphTransformer(build_test_case, 13, *logger_, std::make_unique<CastGemmFusion>(),
+                                        TransformerLevel::Level2, 1, graph_checker, graph_checker));
+}
+
 TEST_F(GraphTransformationTests, FuseConvBnAddMulFloat16) {
   constexpr const ORTCHAR_T* model_uri = MODEL_FOLDER "fusion/fuse-conv-bn-add-mul-float16.onnx";
 
@@ -5333,6 +5604,328 @@ TEST_F(GraphTransformationTests, QuickGelu) {
   }
 }
 
+TEST_F(GraphTransformationTests, ElementwiseFusion) {
+  // Add(x, scalar) -> Sigmoid -> Mul(scalar, x): the whole chain collapses into one node.
+  {
+    auto build_test_case = [&](ModelTestBuilder& builder) {
+      auto* input_arg = builder.MakeInput<float>({{2, 3, 3, 3}});
+      auto* add_scalar = builder.MakeInitializer<float>({}, {1.5f});
+      auto* mul_scalar = builder.MakeInitializer<float>({}, {0.25f});
+      auto* add_out = builder.MakeIntermediate();
+      auto* sigmoid_out = builder.MakeIntermediate();
+      auto* mul_out = builder.MakeOutput();
+
+      builder.AddNode("Add", {input_arg, add_scalar}, {add_out});
+      builder.AddNode("Sigmoid", {add_out}, {sigmoid_out});
+      builder.AddNode("Mul", {mul_scalar, sigmoid_out}, {mul_out});
+    };
+
+    auto pre_graph_checker = [&](Graph& graph) {
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["Add"] == 1);
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["Sigmoid"] == 1);
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["Mul"] == 1);
+      return Status::OK();
+    };
+
+    auto post_graph_checker = [&](Graph& graph) {
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["Add"] == 0);
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["Sigmoid"] == 0);
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["Mul"] == 0);
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["com.microsoft.FusedElementwise"] == 1);
+      for (auto& node : graph.Nodes()) {
+        if (node.OpType() == "FusedElementwise") {
+          auto& attrs = node.GetAttributes();
+          TEST_RETURN_IF_NOT(attrs.find("steps") != attrs.end());
+          TEST_RETURN_IF_NOT(attrs.at("steps").strings_size() == 3);
+          TEST_RETURN_IF_NOT(attrs.at("steps").strings(0) == "Add");
+          TEST_RETURN_IF_NOT(attrs.at("steps").strings(1) == "Sigmoid");
+          TEST_RETURN_IF_NOT(attrs.at("steps").strings(2) == "Mul");
+          TEST_RETURN_IF_NOT(attrs.at("scalars").floats(0) == 1.5f);
+          TEST_RETURN_IF_NOT(attrs.at("scalars").floats(2) == 0.25f);
+          TEST_RETURN_IF_NOT(attrs.at("scalar_first").ints(2) == 1);
+        }
+      }
+      return Status::OK();
+    };
+
+    std::unique_ptr<GraphTransformer> transformer = std::make_unique<ElementwiseFusion>();
+    ASSERT_STATUS_OK(TestGraphTransformer(build_test_case, 14, *logger_, std::move(transformer),
+                                          TransformerLevel::Level2, 1, pre_graph_checker, post_graph_checker));
+  }
+
+  // An intermediate output with a second consumer stops the chain: only Sigmoid -> Mul fuses.
+  {
+    auto build_test_case = [&](ModelTestBuilder& builder) {
+      auto* input_arg = builder.MakeInput<float>({{2, 3, 3, 3}});
+      auto* add_scalar = builder.MakeInitializer<float>({}, {1.5f});
+      auto* mul_scalar = builder.MakeInitializer<float>({}, {0.25f});
+      auto* add_out = builder.MakeIntermediate();
+      auto* sigmoid_out = builder.MakeIntermediate();
+      auto* mul_out = builder.MakeOutput();
+      auto* relu_out = builder.MakeOutput();
+
+      builder.AddNode("Add", {input_arg, add_scalar}, {add_out});
+      builder.AddNode("Relu", {add_out}, {relu_out});  // second consumer of add_out
+      builder.AddNode("Sigmoid", {add_out}, {sigmoid_out});
+      builder.AddNode("Mul", {sigmoid_out, mul_scalar}, {mul_out});
+    };
+
+    auto pre_graph_checker = [&](Graph& graph) {
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["Add"] == 1);
+      return Status::OK();
+    };
+
+    auto post_graph_checker = [&](Graph& graph) {
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["Add"] == 1);
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["Relu"] == 1);
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["Sigmoid"] == 0);
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["Mul"] == 0);
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["com.microsoft.FusedElementwise"] == 1);
+      return Status::OK();
+    };
+
+    std::unique_ptr<GraphTransformer> transformer = std::make_unique<ElementwiseFusion>();
+    ASSERT_STATUS_OK(TestGraphTransformer(build_test_case, 14, *logger_, std::move(transformer),
+                                          TransformerLevel::Level2, 1, pre_graph_checker, post_graph_checker));
+  }
+
+  // Binary ops with two tensor inputs are not steps; a lone fusable node is left alone.
+  {
+    auto build_test_case = [&](ModelTestBuilder& builder) {
+      auto* input_arg = builder.MakeInput<float>({{2, 3, 3, 3}});
+      auto* other_arg = builder.MakeInput<float>({{2, 3, 3, 3}});
+      auto* sigmoid_out = builder.MakeIntermediate();
+      auto* mul_out = builder.MakeOutput();
+
+      builder.AddNode("Sigmoid", {input_arg}, {sigmoid_out});
+      builder.AddNode("Mul", {sigmoid_out, other_arg}, {mul_out});
+    };
+
+    auto pre_graph_checker = [&](Graph& graph) {
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["Sigmoid"] == 1);
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["Mul"] == 1);
+      return Status::OK();
+    };
+
+    auto post_graph_checker = [&](Graph& graph) {
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["Sigmoid"] == 1);
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["Mul"] == 1);
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["com.microsoft.FusedElementwise"] == 0);
+      return Status::OK();
+    };
+
+    std::unique_ptr<GraphTransformer> transformer = std::make_unique<ElementwiseFusion>();
+    ASSERT_STATUS_OK(TestGraphTransformer(build_test_case, 14, *logger_, std::move(transformer),
+                                          TransformerLevel::Level2, 1, pre_graph_checker, post_graph_checker));
+  }
+}
+
+TEST_F(GraphTransformationTests, EmbeddingBagFusion) {
+  // Gather(axis=0) -> ReduceSum over the last index dimension fuses into EmbeddingBag.
+  // At opset 14 the ReduceSum axes are a constant input.
+  {
+    auto build_test_case = [&](ModelTestBuilder& builder) {
+      auto* weight_arg = builder.MakeInput<float>({{10, 4}});
+      auto* indices_arg = builder.MakeInput<int64_t>({2, 3}, std::vector<int64_t>{0, 1, 2, 3, 4, 5});
+      auto* axes_arg = builder.MakeInitializer<int64_t>({1}, {1});
+      auto* gather_out = builder.MakeIntermediate();
+      auto* reduce_out = builder.MakeOutput();
+
+      builder.AddNode("Gather", {weight_arg, indices_arg}, {gather_out});
+      auto& reduce = builder.AddNode("ReduceSum", {gather_out, axes_arg}, {reduce_out});
+      reduce.AddAttribute("keepdims", static_cast<int64_t>(0));
+    };
+
+    auto pre_graph_checker = [&](Graph& graph) {
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["Gather"] == 1);
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["ReduceSum"] == 1);
+      return Status::OK();
+    };
+
+    auto post_graph_checker = [&](Graph& graph) {
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["Gather"] == 0);
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["ReduceSum"] == 0);
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["com.microsoft.EmbeddingBag"] == 1);
+      for (auto& node : graph.Nodes()) {
+        if (node.OpType() == "EmbeddingBag") {
+          auto& attrs = node.GetAttributes();
+          TEST_RETURN_IF_NOT(attrs.find("mode") != attrs.end());
+          TEST_RETURN_IF_NOT(attrs.at("mode").s() == "sum");
+        }
+      }
+      return Status::OK();
+    };
+
+    std::unique_ptr<GraphTransformer> transformer = std::make_unique<EmbeddingBagFusion>();
+    ASSERT_STATUS_OK(TestGraphTransformer(build_test_case, 14, *logger_, std::move(transformer),
+                                          TransformerLevel::Level2, 1, pre_graph_checker, post_graph_checker));
+  }
+
+  // ReduceMean with a negative axes attribute naming the bag dimension fuses as mode 'mean'.
+  {
+    auto build_test_case = [&](ModelTestBuilder& builder) {
+      auto* weight_arg = builder.MakeInput<float>({{10, 4}});
+      auto* indices_arg = builder.MakeInput<int64_t>({2, 3}, std::vector<int64_t>{0, 1, 2, 3, 4, 5});
+      auto* gather_out = builder.MakeIntermediate();
+      auto* reduce_out = builder.MakeOutput();
+
+      builder.AddNode("Gather", {weight_arg, indices_arg}, {gather_out});
+      auto& reduce = builder.AddNode("ReduceMean", {gather_out}, {reduce_out});
+      reduce.AddAttribute("axes", std::vector<int64_t>{-2});
+      reduce.AddAttribute("keepdims", static_cast<int64_t>(0));
+    };
+
+    auto pre_graph_checker = [&](Graph& graph) {
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["Gather"] == 1);
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["ReduceMean"] == 1);
+      return Status::OK();
+    };
+
+    auto post_graph_checker = [&](Graph& graph) {
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["Gather"] == 0);
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["ReduceMean"] == 0);
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["com.microsoft.EmbeddingBag"] == 1);
+      for (auto& node : graph.Nodes()) {
+        if (node.OpType() == "EmbeddingBag") {
+          TEST_RETURN_IF_NOT(node.GetAttributes().at("mode").s() == "mean");
+        }
+      }
+      return Status::OK();
+    };
+
+    std::unique_ptr<GraphTransformer> transformer = std::make_unique<EmbeddingBagFusion>();
+    ASSERT_STATUS_OK(TestGraphTransformer(build_test_case, 14, *logger_, std::move(transformer),
+                                          TransformerLevel::Level2, 1, pre_graph_checker, post_graph_checker));
+  }
+
+  // keepdims=1 changes the output shape, so the pair must be left alone. A reduction
+  // over a non-bag axis must not fuse either.
+  {
+    auto build_test_case = [&](ModelTestBuilder& builder) {
+      auto* weight_arg = builder.MakeInput<float>({{10, 4}});
+      auto* indices_arg = builder.MakeInput<int64_t>({2, 3}, std::vector<int64_t>{0, 1, 2, 3, 4, 5});
+      auto* axes_keep = builder.MakeInitializer<int64_t>({1}, {1});
+      auto* axes_wrong = builder.MakeInitializer<int64_t>({1}, {0});
+      auto* gather_out_1 = builder.MakeIntermediate();
+      auto* gather_out_2 = builder.MakeIntermediate();
+      auto* reduce_out_1 = builder.MakeOutput();
+      auto* reduce_out_2 = builder.MakeOutput();
+
+      builder.AddNode("Gather", {weight_arg, indices_arg}, {gather_out_1});
+      auto& reduce_1 = builder.AddNode("ReduceSum", {gather_out_1, axes_keep}, {reduce_out_1});
+      reduce_1.AddAttribute("keepdims", static_cast<int64_t>(1));
+
+      builder.AddNode("Gather", {weight_arg, indices_arg}, {gather_out_2});
+      auto& reduce_2 = builder.AddNode("ReduceSum", {gather_out_2, axes_wrong}, {reduce_out_2});
+      reduce_2.AddAttribute("keepdims", static_cast<int64_t>(0));
+    };
+
+    auto pre_graph_checker = [&](Graph& graph) {
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["Gather"] == 2);
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["ReduceSum"] == 2);
+      return Status::OK();
+    };
+
+    auto post_graph_checker = [&](Graph& graph) {
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["Gather"] == 2);
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["ReduceSum"] == 2);
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["com.microsoft.EmbeddingBag"] == 0);
+      return Status::OK();
+    };
+
+    std::unique_ptr<GraphTransformer> transformer = std::make_unique<EmbeddingBagFusion>();
+    ASSERT_STATUS_OK(TestGraphTransformer(build_test_case, 14, *logger_, std::move(transformer),
+                                          TransformerLevel::Level2, 1, pre_graph_checker, post_graph_checker));
+  }
+}
+
+TEST_F(GraphTransformationTests, MatMulTopKFusion) {
+  // A rank-2 MatMul whose only consumer is TopK over the last axis with a constant k
+  // fuses into GemmTopK, carrying k and the TopK attributes over.
+  {
+    auto build_test_case = [&](ModelTestBuilder& builder) {
+      auto* a_arg = builder.MakeInput<float>({{3, 4}});
+      auto* b_arg = builder.MakeInput<float>({{4, 16}});
+      auto* k_arg = builder.MakeInitializer<int64_t>({1}, {5});
+      auto* matmul_out = builder.MakeIntermediate();
+      auto* values_out = builder.MakeOutput();
+      auto* indices_out = builder.MakeOutput();
+
+      builder.AddNode("MatMul", {a_arg, b_arg}, {matmul_out});
+      auto& topk = builder.AddNode("TopK", {matmul_out, k_arg}, {values_out, indices_out});
+      topk.AddAttribute("axis", static_cast<int64_t>(-1));
+      topk.AddAttribute("largest", static_cast<int64_t>(1));
+    };
+
+    auto pre_graph_checker = [&](Graph& graph) {
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["MatMul"] == 1);
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["TopK"] == 1);
+      return Status::OK();
+    };
+
+    auto post_graph_checker = [&](Graph& graph) {
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["MatMul"] == 0);
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["TopK"] == 0);
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["com.microsoft.GemmTopK"] == 1);
+      for (auto& node : graph.Nodes()) {
+        if (node.OpType() == "GemmTopK") {
+          auto& attrs = node.GetAttributes();
+          TEST_RETURN_IF_NOT(attrs.find("k") != attrs.end());
+          TEST_RETURN_IF_NOT(attrs.at("k").i() == 5);
+          TEST_RETURN_IF_NOT(attrs.at("largest").i() == 1);
+        }
+      }
+      return Status::OK();
+    };
+
+    std::unique_ptr<GraphTransformer> transformer = std::make_unique<MatMulTopKFusion>();
+    ASSERT_STATUS_OK(TestGraphTransformer(build_test_case, 14, *logger_, std::move(transformer),
+                                          TransformerLevel::Level2, 1, pre_graph_checker, post_graph_checker));
+  }
+
+  // A batched MatMul must be left alone, as must one whose TopK k is a dynamic input.
+  {
+    auto build_test_case = [&](ModelTestBuilder& builder) {
+      auto* a_batched = builder.MakeInput<float>({{2, 3, 4}});
+      auto* b_batched = builder.MakeInput<float>({{4, 16}});
+      auto* k_const = builder.MakeInitializer<int64_t>({1}, {5});
+      auto* matmul_out_1 = builder.MakeIntermediate();
+      auto* values_out_1 = builder.MakeOutput();
+      auto* indices_out_1 = builder.MakeOutput();
+
+      builder.AddNode("MatMul", {a_batched, b_batched}, {matmul_out_1});
+      builder.AddNode("TopK", {matmul_out_1, k_const}, {values_out_1, indices_out_1});
+
+      auto* a_arg = builder.MakeInput<float>({{3, 4}});
+      auto* b_arg = builder.MakeInput<float>({{4, 16}});
+      auto* k_dynamic = builder.MakeInput<int64_t>({1}, std::vector<int64_t>{5});
+      auto* matmul_out_2 = builder.MakeIntermediate();
+      auto* values_out_2 = builder.MakeOutput();
+      auto* indices_out_2 = builder.MakeOutput();
+
+      builder.AddNode("MatMul", {a_arg, b_arg}, {matmul_out_2});
+      builder.AddNode("TopK", {matmul_out_2, k_dynamic}, {values_out_2, indices_out_2});
+    };
+
+    auto pre_graph_checker = [&](Graph& graph) {
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["MatMul"] == 2);
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["TopK"] == 2);
+      return Status::OK();
+    };
+
+    auto post_graph_checker = [&](Graph& graph) {
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["MatMul"] == 2);
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["TopK"] == 2);
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["com.microsoft.GemmTopK"] == 0);
+      return Status::OK();
+    };
+
+    std::unique_ptr<GraphTransformer> transformer = std::make_unique<MatMulTopKFusion>();
+    ASSERT_STATUS_OK(TestGraphTransformer(build_test_case, 14, *logger_, std::move(transformer),
+                                          TransformerLevel::Level2, 1, pre_graph_checker, post_graph_checker));
+  }
+}
+
 struct BiasSoftmaxFusionTester {
   std::shared_ptr<Model> p_model_;
   Status model_load_;
@@ -7827,6 +8420,92 @@ TEST_F(GraphTransformationTests, MatMulNBitsBiasFusion) {
   }
 }
 
+TEST_F(GraphTransformationTests, MatMulNBitsActivationFusion) {
+  auto run_test = [&logger = *logger_](const std::string& activation, const std::string& expected_attr) {
+    SCOPED_TRACE(MakeString("activation:", activation));
+
+    auto build_test_case = [&](ModelTestBuilder& builder) {
+      constexpr size_t qbits = 4;
+      constexpr size_t block_size = 32;
+
+      constexpr int64_t M = 2, K = 4, N = 8;
+
+      int q_rows, q_cols;
+      MlasBlockwiseQuantizedShape<float, qbits>(block_size, /* columnwise */ true,
+                                                K, N,
+                                                q_rows, q_cols);
+
+      size_t q_data_size_in_bytes, q_scale_size, q_zp_size_in_bytes;
+      MlasBlockwiseQuantizedBufferSizes(qbits, block_size, /* columnwise */ true,
+                                        K, N,
+                                        q_data_size_in_bytes, q_scale_size, &q_zp_size_in_bytes);
+
+      auto* A = builder.MakeInput<float>(std::vector{M, K}, "A");
+
+      auto* B_data = builder.MakeInitializer<uint8_t>({int64_t{q_rows}, int64_t{q_cols}},
+                                                      uint8_t{0}, uint8_t{255});
+      auto* B_scales = builder.MakeInitializer<float>({static_cast<int64_t>(q_scale_size)},
+                                                      1.0f, 2.0f);
+      auto* B_zero_points = builder.MakeInitializer<uint8_t>({static_cast<int64_t>(q_zp_size_in_bytes)},
+                                                             uint8_t{0}, uint8_t{255});
+
+      auto* matmul_output = builder.MakeIntermediate();
+
+      auto& matmul = builder.AddNode("MatMulNBits",
+                                     {A, B_data, B_scales, B_zero_points},
+                                     {matmul_output},
+                                     kMSDomain);
+      matmul.AddAttribute("N", N);
+      matmul.AddAttribute("K", K);
+      matmul.AddAttribute("block_size", static_cast<int64_t>(block_size));
+      matmul.AddAttribute("bits", static_cast<int64_t>(qbits));
+
+      auto* graph_output = builder.MakeOutput();
+
+      if (activation == "Silu") {
+        // SiLU appears in graphs as Mul(x, Sigmoid(x))
+        auto* sigmoid_output = builder.MakeIntermediate();
+        builder.AddNode("Sigmoid", {matmul_output}, {sigmoid_output});
+        builder.AddNode("Mul", {matmul_output, sigmoid_output}, {graph_output});
+      } else {
+        builder.AddNode(activation, {matmul_output}, {graph_output},
+                        activation == "FastGelu" ? kMSDomain : kOnnxDomain);
+      }
+    };
+
+    auto pre_graph_checker = [](Graph& graph) {
+      auto op_count = CountOpsInGraph(graph);
+      EXPECT_EQ(op_count["com.microsoft.MatMulNBits"], 1);
+      return Status::OK();
+    };
+
+    auto post_graph_checker = [&](Graph& graph) {
+      auto op_count = CountOpsInGraph(graph);
+      EXPECT_EQ(op_count.size(), 1u);
+      EXPECT_EQ(op_count["com.microsoft.MatMulNBits"], 1);
+
+      for (const auto& node : graph.Nodes()) {
+        if (node.OpType() == "MatMulNBits") {
+          const auto* activation_attr = graph_utils::GetNodeAttribute(node, "activation");
+          EXPECT_NE(activation_attr, nullptr);
+          if (activation_attr != nullptr) {
+            EXPECT_EQ(activation_attr->s(), expected_attr);
+          }
+        }
+      }
+
+      return Status::OK();
+    };
+
+    ASSERT_STATUS_OK(TestGraphTransformer(build_test_case, 14, logger, std::make_unique<MatMulNBitsFusion>(),
+                                          TransformerLevel::Level2, 1, pre_graph_checker, post_graph_checker));
+  };
+
+  run_test("Relu", "Relu");
+  run_test("FastGelu", "FastGelu");
+  run_test("Silu", "Silu");
+}
+
 #endif  // !defined(DISABLE_CONTRIB_OPS)
 
 }  // namespace test
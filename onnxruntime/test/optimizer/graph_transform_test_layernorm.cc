@@ -680,6 +680,113 @@ TEST_F(GraphTransformationTests, SkipLayerNormFusion_Input_Output_Check) {
   TestSkipLayerNormFusionInputOutputCheck(MODEL_FOLDER "fusion/skip_layer_norm_input_output_with_cast_check.onnx", true, logger_.get());
 }
 
+// Checks that the bias Add and LayerNormalization were fused into a single SkipLayerNormalization
+// node whose data/skip inputs and 5th (bias) input are the expected NodeArgs.
+static Status CheckSkipLayerNormWithBias(Graph& graph, const std::string& input0_name,
+                                         const std::string& input1_name, const std::string& bias_name) {
+  TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["Add"] == 0);
+  TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["LayerNormalization"] == 0);
+  TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["com.microsoft.SkipLayerNormalization"] == 1);
+  for (const Node& node : graph.Nodes()) {
+    if (node.OpType() == "SkipLayerNormalization") {
+      TEST_RETURN_IF_NOT(node.InputDefs().size() == 5u);
+      TEST_RETURN_IF_NOT(node.InputDefs()[0]->Name() == input0_name);
+      TEST_RETURN_IF_NOT(node.InputDefs()[1]->Name() == input1_name);
+      TEST_RETURN_IF_NOT(node.InputDefs()[4]->Name() == bias_name);
+    }
+  }
+  return Status::OK();
+}
+
+// Format 1 with the bias as the FIRST input of the bias Add, i.e. Add(bias, data). The fusion
+// must still fire and pick the 3D operand as the data input and the 1D constant as the bias.
+TEST_F(GraphTransformationTests, SkipLayerNormFusion_CommutedBiasFormat1) {
+  std::string bias_name;
+  auto build_test_case = [&bias_name](ModelTestBuilder& builder) {
+    auto* data_arg = builder.MakeInput<float>({{2, 3, 4}}, "data");
+    auto* skip_arg = builder.MakeInput<float>({{2, 3, 4}}, "skip");
+    auto* bias_arg = builder.MakeInitializer<float>({4}, std::vector<float>(4, 0.5f));
+    auto* gamma_arg = builder.MakeInitializer<float>({4}, std::vector<float>(4, 1.0f));
+    auto* beta_arg = builder.MakeInitializer<float>({4}, std::vector<float>(4, 0.0f));
+    auto* add2_out = builder.MakeIntermediate();
+    auto* add1_out = builder.MakeIntermediate();
+    auto* ln_out = builder.MakeOutput();
+
+    builder.AddNode("Add", {bias_arg, data_arg}, {add2_out});
+    builder.AddNode("Add", {add2_out, skip_arg}, {add1_out});
+    builder.AddNode("LayerNormalization", {add1_out, gamma_arg, beta_arg}, {ln_out})
+        .AddAttribute("epsilon", 1e-5f);
+    bias_name = bias_arg->Name();
+  };
+
+  auto post_graph_checker = [&bias_name](Graph& graph) {
+    return CheckSkipLayerNormWithBias(graph, "data", "skip", bias_name);
+  };
+
+  ASSERT_STATUS_OK(TestGraphTransformer(build_test_case, 14, *logger_, std::make_unique<SkipLayerNormFusion>(),
+                                        TransformerLevel::Level2, 1, nullptr, post_graph_checker));
+}
+
+// Format 2 with the commuted Add(bias, data): the data operand must end up as the skip input.
+TEST_F(GraphTransformationTests, SkipLayerNormFusion_CommutedBiasFormat2) {
+  std::string bias_name;
+  auto build_test_case = [&bias_name](ModelTestBuilder& builder) {
+    auto* data_arg = builder.MakeInput<float>({{2, 3, 4}}, "data");
+    auto* skip_arg = builder.MakeInput<float>({{2, 3, 4}}, "skip");
+    auto* bias_arg = builder.MakeInitializer<float>({4}, std::vector<float>(4, 0.5f));
+    auto* gamma_arg = builder.MakeInitializer<float>({4}, std::vector<float>(4, 1.0f));
+    auto* beta_arg = builder.MakeInitializer<float>({4}, std::vector<float>(4, 0.0f));
+    auto* add2_out = builder.MakeIntermediate();
+    auto* add1_out = builder.MakeIntermediate();
+    auto* ln_out = builder.MakeOutput();
+
+    builder.AddNode("Add", {bias_arg, data_arg}, {add2_out});
+    builder.AddNode("Add", {skip_arg, add2_out}, {add1_out});
+    builder.AddNode("LayerNormalization", {add1_out, gamma_arg, beta_arg}, {ln_out})
+        .AddAttribute("epsilon", 1e-5f);
+    bias_name = bias_arg->Name();
+  };
+
+  auto post_graph_checker = [&bias_name](Graph& graph) {
+    return CheckSkipLayerNormWithBias(graph, "skip", "data", bias_name);
+  };
+
+  ASSERT_STATUS_OK(TestGraphTransformer(build_test_case, 14, *logger_, std::make_unique<SkipLayerNormFusion>(),
+                                        TransformerLevel::Level2, 1, nullptr, post_graph_checker));
+}
+
+// Both operands of the bias Add are constant, but the second one is 3D and thus cannot be the
+// bias: the match must fall through to the first operand, taking the 1D constant as the bias and
+// the 3D constant as the data input.
+TEST_F(GraphTransformationTests, SkipLayerNormFusion_CommutedBiasShapeFallThrough) {
+  std::string data_name;
+  std::string bias_name;
+  auto build_test_case = [&data_name, &bias_name](ModelTestBuilder& builder) {
+    auto* skip_arg = builder.MakeInput<float>({{2, 3, 4}}, "skip");
+    auto* bias_arg = builder.MakeInitializer<float>({4}, std::vector<float>(4, 0.5f));
+    auto* data_arg = builder.MakeInitializer<float>({2, 3, 4}, std::vector<float>(24, 1.0f));
+    auto* gamma_arg = builder.MakeInitializer<float>({4}, std::vector<float>(4, 1.0f));
+    auto* beta_arg = builder.MakeInitializer<float>({4}, std::vector<float>(4, 0.0f));
+    auto* add2_out = builder.MakeIntermediate();
+    auto* add1_out = builder.MakeIntermediate();
+    auto* ln_out = builder.MakeOutput();
+
+    builder.AddNode("Add", {bias_arg, data_arg}, {add2_out});
+    builder.AddNode("Add", {add2_out, skip_arg}, {add1_out});
+    builder.AddNode("LayerNormalization", {add1_out, gamma_arg, beta_arg}, {ln_out})
+        .AddAttribute("epsilon", 1e-5f);
+    data_name = data_arg->Name();
+    bias_name = bias_arg->Name();
+  };
+
+  auto post_graph_checker = [&data_name, &bias_name](Graph& graph) {
+    return CheckSkipLayerNormWithBias(graph, data_name, "skip", bias_name);
+  };
+
+  ASSERT_STATUS_OK(TestGraphTransformer(build_test_case, 14, *logger_, std::make_unique<SkipLayerNormFusion>(),
+                                        TransformerLevel::Level2, 1, nullptr, post_graph_checker));
+}
+
 static void TestSkipLayerNormFusionNoBeta(const std::basic_string<ORTCHAR_T>& model_uri, bool with_cast, logging::Logger* logger) {
   std::shared_ptr<Model> p_model;
   ASSERT_STATUS_OK(Model::Load(model_uri, p_model, nullptr, *logger));
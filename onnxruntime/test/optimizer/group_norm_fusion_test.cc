@@ -0,0 +1,122 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/optimizer/group_norm_fusion.h"
+
+#include "core/graph/model.h"
+#include "gtest/gtest.h"
+#include "test/framework/test_utils.h"
+#include "test/optimizer/graph_transform_test_builder.h"
+#include "test/test_environment.h"
+#include "test/util/include/asserts.h"
+
+namespace onnxruntime {
+namespace test {
+
+namespace {
+
+constexpr int64_t kBatch = 2;
+constexpr int64_t kChannels = 4;
+constexpr int64_t kGroups = 2;
+
+// Reshape -> InstanceNormalization -> Reshape -> Mul(gamma) -> Add(beta) [-> Sigmoid -> Mul]
+void BuildDecomposedGroupNorm(ModelTestBuilder& builder, bool with_silu) {
+  auto* x = builder.MakeInput<float>({kBatch, kChannels, 2, 2}, -1.0f, 1.0f);
+  auto* shape_grouped = builder.MakeInitializer<int64_t>({3}, {kBatch, kGroups, -1});
+  auto* shape_back = builder.MakeInitializer<int64_t>({4}, {kBatch, kChannels, 2, 2});
+  auto* in_scale = builder.MakeInitializer<float>({kGroups}, {1.0f, 1.0f});
+  auto* in_bias = builder.MakeInitializer<float>({kGroups}, {0.0f, 0.0f});
+  auto* gamma = builder.MakeInitializer<float>({kChannels, 1, 1}, {0.5f, 1.0f, 1.5f, 2.0f});
+  auto* beta = builder.MakeInitializer<float>({kChannels, 1, 1}, {0.1f, 0.2f, 0.3f, 0.4f});
+
+  auto* grouped = builder.MakeIntermediate();
+  builder.AddNode("Reshape", {x, shape_grouped}, {grouped});
+
+  auto* normalized = builder.MakeIntermediate();
+  builder.AddNode("InstanceNormalization", {grouped, in_scale, in_bias}, {normalized});
+
+  auto* restored = builder.MakeIntermediate();
+  builder.AddNode("Reshape", {normalized, shape_back}, {restored});
+
+  auto* scaled = builder.MakeIntermediate();
+  builder.AddNode("Mul", {restored, gamma}, {scaled});
+
+  if (with_silu) {
+    auto* shifted = builder.MakeIntermediate();
+    builder.AddNode("Add", {scaled, beta}, {shifted});
+    auto* sigmoid_out = builder.MakeIntermediate();
+    builder.AddNode("Sigmoid", {shifted}, {sigmoid_out});
+    builder.AddNode("Mul", {shifted, sigmoid_out}, {builder.MakeOutput()});
+  } else {
+    builder.AddNode("Add", {scaled, beta}, {builder.MakeOutput()});
+  }
+
+  builder.SetGraphOutputs();
+}
+
+}  // namespace
+
+TEST(GroupNormFusionTest, FusesDecomposedPattern) {
+  Model model("GroupNormFusionTest", false, ModelMetaData(), PathString(),
+              IOnnxRuntimeOpSchemaRegistryList(), {{kOnnxDomain, 14}, {kMSDomain, 1}}, {},
+              DefaultLoggingManager().DefaultLogger());
+  Graph& graph = model.MainGraph();
+  ModelTestBuilder builder(graph);
+  BuildDecomposedGroupNorm(builder, /*with_silu*/ false);
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  GroupNormFusion transformer;
+  bool modified = false;
+  ASSERT_STATUS_OK(transformer.Apply(graph, modified, DefaultLoggingManager().DefaultLogger()));
+  EXPECT_TRUE(modified);
+
+  auto op_counts = CountOpsInGraph(graph);
+  EXPECT_EQ(op_counts["com.microsoft.GroupNorm"], 1);
+  EXPECT_EQ(op_counts["InstanceNormalization"], 0);
+  EXPECT_EQ(op_counts["Reshape"], 0);
+  EXPECT_EQ(op_counts["Mul"], 0);
+  EXPECT_EQ(op_counts["Add"], 0);
+
+  Node* group_norm = nullptr;
+  for (auto& node : graph.Nodes()) {
+    if (node.OpType() == "GroupNorm") {
+      group_norm = &node;
+    }
+  }
+  ASSERT_NE(group_norm, nullptr);
+  EXPECT_EQ(group_norm->GetAttributes().at("groups").i(), kGroups);
+  EXPECT_EQ(group_norm->GetAttributes().at("activation").i(), 0);
+  EXPECT_EQ(group_norm->GetAttributes().at("channels_last").i(), 0);
+}
+
+TEST(GroupNormFusionTest, AbsorbsSiluEpilogue) {
+  Model model("GroupNormFusionTest", false, ModelMetaData(), PathString(),
+              IOnnxRuntimeOpSchemaRegistryList(), {{kOnnxDomain, 14}, {kMSDomain, 1}}, {},
+              DefaultLoggingManager().DefaultLogger());
+  Graph& graph = model.MainGraph();
+  ModelTestBuilder builder(graph);
+  BuildDecomposedGroupNorm(builder, /*with_silu*/ true);
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  GroupNormFusion transformer;
+  bool modified = false;
+  ASSERT_STATUS_OK(transformer.Apply(graph, modified, DefaultLoggingManager().DefaultLogger()));
+  EXPECT_TRUE(modified);
+
+  auto op_counts = CountOpsInGraph(graph);
+  EXPECT_EQ(op_counts["com.microsoft.GroupNorm"], 1);
+  EXPECT_EQ(op_counts["Sigmoid"], 0);
+  EXPECT_EQ(op_counts["Mul"], 0);
+
+  Node* group_norm = nullptr;
+  for (auto& node : graph.Nodes()) {
+    if (node.OpType() == "GroupNorm") {
+      group_norm = &node;
+    }
+  }
+  ASSERT_NE(group_norm, nullptr);
+  EXPECT_EQ(group_norm->GetAttributes().at("activation").i(), 1);
+}
+
+}  // namespace test
+}  // namespace onnxruntime
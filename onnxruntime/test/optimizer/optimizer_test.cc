@@ -115,5 +115,59 @@ TEST(OptimizerTest, Basic) {
   }
 }
 
+namespace {
+// Counts its applications and reports a modification for the first modifying_applications calls.
+class CountingGraphTransformer : public GraphTransformer {
+ public:
+  CountingGraphTransformer(const std::string& name, int modifying_applications)
+      : GraphTransformer(name), modifying_applications_(modifying_applications) {}
+
+  int NumApplications() const { return num_applications_; }
+
+ private:
+  Status ApplyImpl(Graph& /*graph*/, bool& modified, int /*graph_level*/,
+                   const logging::Logger& /*logger*/) const override {
+    modified = num_applications_ < modifying_applications_;
+    ++num_applications_;
+    return Status::OK();
+  }
+
+  const int modifying_applications_;
+  mutable int num_applications_ = 0;
+};
+}  // namespace
+
+TEST(GraphTransformerManagerTest, SkipsTransformersWhenGraphIsUnchanged) {
+  Model model("GraphTransformerManagerTest", false, ModelMetaData(), PathString(),
+              IOnnxRuntimeOpSchemaRegistryList(), {{kOnnxDomain, 12}}, {},
+              DefaultLoggingManager().DefaultLogger());
+  auto& graph = model.MainGraph();
+
+  TypeProto float_tensor;
+  float_tensor.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  float_tensor.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(1);
+  auto& input_arg = graph.GetOrCreateNodeArg("X", &float_tensor);
+  auto& output_arg = graph.GetOrCreateNodeArg("Y", &float_tensor);
+  graph.AddNode("identity", "Identity", "", {&input_arg}, {&output_arg});
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  GraphTransformerManager mgr{10};
+  auto modifying = std::make_unique<CountingGraphTransformer>("modifies_once", 1);
+  auto readonly = std::make_unique<CountingGraphTransformer>("never_modifies", 0);
+  const auto* modifying_ptr = modifying.get();
+  const auto* readonly_ptr = readonly.get();
+  ASSERT_STATUS_OK(mgr.Register(std::move(modifying), TransformerLevel::Level1));
+  ASSERT_STATUS_OK(mgr.Register(std::move(readonly), TransformerLevel::Level1));
+
+  ASSERT_STATUS_OK(mgr.ApplyTransformers(graph, TransformerLevel::Level1,
+                                         DefaultLoggingManager().DefaultLogger()));
+
+  // Step 0 runs both transformers; 'modifies_once' advances the graph version. In step 1
+  // 'modifies_once' is re-applied (its own change may enable further matches) and finds
+  // nothing, while 'never_modifies' already ran against the current graph and is skipped.
+  EXPECT_EQ(modifying_ptr->NumApplications(), 2);
+  EXPECT_EQ(readonly_ptr->NumApplications(), 1);
+}
+
 }  // namespace test
 }  // namespace onnxruntime
@@ -3773,6 +3773,56 @@ TEST(TransposeOptimizerTests, TestDequantizeLinearNoAxis) {
 #endif
 }
 
+// Runs TransformerTester for the graph Transpose -> DequantizeLinear -> Transpose with blocked
+// quantization, where scale and zero point have the same rank as the input and must be permuted
+// together with it when the leading Transpose is pushed through the DequantizeLinear.
+// Expects the Transpose nodes to cancel.
+template <typename QuantType>
+static void RunBlockedDequantizeLinearTestCase() {
+  auto build_test_case = [&](ModelTestBuilder& builder) {
+    constexpr QuantType qmin = std::numeric_limits<QuantType>::min();
+    constexpr QuantType qmax = std::numeric_limits<QuantType>::max();
+
+    auto* input0_arg = MakeInput<QuantType>(builder, {{2, 4, 6, 3}}, {2, 4, 6, 3}, qmin, qmax);
+
+    // after the leading Transpose with perm {0, 3, 1, 2} the DQ input has shape {2, 3, 4, 6};
+    // blocked quantization on axis 2 with block_size 2 gives the quantization params shape {2, 3, 2, 6}
+    const std::vector<int64_t> param_shape = {2, 3, 2, 6};
+    auto* scale_arg = builder.MakeInitializer<float>(param_shape, 0.01f, 1.0f);
+    auto* zero_point_arg = builder.MakeInitializer<QuantType>(param_shape, qmin, qmax);
+
+    auto* transpose_1_out_0 = builder.MakeIntermediate();
+    auto* dequantizelinear_1_out_0 = builder.MakeIntermediate();
+    auto* transpose_2_out_0 = builder.MakeOutput();
+
+    auto& transpose_1 = builder.AddNode("Transpose", {input0_arg}, {transpose_1_out_0});
+    transpose_1.AddAttribute("perm", std::vector<int64_t>{0, 3, 1, 2});
+    auto& dequantizelinear_1 = builder.AddNode("DequantizeLinear", {transpose_1_out_0, scale_arg, zero_point_arg},
+                                               {dequantizelinear_1_out_0});
+    dequantizelinear_1.AddAttribute("axis", static_cast<int64_t>(2));
+    dequantizelinear_1.AddAttribute("block_size", static_cast<int64_t>(2));
+    auto& transpose_2 = builder.AddNode("Transpose", {dequantizelinear_1_out_0}, {transpose_2_out_0});
+    transpose_2.AddAttribute("perm", std::vector<int64_t>{0, 2, 3, 1});
+  };
+
+  auto check_optimized_graph = [](InferenceSessionWrapper& session) {
+    int transpose_cost = EstimateTransposeCost(session.GetGraph());
+    EXPECT_EQ(transpose_cost, 0);
+  };
+
+  // Blocked quantization requires ONNX opset 21.
+  TransformerTester(build_test_case,
+                    check_optimized_graph,
+                    TransformerLevel::Default,
+                    TransformerLevel::Level1,
+                    /*opset_version*/ 21);
+}
+
+TEST(TransposeOptimizerTests, TestDequantizeLinearBlocked) {
+  RunBlockedDequantizeLinearTestCase<uint8_t>();
+  RunBlockedDequantizeLinearTestCase<int8_t>();
+}
+
 TEST(TransposeOptimizerTests, TestCast) {
   auto build_test_case_1 = [&](ModelTestBuilder& builder) {
     auto* input0_arg = MakeInput<int32_t>(builder, {{-1, 4, -1, 5}}, {2, 4, 6, 5}, -1, 5);
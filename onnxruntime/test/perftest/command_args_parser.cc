@@ -38,6 +38,12 @@ namespace perftest {
       "\t-A: Disable memory arena\n"
       "\t-I: Generate tensor input binding (Free dimensions are treated as 1.)\n"
       "\t-c [parallel runs]: Specifies the (max) number of runs to invoke simultaneously. Default:1.\n"
+      "\t-a [arrival_rate_qps]: Open-loop load generation for 'duration' mode: issue requests with Poisson arrivals "
+      "at the given average rate instead of back-to-back, regardless of completions. Latency is measured from the "
+      "intended arrival time, so queueing delay behind slow requests is included. In-flight requests are unbounded "
+      "by design; rates above the sustainable throughput will grow the queue for the whole run.\n"
+      "\t-J [summary_file]: Dump a machine-readable JSON summary (throughput, latency percentiles, "
+      "session creation and first-inference time) to the given file.\n"
       "\t-e [cpu|cuda|dnnl|tensorrt|openvino|dml|acl|nnapi|coreml|qnn|snpe|rocm|migraphx|xnnpack|vitisai|webgpu]: Specifies the provider 'cpu','cuda','dnnl','tensorrt', "
       "'openvino', 'dml', 'acl', 'nnapi', 'coreml', 'qnn', 'snpe', 'rocm', 'migraphx', 'xnnpack', 'vitisai' or 'webgpu'. "
       "Default:'cpu'.\n"
@@ -209,7 +215,7 @@ static bool ParseSessionConfigs(const std::string& configs_string,
 
 /*static*/ bool CommandLineParser::ParseArguments(PerformanceTestConfig& test_config, int argc, ORTCHAR_T* argv[]) {
   int ch;
-  while ((ch = getopt(argc, argv, ORT_TSTR("m:e:r:t:p:x:y:c:d:o:u:i:f:F:S:T:C:AMPIDZvhsqznlR:"))) != -1) {
+  while ((ch = getopt(argc, argv, ORT_TSTR("m:e:r:t:p:x:y:c:d:o:u:i:f:F:S:T:C:a:J:AMPIDZvhsqznlR:"))) != -1) {
     switch (ch) {
       case 'f': {
         std::basic_string<ORTCHAR_T> dim_name;
@@ -401,6 +407,15 @@ static bool ParseSessionConfigs(const std::string& configs_string,
       case 'R':
         test_config.run_config.register_custom_op_path = optarg;
         break;
+      case 'a':
+        test_config.run_config.poisson_arrival_rate_qps = OrtStrtod<PATH_CHAR_TYPE>(optarg, nullptr);
+        if (!(test_config.run_config.poisson_arrival_rate_qps > 0.0)) {
+          return false;
+        }
+        break;
+      case 'J':
+        test_config.model_info.summary_file_path = optarg;
+        break;
       case '?':
       case 'h':
       default:
@@ -8,6 +8,7 @@
 
 #include "performance_runner.h"
 #include <iostream>
+#include <thread>
 
 #include "TestCase.h"
 #include "utils.h"
@@ -165,10 +166,68 @@ Status PerformanceRunner::Run() {
             << "Peak working set size: " << performance_result_.peak_workingset_size << " bytes"
             << std::endl;
 
+  if (!performance_test_config_.model_info.summary_file_path.empty()) {
+    WriteJsonSummary(session_create_duration.count(), static_cast<double>(first_inference_duration),
+                     inference_duration.count());
+  }
+
   return Status::OK();
 }
 
+void PerformanceRunner::WriteJsonSummary(double session_create_s, double first_inference_ms,
+                                         double run_duration_s) const {
+  const auto& path = performance_test_config_.model_info.summary_file_path;
+  std::ofstream outfile(path);
+  if (!outfile.good()) {
+    std::cerr << "failed to open summary file '" << ToUTF8String(path.c_str()) << "'.\n";
+    return;
+  }
+
+  const auto& run_config = performance_test_config_.run_config;
+  const auto& time_costs = performance_result_.time_costs;
+  const bool open_loop = run_config.poisson_arrival_rate_qps > 0.0;
+
+  outfile << "{\n"
+          << "  \"model_name\": \"" << performance_result_.model_name << "\",\n"
+          << "  \"mode\": \""
+          << (open_loop ? "open_loop_poisson"
+                        : (run_config.test_mode == TestMode::kFixDurationMode ? "duration" : "times"))
+          << "\",\n";
+  if (open_loop) {
+    outfile << "  \"arrival_rate_qps\": " << run_config.poisson_arrival_rate_qps << ",\n";
+  }
+  outfile << "  \"concurrent_session_runs\": " << run_config.concurrent_session_runs << ",\n"
+          << "  \"session_creation_s\": " << session_create_s << ",\n"
+          << "  \"first_inference_ms\": " << first_inference_ms << ",\n"
+          << "  \"requests\": " << time_costs.size() << ",\n"
+          << "  \"run_duration_s\": " << run_duration_s << ",\n"
+          << "  \"throughput_qps\": " << (run_duration_s > 0 ? time_costs.size() / run_duration_s : 0.0) << ",\n"
+          << "  \"avg_cpu_usage_percent\": " << performance_result_.average_CPU_usage << ",\n"
+          << "  \"peak_workingset_bytes\": " << performance_result_.peak_workingset_size;
+
+  if (!time_costs.empty()) {
+    std::vector<double> sorted_time = time_costs;
+    std::sort(sorted_time.begin(), sorted_time.end());
+    size_t total = sorted_time.size();
+    outfile << ",\n"
+            << "  \"latency_s\": {\n"
+            << "    \"min\": " << sorted_time[0] << ",\n"
+            << "    \"p50\": " << sorted_time[static_cast<size_t>(total * 0.5)] << ",\n"
+            << "    \"p90\": " << sorted_time[static_cast<size_t>(total * 0.9)] << ",\n"
+            << "    \"p95\": " << sorted_time[static_cast<size_t>(total * 0.95)] << ",\n"
+            << "    \"p99\": " << sorted_time[static_cast<size_t>(total * 0.99)] << ",\n"
+            << "    \"p999\": " << sorted_time[static_cast<size_t>(total * 0.999)] << ",\n"
+            << "    \"max\": " << sorted_time[total - 1] << "\n"
+            << "  }";
+  }
+  outfile << "\n}\n";
+}
+
 Status PerformanceRunner::FixDurationTest() {
+  if (performance_test_config_.run_config.poisson_arrival_rate_qps > 0.0) {
+    return RunOpenLoopPoisson();
+  }
+
   if (performance_test_config_.run_config.concurrent_session_runs <= 1) {
     return RunFixDuration();
   }
@@ -222,6 +281,73 @@ Status PerformanceRunner::RunParallelDuration() {
   return Status::OK();
 }
 
+Status PerformanceRunner::RunOneScheduledRequest(
+    std::chrono::time_point<std::chrono::high_resolution_clock> arrival) {
+  auto status = Status::OK();
+  ORT_TRY {
+    session_->Run();
+  }
+  ORT_CATCH(const std::exception& ex) {
+    ORT_HANDLE_EXCEPTION([&]() {
+      status = ORT_MAKE_STATUS(ONNXRUNTIME, FAIL,
+                               "PerformanceRunner::RunOneScheduledRequest caught exception: ", ex.what());
+    });
+  }
+  ORT_RETURN_IF_ERROR(status);
+
+  // measure from the intended arrival so time spent queued behind slow requests is included
+  std::chrono::duration<double> latency_seconds = std::chrono::high_resolution_clock::now() - arrival;
+
+  std::lock_guard<OrtMutex> guard(results_mutex_);
+  performance_result_.time_costs.emplace_back(latency_seconds.count());
+  performance_result_.total_time_cost += latency_seconds.count();
+  if (performance_test_config_.run_config.f_verbose) {
+    std::cout << "iteration:" << performance_result_.time_costs.size() << ","
+              << "time_cost:" << performance_result_.time_costs.back() << std::endl;
+  }
+  return Status::OK();
+}
+
+Status PerformanceRunner::RunOpenLoopPoisson() {
+  const auto& run_config = performance_test_config_.run_config;
+  auto tpool = GetDefaultThreadPool(Env::Default());
+  std::atomic<int> counter = {0};
+  OrtMutex m;
+  OrtCondVar cv;
+
+  std::random_device rd;
+  std::mt19937_64 generator(run_config.random_seed_for_input_data < 0
+                                ? rd()
+                                : static_cast<uint64_t>(run_config.random_seed_for_input_data));
+  std::exponential_distribution<double> inter_arrival_seconds(run_config.poisson_arrival_rate_qps);
+
+  const auto start = std::chrono::high_resolution_clock::now();
+  const auto deadline = start + std::chrono::seconds(run_config.duration_in_seconds);
+  auto next_arrival = start;
+
+  while (next_arrival < deadline) {
+    std::this_thread::sleep_until(next_arrival);
+    counter++;
+    tpool->Schedule([this, next_arrival, &counter, &m, &cv]() {
+      auto status = RunOneScheduledRequest(next_arrival);
+      if (!status.IsOK())
+        std::cerr << status.ErrorMessage();
+      // Simplified version of Eigen::Barrier
+      std::lock_guard<OrtMutex> lg(m);
+      counter--;
+      cv.notify_all();
+    });
+    next_arrival += std::chrono::duration_cast<std::chrono::high_resolution_clock::duration>(
+        std::chrono::duration<double>(inter_arrival_seconds(generator)));
+  }
+
+  // Join; drains any queue built up when the offered rate exceeded the sustainable throughput.
+  std::unique_lock<OrtMutex> lock(m);
+  cv.wait(lock, [&counter]() { return counter == 0; });
+
+  return Status::OK();
+}
+
 Status PerformanceRunner::ForkJoinRepeat() {
   const auto& run_config = performance_test_config_.run_config;
 
@@ -90,6 +90,12 @@ class PerformanceRunner {
   Status RepeatedTimesTest();
   Status ForkJoinRepeat();
   Status RunParallelDuration();
+  // Open-loop load generation: requests arrive at a fixed Poisson rate regardless of completions,
+  // and each request's latency is measured from its intended arrival time so queueing delay counts.
+  Status RunOpenLoopPoisson();
+  Status RunOneScheduledRequest(std::chrono::time_point<std::chrono::high_resolution_clock> arrival);
+
+  void WriteJsonSummary(double session_create_s, double first_inference_ms, double run_duration_s) const;
 
   inline Status RunFixDuration() {
     while (performance_result_.total_time_cost < performance_test_config_.run_config.duration_in_seconds) {
@@ -29,6 +29,7 @@ struct ModelInfo {
   std::basic_string<ORTCHAR_T> model_file_path;
   std::basic_string<ORTCHAR_T> input_file_path;
   std::basic_string<ORTCHAR_T> result_file_path;
+  std::basic_string<ORTCHAR_T> summary_file_path;
   bool load_via_path = false;
 };
 
@@ -66,6 +67,9 @@ struct RunConfig {
   bool disable_spinning_between_run = false;
   bool exit_after_session_creation = false;
   std::basic_string<ORTCHAR_T> register_custom_op_path;
+  // > 0 switches 'duration' mode to an open-loop load generator with Poisson arrivals at this
+  // rate; latency is then measured from the intended arrival time so queueing delay is included.
+  double poisson_arrival_rate_qps = 0.0;
 };
 
 struct PerformanceTestConfig {
@@ -14,6 +14,8 @@
 #include <algorithm>
 #include <memory>
 #include <functional>
+#include <set>
+#include <thread>
 
 #ifdef _WIN32
 #include <Windows.h>
@@ -252,6 +254,81 @@ TEST(ThreadPoolTest, TestParallelFor_1_Thread_50_Task) {
   TestParallelFor("TestParallelFor_1_Thread_50_Task", 1, 50);
 }
 
+TEST(ThreadPoolTest, TestQuiesceAndResume) {
+  // While quiesced the pool has no worker threads and loops run inline on the calling thread;
+  // after Resume() the pool is fully operational again. Every iteration runs exactly once in
+  // each of the three phases.
+  constexpr int num_tasks = 50;
+  CreateThreadPoolAndTest("TestQuiesceAndResume", 4, [&](ThreadPool* tp) {
+    const int original_d_of_p = ThreadPool::DegreeOfParallelism(tp);
+    auto test_data = CreateTestData(num_tasks);
+    ThreadPool::TrySimpleParallelFor(tp, num_tasks, [&](std::ptrdiff_t i) { IncrementElement(*test_data, i); });
+
+    tp->Quiesce();
+    ASSERT_LT(ThreadPool::DegreeOfParallelism(tp), original_d_of_p);
+    std::set<std::thread::id> thread_ids;
+    onnxruntime::OrtMutex mutex;
+    ThreadPool::TrySimpleParallelFor(tp, num_tasks, [&](std::ptrdiff_t i) {
+      IncrementElement(*test_data, i);
+      std::lock_guard<onnxruntime::OrtMutex> lock(mutex);
+      thread_ids.insert(std::this_thread::get_id());
+    });
+    ASSERT_EQ(thread_ids.size(), 1u);
+    ASSERT_EQ(*thread_ids.begin(), std::this_thread::get_id());
+
+    tp->Resume();
+    ASSERT_EQ(ThreadPool::DegreeOfParallelism(tp), original_d_of_p);
+    ThreadPool::TrySimpleParallelFor(tp, num_tasks, [&](std::ptrdiff_t i) { IncrementElement(*test_data, i); });
+
+    ValidateTestData(*test_data, 3);
+  });
+}
+
+TEST(ThreadPoolTest, TestDegreeOfParallelismCap) {
+  CreateThreadPoolAndTest("TestDegreeOfParallelismCap", 4, [](ThreadPool* tp) {
+    const int uncapped = ThreadPool::DegreeOfParallelism(tp);
+    ASSERT_GT(uncapped, 2);
+    {
+      ThreadPool::DegreeOfParallelismCap cap(2);
+      ASSERT_EQ(ThreadPool::DegreeOfParallelism(tp), 2);
+      {
+        // nested caps only tighten; a looser nested value keeps the enclosing cap
+        ThreadPool::DegreeOfParallelismCap looser(uncapped);
+        ASSERT_EQ(ThreadPool::DegreeOfParallelism(tp), 2);
+        ThreadPool::DegreeOfParallelismCap tighter(1);
+        ASSERT_EQ(ThreadPool::DegreeOfParallelism(tp), 1);
+        ASSERT_FALSE(ThreadPool::ShouldParallelize(tp));
+      }
+      ASSERT_EQ(ThreadPool::DegreeOfParallelism(tp), 2);
+    }
+    ASSERT_EQ(ThreadPool::DegreeOfParallelism(tp), uncapped);
+  });
+}
+
+TEST(ThreadPoolTest, TestParallelForWithDegreeOfParallelismCap) {
+  // Under a cap every iteration still runs exactly once, at most cap threads participate,
+  // and a cap of 1 runs the loop inline on the calling thread.
+  constexpr int num_tasks = 50;
+  CreateThreadPoolAndTest("TestParallelForWithDegreeOfParallelismCap", 4, [&](ThreadPool* tp) {
+    for (int cap_value : {1, 2}) {
+      ThreadPool::DegreeOfParallelismCap cap(cap_value);
+      auto test_data = CreateTestData(num_tasks);
+      std::set<std::thread::id> thread_ids;
+      onnxruntime::OrtMutex mutex;
+      ThreadPool::TrySimpleParallelFor(tp, num_tasks, [&](std::ptrdiff_t i) {
+        IncrementElement(*test_data, i);
+        std::lock_guard<onnxruntime::OrtMutex> lock(mutex);
+        thread_ids.insert(std::this_thread::get_id());
+      });
+      ValidateTestData(*test_data);
+      ASSERT_LE(thread_ids.size(), static_cast<size_t>(cap_value));
+      if (cap_value == 1) {
+        ASSERT_EQ(*thread_ids.begin(), std::this_thread::get_id());
+      }
+    }
+  });
+}
+
 TEST(ThreadPoolTest, TestBatchParallelFor_0_Thread_50_Task_10_Batch) {
   TestBatchParallelFor("TestBatchParallelFor_0_Thread_50_Task_10_Batch", 0, 50, 10);
 }
@@ -510,6 +587,41 @@ TEST(ThreadPoolTest, TestStagedMultiLoopSections_4Thread_100Loop) {
   TestStagedMultiLoopSections("TestStagedMultiLoopSections_4Thread_100Loop", 4, 100);
 }
 
+static void TestSmallLoopFastPath(const std::string&, int num_threads, int small_loop_max_helpers) {
+  onnxruntime::ThreadOptions thread_options;
+  thread_options.small_loop_max_helpers = small_loop_max_helpers;
+  auto tp = std::make_unique<ThreadPool>(&onnxruntime::Env::Default(), thread_options, nullptr,
+                                         num_threads, true);
+
+  // Cover loop sizes and costs likely to hit the inline threshold, the degree-limited fork,
+  // and the regular full fan-out; each must run every iteration exactly once.
+  for (int num_tasks : {1, 16, 1024, 100000}) {
+    for (double cost_per_task : {1.0, 100.0, 100000.0}) {
+      auto test_data = CreateTestData(num_tasks);
+      ThreadPool::TryParallelFor(tp.get(), num_tasks, cost_per_task,
+                                 [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+                                   for (std::ptrdiff_t i = first; i < last; i++) {
+                                     IncrementElement(*test_data, i);
+                                   }
+                                 });
+      ValidateTestData(*test_data);
+    }
+  }
+}
+
+TEST(ThreadPoolTest, TestSmallLoopFastPath_2Thread_1Helper) {
+  TestSmallLoopFastPath("TestSmallLoopFastPath_2Thread_1Helper", 2, 1);
+}
+
+TEST(ThreadPoolTest, TestSmallLoopFastPath_4Thread_2Helper) {
+  TestSmallLoopFastPath("TestSmallLoopFastPath_4Thread_2Helper", 4, 2);
+}
+
+// More helpers than the pool has threads; the fork must be capped at the pool size.
+TEST(ThreadPoolTest, TestSmallLoopFastPath_4Thread_8Helper) {
+  TestSmallLoopFastPath("TestSmallLoopFastPath_4Thread_8Helper", 4, 8);
+}
+
 #ifdef _WIN32
 #if WINAPI_FAMILY_PARTITION(WINAPI_PARTITION_DESKTOP)
 #pragma warning(push)
@@ -0,0 +1,57 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/providers/azure/transfer_codec.h"
+
+#include <cstring>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "test/util/include/asserts.h"
+
+namespace onnxruntime {
+namespace test {
+
+TEST(AzureTransferCodec, ByteStreamSplitRoundTrip) {
+  const std::vector<float> values{0.f, 1.f, -1.f, 3.14159f, 1e-30f, -1e30f};
+  std::vector<uint8_t> src(values.size() * sizeof(float));
+  std::memcpy(src.data(), values.data(), src.size());
+
+  std::vector<uint8_t> encoded(src.size());
+  ASSERT_STATUS_OK(azure::ByteStreamSplitEncode(src, sizeof(float), encoded));
+
+  // plane 0 holds byte 0 of every element
+  for (size_t i = 0; i < values.size(); ++i) {
+    EXPECT_EQ(encoded[i], src[i * sizeof(float)]);
+  }
+
+  std::vector<uint8_t> decoded(src.size());
+  ASSERT_STATUS_OK(azure::ByteStreamSplitDecode(encoded, sizeof(float), decoded));
+  EXPECT_EQ(decoded, src);
+}
+
+TEST(AzureTransferCodec, ByteStreamSplitRejectsBadSizes) {
+  std::vector<uint8_t> src(10);
+  std::vector<uint8_t> dst(10);
+  // 10 is not a multiple of the element size
+  ASSERT_STATUS_NOT_OK(azure::ByteStreamSplitEncode(src, sizeof(float), dst));
+
+  std::vector<uint8_t> small_dst(8);
+  src.resize(12);
+  ASSERT_STATUS_NOT_OK(azure::ByteStreamSplitEncode(src, sizeof(float), small_dst));
+}
+
+TEST(AzureTransferCodec, ParseTransferCodecConfig) {
+  azure::TransferCodec codec;
+
+  ASSERT_STATUS_OK(azure::ParseTransferCodec({}, codec));
+  EXPECT_EQ(codec, azure::TransferCodec::kNone);
+
+  ASSERT_STATUS_OK(azure::ParseTransferCodec({{azure::kTransferCodecConfigKey, "byte_stream_split"}}, codec));
+  EXPECT_EQ(codec, azure::TransferCodec::kByteStreamSplit);
+
+  ASSERT_STATUS_NOT_OK(azure::ParseTransferCodec({{azure::kTransferCodecConfigKey, "zstd"}}, codec));
+}
+
+}  // namespace test
+}  // namespace onnxruntime
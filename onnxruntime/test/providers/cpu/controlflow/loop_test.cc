@@ -9,6 +9,7 @@
 #include "core/common/logging/logging.h"
 #include "core/framework/session_state.h"
 #include "core/session/inference_session.h"
+#include "core/session/onnxruntime_session_options_config_keys.h"
 
 #include "test/providers/provider_test_utils.h"
 #include "test/util/include/default_providers.h"
@@ -583,6 +584,105 @@ TEST(Loop, InfiniteLoopTermination) {
   terminator_thread.join();
 }
 
+// Run a Loop with scan output compression enabled and slices large and sparse enough to take the
+// compressed path, and check the concatenated output is bit-identical to the uncompressed result.
+TEST(Loop, ScanOutputCompression) {
+  constexpr int64_t kSliceElements = 16384;  // 64KB of floats, the minimum eligible slice size
+  constexpr int64_t kNumIterations = 3;
+
+  // mostly-zero slice so the zero suppression codec clears its 1/8 savings probe, with scattered
+  // non-zero values so a bug that just zero fills the output would be caught
+  std::vector<float> slice(kSliceElements, 0.f);
+  for (int64_t i = 0; i < kSliceElements; i += 509) {
+    slice[i] = 1.5f + static_cast<float>(i);
+  }
+
+  auto create_subgraph = [&slice](const RunOptions&) {
+    Model model("Loop scan output compression subgraph", false, DefaultLoggingManager().DefaultLogger());
+    auto& graph = model.MainGraph();
+
+    /*  Inputs: iter_num, cond_in, loop_var_0_in
+
+         iter_num_in   cond_in   loop_var_0_in
+          (unused)        |           |
+                      [Identity]  [Identity]   [Constant]
+                          |           |            |
+                       cond_out  loop_var_0_out scan_out
+    */
+
+    TypeProto int64_scalar;
+    int64_scalar.mutable_tensor_type()->set_elem_type(TensorProto_DataType_INT64);
+    int64_scalar.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(1);
+
+    TypeProto bool_scalar;
+    bool_scalar.mutable_tensor_type()->set_elem_type(TensorProto_DataType_BOOL);
+    bool_scalar.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(1);
+
+    TypeProto float_tensor;
+    float_tensor.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+    float_tensor.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(1);
+
+    TypeProto float_slice;
+    float_slice.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+    float_slice.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(kSliceElements);
+
+    auto& iter_num_in = graph.GetOrCreateNodeArg("iter_num_in", &int64_scalar);
+    auto& cond_in = graph.GetOrCreateNodeArg("cond_in", &bool_scalar);
+    auto& loop_var_0_in = graph.GetOrCreateNodeArg("loop_var_0_in", &float_tensor);
+
+    auto& cond_out = graph.GetOrCreateNodeArg("cond_out", &bool_scalar);
+    auto& loop_var_0_out = graph.GetOrCreateNodeArg("loop_var_0_out", &float_tensor);
+    auto& scan_out = graph.GetOrCreateNodeArg("scan_out", &float_slice);
+
+    graph.AddNode("cond_in_identity", "Identity", "Forward cond_in to cond_out",
+                  {&cond_in}, {&cond_out});
+    graph.AddNode("loop_var_identity", "Identity", "Forward loop_var_0_in to loop_var_0_out",
+                  {&loop_var_0_in}, {&loop_var_0_out});
+
+    TensorProto slice_tensor;
+    slice_tensor.set_data_type(TensorProto_DataType_FLOAT);
+    slice_tensor.add_dims(kSliceElements);
+    for (float value : slice) {
+      slice_tensor.add_float_data(value);
+    }
+
+    auto& constant_node = graph.AddNode("scan_out_constant", "Constant", "Produce the scan output slice",
+                                        {}, {&scan_out});
+    constant_node.AddAttribute("value", slice_tensor);
+
+    graph.SetInputs({&iter_num_in, &cond_in, &loop_var_0_in});
+    graph.SetOutputs({&cond_out, &loop_var_0_out, &scan_out});
+
+    auto status = graph.Resolve();
+    EXPECT_EQ(status, Status::OK());
+
+    return graph.ToGraphProto();
+  };
+
+  LoopOpTester test{{}, create_subgraph};
+
+  test.AddInput<int64_t>("M", {1}, {kNumIterations});
+  test.AddInput<bool>("cond", {1}, {true});
+  test.AddInput<float>("loop_var_0_orig", {1}, {0.f});
+  test.AddInput<float>("outer_scope_0", {1}, {kOuterNodeAddValue});
+
+  std::vector<float> expected_scan_output;
+  expected_scan_output.reserve(kNumIterations * kSliceElements);
+  for (int64_t i = 0; i < kNumIterations; ++i) {
+    expected_scan_output.insert(expected_scan_output.end(), slice.begin(), slice.end());
+  }
+
+  test.AddOutput<float>("loop_var_0_final", {1}, {0.f});
+  test.AddOutput<float>("scan_out_final", {kNumIterations, kSliceElements}, expected_scan_output);
+  test.AddOutput<int64_t>("outer_scope_0_out", {1}, {int64_t(kOuterNodeAddValue)});
+
+  SessionOptions so;
+  ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsEnableLoopScanOutputCompression, "1"));
+
+  test.Run(so, OpTester::ExpectResult::kExpectSuccess, "",
+           {kTensorrtExecutionProvider, kOpenVINOExecutionProvider});
+}
+
 // Add basic test to trigger types override logic in Graph::InferAndVerifySubgraphTypes as well as
 // type/shape inferencing for subgraph to flow the type/shape info through
 // subgraph.PerformTypeAndShapeInferencing(options).
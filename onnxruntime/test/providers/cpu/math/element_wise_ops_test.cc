@@ -223,6 +223,52 @@ TEST(MathOpTest, Add_float) {
 #endif  // USE_DNNL
 }
 
+TEST(MathOpTest, Add_MLFloat16) {
+  OpTester test("Add", 14);
+  std::vector<int64_t> dims{2, 3};
+  test.AddInput<MLFloat16>("A", dims,
+                           MakeMLFloat16({1.0f, 2.0f, -1.0f, 0.0f, 1.5f, -100.0f}));
+  test.AddInput<MLFloat16>("B", dims,
+                           MakeMLFloat16({-1.0f, 4.5f, 432.5f, 0.0f, 3.5f, 64.0f}));
+  test.AddOutput<MLFloat16>("C", dims,
+                            MakeMLFloat16({0.0f, 6.5f, 431.5f, 0.0f, 5.0f, -36.0f}));
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider});  // TensorRT: fp16 is not enabled by default
+}
+
+TEST(MathOpTest, Add_MLFloat16_Scalar_B) {
+  OpTester test("Add", 14);
+  test.AddInput<MLFloat16>("A", {1, 3},
+                           MakeMLFloat16({1.0f, -2.0f, 3.5f}));
+  test.AddInput<MLFloat16>("B", {},
+                           MakeMLFloat16({0.5f}));
+  test.AddOutput<MLFloat16>("C", {1, 3},
+                            MakeMLFloat16({1.5f, -1.5f, 4.0f}));
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider});  // TensorRT: fp16 is not enabled by default
+}
+
+TEST(MathOpTest, Add_BFloat16_CPU) {
+  OpTester test("Add", 14);
+  std::vector<int64_t> dims{2, 3};
+  test.AddInput<BFloat16>("A", dims,
+                          MakeBFloat16({1.0f, 2.0f, -1.0f, 0.0f, 1.5f, -100.0f}));
+  test.AddInput<BFloat16>("B", dims,
+                          MakeBFloat16({-1.0f, 4.5f, 30.0f, 0.0f, 3.5f, 64.0f}));
+  test.AddOutput<BFloat16>("C", dims,
+                           MakeBFloat16({0.0f, 6.5f, 29.0f, 0.0f, 5.0f, -36.0f}));
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider, kOpenVINOExecutionProvider});  // bf16 not supported
+}
+
+TEST(MathOpTest, Add_BFloat16_Scalar_B) {
+  OpTester test("Add", 14);
+  test.AddInput<BFloat16>("A", {1, 3},
+                          MakeBFloat16({1.0f, -2.0f, 3.5f}));
+  test.AddInput<BFloat16>("B", {},
+                          MakeBFloat16({0.5f}));
+  test.AddOutput<BFloat16>("C", {1, 3},
+                           MakeBFloat16({1.5f, -1.5f, 4.0f}));
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider, kOpenVINOExecutionProvider});  // bf16 not supported
+}
+
 TEST(MathOpTest, Add_double) {
   OpTester test("Add");
   std::vector<int64_t> dims{3, 3};
@@ -579,6 +625,30 @@ TEST(MathOpTest, Sub) {
 #endif
 }
 
+TEST(MathOpTest, Sub_MLFloat16) {
+  OpTester test("Sub", 14);
+  std::vector<int64_t> dims{2, 3};
+  test.AddInput<MLFloat16>("A", dims,
+                           MakeMLFloat16({1.0f, 2.0f, -1.0f, 0.0f, 1.5f, -100.0f}));
+  test.AddInput<MLFloat16>("B", dims,
+                           MakeMLFloat16({-1.0f, 4.5f, 432.5f, 0.0f, 3.5f, 64.0f}));
+  test.AddOutput<MLFloat16>("C", dims,
+                            MakeMLFloat16({2.0f, -2.5f, -433.5f, 0.0f, -2.0f, -164.0f}));
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider});  // TensorRT: fp16 is not enabled by default
+}
+
+TEST(MathOpTest, Sub_BFloat16_CPU) {
+  OpTester test("Sub", 14);
+  std::vector<int64_t> dims{2, 3};
+  test.AddInput<BFloat16>("A", dims,
+                          MakeBFloat16({1.0f, 2.0f, -1.0f, 0.0f, 1.5f, -100.0f}));
+  test.AddInput<BFloat16>("B", dims,
+                          MakeBFloat16({-1.0f, 4.5f, 30.0f, 0.0f, 3.5f, 64.0f}));
+  test.AddOutput<BFloat16>("C", dims,
+                           MakeBFloat16({2.0f, -2.5f, -31.0f, 0.0f, -2.0f, -164.0f}));
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider, kOpenVINOExecutionProvider});  // bf16 not supported
+}
+
 TEST(MathOpTest, Sub_Broadcast_Scalar) {
   auto run = [](bool scalar_as_initializer) {
     OpTester test("Sub");
@@ -634,6 +704,30 @@ TEST(MathOpTest, Mul) {
 #endif
 }
 
+TEST(MathOpTest, Mul_MLFloat16) {
+  OpTester test("Mul", 14);
+  std::vector<int64_t> dims{2, 3};
+  test.AddInput<MLFloat16>("A", dims,
+                           MakeMLFloat16({1.0f, 2.0f, -1.0f, 0.0f, 1.5f, -100.0f}));
+  test.AddInput<MLFloat16>("B", dims,
+                           MakeMLFloat16({-1.0f, 4.5f, 432.0f, 0.0f, 3.5f, 64.0f}));
+  test.AddOutput<MLFloat16>("C", dims,
+                            MakeMLFloat16({-1.0f, 9.0f, -432.0f, 0.0f, 5.25f, -6400.0f}));
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider});  // TensorRT: fp16 is not enabled by default
+}
+
+TEST(MathOpTest, Mul_BFloat16_CPU) {
+  OpTester test("Mul", 14);
+  std::vector<int64_t> dims{2, 3};
+  test.AddInput<BFloat16>("A", dims,
+                          MakeBFloat16({1.0f, 2.0f, -1.0f, 0.0f, 1.5f, -100.0f}));
+  test.AddInput<BFloat16>("B", dims,
+                          MakeBFloat16({-1.0f, 4.5f, 30.0f, 0.0f, 3.5f, 64.0f}));
+  test.AddOutput<BFloat16>("C", dims,
+                           MakeBFloat16({-1.0f, 9.0f, -30.0f, 0.0f, 5.25f, -6400.0f}));
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider, kOpenVINOExecutionProvider});  // bf16 not supported
+}
+
 TEST(MathOpTest, Div_int32) {
   OpTester test("Div");
   test.AddInput<int32_t>("A", {3}, {4, 8, 8});
@@ -670,6 +764,30 @@ TEST(MathOpTest, Div) {
 #endif
 }
 
+TEST(MathOpTest, Div_MLFloat16) {
+  OpTester test("Div", 14);
+  std::vector<int64_t> dims{2, 3};
+  test.AddInput<MLFloat16>("A", dims,
+                           MakeMLFloat16({1000.0f, 1.0f, 6.0f, 0.0f, -10.0f, -1.0f}));
+  test.AddInput<MLFloat16>("B", dims,
+                           MakeMLFloat16({1000.0f, 2.0f, 3.0f, 1.0f, -1.0f, 4.0f}));
+  test.AddOutput<MLFloat16>("C", dims,
+                            MakeMLFloat16({1.0f, 0.5f, 2.0f, 0.0f, 10.0f, -0.25f}));
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider});  // TensorRT: fp16 is not enabled by default
+}
+
+TEST(MathOpTest, Div_BFloat16_CPU) {
+  OpTester test("Div", 14);
+  std::vector<int64_t> dims{2, 3};
+  test.AddInput<BFloat16>("A", dims,
+                          MakeBFloat16({1000.0f, 1.0f, 6.0f, 0.0f, -10.0f, -1.0f}));
+  test.AddInput<BFloat16>("B", dims,
+                          MakeBFloat16({1000.0f, 2.0f, 3.0f, 1.0f, -1.0f, 4.0f}));
+  test.AddOutput<BFloat16>("C", dims,
+                           MakeBFloat16({1.0f, 0.5f, 2.0f, 0.0f, 10.0f, -0.25f}));
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider, kOpenVINOExecutionProvider});  // bf16 not supported
+}
+
 TEST(MathOpTest, Abs) {
   OpTester test("Abs");
   std::vector<int64_t> dims{2, 2};
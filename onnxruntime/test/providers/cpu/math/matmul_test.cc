@@ -2,8 +2,10 @@
 // Licensed under the MIT License.
 
 #include "gtest/gtest.h"
+#include "core/session/onnxruntime_session_options_config_keys.h"
 #include "test/providers/provider_test_utils.h"
 #include "test/providers/run_options_config_keys.h"
+#include "test/util/include/asserts.h"
 #include "test/common/dnnl_op_test_utils.h"
 #include "test/common/cuda_op_test_utils.h"
 #include "test/common/tensor_op_test_utils.h"
@@ -318,6 +320,39 @@ TEST(MathOpTest, MatMul_bfloat16) {
 }
 #endif
 
+TEST(MathOpTest, MatMulRuntimePackedBCache) {
+  // B is a regular runtime input rather than an initializer, so it cannot be prepacked at
+  // session initialization; with the cache enabled it is packed on first use instead and the
+  // gemm runs against the packed copy. The 2-D B is broadcast across A's batch.
+  OpTester test("MatMul");
+
+  test.AddInput<float>("A", {2, 2, 4},
+                       {1.0f, 2.0f, 3.0f, 4.0f,
+                        -1.0f, -2.0f, -3.0f, -4.0f,
+                        0.0f, 1.0f, 0.0f, 1.0f,
+                        2.0f, 0.0f, 2.0f, 0.0f});
+  test.AddInput<float>("B", {4, 3},
+                       {1.0f, 1.0f, 1.0f,
+                        2.0f, 2.0f, 2.0f,
+                        3.0f, 3.0f, 3.0f,
+                        4.0f, 4.0f, 4.0f});
+  test.AddOutput<float>("Y", {2, 2, 3},
+                        {30.0f, 30.0f, 30.0f,
+                         -30.0f, -30.0f, -30.0f,
+                         6.0f, 6.0f, 6.0f,
+                         8.0f, 8.0f, 8.0f});
+
+  SessionOptions so;
+  ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsMatMulRuntimePackedBCache, "1"));
+
+  std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
+  execution_providers.push_back(DefaultCpuExecutionProvider());
+
+  test.Config(so)
+      .ConfigEps(std::move(execution_providers))
+      .RunWithConfig();
+}
+
 #ifndef ENABLE_TRAINING
 // Prepacking is disabled in full training build so no need to test the feature in a training build.
 TEST(MathOpTest, MatMulSharedPrepackedWeights) {
@@ -49,7 +49,6 @@ TEST(SoftmaxOperator, Simple) {
   RunTest(x_vals, expected_vals, dimensions);
 }
 
-#if defined(USE_CUDA) || defined(USE_ROCM)
 TEST(SoftmaxOperator, Simple_fp16) {
 #ifdef USE_CUDA
   int min_cuda_architecture = 530;
@@ -76,7 +75,6 @@ TEST(SoftmaxOperator, Simple_fp16) {
   test.AddOutput<MLFloat16>("Y", dimensions, f_Y);
   test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider, kOpenVINOExecutionProvider});
 }
-#endif
 
 #if defined(USE_CUDA) || defined(USE_ROCM) || defined(USE_DNNL)
 TEST(SoftmaxOperator, Simple_bfloat16) {
@@ -112,6 +110,17 @@ TEST(SoftmaxOperator, Simple_bfloat16) {
 }
 #endif  //  USE_CUDA USE_ROCM USE_DNNL
 
+TEST(SoftmaxOperator, Simple_bfloat16_CPU) {
+  OpTester test("Softmax", 14);
+
+  int64_t axis = 1;
+  test.AddAttribute("axis", axis);
+
+  test.AddInput<BFloat16>("X", {1, 3}, MakeBFloat16({-1.0f, 0.0f, 1.0f}));
+  test.AddOutput<BFloat16>("Y", {1, 3}, MakeBFloat16({0.09003058f, 0.24472848f, 0.66524094f}));
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider, kOpenVINOExecutionProvider});
+}
+
 TEST(SoftmaxOperator, LargeNumber) {
   // x = np.array([[0, 1, 2, 3], [10000, 10001, 10002, 10003]]).astype(np.float32)
   // expected output[[0.0320586, 0.08714432, 0.23688284, 0.64391428],
@@ -814,6 +814,39 @@ TEST(TopKOperator, Top3AllSame) {
   top_3_explicit_axis<double>(11, 0);
 }
 
+template <typename T>
+static void TestFilteredScan(int64_t k, int64_t n, int64_t largest) {
+  // scatter the values so the winners are spread over the blocks of the filtered scan
+  std::vector<T> input_vals(n);
+  for (int64_t i = 0; i < n; ++i)
+    input_vals[i] = static_cast<T>((i * 37) % n);
+
+  std::vector<int64_t> order(n);
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(), [&input_vals, largest](int64_t a, int64_t b) {
+    return largest == 1 ? input_vals[a] > input_vals[b] : input_vals[a] < input_vals[b];
+  });
+
+  std::vector<T> expected_vals(k);
+  std::vector<int64_t> expected_indices(k);
+  for (int64_t i = 0; i < k; ++i) {
+    expected_indices[i] = order[i];
+    expected_vals[i] = input_vals[order[i]];
+  }
+
+  std::vector<int64_t> input_dimensions = {n};
+  std::vector<int64_t> expected_dimensions = {k};
+  RunTest(11, k, input_vals, input_dimensions, expected_vals, expected_indices, expected_dimensions, false, 0, largest);
+}
+
+// rows of 1024 or more contiguous elements with a small k take the block-filtered scan path
+TEST(TopKOperator, FilteredScanLargeArray) {
+  TestFilteredScan<float>(7, 1300, 1);
+  TestFilteredScan<float>(7, 1300, 0);
+  TestFilteredScan<double>(7, 1300, 1);
+  TestFilteredScan<double>(7, 1300, 0);
+}
+
 template <typename T>
 static void TestThreaded(int64_t k, int64_t n, int64_t batch_size) {
   std::vector<T> input_vals(n * batch_size, 0.0f);
@@ -760,5 +760,65 @@ TEST(MLOpTest, TreeRegressorTrueNodeBeforeNode) {
   test.Run();
 }
 
+TEST(MLOpTest, TreeRegressorDeepTreeChain) {
+  // A single tree deeper than the flattened branch-free layout supports (a chain of 10
+  // BRANCH_LEQ nodes), so the evaluation falls back to the pointer-chasing path.
+  OpTester test("TreeEnsembleRegressor", 3, onnxruntime::kMLDomain);
+
+  constexpr int n_internal = 10;
+  int64_t n_targets = 1;
+  std::vector<int64_t> nodes_featureids, nodes_treeids, nodes_nodeids, nodes_falsenodeids, nodes_truenodeids;
+  std::vector<std::string> nodes_modes;
+  std::vector<float> nodes_values;
+  std::vector<int64_t> target_ids, target_nodeids, target_treeids;
+  std::vector<float> target_weights;
+
+  // Internal node i (node id 2i) tests x0 <= i + 1; true goes to a leaf (node id 2i + 1) with
+  // weight (i + 1) * 10, false continues the chain, ending in a leaf (node id 2 * n_internal).
+  for (int i = 0; i < n_internal; ++i) {
+    nodes_featureids.insert(nodes_featureids.end(), {0, 0});
+    nodes_treeids.insert(nodes_treeids.end(), {0, 0});
+    nodes_nodeids.insert(nodes_nodeids.end(), {2 * i, 2 * i + 1});
+    nodes_falsenodeids.insert(nodes_falsenodeids.end(), {2 * (i + 1), 0});
+    nodes_truenodeids.insert(nodes_truenodeids.end(), {2 * i + 1, 0});
+    nodes_modes.insert(nodes_modes.end(), {"BRANCH_LEQ", "LEAF"});
+    nodes_values.insert(nodes_values.end(), {static_cast<float>(i + 1), 0.f});
+    target_ids.push_back(0);
+    target_nodeids.push_back(2 * i + 1);
+    target_treeids.push_back(0);
+    target_weights.push_back(static_cast<float>((i + 1) * 10));
+  }
+  nodes_featureids.push_back(0);
+  nodes_treeids.push_back(0);
+  nodes_nodeids.push_back(2 * n_internal);
+  nodes_falsenodeids.push_back(0);
+  nodes_truenodeids.push_back(0);
+  nodes_modes.push_back("LEAF");
+  nodes_values.push_back(0.f);
+  target_ids.push_back(0);
+  target_nodeids.push_back(2 * n_internal);
+  target_treeids.push_back(0);
+  target_weights.push_back(999.f);
+
+  test.AddAttribute("nodes_truenodeids", nodes_truenodeids);
+  test.AddAttribute("nodes_falsenodeids", nodes_falsenodeids);
+  test.AddAttribute("nodes_treeids", nodes_treeids);
+  test.AddAttribute("nodes_nodeids", nodes_nodeids);
+  test.AddAttribute("nodes_featureids", nodes_featureids);
+  test.AddAttribute("nodes_values", nodes_values);
+  test.AddAttribute("nodes_modes", nodes_modes);
+  test.AddAttribute("target_treeids", target_treeids);
+  test.AddAttribute("target_nodeids", target_nodeids);
+  test.AddAttribute("target_ids", target_ids);
+  test.AddAttribute("target_weights", target_weights);
+  test.AddAttribute("n_targets", n_targets);
+
+  std::vector<float> X = {0.5f, 5.5f, 9.5f, 100.f};
+  std::vector<float> Y = {10.f, 60.f, 100.f, 999.f};
+  test.AddInput<float>("X", {4, 1}, X);
+  test.AddOutput<float>("Y", {4, 1}, Y);
+  test.Run();
+}
+
 }  // namespace test
 }  // namespace onnxruntime
@@ -383,5 +383,37 @@ TEST(NonMaxSuppressionOpTest, WithIOUThresholdOpset11) {
   test.Run();
 }
 
+// enough boxes to take the grid-bucketed selection path in the CPU kernel (>= 512 boxes).
+// boxes come in pairs that overlap well above the threshold, so the higher scoring box of each
+// pair is kept and the other suppressed; pairs are spaced out so they don't affect each other.
+TEST(NonMaxSuppressionOpTest, ManyBoxesGridPath) {
+  constexpr int64_t num_pairs = 300;
+  constexpr int64_t num_boxes = num_pairs * 2;
+
+  std::vector<float> boxes;
+  std::vector<float> scores;
+  boxes.reserve(num_boxes * 4);
+  scores.reserve(num_boxes);
+  std::vector<int64_t> expected;
+  expected.reserve(num_pairs * 3);
+
+  for (int64_t p = 0; p < num_pairs; ++p) {
+    const float x = static_cast<float>(p) * 20.0f;
+    boxes.insert(boxes.end(), {0.0f, x, 10.0f, x + 10.0f});
+    boxes.insert(boxes.end(), {0.0f, x + 1.0f, 10.0f, x + 11.0f});
+    scores.push_back(0.9f);
+    scores.push_back(0.8f);
+    expected.insert(expected.end(), {0L, 0L, p * 2});
+  }
+
+  OpTester test("NonMaxSuppression", 11, kOnnxDomain);
+  test.AddInput<float>("boxes", {1, num_boxes, 4}, boxes);
+  test.AddInput<float>("scores", {1, 1, num_boxes}, scores);
+  test.AddInput<int64_t>("max_output_boxes_per_class", {}, {num_boxes});
+  test.AddInput<float>("iou_threshold", {}, {0.5f});
+  test.AddOutput<int64_t>("selected_indices", {num_pairs, 3}, expected);
+  test.Run();
+}
+
 }  // namespace test
 }  // namespace onnxruntime
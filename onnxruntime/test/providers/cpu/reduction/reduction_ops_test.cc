@@ -5246,6 +5246,26 @@ TEST(ReductionOpTest, ReduceMean_RKRK_keepdims) {
   test.Run();
 }
 
+TEST(ReductionOpTest, ReduceMean_KRKR) {
+  OpTester test("ReduceMean");
+  test.AddAttribute("axes", std::vector<int64_t>{1, 3});
+  test.AddAttribute("keepdims", (int64_t)0);
+  test.AddInput<float>("data", {2, 2, 2, 3},
+                       {1.0f, 2.0f, 3.0f,
+                        4.0f, 5.0f, 6.0f,
+
+                        7.0f, 8.0f, 9.0f,
+                        10.0f, 11.0f, 12.0f,
+
+                        13.0f, 14.0f, 15.0f,
+                        16.0f, 17.0f, 18.0f,
+
+                        19.0f, 20.0f, 21.0f,
+                        22.0f, 23.0f, 24.0f});
+  test.AddOutput<float>("reduced", {2, 2}, {5.f, 8.f, 17.f, 20.f});
+  test.Run();
+}
+
 TEST(ReductionOpTest, ReduceMin_KR) {
   OpTester test("ReduceMin");
   test.AddAttribute("axes", std::vector<int64_t>{1});
@@ -5936,6 +5956,46 @@ TEST(ReductionOpTest, ReduceSum_RKRK_keepdims) {
   test.Run();
 }
 
+TEST(ReductionOpTest, ReduceSum_KRKR) {
+  OpTester test("ReduceSum");
+  test.AddAttribute("axes", std::vector<int64_t>{1, 3});
+  test.AddAttribute("keepdims", (int64_t)0);
+  test.AddInput<float>("data", {2, 2, 2, 3},
+                       {1.0f, 2.0f, 3.0f,
+                        4.0f, 5.0f, 6.0f,
+
+                        7.0f, 8.0f, 9.0f,
+                        10.0f, 11.0f, 12.0f,
+
+                        13.0f, 14.0f, 15.0f,
+                        16.0f, 17.0f, 18.0f,
+
+                        19.0f, 20.0f, 21.0f,
+                        22.0f, 23.0f, 24.0f});
+  test.AddOutput<float>("reduced", {2, 2}, {30.f, 48.f, 102.f, 120.f});
+  test.Run();
+}
+
+TEST(ReductionOpTest, ReduceSum_KRKR_keepdims) {
+  OpTester test("ReduceSum");
+  test.AddAttribute("axes", std::vector<int64_t>{1, 3});
+  test.AddAttribute("keepdims", (int64_t)1);
+  test.AddInput<float>("data", {2, 2, 2, 3},
+                       {1.0f, 2.0f, 3.0f,
+                        4.0f, 5.0f, 6.0f,
+
+                        7.0f, 8.0f, 9.0f,
+                        10.0f, 11.0f, 12.0f,
+
+                        13.0f, 14.0f, 15.0f,
+                        16.0f, 17.0f, 18.0f,
+
+                        19.0f, 20.0f, 21.0f,
+                        22.0f, 23.0f, 24.0f});
+  test.AddOutput<float>("reduced", {2, 1, 2, 1}, {30.f, 48.f, 102.f, 120.f});
+  test.Run();
+}
+
 void test_empty_set(const std::string& op, int opset, bool axes_as_input, float empty_value) {
   OpTester test(op, opset);
   std::vector<int64_t> input_shape = {2, 0, 4};
@@ -369,6 +369,34 @@ TEST(GatherOpTest, Gather_perf) {
   test.Run();
 }
 
+TEST(GatherOpTest, Gather_axis0_large_indices) {
+  // More indices than one translation batch (see kGatherIndexBatch in gather.cc)
+  // with varied and negative values, so batched offsets and prefetch are exercised.
+  OpTester test("Gather", 11);
+  test.AddAttribute<int64_t>("axis", 0LL);
+  constexpr int64_t kRows = 97;
+  constexpr int64_t kCols = 5;
+  constexpr int64_t kIndices = 150;
+  std::vector<float> input(kRows * kCols);
+  for (size_t i = 0; i < input.size(); ++i) {
+    input[i] = static_cast<float>(i);
+  }
+  std::vector<int64_t> indices(kIndices);
+  std::vector<float> output(kIndices * kCols);
+  for (int64_t i = 0; i < kIndices; ++i) {
+    int64_t row = (i * 31) % kRows;
+    indices[i] = (i % 3 == 0) ? row - kRows : row;
+    for (int64_t j = 0; j < kCols; ++j) {
+      output[i * kCols + j] = static_cast<float>(row * kCols + j);
+    }
+  }
+  test.AddInput<float>("data", {kRows, kCols}, input);
+  test.AddInput<int64_t>("indices", {kIndices}, indices);
+  test.AddOutput<float>("output", {kIndices, kCols}, output);
+  // OpenVINO EP: Disabled due to accuracy issues
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider, kOpenVINOExecutionProvider});
+}
+
 TEST(GatherOpTest, Gather_axis1_neg_indices2d_int8) {
   OpTester test("Gather", 11);
   test.AddAttribute<int64_t>("axis", 1LL);
@@ -191,6 +191,18 @@ TEST(ScatterNDOpTest, ScatterND_18_add) {
   test1.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider, kOpenVINOExecutionProvider});
 }
 
+TEST(ScatterNDOpTest, ScatterND_18_add_duplicate_indices) {
+  // Scalar destination slices with every index duplicated; the reduction path groups updates by
+  // destination offset so duplicates accumulate correctly regardless of thread partitioning.
+  OpTester test1("ScatterND", 18);
+  test1.AddAttribute("reduction", "add");
+  test1.AddInput<float>("data", {4}, {1.0f, 2.0f, 3.0f, 4.0f});
+  test1.AddInput<int64_t>("indices", {8, 1}, {3, 0, 1, 0, 2, 1, 0, 3});
+  test1.AddInput<float>("updates", {8}, {1.0f, 2.0f, 4.0f, 8.0f, 16.0f, 32.0f, 64.0f, 128.0f});
+  test1.AddOutput<float>("output", {4}, {75.0f, 38.0f, 19.0f, 133.0f});
+  test1.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider, kOpenVINOExecutionProvider});
+}
+
 TEST(ScatterNDOpTest, ScatterND_18_mul) {
   OpTester test1("ScatterND", 18);
   test1.AddAttribute("reduction", "mul");
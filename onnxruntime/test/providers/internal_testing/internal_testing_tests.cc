@@ -256,6 +256,59 @@ TEST(InternalTestingEP, TestNhwcConversionOfStaticKernels) {
   run_test(ort_model_path);
 }
 
+TEST(InternalTestingEP, TestSaveOrtFormatModelWithAppliedLayoutTransformation) {
+  const ORTCHAR_T* onnx_model_path = ORT_MODEL_FOLDER "transform/fusion/conv_relu_opset12.onnx";
+  const ORTCHAR_T* ort_model_path =
+      ORT_MODEL_FOLDER "transform/fusion/conv_relu_opset12.layout_transformed.test_output.ort";
+
+  const std::unordered_set<std::string> supported_ops{"Conv"};
+  auto make_ep = [&supported_ops]() {
+    auto ep = std::make_unique<InternalTestingExecutionProvider>(supported_ops,
+                                                                 std::unordered_set<std::string>{},
+                                                                 DataLayout::NHWC);
+    ep->EnableStaticKernels();
+    return ep;
+  };
+
+  // save an ORT format model with the layout transformation applied up front
+  {
+    SessionOptions so;
+    so.optimized_model_filepath = ort_model_path;
+    ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsConfigSaveModelFormat, "ORT"));
+    ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsSaveOrtFormatApplyLayoutTransformation, "1"));
+
+    InferenceSessionWrapper session(so, GetEnvironment());
+    ASSERT_STATUS_OK(session.RegisterExecutionProvider(make_ep()));
+    ASSERT_STATUS_OK(session.Load(onnx_model_path));
+    ASSERT_STATUS_OK(session.Initialize());
+
+    // the graph that was saved should already contain the NHWC conversion
+    for (const auto& node : session.GetGraph().Nodes()) {
+      if (node.OpType() == "Conv") {
+        ASSERT_EQ(node.Domain(), kMSInternalNHWCDomain);
+      }
+    }
+  }
+
+  // when reloading, the Conv nodes are NHWC before Initialize runs, so no load-time layout rewriting is needed
+  {
+    SessionOptions so;
+    ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsConfigLoadModelFormat, "ORT"));
+
+    InferenceSessionWrapper session(so, GetEnvironment());
+    ASSERT_STATUS_OK(session.RegisterExecutionProvider(make_ep()));
+    ASSERT_STATUS_OK(session.Load(ort_model_path));
+
+    for (const auto& node : session.GetGraph().Nodes()) {
+      if (node.OpType() == "Conv") {
+        ASSERT_EQ(node.Domain(), kMSInternalNHWCDomain);
+      }
+    }
+
+    ASSERT_STATUS_OK(session.Initialize());
+  }
+}
+
 // This test can be deprecated now as the code logic has been changed so the model is not applicable
 // TEST(InternalTestingEP, TestRegisterAllocatorHandlesUsageInMultipleSessions) {
 //}
@@ -389,6 +389,44 @@ TEST(XnnpackEP, TestQDQSoftMax_axisLast) {
                {ExpectedEPNodeAssignment::All});
 }
 
+TEST(XnnpackEP, TestAdd_Broadcast) {
+  auto modelCreater = [](ModelTestBuilder& builder) {
+    auto* input0_arg = builder.MakeInput<float>({1, 2, 3, 5}, -10.f, 10.f);
+    auto* input1_arg = builder.MakeInput<float>({3, 5}, -10.f, 10.f);
+    auto* output_arg = builder.MakeOutput();
+    builder.AddNode("Add", {input0_arg, input1_arg}, {output_arg});
+  };
+  RunModelTest(modelCreater,
+               "xnnpack_test_graph_add",
+               {ExpectedEPNodeAssignment::All});
+}
+
+TEST(XnnpackEP, TestMul) {
+  auto modelCreater = [](ModelTestBuilder& builder) {
+    auto* input0_arg = builder.MakeInput<float>({1, 2, 3, 5}, -10.f, 10.f);
+    auto* input1_arg = builder.MakeInput<float>({1, 2, 3, 5}, -10.f, 10.f);
+    auto* output_arg = builder.MakeOutput();
+    builder.AddNode("Mul", {input0_arg, input1_arg}, {output_arg});
+  };
+  RunModelTest(modelCreater,
+               "xnnpack_test_graph_mul",
+               {ExpectedEPNodeAssignment::All});
+}
+
+TEST(XnnpackEP, TestQDQAdd_u8) {
+  RunModelTest(BuildBinaryOpTestCase<uint8_t, uint8_t, uint8_t>({1, 2, 3, 32} /* input_shape */, "Add"),
+               "xnnpack_qdq_test_graph_add",
+               {ExpectedEPNodeAssignment::All,
+                0.2f /* fp32_abs_err */});
+}
+
+TEST(XnnpackEP, TestQDQMul_s8) {
+  RunModelTest(BuildBinaryOpTestCase<int8_t, int8_t, int8_t>({1, 2, 3, 32} /* input_shape */, "Mul"),
+               "xnnpack_qdq_test_graph_mul",
+               {ExpectedEPNodeAssignment::All,
+                0.2f /* fp32_abs_err */});
+}
+
 TEST(XnnpackEP, TestConvTranspose) {
   // Conv+ConvTranspose with attributes of Group and Dilation
   const ORTCHAR_T* ort_model_path = ORT_MODEL_FOLDER "test_conv_follow_convtrans.onnx";
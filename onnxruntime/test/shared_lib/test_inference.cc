@@ -498,6 +498,69 @@ INSTANTIATE_TEST_SUITE_P(CApiTestWithProviders,
                          CApiTestWithProvider,
                          ::testing::Values(0, 1, 2, 3, 4));
 
+TEST(CApiTest, SessionOptionsSnapshotRoundTrip) {
+  const auto& api = Ort::GetApi();
+
+  Ort::SessionOptions session_options;
+  session_options.SetIntraOpNumThreads(3);
+  session_options.SetExecutionMode(ORT_PARALLEL);
+  session_options.SetGraphOptimizationLevel(ORT_ENABLE_BASIC);
+  session_options.AddConfigEntry(kOrtSessionOptionsConfigUseEnvAllocators, "1");
+  session_options.AddFreeDimensionOverrideByName("batch", 4);
+
+  OrtAllocator* allocator = nullptr;
+  Ort::ThrowOnError(api.GetAllocatorWithDefaultOptions(&allocator));
+
+  void* snapshot = nullptr;
+  size_t snapshot_size = 0;
+  Ort::ThrowOnError(api.SessionOptionsToSnapshot(session_options, allocator, &snapshot, &snapshot_size));
+  ASSERT_NE(snapshot, nullptr);
+  ASSERT_GT(snapshot_size, size_t{0});
+
+  OrtSessionOptions* restored_raw = nullptr;
+  Ort::ThrowOnError(api.CreateSessionOptionsFromSnapshot(snapshot, snapshot_size, &restored_raw));
+  Ort::SessionOptions restored{restored_raw};
+
+  int has_entry = 0;
+  Ort::ThrowOnError(api.HasSessionConfigEntry(restored, kOrtSessionOptionsConfigUseEnvAllocators, &has_entry));
+  ASSERT_EQ(has_entry, 1);
+
+  // the restored options must be usable to create a session
+  Ort::Session session(*ort_env, NAMED_AND_ANON_DIM_PARAM_URI, restored);
+
+  // truncated blobs are rejected, not trusted
+  OrtSessionOptions* bogus = nullptr;
+  OrtStatus* status = api.CreateSessionOptionsFromSnapshot(snapshot, snapshot_size / 2, &bogus);
+  ASSERT_NE(status, nullptr);
+  ASSERT_EQ(api.GetErrorCode(status), ORT_INVALID_ARGUMENT);
+  api.ReleaseStatus(status);
+
+  allocator->Free(allocator, snapshot);
+}
+
+static void ORT_API_CALL NoOpUserLoggingFunction(void* /*param*/, OrtLoggingLevel /*severity*/,
+                                                 const char* /*category*/, const char* /*logid*/,
+                                                 const char* /*code_location*/, const char* /*message*/) {
+}
+
+TEST(CApiTest, SessionOptionsSnapshotRejectsUnserializableState) {
+  const auto& api = Ort::GetApi();
+
+  // a user logging callback is a process-local pointer and cannot round-trip through bytes
+  Ort::SessionOptions session_options;
+  Ort::ThrowOnError(api.SetUserLoggingFunction(session_options, NoOpUserLoggingFunction, nullptr));
+
+  OrtAllocator* allocator = nullptr;
+  Ort::ThrowOnError(api.GetAllocatorWithDefaultOptions(&allocator));
+
+  void* snapshot = nullptr;
+  size_t snapshot_size = 0;
+  OrtStatus* status = api.SessionOptionsToSnapshot(session_options, allocator, &snapshot, &snapshot_size);
+  ASSERT_NE(status, nullptr);
+  ASSERT_EQ(api.GetErrorCode(status), ORT_INVALID_ARGUMENT);
+  api.ReleaseStatus(status);
+}
+
 #if !defined(DISABLE_SPARSE_TENSORS)
 TEST(CApiTest, SparseOutputModel) {
   std::vector<int64_t> dense_shape{3, 3};
@@ -2675,6 +2738,34 @@ TEST(CApiTest, fill_string_tensor_directly) {
   }
 }
 
+TEST(CApiTest, fill_string_tensor_from_offsets) {
+  // concatenation of {"abc", "", "kmp"}; the empty element and the embedded range bounds are the
+  // interesting cases for the offset-based fill
+  constexpr const char* buffer = "abckmp";
+  constexpr size_t offsets[] = {0, 3, 3, 6};
+  constexpr int64_t expected_len = 3;
+  const std::string expected[] = {"abc", "", "kmp"};
+
+  MockedOrtAllocator default_allocator;
+  Ort::Value tensor = Ort::Value::CreateTensor(&default_allocator, &expected_len, 1U,
+                                               ONNX_TENSOR_ELEMENT_DATA_TYPE_STRING);
+
+  Ort::ThrowOnError(Ort::GetApi().FillStringTensorFromOffsets(tensor, buffer, 6, offsets, 4));
+
+  for (size_t i = 0; i < expected_len; i++) {
+    auto element = tensor.GetStringTensorElement(i);
+    ASSERT_EQ(expected[i], element);
+  }
+
+  // offsets count must be element count + 1
+  Ort::Status bad_count{Ort::GetApi().FillStringTensorFromOffsets(tensor, buffer, 6, offsets, 3)};
+  ASSERT_FALSE(bad_count.IsOK());
+  // offsets must stay within the buffer
+  constexpr size_t out_of_range_offsets[] = {0, 3, 3, 7};
+  Ort::Status out_of_range{Ort::GetApi().FillStringTensorFromOffsets(tensor, buffer, 6, out_of_range_offsets, 4)};
+  ASSERT_FALSE(out_of_range.IsOK());
+}
+
 TEST(CApiTest, get_string_tensor_element) {
   const char* s[] = {"abc", "kmp"};
   constexpr int64_t expected_len = 2;
@@ -80,6 +80,14 @@ void KernelTwo(OrtKernelContext* context,
   auto Y_raw = Y.Allocate(shape);
   std::vector<float> floats(static_cast<size_t>(X.NumberOfElement()), 0.f);
 
+  // test the bulk input snapshot: one call, views aliasing the input's data and shape
+  OrtTensorView views[1];
+  Ort::ThrowOnError(Ort::GetApi().KernelContext_GetInputViews(context, views, 1));
+  CUSTOM_ENFORCE(views[0].data == X_raw, "view should alias the input data");
+  CUSTOM_ENFORCE(views[0].num_dims == shape.size(), "unexpected view rank");
+  CUSTOM_ENFORCE(views[0].num_elements == static_cast<size_t>(X.NumberOfElement()), "unexpected view element count");
+  CUSTOM_ENFORCE(views[0].element_type == ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT, "unexpected view element type");
+
   DataI data_i = {X_raw, floats.data()};
   auto total = std::accumulate(shape.begin(), shape.end(), 1LL, std::multiplies<int64_t>());
 